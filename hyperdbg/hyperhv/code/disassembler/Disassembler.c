@@ -315,6 +315,79 @@ DisassemblerLengthDisassembleEngineInVmxRootOnTargetProcess(PVOID Address, BOOLE
     return DisassemblerLengthDisassembleEngine(SafeMemoryToRead, Is32Bit);
 }
 
+/**
+ * @brief Check whether the instruction is a 'call' or a 'ret' instruction
+ * @details Should be called in VMX-root mode
+ *
+ * @param Address
+ * @param Is32Bit
+ * @param IsRet Whether it's a 'ret' or a 'call'
+ * @param Length Length of the instruction
+ *
+ * @return BOOLEAN TRUE if it's a 'call' or a 'ret' instruction
+ */
+BOOLEAN
+DisassemblerCheckCallOrRetInVmxRootOnTargetProcess(PVOID Address, BOOLEAN Is32Bit, BOOLEAN * IsRet, UINT32 * Length)
+{
+    BYTE                    SafeMemoryToRead[MAXIMUM_INSTR_SIZE] = {0};
+    UINT64                  SizeOfSafeBufferToRead               = 0;
+    ZydisDecoder            Decoder;
+    ZydisDecodedInstruction Instruction;
+    ZydisDecodedOperand     Operands[ZYDIS_MAX_OPERAND_COUNT];
+
+    //
+    // Read the maximum number of instruction that is valid to be read in the
+    // target address
+    //
+    SizeOfSafeBufferToRead = CheckAddressMaximumInstructionLength(Address);
+
+    //
+    // Find the current instruction
+    //
+    MemoryMapperReadMemorySafeOnTargetProcess((UINT64)Address,
+                                              SafeMemoryToRead,
+                                              SizeOfSafeBufferToRead);
+
+    //
+    // Initialize Zydis decoder
+    //
+    if (!ZYAN_SUCCESS(ZydisDecoderInit(&Decoder,
+                                       Is32Bit ? ZYDIS_MACHINE_MODE_LONG_COMPAT_32 : ZYDIS_MACHINE_MODE_LONG_64,
+                                       Is32Bit ? ZYDIS_STACK_WIDTH_32 : ZYDIS_STACK_WIDTH_64)))
+    {
+        return FALSE;
+    }
+
+    if (!ZYAN_SUCCESS(ZydisDecoderDecodeFull(&Decoder,
+                                             SafeMemoryToRead,
+                                             SizeOfSafeBufferToRead,
+                                             &Instruction,
+                                             Operands)))
+    {
+        //
+        // Probably invalid instruction
+        //
+        return FALSE;
+    }
+
+    if (Instruction.mnemonic == ZYDIS_MNEMONIC_CALL)
+    {
+        *IsRet = FALSE;
+    }
+    else if (Instruction.mnemonic == ZYDIS_MNEMONIC_RET)
+    {
+        *IsRet = TRUE;
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    *Length = Instruction.length;
+
+    return TRUE;
+}
+
 /**
  * @brief Shows the disassembly of only one instruction
  * @details Should be called in VMX-root mode
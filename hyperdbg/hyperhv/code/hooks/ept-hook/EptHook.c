@@ -25,15 +25,7 @@ _Success_(return == TRUE)
 static EPT_HOOKED_PAGE_DETAIL *
 EptHookFindByPhysAddress(_In_ UINT64 PhysicalBaseAddress)
 {
-    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
-    {
-        if (CurrEntity->PhysicalBaseAddress == PhysicalBaseAddress)
-        {
-            return CurrEntity;
-        }
-    }
-
-    return NULL;
+    return EptHookIndexFindHookedPage(PhysicalBaseAddress);
 }
 
 /**
@@ -413,6 +405,11 @@ EptHookCreateHookPagePCIECAM(USHORT bus, USHORT device, USHORT function, ULONGLO
             // Add it to the list
             //
             InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
+
+            //
+            // Add it to the index (before applying the hook for the same reason)
+            //
+            EptHookIndexInsertHookedPage(HookedPage);
         }
         //
         // Apply the hook to EPT
@@ -651,6 +648,11 @@ EptHookCreateHookPage(_Inout_ VIRTUAL_MACHINE_STATE * VCpu,
             // Add it to the list
             //
             InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
+
+            //
+            // Add it to the index (before applying the hook for the same reason)
+            //
+            EptHookIndexInsertHookedPage(HookedPage);
         }
 
         //
@@ -731,6 +733,11 @@ EptHookUpdateHookPage(_In_ PVOID                       TargetAddress,
     //
     HookedEntry->CountOfBreakpoints = HookedEntry->CountOfBreakpoints + 1;
 
+    //
+    // Add the breakpoint to the index
+    //
+    EptHookIndexInsertBreakpoint(HookedEntry, (UINT64)TargetAddress);
+
     //
     // Once we set every details, now we can apply the breakpoint on the fake page
     // It should be after setting the above details because the 0xcc might be triggered
@@ -1297,8 +1304,6 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
     PEPT_PML1_ENTRY         TargetPage;
     PEPT_HOOKED_PAGE_DETAIL HookedPage;
     CR3_TYPE                Cr3OfCurrentProcess;
-    PLIST_ENTRY             TempList      = 0;
-    PEPT_HOOKED_PAGE_DETAIL HookedEntry   = NULL;
     BOOLEAN                 UnsetExecute  = FALSE;
     BOOLEAN                 UnsetRead     = FALSE;
     BOOLEAN                 UnsetWrite    = FALSE;
@@ -1361,22 +1366,14 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
     //
     // try to see if we can find the address
     //
-    TempList = &g_EptState->HookedPagesList;
-
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    if (EptHookIndexFindHookedPage(PhysicalBaseAddress) != NULL)
     {
-        TempList    = TempList->Flink;
-        HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-
-        if (HookedEntry->PhysicalBaseAddress == PhysicalBaseAddress)
-        {
-            //
-            // Means that we find the address and !epthook2 doesn't support
-            // multiple breakpoints in on page
-            //
-            VmmCallbackSetLastError(DEBUGGER_ERROR_EPT_MULTIPLE_HOOKS_IN_A_SINGLE_PAGE);
-            return FALSE;
-        }
+        //
+        // Means that we find the address and !epthook2 doesn't support
+        // multiple breakpoints in on page
+        //
+        VmmCallbackSetLastError(DEBUGGER_ERROR_EPT_MULTIPLE_HOOKS_IN_A_SINGLE_PAGE);
+        return FALSE;
     }
 
     //
@@ -1637,6 +1634,11 @@ EptHookPerformPageHookMonitorAndInlineHook(VIRTUAL_MACHINE_STATE * VCpu,
             // Add it to the list
             //
             InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
+
+            //
+            // Add it to the index (before applying the hook for the same reason)
+            //
+            EptHookIndexInsertHookedPage(HookedPage);
         }
 
         //
@@ -2243,6 +2245,7 @@ EptHookUnHookSingleAddressDetoursAndMonitor(PEPT_HOOKED_PAGE_DETAIL
     // remove the entry from the list
     //
     RemoveEntryList(&HookedEntry->PageHookList);
+    EptHookIndexRemoveHookedPage(HookedEntry);
 
     //
     // we add the hooked entry to the list
@@ -2394,6 +2397,7 @@ EptHookUnHookSingleAddressHiddenBreakpoint(PEPT_HOOKED_PAGE_DETAIL             H
                 // remove the entry from the list
                 //
                 RemoveEntryList(&HookedEntry->PageHookList);
+                EptHookIndexRemoveHookedPage(HookedEntry);
 
                 //
                 // we add the hooked entry to the list
@@ -2486,6 +2490,12 @@ EptHookUnHookSingleAddressHiddenBreakpoint(PEPT_HOOKED_PAGE_DETAIL             H
                 //
                 HookedEntry->CountOfBreakpoints = HookedEntry->CountOfBreakpoints - 1;
 
+                //
+                // Remove the breakpoint from the index (if there is no other
+                // breakpoint on the same address)
+                //
+                EptHookIndexRemoveBreakpoint(HookedEntry, VirtualAddress);
+
                 return TRUE;
             }
         }
@@ -2776,6 +2786,11 @@ EptHookUnHookAll()
             LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
         }
     }
+
+    //
+    // None of the hooked pages is valid anymore
+    //
+    EptHookIndexRemoveAll();
 }
 
 /**
@@ -0,0 +1,351 @@
+/**
+ * @file EptHookIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Hash index of the hooked pages and the hidden breakpoints
+ * @details The index is an accelerator for g_EptState->HookedPagesList (the
+ * list is still the owner of the hooked pages), it's changed at the same
+ * points as the list and its storage is allocated once at the initialization
+ * of EPT, so it's safe to be used in vmx-root. If the index ever becomes
+ * full, the lookups walk the list until all of the hooks are removed
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether the index contains all of the hooks or not
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EptHookIndexIsUsable()
+{
+#if UseEptHookHashIndex == TRUE
+    return g_EptState->HookedPagesIndex.Slots != NULL && !g_EptState->IsHookIndexIncomplete;
+#else
+    return FALSE;
+#endif // UseEptHookHashIndex == TRUE
+}
+
+/**
+ * @brief Count the breakpoints of a hooked page on the target address
+ *
+ * @param HookedEntry
+ * @param Address
+ *
+ * @return UINT32
+ */
+static UINT32
+EptHookIndexCountBreakpoints(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT64 Address)
+{
+    UINT32 Count = 0;
+
+    for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+    {
+        if (HookedEntry->BreakpointAddresses[i] == Address)
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Allocate the storage of the index
+ * @details Should be called from vmx non-root (at the initialization of EPT)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookIndexInitialize()
+{
+#if UseEptHookHashIndex == TRUE
+
+    UINT64  PagesIndexSize       = HashIndexGetRequiredSize(EPT_HOOK_INDEX_PAGES_CAPACITY);
+    UINT64  BreakpointsIndexSize = HashIndexGetRequiredSize(EPT_HOOK_INDEX_BREAKPOINTS_CAPACITY);
+    UINT8 * Storage;
+
+    //
+    // Both of the indexes share a single allocation
+    //
+    Storage = PlatformMemAllocateZeroedNonPagedPool(PagesIndexSize + BreakpointsIndexSize);
+
+    if (Storage == NULL)
+    {
+        return FALSE;
+    }
+
+    HashIndexInitialize(&g_EptState->HookedPagesIndex, Storage, EPT_HOOK_INDEX_PAGES_CAPACITY);
+    HashIndexInitialize(&g_EptState->HookedBreakpointsIndex, Storage + PagesIndexSize, EPT_HOOK_INDEX_BREAKPOINTS_CAPACITY);
+
+    g_EptState->IsHookIndexIncomplete = FALSE;
+
+#endif // UseEptHookHashIndex == TRUE
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the storage of the index
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexUninitialize()
+{
+#if UseEptHookHashIndex == TRUE
+
+    if (g_EptState->HookedPagesIndex.Slots != NULL)
+    {
+        PlatformMemFreePool(g_EptState->HookedPagesIndex.Slots);
+
+        g_EptState->HookedPagesIndex.Slots       = NULL;
+        g_EptState->HookedBreakpointsIndex.Slots = NULL;
+    }
+
+#endif // UseEptHookHashIndex == TRUE
+}
+
+/**
+ * @brief Add a hooked page (and its breakpoints) to the index
+ * @details Should be called right after adding the page to the list
+ *
+ * @param HookedEntry
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexInsertHookedPage(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
+{
+    if (!EptHookIndexIsUsable())
+    {
+        return;
+    }
+
+    if (!HashIndexInsert(&g_EptState->HookedPagesIndex, HookedEntry->PhysicalBaseAddress, HookedEntry))
+    {
+        g_EptState->IsHookIndexIncomplete = TRUE;
+        return;
+    }
+
+    for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+    {
+        BOOLEAN IsDuplicate = FALSE;
+
+        for (size_t j = 0; j < i; j++)
+        {
+            if (HookedEntry->BreakpointAddresses[j] == HookedEntry->BreakpointAddresses[i])
+            {
+                IsDuplicate = TRUE;
+                break;
+            }
+        }
+
+        if (!IsDuplicate &&
+            !HashIndexInsert(&g_EptState->HookedBreakpointsIndex, HookedEntry->BreakpointAddresses[i], HookedEntry))
+        {
+            g_EptState->IsHookIndexIncomplete = TRUE;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Remove a hooked page (and its breakpoints) from the index
+ * @details Should be called right after removing the page from the list
+ *
+ * @param HookedEntry
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveHookedPage(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
+{
+#if UseEptHookHashIndex == TRUE
+
+    if (g_EptState->HookedPagesIndex.Slots == NULL)
+    {
+        return;
+    }
+
+    HashIndexRemove(&g_EptState->HookedPagesIndex, HookedEntry->PhysicalBaseAddress, HookedEntry);
+
+    for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+    {
+        HashIndexRemove(&g_EptState->HookedBreakpointsIndex, HookedEntry->BreakpointAddresses[i], HookedEntry);
+    }
+
+    //
+    // Once there is no hook, the index is complete again
+    //
+    if (IsListEmpty(&g_EptState->HookedPagesList))
+    {
+        EptHookIndexRemoveAll();
+    }
+
+#else
+    UNREFERENCED_PARAMETER(HookedEntry);
+#endif // UseEptHookHashIndex == TRUE
+}
+
+/**
+ * @brief Add a breakpoint of a hooked page to the index
+ * @details Should be called after adding the address to the breakpoints of
+ * the page and before applying the 0xcc
+ *
+ * @param HookedEntry
+ * @param Address
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexInsertBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT64 Address)
+{
+    if (!EptHookIndexIsUsable())
+    {
+        return;
+    }
+
+    //
+    // Each page is indexed once for each address (even if there are multiple
+    // breakpoints on the same address)
+    //
+    if (EptHookIndexCountBreakpoints(HookedEntry, Address) > 1 ||
+        HashIndexInsert(&g_EptState->HookedBreakpointsIndex, Address, HookedEntry))
+    {
+        return;
+    }
+
+    g_EptState->IsHookIndexIncomplete = TRUE;
+}
+
+/**
+ * @brief Remove a breakpoint of a hooked page from the index
+ * @details Should be called after removing the address from the breakpoints
+ * of the page
+ *
+ * @param HookedEntry
+ * @param Address
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT64 Address)
+{
+#if UseEptHookHashIndex == TRUE
+
+    if (g_EptState->HookedBreakpointsIndex.Slots == NULL || EptHookIndexCountBreakpoints(HookedEntry, Address) != 0)
+    {
+        return;
+    }
+
+    HashIndexRemove(&g_EptState->HookedBreakpointsIndex, Address, HookedEntry);
+
+#else
+    UNREFERENCED_PARAMETER(HookedEntry);
+    UNREFERENCED_PARAMETER(Address);
+#endif // UseEptHookHashIndex == TRUE
+}
+
+/**
+ * @brief Remove all of the hooks from the index
+ * @details Should be called once all of the hooked pages are removed
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveAll()
+{
+#if UseEptHookHashIndex == TRUE
+
+    if (g_EptState->HookedPagesIndex.Slots == NULL)
+    {
+        return;
+    }
+
+    HashIndexClear(&g_EptState->HookedPagesIndex);
+    HashIndexClear(&g_EptState->HookedBreakpointsIndex);
+
+    g_EptState->IsHookIndexIncomplete = FALSE;
+
+#endif // UseEptHookHashIndex == TRUE
+}
+
+/**
+ * @brief Find the hooked page of a physical address
+ *
+ * @param PhysicalBaseAddress Page-aligned physical address
+ *
+ * @return PEPT_HOOKED_PAGE_DETAIL NULL if the page is not hooked
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptHookIndexFindHookedPage(UINT64 PhysicalBaseAddress)
+{
+#if UseEptHookHashIndex == TRUE
+
+    if (EptHookIndexIsUsable())
+    {
+        return (PEPT_HOOKED_PAGE_DETAIL)HashIndexFind(&g_EptState->HookedPagesIndex, PhysicalBaseAddress, NULL);
+    }
+
+#endif // UseEptHookHashIndex == TRUE
+
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
+    {
+        if (CurrEntity->PhysicalBaseAddress == PhysicalBaseAddress)
+        {
+            return CurrEntity;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the hooked pages that have a breakpoint on the target address
+ * @details The cursor should be zero for the first call, the next calls
+ * with the same cursor return the other hooked pages
+ *
+ * @param Address Virtual address of the breakpoint
+ * @param Cursor
+ *
+ * @return PEPT_HOOKED_PAGE_DETAIL NULL if there is no other hooked page
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptHookIndexFindBreakpoint(UINT64 Address, UINT32 * Cursor)
+{
+    UINT32 SkippedEntries = 0;
+
+#if UseEptHookHashIndex == TRUE
+
+    if (EptHookIndexIsUsable())
+    {
+        return (PEPT_HOOKED_PAGE_DETAIL)HashIndexFind(&g_EptState->HookedBreakpointsIndex, Address, Cursor);
+    }
+
+#endif // UseEptHookHashIndex == TRUE
+
+    //
+    // Without the index, the cursor is the number of the returned pages
+    //
+    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, CurrEntity)
+    {
+        if (EptHookIndexCountBreakpoints(CurrEntity, Address) != 0)
+        {
+            if (SkippedEntries == *Cursor)
+            {
+                *Cursor = *Cursor + 1;
+                return CurrEntity;
+            }
+
+            SkippedEntries++;
+        }
+    }
+
+    return NULL;
+}
@@ -3,7 +3,9 @@
  * @author Sina Karvandi (sina@hyperdbg.org)
  * @brief The pool manager used in vmx root
  * @details As we cannot allocate pools in vmx root, we need a pool
- * manager to manage the pools
+ * manager to manage the pools. The free pools of each intention are kept
+ * in a separate lock-free stack (requesting a pool is a single pop) and the
+ * pools are found by their addresses through a hash index
  *
  * @version 0.1
  * @date 2020-04-11
@@ -40,6 +42,66 @@ PlmgrFreeRequestNewAllocation(VOID)
     g_RequestNewAllocation = NULL;
 }
 
+/**
+ * @brief Find the record of a pool by its address
+ * @details Should be called while holding LockForReadingPool
+ *
+ * @param Address
+ * @return PPOOL_TABLE NULL if the address is not managed by the pool manager
+ */
+PPOOL_TABLE
+PlmgrFindPoolByAddress(UINT64 Address)
+{
+    if (!g_PoolManagerAddressIndexIsFull)
+    {
+        return (PPOOL_TABLE)HashIndexFind(&g_PoolManagerAddressIndex, Address, NULL);
+    }
+
+    //
+    // The index is full, so the list is walked
+    //
+    LIST_FOR_EACH_LINK(g_ListOfAllocatedPoolsHead, POOL_TABLE, PoolsList, PoolTable)
+    {
+        if (PoolTable->Address == Address)
+        {
+            return PoolTable;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Add a pool (that is already in the list of pools) to the address index
+ * @details Should be called while holding LockForReadingPool. If the index
+ * is full, it's rebuilt from the list (this releases the removed slots) and
+ * if it's still full, the lookups walk the list until the next rebuild
+ *
+ * @param PoolTable
+ * @return VOID
+ */
+VOID
+PlmgrAddToAddressIndex(PPOOL_TABLE PoolTable)
+{
+    if (!g_PoolManagerAddressIndexIsFull &&
+        HashIndexInsert(&g_PoolManagerAddressIndex, PoolTable->Address, PoolTable))
+    {
+        return;
+    }
+
+    HashIndexClear(&g_PoolManagerAddressIndex);
+    g_PoolManagerAddressIndexIsFull = FALSE;
+
+    LIST_FOR_EACH_LINK(g_ListOfAllocatedPoolsHead, POOL_TABLE, PoolsList, CurrentPoolTable)
+    {
+        if (!HashIndexInsert(&g_PoolManagerAddressIndex, CurrentPoolTable->Address, CurrentPoolTable))
+        {
+            g_PoolManagerAddressIndexIsFull = TRUE;
+            break;
+        }
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Public Interfaces
 //
@@ -62,11 +124,38 @@ PoolManagerInitialize()
         return FALSE;
     }
 
+    //
+    // Allocate the storage of the address index
+    //
+    PVOID AddressIndexStorage = PlatformMemAllocateZeroedNonPagedPool(
+        (SIZE_T)HashIndexGetRequiredSize(POOL_MANAGER_ADDRESS_INDEX_CAPACITY));
+
+    if (!AddressIndexStorage)
+    {
+        PlmgrFreeRequestNewAllocation();
+
+        LogError("Err, insufficient memory");
+        return FALSE;
+    }
+
+    HashIndexInitialize(&g_PoolManagerAddressIndex, AddressIndexStorage, POOL_MANAGER_ADDRESS_INDEX_CAPACITY);
+    g_PoolManagerAddressIndexIsFull = FALSE;
+
     //
     // Initialize list head
     //
     InitializeListHead(&g_ListOfAllocatedPoolsHead);
 
+    //
+    // Initialize the stacks of the free pools and the spare records
+    //
+    for (UINT32 i = 0; i < POOL_MANAGER_NUMBER_OF_INTENTIONS; i++)
+    {
+        LockFreeStackInitialize(&g_PoolManagerFreePools[i]);
+    }
+
+    LockFreeStackInitialize(&g_PoolManagerSpareRecords);
+
     //
     // Nothing to deallocate
     //
@@ -119,6 +208,24 @@ PoolManagerUninitialize()
         PlatformMemFreePool(PoolTable);
     }
 
+    //
+    // Free the records of the deallocated pools
+    //
+    PLOCK_FREE_STACK_ENTRY SpareRecord;
+
+    while ((SpareRecord = LockFreeStackPop(&g_PoolManagerSpareRecords)) != NULL)
+    {
+        PlatformMemFreePool(CONTAINING_RECORD(SpareRecord, POOL_TABLE, FreeStackEntry));
+    }
+
+    for (UINT32 i = 0; i < POOL_MANAGER_NUMBER_OF_INTENTIONS; i++)
+    {
+        LockFreeStackInitialize(&g_PoolManagerFreePools[i]);
+    }
+
+    PlatformMemFreePool(g_PoolManagerAddressIndex.Slots);
+    g_PoolManagerAddressIndex.Slots = NULL;
+
     SpinlockUnlock(&LockForReadingPool);
 
     PlmgrFreeRequestNewAllocation();
@@ -135,33 +242,26 @@ PoolManagerUninitialize()
 BOOLEAN
 PoolManagerFreePool(UINT64 AddressToFree)
 {
-    PLIST_ENTRY ListTemp = 0;
-    BOOLEAN     Result   = FALSE;
-    ListTemp             = &g_ListOfAllocatedPoolsHead;
+    BOOLEAN Result = FALSE;
 
     SpinlockLock(&LockForReadingPool);
 
-    while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
-    {
-        ListTemp = ListTemp->Flink;
+    PPOOL_TABLE PoolTable = PlmgrFindPoolByAddress(AddressToFree);
 
+    //
+    // The free pools are still in the stack of their intention, so only
+    // the requested (busy) pools can be freed
+    //
+    if (PoolTable != NULL && PoolTable->IsBusy)
+    {
         //
-        // Get the head of the record
+        // We found an entry that matched the detailed from
+        // previously allocated pools
         //
-        PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, PoolsList);
-
-        if (PoolTable->Address == AddressToFree)
-        {
-            //
-            // We found an entry that matched the detailed from
-            // previously allocated pools
-            //
-            PoolTable->ShouldBeFreed = TRUE;
-            Result                   = TRUE;
+        PoolTable->ShouldBeFreed = TRUE;
+        Result                   = TRUE;
 
-            g_IsNewRequestForDeAllocation = TRUE;
-            break;
-        }
+        g_IsNewRequestForDeAllocation = TRUE;
     }
 
     SpinlockUnlock(&LockForReadingPool);
@@ -211,18 +311,24 @@ PoolManagerShowPreAllocatedPools()
 UINT64
 PoolManagerRequestPool(POOL_ALLOCATION_INTENTION Intention, BOOLEAN RequestNewPool, UINT32 Size)
 {
-    UINT64 Address = 0;
+    UINT64                 Address = 0;
+    PLOCK_FREE_STACK_ENTRY Entry   = NULL;
 
-    ScopedSpinlock(
-        LockForReadingPool,
-        LIST_FOR_EACH_LINK(g_ListOfAllocatedPoolsHead, POOL_TABLE, PoolsList, PoolTable) {
-            if (PoolTable->Intention == Intention && PoolTable->IsBusy == FALSE)
-            {
-                PoolTable->IsBusy = TRUE;
-                Address           = PoolTable->Address;
-                break;
-            }
-        });
+    //
+    // Get a free pool of this intention (without taking any lock)
+    //
+    if ((UINT32)Intention < POOL_MANAGER_NUMBER_OF_INTENTIONS)
+    {
+        Entry = LockFreeStackPop(&g_PoolManagerFreePools[Intention]);
+    }
+
+    if (Entry != NULL)
+    {
+        PPOOL_TABLE PoolTable = CONTAINING_RECORD(Entry, POOL_TABLE, FreeStackEntry);
+
+        PoolTable->IsBusy = TRUE;
+        Address           = PoolTable->Address;
+    }
 
     //
     // Check if we need additional pools e.g another pool or the pool
@@ -252,11 +358,31 @@ PoolManagerRequestPool(POOL_ALLOCATION_INTENTION Intention, BOOLEAN RequestNewPo
 BOOLEAN
 PoolManagerAllocateAndAddToPoolTable(SIZE_T Size, UINT32 Count, POOL_ALLOCATION_INTENTION Intention)
 {
+    if ((UINT32)Intention >= POOL_MANAGER_NUMBER_OF_INTENTIONS)
+    {
+        LogError("Err, invalid pool intention (%x)", Intention);
+        return FALSE;
+    }
+
     for (size_t i = 0; i < Count; i++)
     {
-        POOL_TABLE * SinglePool = NULL;
+        POOL_TABLE *           SinglePool  = NULL;
+        PLOCK_FREE_STACK_ENTRY SpareRecord = NULL;
+
+        //
+        // Reuse the record of a deallocated pool (if any)
+        //
+        SpareRecord = LockFreeStackPop(&g_PoolManagerSpareRecords);
 
-        SinglePool = PlatformMemAllocateZeroedNonPagedPool(sizeof(POOL_TABLE));
+        if (SpareRecord != NULL)
+        {
+            SinglePool = CONTAINING_RECORD(SpareRecord, POOL_TABLE, FreeStackEntry);
+            RtlZeroMemory(SinglePool, sizeof(POOL_TABLE));
+        }
+        else
+        {
+            SinglePool = PlatformMemAllocateZeroedNonPagedPool(sizeof(POOL_TABLE));
+        }
 
         if (!SinglePool)
         {
@@ -271,7 +397,7 @@ PoolManagerAllocateAndAddToPoolTable(SIZE_T Size, UINT32 Count, POOL_ALLOCATION_
 
         if (!SinglePool->Address)
         {
-            PlatformMemFreePool(SinglePool);
+            LockFreeStackPush(&g_PoolManagerSpareRecords, &SinglePool->FreeStackEntry);
 
             LogError("Err, insufficient memory");
             return FALSE;
@@ -284,9 +410,19 @@ PoolManagerAllocateAndAddToPoolTable(SIZE_T Size, UINT32 Count, POOL_ALLOCATION_
         SinglePool->Size          = Size;
 
         //
-        // Add it to the list
+        // Add it to the list and the address index
         //
+        SpinlockLock(&LockForReadingPool);
+
         InsertHeadList(&g_ListOfAllocatedPoolsHead, &(SinglePool->PoolsList));
+        PlmgrAddToAddressIndex(SinglePool);
+
+        SpinlockUnlock(&LockForReadingPool);
+
+        //
+        // Now, it's available to be requested
+        //
+        LockFreeStackPush(&g_PoolManagerFreePools[Intention], &SinglePool->FreeStackEntry);
     }
 
     return TRUE;
@@ -303,6 +439,7 @@ PoolManagerCheckAndPerformAllocationAndDeallocation()
 {
     BOOLEAN     Result   = TRUE;
     PLIST_ENTRY ListTemp = 0;
+    PLIST_ENTRY NextItem = 0;
 
     //
     // let's make sure we're on vmx non-root and also we have new allocation
@@ -350,13 +487,11 @@ PoolManagerCheckAndPerformAllocationAndDeallocation()
     //
     if (g_IsNewRequestForDeAllocation)
     {
-        ListTemp = &g_ListOfAllocatedPoolsHead;
-
         SpinlockLock(&LockForReadingPool);
 
-        while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
+        for (ListTemp = g_ListOfAllocatedPoolsHead.Flink; ListTemp != &g_ListOfAllocatedPoolsHead; ListTemp = NextItem)
         {
-            ListTemp = ListTemp->Flink;
+            NextItem = ListTemp->Flink;
 
             //
             // Get the head of the record
@@ -381,13 +516,20 @@ PoolManagerCheckAndPerformAllocationAndDeallocation()
 
                 //
                 // Now we should remove the entry from the g_ListOfAllocatedPoolsHead
+                // and the address index
                 //
                 RemoveEntryList(&PoolTable->PoolsList);
 
+                if (!g_PoolManagerAddressIndexIsFull)
+                {
+                    HashIndexRemove(&g_PoolManagerAddressIndex, PoolTable->Address, PoolTable);
+                }
+
                 //
-                // Free the structure pool
+                // Keep the structure pool to be reused (a concurrent pop might
+                // still read it)
                 //
-                PlatformMemFreePool(PoolTable);
+                LockFreeStackPush(&g_PoolManagerSpareRecords, &PoolTable->FreeStackEntry);
             }
         }
 
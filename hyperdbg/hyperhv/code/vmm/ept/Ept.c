@@ -893,117 +893,116 @@ EptHandlePageHookExit(VIRTUAL_MACHINE_STATE *              VCpu,
                       UINT64                               GuestPhysicalAddr)
 {
     
-    PVOID   TargetPage;
-    UINT64  CurrentRip;
-    UINT32  CurrentInstructionLength;
-    BOOLEAN IsHandled               = FALSE;
-    BOOLEAN ResultOfHandlingHook    = FALSE;
-    BOOLEAN IgnoreReadOrWriteOrExec = FALSE;
-    BOOLEAN IsExecViolation         = FALSE;
+    PVOID                   TargetPage;
+    UINT64                  CurrentRip;
+    UINT32                  CurrentInstructionLength;
+    PEPT_HOOKED_PAGE_DETAIL HookedEntry;
+    BOOLEAN                 IsHandled               = FALSE;
+    BOOLEAN                 ResultOfHandlingHook    = FALSE;
+    BOOLEAN                 IgnoreReadOrWriteOrExec = FALSE;
+    BOOLEAN                 IsExecViolation         = FALSE;
    // LogInfo("Entered handlePage\n");
-    LIST_FOR_EACH_LINK(g_EptState->HookedPagesList, EPT_HOOKED_PAGE_DETAIL, PageHookList, HookedEntry)
+
+    //
+    // Find the hooked page of the violation
+    //
+    HookedEntry = EptHookIndexFindHookedPage((SIZE_T)PAGE_ALIGN(GuestPhysicalAddr));
+
+    if (HookedEntry != NULL)
     {
-        if (HookedEntry->PhysicalBaseAddress == (SIZE_T)PAGE_ALIGN(GuestPhysicalAddr))
-        {
-            //
-            // *** We found an address that matches the details ***
-            //
+        //
+        // *** We found an address that matches the details ***
+        //
 
+        //
+        // Returning true means that the caller should return to the ept state to
+        // the previous state when this instruction is executed
+        // by setting the Monitor Trap Flag. Return false means that nothing special
+        // for the caller to do
+        //
+
+        //
+        // Reaching here means that the hooks was actually caused VM-exit because of
+        // our configurations, but here we double whether the hook needs to trigger
+        // any event or not because the hooking address (physical) might not be in the
+        // target range. For example we might hook 0x123b000 to 0x123b300 but the hook
+        // happens on 0x123b4600, so we perform the necessary checks here
+        //
+        if (GuestPhysicalAddr >= g_EcamBase && GuestPhysicalAddr <g_EcamBase + g_EcamSize) {
+            
+            return EptHandleECAMRange(VCpu,ViolationQualification, HookedEntry);
+        }
+        else if (GuestPhysicalAddr >= HookedEntry->StartOfTargetPhysicalAddress && GuestPhysicalAddr <= HookedEntry->EndOfTargetPhysicalAddress)
+        {
+            ResultOfHandlingHook = EptHookHandleHookedPage(VCpu,
+                                                           HookedEntry,
+                                                           ViolationQualification,
+                                                           GuestPhysicalAddr,
+                                                           &HookedEntry->LastContextState,
+                                                           &IgnoreReadOrWriteOrExec,
+                                                           &IsExecViolation);
+        }
+        else
+        {
             //
-            // Returning true means that the caller should return to the ept state to
-            // the previous state when this instruction is executed
-            // by setting the Monitor Trap Flag. Return false means that nothing special
-            // for the caller to do
+            // Here we assume the hook is handled as the hook needs to be
+            // restored (just not within the range)
             //
+            ResultOfHandlingHook = TRUE;
+        }
 
+        if (ResultOfHandlingHook)
+        {
+            
             //
-            // Reaching here means that the hooks was actually caused VM-exit because of
-            // our configurations, but here we double whether the hook needs to trigger
-            // any event or not because the hooking address (physical) might not be in the
-            // target range. For example we might hook 0x123b000 to 0x123b300 but the hook
-            // happens on 0x123b4600, so we perform the necessary checks here
+            // Here we check whether the event should be ignored or not,
+            // if we don't apply the below restorations routines, the event
+            // won't redo and the emulation of the memory access is passed
             //
-            if (GuestPhysicalAddr >= g_EcamBase && GuestPhysicalAddr <g_EcamBase + g_EcamSize) {
-                
-                return EptHandleECAMRange(VCpu,ViolationQualification, HookedEntry);
-            }
-            else if (GuestPhysicalAddr >= HookedEntry->StartOfTargetPhysicalAddress && GuestPhysicalAddr <= HookedEntry->EndOfTargetPhysicalAddress)
-            {
-                ResultOfHandlingHook = EptHookHandleHookedPage(VCpu,
-                                                               HookedEntry,
-                                                               ViolationQualification,
-                                                               GuestPhysicalAddr,
-                                                               &HookedEntry->LastContextState,
-                                                               &IgnoreReadOrWriteOrExec,
-                                                               &IsExecViolation);
-            }
-            else
+            if (!IgnoreReadOrWriteOrExec)
             {
+         
                 //
-                // Here we assume the hook is handled as the hook needs to be
-                // restored (just not within the range)
+                // Pointer to the page entry in the page table
                 //
-                ResultOfHandlingHook = TRUE;
-            }
-
-            if (ResultOfHandlingHook)
-            {
                 
+                TargetPage = EptGetPml1Entry(VCpu->EptPageTable, HookedEntry->PhysicalBaseAddress);
+               
                 //
-                // Here we check whether the event should be ignored or not,
-                // if we don't apply the below restorations routines, the event
-                // won't redo and the emulation of the memory access is passed
+                // Restore to its original entry for one instruction
                 //
-                if (!IgnoreReadOrWriteOrExec)
-                {
-             
-                    //
-                    // Pointer to the page entry in the page table
-                    //
-                    
-                    TargetPage = EptGetPml1Entry(VCpu->EptPageTable, HookedEntry->PhysicalBaseAddress);
-                   
-                    //
-                    // Restore to its original entry for one instruction
-                    //
-                    
-                    EptSetPML1AndInvalidateTLB(VCpu,
-                                               TargetPage,
-                                               HookedEntry->OriginalEntry,
-                                               InveptSingleContext);
-                             
+                
+                EptSetPML1AndInvalidateTLB(VCpu,
+                                           TargetPage,
+                                           HookedEntry->OriginalEntry,
+                                           InveptSingleContext);
+                         
 
-                    //
-                    // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
-                    //
-                    VCpu->MtfEptHookRestorePoint = HookedEntry;
+                //
+                // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
+                //
+                VCpu->MtfEptHookRestorePoint = HookedEntry;
 
-                    //
-                    // The following codes are added because we realized if the execution takes long then
-                    // the execution might be switched to another routines, thus, MTF might conclude on
-                    // another routine and we might (and will) trigger the same instruction soon
-                    //
+                //
+                // The following codes are added because we realized if the execution takes long then
+                // the execution might be switched to another routines, thus, MTF might conclude on
+                // another routine and we might (and will) trigger the same instruction soon
+                //
 
-                    //
-                    // We have to set Monitor trap flag and give it the HookedEntry to work with
-                    //
-                    HvEnableMtfAndChangeExternalInterruptState(VCpu);
-                            
+                //
+                // We have to set Monitor trap flag and give it the HookedEntry to work with
+                //
+                HvEnableMtfAndChangeExternalInterruptState(VCpu);
+                        
 
-                  
-                }
+              
             }
-
-            //
-            // Indicate that we handled the ept violation
-            //
-            IsHandled = TRUE;
-
-            //
-            // Get out of the loop
-            //
-            break;
         }
+
+        //
+        // Indicate that we handled the ept violation
+        //
+        IsHandled = TRUE;
     }
    
     //
@@ -1186,90 +1185,76 @@ EptSetPML1AndInvalidateTLB(VIRTUAL_MACHINE_STATE * VCpu,
 BOOLEAN
 EptCheckAndHandleEptHookBreakpoints(VIRTUAL_MACHINE_STATE * VCpu, UINT64 GuestRip)
 {
-    PVOID       TargetPage;
-    PLIST_ENTRY TempList;
-    BOOLEAN     IsHandledByEptHook = FALSE;
+    PVOID                   TargetPage;
+    PEPT_HOOKED_PAGE_DETAIL HookedEntry;
+    UINT32                  Cursor             = 0;
+    BOOLEAN                 IsHandledByEptHook = FALSE;
 
     //
     // ***** Check breakpoint for !epthook *****
     //
 
     //
-    // Check whether the breakpoint was due to a !epthook command or not
+    // Check whether the breakpoint was due to a !epthook command or not (all of
+    // the hooked pages with a breakpoint on this address are returned)
     //
-    TempList = &g_EptState->HookedPagesList;
-
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    while ((HookedEntry = EptHookIndexFindBreakpoint(GuestRip, &Cursor)) != NULL)
     {
-        TempList                            = TempList->Flink;
-        PEPT_HOOKED_PAGE_DETAIL HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-
         if (HookedEntry->IsExecutionHook)
         {
-            for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
-            {
-                if (HookedEntry->BreakpointAddresses[i] == GuestRip)
-                {
-                    //
-                    // We found an address that matches the details, let's trigger the event
-                    //
-
-                    //
-                    // As the context to event trigger, we send the rip
-                    // of where triggered this event
-                    //
-                    DispatchEventHiddenHookExecCc(VCpu, (PVOID)GuestRip);
+            //
+            // We found an address that matches the details, let's trigger the event
+            //
 
-                    //
-                    // Pointer to the page entry in the page table
-                    //
-                    TargetPage = EptGetPml1Entry(VCpu->EptPageTable, HookedEntry->PhysicalBaseAddress);
+            //
+            // As the context to event trigger, we send the rip
+            // of where triggered this event
+            //
+            DispatchEventHiddenHookExecCc(VCpu, (PVOID)GuestRip);
 
-                    //
-                    // Restore to its original entry for one instruction
-                    //
-                    EptSetPML1AndInvalidateTLB(VCpu,
-                                               TargetPage,
-                                               HookedEntry->OriginalEntry,
-                                               InveptSingleContext);
+            //
+            // Pointer to the page entry in the page table
+            //
+            TargetPage = EptGetPml1Entry(VCpu->EptPageTable, HookedEntry->PhysicalBaseAddress);
 
-                    //
-                    // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
-                    //
-                    VCpu->MtfEptHookRestorePoint = HookedEntry;
+            //
+            // Restore to its original entry for one instruction
+            //
+            EptSetPML1AndInvalidateTLB(VCpu,
+                                       TargetPage,
+                                       HookedEntry->OriginalEntry,
+                                       InveptSingleContext);
 
-                    //
-                    // The following codes are added because we realized if the execution takes long then
-                    // the execution might be switched to another routines, thus, MTF might conclude on
-                    // another routine and we might (and will) trigger the same instruction soon
-                    //
-                    // The following code is not necessary on local debugging (VMI Mode), however, I don't
-                    // know why? just things are not reasonable here for me
-                    // another weird thing that I observed is the fact if you don't touch the routine related
-                    // to the I/O in and out instructions in VMWare then it works perfectly, just touching I/O
-                    // for serial is problematic, it might be a VMWare nested-virtualization bug, however, the
-                    // below approached proved to be work on both Debug Mode and WMI Mode
-                    // If you remove the below codes then when epthook is triggered then the execution stucks
-                    // on the same instruction on where the hooks is triggered, so 'p' and 't' commands for
-                    // steppings won't work
-                    //
+            //
+            // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
+            //
+            VCpu->MtfEptHookRestorePoint = HookedEntry;
 
-                    //
-                    // We have to set Monitor trap flag and give it the HookedEntry to work with
-                    //
-                    HvEnableMtfAndChangeExternalInterruptState(VCpu);
+            //
+            // The following codes are added because we realized if the execution takes long then
+            // the execution might be switched to another routines, thus, MTF might conclude on
+            // another routine and we might (and will) trigger the same instruction soon
+            //
+            // The following code is not necessary on local debugging (VMI Mode), however, I don't
+            // know why? just things are not reasonable here for me
+            // another weird thing that I observed is the fact if you don't touch the routine related
+            // to the I/O in and out instructions in VMWare then it works perfectly, just touching I/O
+            // for serial is problematic, it might be a VMWare nested-virtualization bug, however, the
+            // below approached proved to be work on both Debug Mode and WMI Mode
+            // If you remove the below codes then when epthook is triggered then the execution stucks
+            // on the same instruction on where the hooks is triggered, so 'p' and 't' commands for
+            // steppings won't work
+            //
 
-                    //
-                    // Indicate that we handled the ept violation
-                    //
-                    IsHandledByEptHook = TRUE;
+            //
+            // We have to set Monitor trap flag and give it the HookedEntry to work with
+            //
+            HvEnableMtfAndChangeExternalInterruptState(VCpu);
 
-                    //
-                    // Get out of the loop
-                    //
-                    break;
-                }
-            }
+            //
+            // Indicate that we handled the ept violation
+            //
+            IsHandledByEptHook = TRUE;
         }
     }
 
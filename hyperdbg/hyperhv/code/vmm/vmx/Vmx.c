@@ -436,6 +436,15 @@ VmxPerformVirtualizationOnAllCores()
     //
     InitializeListHead(&g_EptState->HookedPagesList);
 
+    //
+    // Allocate the index of the hooked pages (used in vmx-root)
+    //
+    if (!EptHookIndexInitialize())
+    {
+        LogError("Err, insufficient memory");
+        return FALSE;
+    }
+
     //
     // Check whether EPT is supported or not
     //
@@ -1259,8 +1268,9 @@ VmxPerformTermination()
     }
 
     //
-    // Free EptState
+    // Free the index of the hooked pages and EptState
     //
+    EptHookIndexUninitialize();
     PlatformMemFreePool(g_EptState);
     g_EptState = NULL;
 
@@ -505,3 +505,94 @@ EptHookModifyPageWriteState(VIRTUAL_MACHINE_STATE * VCpu,
  */
 VOID
 EptHookHandleMonitorTrapFlag(VIRTUAL_MACHINE_STATE * VCpu);
+
+//////////////////////////////////////////////////
+//		    	 EPT Hooks Index				//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Allocate the storage of the index
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookIndexInitialize();
+
+/**
+ * @brief Free the storage of the index
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexUninitialize();
+
+/**
+ * @brief Add a hooked page (and its breakpoints) to the index
+ *
+ * @param HookedEntry
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexInsertHookedPage(PEPT_HOOKED_PAGE_DETAIL HookedEntry);
+
+/**
+ * @brief Remove a hooked page (and its breakpoints) from the index
+ *
+ * @param HookedEntry
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveHookedPage(PEPT_HOOKED_PAGE_DETAIL HookedEntry);
+
+/**
+ * @brief Add a breakpoint of a hooked page to the index
+ *
+ * @param HookedEntry
+ * @param Address
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexInsertBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT64 Address);
+
+/**
+ * @brief Remove a breakpoint of a hooked page from the index
+ *
+ * @param HookedEntry
+ * @param Address
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry, UINT64 Address);
+
+/**
+ * @brief Remove all of the hooks from the index
+ *
+ * @return VOID
+ */
+VOID
+EptHookIndexRemoveAll();
+
+/**
+ * @brief Find the hooked page of a physical address
+ *
+ * @param PhysicalBaseAddress
+ *
+ * @return PEPT_HOOKED_PAGE_DETAIL
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptHookIndexFindHookedPage(UINT64 PhysicalBaseAddress);
+
+/**
+ * @brief Find the hooked pages that have a breakpoint on the target address
+ *
+ * @param Address
+ * @param Cursor
+ *
+ * @return PEPT_HOOKED_PAGE_DETAIL
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptHookIndexFindBreakpoint(UINT64 Address, UINT32 * Cursor);
@@ -22,6 +22,20 @@
 #define MaximumRequestsQueueDepth   300
 #define NumberOfPreAllocatedBuffers 10
 
+/**
+ * @brief Number of the intentions (buffer tags) that have a separate stack
+ * of free pools
+ *
+ */
+#define POOL_MANAGER_NUMBER_OF_INTENTIONS (INSTANT_BIG_SAFE_BUFFER_FOR_EVENTS + 1)
+
+/**
+ * @brief Number of slots in the index of the pools by their addresses
+ * (a power of two)
+ *
+ */
+#define POOL_MANAGER_ADDRESS_INDEX_CAPACITY 16384
+
 //////////////////////////////////////////////////
 //                   Structures		   			//
 //////////////////////////////////////////////////
@@ -36,6 +50,7 @@ typedef struct _POOL_TABLE
     SIZE_T                    Size;
     POOL_ALLOCATION_INTENTION Intention;
     LIST_ENTRY                PoolsList;
+    LOCK_FREE_STACK_ENTRY     FreeStackEntry; // Entry in the stack of free pools (or the spare records)
     BOOLEAN                   IsBusy;
     BOOLEAN                   ShouldBeFreed;
     BOOLEAN                   AlreadyFreed;
@@ -94,6 +109,32 @@ BOOLEAN g_IsNewRequestForDeAllocation;
  */
 LIST_ENTRY g_ListOfAllocatedPoolsHead;
 
+/**
+ * @brief Stacks of the free (not busy) pools of each intention
+ *
+ */
+LOCK_FREE_STACK g_PoolManagerFreePools[POOL_MANAGER_NUMBER_OF_INTENTIONS];
+
+/**
+ * @brief Stack of the records of the deallocated pools (the records are
+ * reused instead of being freed, as they might be read by a concurrent pop)
+ *
+ */
+LOCK_FREE_STACK g_PoolManagerSpareRecords;
+
+/**
+ * @brief Index of the pools by their addresses (protected by LockForReadingPool)
+ *
+ */
+HASH_INDEX g_PoolManagerAddressIndex;
+
+/**
+ * @brief Whether the address index is full or not (if full, the pools
+ * are found by walking the list)
+ *
+ */
+BOOLEAN g_PoolManagerAddressIndexIsFull;
+
 //////////////////////////////////////////////////
 //                   Functions		  			//
 //////////////////////////////////////////////////
@@ -110,6 +151,12 @@ PlmgrAllocateRequestNewAllocation(SIZE_T NumberOfBytes);
 
 static VOID PlmgrFreeRequestNewAllocation(VOID);
 
+static PPOOL_TABLE
+PlmgrFindPoolByAddress(UINT64 Address);
+
+static VOID
+PlmgrAddToAddressIndex(PPOOL_TABLE PoolTable);
+
 // ----------------------------------------------------------------------------
 // Public Interfaces
 //
@@ -125,6 +125,9 @@ typedef struct _EPT_STATE
     EPT_POINTER           ModeBasedKernelDisabledEptPointer;   // Extended-Page-Table Pointer for kernel-disabled mode-based execution
     EPT_POINTER           ExecuteOnlyEptPointer;               // Extended-Page-Table Pointer for execute-only execution
     UINT8                 DefaultMemoryType;
+    HASH_INDEX            HookedPagesIndex;                    // Index of the hooked pages by their physical address
+    HASH_INDEX            HookedBreakpointsIndex;              // Index of the hooked pages by the address of their hidden breakpoints
+    BOOLEAN               IsHookIndexIncomplete;               // Set if the index was full, the list is used until all of the hooks are removed
 } EPT_STATE, *PEPT_STATE;
 
 /**
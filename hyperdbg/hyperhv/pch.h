@@ -67,6 +67,16 @@
 //
 #include "SDK/modules/VMM.h"
 
+//
+// Hash index (used in the EPT state)
+//
+#include "components/hashindex/header/HashIndex.h"
+
+//
+// Lock-free stack (used in the pool manager)
+//
+#include "components/lockfreestack/header/LockFreeStack.h"
+
 //
 // The core's state
 //
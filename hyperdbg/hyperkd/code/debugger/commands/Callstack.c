@@ -123,3 +123,93 @@ CallstackWalkthroughStack(PDEBUGGER_SINGLE_CALLSTACK_FRAME AddressToSaveFrames,
     //
     return TRUE;
 }
+
+/**
+ * @brief Read the memory of the target process for the unwinder
+ *
+ * @param Context
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+CallstackReadMemoryForUnwinder(PVOID Context, UINT64 Address, PVOID Buffer, UINT32 Size)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    if (!CheckAccessValidityAndSafety(Address, Size))
+    {
+        return FALSE;
+    }
+
+    return MemoryMapperReadMemorySafeOnTargetProcess(Address, Buffer, Size);
+}
+
+/**
+ * @brief Unwind the frames of the stack
+ * @details The frames are unwound based on the unwind data (.pdata) of the
+ * images that are loaded in the memory, so only the real frames are saved
+ *
+ * @param AddressToSaveFrames
+ * @param Regs Registers of the current frame
+ * @param Rip
+ * @param MaximumFrames
+ * @param FrameCount Number of the saved frames
+ *
+ * @return BOOLEAN FALSE if the current frame can't be unwound
+ */
+BOOLEAN
+CallstackUnwindStack(PDEBUGGER_SINGLE_CALLSTACK_FRAME AddressToSaveFrames,
+                     PGUEST_REGS                      Regs,
+                     UINT64                           Rip,
+                     UINT32                           MaximumFrames,
+                     UINT32 *                         FrameCount)
+{
+    UNWINDER         Unwinder;
+    UNWINDER_CONTEXT Context;
+    UNWINDER_FRAME   Frames[CALLSTACK_MAXIMUM_UNWOUND_FRAMES];
+    UINT32           Count;
+
+    if (MaximumFrames > CALLSTACK_MAXIMUM_UNWOUND_FRAMES)
+    {
+        MaximumFrames = CALLSTACK_MAXIMUM_UNWOUND_FRAMES;
+    }
+
+    if (MaximumFrames == 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // The general-purpose registers are in the same order
+    //
+    RtlCopyMemory(Context.Gpr, Regs, sizeof(Context.Gpr));
+    Context.Rip = Rip;
+
+    UnwinderInitialize(&Unwinder, CallstackReadMemoryForUnwinder, NULL);
+
+    Count = UnwinderWalkStack(&Unwinder, &Context, Frames, MaximumFrames);
+
+    //
+    // Only the current frame means that it can't be unwound
+    //
+    if (Count <= 1 && MaximumFrames != 1)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        AddressToSaveFrames[i].IsStackAddressValid = TRUE;
+        AddressToSaveFrames[i].IsValidAddress      = TRUE;
+        AddressToSaveFrames[i].IsExecutable        = TRUE;
+        AddressToSaveFrames[i].Value               = Frames[i].Rip;
+        AddressToSaveFrames[i].StackAddress        = Frames[i].Rsp;
+    }
+
+    *FrameCount = Count;
+
+    return TRUE;
+}
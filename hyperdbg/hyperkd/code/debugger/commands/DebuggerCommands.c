@@ -662,6 +662,78 @@ DebuggerCommandEditMemoryVmxRoot(PDEBUGGER_EDIT_MEMORY EditMemRequest)
     return TRUE;
 }
 
+/**
+ * @brief Save a result of searching memory
+ *
+ * @param Context Details of saving the results (SEARCH_MEMORY_RESULTS_CONTEXT)
+ * @param PatternIndex Index of the matched pattern
+ * @param Offset Offset of the match from the start address
+ * @return BOOLEAN FALSE if the results buffer is full
+ */
+static BOOLEAN
+SearchMemorySaveResult(PVOID Context, UINT32 PatternIndex, UINT64 Offset)
+{
+    PSEARCH_MEMORY_RESULTS_CONTEXT ResultsContext = (PSEARCH_MEMORY_RESULTS_CONTEXT)Context;
+    UINT64                         Address        = ResultsContext->StartAddress + Offset;
+
+    UNREFERENCED_PARAMETER(PatternIndex);
+
+    //
+    // We found the a matching address, let's save the
+    // address for future use
+    //
+    ResultsContext->CountOfOccurance++;
+
+    if (ResultsContext->IsDebuggeePaused)
+    {
+        if (ResultsContext->SearchMemRequest->MemoryType == SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
+        {
+            //
+            // It's a physical memory
+            //
+            Log("%llx\n", VirtualAddressToPhysicalAddress((PVOID)Address));
+        }
+        else
+        {
+            //
+            // It's a virtual memory
+            //
+            Log("%llx\n", Address);
+        }
+    }
+    else
+    {
+        if (ResultsContext->SearchMemRequest->MemoryType == SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
+        {
+            //
+            // It's a physical memory
+            //
+            ResultsContext->AddressToSaveResults[ResultsContext->IndexToArrayOfResults] = VirtualAddressToPhysicalAddress((PVOID)Address);
+        }
+        else
+        {
+            //
+            // It's a virtual memory
+            //
+            ResultsContext->AddressToSaveResults[ResultsContext->IndexToArrayOfResults] = Address;
+        }
+    }
+
+    //
+    // Increase the array pointer if it doesn't exceed the limitation
+    //
+    if (MaximumSearchResults > ResultsContext->IndexToArrayOfResults)
+    {
+        ResultsContext->IndexToArrayOfResults++;
+        return TRUE;
+    }
+
+    //
+    // The result buffer is full!
+    //
+    return FALSE;
+}
+
 /**
  * @brief Search on virtual memory (not work on physical memory)
  *
@@ -669,7 +741,9 @@ DebuggerCommandEditMemoryVmxRoot(PDEBUGGER_EDIT_MEMORY EditMemRequest)
  * Do NOT directly call this function as the virtual addresses
  * should be valid on the target process memory layout
  * instead call : SearchAddressWrapper
- * the address between StartAddress and EndAddress should be contiguous
+ * The memory is read page by page (each page is validated once and
+ * the search stops at the first invalid page), the unscanned tail of
+ * each page is kept to find the patterns that cross the pages
  *
  * @param AddressToSaveResults Address to save the search results
  * @param SearchMemRequest request structure of searching memory
@@ -688,15 +762,22 @@ PerformSearchAddress(UINT64 *                AddressToSaveResults,
                      BOOLEAN                 IsDebuggeePaused,
                      PUINT32                 CountOfMatchedCases)
 {
-    UINT32   CountOfOccurance      = 0;
-    UINT64   Cmp64                 = 0;
-    UINT32   IndexToArrayOfResults = 0;
-    UINT32   LengthOfEachChunk     = 0;
-    PVOID    TempSourceAddress     = 0;
-    PVOID    SourceAddress         = 0;
-    BOOLEAN  StillMatch            = FALSE;
-    UINT64   TempValue             = (UINT64)NULL;
-    CR3_TYPE CurrentProcessCr3     = {0};
+    UINT32                        LengthOfEachChunk = 0;
+    UINT64                        PatternLength     = 0;
+    UINT64                        CurrentAddress    = 0;
+    UINT64                        ReadEndAddress    = 0;
+    UINT64                        ChunkSize         = 0;
+    UINT64                        WindowLength      = 0;
+    UINT64                        WindowBase        = 0;
+    UINT64                        ScanLength        = 0;
+    UINT64                        SearchLength      = 0;
+    UINT8 *                       SearchBuffer      = NULL;
+    UINT8 *                       Window            = NULL;
+    PUINT64                       Values            = NULL;
+    MEMORY_SEARCH                 Search            = {0};
+    MEMORY_SEARCH_PATTERN         Pattern           = {0};
+    SEARCH_MEMORY_RESULTS_CONTEXT ResultsContext    = {0};
+    CR3_TYPE                      CurrentProcessCr3 = {0};
 
     //
     // set chunk size in each modification
@@ -724,228 +805,200 @@ PerformSearchAddress(UINT64 *                AddressToSaveResults,
     //
     // Check if address is virtual address or physical address
     //
-    if (SearchMemRequest->MemoryType == SEARCH_VIRTUAL_MEMORY ||
-        SearchMemRequest->MemoryType == SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
+    if (SearchMemRequest->MemoryType == SEARCH_PHYSICAL_MEMORY)
     {
         //
-        // Search the memory
+        // That's an error, the physical memory is handled like virtual memory and
+        // thus we should never reach here
         //
+        LogError("Err, searching physical memory is not allowed without virtual address");
 
+        return FALSE;
+    }
+    else if (SearchMemRequest->MemoryType != SEARCH_VIRTUAL_MEMORY &&
+             SearchMemRequest->MemoryType != SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
+    {
         //
-        // Change the memory layout (cr3), if the user specified a
-        // special process
+        // Invalid parameter
         //
-        if (IsDebuggeePaused)
-        {
-            //
-            // Switch to target process memory layout
-            //
-            CurrentProcessCr3 = SwitchToProcessMemoryLayoutByCr3(LayoutGetCurrentProcessCr3());
-        }
-        else
-        {
-            if (SearchMemRequest->ProcessId != HANDLE_TO_UINT32(PsGetCurrentProcessId()))
-            {
-                CurrentProcessCr3 = SwitchToProcessMemoryLayout(SearchMemRequest->ProcessId);
-            }
-        }
+        return FALSE;
+    }
 
-        //
-        // Here we iterate through the buffer we received from
-        // user-mode
-        //
-        SourceAddress = (PVOID)((UINT64)SearchMemRequest + SIZEOF_DEBUGGER_SEARCH_MEMORY);
+    //
+    // The pattern (in bytes) should fit in the search buffer
+    //
+    PatternLength = (UINT64)SearchMemRequest->CountOf64Chunks * LengthOfEachChunk;
 
-        for (size_t BaseIterator = (size_t)StartAddress; BaseIterator < ((UINT64)EndAddress); BaseIterator += LengthOfEachChunk)
-        {
-            //
-            // *** Search the memory ***
-            //
+    if (PatternLength == 0 || PatternLength > MaximumSearchPatternLength)
+    {
+        return FALSE;
+    }
 
-            //
-            // Copy 64bit, 32bit or one byte value into Cmp64 buffer and then compare it
-            // Check if we should access the memory directly, or through safe memory
-            // routine from vmx-root
-            //
-            if (IsDebuggeePaused)
-            {
-                MemoryMapperReadMemorySafe((UINT64)BaseIterator, &Cmp64, LengthOfEachChunk);
-            }
-            else
-            {
-                RtlCopyMemory(&Cmp64, (PVOID)BaseIterator, LengthOfEachChunk);
-            }
+    //
+    // We cannot allocate in vmx-root, so the pre-allocated buffer is used
+    // in the debugger mode
+    //
+    if (IsDebuggeePaused)
+    {
+        SearchBuffer = g_SearchMemoryBuffer;
+    }
+    else
+    {
+        SearchBuffer = PlatformMemAllocateNonPagedPool(SEARCH_MEMORY_BUFFER_SIZE);
+    }
 
-            //
-            // Get the searching bytes
-            //
-            TempValue = *(UINT64 *)SourceAddress;
+    if (SearchBuffer == NULL)
+    {
+        return FALSE;
+    }
 
-            //
-            // Check whether the byte matches the source or not
-            //
-            if (Cmp64 == TempValue)
-            {
-                //
-                // Indicate that it matches until now
-                //
-                StillMatch = TRUE;
+    Window = SearchBuffer + MaximumSearchPatternLength;
 
-                //
-                // Try to check each element (we don't start from the very first element as
-                // it checked before )
-                //
-                for (size_t i = LengthOfEachChunk; i < SearchMemRequest->CountOf64Chunks; i++)
-                {
-                    //
-                    // I know, we have a double check here ;)
-                    //
-                    TempSourceAddress = (PVOID)((UINT64)SearchMemRequest + SIZEOF_DEBUGGER_SEARCH_MEMORY + (i * sizeof(UINT64)));
+    //
+    // Here we convert the values that we received from user-mode to
+    // the bytes of the pattern (each value has the size of a chunk)
+    //
+    Values = (PUINT64)((UINT64)SearchMemRequest + SIZEOF_DEBUGGER_SEARCH_MEMORY);
 
-                    //
-                    // Add i to BaseIterator and recompute the Cmp64
-                    // Check if we should access the memory directly, or through safe memory
-                    // routine from vmx-root
-                    //
-                    if (IsDebuggeePaused)
-                    {
-                        MemoryMapperReadMemorySafe((UINT64)(BaseIterator + (LengthOfEachChunk * i)), &Cmp64, LengthOfEachChunk);
-                    }
-                    else
-                    {
-                        RtlCopyMemory(&Cmp64, (PVOID)(BaseIterator + (LengthOfEachChunk * i)), LengthOfEachChunk);
-                    }
+    for (UINT32 i = 0; i < SearchMemRequest->CountOf64Chunks; i++)
+    {
+        RtlCopyMemory(SearchBuffer + (i * LengthOfEachChunk), &Values[i], LengthOfEachChunk);
+    }
 
-                    //
-                    // Check if we should access the memory directly,
-                    // or through safe memory routine from vmx-root
-                    //
-                    if (IsDebuggeePaused)
-                    {
-                        MemoryMapperReadMemorySafe((UINT64)TempSourceAddress, &TempValue, sizeof(UINT64));
-                    }
-                    else
-                    {
-                        TempValue = *(UINT64 *)TempSourceAddress;
-                    }
+    Pattern.Bytes  = SearchBuffer;
+    Pattern.Length = (UINT32)PatternLength;
 
-                    if (!(Cmp64 == TempValue))
-                    {
-                        //
-                        // One thing didn't match so this is not the pattern
-                        //
-                        StillMatch = FALSE;
+    //
+    // The pattern is only matched at the multiples of the chunk size from
+    // the start address
+    //
+    MemorySearchInitialize(&Search, &Pattern, 1, LengthOfEachChunk);
 
-                        //
-                        // Break from the loop
-                        //
-                        break;
-                    }
-                }
+    ResultsContext.SearchMemRequest     = SearchMemRequest;
+    ResultsContext.AddressToSaveResults = AddressToSaveResults;
+    ResultsContext.StartAddress         = StartAddress;
+    ResultsContext.IsDebuggeePaused     = IsDebuggeePaused;
 
-                //
-                // Check if we find the pattern or not
-                //
-                if (StillMatch)
-                {
-                    //
-                    // We found the a matching address, let's save the
-                    // address for future use
-                    //
-                    CountOfOccurance++;
+    //
+    // Change the memory layout (cr3), if the user specified a
+    // special process
+    //
+    if (IsDebuggeePaused)
+    {
+        //
+        // Switch to target process memory layout
+        //
+        CurrentProcessCr3 = SwitchToProcessMemoryLayoutByCr3(LayoutGetCurrentProcessCr3());
+    }
+    else
+    {
+        if (SearchMemRequest->ProcessId != HANDLE_TO_UINT32(PsGetCurrentProcessId()))
+        {
+            CurrentProcessCr3 = SwitchToProcessMemoryLayout(SearchMemRequest->ProcessId);
+        }
+    }
 
-                    if (IsDebuggeePaused)
-                    {
-                        if (SearchMemRequest->MemoryType == SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
-                        {
-                            //
-                            // It's a physical memory
-                            //
-                            Log("%llx\n", VirtualAddressToPhysicalAddress((PVOID)BaseIterator));
-                        }
-                        else
-                        {
-                            //
-                            // It's a virtual memory
-                            //
-                            Log("%llx\n", BaseIterator);
-                        }
-                    }
-                    else
-                    {
-                        if (SearchMemRequest->MemoryType == SEARCH_PHYSICAL_FROM_VIRTUAL_MEMORY)
-                        {
-                            //
-                            // It's a physical memory
-                            //
-                            AddressToSaveResults[IndexToArrayOfResults] = VirtualAddressToPhysicalAddress((PVOID)BaseIterator);
-                        }
-                        else
-                        {
-                            //
-                            // It's a virtual memory
-                            //
-                            AddressToSaveResults[IndexToArrayOfResults] = BaseIterator;
-                        }
-                    }
+    //
+    // The pattern might start at any address before the end address, so the
+    // memory is read up to the end of the last possible match
+    //
+    SearchLength   = EndAddress > StartAddress ? EndAddress - StartAddress : 0;
+    ReadEndAddress = StartAddress + SearchLength + PatternLength - 1;
 
-                    //
-                    // Increase the array pointer if it doesn't exceed the limitation
-                    //
-                    if (MaximumSearchResults > IndexToArrayOfResults)
-                    {
-                        IndexToArrayOfResults++;
-                    }
-                    else
-                    {
-                        //
-                        // The result buffer is full!
-                        //
-                        *CountOfMatchedCases = CountOfOccurance;
-                        return TRUE;
-                    }
-                }
-            }
-            else
+    if (ReadEndAddress < StartAddress)
+    {
+        ReadEndAddress = MAXULONG64;
+    }
+
+    CurrentAddress = StartAddress;
+
+    while (SearchLength != 0 && CurrentAddress < ReadEndAddress)
+    {
+        //
+        // Read the rest of the current page
+        //
+        ChunkSize = (UINT64)PAGE_ALIGN(CurrentAddress) + PAGE_SIZE - CurrentAddress;
+
+        if (ChunkSize > ReadEndAddress - CurrentAddress)
+        {
+            ChunkSize = ReadEndAddress - CurrentAddress;
+        }
+
+        //
+        // Each page is validated once, the search stops at the first invalid page
+        //
+        if (VirtualAddressToPhysicalAddress((PVOID)CurrentAddress) == (UINT64)NULL)
+        {
+            break;
+        }
+
+        //
+        // Check if we should access the memory directly, or through safe memory
+        // routine from vmx-root
+        //
+        if (IsDebuggeePaused)
+        {
+            if (!MemoryMapperReadMemorySafe(CurrentAddress, Window + WindowLength, ChunkSize))
             {
-                //
-                // Not found in the place
-                //
-                continue;
+                break;
             }
         }
+        else
+        {
+            RtlCopyMemory(Window + WindowLength, (PVOID)CurrentAddress, ChunkSize);
+        }
+
+        WindowLength += ChunkSize;
+        CurrentAddress += ChunkSize;
 
         //
-        // Restore the previous memory layout (cr3), if the user specified a
-        // special process
+        // The last (PatternLength - 1) bytes can't hold a complete pattern yet,
+        // so they are scanned with the next page (and never after the last page)
         //
-        if (IsDebuggeePaused || SearchMemRequest->ProcessId != HANDLE_TO_UINT32(PsGetCurrentProcessId()))
+        if (WindowLength < PatternLength)
         {
-            SwitchToPreviousProcess(CurrentProcessCr3);
+            continue;
         }
+
+        ScanLength = WindowLength - (PatternLength - 1);
+
+        if (WindowBase + ScanLength > SearchLength)
+        {
+            ScanLength = SearchLength > WindowBase ? SearchLength - WindowBase : 0;
+        }
+
+        if (!MemorySearchBuffer(&Search, Window, WindowLength, ScanLength, WindowBase, SearchMemorySaveResult, &ResultsContext))
+        {
+            //
+            // The result buffer is full!
+            //
+            break;
+        }
+
+        RtlMoveMemory(Window, Window + WindowLength - (PatternLength - 1), PatternLength - 1);
+
+        WindowBase += WindowLength - (PatternLength - 1);
+        WindowLength = PatternLength - 1;
     }
-    else if (SearchMemRequest->MemoryType == SEARCH_PHYSICAL_MEMORY)
-    {
-        //
-        // That's an error, the physical memory is handled like virtual memory and
-        // thus we should never reach here
-        //
-        LogError("Err, searching physical memory is not allowed without virtual address");
 
-        return FALSE;
+    //
+    // Restore the previous memory layout (cr3), if the user specified a
+    // special process
+    //
+    if (IsDebuggeePaused || SearchMemRequest->ProcessId != HANDLE_TO_UINT32(PsGetCurrentProcessId()))
+    {
+        SwitchToPreviousProcess(CurrentProcessCr3);
     }
-    else
+
+    if (!IsDebuggeePaused)
     {
-        //
-        // Invalid parameter
-        //
-        return FALSE;
+        PlatformMemFreePool(SearchBuffer);
     }
 
     //
     // As we're here the search is finished without error
     //
-    *CountOfMatchedCases = CountOfOccurance;
+    *CountOfMatchedCases = ResultsContext.CountOfOccurance;
     return TRUE;
 }
 
@@ -1015,41 +1068,17 @@ SearchAddressWrapper(PUINT64                 AddressToSaveResults,
         }
 
         //
-        // We will try to find a contigues address
+        // Check if the first page is valid or not, the search itself
+        // validates the next pages (and stops at the first invalid page)
+        // Generally, we can use VirtualAddressToPhysicalAddressByProcessId
+        // but let's not change the cr3 multiple times
         //
-        while (StartAddress < EndAddress)
-        {
-            //
-            // Check if address is valid or not
-            // Generally, we can use VirtualAddressToPhysicalAddressByProcessId
-            // but let's not change the cr3 multiple times
-            //
-            TempValue = VirtualAddressToPhysicalAddress((PVOID)StartAddress);
+        TempValue = VirtualAddressToPhysicalAddress((PVOID)StartAddress);
 
-            if (TempValue != 0)
-            {
-                //
-                // Address is valid, let's add a page size to it
-                // nothing to do
-                //
-                if (!DoesBaseAddrSaved)
-                {
-                    BaseAddress       = TempStartAddress;
-                    DoesBaseAddrSaved = TRUE;
-                }
-            }
-            else
-            {
-                //
-                // Address is not valid anymore
-                //
-                break;
-            }
-
-            //
-            // Make the start address ready for next address
-            //
-            StartAddress += PAGE_SIZE;
+        if (TempValue != 0 && StartAddress < EndAddress)
+        {
+            BaseAddress       = TempStartAddress;
+            DoesBaseAddrSaved = TRUE;
         }
 
         //
@@ -1060,7 +1089,7 @@ SearchAddressWrapper(PUINT64                 AddressToSaveResults,
         //
         // All of the address chunk was valid
         //
-        if (DoesBaseAddrSaved && StartAddress > BaseAddress)
+        if (DoesBaseAddrSaved)
         {
             SearchResult = PerformSearchAddress(AddressToSaveResults,
                                                 SearchMemRequest,
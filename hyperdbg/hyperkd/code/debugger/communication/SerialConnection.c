@@ -25,6 +25,146 @@ SerialConnectionTest()
     }
 }
 
+#if UseSerialFraming == TRUE
+
+/**
+ * @brief Receive a byte from the debugger (wait for it)
+ *
+ * @return UCHAR
+ */
+static UCHAR
+SerialConnectionRecvByte()
+{
+    UCHAR RecvChar = NULL_ZERO;
+
+    while (!KdHyperDbgRecvByte(&RecvChar))
+    {
+        //
+        // Wait for the byte
+        //
+    }
+
+    return RecvChar;
+}
+
+/**
+ * @brief Receive packet from the debugger
+ * @details The bytes are skipped until a valid header of a frame is
+ * received, then the payload is received and checked by its CRC32
+ *
+ * @param BufferToSave
+ * @param LengthReceived
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialConnectionRecvBuffer(CHAR *   BufferToSave,
+                           UINT32 * LengthReceived)
+{
+    SERIAL_FRAME_HEADER Header;
+    UCHAR *             HeaderBytes = (UCHAR *)&Header;
+
+    //
+    // Receive the header, slide it byte by byte until it's valid (the
+    // maximum size of the payload is MaxSerialPacketSize)
+    //
+    for (UINT32 i = 0; i < sizeof(SERIAL_FRAME_HEADER); i++)
+    {
+        HeaderBytes[i] = SerialConnectionRecvByte();
+    }
+
+    while (!SerialFrameCheckHeader(&Header, MaxSerialPacketSize))
+    {
+        memmove(HeaderBytes, HeaderBytes + 1, sizeof(SERIAL_FRAME_HEADER) - 1);
+        HeaderBytes[sizeof(SERIAL_FRAME_HEADER) - 1] = SerialConnectionRecvByte();
+    }
+
+    //
+    // Receive the payload
+    //
+    for (UINT32 i = 0; i < Header.Length; i++)
+    {
+        BufferToSave[i] = SerialConnectionRecvByte();
+    }
+
+    if (SerialFrameCrc32(0, BufferToSave, Header.Length) != Header.Crc32)
+    {
+        LogError("Err, a corrupted frame received in debuggee (invalid CRC32)");
+        return FALSE;
+    }
+
+    //
+    // Set the length
+    //
+    *LengthReceived = Header.Length;
+
+    return TRUE;
+}
+
+/**
+ * @brief Send a frame that its payload is made of (not appended) buffers
+ *
+ * @param Buffers buffers to send
+ * @param Lengths lengths of the buffers
+ * @param Count number of the buffers
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SerialConnectionSendFrame(CHAR ** Buffers, UINT32 * Lengths, UINT32 Count)
+{
+    SERIAL_FRAME_HEADER Header;
+    UINT32              Length = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Length += Lengths[i];
+    }
+
+    //
+    // Check if buffer not pass the boundary
+    //
+    if (Length > MaxSerialPacketSize)
+    {
+        LogError("Err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
+                 "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size",
+                 Length,
+                 MaxSerialPacketSize);
+        return FALSE;
+    }
+
+    SerialFrameInitializeHeader(&Header);
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        SerialFrameAppendToHeader(&Header, Buffers[i], Lengths[i]);
+    }
+
+    SerialFrameFinalizeHeader(&Header);
+
+    //
+    // Send the header
+    //
+    for (size_t i = 0; i < sizeof(SERIAL_FRAME_HEADER); i++)
+    {
+        KdHyperDbgSendByte(((UCHAR *)&Header)[i], TRUE);
+    }
+
+    //
+    // Send the buffers
+    //
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        for (size_t j = 0; j < Lengths[i]; j++)
+        {
+            KdHyperDbgSendByte(Buffers[i][j], TRUE);
+        }
+    }
+
+    return TRUE;
+}
+
+#else
+
 /**
  * @brief Send end of buffer packet
  *
@@ -145,15 +285,24 @@ SerialConnectionRecvBuffer(CHAR *   BufferToSave,
 }
 
 /**
- * @brief Perform sending buffer over serial
+ * @brief Send the (not appended) buffers that are followed by the end of
+ * buffer characters
  *
- * @param Buffer buffer to send
- * @param Length length of buffer to send
+ * @param Buffers buffers to send
+ * @param Lengths lengths of the buffers
+ * @param Count number of the buffers
  * @return BOOLEAN
  */
-BOOLEAN
-SerialConnectionSend(CHAR * Buffer, UINT32 Length)
+static BOOLEAN
+SerialConnectionSendFrame(CHAR ** Buffers, UINT32 * Lengths, UINT32 Count)
 {
+    UINT32 Length = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Length += Lengths[i];
+    }
+
     //
     // Check if buffer not pass the boundary
     //
@@ -166,9 +315,15 @@ SerialConnectionSend(CHAR * Buffer, UINT32 Length)
         return FALSE;
     }
 
-    for (size_t i = 0; i < Length; i++)
+    //
+    // Send the buffers
+    //
+    for (UINT32 i = 0; i < Count; i++)
     {
-        KdHyperDbgSendByte(Buffer[i], TRUE);
+        for (size_t j = 0; j < Lengths[i]; j++)
+        {
+            KdHyperDbgSendByte(Buffers[i][j], TRUE);
+        }
     }
 
     //
@@ -179,6 +334,21 @@ SerialConnectionSend(CHAR * Buffer, UINT32 Length)
     return TRUE;
 }
 
+#endif // UseSerialFraming == TRUE
+
+/**
+ * @brief Perform sending buffer over serial
+ *
+ * @param Buffer buffer to send
+ * @param Length length of buffer to send
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialConnectionSend(CHAR * Buffer, UINT32 Length)
+{
+    return SerialConnectionSendFrame(&Buffer, &Length, 1);
+}
+
 /**
  * @brief Perform sending 2 not appended buffers over serial
  *
@@ -191,40 +361,10 @@ SerialConnectionSend(CHAR * Buffer, UINT32 Length)
 BOOLEAN
 SerialConnectionSendTwoBuffers(CHAR * Buffer1, UINT32 Length1, CHAR * Buffer2, UINT32 Length2)
 {
-    //
-    // Check if buffer not pass the boundary
-    //
-    if ((Length1 + Length2 + SERIAL_END_OF_BUFFER_CHARS_COUNT) > MaxSerialPacketSize)
-    {
-        LogError("Err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
-                 "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size",
-                 Length1 + Length2 + SERIAL_END_OF_BUFFER_CHARS_COUNT,
-                 MaxSerialPacketSize);
-        return FALSE;
-    }
+    CHAR * Buffers[2] = {Buffer1, Buffer2};
+    UINT32 Lengths[2] = {Length1, Length2};
 
-    //
-    // Send first buffer
-    //
-    for (size_t i = 0; i < Length1; i++)
-    {
-        KdHyperDbgSendByte(Buffer1[i], TRUE);
-    }
-
-    //
-    // Send second buffer
-    //
-    for (size_t i = 0; i < Length2; i++)
-    {
-        KdHyperDbgSendByte(Buffer2[i], TRUE);
-    }
-
-    //
-    // Send the end buffer
-    //
-    SerialConnectionSendEndOfBuffer();
-
-    return TRUE;
+    return SerialConnectionSendFrame(Buffers, Lengths, 2);
 }
 
 /**
@@ -246,48 +386,10 @@ SerialConnectionSendThreeBuffers(CHAR * Buffer1,
                                  CHAR * Buffer3,
                                  UINT32 Length3)
 {
-    //
-    // Check if buffer not pass the boundary
-    //
-    if ((Length1 + Length2 + Length3 + SERIAL_END_OF_BUFFER_CHARS_COUNT) > MaxSerialPacketSize)
-    {
-        LogError("Err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
-                 "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size",
-                 Length1 + Length2 + Length3 + SERIAL_END_OF_BUFFER_CHARS_COUNT,
-                 MaxSerialPacketSize);
-        return FALSE;
-    }
+    CHAR * Buffers[3] = {Buffer1, Buffer2, Buffer3};
+    UINT32 Lengths[3] = {Length1, Length2, Length3};
 
-    //
-    // Send first buffer
-    //
-    for (size_t i = 0; i < Length1; i++)
-    {
-        KdHyperDbgSendByte(Buffer1[i], TRUE);
-    }
-
-    //
-    // Send second buffer
-    //
-    for (size_t i = 0; i < Length2; i++)
-    {
-        KdHyperDbgSendByte(Buffer2[i], TRUE);
-    }
-
-    //
-    // Send third buffer
-    //
-    for (size_t i = 0; i < Length3; i++)
-    {
-        KdHyperDbgSendByte(Buffer3[i], TRUE);
-    }
-
-    //
-    // Send the end buffer
-    //
-    SerialConnectionSendEndOfBuffer();
-
-    return TRUE;
+    return SerialConnectionSendFrame(Buffers, Lengths, 3);
 }
 
 /**
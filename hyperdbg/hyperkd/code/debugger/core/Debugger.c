@@ -112,6 +112,27 @@ DebuggerInitialize()
     InitializeListHead(&g_Events->ControlRegister3ModifiedEventsHead);
     InitializeListHead(&g_Events->ControlRegisterModifiedEventsHead);
 
+#if UseIndexedEventDispatch == TRUE
+
+    //
+    // Initialize the dispatch indexes of the events (one for each list)
+    //
+    for (size_t i = 0; i < sizeof(DEBUGGER_CORE_EVENTS) / sizeof(LIST_ENTRY); i++)
+    {
+        EventIndexInitialize(&g_EventIndexes[i]);
+    }
+
+#endif // UseIndexedEventDispatch == TRUE
+
+#if UseEventTagIndex == TRUE
+
+    //
+    // There is no event, so the index of the tags is also empty
+    //
+    TagIndexClear(&g_EventTagIndex);
+
+#endif // UseEventTagIndex == TRUE
+
     //
     // Enabled Debugger Events
     //
@@ -148,6 +169,40 @@ DebuggerInitialize()
     //
     RtlZeroMemory(g_ScriptGlobalVariables, MAX_VAR_COUNT * sizeof(UINT64));
 
+    //
+    // Initialize the buffer of searching memory in the debugger mode
+    //
+    if (!g_SearchMemoryBuffer)
+    {
+        g_SearchMemoryBuffer = PlatformMemAllocateNonPagedPool(SEARCH_MEMORY_BUFFER_SIZE);
+    }
+
+    if (!g_SearchMemoryBuffer)
+    {
+        //
+        // Out of resource, initialization of the search buffer failed
+        //
+        return FALSE;
+    }
+
+    //
+    // Initialize script engine's aggregation maps (a table for each core)
+    //
+    if (!g_ScriptEngineMaps.Tables)
+    {
+        PVOID MapsBuffer = PlatformMemAllocateNonPagedPool(ScriptEngineMapsGetRequiredSize(ProcessorsCount));
+
+        if (!MapsBuffer)
+        {
+            //
+            // Out of resource, initialization of script engine's aggregation maps failed
+            //
+            return FALSE;
+        }
+
+        ScriptEngineMapsInitialize(&g_ScriptEngineMaps, MapsBuffer, ProcessorsCount);
+    }
+
     //
     // Zero the TRAP FLAG state memory
     //
@@ -283,6 +338,24 @@ DebuggerUninitialize()
         g_ScriptGlobalVariables = NULL;
     }
 
+    //
+    // Free the buffer of searching memory
+    //
+    if (g_SearchMemoryBuffer != NULL)
+    {
+        PlatformMemFreePool(g_SearchMemoryBuffer);
+        g_SearchMemoryBuffer = NULL;
+    }
+
+    //
+    // Free script engine's aggregation maps
+    //
+    if (g_ScriptEngineMaps.Tables != NULL)
+    {
+        PlatformMemFreePool(g_ScriptEngineMaps.Tables);
+        g_ScriptEngineMaps.Tables = NULL;
+    }
+
     //
     // Free core specific local and temp variables
     //
@@ -478,6 +551,11 @@ DebuggerCreateEvent(BOOLEAN                           Enabled,
     //
     InitializeListHead(&Event->ActionsListHead);
 
+    //
+    // The event is added to the dispatch index once it's applied
+    //
+    EventIndexInitializeNode(&Event->IndexNode);
+
     //
     // Return our event
     //
@@ -985,6 +1063,21 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
         Action->ScriptConfiguration.ScriptLength                = InTheCaseOfRunScript->ScriptLength;
         Action->ScriptConfiguration.ScriptPointer               = InTheCaseOfRunScript->ScriptPointer;
         Action->ScriptConfiguration.OptionalRequestedBufferSize = InTheCaseOfRunScript->OptionalRequestedBufferSize;
+        Action->ScriptConfiguration.SendRecords                 = InTheCaseOfRunScript->SendRecords;
+
+#if UseScriptEnginePreDecodedInterpreter == TRUE
+
+        //
+        // Pre-decode the script once, it's only possible if we're not in vmx-root
+        // as the buffer is allocated from the OS pools, if it fails, the script
+        // simply runs on the regular interpreter
+        //
+        if (!InputFromVmxRoot)
+        {
+            DebuggerPreDecodeActionScript(Action);
+        }
+
+#endif // UseScriptEnginePreDecodedInterpreter == TRUE
     }
 
     //
@@ -1009,6 +1102,44 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
     return Action;
 }
 
+/**
+ * @brief Pre-decode the script of a run script action
+ * @details should be called from vmx non-root mode
+ *
+ * @param Action The run script action
+ *
+ * @return BOOLEAN TRUE if the script is pre-decoded
+ */
+BOOLEAN
+DebuggerPreDecodeActionScript(PDEBUGGER_EVENT_ACTION Action)
+{
+    SYMBOL_BUFFER CodeBuffer        = {0};
+    PVOID         DecodedBuffer     = NULL;
+    UINT32        DecodedBufferSize = 0;
+
+    CodeBuffer.Head    = (PSYMBOL)Action->ScriptConfiguration.ScriptBuffer;
+    CodeBuffer.Size    = Action->ScriptConfiguration.ScriptLength;
+    CodeBuffer.Pointer = Action->ScriptConfiguration.ScriptPointer;
+
+    DecodedBufferSize = ScriptEngineDecodeGetBufferSize(&CodeBuffer);
+    DecodedBuffer     = PlatformMemAllocateZeroedNonPagedPool(DecodedBufferSize);
+
+    if (DecodedBuffer == NULL)
+    {
+        return FALSE;
+    }
+
+    if (!ScriptEngineDecode(&CodeBuffer, DecodedBuffer, DecodedBufferSize))
+    {
+        PlatformMemFreePool(DecodedBuffer);
+        return FALSE;
+    }
+
+    Action->DecodedScriptBuffer = DecodedBuffer;
+
+    return TRUE;
+}
+
 /**
  * @brief Register an event to a list of active events
  *
@@ -1029,6 +1160,16 @@ DebuggerRegisterEvent(PDEBUGGER_EVENT Event)
     {
         InsertHeadList(TargetEventList, &(Event->EventsOfSameTypeList));
 
+#if UseEventTagIndex == TRUE
+
+        //
+        // Also add it to the index of the tags (if it's not added, the
+        // events are found by walking the lists)
+        //
+        TagIndexInsert(&g_EventTagIndex, Event->Tag, Event);
+
+#endif // UseEventTagIndex == TRUE
+
         return TRUE;
     }
     else
@@ -1062,8 +1203,14 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
     DEBUGGER_TRIGGERED_EVENT_DETAILS EventTriggerDetail = {0};
     PEPT_HOOKS_CONTEXT               EptContext;
     PLIST_ENTRY                      TempList        = 0;
-    PLIST_ENTRY                      TempList2       = 0;
     const PVOID                      OriginalContext = Context;
+    UINT32                           CurrentProcessId;
+#if UseIndexedEventDispatch == TRUE
+    EVENT_INDEX_ITERATOR IndexIterator;
+    PEVENT_INDEX_NODE    IndexNode;
+#else
+    PLIST_ENTRY TempList2 = 0;
+#endif // UseIndexedEventDispatch == TRUE
 
     //
     // Check if triggering debugging actions are allowed or not
@@ -1089,19 +1236,42 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
     //
     // Find the debugger events list base on the type of the event
     //
-    TempList  = DebuggerGetEventListByEventType(EventType);
-    TempList2 = TempList;
+    TempList = DebuggerGetEventListByEventType(EventType);
 
     if (TempList == NULL)
     {
         return VMM_CALLBACK_TRIGGERING_EVENT_STATUS_INVALID_EVENT_TYPE;
     }
 
+    CurrentProcessId = HANDLE_TO_UINT32(PsGetCurrentProcessId());
+
+#if UseIndexedEventDispatch == TRUE
+
+    //
+    // Only visit the events of the same key (e.g., the same MSR) and the
+    // events of all keys, the order is the same as the list of the events
+    //
+    EventIndexBeginLookup(DebuggerGetEventIndexByEventType(EventType),
+                          &IndexIterator,
+                          DebuggerGetEventIndexKeyOfContext(EventType, OriginalContext),
+                          DbgState->CoreId,
+                          CurrentProcessId);
+
+    while ((IndexNode = EventIndexGetNext(&IndexIterator)) != NULL)
+    {
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(IndexNode, DEBUGGER_EVENT, IndexNode);
+
+#else
+
+    TempList2 = TempList;
+
     while (TempList2 != TempList->Flink)
     {
         TempList                     = TempList->Flink;
         PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
 
+#endif // UseIndexedEventDispatch == TRUE
+
         //
         // check if the event is enabled or not
         //
@@ -1124,7 +1294,7 @@ DebuggerTriggerEvents(VMM_EVENT_TYPE_ENUM                   EventType,
         //
         // Check if this event is for this process or not
         //
-        if (CurrentEvent->ProcessId != DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES && CurrentEvent->ProcessId != HANDLE_TO_UINT32(PsGetCurrentProcessId()))
+        if (CurrentEvent->ProcessId != DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES && CurrentEvent->ProcessId != CurrentProcessId)
         {
             //
             // This event is not related to either our process or all processes
@@ -1554,10 +1724,11 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
                          DEBUGGEE_SCRIPT_PACKET *           ScriptDetails,
                          DEBUGGER_TRIGGERED_EVENT_DETAILS * EventTriggerDetail)
 {
-    SYMBOL_BUFFER                   CodeBuffer             = {0};
-    ACTION_BUFFER                   ActionBuffer           = {0};
-    SYMBOL                          ErrorSymbol            = {0};
-    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    SYMBOL_BUFFER                          CodeBuffer             = {0};
+    ACTION_BUFFER                          ActionBuffer           = {0};
+    SYMBOL                                 ErrorSymbol            = {0};
+    SCRIPT_ENGINE_GENERAL_REGISTERS        ScriptGeneralRegisters = {0};
+    SCRIPT_ENGINE_DECODED_EXECUTION_STATUS Status                 = SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL;
 
     if (Action != NULL)
     {
@@ -1580,6 +1751,7 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
         ActionBuffer.Tag                       = EventTriggerDetail->Tag;
         ActionBuffer.ImmediatelySendTheResults = Action->ImmediatelySendTheResults;
         ActionBuffer.CurrentAction             = (UINT64)Action;
+        ActionBuffer.SendRecords               = Action->ScriptConfiguration.SendRecords;
 
         //
         // Context point to the registers
@@ -1632,37 +1804,73 @@ DebuggerPerformRunScript(PROCESSOR_DEBUGGING_STATE *        DbgState,
     ScriptGeneralRegisters.GlobalVariablesList = g_ScriptGlobalVariables;
     RtlZeroMemory(ScriptGeneralRegisters.StackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
 
-    UINT64 EXECUTENUMBER = 0;
-
-    for (UINT64 i = 0; i < CodeBuffer.Pointer;)
+    //
+    // Run the pre-decoded script if it's available
+    //
+    if (Action != NULL && Action->DecodedScriptBuffer != NULL)
     {
-        //
-        // If has error, show error message and abort.
-        //
+        Status = ScriptEngineExecuteDecoded(DbgState->Regs,
+                                            &ActionBuffer,
+                                            &ScriptGeneralRegisters,
+                                            &CodeBuffer,
+                                            (PSCRIPT_ENGINE_DECODED_BUFFER)Action->DecodedScriptBuffer,
+                                            &ErrorSymbol,
+                                            NULL);
+    }
+    else
+    {
+        UINT64 EXECUTENUMBER = 0;
 
-        if (ScriptEngineExecute(DbgState->Regs,
-                                &ActionBuffer,
-                                &ScriptGeneralRegisters,
-                                &CodeBuffer,
-                                &i,
-                                &ErrorSymbol) == TRUE)
+        for (UINT64 i = 0; i < CodeBuffer.Pointer;)
         {
-            LogInfo("Err, ScriptEngineExecute, function = % s\n ",
-                    FunctionNames[ErrorSymbol.Value]);
-            break;
-        }
-        else if (ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
-        {
-            LogInfo("Err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
-            break;
-        }
-        else if (EXECUTENUMBER >= MAX_EXECUTION_COUNT)
-        {
-            LogInfo("Err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
-            break;
+            //
+            // If has error, abort
+            //
+            if (ScriptEngineExecute(DbgState->Regs,
+                                    &ActionBuffer,
+                                    &ScriptGeneralRegisters,
+                                    &CodeBuffer,
+                                    &i,
+                                    &ErrorSymbol) == TRUE)
+            {
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_ERROR;
+                break;
+            }
+            else if (ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
+            {
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW;
+                break;
+            }
+            else if (EXECUTENUMBER >= MAX_EXECUTION_COUNT)
+            {
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT;
+                break;
+            }
+
+            EXECUTENUMBER++;
         }
+    }
 
-        EXECUTENUMBER++;
+    //
+    // Show error message (the same for both of the interpreters)
+    //
+    switch (Status)
+    {
+    case SCRIPT_ENGINE_DECODED_EXECUTION_ERROR:
+        LogInfo("Err, ScriptEngineExecute, function = % s\n ",
+                FunctionNames[ErrorSymbol.Value]);
+        break;
+
+    case SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW:
+        LogInfo("Err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+        break;
+
+    case SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT:
+        LogInfo("Err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+        break;
+
+    default:
+        break;
     }
 
     return TRUE;
@@ -1781,6 +1989,19 @@ DebuggerGetEventByTag(UINT64 Tag)
     PLIST_ENTRY TempList  = 0;
     PLIST_ENTRY TempList2 = 0;
 
+#if UseEventTagIndex == TRUE
+
+    //
+    // If all of the events are in the index, there is no need to walk
+    // the lists
+    //
+    if (TagIndexIsComplete(&g_EventTagIndex))
+    {
+        return (PDEBUGGER_EVENT)TagIndexFind(&g_EventTagIndex, Tag);
+    }
+
+#endif // UseEventTagIndex == TRUE
+
     //
     // We have to iterate through all events
     //
@@ -2102,6 +2323,163 @@ DebuggerGetEventListByEventType(VMM_EVENT_TYPE_ENUM EventType)
     return ResultList;
 }
 
+/**
+ * @brief Get the dispatch index of events based on event type
+ *
+ * @param EventType type of event
+ * @return PEVENT_INDEX
+ */
+PEVENT_INDEX
+DebuggerGetEventIndexByEventType(VMM_EVENT_TYPE_ENUM EventType)
+{
+    PLIST_ENTRY EventList = DebuggerGetEventListByEventType(EventType);
+
+    if (EventList == NULL)
+    {
+        return NULL;
+    }
+
+    //
+    // Each list of the events has an index at the same position
+    //
+    return &g_EventIndexes[EventList - (PLIST_ENTRY)g_Events];
+}
+
+/**
+ * @brief Get the key of an event in the dispatch index
+ * @details The key is the same value that is compared with the context
+ * of the triggered event
+ *
+ * @param Event Event Object
+ * @param Key The key of the event
+ *
+ * @return BOOLEAN FALSE if the event is triggered for all keys
+ */
+BOOLEAN
+DebuggerGetEventIndexKey(PDEBUGGER_EVENT Event, UINT64 * Key)
+{
+    *Key = Event->Options.OptionalParam1;
+
+    switch (Event->EventType)
+    {
+    case HIDDEN_HOOK_READ_AND_WRITE_AND_EXECUTE:
+    case HIDDEN_HOOK_READ_AND_WRITE:
+    case HIDDEN_HOOK_READ_AND_EXECUTE:
+    case HIDDEN_HOOK_WRITE_AND_EXECUTE:
+    case HIDDEN_HOOK_READ:
+    case HIDDEN_HOOK_WRITE:
+    case HIDDEN_HOOK_EXECUTE:
+
+        //
+        // The hooking tag is same as the event tag
+        //
+        *Key = Event->Tag;
+
+        return TRUE;
+
+    case HIDDEN_HOOK_EXEC_CC:
+    case HIDDEN_HOOK_EXEC_DETOURS:
+    case EXTERNAL_INTERRUPT_OCCURRED:
+    case CONTROL_REGISTER_MODIFIED:
+
+        return TRUE;
+
+    case RDMSR_INSTRUCTION_EXECUTION:
+    case WRMSR_INSTRUCTION_EXECUTION:
+
+        return Event->Options.OptionalParam1 != DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS;
+
+    case EXCEPTION_OCCURRED:
+
+        return Event->Options.OptionalParam1 != DEBUGGER_EVENT_EXCEPTIONS_ALL_FIRST_32_ENTRIES;
+
+    case IN_INSTRUCTION_EXECUTION:
+    case OUT_INSTRUCTION_EXECUTION:
+
+        return Event->Options.OptionalParam1 != DEBUGGER_EVENT_ALL_IO_PORTS;
+
+    case SYSCALL_HOOK_EFER_SYSCALL:
+
+        return Event->Options.OptionalParam1 != DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS;
+
+    case CPUID_INSTRUCTION_EXECUTION:
+
+        //
+        // The first parameter shows whether a special CPUID is requested
+        //
+        *Key = Event->Options.OptionalParam2;
+
+        return Event->Options.OptionalParam1 != (UINT64)NULL;
+
+    default:
+
+        //
+        // Other events (and the events that are checked differently, like
+        // the mode changes) are triggered for all keys
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Get the key of the triggered events in the dispatch index
+ *
+ * @param EventType Type of events
+ * @param Context The context of the triggered event
+ *
+ * @return UINT64
+ */
+UINT64
+DebuggerGetEventIndexKeyOfContext(VMM_EVENT_TYPE_ENUM EventType, PVOID Context)
+{
+    switch (EventType)
+    {
+    case HIDDEN_HOOK_READ_AND_WRITE_AND_EXECUTE:
+    case HIDDEN_HOOK_READ_AND_WRITE:
+    case HIDDEN_HOOK_READ_AND_EXECUTE:
+    case HIDDEN_HOOK_WRITE_AND_EXECUTE:
+    case HIDDEN_HOOK_READ:
+    case HIDDEN_HOOK_WRITE:
+    case HIDDEN_HOOK_EXECUTE:
+
+        return ((PEPT_HOOKS_CONTEXT)Context)->HookingTag;
+
+    case HIDDEN_HOOK_EXEC_DETOURS:
+
+        return ((PEPT_HOOKS_CONTEXT)Context)->PhysicalAddress;
+
+    default:
+
+        return (UINT64)Context;
+    }
+}
+
+/**
+ * @brief Add an applied event to the dispatch index of its type
+ * @details If the event is already in the index (applied again), its
+ * key is updated
+ *
+ * @param Event Event Object
+ *
+ * @return VOID
+ */
+VOID
+DebuggerAddEventToIndex(PDEBUGGER_EVENT Event)
+{
+    PEVENT_INDEX EventIndex = DebuggerGetEventIndexByEventType(Event->EventType);
+    BOOLEAN      IsKeyed;
+    UINT64       Key;
+
+    if (EventIndex == NULL)
+    {
+        return;
+    }
+
+    IsKeyed = DebuggerGetEventIndexKey(Event, &Key);
+
+    EventIndexInsert(EventIndex, &Event->IndexNode, IsKeyed, Key, Event->CoreId, Event->ProcessId);
+}
+
 /**
  * @brief Count the list of events in a special list that
  * are activate on a target core
@@ -2442,40 +2820,45 @@ DebuggerQueryDebuggerStatus()
 BOOLEAN
 DebuggerRemoveEventFromEventList(UINT64 Tag)
 {
-    PLIST_ENTRY TempList  = 0;
-    PLIST_ENTRY TempList2 = 0;
+    PDEBUGGER_EVENT Event;
 
     //
-    // We have to iterate through all events
+    // Find the event (the same as walking all of the lists)
     //
-    for (size_t i = 0; i < sizeof(DEBUGGER_CORE_EVENTS) / sizeof(LIST_ENTRY); i++)
+    Event = DebuggerGetEventByTag(Tag);
+
+    if (Event == NULL)
     {
-        TempList  = (PLIST_ENTRY)((UINT64)(g_Events) + (i * sizeof(LIST_ENTRY)));
-        TempList2 = TempList;
+        //
+        // We didn't find anything
+        //
+        return FALSE;
+    }
 
-        while (TempList2 != TempList->Flink)
-        {
-            TempList                     = TempList->Flink;
-            PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+    //
+    // We have to remove the event from the list
+    //
+    RemoveEntryList(&Event->EventsOfSameTypeList);
 
-            //
-            // Check if we find the event or not
-            //
-            if (CurrentEvent->Tag == Tag)
-            {
-                //
-                // We have to remove the event from the list
-                //
-                RemoveEntryList(&CurrentEvent->EventsOfSameTypeList);
-                return TRUE;
-            }
-        }
-    }
+#if UseIndexedEventDispatch == TRUE
 
     //
-    // We didn't find anything, so return null
+    // And also from the dispatch index
     //
-    return FALSE;
+    EventIndexRemove(DebuggerGetEventIndexByEventType(Event->EventType), &Event->IndexNode);
+
+#endif // UseIndexedEventDispatch == TRUE
+
+#if UseEventTagIndex == TRUE
+
+    //
+    // And also from the index of the tags
+    //
+    TagIndexRemove(&g_EventTagIndex, Event->Tag, Event);
+
+#endif // UseEventTagIndex == TRUE
+
+    return TRUE;
 }
 
 /**
@@ -2527,6 +2910,14 @@ DebuggerRemoveAllActionsFromEvent(PDEBUGGER_EVENT Event, BOOLEAN PoolManagerAllo
             }
         }
 
+        //
+        // Free the pre-decoded script (it's always allocated from the OS pools)
+        //
+        if (CurrentAction->DecodedScriptBuffer != NULL && !PoolManagerAllocatedMemory)
+        {
+            PlatformMemFreePool(CurrentAction->DecodedScriptBuffer);
+        }
+
         //
         // Remove the action and free the pool,
         // if it's a custom buffer then the buffer
@@ -3005,6 +3396,15 @@ DebuggerApplyEvent(PDEBUGGER_EVENT                   Event,
     }
     }
 
+#if UseIndexedEventDispatch == TRUE
+
+    //
+    // The options of the event are set, so it can be dispatched by its key
+    //
+    DebuggerAddEventToIndex(Event);
+
+#endif // UseIndexedEventDispatch == TRUE
+
     //
     // Set the status
     //
@@ -3277,6 +3677,7 @@ DebuggerParseAction(PDEBUGGER_GENERAL_ACTION          ActionDetails,
         UserScriptConfig.ScriptLength                                   = ActionDetails->ScriptBufferSize;
         UserScriptConfig.ScriptPointer                                  = ActionDetails->ScriptBufferPointer;
         UserScriptConfig.OptionalRequestedBufferSize                    = ActionDetails->PreAllocatedBuffer;
+        UserScriptConfig.SendRecords                                    = ActionDetails->SendRecords;
 
         Action = DebuggerAddActionToEvent(Event,
                                           RUN_SCRIPT,
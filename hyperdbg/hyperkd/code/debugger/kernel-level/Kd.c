@@ -1163,6 +1163,7 @@ KdHandleRegisteredMtfCallback(UINT32 CoreId)
         UINT64                           CsSel         = NULL64_ZERO;
         DEBUGGER_TRIGGERED_EVENT_DETAILS TargetContext = {0};
         UINT64                           LastVmexitRip = VmFuncGetLastVmexitRip(CoreId);
+        DEBUGGEE_PAUSING_REASON          Reason        = DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED;
 
         //
         // Check if the cs selector changed or not, which indicates that the
@@ -1187,15 +1188,45 @@ KdHandleRegisteredMtfCallback(UINT32 CoreId)
                                                                 DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED,
                                                                 TRUE))
         {
+            if (DbgState->BatchedTracking.IsTracking)
+            {
+                //
+                // The debuggee tracks the instructions by itself, so it's only
+                // paused after the last step of the batch
+                //
+                if (KdHandleBatchedTrackingStep(DbgState, LastVmexitRip))
+                {
+                    return;
+                }
+
+                Reason                             = DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_BATCH_FINISHED;
+                DbgState->IgnoreDisasmInNextPacket = TRUE;
+            }
+            else if (DbgState->IgnoreDisasmInNextPacket)
+            {
+                //
+                // If the disassembly ignored here, it means the debugger wants to use it
+                // as a tracking mechanism, so we'll change the reason for that
+                //
+                Reason = DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_STEPPED;
+            }
+
             //
-            // Handle the step (if the disassembly ignored here, it means the debugger wants to use it
-            // as a tracking mechanism, so we'll change the reason for that)
+            // Handle the step
             //
             TargetContext.Context = (PVOID)LastVmexitRip;
             KdHandleBreakpointAndDebugBreakpoints(DbgState,
-                                                  DbgState->IgnoreDisasmInNextPacket ? DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_STEPPED : DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED,
+                                                  Reason,
                                                   &TargetContext);
         }
+        else
+        {
+            //
+            // The step is handled by the breakpoints (and the debuggee might be
+            // paused there), so the tracking in batches is stopped
+            //
+            KdFlushBatchedTracking(DbgState);
+        }
     }
 }
 
@@ -1573,6 +1604,164 @@ KdRegularStepOver(PROCESSOR_DEBUGGING_STATE * DbgState, BOOLEAN IsNextInstructio
     }
 }
 
+/**
+ * @brief Start tracking the 'call' and the 'ret' instructions in batches
+ * @details The debuggee steps the instructions by itself and only the executed
+ * 'call' and 'ret' instructions are sent to the debugger (as records), instead
+ * of pausing and sending the current instruction after each step
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param StepCount Number of the instructions to step
+ *
+ * @return VOID
+ */
+VOID
+KdStartBatchedTracking(PROCESSOR_DEBUGGING_STATE * DbgState, UINT32 StepCount)
+{
+    DEBUGGEE_BATCHED_TRACKING_STATE * TrackingState = &DbgState->BatchedTracking;
+
+    if (StepCount == 0 || StepCount > DEBUGGER_REMOTE_TRACKING_MAXIMUM_COUNT_OF_STEPPING_IN_BATCH)
+    {
+        StepCount = DEBUGGER_REMOTE_TRACKING_MAXIMUM_COUNT_OF_STEPPING_IN_BATCH;
+    }
+
+    TrackingState->IsTracking     = TRUE;
+    TrackingState->RemainingSteps = StepCount;
+
+    TrackTraceBufferReset(&TrackingState->Records);
+
+    //
+    // Check the instruction that is going to be stepped
+    //
+    KdClassifyBatchedTrackingInstruction(DbgState, VmFuncGetLastVmexitRip(DbgState->CoreId));
+
+    //
+    // Indicate a step
+    //
+    KdGuaranteedStepInstruction(DbgState);
+}
+
+/**
+ * @brief Check whether the instruction that is going to be stepped is a
+ * 'call' or a 'ret' (in the case of tracking in batches)
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Rip Address of the instruction
+ *
+ * @return VOID
+ */
+VOID
+KdClassifyBatchedTrackingInstruction(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip)
+{
+    TRACK_TRACE_RECORD * PendingRecord = &DbgState->BatchedTracking.PendingRecord;
+    BOOLEAN              IsRet         = FALSE;
+    UINT32               Length        = 0;
+
+    if (DisassemblerCheckCallOrRetInVmxRootOnTargetProcess((PVOID)Rip, KdIsGuestOnUsermode32Bit(), &IsRet, &Length))
+    {
+        PendingRecord->Kind   = IsRet ? TRACK_TRACE_KIND_RET : TRACK_TRACE_KIND_CALL;
+        PendingRecord->Rip    = Rip;
+        PendingRecord->Length = Length;
+    }
+    else
+    {
+        PendingRecord->Kind = TRACK_TRACE_KIND_NONE;
+    }
+}
+
+/**
+ * @brief Handle the MTF of a step in the case of tracking in batches
+ * @details The current instruction is the target of the stepped instruction,
+ * so if it was a 'call' or a 'ret', its record is added here (it also covers
+ * the indirect calls)
+ *
+ * @param DbgState The state of the debugger on the current core
+ * @param Rip Address of the current instruction
+ *
+ * @return BOOLEAN TRUE if the tracking is continued, FALSE if the batch is
+ * finished and the debuggee should be paused
+ */
+BOOLEAN
+KdHandleBatchedTrackingStep(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip)
+{
+    DEBUGGEE_BATCHED_TRACKING_STATE * TrackingState = &DbgState->BatchedTracking;
+
+    if (TrackingState->PendingRecord.Kind != TRACK_TRACE_KIND_NONE)
+    {
+        TrackingState->PendingRecord.Target = Rip;
+
+        if (!TrackTraceBufferAdd(&TrackingState->Records, &TrackingState->PendingRecord))
+        {
+            //
+            // The buffer is full, send it to the debugger and add the record
+            // to the next buffer
+            //
+            KdSendBatchedTrackingRecords(DbgState);
+
+            TrackTraceBufferAdd(&TrackingState->Records, &TrackingState->PendingRecord);
+        }
+    }
+
+    TrackingState->RemainingSteps--;
+
+    if (TrackingState->RemainingSteps == 0)
+    {
+        return FALSE;
+    }
+
+    //
+    // Step the next instruction
+    //
+    KdClassifyBatchedTrackingInstruction(DbgState, Rip);
+    KdGuaranteedStepInstruction(DbgState);
+
+    return TRUE;
+}
+
+/**
+ * @brief Send the records of tracking in batches to the debugger
+ *
+ * @param DbgState The state of the debugger on the current core
+ *
+ * @return VOID
+ */
+VOID
+KdSendBatchedTrackingRecords(PROCESSOR_DEBUGGING_STATE * DbgState)
+{
+    TRACK_TRACE_BUFFER * Records = &DbgState->BatchedTracking.Records;
+
+    if (Records->RecordCount != 0)
+    {
+        KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                   DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_TRACKING_RECORDS,
+                                   (CHAR *)Records,
+                                   FIELD_OFFSET(TRACK_TRACE_BUFFER, Data) + Records->Size);
+    }
+
+    TrackTraceBufferReset(Records);
+}
+
+/**
+ * @brief Finish tracking in batches (if the current core is tracking) and
+ * send its remaining records to the debugger
+ *
+ * @param DbgState The state of the debugger on the current core
+ *
+ * @return VOID
+ */
+VOID
+KdFlushBatchedTracking(PROCESSOR_DEBUGGING_STATE * DbgState)
+{
+    if (!DbgState->BatchedTracking.IsTracking)
+    {
+        return;
+    }
+
+    KdSendBatchedTrackingRecords(DbgState);
+
+    DbgState->BatchedTracking.IsTracking = FALSE;
+}
+
 /**
  * @brief Send event registration buffer to user-mode to register the event
  * @param EventDetailHeader
@@ -2428,6 +2617,26 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
 
                     break;
 
+                case DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_FOR_BATCHED_TRACKING:
+
+                    //
+                    // Used for tracking in batches (creating call tree), the debuggee
+                    // steps the instructions by itself
+                    //
+                    KdStartBatchedTracking(DbgState, SteppingPacket->TrackingCount);
+
+                    //
+                    // Unlock just on core
+                    //
+                    KdContinueDebuggeeJustCurrentCore(DbgState);
+
+                    //
+                    // No need to wait for new commands
+                    //
+                    EscapeFromTheLoop = TRUE;
+
+                    break;
+
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER:
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU:
                 case DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU_LAST_INSTRUCTION:
@@ -2566,6 +2775,34 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
 
                 CallstackFrameBuffer = (DEBUGGER_SINGLE_CALLSTACK_FRAME *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(DEBUGGER_CALLSTACK_REQUEST));
 
+                //
+                // The debugger only sends the request, the frames are filled in
+                // the packet buffer, so they should fit in it
+                //
+                if (CallstackPacket->FrameCount > CALLSTACK_MAXIMUM_FRAMES_IN_PACKET)
+                {
+                    CallstackPacket->FrameCount = CALLSTACK_MAXIMUM_FRAMES_IN_PACKET;
+                    CallstackPacket->Size       = CallstackPacket->FrameCount * (CallstackPacket->Is32Bit ? sizeof(UINT32) : sizeof(UINT64));
+                }
+
+                //
+                // The current frame of the 64-bit code is unwound based on the unwind
+                // data of the images (only the real frames are sent), otherwise (or
+                // if it can't be unwound) all of the stack values are sent
+                //
+                CallstackPacket->IsUnwound = FALSE;
+
+                if (CallstackPacket->BaseAddress == (UINT64)NULL &&
+                    !CallstackPacket->Is32Bit &&
+                    CallstackPacket->DisplayMethod == DEBUGGER_CALLSTACK_DISPLAY_METHOD_WITHOUT_PARAMS)
+                {
+                    CallstackPacket->IsUnwound = CallstackUnwindStack(CallstackFrameBuffer,
+                                                                      DbgState->Regs,
+                                                                      VmFuncGetRip(),
+                                                                      CallstackPacket->FrameCount,
+                                                                      &CallstackPacket->FrameCount);
+                }
+
                 //
                 // If the address is null, we use the current RSP register
                 //
@@ -2577,7 +2814,8 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
                 //
                 // Feel the callstack frames the buffers
                 //
-                if (CallstackWalkthroughStack(CallstackFrameBuffer,
+                if (CallstackPacket->IsUnwound ||
+                    CallstackWalkthroughStack(CallstackFrameBuffer,
                                               CallstackPacket->BaseAddress,
                                               CallstackPacket->Size,
                                               CallstackPacket->Is32Bit))
@@ -2589,6 +2827,9 @@ KdDispatchAndPerformCommandsFromDebugger(PROCESSOR_DEBUGGING_STATE * DbgState)
                     CallstackPacket->KernelStatus = DEBUGGER_ERROR_UNABLE_TO_GET_CALLSTACK;
                 }
 
+                CallstackPacket->BufferSize = sizeof(DEBUGGER_CALLSTACK_REQUEST) +
+                                              (CallstackPacket->FrameCount * sizeof(DEBUGGER_SINGLE_CALLSTACK_FRAME));
+
                 //
                 // Send the result of flushing back to the debuggee
                 //
@@ -3263,6 +3504,12 @@ StartAgain:
         //
         // *** Current Operating Core  ***
         //
+
+        //
+        // Send the remaining records of tracking (if any) before the pause packet
+        //
+        KdFlushBatchedTracking(DbgState);
+
         RtlZeroMemory(&PausePacket, sizeof(DEBUGGEE_KD_PAUSED_PACKET));
 
         //
@@ -76,7 +76,44 @@ GlobalEventsAllocateZeroedMemory(VOID)
         RtlZeroBytes(g_Events, sizeof(DEBUGGER_CORE_EVENTS));
     }
 
+#if UseIndexedEventDispatch == TRUE
+
+    //
+    // Allocate buffer for the dispatch indexes of the events
+    //
+    if (!g_EventIndexes)
+    {
+        g_EventIndexes = PlatformMemAllocateNonPagedPool(sizeof(EVENT_INDEX) * (sizeof(DEBUGGER_CORE_EVENTS) / sizeof(LIST_ENTRY)));
+    }
+
+    if (g_EventIndexes == NULL)
+    {
+        return FALSE;
+    }
+
+#endif // UseIndexedEventDispatch == TRUE
+
+#if UseEventTagIndex == TRUE
+
+    //
+    // Allocate buffer for the index of the events' tags
+    //
+    if (!g_EventTagIndex.DenseTable)
+    {
+        TagIndexInitialize(&g_EventTagIndex,
+                           PlatformMemAllocateNonPagedPool(TagIndexGetRequiredSize(EVENT_TAG_INDEX_DENSE_COUNT, EVENT_TAG_INDEX_OVERFLOW_CAPACITY)),
+                           DebuggerEventTagStartSeed,
+                           EVENT_TAG_INDEX_DENSE_COUNT,
+                           EVENT_TAG_INDEX_OVERFLOW_CAPACITY);
+    }
+
+    return g_Events != NULL && g_EventTagIndex.DenseTable != NULL;
+
+#else
+
     return g_Events != NULL;
+
+#endif // UseEventTagIndex == TRUE
 }
 
 /**
@@ -92,4 +129,24 @@ GlobalEventsFreeMemory(VOID)
         PlatformMemFreePool(g_Events);
         g_Events = NULL;
     }
+
+#if UseIndexedEventDispatch == TRUE
+
+    if (g_EventIndexes != NULL)
+    {
+        PlatformMemFreePool(g_EventIndexes);
+        g_EventIndexes = NULL;
+    }
+
+#endif // UseIndexedEventDispatch == TRUE
+
+#if UseEventTagIndex == TRUE
+
+    if (g_EventTagIndex.DenseTable != NULL)
+    {
+        PlatformMemFreePool((PVOID)g_EventTagIndex.DenseTable);
+        g_EventTagIndex.DenseTable = NULL;
+    }
+
+#endif // UseEventTagIndex == TRUE
 }
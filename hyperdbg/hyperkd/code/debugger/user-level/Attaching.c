@@ -86,6 +86,92 @@ AttachingInitialize()
     return TRUE;
 }
 
+/**
+ * @brief Allocate the indexes of the threads and the processes of the
+ * user debugger
+ * @details this function should be called on vmx non-root, the entries of
+ * the indexes are in the details of the threads and the processes, so only
+ * the buckets are allocated here and nothing is allocated in vmx-root
+ *
+ * @return BOOLEAN whether all of the indexes are allocated or not (the lists
+ * are walked instead of the indexes that are not allocated)
+ */
+BOOLEAN
+AttachingAllocateDebuggingDetailsIndexes()
+{
+#if UseUserDebuggingIndex == TRUE
+
+    if (g_UserDebuggingThreadIndex.Buckets == NULL)
+    {
+        ChainedIndexInitialize(&g_UserDebuggingThreadIndex,
+                               PlatformMemAllocateNonPagedPool(ChainedIndexGetRequiredSize(USER_DEBUGGING_THREAD_INDEX_BUCKETS)),
+                               USER_DEBUGGING_THREAD_INDEX_BUCKETS);
+    }
+
+    if (g_UserDebuggingProcessIdIndex.Buckets == NULL)
+    {
+        ChainedIndexInitialize(&g_UserDebuggingProcessIdIndex,
+                               PlatformMemAllocateNonPagedPool(ChainedIndexGetRequiredSize(USER_DEBUGGING_PROCESS_INDEX_BUCKETS)),
+                               USER_DEBUGGING_PROCESS_INDEX_BUCKETS);
+    }
+
+    if (g_UserDebuggingProcessTokenIndex.Buckets == NULL)
+    {
+        ChainedIndexInitialize(&g_UserDebuggingProcessTokenIndex,
+                               PlatformMemAllocateNonPagedPool(ChainedIndexGetRequiredSize(USER_DEBUGGING_PROCESS_INDEX_BUCKETS)),
+                               USER_DEBUGGING_PROCESS_INDEX_BUCKETS);
+    }
+
+    return g_UserDebuggingThreadIndex.Buckets != NULL &&
+           g_UserDebuggingProcessIdIndex.Buckets != NULL &&
+           g_UserDebuggingProcessTokenIndex.Buckets != NULL;
+
+#else
+
+    return TRUE;
+
+#endif // UseUserDebuggingIndex == TRUE
+}
+
+/**
+ * @brief Free the buckets of an index of the user debugger
+ *
+ * @param Index
+ * @return VOID
+ */
+static VOID
+AttachingFreeDebuggingDetailsIndex(PCHAINED_INDEX Index)
+{
+    PVOID Buckets = (PVOID)Index->Buckets;
+
+    if (Buckets != NULL)
+    {
+        //
+        // The lookups walk the lists once the buckets are removed
+        //
+        Index->Buckets     = NULL;
+        Index->BucketCount = 0;
+        Index->Count       = 0;
+
+        PlatformMemFreePool(Buckets);
+    }
+}
+
+/**
+ * @brief Free the indexes of the threads and the processes of the user debugger
+ * @details this function should be called on vmx non-root after all of the
+ * processes are removed
+ *
+ * @return VOID
+ */
+VOID
+AttachingFreeDebuggingDetailsIndexes()
+{
+    AttachingFreeDebuggingDetailsIndex(&g_UserDebuggingThreadIndex);
+    AttachingFreeDebuggingDetailsIndex(&g_UserDebuggingProcessIdIndex);
+    AttachingFreeDebuggingDetailsIndex(&g_UserDebuggingProcessTokenIndex);
+}
+
 /**
  * @brief Create user-mode debugging details for threads
  *
@@ -148,6 +234,13 @@ AttachingCreateProcessDebuggingDetails(UINT32    ProcessId,
     //
     InsertHeadList(&g_ProcessDebuggingDetailsListHead, &(ProcessDebuggingDetail->AttachedProcessList));
 
+    //
+    // Index it by its process id and its token (both of the indexes are
+    // changed next to the list)
+    //
+    ChainedIndexInsert(&g_UserDebuggingProcessIdIndex, &ProcessDebuggingDetail->ProcessIdIndexEntry, ProcessDebuggingDetail->ProcessId);
+    ChainedIndexInsert(&g_UserDebuggingProcessTokenIndex, &ProcessDebuggingDetail->TokenIndexEntry, ProcessDebuggingDetail->Token);
+
     //
     // return the token
     //
@@ -163,6 +256,28 @@ AttachingCreateProcessDebuggingDetails(UINT32    ProcessId,
 PUSERMODE_DEBUGGING_PROCESS_DETAILS
 AttachingFindProcessDebuggingDetailsByToken(UINT64 Token)
 {
+#if UseUserDebuggingIndex == TRUE
+
+    PCHAINED_INDEX_ENTRY                IndexEntry = NULL;
+    PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail;
+
+    if (g_UserDebuggingProcessTokenIndex.Buckets != NULL)
+    {
+        while ((IndexEntry = ChainedIndexFind(&g_UserDebuggingProcessTokenIndex, Token, IndexEntry)) != NULL)
+        {
+            ProcessDebuggingDetail = CONTAINING_RECORD(IndexEntry, USERMODE_DEBUGGING_PROCESS_DETAILS, TokenIndexEntry);
+
+            if (ProcessDebuggingDetail->Enabled)
+            {
+                return ProcessDebuggingDetail;
+            }
+        }
+
+        return NULL;
+    }
+
+#endif // UseUserDebuggingIndex == TRUE
+
     LIST_FOR_EACH_LINK(g_ProcessDebuggingDetailsListHead, USERMODE_DEBUGGING_PROCESS_DETAILS, AttachedProcessList, ProcessDebuggingDetails)
     {
         //
@@ -186,6 +301,32 @@ AttachingFindProcessDebuggingDetailsByToken(UINT64 Token)
 PUSERMODE_DEBUGGING_PROCESS_DETAILS
 AttachingFindProcessDebuggingDetailsByProcessId(UINT32 ProcessId)
 {
+#if UseUserDebuggingIndex == TRUE
+
+    PCHAINED_INDEX_ENTRY                IndexEntry = NULL;
+    PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail;
+
+    if (g_UserDebuggingProcessIdIndex.Buckets != NULL)
+    {
+        //
+        // The same process id might be indexed multiple times (the last
+        // attached one is found first, the same as the list)
+        //
+        while ((IndexEntry = ChainedIndexFind(&g_UserDebuggingProcessIdIndex, ProcessId, IndexEntry)) != NULL)
+        {
+            ProcessDebuggingDetail = CONTAINING_RECORD(IndexEntry, USERMODE_DEBUGGING_PROCESS_DETAILS, ProcessIdIndexEntry);
+
+            if (ProcessDebuggingDetail->Enabled)
+            {
+                return ProcessDebuggingDetail;
+            }
+        }
+
+        return NULL;
+    }
+
+#endif // UseUserDebuggingIndex == TRUE
+
     LIST_FOR_EACH_LINK(g_ProcessDebuggingDetailsListHead, USERMODE_DEBUGGING_PROCESS_DETAILS, AttachedProcessList, ProcessDebuggingDetails)
     {
         //
@@ -239,6 +380,8 @@ AttachingRemoveAndFreeAllProcessDebuggingDetails()
         // Remove thread debugging detail from the list active threads
         //
         RemoveEntryList(&ProcessDebuggingDetails->AttachedProcessList);
+        ChainedIndexRemove(&g_UserDebuggingProcessIdIndex, &ProcessDebuggingDetails->ProcessIdIndexEntry);
+        ChainedIndexRemove(&g_UserDebuggingProcessTokenIndex, &ProcessDebuggingDetails->TokenIndexEntry);
 
         //
         // Unallocate the pool
@@ -280,6 +423,8 @@ AttachingRemoveProcessDebuggingDetailsByToken(UINT64 Token)
     // Remove thread debugging detail from the list active threads
     //
     RemoveEntryList(&ProcessDebuggingDetails->AttachedProcessList);
+    ChainedIndexRemove(&g_UserDebuggingProcessIdIndex, &ProcessDebuggingDetails->ProcessIdIndexEntry);
+    ChainedIndexRemove(&g_UserDebuggingProcessTokenIndex, &ProcessDebuggingDetails->TokenIndexEntry);
 
     //
     // Unallocate the pool
@@ -98,6 +98,79 @@ ThreadHolderIsAnyPausedThreadInProcess(PUSERMODE_DEBUGGING_PROCESS_DETAILS Proce
     return FALSE;
 }
 
+/**
+ * @brief Find a thread of a process from the index of the threads
+ * @details The same thread id might be indexed for multiple processes (the
+ * thread holders keep the threads that are exited), so the process of each
+ * found thread is checked
+ *
+ * @param ProcessDebuggingDetail
+ * @param ThreadId
+ * @return PUSERMODE_DEBUGGING_THREAD_DETAILS
+ */
+static PUSERMODE_DEBUGGING_THREAD_DETAILS
+ThreadHolderFindThreadDetailsInIndex(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail, UINT32 ThreadId)
+{
+    PCHAINED_INDEX_ENTRY               IndexEntry = NULL;
+    PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetail;
+
+    while ((IndexEntry = ChainedIndexFind(&g_UserDebuggingThreadIndex, ThreadId, IndexEntry)) != NULL)
+    {
+        ThreadDebuggingDetail = CONTAINING_RECORD(IndexEntry, USERMODE_DEBUGGING_THREAD_DETAILS, ThreadIdIndexEntry);
+
+        if (ThreadDebuggingDetail->ProcessDebuggingDetail == ProcessDebuggingDetail)
+        {
+            return ThreadDebuggingDetail;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Check whether the index of the threads could be used for a thread id
+ * @details The empty places of the thread holders have the zero thread id and
+ * they're not indexed, so the zero thread id is still found by the lists
+ *
+ * @param ThreadId
+ * @return BOOLEAN
+ */
+static BOOLEAN
+ThreadHolderIsThreadIdIndexed(UINT32 ThreadId)
+{
+#if UseUserDebuggingIndex == TRUE
+
+    return ThreadId != NULL_ZERO && g_UserDebuggingThreadIndex.Buckets != NULL;
+
+#else
+
+    UNREFERENCED_PARAMETER(ThreadId);
+
+    return FALSE;
+
+#endif // UseUserDebuggingIndex == TRUE
+}
+
+/**
+ * @brief Add a new thread of a process to the index of the threads
+ * @details The caller should hold VmxRootThreadHoldingLock
+ *
+ * @param ThreadDebuggingDetail
+ * @param ProcessDebuggingDetail
+ * @return VOID
+ */
+static VOID
+ThreadHolderAddThreadDetailsToIndex(PUSERMODE_DEBUGGING_THREAD_DETAILS  ThreadDebuggingDetail,
+                                    PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail)
+{
+    //
+    // The thread is completely set before it's linked to the index
+    //
+    ThreadDebuggingDetail->ProcessDebuggingDetail = ProcessDebuggingDetail;
+
+    ChainedIndexInsert(&g_UserDebuggingThreadIndex, &ThreadDebuggingDetail->ThreadIdIndexEntry, ThreadDebuggingDetail->ThreadId);
+}
+
 /**
  * @brief Find the active threads of the process from process id
  *
@@ -121,6 +194,11 @@ ThreadHolderGetProcessThreadDetailsByProcessIdAndThreadId(UINT32 ProcessId, UINT
         return NULL;
     }
 
+    if (ThreadHolderIsThreadIdIndexed(ThreadId))
+    {
+        return ThreadHolderFindThreadDetailsInIndex(ProcessDebuggingDetail, ThreadId);
+    }
+
     TempList = &ProcessDebuggingDetail->ThreadsListHead;
 
     while (&ProcessDebuggingDetail->ThreadsListHead != TempList->Flink)
@@ -204,8 +282,16 @@ ThreadHolderGetProcessFirstThreadDetailsByProcessId(UINT32 ProcessId)
 PUSERMODE_DEBUGGING_PROCESS_DETAILS
 ThreadHolderGetProcessDebuggingDetailsByThreadId(UINT32 ThreadId)
 {
-    PLIST_ENTRY TempList  = 0;
-    PLIST_ENTRY TempList2 = 0;
+    PLIST_ENTRY          TempList  = 0;
+    PLIST_ENTRY          TempList2 = 0;
+    PCHAINED_INDEX_ENTRY IndexEntry;
+
+    if (ThreadHolderIsThreadIdIndexed(ThreadId))
+    {
+        IndexEntry = ChainedIndexFind(&g_UserDebuggingThreadIndex, ThreadId, NULL);
+
+        return IndexEntry == NULL ? NULL : CONTAINING_RECORD(IndexEntry, USERMODE_DEBUGGING_THREAD_DETAILS, ThreadIdIndexEntry)->ProcessDebuggingDetail;
+    }
 
     TempList = &g_ProcessDebuggingDetailsListHead;
 
@@ -256,7 +342,23 @@ ThreadHolderGetProcessDebuggingDetailsByThreadId(UINT32 ThreadId)
 PUSERMODE_DEBUGGING_THREAD_DETAILS
 ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail)
 {
-    PLIST_ENTRY TempList = 0;
+    PLIST_ENTRY                        TempList = 0;
+    PUSERMODE_DEBUGGING_THREAD_DETAILS ThreadDebuggingDetail;
+
+    if (ThreadHolderIsThreadIdIndexed(ThreadId))
+    {
+        ThreadDebuggingDetail = ThreadHolderFindThreadDetailsInIndex(ProcessDebuggingDetail, ThreadId);
+
+        if (ThreadDebuggingDetail != NULL)
+        {
+            return ThreadDebuggingDetail;
+        }
+
+        //
+        // Not found, no need to walk the thread holders
+        //
+        goto CreateThreadDebuggingDetail;
+    }
 
     TempList = &ProcessDebuggingDetail->ThreadsListHead;
 
@@ -281,6 +383,8 @@ ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGI
         }
     }
 
+CreateThreadDebuggingDetail:
+
     //
     // *** We're here, the thread is not found, let's create an entry for it ***
     //
@@ -310,6 +414,8 @@ ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGI
                 //
                 ThreadHolder->Threads[i].ThreadId = ThreadId;
 
+                ThreadHolderAddThreadDetailsToIndex(&ThreadHolder->Threads[i], ProcessDebuggingDetail);
+
                 SpinlockUnlock(&VmxRootThreadHoldingLock);
                 return &ThreadHolder->Threads[i];
             }
@@ -338,6 +444,8 @@ ThreadHolderFindOrCreateThreadDebuggingDetail(UINT32 ThreadId, PUSERMODE_DEBUGGI
     //
     NewThreadHolder->Threads[0].ThreadId = ThreadId;
 
+    ThreadHolderAddThreadDetailsToIndex(&NewThreadHolder->Threads[0], ProcessDebuggingDetail);
+
     //
     // Link to the thread holding structure
     //
@@ -465,6 +573,7 @@ VOID
 ThreadHolderFreeHoldingStructures(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail)
 {
     PLIST_ENTRY TempList = 0;
+    KIRQL       OldIrql;
 
     TempList = &ProcessDebuggingDetail->ThreadsListHead;
 
@@ -474,6 +583,26 @@ ThreadHolderFreeHoldingStructures(PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDeb
         PUSERMODE_DEBUGGING_THREAD_HOLDER ThreadHolder =
             CONTAINING_RECORD(TempList, USERMODE_DEBUGGING_THREAD_HOLDER, ThreadHolderList);
 
+        //
+        // Remove the threads from the index before the holder is freed, the
+        // threads of the other processes are added to the same index from
+        // vmx-root, so the lock is held (on DISPATCH_LEVEL, there is no
+        // thread interception on this core while the lock is held)
+        //
+        OldIrql = KeRaiseIrqlToDpcLevel();
+        SpinlockLock(&VmxRootThreadHoldingLock);
+
+        for (size_t i = 0; i < MAX_THREADS_IN_A_PROCESS_HOLDER; i++)
+        {
+            if (ThreadHolder->Threads[i].ThreadId != NULL_ZERO)
+            {
+                ChainedIndexRemove(&g_UserDebuggingThreadIndex, &ThreadHolder->Threads[i].ThreadIdIndexEntry);
+            }
+        }
+
+        SpinlockUnlock(&VmxRootThreadHoldingLock);
+        KeLowerIrql(OldIrql);
+
         //
         // The thread is allocated from the pool management, so we'll
         // free it from there
@@ -48,6 +48,15 @@ UdInitializeUserDebugger()
     //
     InitializeListHead(&g_ProcessDebuggingDetailsListHead);
 
+    //
+    // Allocate the indexes of the threads and the processes (the lists are
+    // walked if they're not allocated)
+    //
+    if (!AttachingAllocateDebuggingDetailsIndexes())
+    {
+        LogWarning("Warning, unable to allocate the indexes of the user debugger's threads");
+    }
+
     //
     // Enable vm-exit on Hardware debug exceptions and breakpoints
     // so, intercept #DBs and #BP by changing exception bitmap (one core)
@@ -88,6 +97,11 @@ UdUninitializeUserDebugger()
         // thread debugging details
         //
         AttachingRemoveAndFreeAllProcessDebuggingDetails();
+
+        //
+        // Free the indexes of the threads and the processes
+        //
+        AttachingFreeDebuggingDetailsIndexes();
     }
 }
 
@@ -98,6 +98,7 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
             switch (RegisterEventRequest->Type)
             {
             case IRP_BASED:
+            case IRP_BASED_BATCHED:
 
                 LogRegisterIrpBasedNotification((PVOID)Irp, &Status);
 
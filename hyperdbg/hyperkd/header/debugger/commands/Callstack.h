@@ -11,6 +11,24 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//				     Definitions	      		//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of the frames that are unwound
+ *
+ */
+#define CALLSTACK_MAXIMUM_UNWOUND_FRAMES 64
+
+/**
+ * @brief Maximum number of the frames that fit in the packet of the callstack
+ *
+ */
+#define CALLSTACK_MAXIMUM_FRAMES_IN_PACKET                                                                    \
+    ((MaxSerialPacketSize - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(DEBUGGER_CALLSTACK_REQUEST)) / \
+     sizeof(DEBUGGER_SINGLE_CALLSTACK_FRAME))
+
 //////////////////////////////////////////////////
 //				     Functions		      		//
 //////////////////////////////////////////////////
@@ -20,3 +38,10 @@ CallstackWalkthroughStack(PDEBUGGER_SINGLE_CALLSTACK_FRAME AddressToSaveFrames,
                           UINT64                           StackBaseAddress,
                           UINT32                           Size,
                           BOOLEAN                          Is32Bit);
+
+BOOLEAN
+CallstackUnwindStack(PDEBUGGER_SINGLE_CALLSTACK_FRAME AddressToSaveFrames,
+                     PGUEST_REGS                      Regs,
+                     UINT64                           Rip,
+                     UINT32                           MaximumFrames,
+                     UINT32 *                         FrameCount);
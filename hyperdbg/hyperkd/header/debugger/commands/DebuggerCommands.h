@@ -13,6 +13,36 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//				    Definitions		      		//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the buffer of searching memory (the pattern, the unscanned
+ * tail of the previous page and a page of memory)
+ *
+ */
+#define SEARCH_MEMORY_BUFFER_SIZE ((2 * MaximumSearchPatternLength) + PAGE_SIZE)
+
+//////////////////////////////////////////////////
+//				    Structures		      		//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Details of saving the results of searching memory
+ *
+ */
+typedef struct _SEARCH_MEMORY_RESULTS_CONTEXT
+{
+    PDEBUGGER_SEARCH_MEMORY SearchMemRequest;
+    UINT64 *                AddressToSaveResults;
+    UINT64                  StartAddress;
+    UINT32                  CountOfOccurance;
+    UINT32                  IndexToArrayOfResults;
+    BOOLEAN                 IsDebuggeePaused;
+
+} SEARCH_MEMORY_RESULTS_CONTEXT, *PSEARCH_MEMORY_RESULTS_CONTEXT;
+
 //////////////////////////////////////////////////
 //				     Functions		      		//
 //////////////////////////////////////////////////
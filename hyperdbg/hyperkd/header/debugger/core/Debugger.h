@@ -88,6 +88,8 @@ typedef struct _DEBUGGER_EVENT_ACTION
     DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION
     ScriptConfiguration; // If it's run script
 
+    PVOID DecodedScriptBuffer; // Pre-decoded script (if any), see ScriptEngineDecode
+
     DEBUGGER_EVENT_REQUEST_BUFFER
     RequestedBuffer; // if it's a custom code and needs a buffer then we use
                      // this structs
@@ -134,6 +136,8 @@ typedef struct _DEBUGGER_EVENT
     PVOID  ConditionBufferAddress; // Address of the condition buffer (most of the
                                    // time at the end of this buffer)
 
+    EVENT_INDEX_NODE IndexNode; // The node of this event in the dispatch index of its type
+
 } DEBUGGER_EVENT, *PDEBUGGER_EVENT;
 
 /* ==============================================================================================
@@ -214,6 +218,9 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT                                 Event,
                          PDEBUGGER_EVENT_AND_ACTION_RESULT               ResultsToReturn,
                          BOOLEAN                                         InputFromVmxRoot);
 
+BOOLEAN
+DebuggerPreDecodeActionScript(PDEBUGGER_EVENT_ACTION Action);
+
 BOOLEAN
 DebuggerRegisterEvent(PDEBUGGER_EVENT Event);
 
@@ -303,3 +310,15 @@ DebuggerPerformRunTheCustomCode(PROCESSOR_DEBUGGING_STATE * DbgState, DEBUGGER_E
 
 PLIST_ENTRY
 DebuggerGetEventListByEventType(VMM_EVENT_TYPE_ENUM EventType);
+
+PEVENT_INDEX
+DebuggerGetEventIndexByEventType(VMM_EVENT_TYPE_ENUM EventType);
+
+BOOLEAN
+DebuggerGetEventIndexKey(PDEBUGGER_EVENT Event, UINT64 * Key);
+
+UINT64
+DebuggerGetEventIndexKeyOfContext(VMM_EVENT_TYPE_ENUM EventType, PVOID Context);
+
+VOID
+DebuggerAddEventToIndex(PDEBUGGER_EVENT Event);
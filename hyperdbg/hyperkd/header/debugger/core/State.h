@@ -37,6 +37,22 @@ typedef struct _DEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE
 
 } DEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE, *PDEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE;
 
+/**
+ * @brief Use to track the 'call' and the 'ret' instructions in batches
+ * ('!track' command)
+ * @details The debuggee steps the instructions by itself and the records are
+ * sent to the debugger once the buffer is full or the debuggee is paused
+ *
+ */
+typedef struct _DEBUGGEE_BATCHED_TRACKING_STATE
+{
+    BOOLEAN            IsTracking;
+    UINT32             RemainingSteps;
+    TRACK_TRACE_RECORD PendingRecord; // The 'call' or the 'ret' that is being stepped (its target is the next instruction)
+    TRACK_TRACE_BUFFER Records;
+
+} DEBUGGEE_BATCHED_TRACKING_STATE, *PDEBUGGEE_BATCHED_TRACKING_STATE;
+
 /**
  * @brief Structure to save the state of adding trace for threads
  * and processes
@@ -173,6 +189,7 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     DATE_TIME_HOLDER                           DateTimeHolder;
     PDEBUGGEE_BP_DESCRIPTOR                    SoftwareBreakpointState;
     DEBUGGEE_INSTRUMENTATION_STEP_IN_TRACE     InstrumentationStepInTrace;
+    DEBUGGEE_BATCHED_TRACKING_STATE            BatchedTracking;
     BOOLEAN                                    DoNotNmiNotifyOtherCoresByThisCore;
     BOOLEAN                                    TracingMode; // Indicate that the target processor is on the tracing mode or not
     DEBUGGEE_PROCESS_OR_THREAD_TRACING_DETAILS ThreadOrProcessTracingDetails;
@@ -141,6 +141,21 @@ KdRegularStepInInstruction(PROCESSOR_DEBUGGING_STATE * DbgState);
 static VOID
 KdRegularStepOver(PROCESSOR_DEBUGGING_STATE * DbgState, BOOLEAN IsNextInstructionACall, UINT32 CallLength);
 
+static VOID
+KdStartBatchedTracking(PROCESSOR_DEBUGGING_STATE * DbgState, UINT32 StepCount);
+
+static VOID
+KdClassifyBatchedTrackingInstruction(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip);
+
+static BOOLEAN
+KdHandleBatchedTrackingStep(PROCESSOR_DEBUGGING_STATE * DbgState, UINT64 Rip);
+
+static VOID
+KdSendBatchedTrackingRecords(PROCESSOR_DEBUGGING_STATE * DbgState);
+
+static VOID
+KdFlushBatchedTracking(PROCESSOR_DEBUGGING_STATE * DbgState);
+
 static BOOLEAN
 KdPerformRegisterEvent(PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET EventDetailHeader,
                        DEBUGGER_EVENT_AND_ACTION_RESULT *                  DebuggerEventAndActionResult);
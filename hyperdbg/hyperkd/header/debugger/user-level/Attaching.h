@@ -66,6 +66,9 @@ typedef struct _USERMODE_DEBUGGING_PROCESS_DETAILS
     CR3_TYPE   InterceptedCr3[MAX_CR3_IN_A_PROCESS];
     LIST_ENTRY ThreadsListHead;
 
+    CHAINED_INDEX_ENTRY ProcessIdIndexEntry; // Entry of the index of the processes (by their ids)
+    CHAINED_INDEX_ENTRY TokenIndexEntry;     // Entry of the index of the processes (by their tokens)
+
 } USERMODE_DEBUGGING_PROCESS_DETAILS, *PUSERMODE_DEBUGGING_PROCESS_DETAILS;
 
 //////////////////////////////////////////////////
@@ -75,6 +78,12 @@ typedef struct _USERMODE_DEBUGGING_PROCESS_DETAILS
 BOOLEAN
 AttachingInitialize();
 
+BOOLEAN
+AttachingAllocateDebuggingDetailsIndexes();
+
+VOID
+AttachingFreeDebuggingDetailsIndexes();
+
 BOOLEAN
 AttachingCheckPageFaultsWithUserDebugger(UINT32 CoreId,
                                          UINT64 Address,
@@ -36,6 +36,9 @@ typedef struct _USERMODE_DEBUGGING_THREAD_DETAILS
     BOOLEAN                    IsPaused;
     DEBUGGER_UD_COMMAND_ACTION UdAction[MAX_USER_ACTIONS_FOR_THREADS];
 
+    CHAINED_INDEX_ENTRY                 ThreadIdIndexEntry;     // Entry of the index of the threads (by their ids)
+    PUSERMODE_DEBUGGING_PROCESS_DETAILS ProcessDebuggingDetail; // The process of the thread
+
 } USERMODE_DEBUGGING_THREAD_DETAILS, *PUSERMODE_DEBUGGING_THREAD_DETAILS;
 
 /**
@@ -22,6 +22,19 @@ PROCESSOR_DEBUGGING_STATE * g_DbgState;
  */
 UINT64 * g_ScriptGlobalVariables;
 
+/**
+ * @brief Buffer of searching memory in the debugger mode (the pattern
+ * and the chunks of the memory)
+ *
+ */
+UINT8 * g_SearchMemoryBuffer;
+
+/**
+ * @brief Aggregation maps of the script engine (one table for each core)
+ *
+ */
+SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
+
 /**
  * @brief State of the trap-flag
  *
@@ -47,6 +60,18 @@ BOOLEAN g_AllowIOCTLFromUsermode;
  */
 DEBUGGER_CORE_EVENTS * g_Events;
 
+/**
+ * @brief dispatch indexes of the events (one for each list of g_Events)
+ *
+ */
+EVENT_INDEX * g_EventIndexes;
+
+/**
+ * @brief index of the events by their tags
+ *
+ */
+TAG_INDEX g_EventTagIndex;
+
 /**
  * @brief Holds the requests to pause the break of debuggee until
  * a special event happens
@@ -151,6 +176,24 @@ BOOLEAN g_IsWaitingForReturnAndRunFromPageFault;
  */
 LIST_ENTRY g_ProcessDebuggingDetailsListHead;
 
+/**
+ * @brief Index of the threads of the user debugger (by their ids)
+ *
+ */
+CHAINED_INDEX g_UserDebuggingThreadIndex;
+
+/**
+ * @brief Index of the processes of the user debugger (by their ids)
+ *
+ */
+CHAINED_INDEX g_UserDebuggingProcessIdIndex;
+
+/**
+ * @brief Index of the processes of the user debugger (by their tokens)
+ *
+ */
+CHAINED_INDEX g_UserDebuggingProcessTokenIndex;
+
 /**
  * @brief Whether the thread attaching mechanism is waiting for #DB or not
  *
@@ -93,6 +93,43 @@
 #include "components/optimizations/header/BinarySearch.h"
 #include "components/optimizations/header/InsertionSort.h"
 
+//
+// Event index (used in the debugger events)
+//
+#include "components/eventindex/header/EventIndex.h"
+
+//
+// Tag index (used in the debugger events)
+//
+#include "components/hashindex/header/HashIndex.h"
+#include "components/tagindex/header/TagIndex.h"
+
+//
+// Memory search engine (used in the s* commands)
+//
+#include "components/memorysearch/header/MemorySearch.h"
+#include "components/unwinder/header/Unwinder.h"
+
+//
+// Frames of the serial connection
+//
+#include "components/serialframe/header/SerialFrame.h"
+
+//
+// Binary records of the messages of the events (printf of the scripts)
+//
+#include "components/eventrecord/header/EventRecord.h"
+
+//
+// Chained index (used in the user debugger's threads and processes)
+//
+#include "components/chainedindex/header/ChainedIndex.h"
+
+//
+// Records of tracking the 'call' and the 'ret' instructions (used in the '!track' command)
+//
+#include "components/tracktrace/header/TrackTrace.h"
+
 //
 // Debugger Types
 //
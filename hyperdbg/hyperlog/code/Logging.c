@@ -192,6 +192,42 @@ LogInitialize(MESSAGE_TRACING_CALLBACKS * MsgTracingCallbacks)
         //
         MessageBufferInformation[i].BufferEndAddress         = (UINT64)MessageBufferInformation[i].BufferStartAddress + LogBufferSize;
         MessageBufferInformation[i].BufferEndAddressPriority = (UINT64)MessageBufferInformation[i].BufferStartAddressPriority + LogBufferSizePriority;
+
+#if UseVariableLengthLogRecords == TRUE
+
+        //
+        // Use the same buffers as the rings of variable-length records
+        //
+        RingBufferInitialize(&MessageBufferInformation[i].RegularRing,
+                             (PVOID)MessageBufferInformation[i].BufferStartAddress,
+                             (UINT32)LogBufferSize);
+
+        RingBufferInitialize(&MessageBufferInformation[i].PriorityRing,
+                             (PVOID)MessageBufferInformation[i].BufferStartAddressPriority,
+                             (UINT32)LogBufferSizePriority);
+
+#    if UsePerCoreLogQueues == TRUE
+
+        //
+        // Allocate a queue for each core, the regular messages are saved
+        // there instead of the regular ring
+        //
+        PVOID QueuesBuffer = PlatformMemAllocateZeroedNonPagedPool(
+            (SIZE_T)PerCoreQueuesGetRequiredSize(ProcessorsCount, LogPerCoreQueueSize));
+
+        if (!QueuesBuffer)
+        {
+            return FALSE; // STATUS_INSUFFICIENT_RESOURCES
+        }
+
+        PerCoreQueuesInitialize(&MessageBufferInformation[i].RegularQueues,
+                                QueuesBuffer,
+                                ProcessorsCount,
+                                LogPerCoreQueueSize);
+
+#    endif // UsePerCoreLogQueues == TRUE
+
+#endif // UseVariableLengthLogRecords == TRUE
     }
 
     //
@@ -232,6 +268,18 @@ LogUnInitialize()
         {
             PlatformMemFreePool((PVOID)MessageBufferInformation[i].BufferForMultipleNonImmediateMessage);
         }
+
+#if UsePerCoreLogQueues == TRUE
+
+        //
+        // The queue structures are at the start of the allocated buffer
+        //
+        if (MessageBufferInformation[i].RegularQueues.Queues != NULL)
+        {
+            PlatformMemFreePool((PVOID)MessageBufferInformation[i].RegularQueues.Queues);
+        }
+
+#endif // UsePerCoreLogQueues == TRUE
     }
 
     //
@@ -241,6 +289,158 @@ LogUnInitialize()
     MessageBufferInformation = NULL;
 }
 
+#if UseVariableLengthLogRecords == TRUE
+
+/**
+ * @brief Read (and remove) the oldest regular record
+ * @details The caller should hold the lock of the buffer
+ *
+ * @param Index Index of the buffer (vmx-root or vmx non-root)
+ * @param OperationNumber
+ * @param BufferToSave
+ * @param BufferToSaveSize
+ * @param BufferLength
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+LogReadRegularRecord(UINT32   Index,
+                     UINT32 * OperationNumber,
+                     PVOID    BufferToSave,
+                     UINT32   BufferToSaveSize,
+                     UINT32 * BufferLength)
+{
+#    if UsePerCoreLogQueues == TRUE
+
+    UINT64 Sequence;
+
+    //
+    // Records of all cores are merged by their global sequence number
+    //
+    return PerCoreQueuesRead(&MessageBufferInformation[Index].RegularQueues,
+                             OperationNumber,
+                             &Sequence,
+                             BufferToSave,
+                             BufferToSaveSize,
+                             BufferLength);
+
+#    else
+
+    return RingBufferRead(&MessageBufferInformation[Index].RegularRing,
+                          OperationNumber,
+                          BufferToSave,
+                          BufferToSaveSize,
+                          BufferLength);
+
+#    endif // UsePerCoreLogQueues == TRUE
+}
+
+/**
+ * @brief Remove all of the regular records
+ * @details The caller should hold the lock of the buffer
+ *
+ * @param Index Index of the buffer (vmx-root or vmx non-root)
+ *
+ * @return UINT32 Number of removed records
+ */
+static UINT32
+LogDiscardRegularRecords(UINT32 Index)
+{
+#    if UsePerCoreLogQueues == TRUE
+    return PerCoreQueuesDiscardAll(&MessageBufferInformation[Index].RegularQueues);
+#    else
+    return RingBufferDiscardAll(&MessageBufferInformation[Index].RegularRing);
+#    endif // UsePerCoreLogQueues == TRUE
+}
+
+/**
+ * @brief Check whether there is any regular record
+ *
+ * @param Index Index of the buffer (vmx-root or vmx non-root)
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+LogCheckForRegularRecord(UINT32 Index)
+{
+#    if UsePerCoreLogQueues == TRUE
+    return !PerCoreQueuesIsEmpty(&MessageBufferInformation[Index].RegularQueues);
+#    else
+    return !RingBufferIsEmpty(&MessageBufferInformation[Index].RegularRing);
+#    endif // UsePerCoreLogQueues == TRUE
+}
+
+#endif // UseVariableLengthLogRecords == TRUE
+
+#if UsePerCoreLogQueues == TRUE
+
+/**
+ * @brief Save a regular buffer to the queue of the current core
+ * @details The logging locks are not acquired as each core is the only
+ * writer of its own queue
+ *
+ * @param Index Index of the buffer (vmx-root or vmx non-root)
+ * @param IsVmxRoot
+ * @param OperationCode
+ * @param Buffer
+ * @param BufferLength
+ *
+ * @return BOOLEAN FALSE if the queue of the current core is full
+ */
+static BOOLEAN
+LogSendBufferToCoreQueue(UINT32 Index, BOOLEAN IsVmxRoot, UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
+{
+    KIRQL          OldIRQL = NULL_ZERO;
+    PNOTIFY_RECORD NotifyRecord;
+    BOOLEAN        Result;
+
+    //
+    // In vmx non-root, the thread should not be moved to another core (or be
+    // preempted by another writer of the same queue) while writing the record
+    //
+    if (!IsVmxRoot)
+    {
+        OldIRQL = KeRaiseIrqlToDpcLevel();
+    }
+
+    Result = PerCoreQueuesWrite(&MessageBufferInformation[Index].RegularQueues,
+                                KeGetCurrentProcessorNumberEx(NULL),
+                                OperationCode,
+                                Buffer,
+                                BufferLength);
+
+    //
+    // check if there is any thread in IRP Pending state, only one of the cores
+    // takes the notify record as the lock is not held here
+    //
+    if (g_GlobalNotifyRecord != NULL)
+    {
+        NotifyRecord = (PNOTIFY_RECORD)InterlockedExchangePointer((PVOID volatile *)&g_GlobalNotifyRecord, NULL);
+
+        if (NotifyRecord != NULL)
+        {
+            //
+            // set the target pool
+            //
+            NotifyRecord->CheckVmxRootMessagePool = IsVmxRoot;
+
+            //
+            // Insert dpc to queue
+            //
+            KeInsertQueueDpc(&NotifyRecord->Dpc, NotifyRecord, NULL);
+        }
+    }
+
+    if (!IsVmxRoot)
+    {
+        KeLowerIrql(OldIRQL);
+    }
+
+    return Result;
+}
+
+#endif // UsePerCoreLogQueues == TRUE
+
 /**
  * @brief Checks whether the priority or regular buffer is full or not
  *
@@ -252,8 +452,6 @@ LogCallbackCheckIfBufferIsFull(BOOLEAN Priority)
 {
     UINT32  Index;
     BOOLEAN IsVmxRoot;
-    UINT32  CurrentIndexToWrite         = NULL_ZERO;
-    UINT32  CurrentIndexToWritePriority = NULL_ZERO;
 
     //
     // Check that if we're in vmx root-mode
@@ -275,6 +473,36 @@ LogCallbackCheckIfBufferIsFull(BOOLEAN Priority)
         Index = 0;
     }
 
+#if UseVariableLengthLogRecords == TRUE
+
+    //
+    // The buffer is full if the largest possible message replaces the
+    // previous (not served) messages
+    //
+    if (Priority)
+    {
+        return RingBufferCheckIfFull(&MessageBufferInformation[Index].PriorityRing, PacketChunkSize - 1);
+    }
+    else
+    {
+#    if UsePerCoreLogQueues == TRUE
+
+        //
+        // Only the queue of the current core is checked
+        //
+        return PerCoreQueuesCheckIfFull(&MessageBufferInformation[Index].RegularQueues,
+                                        KeGetCurrentProcessorNumberEx(NULL),
+                                        PacketChunkSize - 1);
+#    else
+        return RingBufferCheckIfFull(&MessageBufferInformation[Index].RegularRing, PacketChunkSize - 1);
+#    endif // UsePerCoreLogQueues == TRUE
+    }
+
+#else
+
+    UINT32 CurrentIndexToWrite         = NULL_ZERO;
+    UINT32 CurrentIndexToWritePriority = NULL_ZERO;
+
     //
     // check if the buffer is filled to it's maximum index or not
     //
@@ -322,6 +550,8 @@ LogCallbackCheckIfBufferIsFull(BOOLEAN Priority)
     // item will replace the previous (not served items)
     //
     return Header->Valid;
+
+#endif // UseVariableLengthLogRecords == TRUE
 }
 
 /**
@@ -338,9 +568,10 @@ _Use_decl_annotations_
 BOOLEAN
 LogCallbackSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, BOOLEAN Priority)
 {
-    UINT32  Index;
-    BOOLEAN IsVmxRoot;
-    KIRQL   OldIRQL = NULL_ZERO;
+    UINT32         Index;
+    BOOLEAN        IsVmxRoot;
+    PNOTIFY_RECORD NotifyRecord;
+    KIRQL          OldIRQL = NULL_ZERO;
 
     if (BufferLength > PacketChunkSize - 1 || BufferLength == 0)
     {
@@ -398,6 +629,19 @@ LogCallbackSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, B
         return TRUE;
     }
 
+#if UsePerCoreLogQueues == TRUE
+
+    //
+    // Regular messages are saved to the queue of the current core without
+    // holding the locks, the locks are only for the priority messages
+    //
+    if (!Priority)
+    {
+        return LogSendBufferToCoreQueue(IsVmxRoot ? 1 : 0, IsVmxRoot, OperationCode, Buffer, BufferLength);
+    }
+
+#endif // UsePerCoreLogQueues == TRUE
+
     //
     // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
     // if not we use the windows spinlock
@@ -423,6 +667,23 @@ LogCallbackSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, B
         KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
     }
 
+#if UseVariableLengthLogRecords == TRUE
+
+    //
+    // Save the buffer as a record, if the buffer is full then the oldest
+    // records are replaced (the same as the regular chunks)
+    //
+    if (Priority)
+    {
+        RingBufferWrite(&MessageBufferInformation[Index].PriorityRing, OperationCode, Buffer, BufferLength);
+    }
+    else
+    {
+        RingBufferWrite(&MessageBufferInformation[Index].RegularRing, OperationCode, Buffer, BufferLength);
+    }
+
+#else
+
     //
     // check if the buffer is filled to it's maximum index or not
     //
@@ -503,29 +764,29 @@ LogCallbackSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength, B
         MessageBufferInformation[Index].CurrentIndexToWrite = MessageBufferInformation[Index].CurrentIndexToWrite + 1;
     }
 
+#endif // UseVariableLengthLogRecords == TRUE
+
     //
-    // check if there is any thread in IRP Pending state, so we can complete their request
+    // check if there is any thread in IRP Pending state, so we can complete their request,
+    // the record is claimed atomically as the writers of the per-core queues (and the other
+    // pool) don't hold this lock
     //
     if (g_GlobalNotifyRecord != NULL)
     {
-        //
-        // there is some threads that needs to be completed
-        //
+        NotifyRecord = (PNOTIFY_RECORD)InterlockedExchangePointer((PVOID volatile *)&g_GlobalNotifyRecord, NULL);
 
-        //
-        // set the target pool
-        //
-        g_GlobalNotifyRecord->CheckVmxRootMessagePool = IsVmxRoot;
-
-        //
-        // Insert dpc to queue
-        //
-        KeInsertQueueDpc(&g_GlobalNotifyRecord->Dpc, g_GlobalNotifyRecord, NULL);
+        if (NotifyRecord != NULL)
+        {
+            //
+            // set the target pool
+            //
+            NotifyRecord->CheckVmxRootMessagePool = IsVmxRoot;
 
-        //
-        // set notify routine to null
-        //
-        g_GlobalNotifyRecord = NULL;
+            //
+            // Insert dpc to queue
+            //
+            KeInsertQueueDpc(&NotifyRecord->Dpc, NotifyRecord, NULL);
+        }
     }
 
     //
@@ -590,6 +851,15 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
         KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
     }
 
+#if UseVariableLengthLogRecords == TRUE
+
+    //
+    // Remove all of the records at once
+    //
+    ResultsOfBuffersSetToRead = LogDiscardRegularRecords(Index);
+
+#else
+
     //
     // We have iterate through the all indexes
     //
@@ -665,6 +935,8 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
         }
     }
 
+#endif // UseVariableLengthLogRecords == TRUE
+
     //
     // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
     // if not we use the windows spinlock
@@ -696,9 +968,8 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
 BOOLEAN
 LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLength)
 {
-    UINT32  Index;
-    BOOLEAN PriorityMessageIsAvailable = FALSE;
-    KIRQL   OldIRQL                    = NULL_ZERO;
+    UINT32 Index;
+    KIRQL  OldIRQL = NULL_ZERO;
 
     //
     // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
@@ -729,6 +1000,70 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
         KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
     }
 
+#if UseVariableLengthLogRecords == TRUE
+
+    UINT32 OperationNumber;
+    UINT32 BufferLength;
+
+    //
+    // Because we want to pass the header of usermode header
+    //
+    PVOID SavingAddress = (PVOID)((UINT64)BufferToSaveMessage + sizeof(UINT32));
+
+    //
+    // Check for priority message, and then for regular message
+    //
+    if (!RingBufferRead(&MessageBufferInformation[Index].PriorityRing, &OperationNumber, SavingAddress, PacketChunkSize, &BufferLength) &&
+        !LogReadRegularRecord(Index, &OperationNumber, SavingAddress, PacketChunkSize, &BufferLength))
+    {
+        //
+        // there is nothing to send
+        //
+
+        //
+        // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
+        // if not we use the windows spinlock
+        //
+        if (IsVmxRoot)
+        {
+            SpinlockUnlock(&VmxRootLoggingLock);
+        }
+        else
+        {
+            //
+            // Release the lock
+            //
+            KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
+        }
+
+        return FALSE;
+    }
+
+    //
+    // Copy the header
+    //
+    RtlCopyBytes(BufferToSaveMessage, &OperationNumber, sizeof(UINT32));
+
+#    if ShowMessagesOnDebugger
+
+    //
+    // Means that show just messages
+    //
+    if (OperationNumber <= OPERATION_LOG_NON_IMMEDIATE_MESSAGE)
+    {
+        DbgPrint("%s", (char *)SavingAddress);
+    }
+#    endif
+
+    //
+    // Set the length to show as the ReturnedByted in usermode ioctl function + size of header
+    //
+    *ReturnedLength = BufferLength + sizeof(UINT32);
+
+#else
+
+    BOOLEAN PriorityMessageIsAvailable = FALSE;
+
     //
     // Compute the current buffer to read
     //
@@ -806,7 +1141,7 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
 
     RtlCopyBytes(SavingAddress, SendingBuffer, Header->BufferLength);
 
-#if ShowMessagesOnDebugger
+#    if ShowMessagesOnDebugger
 
     //
     // Means that show just messages
@@ -836,7 +1171,7 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
             DbgPrint("%s", (char *)SendingBuffer);
         }
     }
-#endif
+#    endif
 
     //
     // Finally, set the current index to invalid as we sent it
@@ -890,6 +1225,122 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
         }
     }
 
+#endif // UseVariableLengthLogRecords == TRUE
+
+    //
+    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
+    // if not we use the windows spinlock
+    //
+    if (IsVmxRoot)
+    {
+        SpinlockUnlock(&VmxRootLoggingLock);
+    }
+    else
+    {
+        //
+        // Release the lock
+        //
+        KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Attempt to read as many messages as fit in a batch
+ * @details The messages are appended to the batch as length-prefixed records
+ * (see LogBatch.h), the priority messages are read first
+ *
+ * @param IsVmxRoot Determine whether you want to read vmx root buffer or vmx non root buffer
+ * @param Batch Target buffer to save the messages
+ * @param BatchSize Size of the target buffer
+ * @param BatchLength The current length of the batch, updated after
+ * appending the messages
+ * @return BOOLEAN return of this function shows whether any message was read
+ * or not (e.g FALSE shows there's no new buffer available.)
+ */
+BOOLEAN
+LogReadBufferBatched(BOOLEAN IsVmxRoot, PVOID Batch, UINT32 BatchSize, UINT32 * BatchLength)
+{
+    UINT32 Offset = *BatchLength;
+
+#if UseVariableLengthLogRecords == TRUE
+
+    UINT32 Index;
+    UINT32 OperationNumber;
+    UINT32 BufferLength;
+    PVOID  SavingAddress;
+    UINT32 AvailableLength;
+    KIRQL  OldIRQL = NULL_ZERO;
+
+    //
+    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
+    // if not we use the windows spinlock
+    //
+    if (IsVmxRoot)
+    {
+        //
+        // Set the index
+        //
+        Index = 1;
+
+        //
+        // Acquire the lock
+        //
+        SpinlockLock(&VmxRootLoggingLock);
+    }
+    else
+    {
+        //
+        // Set the index
+        //
+        Index = 0;
+
+        //
+        // Acquire the lock
+        //
+        KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
+    }
+
+    //
+    // The lock is acquired once for all of the messages, each message is
+    // directly read to its place in the batch
+    //
+    while (TRUE)
+    {
+        SavingAddress   = LogBatchGetRecordBody(Batch, Offset);
+        AvailableLength = LogBatchGetAvailableLength(BatchSize, Offset);
+
+        if (!RingBufferIsEmpty(&MessageBufferInformation[Index].PriorityRing))
+        {
+            //
+            // Regular messages are not read before the priority messages, even
+            // if the priority message doesn't fit
+            //
+            if (!RingBufferRead(&MessageBufferInformation[Index].PriorityRing, &OperationNumber, SavingAddress, AvailableLength, &BufferLength))
+            {
+                break;
+            }
+        }
+        else if (!LogReadRegularRecord(Index, &OperationNumber, SavingAddress, AvailableLength, &BufferLength))
+        {
+            break;
+        }
+
+        Offset = LogBatchCommitRecord(Batch, Offset, OperationNumber, BufferLength);
+
+#    if ShowMessagesOnDebugger
+
+        //
+        // Means that show just messages
+        //
+        if (OperationNumber <= OPERATION_LOG_NON_IMMEDIATE_MESSAGE)
+        {
+            DbgPrint("%s", (char *)SavingAddress);
+        }
+#    endif
+    }
+
     //
     // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
     // if not we use the windows spinlock
@@ -906,6 +1357,39 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
         KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
     }
 
+#else
+
+    PLOG_BATCH_RECORD_HEADER Header;
+    UINT32                   ReturnedLength;
+
+    //
+    // The chunks are read one by one, the operation code of the single message
+    // format is at the same place as the operation code of the record
+    //
+    while (LogBatchGetAvailableLength(BatchSize, Offset) >= PacketChunkSize)
+    {
+        Header = (PLOG_BATCH_RECORD_HEADER)((UINT64)Batch + Offset);
+
+        if (!LogReadBuffer(IsVmxRoot, &Header->OperationCode, &ReturnedLength))
+        {
+            break;
+        }
+
+        Offset = LogBatchCommitRecord(Batch, Offset, Header->OperationCode, ReturnedLength - sizeof(UINT32));
+    }
+
+#endif // UseVariableLengthLogRecords == TRUE
+
+    if (Offset == *BatchLength)
+    {
+        //
+        // there is nothing to send
+        //
+        return FALSE;
+    }
+
+    *BatchLength = Offset;
+
     return TRUE;
 }
 
@@ -932,6 +1416,19 @@ LogCheckForNewMessage(BOOLEAN IsVmxRoot, BOOLEAN Priority)
         Index = 0;
     }
 
+#if UseVariableLengthLogRecords == TRUE
+
+    if (Priority)
+    {
+        return !RingBufferIsEmpty(&MessageBufferInformation[Index].PriorityRing);
+    }
+    else
+    {
+        return LogCheckForRegularRecord(Index);
+    }
+
+#else
+
     //
     // Compute the current buffer to read
     //
@@ -958,6 +1455,8 @@ LogCheckForNewMessage(BOOLEAN IsVmxRoot, BOOLEAN Priority)
     // If we reached here, means that there is sth to send
     //
     return TRUE;
+
+#endif // UseVariableLengthLogRecords == TRUE
 }
 
 /**
@@ -1365,6 +1864,7 @@ LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument
     switch (NotifyRecord->Type)
     {
     case IRP_BASED:
+    case IRP_BASED_BATCHED:
         Irp = NotifyRecord->Message.PendingIrp;
 
         if (Irp != NULL)
@@ -1408,10 +1908,24 @@ LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument
             OutBuff = Irp->AssociatedIrp.SystemBuffer;
             Length  = 0;
 
+            if (NotifyRecord->Type == IRP_BASED_BATCHED)
+            {
+                //
+                // Fill the batch from the notified pool first and then from
+                // the other pool
+                //
+                LogReadBufferBatched(NotifyRecord->CheckVmxRootMessagePool, OutBuff, OutBuffLength, &Length);
+                LogReadBufferBatched(!NotifyRecord->CheckVmxRootMessagePool, OutBuff, OutBuffLength, &Length);
+            }
+            else
+            {
+                LogReadBuffer(NotifyRecord->CheckVmxRootMessagePool, OutBuff, &Length);
+            }
+
             //
             // Read Buffer might be empty (nothing to send)
             //
-            if (!LogReadBuffer(NotifyRecord->CheckVmxRootMessagePool, OutBuff, &Length))
+            if (Length == 0)
             {
                 //
                 // we have to return here as there is nothing to send here
@@ -1491,7 +2005,7 @@ LogRegisterIrpBasedNotification(PVOID TargetIrp, LONG * Status)
             return FALSE;
         }
 
-        NotifyRecord->Type               = IRP_BASED;
+        NotifyRecord->Type               = RegisterEvent->Type == IRP_BASED_BATCHED ? IRP_BASED_BATCHED : IRP_BASED;
         NotifyRecord->Message.PendingIrp = Irp;
 
         KeInitializeDpc(&NotifyRecord->Dpc,        // Dpc
@@ -91,6 +91,19 @@ typedef struct _LOG_BUFFER_INFORMATION
     UINT32 CurrentIndexToSendPriority;  // Current buffer index to send to user-mode for priority buffers
     UINT32 CurrentIndexToWritePriority; // Current buffer index to write new messages for priority buffers
 
+    //
+    // Variable-length records (used instead of the above indexes if
+    // UseVariableLengthLogRecords is enabled)
+    //
+    RING_BUFFER RegularRing;  // Records on the regular buffer
+    RING_BUFFER PriorityRing; // Records on the priority buffer
+
+    //
+    // Per-core queues of the regular records (used instead of the regular
+    // ring if UsePerCoreLogQueues is enabled)
+    //
+    PER_CORE_QUEUES RegularQueues;
+
 } LOG_BUFFER_INFORMATION, *PLOG_BUFFER_INFORMATION;
 
 //////////////////////////////////////////////////
@@ -124,6 +137,14 @@ volatile LONG VmxRootLoggingLockForNonImmBuffers;
 A core buffer is like this , it's divided into MaximumPacketsCapacity chucks,
 each chunk has PacketChunkSize + sizeof(BUFFER_HEADER) size
 
+If UseVariableLengthLogRecords is enabled, the same buffer is used as a ring
+of variable-length records instead (see RingBuffer.h)
+
+If UsePerCoreLogQueues is also enabled, the regular records are saved to a
+separate queue for each core (see PerCoreQueue.h), so the cores don't wait
+for each other on the logging locks, these locks only protect the priority
+ring and the reader
+
              _________________________
             |      BUFFER_HEADER      |
             |_________________________|
@@ -187,5 +208,8 @@ MESSAGE_TRACING_CALLBACKS g_MsgTracingCallbacks;
 BOOLEAN
 LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLength);
 
+BOOLEAN
+LogReadBufferBatched(BOOLEAN IsVmxRoot, PVOID Batch, UINT32 BatchSize, UINT32 * BatchLength);
+
 VOID
 LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2);
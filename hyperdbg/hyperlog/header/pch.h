@@ -39,10 +39,14 @@
 #define HYPERDBG_HYPER_LOG
 
 #include "UnloadDll.h"
+#include "Configuration.h"
 #include "SDK/HyperDbgSdk.h"
 #include "SDK/modules/HyperLog.h"
 #include "SDK/imports/kernel/HyperDbgHyperLogImports.h"
 #include "components/spinlock/header/Spinlock.h"
+#include "components/ringbuffer/header/RingBuffer.h"
+#include "components/percorequeue/header/PerCoreQueue.h"
+#include "components/logbatch/header/LogBatch.h"
 #include "Logging.h"
 
 //
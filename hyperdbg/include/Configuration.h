@@ -73,3 +73,83 @@
  * @details for more information: https://docs.hyperdbg.org/tips-and-tricks/misc/instant-events
  */
 #define EnableInstantEventMechanism TRUE
+
+/**
+ * @brief Pre-decode run script actions into a compact instruction stream
+ * @details The script is decoded once when the action is registered and
+ * the hot operators are dispatched directly, other operators fall back to
+ * the regular interpreter
+ */
+#define UseScriptEnginePreDecodedInterpreter TRUE
+
+/**
+ * @brief Optimize the symbol buffer of the scripts after code generation
+ * @details Constant folding, copy propagation, dead-temp elimination and
+ * jump threading are applied before the script is sent to the debuggee
+ */
+#define UseScriptEngineOptimizer TRUE
+
+/**
+ * @brief Store the messages of hyperlog as variable-length records
+ * @details Each message only takes its own length (plus a small header) from
+ * the buffers instead of a full PacketChunkSize chunk
+ */
+#define UseVariableLengthLogRecords TRUE
+
+/**
+ * @brief Save the regular messages of hyperlog to per-core queues
+ * @details Each core writes to its own queue without holding the logging
+ * locks and the reader merges the queues by a global sequence number, needs
+ * UseVariableLengthLogRecords
+ */
+#define UsePerCoreLogQueues TRUE
+
+#if UsePerCoreLogQueues == TRUE && UseVariableLengthLogRecords == FALSE
+#    error "UsePerCoreLogQueues needs UseVariableLengthLogRecords"
+#endif
+
+/**
+ * @brief Read multiple messages of hyperlog in each IOCTL
+ * @details The messages are returned as a batch of records (see LogBatch.h)
+ * instead of one message for each IRP completion
+ */
+#define UseBatchedLogDelivery TRUE
+
+/**
+ * @brief Find the EPT hooked pages and the hidden breakpoints by a hash index
+ * @details The breakpoint and the EPT violation vm-exits look up the index
+ * instead of walking the list of the hooked pages
+ */
+#define UseEptHookHashIndex TRUE
+
+/**
+ * @brief Dispatch the debugger events by an index of their keys
+ * @details The events are looked up by the MSR, the I/O port, the syscall
+ * number, etc. of each vm-exit instead of walking all of the events of the
+ * same type
+ */
+#define UseIndexedEventDispatch TRUE
+
+/**
+ * @brief Find the debugger events by an index of their tags
+ * @details Enabling, disabling, querying and removing the events (e.g., from
+ * the scripts) don't walk all of the lists of the events
+ */
+#define UseEventTagIndex TRUE
+
+/**
+ * @brief Send the packets of the serial connection as CRC32-checked frames
+ * @details Each packet is preceded by a header of its length and its CRC32
+ * and the debugger reads the frames in bulk, otherwise the packets are ended
+ * by the end of buffer characters and read byte by byte (both the debugger
+ * and the debuggee should use the same value)
+ */
+#define UseSerialFraming TRUE
+
+/**
+ * @brief Find the threads and the processes of the user debugger by indexes
+ * @details The thread interception vm-exits and the user-mode breakpoints
+ * look up the threads by their ids and the processes by their ids and tokens
+ * instead of walking the lists of the processes and their thread holders
+ */
+#define UseUserDebuggingIndex TRUE
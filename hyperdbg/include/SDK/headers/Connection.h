@@ -46,6 +46,11 @@ typedef enum _DEBUGGEE_PAUSING_REASON
     //
     DEBUGGEE_PAUSING_REASON_HARDWARE_BASED_DEBUGGEE_GENERAL_BREAK,
 
+    //
+    // Only for kernel debugger (appended to keep the values of the others)
+    //
+    DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_BATCH_FINISHED,
+
 } DEBUGGEE_PAUSING_REASON;
 
 /**
@@ -137,6 +142,7 @@ typedef enum _DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_APIC_REQUESTS,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_PCIDEVINFO,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_QUERY_IDT_ENTRIES_REQUESTS,
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_TRACKING_RECORDS,
 
     //
     // hardware debuggee to debugger
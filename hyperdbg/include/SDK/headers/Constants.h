@@ -186,6 +186,13 @@ const unsigned char BuildSignature[] = {
  */
 #define UsermodeBufferSize sizeof(UINT32) + PacketChunkSize + 1
 
+/**
+ * @brief size of user-mode buffer for the batched messages
+ * @details multiple messages are returned in each IRP (see LogBatch.h)
+ *
+ */
+#define UsermodeBatchBufferSize 16 * PacketChunkSize
+
 /**
  * @brief size of buffer for serial
  * @details the maximum packet size for sending over serial
@@ -207,6 +214,13 @@ const unsigned char BuildSignature[] = {
 #define LogBufferSizePriority \
     MaximumPacketsCapacityPriority *(PacketChunkSize + sizeof(BUFFER_HEADER))
 
+/**
+ * @brief Storage size of the regular messages of each core
+ * @details only used if the per-core log queues are enabled
+ *
+ */
+#define LogPerCoreQueueSize 32 * NORMAL_PAGE_SIZE
+
 /**
  * @brief limitation of Windows DbgPrint message size
  * @details currently is not functional
@@ -221,6 +235,20 @@ const unsigned char BuildSignature[] = {
  */
 #define DebuggerEventTagStartSeed 0x1000000
 
+/**
+ * @brief Number of the tags (from DebuggerEventTagStartSeed) that are kept in
+ * the dense table of the index of the events' tags
+ *
+ */
+#define EVENT_TAG_INDEX_DENSE_COUNT 8192
+
+/**
+ * @brief Number of slots for the other tags in the index of the events' tags
+ * (a power of two)
+ *
+ */
+#define EVENT_TAG_INDEX_OVERFLOW_CAPACITY 2048
+
 /**
  * @brief The seeds that user-mode thread detail token start with it
  * @details This seed should not start with zero (0), otherwise it's
@@ -228,6 +256,20 @@ const unsigned char BuildSignature[] = {
  */
 #define DebuggerThreadDebuggingTagStartSeed 0x1000000
 
+/**
+ * @brief Number of the buckets of the index of the user debugger's threads
+ * (a power of two)
+ *
+ */
+#define USER_DEBUGGING_THREAD_INDEX_BUCKETS 4096
+
+/**
+ * @brief Number of the buckets of the indexes of the user debugger's
+ * processes (a power of two)
+ *
+ */
+#define USER_DEBUGGING_PROCESS_INDEX_BUCKETS 64
+
 /**
  * @brief The seeds that user-mode codes use as the starter
  * of their output source tag
@@ -259,6 +301,18 @@ const unsigned char BuildSignature[] = {
  */
 #define MAXIMUM_NUMBER_OF_INITIAL_PREALLOCATED_EPT_HOOKS 64
 
+/**
+ * @brief Number of slots in the index of the EPT hooked pages (a power of two)
+ *
+ */
+#define EPT_HOOK_INDEX_PAGES_CAPACITY 2048
+
+/**
+ * @brief Number of slots in the index of the hidden breakpoints (a power of two)
+ *
+ */
+#define EPT_HOOK_INDEX_BREAKPOINTS_CAPACITY 8192
+
 //////////////////////////////////////////////////
 //             Instant Event Configs            //
 //////////////////////////////////////////////////
@@ -513,6 +567,13 @@ const unsigned char BuildSignature[] = {
  */
 #define MaximumSearchResults 0x1000
 
+/**
+ * @brief maximum length of the pattern (in bytes) of !s* s*
+ * command
+ *
+ */
+#define MaximumSearchPatternLength 0x1000
+
 //////////////////////////////////////////////////
 //                 Script Engine                //
 //////////////////////////////////////////////////
@@ -253,7 +253,8 @@ typedef struct _DEBUGGEE_UD_PAUSED_PACKET
 typedef enum _NOTIFY_TYPE
 {
     IRP_BASED,
-    EVENT_BASED
+    EVENT_BASED,
+    IRP_BASED_BATCHED
 } NOTIFY_TYPE;
 
 //////////////////////////////////////////////////
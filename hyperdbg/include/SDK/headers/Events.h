@@ -407,6 +407,7 @@ typedef struct _DEBUGGER_GENERAL_ACTION
     UINT64                          EventTag;
     DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType;
     BOOLEAN                         ImmediateMessagePassing;
+    BOOLEAN                         SendRecords; // Send the binary records of the printf (scripts)
     UINT32                          PreAllocatedBuffer;
 
     UINT32 CustomCodeBufferSize;
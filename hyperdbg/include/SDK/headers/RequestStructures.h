@@ -763,6 +763,7 @@ typedef struct _DEBUGGER_SINGLE_CALLSTACK_FRAME
     BOOLEAN IsValidAddress;
     BOOLEAN IsExecutable;
     UINT64  Value;
+    UINT64  StackAddress; // Only for the unwound frames
     BYTE    InstructionBytesOnRip[MAXIMUM_CALL_INSTR_SIZE];
 
 } DEBUGGER_SINGLE_CALLSTACK_FRAME, *PDEBUGGER_SINGLE_CALLSTACK_FRAME;
@@ -788,6 +789,7 @@ typedef enum _DEBUGGER_CALLSTACK_DISPLAY_METHOD
 typedef struct _DEBUGGER_CALLSTACK_REQUEST
 {
     BOOLEAN                           Is32Bit;
+    BOOLEAN                           IsUnwound; // Frames are unwound based on the unwind data of the images
     UINT32                            KernelStatus;
     DEBUGGER_CALLSTACK_DISPLAY_METHOD DisplayMethod;
     UINT32                            Size;
@@ -823,10 +825,11 @@ typedef struct _USERMODE_DEBUGGING_THREAD_OR_PROCESS_STATE_DETAILS
  */
 typedef struct _DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION
 {
-    UINT64 ScriptBuffer;
-    UINT32 ScriptLength;
-    UINT32 ScriptPointer;
-    UINT32 OptionalRequestedBufferSize;
+    UINT64  ScriptBuffer;
+    UINT32  ScriptLength;
+    UINT32  ScriptPointer;
+    UINT32  OptionalRequestedBufferSize;
+    BOOLEAN SendRecords; // Send the binary records of the printf instead of the texts
 
 } DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION,
     *PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION;
@@ -997,6 +1000,8 @@ typedef enum _DEBUGGER_REMOTE_STEPPING_REQUEST
     DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU,
     DEBUGGER_REMOTE_STEPPING_REQUEST_STEP_OVER_FOR_GU_LAST_INSTRUCTION,
 
+    DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_FOR_BATCHED_TRACKING,
+
 } DEBUGGER_REMOTE_STEPPING_REQUEST;
 
 /**
@@ -1014,6 +1019,12 @@ typedef struct _DEBUGGEE_STEP_PACKET
     BOOLEAN IsCurrentInstructionACall;
     UINT32  CallLength;
 
+    //
+    // Only in the case of tracking in batches
+    // the '!track' command
+    //
+    UINT32 TrackingCount;
+
 } DEBUGGEE_STEP_PACKET, *PDEBUGGEE_STEP_PACKET;
 
 /**
@@ -1022,6 +1033,13 @@ typedef struct _DEBUGGEE_STEP_PACKET
  */
 #define DEBUGGER_REMOTE_TRACKING_DEFAULT_COUNT_OF_STEPPING 0xffffffff
 
+/**
+ * @brief maximum number of instructions that the debuggee tracks by itself
+ * in each batch (the debugger checks for CTRL+C between the batches)
+ *
+ */
+#define DEBUGGER_REMOTE_TRACKING_MAXIMUM_COUNT_OF_STEPPING_IN_BATCH 0x10000
+
 /* ==============================================================================================
 
 /**
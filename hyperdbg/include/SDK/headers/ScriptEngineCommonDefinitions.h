@@ -38,6 +38,7 @@ typedef struct ACTION_BUFFER {
   char ImmediatelySendTheResults;
   long long unsigned Context;
   char CallingStage;
+  char SendRecords;
 } ACTION_BUFFER, *PACTION_BUFFER;
 
 #define SYMBOL_UNDEFINED 0
@@ -132,59 +133,66 @@ static const char *const SymbolTypeNames[] = {
 #define FUNC_SPINLOCK_LOCK 43
 #define FUNC_SPINLOCK_UNLOCK 44
 #define FUNC_EVENT_SC 45
-#define FUNC_PRINTF 46
-#define FUNC_PAUSE 47
-#define FUNC_FLUSH 48
-#define FUNC_EVENT_TRACE_STEP 49
-#define FUNC_EVENT_TRACE_STEP_IN 50
-#define FUNC_EVENT_TRACE_STEP_OUT 51
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 52
-#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 53
-#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 54
-#define FUNC_EVENT_INJECT 55
-#define FUNC_POI 56
-#define FUNC_DB 57
-#define FUNC_DD 58
-#define FUNC_DW 59
-#define FUNC_DQ 60
-#define FUNC_NEG 61
-#define FUNC_HI 62
-#define FUNC_LOW 63
-#define FUNC_NOT 64
-#define FUNC_CHECK_ADDRESS 65
-#define FUNC_DISASSEMBLE_LEN 66
-#define FUNC_DISASSEMBLE_LEN32 67
-#define FUNC_DISASSEMBLE_LEN64 68
-#define FUNC_INTERLOCKED_INCREMENT 69
-#define FUNC_INTERLOCKED_DECREMENT 70
-#define FUNC_PHYSICAL_TO_VIRTUAL 71
-#define FUNC_VIRTUAL_TO_PHYSICAL 72
-#define FUNC_POI_PA 73
-#define FUNC_HI_PA 74
-#define FUNC_LOW_PA 75
-#define FUNC_DB_PA 76
-#define FUNC_DD_PA 77
-#define FUNC_DW_PA 78
-#define FUNC_DQ_PA 79
-#define FUNC_ED 80
-#define FUNC_EB 81
-#define FUNC_EQ 82
-#define FUNC_INTERLOCKED_EXCHANGE 83
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 84
-#define FUNC_EB_PA 85
-#define FUNC_ED_PA 86
-#define FUNC_EQ_PA 87
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 88
-#define FUNC_STRLEN 89
-#define FUNC_STRCMP 90
-#define FUNC_MEMCMP 91
-#define FUNC_STRNCMP 92
-#define FUNC_WCSLEN 93
-#define FUNC_WCSCMP 94
-#define FUNC_EVENT_INJECT_ERROR_CODE 95
-#define FUNC_MEMCPY 96
-#define FUNC_MEMCPY_PA 97
-#define FUNC_WCSNCMP 98
+#define FUNC_MAP_PRINT 46
+#define FUNC_MAP_CLEAR 47
+#define FUNC_PRINTF 48
+#define FUNC_PAUSE 49
+#define FUNC_FLUSH 50
+#define FUNC_EVENT_TRACE_STEP 51
+#define FUNC_EVENT_TRACE_STEP_IN 52
+#define FUNC_EVENT_TRACE_STEP_OUT 53
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP 54
+#define FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN 55
+#define FUNC_SPINLOCK_LOCK_CUSTOM_WAIT 56
+#define FUNC_EVENT_INJECT 57
+#define FUNC_MAP_COUNT 58
+#define FUNC_HIST 59
+#define FUNC_POI 60
+#define FUNC_DB 61
+#define FUNC_DD 62
+#define FUNC_DW 63
+#define FUNC_DQ 64
+#define FUNC_NEG 65
+#define FUNC_HI 66
+#define FUNC_LOW 67
+#define FUNC_NOT 68
+#define FUNC_CHECK_ADDRESS 69
+#define FUNC_DISASSEMBLE_LEN 70
+#define FUNC_DISASSEMBLE_LEN32 71
+#define FUNC_DISASSEMBLE_LEN64 72
+#define FUNC_INTERLOCKED_INCREMENT 73
+#define FUNC_INTERLOCKED_DECREMENT 74
+#define FUNC_PHYSICAL_TO_VIRTUAL 75
+#define FUNC_VIRTUAL_TO_PHYSICAL 76
+#define FUNC_POI_PA 77
+#define FUNC_HI_PA 78
+#define FUNC_LOW_PA 79
+#define FUNC_DB_PA 80
+#define FUNC_DD_PA 81
+#define FUNC_DW_PA 82
+#define FUNC_DQ_PA 83
+#define FUNC_ED 84
+#define FUNC_EB 85
+#define FUNC_EQ 86
+#define FUNC_INTERLOCKED_EXCHANGE 87
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 88
+#define FUNC_EB_PA 89
+#define FUNC_ED_PA 90
+#define FUNC_EQ_PA 91
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 92
+#define FUNC_STRLEN 93
+#define FUNC_STRCMP 94
+#define FUNC_MEMCMP 95
+#define FUNC_STRNCMP 96
+#define FUNC_WCSLEN 97
+#define FUNC_WCSCMP 98
+#define FUNC_EVENT_INJECT_ERROR_CODE 99
+#define FUNC_MEMCPY 100
+#define FUNC_MEMCPY_PA 101
+#define FUNC_MAP_SUM 102
+#define FUNC_MAP_MIN 103
+#define FUNC_MAP_MAX 104
+#define FUNC_WCSNCMP 105
 
 static const char *const FunctionNames[] = {
 "FUNC_UNDEFINED",
@@ -233,6 +241,8 @@ static const char *const FunctionNames[] = {
 "FUNC_SPINLOCK_LOCK",
 "FUNC_SPINLOCK_UNLOCK",
 "FUNC_EVENT_SC",
+"FUNC_MAP_PRINT",
+"FUNC_MAP_CLEAR",
 "FUNC_PRINTF",
 "FUNC_PAUSE",
 "FUNC_FLUSH",
@@ -243,6 +253,8 @@ static const char *const FunctionNames[] = {
 "FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN",
 "FUNC_SPINLOCK_LOCK_CUSTOM_WAIT",
 "FUNC_EVENT_INJECT",
+"FUNC_MAP_COUNT",
+"FUNC_HIST",
 "FUNC_POI",
 "FUNC_DB",
 "FUNC_DD",
@@ -285,6 +297,9 @@ static const char *const FunctionNames[] = {
 "FUNC_EVENT_INJECT_ERROR_CODE",
 "FUNC_MEMCPY",
 "FUNC_MEMCPY_PA",
+"FUNC_MAP_SUM",
+"FUNC_MAP_MIN",
+"FUNC_MAP_MAX",
 "FUNC_WCSNCMP",
 };
 
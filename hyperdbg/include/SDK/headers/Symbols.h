@@ -32,6 +32,7 @@ typedef struct _MODULE_SYMBOL_DETAIL
     char    FilePath[MAX_PATH];
     char    ModuleSymbolPath[MAX_PATH];
     char    ModuleSymbolGuidAndAge[MAXIMUM_GUID_AND_AGE_SIZE];
+    UINT64  ModuleSize; // Size of the image of the module (zero if it's not reported)
 
 } MODULE_SYMBOL_DETAIL, *PMODULE_SYMBOL_DETAIL;
 
@@ -594,6 +594,9 @@ DisassemblerLengthDisassembleEngine(PVOID Address, BOOLEAN Is32Bit);
 IMPORT_EXPORT_VMM UINT32
 DisassemblerLengthDisassembleEngineInVmxRootOnTargetProcess(PVOID Address, BOOLEAN Is32Bit);
 
+IMPORT_EXPORT_VMM BOOLEAN
+DisassemblerCheckCallOrRetInVmxRootOnTargetProcess(PVOID Address, BOOLEAN Is32Bit, BOOLEAN * IsRet, UINT32 * Length);
+
 // ----------------------------------------------------------------------------
 // Writing Memory Functions
 //
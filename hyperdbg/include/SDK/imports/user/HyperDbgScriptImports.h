@@ -61,6 +61,9 @@ HardwareScriptInterpreterFreeHwdbgShortSymbolBuffer(HWDBG_SHORT_SYMBOL * NewShor
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE PVOID
 ScriptEngineParse(char * str);
 
+IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
+ScriptEngineOptimizeSymbolBuffer(PVOID SymbolBuffer);
+
 IMPORT_EXPORT_HYPERDBG_SCRIPT_ENGINE BOOLEAN
 ScriptEngineSetHwdbgInstanceInfo(HWDBG_INSTANCE_INFORMATION * InstancInfo);
 
@@ -0,0 +1,207 @@
+/**
+ * @file ChainedIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the chained (intrusive) hash index
+ * @details Each bucket is a singly linked list of the entries and the new
+ * entries are linked to the head of their buckets. A removed entry is only
+ * unlinked (its next entry is not changed), so a lookup that runs at the same
+ * time as a change and is on the removed entry still reaches the rest of the
+ * bucket. This file doesn't use any platform-specific function, so it's used
+ * in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the bucket of a key
+ * @details The keys are mostly ids that are multiples of four, so the bits
+ * are mixed before masking
+ *
+ * @param Index
+ * @param Key
+ *
+ * @return UINT32
+ */
+static UINT32
+ChainedIndexGetBucket(PCHAINED_INDEX Index, UINT64 Key)
+{
+    Key = Key * 0x9E3779B97F4A7C15ull;
+    Key = Key ^ (Key >> 32);
+
+    return (UINT32)Key & (Index->BucketCount - 1);
+}
+
+/**
+ * @brief Get the size of the storage that should be allocated for the index
+ *
+ * @param BucketCount Number of the buckets (a power of two)
+ *
+ * @return UINT64
+ */
+UINT64
+ChainedIndexGetRequiredSize(UINT32 BucketCount)
+{
+    return (UINT64)BucketCount * sizeof(PCHAINED_INDEX_ENTRY);
+}
+
+/**
+ * @brief Initialize the index
+ *
+ * @param Index
+ * @param Storage A buffer with the size of ChainedIndexGetRequiredSize
+ * @param BucketCount Number of the buckets (a power of two)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ChainedIndexInitialize(PCHAINED_INDEX Index, PVOID Storage, UINT32 BucketCount)
+{
+    memset(Index, 0, sizeof(CHAINED_INDEX));
+
+    if (Storage == NULL || BucketCount == 0 || (BucketCount & (BucketCount - 1)) != 0)
+    {
+        return FALSE;
+    }
+
+    Index->Buckets     = (PCHAINED_INDEX_ENTRY volatile *)Storage;
+    Index->BucketCount = BucketCount;
+
+    ChainedIndexClear(Index);
+
+    return TRUE;
+}
+
+/**
+ * @brief Insert an entry to the index
+ *
+ * @param Index
+ * @param Entry Should not be already in the index
+ * @param Key
+ *
+ * @return BOOLEAN FALSE if the index is not initialized
+ */
+BOOLEAN
+ChainedIndexInsert(PCHAINED_INDEX Index, PCHAINED_INDEX_ENTRY Entry, UINT64 Key)
+{
+    UINT32 Bucket;
+
+    if (Index->Buckets == NULL)
+    {
+        return FALSE;
+    }
+
+    Bucket = ChainedIndexGetBucket(Index, Key);
+
+    //
+    // The entry should be written before it's linked to the bucket
+    //
+    Entry->Key  = Key;
+    Entry->Next = Index->Buckets[Bucket];
+
+    Index->Buckets[Bucket] = Entry;
+
+    Index->Count++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the entries of a key
+ * @details The entries are returned from the last inserted one, the next
+ * entries of the same key are found by passing the previous entry
+ *
+ * @param Index
+ * @param Key
+ * @param Previous The previous found entry of the key (or NULL to get the first entry)
+ *
+ * @return PCHAINED_INDEX_ENTRY NULL if there is no other entry
+ */
+PCHAINED_INDEX_ENTRY
+ChainedIndexFind(PCHAINED_INDEX Index, UINT64 Key, PCHAINED_INDEX_ENTRY Previous)
+{
+    PCHAINED_INDEX_ENTRY Entry;
+
+    if (Index->Buckets == NULL)
+    {
+        return NULL;
+    }
+
+    Entry = Previous == NULL ? Index->Buckets[ChainedIndexGetBucket(Index, Key)] : Previous->Next;
+
+    for (; Entry != NULL; Entry = Entry->Next)
+    {
+        if (Entry->Key == Key)
+        {
+            return Entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Remove an entry from the index
+ *
+ * @param Index
+ * @param Entry
+ *
+ * @return BOOLEAN FALSE if the entry was not found
+ */
+BOOLEAN
+ChainedIndexRemove(PCHAINED_INDEX Index, PCHAINED_INDEX_ENTRY Entry)
+{
+    PCHAINED_INDEX_ENTRY volatile * Link;
+
+    if (Index->Buckets == NULL)
+    {
+        return FALSE;
+    }
+
+    Link = &Index->Buckets[ChainedIndexGetBucket(Index, Entry->Key)];
+
+    while (*Link != NULL)
+    {
+        if (*Link == Entry)
+        {
+            //
+            // The next entry of the removed entry is kept for the lookups
+            // that are on it
+            //
+            *Link = Entry->Next;
+
+            Index->Count--;
+
+            return TRUE;
+        }
+
+        Link = &(*Link)->Next;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Remove all of the entries of the index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+ChainedIndexClear(PCHAINED_INDEX Index)
+{
+    //
+    // Buckets are cleared one by one (not by memset), so a concurrent lookup
+    // never sees a partially cleared bucket
+    //
+    for (UINT32 i = 0; i < Index->BucketCount; i++)
+    {
+        Index->Buckets[i] = NULL;
+    }
+
+    Index->Count = 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file ChainedIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the chained (intrusive) hash index
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of the index
+ * @details The entries are embedded in the items (e.g., in the structures
+ * that are already allocated from the pre-allocated pools), so the number
+ * of the items is not limited by the index
+ *
+ */
+typedef struct _CHAINED_INDEX_ENTRY
+{
+    struct _CHAINED_INDEX_ENTRY * volatile Next; // Next entry of the same bucket
+    volatile UINT64                        Key;
+
+} CHAINED_INDEX_ENTRY, *PCHAINED_INDEX_ENTRY;
+
+/**
+ * @brief A hash index from keys to the entries that are embedded in the items
+ * @details Only the buckets are given by the caller, so the index never
+ * allocates and can be used in vmx-root. The same key might be inserted
+ * multiple times and the last inserted entry is found first (the same as
+ * InsertHeadList). The caller should serialize the changes, but the lookups
+ * might run at the same time as the changes (an entry is completely written
+ * before it's linked and the removed entries keep their next entries)
+ *
+ */
+typedef struct _CHAINED_INDEX
+{
+    PCHAINED_INDEX_ENTRY volatile * Buckets;     // Storage of the buckets
+    UINT32                          BucketCount; // Number of the buckets (a power of two)
+    UINT32                          Count;       // Number of the entries
+
+} CHAINED_INDEX, *PCHAINED_INDEX;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+ChainedIndexGetRequiredSize(UINT32 BucketCount);
+
+BOOLEAN
+ChainedIndexInitialize(PCHAINED_INDEX Index, PVOID Storage, UINT32 BucketCount);
+
+BOOLEAN
+ChainedIndexInsert(PCHAINED_INDEX Index, PCHAINED_INDEX_ENTRY Entry, UINT64 Key);
+
+PCHAINED_INDEX_ENTRY
+ChainedIndexFind(PCHAINED_INDEX Index, UINT64 Key, PCHAINED_INDEX_ENTRY Previous);
+
+BOOLEAN
+ChainedIndexRemove(PCHAINED_INDEX Index, PCHAINED_INDEX_ENTRY Entry);
+
+VOID
+ChainedIndexClear(PCHAINED_INDEX Index);
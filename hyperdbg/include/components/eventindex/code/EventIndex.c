@@ -0,0 +1,284 @@
+/**
+ * @file EventIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the dispatch index of the events
+ * @details A lookup only visits the bucket of the key and the 'all' events
+ * and merges them by their sequence, so the cost of triggering an event
+ * depends on the number of the matching events instead of all of the events
+ * of the same type. The removed nodes keep their next link (the same as
+ * RemoveEntryList), so a lookup that stands on a removed node continues
+ * safely. This file doesn't use any platform-specific function, so it's used
+ * in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the bucket of a key
+ *
+ * @param Index
+ * @param Key
+ *
+ * @return PEVENT_INDEX_LINK
+ */
+static PEVENT_INDEX_LINK
+EventIndexGetBucket(PEVENT_INDEX Index, UINT64 Key)
+{
+    Key = Key * 0x9E3779B97F4A7C15ull;
+
+    return &Index->Buckets[(Key >> 32) & (EVENT_INDEX_BUCKET_COUNT - 1)];
+}
+
+/**
+ * @brief Check whether a node passes the prefilters of a lookup
+ *
+ * @param Node
+ * @param CoreId
+ * @param ProcessId
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EventIndexIsTarget(PEVENT_INDEX_NODE Node, UINT32 CoreId, UINT32 ProcessId)
+{
+    return (Node->CoreId == EVENT_INDEX_ANY || Node->CoreId == CoreId) &&
+           (Node->ProcessId == EVENT_INDEX_ANY || Node->ProcessId == ProcessId);
+}
+
+/**
+ * @brief Skip the nodes that don't match a lookup
+ *
+ * @param Head Head of the list
+ * @param Cursor Last visited link, updated to the link before the match
+ * @param CheckKey Whether the key of the nodes should be checked or not
+ * @param Iterator
+ *
+ * @return PEVENT_INDEX_NODE The next matching node or NULL
+ */
+static PEVENT_INDEX_NODE
+EventIndexPeek(PEVENT_INDEX_LINK Head, PEVENT_INDEX_LINK * Cursor, BOOLEAN CheckKey, PEVENT_INDEX_ITERATOR Iterator)
+{
+    PEVENT_INDEX_LINK Link = (*Cursor)->Next;
+    PEVENT_INDEX_NODE Node;
+
+    while (Link != Head)
+    {
+        Node = (PEVENT_INDEX_NODE)Link;
+
+        if ((!CheckKey || Node->Key == Iterator->Key) &&
+            EventIndexIsTarget(Node, Iterator->CoreId, Iterator->ProcessId))
+        {
+            return Node;
+        }
+
+        *Cursor = Link;
+        Link    = Link->Next;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Initialize the index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+EventIndexInitialize(PEVENT_INDEX Index)
+{
+    for (UINT32 i = 0; i < EVENT_INDEX_BUCKET_COUNT; i++)
+    {
+        Index->Buckets[i].Next     = &Index->Buckets[i];
+        Index->Buckets[i].Previous = &Index->Buckets[i];
+    }
+
+    Index->AllKeys.Next     = &Index->AllKeys;
+    Index->AllKeys.Previous = &Index->AllKeys;
+
+    Index->NextSequence = 0;
+    Index->Count        = 0;
+}
+
+/**
+ * @brief Initialize the node of a new event
+ *
+ * @param Node
+ *
+ * @return VOID
+ */
+VOID
+EventIndexInitializeNode(PEVENT_INDEX_NODE Node)
+{
+    Node->Link.Next     = NULL;
+    Node->Link.Previous = NULL;
+    Node->Key           = 0;
+    Node->Sequence      = 0;
+    Node->CoreId        = EVENT_INDEX_ANY;
+    Node->ProcessId     = EVENT_INDEX_ANY;
+    Node->IsKeyed       = FALSE;
+}
+
+/**
+ * @brief Add an event to the index
+ * @details If the node is already in the index with the same key, only its
+ * prefilters are updated, otherwise it's moved to its new bucket but keeps
+ * its order between the other events
+ *
+ * @param Index
+ * @param Node
+ * @param IsKeyed Whether the event only matches a single key or all keys
+ * @param Key
+ * @param CoreId Target core or EVENT_INDEX_ANY
+ * @param ProcessId Target process or EVENT_INDEX_ANY
+ *
+ * @return VOID
+ */
+VOID
+EventIndexInsert(PEVENT_INDEX      Index,
+                 PEVENT_INDEX_NODE Node,
+                 BOOLEAN           IsKeyed,
+                 UINT64            Key,
+                 UINT32            CoreId,
+                 UINT32            ProcessId)
+{
+    PEVENT_INDEX_LINK Head;
+    PEVENT_INDEX_LINK Position;
+
+    Key = IsKeyed ? Key : 0;
+
+    //
+    // The lookups might stand on this node, so it's not moved if it's
+    // already in the right list
+    //
+    if (Node->Link.Previous != NULL && Node->IsKeyed == IsKeyed && Node->Key == Key)
+    {
+        Node->CoreId    = CoreId;
+        Node->ProcessId = ProcessId;
+
+        return;
+    }
+
+    EventIndexRemove(Index, Node);
+
+    if (Node->Sequence == 0)
+    {
+        Index->NextSequence++;
+        Node->Sequence = Index->NextSequence;
+    }
+
+    Node->Key       = Key;
+    Node->CoreId    = CoreId;
+    Node->ProcessId = ProcessId;
+    Node->IsKeyed   = IsKeyed;
+
+    Head = IsKeyed ? EventIndexGetBucket(Index, Key) : &Index->AllKeys;
+
+    //
+    // Newer events come first, a new event is always inserted at the head
+    //
+    Position = Head->Next;
+
+    while (Position != Head && ((PEVENT_INDEX_NODE)Position)->Sequence > Node->Sequence)
+    {
+        Position = Position->Next;
+    }
+
+    //
+    // The node is filled before it becomes reachable from the list
+    //
+    Node->Link.Next     = Position;
+    Node->Link.Previous = Position->Previous;
+
+    Position->Previous->Next = &Node->Link;
+    Position->Previous       = &Node->Link;
+
+    Index->Count++;
+}
+
+/**
+ * @brief Remove an event from the index
+ * @details Nothing happens if the event is not in the index
+ *
+ * @param Index
+ * @param Node
+ *
+ * @return VOID
+ */
+VOID
+EventIndexRemove(PEVENT_INDEX Index, PEVENT_INDEX_NODE Node)
+{
+    if (Node->Link.Previous == NULL)
+    {
+        return;
+    }
+
+    Node->Link.Previous->Next = Node->Link.Next;
+    Node->Link.Next->Previous = Node->Link.Previous;
+
+    //
+    // The next link is kept for the lookups that stand on this node
+    //
+    Node->Link.Previous = NULL;
+
+    Index->Count--;
+}
+
+/**
+ * @brief Start looking up the events of a key
+ *
+ * @param Index
+ * @param Iterator
+ * @param Key
+ * @param CoreId Current core
+ * @param ProcessId Current process
+ *
+ * @return VOID
+ */
+VOID
+EventIndexBeginLookup(PEVENT_INDEX          Index,
+                      PEVENT_INDEX_ITERATOR Iterator,
+                      UINT64                Key,
+                      UINT32                CoreId,
+                      UINT32                ProcessId)
+{
+    Iterator->KeyedHead   = EventIndexGetBucket(Index, Key);
+    Iterator->AllHead     = &Index->AllKeys;
+    Iterator->KeyedCursor = Iterator->KeyedHead;
+    Iterator->AllCursor   = Iterator->AllHead;
+    Iterator->Key         = Key;
+    Iterator->CoreId      = CoreId;
+    Iterator->ProcessId   = ProcessId;
+}
+
+/**
+ * @brief Get the next matching event of a lookup
+ *
+ * @param Iterator
+ *
+ * @return PEVENT_INDEX_NODE NULL if there is no other event
+ */
+PEVENT_INDEX_NODE
+EventIndexGetNext(PEVENT_INDEX_ITERATOR Iterator)
+{
+    PEVENT_INDEX_NODE Keyed = EventIndexPeek(Iterator->KeyedHead, &Iterator->KeyedCursor, TRUE, Iterator);
+    PEVENT_INDEX_NODE All   = EventIndexPeek(Iterator->AllHead, &Iterator->AllCursor, FALSE, Iterator);
+
+    if (Keyed != NULL && (All == NULL || Keyed->Sequence > All->Sequence))
+    {
+        Iterator->KeyedCursor = &Keyed->Link;
+        return Keyed;
+    }
+
+    if (All != NULL)
+    {
+        Iterator->AllCursor = &All->Link;
+    }
+
+    return All;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file EventIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the dispatch index of the events
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the buckets of the keyed events (a power of two)
+ *
+ */
+#define EVENT_INDEX_BUCKET_COUNT 128
+
+/**
+ * @brief The core or the process of the events that are applied to all of
+ * the cores or all of the processes
+ *
+ */
+#define EVENT_INDEX_ANY 0xffffffff
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Link of the circular lists of the index
+ *
+ */
+typedef struct _EVENT_INDEX_LINK
+{
+    struct _EVENT_INDEX_LINK * Next;
+    struct _EVENT_INDEX_LINK * Previous;
+
+} EVENT_INDEX_LINK, *PEVENT_INDEX_LINK;
+
+/**
+ * @brief Node of an event in the index (embedded in the event)
+ * @details The prefilters (core and process) are copied to the node, so the
+ * events that don't match are skipped without touching the event itself
+ *
+ */
+typedef struct _EVENT_INDEX_NODE
+{
+    EVENT_INDEX_LINK Link;      // Should be the first member
+    UINT64           Key;       // Key of the event (if it's not an 'all' event)
+    UINT64           Sequence;  // Order of the event (zero if it's never indexed)
+    UINT32           CoreId;    // Target core or EVENT_INDEX_ANY
+    UINT32           ProcessId; // Target process or EVENT_INDEX_ANY
+    BOOLEAN          IsKeyed;   // Whether the event is in a bucket or in the 'all' events
+
+} EVENT_INDEX_NODE, *PEVENT_INDEX_NODE;
+
+/**
+ * @brief The dispatch index of the events of a single type
+ * @details The events with a key (e.g., an MSR or a syscall number) are kept
+ * in the bucket of their key and the other events (the 'all' events) are kept
+ * in a separate list. Each list is sorted by the sequence of the events
+ * (newest first), so the lookups return the events with the same order as the
+ * list of the events. The nodes are embedded in the events and the index never
+ * allocates, the caller should serialize the changes
+ *
+ */
+typedef struct _EVENT_INDEX
+{
+    EVENT_INDEX_LINK Buckets[EVENT_INDEX_BUCKET_COUNT]; // Events with a key
+    EVENT_INDEX_LINK AllKeys;                           // Events without a key
+    UINT64           NextSequence;                      // Sequence of the next new event
+    UINT32           Count;                             // Number of the events
+
+} EVENT_INDEX, *PEVENT_INDEX;
+
+/**
+ * @brief State of a lookup
+ * @details The cursors are the last visited links (not the next ones), so the
+ * events might be changed between the calls, the same as walking the list
+ *
+ */
+typedef struct _EVENT_INDEX_ITERATOR
+{
+    PEVENT_INDEX_LINK KeyedHead;   // Head of the bucket of the key
+    PEVENT_INDEX_LINK AllHead;     // Head of the 'all' events
+    PEVENT_INDEX_LINK KeyedCursor; // Last visited link of the bucket
+    PEVENT_INDEX_LINK AllCursor;   // Last visited link of the 'all' events
+    UINT64            Key;
+    UINT32            CoreId;
+    UINT32            ProcessId;
+
+} EVENT_INDEX_ITERATOR, *PEVENT_INDEX_ITERATOR;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+EventIndexInitialize(PEVENT_INDEX Index);
+
+VOID
+EventIndexInitializeNode(PEVENT_INDEX_NODE Node);
+
+VOID
+EventIndexInsert(PEVENT_INDEX      Index,
+                 PEVENT_INDEX_NODE Node,
+                 BOOLEAN           IsKeyed,
+                 UINT64            Key,
+                 UINT32            CoreId,
+                 UINT32            ProcessId);
+
+VOID
+EventIndexRemove(PEVENT_INDEX Index, PEVENT_INDEX_NODE Node);
+
+VOID
+EventIndexBeginLookup(PEVENT_INDEX          Index,
+                      PEVENT_INDEX_ITERATOR Iterator,
+                      UINT64                Key,
+                      UINT32                CoreId,
+                      UINT32                ProcessId);
+
+PEVENT_INDEX_NODE
+EventIndexGetNext(PEVENT_INDEX_ITERATOR Iterator);
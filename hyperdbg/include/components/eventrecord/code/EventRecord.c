@@ -0,0 +1,557 @@
+/**
+ * @file EventRecord.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the binary records of the messages of the events
+ * @details A printf of a script could send a record of its values instead of
+ * formatting them in the debuggee (vmx-root). The records are formatted by the
+ * debugger, the same way as the printf of the script engine formats them. This
+ * file doesn't use the formatting functions of the CRT, so it's usable in the
+ * kernel and the result is the same on any platform
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether a character is a conversion of the integers
+ *
+ * @param Ch
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+EventRecordIsIntegerConversion(CHAR Ch)
+{
+    return Ch == 'd' || Ch == 'i' || Ch == 'u' || Ch == 'o' || Ch == 'x';
+}
+
+/**
+ * @brief Append a buffer to the output
+ * @details In the CSV mode, the quotes are doubled and the new lines are
+ * replaced with spaces (the output is a quoted field). The output is
+ * truncated (but always null-terminated) if it's full
+ *
+ * @param Output
+ * @param OutputSize
+ * @param Position
+ * @param Source
+ * @param Length
+ * @param IsCsv
+ *
+ * @return UINT32 The new position
+ */
+static UINT32
+EventRecordAppend(CHAR * Output, UINT32 OutputSize, UINT32 Position, const CHAR * Source, UINT32 Length, BOOLEAN IsCsv)
+{
+    CHAR Ch;
+
+    if (!IsCsv)
+    {
+        if (Length > OutputSize - 1 - Position)
+        {
+            Length = OutputSize - 1 - Position;
+        }
+
+        memcpy(&Output[Position], Source, Length);
+
+        return Position + Length;
+    }
+
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Ch = Source[i];
+
+        if (Ch == '\n' || Ch == '\r')
+        {
+            Ch = ' ';
+        }
+
+        if (Position + (Ch == '"' ? 2 : 1) > OutputSize - 1)
+        {
+            break;
+        }
+
+        if (Ch == '"')
+        {
+            Output[Position++] = '"';
+        }
+
+        Output[Position++] = Ch;
+    }
+
+    return Position;
+}
+
+/**
+ * @brief Append an integer to the output
+ *
+ * @param Output
+ * @param OutputSize
+ * @param Position
+ * @param Value
+ * @param Base 8, 10, or 16
+ * @param MinimumDigits The number is padded with zeros
+ * @param IsUpper Upper-case hex digits
+ *
+ * @return UINT32 The new position
+ */
+static UINT32
+EventRecordAppendInteger(CHAR * Output, UINT32 OutputSize, UINT32 Position, UINT64 Value, UINT32 Base, UINT32 MinimumDigits, BOOLEAN IsUpper)
+{
+    const CHAR * Digits   = IsUpper ? "0123456789ABCDEF" : "0123456789abcdef";
+    CHAR         Temp[24] = {0};
+    UINT32       Start    = sizeof(Temp);
+
+    do
+    {
+        Temp[--Start] = Digits[Value % Base];
+        Value /= Base;
+
+    } while (Value != 0 || sizeof(Temp) - Start < MinimumDigits);
+
+    return EventRecordAppend(Output, OutputSize, Position, &Temp[Start], sizeof(Temp) - Start, FALSE);
+}
+
+/**
+ * @brief Format a value based on a specifier
+ * @details The values are passed to the printf of the script engine as 64-bit
+ * integers, so it's the same as formatting them with the printf of the
+ * debuggee (Windows), where 'long' is 32-bit and '%p' is 16 upper-case hex
+ * digits. The strings are not in the records, so their addresses are shown
+ *
+ * @param Output
+ * @param OutputSize
+ * @param Position
+ * @param Specifier
+ * @param Length Length of the specifier
+ * @param Value
+ * @param IsCsv
+ *
+ * @return UINT32 The new position
+ */
+static UINT32
+EventRecordApplySpecifier(CHAR * Output, UINT32 OutputSize, UINT32 Position, const CHAR * Specifier, UINT32 Length, UINT64 Value, BOOLEAN IsCsv)
+{
+    CHAR Conversion = Specifier[Length - 1];
+    CHAR Ch;
+
+    if (Conversion == 'c')
+    {
+        //
+        // A null character ends the message
+        //
+        Ch = (CHAR)Value;
+
+        return Ch == '\0' ? Position : EventRecordAppend(Output, OutputSize, Position, &Ch, 1, IsCsv);
+    }
+
+    if (Conversion == 'p' || Conversion == 's')
+    {
+        return EventRecordAppendInteger(Output, OutputSize, Position, Value, 16, 16, TRUE);
+    }
+
+    //
+    // Narrow the value to the size of its specifier ('%x' and '%lx' are
+    // 32-bit, '%hx' is 16-bit, and '%llx' is 64-bit)
+    //
+    if (Length == 3 && Specifier[1] == 'h')
+    {
+        Value = (Conversion == 'd' || Conversion == 'i') ? (UINT64)(INT64)(INT16)Value : (UINT16)Value;
+    }
+    else if (Length != 4)
+    {
+        Value = (Conversion == 'd' || Conversion == 'i') ? (UINT64)(INT64)(INT32)Value : (UINT32)Value;
+    }
+
+    switch (Conversion)
+    {
+    case 'd':
+    case 'i':
+
+        if ((INT64)Value < 0)
+        {
+            Position = EventRecordAppend(Output, OutputSize, Position, "-", 1, FALSE);
+            Value    = 0 - Value;
+        }
+
+        return EventRecordAppendInteger(Output, OutputSize, Position, Value, 10, 1, FALSE);
+
+    case 'u':
+
+        return EventRecordAppendInteger(Output, OutputSize, Position, Value, 10, 1, FALSE);
+
+    case 'o':
+
+        return EventRecordAppendInteger(Output, OutputSize, Position, Value, 8, 1, FALSE);
+
+    default:
+
+        return EventRecordAppendInteger(Output, OutputSize, Position, Value, 16, 1, FALSE);
+    }
+}
+
+/**
+ * @brief Format the values of a record
+ *
+ * @param Format
+ * @param Values
+ * @param ValueCount
+ * @param Output
+ * @param OutputSize
+ * @param Position Position of the message in the output
+ * @param IsCsv Whether the message is a field of CSV
+ *
+ * @return UINT32 The new position
+ */
+static UINT32
+EventRecordFormatMessage(const CHAR *   Format,
+                         const UINT64 * Values,
+                         UINT32         ValueCount,
+                         CHAR *         Output,
+                         UINT32         OutputSize,
+                         UINT32         Position,
+                         BOOLEAN        IsCsv)
+{
+    UINT32  Literal    = 0;
+    UINT32  ValueIndex = 0;
+    UINT32  Length;
+    UINT32  i;
+    BOOLEAN IsString;
+
+    for (i = 0; Format[i] != '\0' && ValueIndex < ValueCount; i++)
+    {
+        if (Format[i] != '%' || (Length = EventRecordGetSpecifierLength(&Format[i], &IsString)) == 0)
+        {
+            continue;
+        }
+
+        //
+        // The text before the specifier, and then the value
+        //
+        Position = EventRecordAppend(Output, OutputSize, Position, &Format[Literal], i - Literal, IsCsv);
+        Position = EventRecordApplySpecifier(Output, OutputSize, Position, &Format[i], Length, Values[ValueIndex++], IsCsv);
+
+        Literal = i + Length;
+        i       = Literal - 1;
+    }
+
+    return EventRecordAppend(Output, OutputSize, Position, &Format[Literal], (UINT32)strlen(&Format[Literal]), IsCsv);
+}
+
+/**
+ * @brief Fill the header of a record of values
+ * @details The values are filled by the caller (in the record), so they're
+ * not copied once more
+ *
+ * @param Record
+ * @param Tag Tag of the event
+ * @param CoreId
+ * @param Tsc
+ * @param Context Context of the event
+ * @param FormatOffset Offset of the format in the script of the event
+ * @param ValueCount
+ *
+ * @return UINT32 Size of the record, or zero if there are too many values
+ */
+UINT32
+EventRecordInitialize(PEVENT_RECORD Record,
+                      UINT64        Tag,
+                      UINT32        CoreId,
+                      UINT64        Tsc,
+                      UINT64        Context,
+                      UINT32        FormatOffset,
+                      UINT32        ValueCount)
+{
+    if (ValueCount > EVENT_RECORD_MAXIMUM_VALUES)
+    {
+        return 0;
+    }
+
+    Record->Signature    = EVENT_RECORD_SIGNATURE;
+    Record->Size         = (UINT16)EVENT_RECORD_SIZE(ValueCount);
+    Record->ValueCount   = (UINT8)ValueCount;
+    Record->Reserved     = 0;
+    Record->CoreId       = CoreId;
+    Record->FormatOffset = FormatOffset;
+    Record->Tag          = Tag;
+    Record->Tsc          = Tsc;
+    Record->Context      = Context;
+
+    return Record->Size;
+}
+
+/**
+ * @brief Build a record of a format
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Tag Tag of the event
+ * @param FormatOffset Offset of the format in the script of the event
+ * @param Format
+ *
+ * @return UINT32 Size of the record, or zero if the buffer is not enough
+ */
+UINT32
+EventRecordBuildFormat(PVOID        Buffer,
+                       UINT32       BufferSize,
+                       UINT64       Tag,
+                       UINT32       FormatOffset,
+                       const CHAR * Format)
+{
+    PEVENT_RECORD_FORMAT Record = (PEVENT_RECORD_FORMAT)Buffer;
+    UINT64               Length = strlen(Format);
+    UINT32               Size;
+
+    if (Length > EVENT_RECORD_FORMAT_MAXIMUM_LENGTH)
+    {
+        return 0;
+    }
+
+    Size = (UINT32)((EVENT_RECORD_FORMAT_HEADER_SIZE + Length + 1 + 7) & ~7ull);
+
+    if (Size > BufferSize)
+    {
+        return 0;
+    }
+
+    memset(Buffer, 0, Size);
+
+    Record->Signature    = EVENT_RECORD_FORMAT_SIGNATURE;
+    Record->Size         = (UINT16)Size;
+    Record->Length       = (UINT16)Length;
+    Record->FormatOffset = FormatOffset;
+    Record->Tag          = Tag;
+
+    memcpy((CHAR *)Buffer + EVENT_RECORD_FORMAT_HEADER_SIZE, Format, (size_t)Length);
+
+    return Size;
+}
+
+/**
+ * @brief Get the type of the message at the start of a buffer
+ * @details Records are validated (their sizes are in the buffer), so the
+ * records of the buffer could be walked by their sizes. The size of a text
+ * message is not known here. The records of a buffer are not aligned (e.g.,
+ * after a text), so their headers are copied
+ *
+ * @param Buffer
+ * @param Length Length of the buffer
+ * @param Size Size of the record (if it's a record)
+ *
+ * @return EVENT_RECORD_TYPE
+ */
+EVENT_RECORD_TYPE
+EventRecordGetType(const VOID * Buffer, UINT32 Length, UINT32 * Size)
+{
+    EVENT_RECORD_FORMAT Format;
+    UINT32              Signature;
+    UINT16              RecordSize;
+    UINT8               ValueCount;
+
+    *Size = 0;
+
+    if (Length < sizeof(UINT32))
+    {
+        return EVENT_RECORD_TYPE_TEXT;
+    }
+
+    memcpy(&Signature, Buffer, sizeof(UINT32));
+
+    if (Signature == EVENT_RECORD_SIGNATURE)
+    {
+        if (Length < EVENT_RECORD_HEADER_SIZE)
+        {
+            return EVENT_RECORD_TYPE_INVALID;
+        }
+
+        memcpy(&RecordSize, (const UINT8 *)Buffer + sizeof(UINT32), sizeof(UINT16));
+        memcpy(&ValueCount, (const UINT8 *)Buffer + sizeof(UINT32) + sizeof(UINT16), sizeof(UINT8));
+
+        if (ValueCount > EVENT_RECORD_MAXIMUM_VALUES || RecordSize != EVENT_RECORD_SIZE(ValueCount) || RecordSize > Length)
+        {
+            return EVENT_RECORD_TYPE_INVALID;
+        }
+
+        *Size = RecordSize;
+
+        return EVENT_RECORD_TYPE_VALUES;
+    }
+
+    if (Signature == EVENT_RECORD_FORMAT_SIGNATURE)
+    {
+        if (Length < EVENT_RECORD_FORMAT_HEADER_SIZE)
+        {
+            return EVENT_RECORD_TYPE_INVALID;
+        }
+
+        memcpy(&Format, Buffer, EVENT_RECORD_FORMAT_HEADER_SIZE);
+
+        if (Format.Size > Length || Format.Size < EVENT_RECORD_FORMAT_HEADER_SIZE + Format.Length + 1 ||
+            ((const CHAR *)Buffer)[EVENT_RECORD_FORMAT_HEADER_SIZE + Format.Length] != '\0')
+        {
+            return EVENT_RECORD_TYPE_INVALID;
+        }
+
+        *Size = Format.Size;
+
+        return EVENT_RECORD_TYPE_FORMAT;
+    }
+
+    return EVENT_RECORD_TYPE_TEXT;
+}
+
+/**
+ * @brief Get the length of a format specifier
+ * @details The specifiers are the same as the ones that the script engine
+ * passes the arguments of the printf for (e.g., "%llx", "%hd", or "%ws")
+ *
+ * @param Specifier The specifier (starts with '%')
+ * @param IsString Whether it's a string ("%s", "%ws", or "%ls")
+ *
+ * @return UINT32 Length of the specifier, or zero if it's not a specifier
+ */
+UINT32
+EventRecordGetSpecifierLength(const CHAR * Specifier, BOOLEAN * IsString)
+{
+    *IsString = FALSE;
+
+    if (Specifier[0] != '%')
+    {
+        return 0;
+    }
+
+    if (EventRecordIsIntegerConversion(Specifier[1]) || Specifier[1] == 'c' || Specifier[1] == 'p')
+    {
+        return 2;
+    }
+
+    if (Specifier[1] == 's')
+    {
+        *IsString = TRUE;
+        return 2;
+    }
+
+    if ((Specifier[1] == 'w' || Specifier[1] == 'l') && Specifier[2] == 's')
+    {
+        *IsString = TRUE;
+        return 3;
+    }
+
+    if ((Specifier[1] == 'l' || Specifier[1] == 'h') && EventRecordIsIntegerConversion(Specifier[2]))
+    {
+        return 3;
+    }
+
+    if (Specifier[1] == 'l' && Specifier[2] == 'l' && EventRecordIsIntegerConversion(Specifier[3]))
+    {
+        return 4;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Format the values of a record as a text
+ * @details The result is the same as the printf of the script (the text that
+ * would have been sent instead of the record)
+ *
+ * @param Format
+ * @param Values
+ * @param ValueCount
+ * @param Output
+ * @param OutputSize
+ *
+ * @return UINT32 Length of the text (the output is null-terminated)
+ */
+UINT32
+EventRecordFormat(const CHAR *   Format,
+                  const UINT64 * Values,
+                  UINT32         ValueCount,
+                  CHAR *         Output,
+                  UINT32         OutputSize)
+{
+    UINT32 Position;
+
+    if (OutputSize == 0)
+    {
+        return 0;
+    }
+
+    Position         = EventRecordFormatMessage(Format, Values, ValueCount, Output, OutputSize, 0, FALSE);
+    Output[Position] = '\0';
+
+    return Position;
+}
+
+/**
+ * @brief Format a record as a line of CSV
+ * @details The columns are the tag, the core, the TSC, the context, the
+ * message (the formatted text, or empty if the format is not known), and the
+ * values (in hex, separated by spaces)
+ *
+ * @param Record
+ * @param Format The format (optional)
+ * @param Output
+ * @param OutputSize
+ *
+ * @return UINT32 Length of the line (the output is null-terminated)
+ */
+UINT32
+EventRecordFormatCsv(const EVENT_RECORD * Record,
+                     const CHAR *         Format,
+                     CHAR *               Output,
+                     UINT32               OutputSize)
+{
+    UINT32 Position = 0;
+    UINT32 MessageStart;
+
+    if (OutputSize == 0)
+    {
+        return 0;
+    }
+
+    Position = EventRecordAppend(Output, OutputSize, Position, "0x", 2, FALSE);
+    Position = EventRecordAppendInteger(Output, OutputSize, Position, Record->Tag, 16, 1, FALSE);
+    Position = EventRecordAppend(Output, OutputSize, Position, ",", 1, FALSE);
+    Position = EventRecordAppendInteger(Output, OutputSize, Position, Record->CoreId, 10, 1, FALSE);
+    Position = EventRecordAppend(Output, OutputSize, Position, ",", 1, FALSE);
+    Position = EventRecordAppendInteger(Output, OutputSize, Position, Record->Tsc, 10, 1, FALSE);
+    Position = EventRecordAppend(Output, OutputSize, Position, ",0x", 3, FALSE);
+    Position = EventRecordAppendInteger(Output, OutputSize, Position, Record->Context, 16, 1, FALSE);
+    Position = EventRecordAppend(Output, OutputSize, Position, ",\"", 2, FALSE);
+
+    if (Format != NULL)
+    {
+        MessageStart = Position;
+        Position     = EventRecordFormatMessage(Format, Record->Values, Record->ValueCount, Output, OutputSize, Position, TRUE);
+
+        //
+        // Most of the messages end with a new line (now a space)
+        //
+        while (Position > MessageStart && Output[Position - 1] == ' ')
+        {
+            Position--;
+        }
+    }
+
+    Position = EventRecordAppend(Output, OutputSize, Position, "\",", 2, FALSE);
+
+    for (UINT32 i = 0; i < Record->ValueCount; i++)
+    {
+        if (i != 0)
+        {
+            Position = EventRecordAppend(Output, OutputSize, Position, " ", 1, FALSE);
+        }
+
+        Position = EventRecordAppend(Output, OutputSize, Position, "0x", 2, FALSE);
+        Position = EventRecordAppendInteger(Output, OutputSize, Position, Record->Values[i], 16, 1, FALSE);
+    }
+
+    Position         = EventRecordAppend(Output, OutputSize, Position, "\n", 1, FALSE);
+    Output[Position] = '\0';
+
+    return Position;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file EventRecord.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the binary records of the messages of the events
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature of the records of the values
+ * @details The first byte (in memory) is not a printable character, so a
+ * record is never mistaken for a text message
+ *
+ */
+#define EVENT_RECORD_SIGNATURE 0x52564597
+
+/**
+ * @brief Signature of the records of the formats
+ *
+ */
+#define EVENT_RECORD_FORMAT_SIGNATURE 0x46524698
+
+/**
+ * @brief Maximum number of the values of a record
+ *
+ */
+#define EVENT_RECORD_MAXIMUM_VALUES 16
+
+/**
+ * @brief Size of a record without its values
+ *
+ */
+#define EVENT_RECORD_HEADER_SIZE (sizeof(EVENT_RECORD) - sizeof(UINT64) * EVENT_RECORD_MAXIMUM_VALUES)
+
+/**
+ * @brief Size of a record with the specified number of values
+ *
+ */
+#define EVENT_RECORD_SIZE(ValueCount) (EVENT_RECORD_HEADER_SIZE + sizeof(UINT64) * (ValueCount))
+
+/**
+ * @brief Size of a record of a format without its string
+ *
+ */
+#define EVENT_RECORD_FORMAT_HEADER_SIZE (sizeof(EVENT_RECORD_FORMAT))
+
+/**
+ * @brief Maximum length of the string of a record of a format
+ *
+ */
+#define EVENT_RECORD_FORMAT_MAXIMUM_LENGTH (0xffff - EVENT_RECORD_FORMAT_HEADER_SIZE - 8)
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Type of a message of an event
+ *
+ */
+typedef enum _EVENT_RECORD_TYPE
+{
+    EVENT_RECORD_TYPE_TEXT,    // Not a record (a text message)
+    EVENT_RECORD_TYPE_VALUES,  // A record of the values (EVENT_RECORD)
+    EVENT_RECORD_TYPE_FORMAT,  // A record of a format (EVENT_RECORD_FORMAT)
+    EVENT_RECORD_TYPE_INVALID, // A record that is truncated or corrupted
+
+} EVENT_RECORD_TYPE;
+
+/**
+ * @brief A record of the values of a printf of a script
+ * @details The record is sent instead of the formatted text, the format is
+ * identified by its offset in the script of the event and is only formatted
+ * by the debugger (once the record is shown)
+ *
+ */
+typedef struct _EVENT_RECORD
+{
+    UINT32 Signature;    // EVENT_RECORD_SIGNATURE
+    UINT16 Size;         // Size of the record (with the values)
+    UINT8  ValueCount;   // Number of the values
+    UINT8  Reserved;     // Zero
+    UINT32 CoreId;       // The core that the event is triggered on
+    UINT32 FormatOffset; // Offset of the format in the script of the event
+    UINT64 Tag;          // Tag of the event
+    UINT64 Tsc;          // Time stamp counter
+    UINT64 Context;      // Context of the event
+    UINT64 Values[EVENT_RECORD_MAXIMUM_VALUES];
+
+} EVENT_RECORD, *PEVENT_RECORD;
+
+/**
+ * @brief A record of a format (the string is after the record)
+ * @details Records of the values are written raw to the output sources, so
+ * each format is written once before the first record that uses it, and a
+ * file of the records could be formatted without the debugger
+ *
+ */
+typedef struct _EVENT_RECORD_FORMAT
+{
+    UINT32 Signature;    // EVENT_RECORD_FORMAT_SIGNATURE
+    UINT16 Size;         // Size of the record (with the string, aligned to 8 bytes)
+    UINT16 Length;       // Length of the string (without the null)
+    UINT32 FormatOffset; // Offset of the format in the script of the event
+    UINT32 Reserved;     // Zero
+    UINT64 Tag;          // Tag of the event
+
+} EVENT_RECORD_FORMAT, *PEVENT_RECORD_FORMAT;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+A message of an event is either a null-terminated text or a record, and the
+buffers of the non-immediate messages are a mix of both of them, one after
+another. Records always start with a signature, and their sizes are multiples
+of 8 bytes.
+
+      EVENT_RECORD                           EVENT_RECORD_FORMAT
+      ________________________________       ________________________________
+     | Signature | Size | Count | ... |     | Signature | Size | Length     |
+     |___________|______|_______|_____|     |___________|______|____________|
+     | CoreId         | FormatOffset  |     | FormatOffset   | (zero)       |
+     |________________|_______________|     |________________|______________|
+     | Tag                            |     | Tag                           |
+     |________________________________|     |_______________________________|
+     | Tsc                            |     | "value: %llx\n"               |
+     |________________________________|     | (null and padding)            |
+     | Context                        |     |_______________________________|
+     |________________________________|
+     | Values[0] ... Values[Count - 1]|
+     |________________________________|
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT32
+EventRecordInitialize(PEVENT_RECORD Record,
+                      UINT64        Tag,
+                      UINT32        CoreId,
+                      UINT64        Tsc,
+                      UINT64        Context,
+                      UINT32        FormatOffset,
+                      UINT32        ValueCount);
+
+UINT32
+EventRecordBuildFormat(PVOID        Buffer,
+                       UINT32       BufferSize,
+                       UINT64       Tag,
+                       UINT32       FormatOffset,
+                       const CHAR * Format);
+
+EVENT_RECORD_TYPE
+EventRecordGetType(const VOID * Buffer, UINT32 Length, UINT32 * Size);
+
+UINT32
+EventRecordGetSpecifierLength(const CHAR * Specifier, BOOLEAN * IsString);
+
+UINT32
+EventRecordFormat(const CHAR *   Format,
+                  const UINT64 * Values,
+                  UINT32         ValueCount,
+                  CHAR *         Output,
+                  UINT32         OutputSize);
+
+UINT32
+EventRecordFormatCsv(const EVENT_RECORD * Record,
+                     const CHAR *         Format,
+                     CHAR *               Output,
+                     UINT32               OutputSize);
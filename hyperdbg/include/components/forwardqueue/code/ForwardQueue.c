@@ -0,0 +1,290 @@
+/**
+ * @file ForwardQueue.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the queues of the messages of the output sources
+ * @details Each output source (file, tcp, etc.) has its own bounded queue that
+ * is filled by the thread that receives the messages and is drained by the
+ * worker of the output source, so a slow output source never stalls receiving
+ * the messages. The queue doesn't know about the threads nor the output
+ * sources, the caller synchronizes it
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Copy a buffer into the queue (it might wrap around the end)
+ *
+ * @param Queue
+ * @param Offset
+ * @param Source
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+ForwardQueueCopyIn(PFORWARD_QUEUE Queue, UINT32 Offset, const VOID * Source, UINT32 Length)
+{
+    UINT32 FirstLength = Queue->Size - Offset;
+
+    if (FirstLength >= Length)
+    {
+        memcpy(Queue->Buffer + Offset, Source, Length);
+    }
+    else
+    {
+        memcpy(Queue->Buffer + Offset, Source, FirstLength);
+        memcpy(Queue->Buffer, (const UINT8 *)Source + FirstLength, Length - FirstLength);
+    }
+}
+
+/**
+ * @brief Copy a buffer out of the queue (it might wrap around the end)
+ *
+ * @param Queue
+ * @param Offset
+ * @param Destination
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+ForwardQueueCopyOut(PFORWARD_QUEUE Queue, UINT32 Offset, VOID * Destination, UINT32 Length)
+{
+    UINT32 FirstLength = Queue->Size - Offset;
+
+    if (FirstLength >= Length)
+    {
+        memcpy(Destination, Queue->Buffer + Offset, Length);
+    }
+    else
+    {
+        memcpy(Destination, Queue->Buffer + Offset, FirstLength);
+        memcpy((UINT8 *)Destination + FirstLength, Queue->Buffer, Length - FirstLength);
+    }
+}
+
+/**
+ * @brief Move an offset of the queue forward
+ *
+ * @param Queue
+ * @param Offset
+ * @param Length
+ *
+ * @return UINT32 The new offset
+ */
+static UINT32
+ForwardQueueAdvance(PFORWARD_QUEUE Queue, UINT32 Offset, UINT32 Length)
+{
+    UINT64 NewOffset = (UINT64)Offset + Length;
+
+    return (UINT32)(NewOffset >= Queue->Size ? NewOffset - Queue->Size : NewOffset);
+}
+
+/**
+ * @brief Initialize the queue
+ *
+ * @param Queue
+ * @param Buffer The buffer of the queue
+ * @param Size Size of the buffer
+ * @param Policy What to do once the queue is full
+ *
+ * @return BOOLEAN FALSE if the buffer is too small
+ */
+BOOLEAN
+ForwardQueueInitialize(PFORWARD_QUEUE Queue, PVOID Buffer, UINT32 Size, FORWARD_QUEUE_POLICY Policy)
+{
+    if (Buffer == NULL || Size <= FORWARD_QUEUE_MESSAGE_HEADER_SIZE)
+    {
+        return FALSE;
+    }
+
+    memset(Queue, 0, sizeof(FORWARD_QUEUE));
+
+    Queue->Buffer = (UINT8 *)Buffer;
+    Queue->Size   = Size;
+    Queue->Policy = Policy;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether there is any message in the queue
+ *
+ * @param Queue
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ForwardQueueIsEmpty(PFORWARD_QUEUE Queue)
+{
+    return Queue->MessageCount == 0;
+}
+
+/**
+ * @brief Add a message to the queue
+ * @details If the queue is full, the message is either dropped or the caller
+ * should wait for the writer and then try again (based on the policy). A
+ * message that never fits in the queue is always dropped
+ *
+ * @param Queue
+ * @param Message
+ * @param MessageLength
+ *
+ * @return FORWARD_QUEUE_STATUS
+ */
+FORWARD_QUEUE_STATUS
+ForwardQueuePush(PFORWARD_QUEUE Queue, const VOID * Message, UINT32 MessageLength)
+{
+    UINT32 WriteOffset;
+
+    if (MessageLength > Queue->Size - FORWARD_QUEUE_MESSAGE_HEADER_SIZE ||
+        (Queue->Size - Queue->UsedSize < FORWARD_QUEUE_MESSAGE_SIZE(MessageLength) &&
+         Queue->Policy == FORWARD_QUEUE_POLICY_DROP))
+    {
+        Queue->Statistics.DroppedMessages++;
+        Queue->Statistics.DroppedBytes += MessageLength;
+
+        return FORWARD_QUEUE_STATUS_DROPPED;
+    }
+
+    if (Queue->Size - Queue->UsedSize < FORWARD_QUEUE_MESSAGE_SIZE(MessageLength))
+    {
+        return FORWARD_QUEUE_STATUS_FULL;
+    }
+
+    WriteOffset = ForwardQueueAdvance(Queue, Queue->ReadOffset, Queue->UsedSize);
+
+    ForwardQueueCopyIn(Queue, WriteOffset, &MessageLength, FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+
+    WriteOffset = ForwardQueueAdvance(Queue, WriteOffset, FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+
+    ForwardQueueCopyIn(Queue, WriteOffset, Message, MessageLength);
+
+    Queue->UsedSize += (UINT32)FORWARD_QUEUE_MESSAGE_SIZE(MessageLength);
+    Queue->MessageCount++;
+
+    Queue->Statistics.QueuedMessages++;
+    Queue->Statistics.QueuedBytes += MessageLength;
+
+    if (Queue->UsedSize > Queue->Statistics.MaximumUsedSize)
+    {
+        Queue->Statistics.MaximumUsedSize = Queue->UsedSize;
+    }
+
+    return FORWARD_QUEUE_STATUS_QUEUED;
+}
+
+/**
+ * @brief Take the oldest messages of the queue as a single batch
+ * @details The bodies of the messages are copied one after another, so the
+ * batch is written at once (e.g., to a file or a socket). The lengths are
+ * only needed for the output sources that keep the boundaries of the messages
+ * (e.g., a callback that is called for each message). A message that is
+ * larger than the whole batch is dropped
+ *
+ * @param Queue
+ * @param Batch The buffer of the batch
+ * @param BatchSize Size of the batch
+ * @param Lengths The length of each message of the batch (optional)
+ * @param MaximumMessages Number of the items of the lengths
+ * @param MessageCount Number of the messages of the batch
+ *
+ * @return UINT32 Length of the batch
+ */
+UINT32
+ForwardQueueTakeBatch(PFORWARD_QUEUE Queue,
+                      PVOID          Batch,
+                      UINT32         BatchSize,
+                      UINT32 *       Lengths,
+                      UINT32         MaximumMessages,
+                      UINT32 *       MessageCount)
+{
+    UINT32 BatchLength = 0;
+    UINT32 Count       = 0;
+    UINT32 MessageLength;
+    UINT32 BodyOffset;
+
+    while (Queue->MessageCount != 0 && (Lengths == NULL || Count < MaximumMessages))
+    {
+        ForwardQueueCopyOut(Queue, Queue->ReadOffset, &MessageLength, FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+
+        if (MessageLength > BatchSize)
+        {
+            //
+            // It never fits in the batch
+            //
+            Queue->Statistics.DroppedMessages++;
+            Queue->Statistics.DroppedBytes += MessageLength;
+        }
+        else if (MessageLength > BatchSize - BatchLength)
+        {
+            //
+            // It goes to the next batch
+            //
+            break;
+        }
+        else
+        {
+            BodyOffset = ForwardQueueAdvance(Queue, Queue->ReadOffset, FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+
+            ForwardQueueCopyOut(Queue, BodyOffset, (UINT8 *)Batch + BatchLength, MessageLength);
+
+            if (Lengths != NULL)
+            {
+                Lengths[Count] = MessageLength;
+            }
+
+            BatchLength += MessageLength;
+            Count++;
+        }
+
+        Queue->ReadOffset = ForwardQueueAdvance(Queue, Queue->ReadOffset, (UINT32)FORWARD_QUEUE_MESSAGE_SIZE(MessageLength));
+        Queue->UsedSize -= (UINT32)FORWARD_QUEUE_MESSAGE_SIZE(MessageLength);
+        Queue->MessageCount--;
+    }
+
+    if (Queue->MessageCount == 0)
+    {
+        //
+        // Start from the beginning, so the next batches are less likely to wrap
+        //
+        Queue->ReadOffset = 0;
+    }
+
+    if (Count != 0)
+    {
+        Queue->Statistics.Batches++;
+    }
+
+    *MessageCount = Count;
+
+    return BatchLength;
+}
+
+/**
+ * @brief Count a batch after it's written
+ *
+ * @param Queue
+ * @param BatchLength
+ * @param MessageCount
+ * @param IsWritten Whether the batch is written successfully
+ *
+ * @return VOID
+ */
+VOID
+ForwardQueueCompleteBatch(PFORWARD_QUEUE Queue, UINT32 BatchLength, UINT32 MessageCount, BOOLEAN IsWritten)
+{
+    if (IsWritten)
+    {
+        Queue->Statistics.WrittenMessages += MessageCount;
+        Queue->Statistics.WrittenBytes += BatchLength;
+    }
+    else
+    {
+        Queue->Statistics.FailedMessages += MessageCount;
+    }
+}
@@ -0,0 +1,147 @@
+/**
+ * @file ForwardQueue.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the queues of the messages of the output sources
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the header (the length) of each message in the queue
+ *
+ */
+#define FORWARD_QUEUE_MESSAGE_HEADER_SIZE sizeof(UINT32)
+
+/**
+ * @brief Size of a message with the specified length in the queue
+ *
+ */
+#define FORWARD_QUEUE_MESSAGE_SIZE(MessageLength) (FORWARD_QUEUE_MESSAGE_HEADER_SIZE + (MessageLength))
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief What to do with a new message once the queue is full
+ *
+ */
+typedef enum _FORWARD_QUEUE_POLICY
+{
+    FORWARD_QUEUE_POLICY_BLOCK, // The caller waits until the messages are written
+    FORWARD_QUEUE_POLICY_DROP,  // The new message is dropped
+
+} FORWARD_QUEUE_POLICY;
+
+/**
+ * @brief Result of adding a message to the queue
+ *
+ */
+typedef enum _FORWARD_QUEUE_STATUS
+{
+    FORWARD_QUEUE_STATUS_QUEUED,
+    FORWARD_QUEUE_STATUS_FULL,
+    FORWARD_QUEUE_STATUS_DROPPED,
+
+} FORWARD_QUEUE_STATUS;
+
+/**
+ * @brief Counters of the messages of a queue
+ *
+ */
+typedef struct _FORWARD_QUEUE_STATISTICS
+{
+    UINT64 QueuedMessages;
+    UINT64 QueuedBytes;
+    UINT64 DroppedMessages;
+    UINT64 DroppedBytes;
+    UINT64 WrittenMessages;
+    UINT64 WrittenBytes;
+    UINT64 FailedMessages;  // Messages of the batches that are failed to be written
+    UINT64 Batches;         // Number of the batches (writes) that are taken
+    UINT32 MaximumUsedSize; // The most of the queue that was ever used
+
+} FORWARD_QUEUE_STATISTICS, *PFORWARD_QUEUE_STATISTICS;
+
+/**
+ * @brief A bounded queue of the messages of an output source
+ * @details The queue itself is not synchronized, the caller should hold a
+ * lock for adding the messages and taking the batches (but not for writing
+ * the batches)
+ *
+ */
+typedef struct _FORWARD_QUEUE
+{
+    UINT8 *              Buffer;       // Start address of the buffer
+    UINT32               Size;         // Size of the buffer
+    UINT32               ReadOffset;   // Offset of the oldest message
+    UINT32               UsedSize;     // Size of the queued messages (with their headers)
+    UINT32               MessageCount; // Number of the queued messages
+    FORWARD_QUEUE_POLICY Policy;
+
+    FORWARD_QUEUE_STATISTICS Statistics;
+
+} FORWARD_QUEUE, *PFORWARD_QUEUE;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+Messages are packed one after another (each one after its length) and both of
+them might wrap around the end of the buffer. The writer takes all of the
+queued messages at once, as a single batch of their bodies, and writes it out
+of the lock (so adding the messages never waits for a write unless the queue
+is full and the policy is to block).
+
+             _________________________
+            |                         |
+            |          (free)         |
+            |_________________________|  <-- ReadOffset
+            |          length         |
+            |_________________________|
+            |           body          |
+            |_________________________|
+            |          length         |
+            |_________________________|
+            |           body          |
+            |_________________________|  <-- ReadOffset + UsedSize
+            |                         |
+            |          (free)         |
+            |_________________________|
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+ForwardQueueInitialize(PFORWARD_QUEUE Queue, PVOID Buffer, UINT32 Size, FORWARD_QUEUE_POLICY Policy);
+
+BOOLEAN
+ForwardQueueIsEmpty(PFORWARD_QUEUE Queue);
+
+FORWARD_QUEUE_STATUS
+ForwardQueuePush(PFORWARD_QUEUE Queue, const VOID * Message, UINT32 MessageLength);
+
+UINT32
+ForwardQueueTakeBatch(PFORWARD_QUEUE Queue,
+                      PVOID          Batch,
+                      UINT32         BatchSize,
+                      UINT32 *       Lengths,
+                      UINT32         MaximumMessages,
+                      UINT32 *       MessageCount);
+
+VOID
+ForwardQueueCompleteBatch(PFORWARD_QUEUE Queue, UINT32 BatchLength, UINT32 MessageCount, BOOLEAN IsWritten);
@@ -0,0 +1,248 @@
+/**
+ * @file HashIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the open-addressing hash index
+ * @details Collisions are resolved by linear probing. The removed slots are
+ * only marked (tombstones) and the items are never moved, so a lookup that
+ * runs at the same time as a change never sees a half-written item. The
+ * tombstones are reused by the same key and all of them are released once
+ * the index is empty. This file doesn't use any platform-specific function,
+ * so it's used in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the home slot of a key
+ * @details The keys are mostly page-aligned addresses, so the bits are
+ * mixed before masking
+ *
+ * @param Index
+ * @param Key
+ *
+ * @return UINT32
+ */
+static UINT32
+HashIndexGetHomeSlot(PHASH_INDEX Index, UINT64 Key)
+{
+    Key = Key * 0x9E3779B97F4A7C15ull;
+    Key = Key ^ (Key >> 32);
+
+    return (UINT32)Key & (Index->Capacity - 1);
+}
+
+/**
+ * @brief Get the size of the storage that should be allocated for the index
+ *
+ * @param Capacity Number of slots (a power of two)
+ *
+ * @return UINT64
+ */
+UINT64
+HashIndexGetRequiredSize(UINT32 Capacity)
+{
+    return (UINT64)Capacity * sizeof(HASH_INDEX_SLOT);
+}
+
+/**
+ * @brief Initialize the index
+ *
+ * @param Index
+ * @param Storage A buffer with the size of HashIndexGetRequiredSize
+ * @param Capacity Number of slots (a power of two)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+HashIndexInitialize(PHASH_INDEX Index, PVOID Storage, UINT32 Capacity)
+{
+    memset(Index, 0, sizeof(HASH_INDEX));
+
+    if (Storage == NULL || Capacity < 2 || (Capacity & (Capacity - 1)) != 0)
+    {
+        return FALSE;
+    }
+
+    Index->Slots    = (PHASH_INDEX_SLOT)Storage;
+    Index->Capacity = Capacity;
+
+    HashIndexClear(Index);
+
+    return TRUE;
+}
+
+/**
+ * @brief Insert an item to the index
+ *
+ * @param Index
+ * @param Key
+ * @param Value Should not be NULL or HASH_INDEX_TOMBSTONE
+ *
+ * @return BOOLEAN FALSE if the index is full
+ */
+BOOLEAN
+HashIndexInsert(PHASH_INDEX Index, UINT64 Key, PVOID Value)
+{
+    UINT32 Slot;
+
+    if (Value == NULL || Value == HASH_INDEX_TOMBSTONE)
+    {
+        return FALSE;
+    }
+
+    Slot = HashIndexGetHomeSlot(Index, Key);
+
+    while (Index->Slots[Slot].Value != NULL)
+    {
+        //
+        // A removed slot of the same key is reused by only changing its value
+        //
+        if (Index->Slots[Slot].Value == HASH_INDEX_TOMBSTONE && Index->Slots[Slot].Key == Key)
+        {
+            Index->Slots[Slot].Value = Value;
+            Index->Count++;
+
+            return TRUE;
+        }
+
+        Slot = (Slot + 1) & (Index->Capacity - 1);
+    }
+
+    if ((UINT64)(Index->UsedCount + 1) * 100 > (UINT64)Index->Capacity * HASH_INDEX_MAXIMUM_LOAD_PERCENT)
+    {
+        return FALSE;
+    }
+
+    //
+    // The key should be written before the value (the slot is not used until
+    // its value is set)
+    //
+    Index->Slots[Slot].Key   = Key;
+    Index->Slots[Slot].Value = Value;
+
+    Index->Count++;
+    Index->UsedCount++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the values of a key
+ * @details The cursor should be zero for the first call, the next calls
+ * with the same cursor return the other values of the key
+ *
+ * @param Index
+ * @param Key
+ * @param Cursor Position of the search (or NULL to only get the first value)
+ *
+ * @return PVOID NULL if there is no other value
+ */
+PVOID
+HashIndexFind(PHASH_INDEX Index, UINT64 Key, UINT32 * Cursor)
+{
+    UINT32 Probe = Cursor == NULL ? 0 : *Cursor;
+    UINT32 Slot;
+    PVOID  Value;
+
+    Slot = (HashIndexGetHomeSlot(Index, Key) + Probe) & (Index->Capacity - 1);
+
+    //
+    // The cluster of the key ends with an empty slot (the index is never full)
+    //
+    for (; Probe < Index->Capacity; Probe++)
+    {
+        Value = Index->Slots[Slot].Value;
+
+        if (Value == NULL)
+        {
+            break;
+        }
+
+        if (Value != HASH_INDEX_TOMBSTONE && Index->Slots[Slot].Key == Key)
+        {
+            if (Cursor != NULL)
+            {
+                *Cursor = Probe + 1;
+            }
+
+            return Value;
+        }
+
+        Slot = (Slot + 1) & (Index->Capacity - 1);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Remove an item from the index
+ *
+ * @param Index
+ * @param Key
+ * @param Value
+ *
+ * @return BOOLEAN FALSE if the item was not found
+ */
+BOOLEAN
+HashIndexRemove(PHASH_INDEX Index, UINT64 Key, PVOID Value)
+{
+    UINT32 Slot;
+
+    if (Value == NULL || Value == HASH_INDEX_TOMBSTONE)
+    {
+        return FALSE;
+    }
+
+    Slot = HashIndexGetHomeSlot(Index, Key);
+
+    while (Index->Slots[Slot].Value != NULL)
+    {
+        if (Index->Slots[Slot].Value == Value && Index->Slots[Slot].Key == Key)
+        {
+            Index->Slots[Slot].Value = HASH_INDEX_TOMBSTONE;
+            Index->Count--;
+
+            //
+            // Release the tombstones if there is no other item
+            //
+            if (Index->Count == 0)
+            {
+                HashIndexClear(Index);
+            }
+
+            return TRUE;
+        }
+
+        Slot = (Slot + 1) & (Index->Capacity - 1);
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Remove all of the items (and the tombstones) of the index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+HashIndexClear(PHASH_INDEX Index)
+{
+    //
+    // Values are cleared one by one (not by memset), so a concurrent lookup
+    // never sees a partially cleared value
+    //
+    for (UINT32 i = 0; i < Index->Capacity; i++)
+    {
+        Index->Slots[i].Value = NULL;
+        Index->Slots[i].Key   = 0;
+    }
+
+    Index->Count     = 0;
+    Index->UsedCount = 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file HashIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the open-addressing hash index
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum load of the index (in percent), inserting more items fails
+ *
+ */
+#define HASH_INDEX_MAXIMUM_LOAD_PERCENT 75
+
+/**
+ * @brief Value of the removed slots
+ *
+ */
+#define HASH_INDEX_TOMBSTONE ((PVOID)(UINT64)-1)
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Each slot of the index
+ * @details A slot is empty if its value is NULL and it's removed if its
+ * value is HASH_INDEX_TOMBSTONE
+ *
+ */
+typedef struct _HASH_INDEX_SLOT
+{
+    volatile UINT64 Key;
+    PVOID volatile  Value;
+
+} HASH_INDEX_SLOT, *PHASH_INDEX_SLOT;
+
+/**
+ * @brief An open-addressing (linear probing) hash index from keys to values
+ * @details The same key might be inserted multiple times with different
+ * values, the storage is given by the caller so the index never allocates
+ * and can be used in vmx-root. The caller should serialize the changes, but
+ * the lookups might run at the same time as the changes (the key of a slot
+ * is written before its value and the items are never moved)
+ *
+ */
+typedef struct _HASH_INDEX
+{
+    PHASH_INDEX_SLOT Slots;     // Storage of the slots
+    UINT32           Capacity;  // Number of slots (a power of two)
+    UINT32           Count;     // Number of the items
+    UINT32           UsedCount; // Number of the items and the removed slots
+
+} HASH_INDEX, *PHASH_INDEX;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+HashIndexGetRequiredSize(UINT32 Capacity);
+
+BOOLEAN
+HashIndexInitialize(PHASH_INDEX Index, PVOID Storage, UINT32 Capacity);
+
+BOOLEAN
+HashIndexInsert(PHASH_INDEX Index, UINT64 Key, PVOID Value);
+
+PVOID
+HashIndexFind(PHASH_INDEX Index, UINT64 Key, UINT32 * Cursor);
+
+BOOLEAN
+HashIndexRemove(PHASH_INDEX Index, UINT64 Key, PVOID Value);
+
+VOID
+HashIndexClear(PHASH_INDEX Index);
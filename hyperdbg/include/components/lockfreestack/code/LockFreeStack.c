@@ -0,0 +1,100 @@
+/**
+ * @file LockFreeStack.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the lock-free (tagged) LIFO stack
+ * @details The top and a change counter (tag) are replaced together by a
+ * 16-byte compare and exchange, so pushes and pops from any core (including
+ * vmx-root) never wait for a lock. This file doesn't use any
+ * platform-specific function except the atomic operation in the header
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize the stack (empty)
+ *
+ * @param Stack
+ *
+ * @return VOID
+ */
+VOID
+LockFreeStackInitialize(PLOCK_FREE_STACK Stack)
+{
+    Stack->Top = NULL;
+    Stack->Tag = 0;
+}
+
+/**
+ * @brief Push an entry to the stack
+ *
+ * @param Stack
+ * @param Entry
+ *
+ * @return VOID
+ */
+VOID
+LockFreeStackPush(PLOCK_FREE_STACK Stack, PLOCK_FREE_STACK_ENTRY Entry)
+{
+    LOCK_FREE_STACK Snapshot;
+
+    do
+    {
+        //
+        // A torn snapshot is never equal to the head, so the exchange fails
+        //
+        Snapshot.Tag = Stack->Tag;
+        Snapshot.Top = Stack->Top;
+
+        Entry->Next = Snapshot.Top;
+
+    } while (!LockFreeStackCompareExchange(Stack, Entry, Snapshot.Tag + 1, &Snapshot));
+}
+
+/**
+ * @brief Pop the last pushed entry of the stack
+ *
+ * @param Stack
+ *
+ * @return PLOCK_FREE_STACK_ENTRY NULL if the stack is empty
+ */
+PLOCK_FREE_STACK_ENTRY
+LockFreeStackPop(PLOCK_FREE_STACK Stack)
+{
+    LOCK_FREE_STACK Snapshot;
+
+    do
+    {
+        Snapshot.Tag = Stack->Tag;
+        Snapshot.Top = Stack->Top;
+
+        if (Snapshot.Top == NULL)
+        {
+            return NULL;
+        }
+
+        //
+        // The top might be popped by another core after taking the snapshot,
+        // its next is still readable (entries are never freed) and the tag
+        // makes the exchange fail
+        //
+    } while (!LockFreeStackCompareExchange(Stack, Snapshot.Top->Next, Snapshot.Tag + 1, &Snapshot));
+
+    return Snapshot.Top;
+}
+
+/**
+ * @brief Check whether the stack is empty or not
+ *
+ * @param Stack
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+LockFreeStackIsEmpty(PLOCK_FREE_STACK Stack)
+{
+    return Stack->Top == NULL;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file LockFreeStack.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the lock-free (tagged) LIFO stack
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+//
+// The head of the stack (top and tag) is changed by a 16-byte compare
+// and exchange, so it should be aligned to 16 bytes
+//
+#ifdef _MSC_VER
+#    define LOCK_FREE_STACK_ALIGN __declspec(align(16))
+#    define LockFreeStackCompareExchange(Head, NewTop, NewTag, Comparand) \
+        (InterlockedCompareExchange128((volatile LONG64 *)(Head),         \
+                                       (LONG64)(NewTag),                  \
+                                       (LONG64)(NewTop),                  \
+                                       (LONG64 *)(Comparand)) != 0)
+#else
+#    define LOCK_FREE_STACK_ALIGN __attribute__((aligned(16)))
+#    define LockFreeStackCompareExchange(Head, NewTop, NewTag, Comparand)                                                \
+        __sync_bool_compare_and_swap((volatile unsigned __int128 *)(Head),                                               \
+                                     ((unsigned __int128)(Comparand)->Tag << 64) | (UINT64)(Comparand)->Top, \
+                                     ((unsigned __int128)(UINT64)(NewTag) << 64) | (UINT64)(NewTop))
+#endif // _MSC_VER
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Each entry of the stack (should be embedded in the items)
+ *
+ */
+typedef struct _LOCK_FREE_STACK_ENTRY
+{
+    struct _LOCK_FREE_STACK_ENTRY * volatile Next;
+
+} LOCK_FREE_STACK_ENTRY, *PLOCK_FREE_STACK_ENTRY;
+
+/**
+ * @brief A lock-free LIFO stack
+ * @details The tag is incremented by each change, so a pop never succeeds if
+ * the top was popped and pushed again in the meantime (ABA). The popped
+ * entries might still be read by a concurrent pop, so their memory should
+ * remain valid (the entries are reused instead of being freed)
+ *
+ */
+typedef struct LOCK_FREE_STACK_ALIGN _LOCK_FREE_STACK
+{
+    PLOCK_FREE_STACK_ENTRY volatile Top; // The last pushed entry
+    volatile UINT64                 Tag; // Number of the changes
+
+} LOCK_FREE_STACK, *PLOCK_FREE_STACK;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+LockFreeStackInitialize(PLOCK_FREE_STACK Stack);
+
+VOID
+LockFreeStackPush(PLOCK_FREE_STACK Stack, PLOCK_FREE_STACK_ENTRY Entry);
+
+PLOCK_FREE_STACK_ENTRY
+LockFreeStackPop(PLOCK_FREE_STACK Stack);
+
+BOOLEAN
+LockFreeStackIsEmpty(PLOCK_FREE_STACK Stack);
@@ -0,0 +1,122 @@
+/**
+ * @file LogBatch.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the batched message format (kernel to user-mode)
+ * @details The writer reads the body of each message directly into the
+ * batch (LogBatchGetRecordBody) and then commits its header, the reader
+ * walks the records in place. This file doesn't use any platform-specific
+ * function, so it's used in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the maximum length of a body that fits in the batch
+ *
+ * @param BatchSize Size of the buffer of the batch
+ * @param Offset Offset of the next record
+ *
+ * @return UINT32
+ */
+UINT32
+LogBatchGetAvailableLength(UINT32 BatchSize, UINT32 Offset)
+{
+    UINT32 Overhead = sizeof(LOG_BATCH_RECORD_HEADER) + 1;
+
+    //
+    // The records are aligned, so the padding of the last record should also
+    // fit in the batch
+    //
+    BatchSize = BatchSize & ~(LOG_BATCH_RECORD_ALIGNMENT - 1);
+
+    if (Offset > BatchSize || BatchSize - Offset <= Overhead)
+    {
+        return 0;
+    }
+
+    return BatchSize - Offset - Overhead;
+}
+
+/**
+ * @brief Get the address of the body of the next record
+ *
+ * @param Batch
+ * @param Offset Offset of the next record
+ *
+ * @return PVOID
+ */
+PVOID
+LogBatchGetRecordBody(PVOID Batch, UINT32 Offset)
+{
+    return (UINT8 *)Batch + Offset + sizeof(LOG_BATCH_RECORD_HEADER);
+}
+
+/**
+ * @brief Commit a record whose body is already written to the batch
+ *
+ * @param Batch
+ * @param Offset Offset of the record
+ * @param OperationCode
+ * @param BufferLength Length of the body
+ *
+ * @return UINT32 Offset of the next record (the length of the batch)
+ */
+UINT32
+LogBatchCommitRecord(PVOID Batch, UINT32 Offset, UINT32 OperationCode, UINT32 BufferLength)
+{
+    PLOG_BATCH_RECORD_HEADER Header = (PLOG_BATCH_RECORD_HEADER)((UINT8 *)Batch + Offset);
+
+    Header->BufferLength  = BufferLength;
+    Header->OperationCode = OperationCode;
+
+    ((UINT8 *)LogBatchGetRecordBody(Batch, Offset))[BufferLength] = 0;
+
+    return Offset + (UINT32)LOG_BATCH_RECORD_SIZE(BufferLength);
+}
+
+/**
+ * @brief Read the next record of a batch (in place)
+ *
+ * @param Batch
+ * @param BatchLength Length of the batch (the returned length)
+ * @param Offset Offset of the record, updated to the offset of the next record
+ * @param OperationCode
+ * @param Buffer Address of the (null-terminated) body in the batch
+ * @param BufferLength Length of the body
+ *
+ * @return BOOLEAN FALSE if there is no other (valid) record
+ */
+BOOLEAN
+LogBatchReadRecord(PVOID    Batch,
+                   UINT32   BatchLength,
+                   UINT32 * Offset,
+                   UINT32 * OperationCode,
+                   PVOID *  Buffer,
+                   UINT32 * BufferLength)
+{
+    PLOG_BATCH_RECORD_HEADER Header;
+
+    if (*Offset >= BatchLength || BatchLength - *Offset < sizeof(LOG_BATCH_RECORD_HEADER))
+    {
+        return FALSE;
+    }
+
+    Header = (PLOG_BATCH_RECORD_HEADER)((UINT8 *)Batch + *Offset);
+
+    if (Header->BufferLength > LogBatchGetAvailableLength(BatchLength, *Offset))
+    {
+        return FALSE;
+    }
+
+    *OperationCode = Header->OperationCode;
+    *BufferLength  = Header->BufferLength;
+    *Buffer        = LogBatchGetRecordBody(Batch, *Offset);
+
+    *Offset = *Offset + (UINT32)LOG_BATCH_RECORD_SIZE(Header->BufferLength);
+
+    return TRUE;
+}
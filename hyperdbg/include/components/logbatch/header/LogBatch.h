@@ -0,0 +1,99 @@
+/**
+ * @file LogBatch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the batched message format (kernel to user-mode)
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Alignment of the records in a batch
+ *
+ */
+#define LOG_BATCH_RECORD_ALIGNMENT 8
+
+/**
+ * @brief Size of a record (header + body + null-terminator, aligned) that
+ * holds a buffer with the specified length
+ *
+ */
+#define LOG_BATCH_RECORD_SIZE(BufferLength)                                                      \
+    ((sizeof(LOG_BATCH_RECORD_HEADER) + (BufferLength) + 1 + LOG_BATCH_RECORD_ALIGNMENT - 1) & \
+     ~((UINT64)LOG_BATCH_RECORD_ALIGNMENT - 1))
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of each message in a batch
+ * @details The body is right after the header and it's followed by a
+ * null-terminator, so the string messages can be used in place. The
+ * operation code is placed right before the body, the same as the single
+ * message format
+ *
+ */
+typedef struct _LOG_BATCH_RECORD_HEADER
+{
+    UINT32 BufferLength;  // The actual length of the body
+    UINT32 OperationCode; // Operation ID to user-mode
+
+} LOG_BATCH_RECORD_HEADER, *PLOG_BATCH_RECORD_HEADER;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+  A batch is a sequence of records, the length of the batch is the returned
+  length of the IOCTL
+
+             _________________________
+            |      BufferLength       |
+            |      OperationCode      |
+            |_________________________|
+            |                         |
+            |          BODY           |
+            |  (BufferLength bytes)   |
+            |_________________________|
+            |   null-terminator and   |
+            |  padding to 8 bytes     |
+            |_________________________|
+            |      BufferLength       |
+            |      OperationCode      |
+            |_________________________|
+            |           .             |
+            |           .             |
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT32
+LogBatchGetAvailableLength(UINT32 BatchSize, UINT32 Offset);
+
+PVOID
+LogBatchGetRecordBody(PVOID Batch, UINT32 Offset);
+
+UINT32
+LogBatchCommitRecord(PVOID Batch, UINT32 Offset, UINT32 OperationCode, UINT32 BufferLength);
+
+BOOLEAN
+LogBatchReadRecord(PVOID    Batch,
+                   UINT32   BatchLength,
+                   UINT32 * Offset,
+                   UINT32 * OperationCode,
+                   PVOID *  Buffer,
+                   UINT32 * BufferLength);
@@ -0,0 +1,364 @@
+/**
+ * @file MemorySearch.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the multi-pattern memory search engine
+ * @details A single byte of each pattern (the anchor) is compared with a
+ * whole vector of the buffer (SSE2 or AVX2), the results of all patterns
+ * are merged and the whole patterns are only compared at the candidates.
+ * The patterns might have masked (wildcard) bytes. This file doesn't use
+ * any platform-specific function except the vector intrinsics, so it's used
+ * in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the rank of a byte as an anchor (lower is better)
+ * @details The anchor is compared with every byte of the memory, so the
+ * bytes that fill the memory (zeros, paddings and nops) make a lot of
+ * false candidates
+ *
+ * @param Value
+ *
+ * @return UINT32
+ */
+static UINT32
+MemorySearchGetAnchorRank(UINT8 Value)
+{
+    switch (Value)
+    {
+    case 0x00:
+        return 3;
+    case 0xff:
+        return 2;
+    case 0xcc:
+    case 0x90:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Compare a pattern with the buffer
+ *
+ * @param Buffer
+ * @param Pattern
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+MemorySearchCompare(const UINT8 * Buffer, PMEMORY_SEARCH_PATTERN Pattern)
+{
+    if (Pattern->Mask == NULL)
+    {
+        return memcmp(Buffer, Pattern->Bytes, Pattern->Length) == 0;
+    }
+
+    for (UINT32 i = 0; i < Pattern->Length; i++)
+    {
+        if (((Buffer[i] ^ Pattern->Bytes[i]) & Pattern->Mask[i]) != 0)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check all of the patterns at a position of the buffer
+ *
+ * @param Search
+ * @param Buffer
+ * @param Length
+ * @param Position
+ * @param BaseOffset
+ * @param Callback
+ * @param Context
+ *
+ * @return BOOLEAN FALSE if the callback stopped the search
+ */
+static BOOLEAN
+MemorySearchCheckPosition(PMEMORY_SEARCH         Search,
+                          const UINT8 *          Buffer,
+                          UINT64                 Length,
+                          UINT64                 Position,
+                          UINT64                 BaseOffset,
+                          MEMORY_SEARCH_CALLBACK Callback,
+                          PVOID                  Context)
+{
+    if (Search->Stride > 1 && (BaseOffset + Position) % Search->Stride != 0)
+    {
+        return TRUE;
+    }
+
+    for (UINT32 i = 0; i < Search->PatternCount; i++)
+    {
+        PMEMORY_SEARCH_PATTERN Pattern = &Search->Patterns[i];
+
+        if (Position + Pattern->Length > Length)
+        {
+            continue;
+        }
+
+        if (Search->AnchorOffsets[i] != MEMORY_SEARCH_NO_ANCHOR &&
+            Buffer[Position + Search->AnchorOffsets[i]] != Search->AnchorBytes[i])
+        {
+            continue;
+        }
+
+        if (MemorySearchCompare(Buffer + Position, Pattern) && !Callback(Context, i, BaseOffset + Position))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+#if MEMORY_SEARCH_VECTOR_SIZE != 0
+
+/**
+ * @brief Get the candidates of a vector of positions
+ * @details The anchor of each pattern is loaded from its offset, so the
+ * bytes up to the largest anchor offset after the vector should be readable
+ *
+ * @param Search
+ * @param Buffer Start of the vector
+ *
+ * @return UINT32 A bit for each candidate position
+ */
+static UINT32
+MemorySearchFilterVector(PMEMORY_SEARCH Search, const UINT8 * Buffer)
+{
+#    if MEMORY_SEARCH_VECTOR_SIZE == 32
+
+    __m256i Result = _mm256_setzero_si256();
+
+    for (UINT32 i = 0; i < Search->PatternCount; i++)
+    {
+        __m256i Data = _mm256_loadu_si256((const __m256i *)(Buffer + Search->AnchorOffsets[i]));
+
+        Result = _mm256_or_si256(Result, _mm256_cmpeq_epi8(Data, _mm256_set1_epi8((char)Search->AnchorBytes[i])));
+    }
+
+    return (UINT32)_mm256_movemask_epi8(Result);
+
+#    else
+
+    __m128i Result = _mm_setzero_si128();
+
+    for (UINT32 i = 0; i < Search->PatternCount; i++)
+    {
+        __m128i Data = _mm_loadu_si128((const __m128i *)(Buffer + Search->AnchorOffsets[i]));
+
+        Result = _mm_or_si128(Result, _mm_cmpeq_epi8(Data, _mm_set1_epi8((char)Search->AnchorBytes[i])));
+    }
+
+    return (UINT32)_mm_movemask_epi8(Result);
+
+#    endif
+}
+
+/**
+ * @brief Get the index of the lowest set bit
+ *
+ * @param Bits Should not be zero
+ *
+ * @return UINT32
+ */
+static UINT32
+MemorySearchGetLowestBit(UINT32 Bits)
+{
+#    ifdef _MSC_VER
+    unsigned long Index;
+
+    _BitScanForward(&Index, Bits);
+
+    return (UINT32)Index;
+#    else
+    return (UINT32)__builtin_ctz(Bits);
+#    endif
+}
+
+#endif // MEMORY_SEARCH_VECTOR_SIZE != 0
+
+/**
+ * @brief Initialize a search
+ *
+ * @param Search
+ * @param Patterns The patterns (their bytes and masks should remain valid
+ * during the search)
+ * @param PatternCount
+ * @param Stride Matches are only reported at the multiples of the stride
+ * (1 for all positions)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+MemorySearchInitialize(PMEMORY_SEARCH Search, PMEMORY_SEARCH_PATTERN Patterns, UINT32 PatternCount, UINT32 Stride)
+{
+    memset(Search, 0, sizeof(MEMORY_SEARCH));
+
+    if (PatternCount == 0 || PatternCount > MEMORY_SEARCH_MAXIMUM_PATTERNS || Stride == 0)
+    {
+        return FALSE;
+    }
+
+    Search->PatternCount   = PatternCount;
+    Search->Stride         = Stride;
+    Search->IsFilterUsable = TRUE;
+
+    for (UINT32 i = 0; i < PatternCount; i++)
+    {
+        UINT32 BestRank = (UINT32)-1;
+
+        if (Patterns[i].Bytes == NULL || Patterns[i].Length == 0)
+        {
+            return FALSE;
+        }
+
+        Search->Patterns[i]      = Patterns[i];
+        Search->AnchorOffsets[i] = MEMORY_SEARCH_NO_ANCHOR;
+
+        if (Patterns[i].Length > Search->MaximumLength)
+        {
+            Search->MaximumLength = Patterns[i].Length;
+        }
+
+        //
+        // The anchor is the rarest byte that is fully compared
+        //
+        for (UINT32 j = 0; j < Patterns[i].Length; j++)
+        {
+            if (Patterns[i].Mask != NULL && Patterns[i].Mask[j] != 0xff)
+            {
+                continue;
+            }
+
+            if (MemorySearchGetAnchorRank(Patterns[i].Bytes[j]) < BestRank)
+            {
+                BestRank                 = MemorySearchGetAnchorRank(Patterns[i].Bytes[j]);
+                Search->AnchorOffsets[i] = j;
+                Search->AnchorBytes[i]   = Patterns[i].Bytes[j];
+            }
+        }
+
+        if (Search->AnchorOffsets[i] == MEMORY_SEARCH_NO_ANCHOR)
+        {
+            //
+            // Every position is a candidate of this pattern
+            //
+            Search->IsFilterUsable = FALSE;
+        }
+        else if (Search->AnchorOffsets[i] > Search->MaximumAnchorOffset)
+        {
+            Search->MaximumAnchorOffset = Search->AnchorOffsets[i];
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Search the patterns in a buffer
+ * @details The positions before ScanLength are checked and a pattern only
+ * matches if it fits in the buffer. A large memory is searched in chunks
+ * by keeping the last (MaximumLength - 1) bytes of each chunk (that are not
+ * scanned) at the start of the next chunk
+ *
+ * @param Search
+ * @param Buffer
+ * @param Length Length of the buffer
+ * @param ScanLength Number of the positions that are checked
+ * @param BaseOffset Offset of the buffer, the matches are reported (and
+ * aligned to the stride) based on this offset
+ * @param Callback Called for each match
+ * @param Context Passed to the callback
+ *
+ * @return BOOLEAN FALSE if the callback stopped the search
+ */
+BOOLEAN
+MemorySearchBuffer(PMEMORY_SEARCH         Search,
+                   const UINT8 *          Buffer,
+                   UINT64                 Length,
+                   UINT64                 ScanLength,
+                   UINT64                 BaseOffset,
+                   MEMORY_SEARCH_CALLBACK Callback,
+                   PVOID                  Context)
+{
+    UINT64 Position = 0;
+
+    if (ScanLength > Length)
+    {
+        ScanLength = Length;
+    }
+
+#if MEMORY_SEARCH_VECTOR_SIZE != 0
+
+    if (Search->IsFilterUsable)
+    {
+        UINT64 StrideBits = 0;
+
+        //
+        // Positions that are not aligned to the stride are removed from the
+        // candidates (if the stride fits in a vector)
+        //
+        if (Search->Stride > 1 && Search->Stride <= MEMORY_SEARCH_VECTOR_SIZE &&
+            (Search->Stride & (Search->Stride - 1)) == 0)
+        {
+            for (UINT32 i = 0; i < MEMORY_SEARCH_VECTOR_SIZE; i += Search->Stride)
+            {
+                StrideBits |= 1ull << i;
+            }
+        }
+
+        while (Position + MEMORY_SEARCH_VECTOR_SIZE <= ScanLength &&
+               Position + Search->MaximumAnchorOffset + MEMORY_SEARCH_VECTOR_SIZE <= Length)
+        {
+            UINT32 Bits = MemorySearchFilterVector(Search, Buffer + Position);
+
+            if (StrideBits != 0)
+            {
+                UINT32 Phase = (UINT32)((BaseOffset + Position) & (Search->Stride - 1));
+
+                Bits &= (UINT32)(StrideBits << ((Search->Stride - Phase) & (Search->Stride - 1)));
+            }
+
+            while (Bits != 0)
+            {
+                UINT64 Candidate = Position + MemorySearchGetLowestBit(Bits);
+
+                Bits &= Bits - 1;
+
+                if (!MemorySearchCheckPosition(Search, Buffer, Length, Candidate, BaseOffset, Callback, Context))
+                {
+                    return FALSE;
+                }
+            }
+
+            Position += MEMORY_SEARCH_VECTOR_SIZE;
+        }
+    }
+
+#endif // MEMORY_SEARCH_VECTOR_SIZE != 0
+
+    //
+    // The rest of the positions (or all of them if there is a pattern
+    // without any anchor) are checked one by one
+    //
+    for (; Position < ScanLength; Position++)
+    {
+        if (!MemorySearchCheckPosition(Search, Buffer, Length, Position, BaseOffset, Callback, Context))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
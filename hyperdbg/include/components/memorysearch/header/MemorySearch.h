@@ -0,0 +1,102 @@
+/**
+ * @file MemorySearch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the multi-pattern memory search engine
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of the patterns that are searched in a single pass
+ *
+ */
+#define MEMORY_SEARCH_MAXIMUM_PATTERNS 8
+
+/**
+ * @brief Anchor offset of the patterns that don't have any fully compared byte
+ *
+ */
+#define MEMORY_SEARCH_NO_ANCHOR ((UINT32)-1)
+
+//
+// Width of the first-byte filter (AVX2 is only used if the module is built
+// for it, the kernel modules are built for SSE2)
+//
+#if defined(__AVX2__)
+#    define MEMORY_SEARCH_VECTOR_SIZE 32
+#elif defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#    define MEMORY_SEARCH_VECTOR_SIZE 16
+#else
+#    define MEMORY_SEARCH_VECTOR_SIZE 0
+#endif
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A byte pattern
+ * @details Each byte of the mask selects the compared bits of the same byte
+ * of the pattern (0xff compares the whole byte and 0x00 is a wildcard), a
+ * NULL mask compares all of the bytes
+ *
+ */
+typedef struct _MEMORY_SEARCH_PATTERN
+{
+    const UINT8 * Bytes;
+    const UINT8 * Mask;
+    UINT32        Length;
+
+} MEMORY_SEARCH_PATTERN, *PMEMORY_SEARCH_PATTERN;
+
+/**
+ * @brief Callback of the matches
+ *
+ * @return BOOLEAN FALSE stops the search
+ */
+typedef BOOLEAN (*MEMORY_SEARCH_CALLBACK)(PVOID Context, UINT32 PatternIndex, UINT64 Offset);
+
+/**
+ * @brief State of a search
+ * @details The candidates are found by comparing a single (anchor) byte of
+ * each pattern with a whole vector of the buffer, then the whole pattern is
+ * compared only at the candidates
+ *
+ */
+typedef struct _MEMORY_SEARCH
+{
+    MEMORY_SEARCH_PATTERN Patterns[MEMORY_SEARCH_MAXIMUM_PATTERNS];
+    UINT32                AnchorOffsets[MEMORY_SEARCH_MAXIMUM_PATTERNS]; // Offset of the anchor byte in each pattern
+    UINT8                 AnchorBytes[MEMORY_SEARCH_MAXIMUM_PATTERNS];   // Value of the anchor byte of each pattern
+    UINT32                PatternCount;
+    UINT32                MaximumLength;       // Length of the longest pattern
+    UINT32                MaximumAnchorOffset; // Largest anchor offset
+    UINT32                Stride;              // Matches are only at the multiples of the stride
+    BOOLEAN               IsFilterUsable;      // FALSE if a pattern doesn't have any anchor byte
+
+} MEMORY_SEARCH, *PMEMORY_SEARCH;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+MemorySearchInitialize(PMEMORY_SEARCH Search, PMEMORY_SEARCH_PATTERN Patterns, UINT32 PatternCount, UINT32 Stride);
+
+BOOLEAN
+MemorySearchBuffer(PMEMORY_SEARCH         Search,
+                   const UINT8 *          Buffer,
+                   UINT64                 Length,
+                   UINT64                 ScanLength,
+                   UINT64                 BaseOffset,
+                   MEMORY_SEARCH_CALLBACK Callback,
+                   PVOID                  Context);
@@ -0,0 +1,336 @@
+/**
+ * @file ModuleTable.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of comparing the tables of the modules and scheduling their jobs
+ * @details Reloading the symbols only processes the modules that are changed
+ * since the previous table (e.g., a loaded driver), and the jobs of these
+ * modules (building the indexes of their PDB files) are divided between the
+ * workers. Nothing here touches the modules themselves, so this file is
+ * tested with fake tables
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Compare two items of a sort
+ *
+ */
+typedef INT32 (*MODULE_TABLE_COMPARE)(const VOID * Context, UINT32 First, UINT32 Second);
+
+/**
+ * @brief Compare two modules (by their base addresses, sizes, and identities)
+ *
+ * @param Context The modules
+ * @param First
+ * @param Second
+ *
+ * @return INT32
+ */
+static INT32
+ModuleTableCompareModules(const VOID * Context, UINT32 First, UINT32 Second)
+{
+    const MODULE_TABLE_ENTRY * Modules = (const MODULE_TABLE_ENTRY *)Context;
+
+    if (Modules[First].BaseAddress != Modules[Second].BaseAddress)
+    {
+        return Modules[First].BaseAddress < Modules[Second].BaseAddress ? -1 : 1;
+    }
+
+    if (Modules[First].Size != Modules[Second].Size)
+    {
+        return Modules[First].Size < Modules[Second].Size ? -1 : 1;
+    }
+
+    if (Modules[First].Identity != Modules[Second].Identity)
+    {
+        return Modules[First].Identity < Modules[Second].Identity ? -1 : 1;
+    }
+
+    return First < Second ? -1 : (First > Second ? 1 : 0);
+}
+
+/**
+ * @brief Compare two jobs (the costly jobs are first)
+ *
+ * @param Context The costs of the jobs
+ * @param First
+ * @param Second
+ *
+ * @return INT32
+ */
+static INT32
+ModuleTableCompareJobs(const VOID * Context, UINT32 First, UINT32 Second)
+{
+    const UINT64 * Costs = (const UINT64 *)Context;
+
+    if (Costs[First] != Costs[Second])
+    {
+        return Costs[First] > Costs[Second] ? -1 : 1;
+    }
+
+    return First < Second ? -1 : (First > Second ? 1 : 0);
+}
+
+/**
+ * @brief Move down an item of the heap
+ *
+ * @param Ids
+ * @param Index
+ * @param Count
+ * @param Compare
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+ModuleTableSiftDown(UINT32 * Ids, UINT32 Index, UINT32 Count, MODULE_TABLE_COMPARE Compare, const VOID * Context)
+{
+    UINT32 Temp;
+    UINT32 Child;
+
+    while ((UINT64)Index * 2 + 1 < Count)
+    {
+        Child = Index * 2 + 1;
+
+        if (Child + 1 < Count && Compare(Context, Ids[Child], Ids[Child + 1]) < 0)
+        {
+            Child++;
+        }
+
+        if (Compare(Context, Ids[Index], Ids[Child]) >= 0)
+        {
+            return;
+        }
+
+        Temp       = Ids[Index];
+        Ids[Index] = Ids[Child];
+        Ids[Child] = Temp;
+
+        Index = Child;
+    }
+}
+
+/**
+ * @brief Sort the ids of the items (heap sort, as the items are needed for
+ * comparing)
+ *
+ * @param Ids
+ * @param Count
+ * @param Compare
+ * @param Context
+ *
+ * @return VOID
+ */
+static VOID
+ModuleTableSort(UINT32 * Ids, UINT32 Count, MODULE_TABLE_COMPARE Compare, const VOID * Context)
+{
+    UINT32 Temp;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Ids[i] = i;
+    }
+
+    for (UINT32 i = Count / 2; i > 0; i--)
+    {
+        ModuleTableSiftDown(Ids, i - 1, Count, Compare, Context);
+    }
+
+    for (UINT32 i = Count; i > 1; i--)
+    {
+        Temp       = Ids[0];
+        Ids[0]     = Ids[i - 1];
+        Ids[i - 1] = Temp;
+
+        ModuleTableSiftDown(Ids, 0, i - 1, Compare, Context);
+    }
+}
+
+/**
+ * @brief Add a string to the identity of a module
+ * @details The strings are case-insensitive (like the paths of Windows), and
+ * more strings could be added to the same identity
+ *
+ * @param Identity The identity (or MODULE_TABLE_IDENTITY_SEED)
+ * @param String
+ *
+ * @return UINT64 The new identity
+ */
+UINT64
+ModuleTableHashString(UINT64 Identity, const CHAR * String)
+{
+    UINT8 Ch;
+
+    while ((Ch = (UINT8)*String++) != 0)
+    {
+        if (Ch >= 'A' && Ch <= 'Z')
+        {
+            Ch = (UINT8)(Ch + ('a' - 'A'));
+        }
+
+        Identity = (Identity ^ Ch) * 0x100000001b3ull;
+    }
+
+    //
+    // Separate the strings (so "ab" + "c" is not the same as "a" + "bc")
+    //
+    return (Identity ^ 0xff) * 0x100000001b3ull;
+}
+
+/**
+ * @brief Get the size of the storage that is needed for comparing two tables
+ *
+ * @param OldCount
+ * @param NewCount
+ * @param StorageSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ModuleTableGetRequiredSize(UINT32 OldCount, UINT32 NewCount, UINT64 * StorageSize)
+{
+    *StorageSize = ((UINT64)OldCount + NewCount) * sizeof(UINT32);
+
+    return TRUE;
+}
+
+/**
+ * @brief Compare the previous table of the modules with the new one
+ * @details Both of the tables are sorted (as ids) and merged, so it takes
+ * O(n log n) for any order of the modules. The same module that is loaded
+ * more than once is matched one to one
+ *
+ * @param OldModules
+ * @param OldCount
+ * @param NewModules
+ * @param NewCount
+ * @param Storage
+ * @param StorageSize
+ * @param OldToNew The index of each old module in the new table (or
+ * MODULE_TABLE_NO_MODULE if it's removed)
+ * @param NewToOld The index of each new module in the old table (or
+ * MODULE_TABLE_NO_MODULE if it's added)
+ *
+ * @return BOOLEAN FALSE if the storage is not enough
+ */
+BOOLEAN
+ModuleTableCompare(const MODULE_TABLE_ENTRY * OldModules,
+                   UINT32                     OldCount,
+                   const MODULE_TABLE_ENTRY * NewModules,
+                   UINT32                     NewCount,
+                   PVOID                      Storage,
+                   UINT64                     StorageSize,
+                   UINT32 *                   OldToNew,
+                   UINT32 *                   NewToOld)
+{
+    UINT64                     RequiredSize;
+    UINT32 *                   OldIds      = (UINT32 *)Storage;
+    UINT32 *                   NewIds      = OldIds + OldCount;
+    UINT32                     OldPosition = 0;
+    UINT32                     NewPosition = 0;
+    const MODULE_TABLE_ENTRY * Old;
+    const MODULE_TABLE_ENTRY * New;
+
+    if (!ModuleTableGetRequiredSize(OldCount, NewCount, &RequiredSize) || StorageSize < RequiredSize)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < OldCount; i++)
+    {
+        OldToNew[i] = MODULE_TABLE_NO_MODULE;
+    }
+
+    for (UINT32 i = 0; i < NewCount; i++)
+    {
+        NewToOld[i] = MODULE_TABLE_NO_MODULE;
+    }
+
+    ModuleTableSort(OldIds, OldCount, ModuleTableCompareModules, OldModules);
+    ModuleTableSort(NewIds, NewCount, ModuleTableCompareModules, NewModules);
+
+    while (OldPosition < OldCount && NewPosition < NewCount)
+    {
+        Old = &OldModules[OldIds[OldPosition]];
+        New = &NewModules[NewIds[NewPosition]];
+
+        if (Old->BaseAddress == New->BaseAddress && Old->Size == New->Size && Old->Identity == New->Identity)
+        {
+            OldToNew[OldIds[OldPosition]] = NewIds[NewPosition];
+            NewToOld[NewIds[NewPosition]] = OldIds[OldPosition];
+
+            OldPosition++;
+            NewPosition++;
+        }
+        else if (Old->BaseAddress < New->BaseAddress ||
+                 (Old->BaseAddress == New->BaseAddress &&
+                  (Old->Size < New->Size || (Old->Size == New->Size && Old->Identity < New->Identity))))
+        {
+            OldPosition++;
+        }
+        else
+        {
+            NewPosition++;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Divide the jobs between the workers
+ * @details The costly jobs are given first, each to the worker with the least
+ * work (so the last worker finishes at most 4/3 of the best time). Each
+ * worker does its jobs in the given order
+ *
+ * @param Costs The cost of each job (e.g., the size of its file)
+ * @param JobCount
+ * @param WorkerCount
+ * @param Order The jobs, the costly ones first
+ * @param Workers The worker of each job
+ *
+ * @return BOOLEAN FALSE if the number of the workers is not valid
+ */
+BOOLEAN
+ModuleTableSchedule(const UINT64 * Costs,
+                    UINT32         JobCount,
+                    UINT32         WorkerCount,
+                    UINT32 *       Order,
+                    UINT32 *       Workers)
+{
+    UINT64 Loads[MODULE_TABLE_MAXIMUM_WORKERS] = {0};
+    UINT32 Worker;
+
+    if (WorkerCount == 0 || WorkerCount > MODULE_TABLE_MAXIMUM_WORKERS)
+    {
+        return FALSE;
+    }
+
+    ModuleTableSort(Order, JobCount, ModuleTableCompareJobs, Costs);
+
+    for (UINT32 i = 0; i < JobCount; i++)
+    {
+        Worker = 0;
+
+        for (UINT32 j = 1; j < WorkerCount; j++)
+        {
+            if (Loads[j] < Loads[Worker])
+            {
+                Worker = j;
+            }
+        }
+
+        //
+        // A job costs at least one (so the empty files are divided too)
+        //
+        Loads[Worker] += Costs[Order[i]] + 1;
+
+        Workers[Order[i]] = Worker;
+    }
+
+    return TRUE;
+}
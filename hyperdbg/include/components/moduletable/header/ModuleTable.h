@@ -0,0 +1,80 @@
+/**
+ * @file ModuleTable.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of comparing the tables of the modules and scheduling their jobs
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief The initial value of the identities of the modules
+ *
+ */
+#define MODULE_TABLE_IDENTITY_SEED 0xcbf29ce484222325ull
+
+/**
+ * @brief Maximum number of the workers of the jobs
+ *
+ */
+#define MODULE_TABLE_MAXIMUM_WORKERS 64
+
+/**
+ * @brief A module that is not in the other table
+ *
+ */
+#define MODULE_TABLE_NO_MODULE 0xffffffff
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A module of a table
+ * @details Two modules are the same if all of the fields are the same. The
+ * identity is a hash of whatever identifies the image of the module (e.g.,
+ * its path, or the GUID and the age of its PDB file)
+ *
+ */
+typedef struct _MODULE_TABLE_ENTRY
+{
+    UINT64 BaseAddress;
+    UINT64 Size;
+    UINT64 Identity;
+
+} MODULE_TABLE_ENTRY, *PMODULE_TABLE_ENTRY;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+ModuleTableHashString(UINT64 Identity, const CHAR * String);
+
+BOOLEAN
+ModuleTableGetRequiredSize(UINT32 OldCount, UINT32 NewCount, UINT64 * StorageSize);
+
+BOOLEAN
+ModuleTableCompare(const MODULE_TABLE_ENTRY * OldModules,
+                   UINT32                     OldCount,
+                   const MODULE_TABLE_ENTRY * NewModules,
+                   UINT32                     NewCount,
+                   PVOID                      Storage,
+                   UINT64                     StorageSize,
+                   UINT32 *                   OldToNew,
+                   UINT32 *                   NewToOld);
+
+BOOLEAN
+ModuleTableSchedule(const UINT64 * Costs,
+                    UINT32         JobCount,
+                    UINT32         WorkerCount,
+                    UINT32 *       Order,
+                    UINT32 *       Workers);
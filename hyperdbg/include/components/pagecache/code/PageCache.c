@@ -0,0 +1,399 @@
+/**
+ * @file PageCache.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the cache of the pages of a remote memory
+ * @details The debugger reads the memory of a halted debuggee many times
+ * (e.g., disassembling and walking the structures), so the pages are kept
+ * here until the debuggee continues or its memory is changed. The remote
+ * memory is only accessed through a callback, so this file is tested
+ * without a debuggee
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the bucket of a page
+ *
+ * @param AddressSpace
+ * @param PageAddress
+ *
+ * @return UINT32
+ */
+static UINT32
+PageCacheGetBucket(UINT64 AddressSpace, UINT64 PageAddress)
+{
+    UINT64 Hash = (PageAddress / PAGE_CACHE_PAGE_SIZE) ^ (AddressSpace * 0x9e3779b97f4a7c15ull);
+
+    Hash ^= Hash >> 29;
+
+    return (UINT32)(Hash & (PAGE_CACHE_BUCKET_COUNT - 1));
+}
+
+/**
+ * @brief Find a page in the cache
+ *
+ * @param Cache
+ * @param AddressSpace
+ * @param PageAddress
+ *
+ * @return PPAGE_CACHE_ENTRY NULL if the page is not cached
+ */
+static PPAGE_CACHE_ENTRY
+PageCacheLookup(PPAGE_CACHE Cache, UINT64 AddressSpace, UINT64 PageAddress)
+{
+    UINT32 Index = Cache->Buckets[PageCacheGetBucket(AddressSpace, PageAddress)];
+
+    while (Index != PAGE_CACHE_NO_ENTRY)
+    {
+        PPAGE_CACHE_ENTRY Entry = &Cache->Entries[Index];
+
+        if (Entry->PageAddress == PageAddress && Entry->AddressSpace == AddressSpace)
+        {
+            return Entry;
+        }
+
+        Index = Entry->Next;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Remove the least recently used page from the cache
+ *
+ * @param Cache
+ *
+ * @return UINT32 Index of the removed entry
+ */
+static UINT32
+PageCacheEvict(PPAGE_CACHE Cache)
+{
+    UINT32   Victim = 0;
+    UINT32 * Link;
+
+    for (UINT32 i = 1; i < Cache->EntryCount; i++)
+    {
+        if (Cache->Entries[i].LastUse < Cache->Entries[Victim].LastUse)
+        {
+            Victim = i;
+        }
+    }
+
+    //
+    // Unlink it from its bucket
+    //
+    Link = &Cache->Buckets[PageCacheGetBucket(Cache->Entries[Victim].AddressSpace,
+                                              Cache->Entries[Victim].PageAddress)];
+
+    while (*Link != Victim)
+    {
+        Link = &Cache->Entries[*Link].Next;
+    }
+
+    *Link = Cache->Entries[Victim].Next;
+
+    return Victim;
+}
+
+/**
+ * @brief Add a page to the cache
+ *
+ * @param Cache
+ * @param AddressSpace
+ * @param PageAddress
+ * @param Data
+ * @param Attributes
+ *
+ * @return VOID
+ */
+static VOID
+PageCacheInsert(PPAGE_CACHE Cache, UINT64 AddressSpace, UINT64 PageAddress, const UINT8 * Data, UINT32 Attributes)
+{
+    PPAGE_CACHE_ENTRY Entry;
+    UINT32            Index;
+    UINT32            Bucket;
+
+    if (Cache->EntryCount < PAGE_CACHE_ENTRY_COUNT)
+    {
+        Index = Cache->EntryCount++;
+    }
+    else
+    {
+        Index = PageCacheEvict(Cache);
+    }
+
+    Bucket = PageCacheGetBucket(AddressSpace, PageAddress);
+    Entry  = &Cache->Entries[Index];
+
+    Entry->AddressSpace = AddressSpace;
+    Entry->PageAddress  = PageAddress;
+    Entry->LastUse      = ++Cache->Clock;
+    Entry->Attributes   = Attributes;
+    Entry->Next         = Cache->Buckets[Bucket];
+
+    memcpy(Entry->Data, Data, PAGE_CACHE_PAGE_SIZE);
+
+    Cache->Buckets[Bucket] = Index;
+}
+
+/**
+ * @brief Read the pages (and the prefetched pages) from the remote memory
+ * @details The remote memory is read as a whole, so if the prefetched pages
+ * are not accessible, only the requested pages are read again
+ *
+ * @param Cache
+ * @param Context
+ * @param AddressSpace
+ * @param PageAddress
+ * @param PageCount
+ * @param PrefetchPages
+ * @param Attributes
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PageCacheFill(PPAGE_CACHE Cache,
+              PVOID       Context,
+              UINT64      AddressSpace,
+              UINT64      PageAddress,
+              UINT32      PageCount,
+              UINT32      PrefetchPages,
+              UINT32 *    Attributes)
+{
+    Cache->Statistics.Reads++;
+
+    if (PrefetchPages != 0)
+    {
+        if (Cache->ReadPages(Context, AddressSpace, PageAddress, PageCount + PrefetchPages, Cache->ReadBuffer, Attributes))
+        {
+            Cache->Statistics.PrefetchedPages += PrefetchPages;
+            PageCount += PrefetchPages;
+
+            goto Insert;
+        }
+
+        Cache->Statistics.FailedPrefetches++;
+        Cache->Statistics.Reads++;
+    }
+
+    if (!Cache->ReadPages(Context, AddressSpace, PageAddress, PageCount, Cache->ReadBuffer, Attributes))
+    {
+        return FALSE;
+    }
+
+Insert:
+    for (UINT32 i = 0; i < PageCount; i++)
+    {
+        PageCacheInsert(Cache,
+                        AddressSpace,
+                        PageAddress + (UINT64)i * PAGE_CACHE_PAGE_SIZE,
+                        &Cache->ReadBuffer[i * PAGE_CACHE_PAGE_SIZE],
+                        *Attributes);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Copy the requested part of a page
+ *
+ * @param Data
+ * @param PageAddress
+ * @param Address The requested address
+ * @param Size The requested size
+ * @param Buffer The requested buffer
+ *
+ * @return VOID
+ */
+static VOID
+PageCacheCopy(const UINT8 * Data, UINT64 PageAddress, UINT64 Address, UINT32 Size, UINT8 * Buffer)
+{
+    UINT64 Start = PageAddress > Address ? PageAddress : Address;
+    UINT64 End   = PageAddress + PAGE_CACHE_PAGE_SIZE - 1;
+
+    if (End > Address + Size - 1)
+    {
+        End = Address + Size - 1;
+    }
+
+    memcpy(&Buffer[Start - Address], &Data[Start - PageAddress], (size_t)(End - Start + 1));
+}
+
+/**
+ * @brief Initialize a cache
+ *
+ * @param Cache
+ * @param ReadPages The callback for reading the remote memory
+ * @param PrefetchPages Number of the pages that are read after the
+ * requested pages (if they're not cached)
+ *
+ * @return VOID
+ */
+VOID
+PageCacheInitialize(PPAGE_CACHE Cache, PAGE_CACHE_READ_PAGES ReadPages, UINT32 PrefetchPages)
+{
+    Cache->ReadPages     = ReadPages;
+    Cache->PrefetchPages = PrefetchPages;
+    Cache->EntryCount    = 0;
+    Cache->Clock         = 0;
+
+    memset(&Cache->Statistics, 0, sizeof(PAGE_CACHE_STATISTICS));
+    memset(Cache->Buckets, 0xff, sizeof(Cache->Buckets));
+}
+
+/**
+ * @brief Remove all of the pages from the cache
+ * @details Should be called whenever the remote memory (or the address
+ * spaces) might be changed
+ *
+ * @param Cache
+ *
+ * @return VOID
+ */
+VOID
+PageCacheInvalidate(PPAGE_CACHE Cache)
+{
+    if (Cache->EntryCount == 0)
+    {
+        return;
+    }
+
+    Cache->EntryCount = 0;
+    Cache->Statistics.Invalidations++;
+
+    memset(Cache->Buckets, 0xff, sizeof(Cache->Buckets));
+}
+
+/**
+ * @brief Read the remote memory through the cache
+ * @details The pages that are not cached are read as contiguous runs (the
+ * prefetched pages are added to the last run), the read fails if any of
+ * the pages is not accessible
+ *
+ * @param Cache
+ * @param Context Passed to the callback
+ * @param AddressSpace
+ * @param Address
+ * @param Buffer
+ * @param Size
+ * @param Attributes Attributes of the first page (optional)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PageCacheRead(PPAGE_CACHE Cache,
+              PVOID       Context,
+              UINT64      AddressSpace,
+              UINT64      Address,
+              PVOID       Buffer,
+              UINT32      Size,
+              UINT32 *    Attributes)
+{
+    PPAGE_CACHE_ENTRY Entry;
+    UINT64            PageAddress;
+    UINT64            LastPageAddress;
+    UINT64            NextPageAddress;
+    UINT32            PageCount;
+    UINT32            PrefetchPages;
+    UINT32            ReadAttributes = 0;
+    BOOLEAN           IsFirstPage    = TRUE;
+
+    if (Size == 0)
+    {
+        return TRUE;
+    }
+
+    if (Address + Size - 1 < Address)
+    {
+        return FALSE;
+    }
+
+    PageAddress     = Address & ~((UINT64)PAGE_CACHE_PAGE_SIZE - 1);
+    LastPageAddress = (Address + Size - 1) & ~((UINT64)PAGE_CACHE_PAGE_SIZE - 1);
+
+    while (TRUE)
+    {
+        Entry = PageCacheLookup(Cache, AddressSpace, PageAddress);
+
+        if (Entry != NULL)
+        {
+            Cache->Statistics.Hits++;
+            Entry->LastUse = ++Cache->Clock;
+
+            PageCacheCopy(Entry->Data, PageAddress, Address, Size, (UINT8 *)Buffer);
+            ReadAttributes = Entry->Attributes;
+
+            PageCount = 1;
+        }
+        else
+        {
+            //
+            // Find the run of the pages that are not cached
+            //
+            PageCount = 1;
+
+            while (PageCount < PAGE_CACHE_MAXIMUM_PAGES_PER_READ &&
+                   LastPageAddress - PageAddress >= (UINT64)PageCount * PAGE_CACHE_PAGE_SIZE &&
+                   PageCacheLookup(Cache, AddressSpace, PageAddress + (UINT64)PageCount * PAGE_CACHE_PAGE_SIZE) == NULL)
+            {
+                PageCount++;
+            }
+
+            //
+            // The adjacent pages are prefetched after the last page
+            //
+            PrefetchPages = 0;
+
+            if (LastPageAddress - PageAddress < (UINT64)PageCount * PAGE_CACHE_PAGE_SIZE)
+            {
+                while (PrefetchPages < Cache->PrefetchPages && PageCount + PrefetchPages < PAGE_CACHE_MAXIMUM_PAGES_PER_READ)
+                {
+                    NextPageAddress = PageAddress + (UINT64)(PageCount + PrefetchPages) * PAGE_CACHE_PAGE_SIZE;
+
+                    if (NextPageAddress < PageAddress || PageCacheLookup(Cache, AddressSpace, NextPageAddress) != NULL)
+                    {
+                        break;
+                    }
+
+                    PrefetchPages++;
+                }
+            }
+
+            if (!PageCacheFill(Cache, Context, AddressSpace, PageAddress, PageCount, PrefetchPages, &ReadAttributes))
+            {
+                return FALSE;
+            }
+
+            Cache->Statistics.Misses += PageCount;
+
+            for (UINT32 i = 0; i < PageCount; i++)
+            {
+                PageCacheCopy(&Cache->ReadBuffer[i * PAGE_CACHE_PAGE_SIZE],
+                              PageAddress + (UINT64)i * PAGE_CACHE_PAGE_SIZE,
+                              Address,
+                              Size,
+                              (UINT8 *)Buffer);
+            }
+        }
+
+        if (IsFirstPage && Attributes != NULL)
+        {
+            *Attributes = ReadAttributes;
+        }
+
+        IsFirstPage = FALSE;
+
+        if (LastPageAddress - PageAddress < (UINT64)PageCount * PAGE_CACHE_PAGE_SIZE)
+        {
+            break;
+        }
+
+        PageAddress += (UINT64)PageCount * PAGE_CACHE_PAGE_SIZE;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file PageCache.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the cache of the pages of a remote memory
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the cached pages
+ *
+ */
+#define PAGE_CACHE_PAGE_SIZE 0x1000
+
+/**
+ * @brief Number of the pages that are kept in a cache
+ *
+ */
+#define PAGE_CACHE_ENTRY_COUNT 256
+
+/**
+ * @brief Number of the buckets of the cache (a power of two)
+ *
+ */
+#define PAGE_CACHE_BUCKET_COUNT 512
+
+/**
+ * @brief Maximum number of the pages that are read from the remote memory
+ * at once (should fit in a packet)
+ *
+ */
+#define PAGE_CACHE_MAXIMUM_PAGES_PER_READ 16
+
+/**
+ * @brief Index of an empty bucket (or the end of a bucket)
+ *
+ */
+#define PAGE_CACHE_NO_ENTRY 0xffffffff
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback for reading the pages from the remote memory
+ * @details The address is page aligned, all of the pages should be read
+ * (otherwise FALSE is returned). The attributes (e.g., the mode of the
+ * address) are kept along with the pages
+ *
+ * @return BOOLEAN
+ */
+typedef BOOLEAN (*PAGE_CACHE_READ_PAGES)(PVOID    Context,
+                                         UINT64   AddressSpace,
+                                         UINT64   Address,
+                                         UINT32   PageCount,
+                                         UINT8 *  Buffer,
+                                         UINT32 * Attributes);
+
+/**
+ * @brief A cached page
+ *
+ */
+typedef struct _PAGE_CACHE_ENTRY
+{
+    UINT64 AddressSpace;
+    UINT64 PageAddress;
+    UINT64 LastUse;
+    UINT32 Next; // Next entry of the bucket
+    UINT32 Attributes;
+    UINT8  Data[PAGE_CACHE_PAGE_SIZE];
+
+} PAGE_CACHE_ENTRY, *PPAGE_CACHE_ENTRY;
+
+/**
+ * @brief Statistics of a cache
+ *
+ */
+typedef struct _PAGE_CACHE_STATISTICS
+{
+    UINT64 Hits;             // Pages that are found in the cache
+    UINT64 Misses;           // Pages that are read from the remote memory
+    UINT64 Reads;            // Reads from the remote memory (round trips)
+    UINT64 PrefetchedPages;  // Pages that are read before they're requested
+    UINT64 FailedPrefetches; // Reads that are repeated without the prefetched pages
+    UINT64 Invalidations;
+
+} PAGE_CACHE_STATISTICS, *PPAGE_CACHE_STATISTICS;
+
+/**
+ * @brief A cache of the pages of a remote memory
+ * @details The pages are keyed by their address space (e.g., the type of
+ * the memory and the process) and their address, the least recently used
+ * page is replaced when the cache is full
+ *
+ */
+typedef struct _PAGE_CACHE
+{
+    PAGE_CACHE_READ_PAGES ReadPages;
+    UINT32                PrefetchPages; // Pages that are read after the requested pages
+    UINT32                EntryCount;
+    UINT64                Clock;
+    PAGE_CACHE_STATISTICS Statistics;
+    UINT32                Buckets[PAGE_CACHE_BUCKET_COUNT];
+    PAGE_CACHE_ENTRY      Entries[PAGE_CACHE_ENTRY_COUNT];
+    UINT8                 ReadBuffer[PAGE_CACHE_MAXIMUM_PAGES_PER_READ * PAGE_CACHE_PAGE_SIZE];
+
+} PAGE_CACHE, *PPAGE_CACHE;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+PageCacheInitialize(PPAGE_CACHE Cache, PAGE_CACHE_READ_PAGES ReadPages, UINT32 PrefetchPages);
+
+VOID
+PageCacheInvalidate(PPAGE_CACHE Cache);
+
+BOOLEAN
+PageCacheRead(PPAGE_CACHE Cache,
+              PVOID       Context,
+              UINT64      AddressSpace,
+              UINT64      Address,
+              PVOID       Buffer,
+              UINT32      Size,
+              UINT32 *    Attributes);
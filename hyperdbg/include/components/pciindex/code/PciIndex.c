@@ -0,0 +1,834 @@
+/**
+ * @file PciIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the binary index of the PCI ID database
+ * @details The text database (pci.ids) is compiled once into an index with
+ * the sorted tables of the vendors, devices, and subsystems, and a pool of
+ * the (interned) names. The index is cached next to the database, and the
+ * names of the devices are found by binary searches in the mapped index
+ * instead of parsing the database. This file doesn't use any
+ * platform-specific function, so it's used in both the kernel and the
+ * user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Parse an ID of the database (four hexadecimal digits followed by
+ * a space or a tab)
+ *
+ * @param Line
+ * @param Length
+ * @param Id
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PciIndexParseId(const CHAR * Line, UINT32 Length, UINT16 * Id)
+{
+    UINT32 Value = 0;
+
+    if (Length < 5 || (Line[4] != ' ' && Line[4] != '\t'))
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < 4; i++)
+    {
+        CHAR Ch = Line[i];
+
+        if (Ch >= '0' && Ch <= '9')
+        {
+            Value = (Value << 4) | (UINT32)(Ch - '0');
+        }
+        else if (Ch >= 'a' && Ch <= 'f')
+        {
+            Value = (Value << 4) | (UINT32)(Ch - 'a' + 10);
+        }
+        else if (Ch >= 'A' && Ch <= 'F')
+        {
+            Value = (Value << 4) | (UINT32)(Ch - 'A' + 10);
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    *Id = (UINT16)Value;
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the name after the IDs of a line (without the whitespaces
+ * around it)
+ *
+ * @param Line The line after the IDs
+ * @param Length
+ * @param NameLength
+ *
+ * @return const CHAR *
+ */
+static const CHAR *
+PciIndexParseName(const CHAR * Line, UINT32 Length, UINT32 * NameLength)
+{
+    while (Length != 0 && (*Line == ' ' || *Line == '\t'))
+    {
+        Line++;
+        Length--;
+    }
+
+    while (Length != 0 && (Line[Length - 1] == ' ' || Line[Length - 1] == '\t'))
+    {
+        Length--;
+    }
+
+    *NameLength = Length;
+
+    return Line;
+}
+
+/**
+ * @brief Hash a name for interning it
+ *
+ * @param Name
+ * @param Length
+ *
+ * @return UINT32
+ */
+static UINT32
+PciIndexHashName(const CHAR * Name, UINT32 Length)
+{
+    UINT32 Hash = 0x811c9dc5;
+
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Hash = (Hash ^ (UINT8)Name[i]) * 0x01000193;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Add a name to the strings (or find the same name in the strings)
+ *
+ * @param Builder
+ * @param Name
+ * @param Length
+ *
+ * @return UINT32 Offset of the name in the strings
+ */
+static UINT32
+PciIndexAddName(PPCI_INDEX_BUILDER Builder, const CHAR * Name, UINT32 Length)
+{
+    UINT32       Bucket = PciIndexHashName(Name, Length) & (Builder->StringBucketCount - 1);
+    UINT32       Offset;
+    const CHAR * String;
+    UINT32       i;
+
+    //
+    // The buckets are at most half full, so there is always an empty bucket
+    // (the offsets in the buckets are plus one)
+    //
+    for (; Builder->StringBuckets[Bucket] != 0; Bucket = (Bucket + 1) & (Builder->StringBucketCount - 1))
+    {
+        String = &Builder->Strings[Builder->StringBuckets[Bucket] - 1];
+
+        for (i = 0; i < Length && String[i] == Name[i]; i++)
+            ;
+
+        if (i == Length && String[i] == '\0')
+        {
+            return Builder->StringBuckets[Bucket] - 1;
+        }
+    }
+
+    Offset = (UINT32)Builder->StringsSize;
+
+    memcpy(&Builder->Strings[Offset], Name, Length);
+    Builder->Strings[Offset + Length] = '\0';
+
+    Builder->StringsSize += Length + 1;
+    Builder->StringBuckets[Bucket] = Offset + 1;
+
+    return Offset;
+}
+
+/**
+ * @brief Add the entries of the database (or count them if the builder
+ * doesn't have an index)
+ * @details The vendors are the lines without indentation, the devices of
+ * the last vendor are indented by a tab, and the subsystems of the last
+ * device are indented by two tabs. The entries after the other top-level
+ * lines (e.g., the classes at the end of the database) are ignored
+ *
+ * @param Builder
+ * @param Text
+ * @param TextSize
+ *
+ * @return BOOLEAN FALSE if the database is changed after counting it
+ */
+static BOOLEAN
+PciIndexAddEntries(PPCI_INDEX_BUILDER Builder, const CHAR * Text, UINT64 TextSize)
+{
+    UINT64                Offset    = 0;
+    BOOLEAN               HasVendor = FALSE;
+    BOOLEAN               HasDevice = FALSE;
+    const CHAR *          Line;
+    const CHAR *          Name;
+    UINT32                Length;
+    UINT32                NameLength;
+    UINT16                Id;
+    UINT16                SubId;
+    PCI_INDEX_VENDOR *    Vendor;
+    PCI_INDEX_DEVICE *    Device;
+    PCI_INDEX_SUBDEVICE * SubDevice;
+
+    Builder->VendorCount    = 0;
+    Builder->DeviceCount    = 0;
+    Builder->SubDeviceCount = 0;
+    Builder->StringsSize    = 1; // The empty string
+
+    while (Offset < TextSize)
+    {
+        Line   = &Text[Offset];
+        Length = 0;
+
+        while (Offset < TextSize && Text[Offset] != '\n')
+        {
+            Offset++;
+            Length++;
+        }
+
+        Offset++;
+
+        if (Length != 0 && Line[Length - 1] == '\r')
+        {
+            Length--;
+        }
+
+        if (Length == 0 || Line[0] == '#')
+        {
+            continue;
+        }
+
+        if (Line[0] != '\t')
+        {
+            HasDevice = FALSE;
+            HasVendor = PciIndexParseId(Line, Length, &Id);
+
+            if (!HasVendor)
+            {
+                continue;
+            }
+
+            Name = PciIndexParseName(Line + 4, Length - 4, &NameLength);
+
+            if (Builder->Header != NULL)
+            {
+                if (Builder->VendorCount >= Builder->Header->VendorCount)
+                {
+                    return FALSE;
+                }
+
+                Vendor              = &Builder->Vendors[Builder->VendorCount];
+                Vendor->VendorId    = Id;
+                Vendor->Reserved    = 0;
+                Vendor->NameOffset  = PciIndexAddName(Builder, Name, NameLength);
+                Vendor->FirstDevice = Builder->DeviceCount;
+                Vendor->DeviceCount = 0;
+            }
+            else
+            {
+                Builder->StringsSize += NameLength + 1;
+            }
+
+            Builder->VendorCount++;
+        }
+        else if (Length == 1 || Line[1] != '\t')
+        {
+            HasDevice = HasVendor && PciIndexParseId(Line + 1, Length - 1, &Id);
+
+            if (!HasDevice)
+            {
+                continue;
+            }
+
+            Name = PciIndexParseName(Line + 5, Length - 5, &NameLength);
+
+            if (Builder->Header != NULL)
+            {
+                if (Builder->DeviceCount >= Builder->Header->DeviceCount)
+                {
+                    return FALSE;
+                }
+
+                Device                 = &Builder->Devices[Builder->DeviceCount];
+                Device->DeviceId       = Id;
+                Device->Reserved       = 0;
+                Device->NameOffset     = PciIndexAddName(Builder, Name, NameLength);
+                Device->FirstSubDevice = Builder->SubDeviceCount;
+                Device->SubDeviceCount = 0;
+
+                Builder->Vendors[Builder->VendorCount - 1].DeviceCount++;
+            }
+            else
+            {
+                Builder->StringsSize += NameLength + 1;
+            }
+
+            Builder->DeviceCount++;
+        }
+        else
+        {
+            if (!HasDevice ||
+                !PciIndexParseId(Line + 2, Length - 2, &Id) ||
+                !PciIndexParseId(Line + 7, Length - 7, &SubId))
+            {
+                continue;
+            }
+
+            Name = PciIndexParseName(Line + 11, Length - 11, &NameLength);
+
+            if (Builder->Header != NULL)
+            {
+                if (Builder->SubDeviceCount >= Builder->Header->SubDeviceCount)
+                {
+                    return FALSE;
+                }
+
+                SubDevice              = &Builder->SubDevices[Builder->SubDeviceCount];
+                SubDevice->SubVendorId = Id;
+                SubDevice->SubDeviceId = SubId;
+                SubDevice->NameOffset  = PciIndexAddName(Builder, Name, NameLength);
+
+                Builder->Devices[Builder->DeviceCount - 1].SubDeviceCount++;
+            }
+            else
+            {
+                Builder->StringsSize += NameLength + 1;
+            }
+
+            Builder->SubDeviceCount++;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the key of sorting an entry (vendors, devices, or subsystems)
+ *
+ * @param Entry
+ * @param IsSubDevice
+ *
+ * @return UINT32
+ */
+static UINT32
+PciIndexGetKey(const VOID * Entry, BOOLEAN IsSubDevice)
+{
+    const UINT16 * Ids = (const UINT16 *)Entry;
+
+    return IsSubDevice ? ((UINT32)Ids[0] << 16) | Ids[1] : Ids[0];
+}
+
+/**
+ * @brief Sort the entries by their IDs
+ * @details The database is already (almost) sorted, so the insertion sort
+ * is linear, and it's stable (the first one of the entries with the same
+ * IDs is found first like parsing the database)
+ *
+ * @param Entries
+ * @param Count
+ * @param EntrySize The size of the entries (at most 16 bytes)
+ * @param IsSubDevice
+ *
+ * @return VOID
+ */
+static VOID
+PciIndexSortEntries(VOID * Entries, UINT32 Count, UINT32 EntrySize, BOOLEAN IsSubDevice)
+{
+    UINT8 * Bytes = (UINT8 *)Entries;
+    UINT8   Entry[16];
+    UINT32  Key;
+    UINT32  j;
+
+    for (UINT32 i = 1; i < Count; i++)
+    {
+        Key = PciIndexGetKey(&Bytes[i * EntrySize], IsSubDevice);
+
+        if (PciIndexGetKey(&Bytes[(i - 1) * EntrySize], IsSubDevice) <= Key)
+        {
+            continue;
+        }
+
+        memcpy(Entry, &Bytes[i * EntrySize], EntrySize);
+
+        for (j = i; j != 0 && PciIndexGetKey(&Bytes[(j - 1) * EntrySize], IsSubDevice) > Key; j--)
+            ;
+
+        memmove(&Bytes[(j + 1) * EntrySize], &Bytes[j * EntrySize], (i - j) * EntrySize);
+        memcpy(&Bytes[j * EntrySize], Entry, EntrySize);
+    }
+}
+
+/**
+ * @brief Compute the layout of an index
+ *
+ * @param Builder The counted entries
+ * @param Header The header of the index (only the offsets are set)
+ * @param StringBucketCount
+ * @param IndexSize The size of the index (with the buckets of interning)
+ *
+ * @return BOOLEAN FALSE if the index is too large
+ */
+static BOOLEAN
+PciIndexGetLayout(PPCI_INDEX_BUILDER Builder, PPCI_INDEX_HEADER Header, UINT32 * StringBucketCount, UINT32 * IndexSize)
+{
+    UINT64 NameCount = (UINT64)Builder->VendorCount + Builder->DeviceCount + Builder->SubDeviceCount;
+    UINT64 StringsEnd;
+    UINT64 Size;
+
+    *StringBucketCount = 1;
+
+    while (*StringBucketCount < NameCount * 2 && *StringBucketCount < 0x40000000)
+    {
+        *StringBucketCount *= 2;
+    }
+
+    Header->VendorsOffset    = sizeof(PCI_INDEX_HEADER);
+    Header->DevicesOffset    = Header->VendorsOffset + Builder->VendorCount * (UINT32)sizeof(PCI_INDEX_VENDOR);
+    Header->SubDevicesOffset = Header->DevicesOffset + Builder->DeviceCount * (UINT32)sizeof(PCI_INDEX_DEVICE);
+    Header->StringsOffset    = Header->SubDevicesOffset + Builder->SubDeviceCount * (UINT32)sizeof(PCI_INDEX_SUBDEVICE);
+
+    StringsEnd = (Header->StringsOffset + Builder->StringsSize + sizeof(UINT32) - 1) & ~(UINT64)(sizeof(UINT32) - 1);
+    Size       = StringsEnd + (UINT64)*StringBucketCount * sizeof(UINT32);
+
+    if (Size > 0xffffffff)
+    {
+        return FALSE;
+    }
+
+    *IndexSize = (UINT32)Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Hash the database (the index is rebuilt if the database is changed)
+ * @details The database is hashed on each load of the index, so it's hashed
+ * by 8-byte words (FNV-1a of the words). Each step is a bijection of the
+ * hash, so changing any word of the database changes the hash
+ *
+ * @param Text
+ * @param TextSize
+ *
+ * @return UINT64
+ */
+UINT64
+PciIndexHashText(const CHAR * Text, UINT64 TextSize)
+{
+    UINT64 Hash = 0xcbf29ce484222325 ^ TextSize;
+    UINT64 Word;
+    UINT64 i;
+
+    for (i = 0; i + sizeof(UINT64) <= TextSize; i += sizeof(UINT64))
+    {
+        memcpy(&Word, &Text[i], sizeof(UINT64));
+
+        Hash = (Hash ^ Word) * 0x100000001b3;
+    }
+
+    for (; i < TextSize; i++)
+    {
+        Hash = (Hash ^ (UINT8)Text[i]) * 0x100000001b3;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Get the size of the buffer of building the index of a database
+ *
+ * @param Text The database
+ * @param TextSize
+ * @param IndexSize
+ *
+ * @return BOOLEAN FALSE if the database is too large
+ */
+BOOLEAN
+PciIndexGetRequiredSize(const CHAR * Text, UINT64 TextSize, UINT32 * IndexSize)
+{
+    PCI_INDEX_BUILDER Builder;
+    PCI_INDEX_HEADER  Header;
+    UINT32            StringBucketCount;
+
+    if (TextSize > PCI_INDEX_MAXIMUM_TEXT_SIZE)
+    {
+        return FALSE;
+    }
+
+    Builder.Header = NULL;
+
+    PciIndexAddEntries(&Builder, Text, TextSize);
+
+    return PciIndexGetLayout(&Builder, &Header, &StringBucketCount, IndexSize);
+}
+
+/**
+ * @brief Build the index of a database
+ * @details The built index is smaller than the buffer (the buckets of
+ * interning the names are not a part of it), its size is the total size
+ * in its header
+ *
+ * @param Text The database
+ * @param TextSize
+ * @param Index The buffer of building the index
+ * @param IndexSize The size of the buffer (from PciIndexGetRequiredSize)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PciIndexBuild(const CHAR * Text, UINT64 TextSize, VOID * Index, UINT32 IndexSize)
+{
+    PCI_INDEX_BUILDER Builder;
+    PPCI_INDEX_HEADER Header = (PPCI_INDEX_HEADER)Index;
+    UINT32            StringBucketCount;
+    UINT32            RequiredSize;
+
+    if (TextSize > PCI_INDEX_MAXIMUM_TEXT_SIZE)
+    {
+        return FALSE;
+    }
+
+    //
+    // Count the entries for the layout of the index
+    //
+    Builder.Header = NULL;
+
+    PciIndexAddEntries(&Builder, Text, TextSize);
+
+    if (IndexSize < sizeof(PCI_INDEX_HEADER) ||
+        !PciIndexGetLayout(&Builder, Header, &StringBucketCount, &RequiredSize) ||
+        IndexSize < RequiredSize)
+    {
+        return FALSE;
+    }
+
+    Header->Magic          = PCI_INDEX_MAGIC;
+    Header->Version        = PCI_INDEX_VERSION;
+    Header->TextHash       = PciIndexHashText(Text, TextSize);
+    Header->TextSize       = TextSize;
+    Header->VendorCount    = Builder.VendorCount;
+    Header->DeviceCount    = Builder.DeviceCount;
+    Header->SubDeviceCount = Builder.SubDeviceCount;
+    Header->Reserved       = 0;
+
+    //
+    // Add the entries and intern their names
+    //
+    Builder.Header            = Header;
+    Builder.Vendors           = (PCI_INDEX_VENDOR *)((UINT8 *)Index + Header->VendorsOffset);
+    Builder.Devices           = (PCI_INDEX_DEVICE *)((UINT8 *)Index + Header->DevicesOffset);
+    Builder.SubDevices        = (PCI_INDEX_SUBDEVICE *)((UINT8 *)Index + Header->SubDevicesOffset);
+    Builder.Strings           = (CHAR *)Index + Header->StringsOffset;
+    Builder.StringBuckets     = (UINT32 *)((UINT8 *)Index + RequiredSize - StringBucketCount * sizeof(UINT32));
+    Builder.StringBucketCount = StringBucketCount;
+
+    memset(Builder.StringBuckets, 0, StringBucketCount * sizeof(UINT32));
+
+    Builder.Strings[0] = '\0';
+
+    if (!PciIndexAddEntries(&Builder, Text, TextSize) ||
+        Builder.VendorCount != Header->VendorCount ||
+        Builder.DeviceCount != Header->DeviceCount ||
+        Builder.SubDeviceCount != Header->SubDeviceCount)
+    {
+        return FALSE;
+    }
+
+    Header->StringsSize = (UINT32)Builder.StringsSize;
+    Header->TotalSize   = Header->StringsOffset + Header->StringsSize;
+
+    //
+    // Sort the vendors, the devices of each vendor, and the subsystems of
+    // each device (the devices and the subsystems are not moved out of
+    // their ranges, so the ranges remain valid)
+    //
+    PciIndexSortEntries(Builder.Vendors, Builder.VendorCount, sizeof(PCI_INDEX_VENDOR), FALSE);
+
+    for (UINT32 i = 0; i < Builder.VendorCount; i++)
+    {
+        PciIndexSortEntries(&Builder.Devices[Builder.Vendors[i].FirstDevice],
+                            Builder.Vendors[i].DeviceCount,
+                            sizeof(PCI_INDEX_DEVICE),
+                            FALSE);
+    }
+
+    for (UINT32 i = 0; i < Builder.DeviceCount; i++)
+    {
+        PciIndexSortEntries(&Builder.SubDevices[Builder.Devices[i].FirstSubDevice],
+                            Builder.Devices[i].SubDeviceCount,
+                            sizeof(PCI_INDEX_SUBDEVICE),
+                            TRUE);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check an index (e.g., an index that is read from a file)
+ * @details All of the offsets, the ranges, and the orders are checked, so
+ * a corrupted index file (or an index of another database) is rebuilt
+ * instead of being used
+ *
+ * @param Index
+ * @param IndexSize
+ * @param TextHash The hash of the database
+ * @param TextSize The size of the database
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PciIndexValidate(const VOID * Index, UINT64 IndexSize, UINT64 TextHash, UINT64 TextSize)
+{
+    const PCI_INDEX_HEADER *    Header = (const PCI_INDEX_HEADER *)Index;
+    const PCI_INDEX_VENDOR *    Vendors;
+    const PCI_INDEX_DEVICE *    Devices;
+    const PCI_INDEX_SUBDEVICE * SubDevices;
+    const CHAR *                Strings;
+
+    if (IndexSize < sizeof(PCI_INDEX_HEADER) ||
+        Header->Magic != PCI_INDEX_MAGIC ||
+        Header->Version != PCI_INDEX_VERSION ||
+        Header->TotalSize > IndexSize ||
+        Header->TextHash != TextHash ||
+        Header->TextSize != TextSize)
+    {
+        return FALSE;
+    }
+
+    if (Header->VendorsOffset < sizeof(PCI_INDEX_HEADER) ||
+        Header->VendorsOffset % sizeof(UINT32) != 0 ||
+        Header->DevicesOffset % sizeof(UINT32) != 0 ||
+        Header->SubDevicesOffset % sizeof(UINT32) != 0 ||
+        Header->VendorsOffset + (UINT64)Header->VendorCount * sizeof(PCI_INDEX_VENDOR) > Header->TotalSize ||
+        Header->DevicesOffset + (UINT64)Header->DeviceCount * sizeof(PCI_INDEX_DEVICE) > Header->TotalSize ||
+        Header->SubDevicesOffset + (UINT64)Header->SubDeviceCount * sizeof(PCI_INDEX_SUBDEVICE) > Header->TotalSize ||
+        Header->StringsOffset + (UINT64)Header->StringsSize > Header->TotalSize ||
+        Header->StringsSize == 0)
+    {
+        return FALSE;
+    }
+
+    Vendors    = (const PCI_INDEX_VENDOR *)((const UINT8 *)Index + Header->VendorsOffset);
+    Devices    = (const PCI_INDEX_DEVICE *)((const UINT8 *)Index + Header->DevicesOffset);
+    SubDevices = (const PCI_INDEX_SUBDEVICE *)((const UINT8 *)Index + Header->SubDevicesOffset);
+    Strings    = (const CHAR *)Index + Header->StringsOffset;
+
+    if (Strings[Header->StringsSize - 1] != '\0')
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Header->VendorCount; i++)
+    {
+        if (Vendors[i].NameOffset >= Header->StringsSize ||
+            Vendors[i].FirstDevice + (UINT64)Vendors[i].DeviceCount > Header->DeviceCount ||
+            (i != 0 && Vendors[i].VendorId < Vendors[i - 1].VendorId))
+        {
+            return FALSE;
+        }
+
+        for (UINT32 j = 1; j < Vendors[i].DeviceCount; j++)
+        {
+            if (Devices[Vendors[i].FirstDevice + j].DeviceId < Devices[Vendors[i].FirstDevice + j - 1].DeviceId)
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->DeviceCount; i++)
+    {
+        if (Devices[i].NameOffset >= Header->StringsSize ||
+            Devices[i].FirstSubDevice + (UINT64)Devices[i].SubDeviceCount > Header->SubDeviceCount)
+        {
+            return FALSE;
+        }
+
+        for (UINT32 j = 1; j < Devices[i].SubDeviceCount; j++)
+        {
+            if (PciIndexGetKey(&SubDevices[Devices[i].FirstSubDevice + j], TRUE) <
+                PciIndexGetKey(&SubDevices[Devices[i].FirstSubDevice + j - 1], TRUE))
+            {
+                return FALSE;
+            }
+        }
+    }
+
+    for (UINT32 i = 0; i < Header->SubDeviceCount; i++)
+    {
+        if (SubDevices[i].NameOffset >= Header->StringsSize)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find an entry by its ID (the first one of the entries with the
+ * same ID)
+ *
+ * @param Entries
+ * @param Count
+ * @param EntrySize
+ * @param Key
+ * @param IsSubDevice
+ *
+ * @return const VOID * NULL if it's not found
+ */
+static const VOID *
+PciIndexFindEntry(const VOID * Entries, UINT32 Count, UINT32 EntrySize, UINT32 Key, BOOLEAN IsSubDevice)
+{
+    const UINT8 * Bytes = (const UINT8 *)Entries;
+    UINT32        Low   = 0;
+    UINT32        High  = Count;
+    UINT32        Middle;
+
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (PciIndexGetKey(&Bytes[Middle * EntrySize], IsSubDevice) < Key)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == Count || PciIndexGetKey(&Bytes[Low * EntrySize], IsSubDevice) != Key)
+    {
+        return NULL;
+    }
+
+    return &Bytes[Low * EntrySize];
+}
+
+/**
+ * @brief Find a vendor
+ *
+ * @param Index A validated index
+ * @param VendorId
+ *
+ * @return const PCI_INDEX_VENDOR * NULL if it's not found
+ */
+const PCI_INDEX_VENDOR *
+PciIndexFindVendor(const VOID * Index, UINT16 VendorId)
+{
+    const PCI_INDEX_HEADER * Header = (const PCI_INDEX_HEADER *)Index;
+
+    return (const PCI_INDEX_VENDOR *)PciIndexFindEntry((const UINT8 *)Index + Header->VendorsOffset,
+                                                       Header->VendorCount,
+                                                       sizeof(PCI_INDEX_VENDOR),
+                                                       VendorId,
+                                                       FALSE);
+}
+
+/**
+ * @brief Find a device of a vendor
+ *
+ * @param Index A validated index
+ * @param Vendor
+ * @param DeviceId
+ *
+ * @return const PCI_INDEX_DEVICE * NULL if it's not found
+ */
+const PCI_INDEX_DEVICE *
+PciIndexFindDevice(const VOID * Index, const PCI_INDEX_VENDOR * Vendor, UINT16 DeviceId)
+{
+    return (const PCI_INDEX_DEVICE *)PciIndexFindEntry(PciIndexGetDevices(Index, Vendor),
+                                                       Vendor->DeviceCount,
+                                                       sizeof(PCI_INDEX_DEVICE),
+                                                       DeviceId,
+                                                       FALSE);
+}
+
+/**
+ * @brief Find a subsystem of a device
+ *
+ * @param Index A validated index
+ * @param Device
+ * @param SubVendorId
+ * @param SubDeviceId
+ *
+ * @return const PCI_INDEX_SUBDEVICE * NULL if it's not found
+ */
+const PCI_INDEX_SUBDEVICE *
+PciIndexFindSubDevice(const VOID * Index, const PCI_INDEX_DEVICE * Device, UINT16 SubVendorId, UINT16 SubDeviceId)
+{
+    return (const PCI_INDEX_SUBDEVICE *)PciIndexFindEntry(PciIndexGetSubDevices(Index, Device),
+                                                          Device->SubDeviceCount,
+                                                          sizeof(PCI_INDEX_SUBDEVICE),
+                                                          ((UINT32)SubVendorId << 16) | SubDeviceId,
+                                                          TRUE);
+}
+
+/**
+ * @brief Get the devices of a vendor (the number of them is in the vendor)
+ *
+ * @param Index A validated index
+ * @param Vendor
+ *
+ * @return const PCI_INDEX_DEVICE *
+ */
+const PCI_INDEX_DEVICE *
+PciIndexGetDevices(const VOID * Index, const PCI_INDEX_VENDOR * Vendor)
+{
+    const PCI_INDEX_HEADER * Header = (const PCI_INDEX_HEADER *)Index;
+
+    return (const PCI_INDEX_DEVICE *)((const UINT8 *)Index + Header->DevicesOffset) + Vendor->FirstDevice;
+}
+
+/**
+ * @brief Get the subsystems of a device (the number of them is in the
+ * device)
+ *
+ * @param Index A validated index
+ * @param Device
+ *
+ * @return const PCI_INDEX_SUBDEVICE *
+ */
+const PCI_INDEX_SUBDEVICE *
+PciIndexGetSubDevices(const VOID * Index, const PCI_INDEX_DEVICE * Device)
+{
+    const PCI_INDEX_HEADER * Header = (const PCI_INDEX_HEADER *)Index;
+
+    return (const PCI_INDEX_SUBDEVICE *)((const UINT8 *)Index + Header->SubDevicesOffset) + Device->FirstSubDevice;
+}
+
+/**
+ * @brief Get a name of an index
+ *
+ * @param Index A validated index
+ * @param NameOffset
+ *
+ * @return const CHAR *
+ */
+const CHAR *
+PciIndexGetName(const VOID * Index, UINT32 NameOffset)
+{
+    const PCI_INDEX_HEADER * Header = (const PCI_INDEX_HEADER *)Index;
+
+    return (const CHAR *)Index + Header->StringsOffset + NameOffset;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file PciIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the binary index of the PCI ID database
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature of the index files ('HDPC')
+ *
+ */
+#define PCI_INDEX_MAGIC 0x43504448
+
+/**
+ * @brief Version of the format of the index files (changing the format
+ * makes the cached index files rebuilt)
+ *
+ */
+#define PCI_INDEX_VERSION 1
+
+/**
+ * @brief The extension that is added to the path of the database (the
+ * pci.ids file) for caching its index
+ *
+ */
+#define PCI_INDEX_FILE_EXTENSION ".hdbidx"
+
+/**
+ * @brief Maximum size of the database (the offsets of the index are 32-bit)
+ *
+ */
+#define PCI_INDEX_MAXIMUM_TEXT_SIZE 0x10000000
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A vendor of the index
+ *
+ */
+typedef struct _PCI_INDEX_VENDOR
+{
+    UINT16 VendorId;
+    UINT16 Reserved;
+    UINT32 NameOffset;  // Offset of the name in the strings
+    UINT32 FirstDevice; // Index of the first device of the vendor
+    UINT32 DeviceCount;
+
+} PCI_INDEX_VENDOR, *PPCI_INDEX_VENDOR;
+
+/**
+ * @brief A device of the index
+ *
+ */
+typedef struct _PCI_INDEX_DEVICE
+{
+    UINT16 DeviceId;
+    UINT16 Reserved;
+    UINT32 NameOffset;     // Offset of the name in the strings
+    UINT32 FirstSubDevice; // Index of the first subsystem of the device
+    UINT32 SubDeviceCount;
+
+} PCI_INDEX_DEVICE, *PPCI_INDEX_DEVICE;
+
+/**
+ * @brief A subsystem of a device of the index
+ *
+ */
+typedef struct _PCI_INDEX_SUBDEVICE
+{
+    UINT16 SubVendorId;
+    UINT16 SubDeviceId;
+    UINT32 NameOffset; // Offset of the name in the strings
+
+} PCI_INDEX_SUBDEVICE, *PPCI_INDEX_SUBDEVICE;
+
+/**
+ * @brief Header of an index
+ * @details The index is position independent, so it's used directly from
+ * the mapped index file. All of the offsets are from the start of the header
+ *
+ */
+typedef struct _PCI_INDEX_HEADER
+{
+    UINT32 Magic;
+    UINT32 Version;
+    UINT64 TextHash; // Hash of the database that the index is built from
+    UINT64 TextSize;
+    UINT32 TotalSize;
+    UINT32 VendorCount;
+    UINT32 VendorsOffset;
+    UINT32 DeviceCount;
+    UINT32 DevicesOffset;
+    UINT32 SubDeviceCount;
+    UINT32 SubDevicesOffset;
+    UINT32 StringsOffset;
+    UINT32 StringsSize;
+    UINT32 Reserved;
+
+} PCI_INDEX_HEADER, *PPCI_INDEX_HEADER;
+
+/**
+ * @brief State of building an index
+ * @details The entries are counted first (without an index), then they're
+ * added to the index. The buckets of interning the names are after the
+ * strings, and they're not a part of the built index
+ *
+ */
+typedef struct _PCI_INDEX_BUILDER
+{
+    PPCI_INDEX_HEADER     Header;
+    PCI_INDEX_VENDOR *    Vendors;
+    PCI_INDEX_DEVICE *    Devices;
+    PCI_INDEX_SUBDEVICE * SubDevices;
+    CHAR *                Strings;
+    UINT32 *              StringBuckets;
+    UINT32                StringBucketCount; // A power of two
+    UINT32                VendorCount;
+    UINT32                DeviceCount;
+    UINT32                SubDeviceCount;
+    UINT64                StringsSize;
+
+} PCI_INDEX_BUILDER, *PPCI_INDEX_BUILDER;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+The vendors are sorted by their IDs, the devices of each vendor are next to
+each other (sorted by their IDs), and so are the subsystems of each device.
+The names are interned, so the repeated names (e.g., the subsystems of the
+same card) are only stored once.
+
+      Vendors                 Devices                    Subsystems
+      ______________          ______________             _________________
+     | 8086 | 3 ----|------->| 0100 | 0 ----|---------->| 1028:0001       |
+     |______|_______|        |______|_______|      _--->| 1043:8460       |
+     | 10de | ...   |        | 0101 | 2 ----|-----'     |_________________|
+     |______|_______|        | 0102 | 0     |           | ...             |
+                             |______|_______|
+                                                 Strings
+                                                 "Intel Corporation\0..."
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+PciIndexHashText(const CHAR * Text, UINT64 TextSize);
+
+BOOLEAN
+PciIndexGetRequiredSize(const CHAR * Text, UINT64 TextSize, UINT32 * IndexSize);
+
+BOOLEAN
+PciIndexBuild(const CHAR * Text, UINT64 TextSize, VOID * Index, UINT32 IndexSize);
+
+BOOLEAN
+PciIndexValidate(const VOID * Index, UINT64 IndexSize, UINT64 TextHash, UINT64 TextSize);
+
+const PCI_INDEX_VENDOR *
+PciIndexFindVendor(const VOID * Index, UINT16 VendorId);
+
+const PCI_INDEX_DEVICE *
+PciIndexFindDevice(const VOID * Index, const PCI_INDEX_VENDOR * Vendor, UINT16 DeviceId);
+
+const PCI_INDEX_SUBDEVICE *
+PciIndexFindSubDevice(const VOID * Index, const PCI_INDEX_DEVICE * Device, UINT16 SubVendorId, UINT16 SubDeviceId);
+
+const PCI_INDEX_DEVICE *
+PciIndexGetDevices(const VOID * Index, const PCI_INDEX_VENDOR * Vendor);
+
+const PCI_INDEX_SUBDEVICE *
+PciIndexGetSubDevices(const VOID * Index, const PCI_INDEX_DEVICE * Device);
+
+const CHAR *
+PciIndexGetName(const VOID * Index, UINT32 NameOffset);
@@ -0,0 +1,1229 @@
+/**
+ * @file PdbIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the native PDB reader and the index of its symbols
+ * @details The PDB file is read from memory (it's mapped by the caller), the
+ * public symbols, the global data and the functions of the modules are put
+ * into an index that is cached next to the PDB file. The names are resolved
+ * (and the addresses are converted to symbols) from the index without
+ * loading the PDB by DbgHelp
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Signature of the MSF 7.00 files
+ *
+ */
+static const CHAR PdbIndexMsfMagic[32] = "Microsoft C/C++ MSF 7.00\r\n\x1a"
+                                         "DS\0\0";
+
+/**
+ * @brief Read a 16-bit value from a buffer
+ *
+ * @param Buffer
+ *
+ * @return UINT16
+ */
+static UINT16
+PdbIndexRead16(const UINT8 * Buffer)
+{
+    return (UINT16)(Buffer[0] | Buffer[1] << 8);
+}
+
+/**
+ * @brief Read a 32-bit value from a buffer
+ *
+ * @param Buffer
+ *
+ * @return UINT32
+ */
+static UINT32
+PdbIndexRead32(const UINT8 * Buffer)
+{
+    return (UINT32)Buffer[0] | (UINT32)Buffer[1] << 8 | (UINT32)Buffer[2] << 16 | (UINT32)Buffer[3] << 24;
+}
+
+/**
+ * @brief Hash a name (case-insensitive)
+ *
+ * @param Name
+ *
+ * @return UINT32
+ */
+static UINT32
+PdbIndexHashName(const CHAR * Name)
+{
+    UINT32 Hash = 0x811c9dc5;
+
+    for (; *Name != '\0'; Name++)
+    {
+        CHAR Ch = *Name;
+
+        if (Ch >= 'A' && Ch <= 'Z')
+        {
+            Ch = Ch - 'A' + 'a';
+        }
+
+        Hash = (Hash ^ (UINT8)Ch) * 0x01000193;
+    }
+
+    return Hash;
+}
+
+/**
+ * @brief Compare two names (case-insensitive)
+ *
+ * @param Name1
+ * @param Name2
+ *
+ * @return BOOLEAN TRUE if the names are equal
+ */
+static BOOLEAN
+PdbIndexIsNameEqual(const CHAR * Name1, const CHAR * Name2)
+{
+    for (;; Name1++, Name2++)
+    {
+        CHAR Ch1 = *Name1;
+        CHAR Ch2 = *Name2;
+
+        if (Ch1 >= 'A' && Ch1 <= 'Z')
+        {
+            Ch1 = Ch1 - 'A' + 'a';
+        }
+
+        if (Ch2 >= 'A' && Ch2 <= 'Z')
+        {
+            Ch2 = Ch2 - 'A' + 'a';
+        }
+
+        if (Ch1 != Ch2)
+        {
+            return FALSE;
+        }
+
+        if (Ch1 == '\0')
+        {
+            return TRUE;
+        }
+    }
+}
+
+static BOOLEAN
+PdbIndexReadStream(PPDB_INDEX_STREAM Stream, UINT32 Offset, VOID * Buffer, UINT32 Size);
+
+/**
+ * @brief Get a block of a stream
+ *
+ * @param Stream
+ * @param BlockIndex Index of the block in the stream
+ * @param Block Number of the block in the file
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexGetBlock(PPDB_INDEX_STREAM Stream, UINT32 BlockIndex, UINT32 * Block)
+{
+    PPDB_INDEX_MSF   Msf = Stream->Msf;
+    PDB_INDEX_STREAM Directory;
+    UINT8            Buffer[4];
+
+    if (Stream->IsDirectory)
+    {
+        *Block = PdbIndexRead32(&Msf->DirectoryBlocks[BlockIndex * 4]);
+    }
+    else
+    {
+        Directory.Msf             = Msf;
+        Directory.Size            = Msf->DirectorySize;
+        Directory.BlockListOffset = 0;
+        Directory.IsDirectory     = TRUE;
+
+        if (!PdbIndexReadStream(&Directory, Stream->BlockListOffset + BlockIndex * 4, Buffer, 4))
+        {
+            return FALSE;
+        }
+
+        *Block = PdbIndexRead32(Buffer);
+    }
+
+    return *Block < Msf->BlockCount;
+}
+
+/**
+ * @brief Read from a stream
+ *
+ * @param Stream
+ * @param Offset
+ * @param Buffer
+ * @param Size
+ *
+ * @return BOOLEAN FALSE if it's out of the stream (or the file)
+ */
+static BOOLEAN
+PdbIndexReadStream(PPDB_INDEX_STREAM Stream, UINT32 Offset, VOID * Buffer, UINT32 Size)
+{
+    PPDB_INDEX_MSF Msf = Stream->Msf;
+    UINT8 *        Destination = (UINT8 *)Buffer;
+    UINT32         Block;
+    UINT32         InBlock;
+    UINT32         Chunk;
+
+    if (Size > Stream->Size || Offset > Stream->Size - Size)
+    {
+        return FALSE;
+    }
+
+    while (Size != 0)
+    {
+        InBlock = Offset % Msf->BlockSize;
+        Chunk   = Msf->BlockSize - InBlock;
+
+        if (Chunk > Size)
+        {
+            Chunk = Size;
+        }
+
+        if (!PdbIndexGetBlock(Stream, Offset / Msf->BlockSize, &Block))
+        {
+            return FALSE;
+        }
+
+        memcpy(Destination, &Msf->Pdb[(UINT64)Block * Msf->BlockSize + InBlock], Chunk);
+
+        Destination += Chunk;
+        Offset += Chunk;
+        Size -= Chunk;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Open a PDB (MSF) file
+ *
+ * @param Msf
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexOpenMsf(PPDB_INDEX_MSF Msf, const VOID * Pdb, UINT64 PdbSize)
+{
+    const UINT8 *    SuperBlock = (const UINT8 *)Pdb;
+    PDB_INDEX_STREAM Directory;
+    UINT32           BlockMapAddress;
+    UINT32           DirectoryBlockCount;
+    UINT8            Buffer[4];
+
+    if (PdbSize < 56 || memcmp(SuperBlock, PdbIndexMsfMagic, sizeof(PdbIndexMsfMagic)) != 0)
+    {
+        return FALSE;
+    }
+
+    Msf->Pdb           = SuperBlock;
+    Msf->PdbSize       = PdbSize;
+    Msf->BlockSize     = PdbIndexRead32(&SuperBlock[32]);
+    Msf->BlockCount    = PdbIndexRead32(&SuperBlock[40]);
+    Msf->DirectorySize = PdbIndexRead32(&SuperBlock[44]);
+    BlockMapAddress    = PdbIndexRead32(&SuperBlock[52]);
+
+    if (Msf->BlockSize != 512 && Msf->BlockSize != 1024 && Msf->BlockSize != 2048 && Msf->BlockSize != 4096)
+    {
+        return FALSE;
+    }
+
+    //
+    // The last block might not be written completely
+    //
+    if (Msf->BlockCount > PdbSize / Msf->BlockSize)
+    {
+        Msf->BlockCount = (UINT32)(PdbSize / Msf->BlockSize);
+    }
+
+    //
+    // The block numbers of the directory should fit in one block
+    //
+    DirectoryBlockCount = (UINT32)(((UINT64)Msf->DirectorySize + Msf->BlockSize - 1) / Msf->BlockSize);
+
+    if (BlockMapAddress >= Msf->BlockCount || DirectoryBlockCount * 4 > Msf->BlockSize)
+    {
+        return FALSE;
+    }
+
+    Msf->DirectoryBlocks = &SuperBlock[(UINT64)BlockMapAddress * Msf->BlockSize];
+
+    Directory.Msf             = Msf;
+    Directory.Size            = Msf->DirectorySize;
+    Directory.BlockListOffset = 0;
+    Directory.IsDirectory     = TRUE;
+
+    if (!PdbIndexReadStream(&Directory, 0, Buffer, 4))
+    {
+        return FALSE;
+    }
+
+    Msf->StreamCount = PdbIndexRead32(Buffer);
+
+    return Msf->StreamCount <= (Msf->DirectorySize - 4) / 4;
+}
+
+/**
+ * @brief Open a stream of a PDB file
+ * @details The nil streams are opened as empty streams
+ *
+ * @param Msf
+ * @param StreamIndex
+ * @param Stream
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexOpenStream(PPDB_INDEX_MSF Msf, UINT32 StreamIndex, PPDB_INDEX_STREAM Stream)
+{
+    PDB_INDEX_STREAM Directory;
+    UINT32           Sizes[64];
+    UINT32           Count;
+    UINT32           Size;
+    UINT64           BlockListOffset;
+
+    if (StreamIndex >= Msf->StreamCount)
+    {
+        return FALSE;
+    }
+
+    Directory.Msf             = Msf;
+    Directory.Size            = Msf->DirectorySize;
+    Directory.BlockListOffset = 0;
+    Directory.IsDirectory     = TRUE;
+
+    //
+    // The lists of the blocks are after the sizes of all of the streams
+    //
+    BlockListOffset = 4 + (UINT64)Msf->StreamCount * 4;
+
+    for (UINT32 i = 0; i <= StreamIndex; i += Count)
+    {
+        Count = StreamIndex + 1 - i;
+
+        if (Count > sizeof(Sizes) / sizeof(Sizes[0]))
+        {
+            Count = sizeof(Sizes) / sizeof(Sizes[0]);
+        }
+
+        if (!PdbIndexReadStream(&Directory, 4 + i * 4, Sizes, Count * 4))
+        {
+            return FALSE;
+        }
+
+        for (UINT32 j = 0; j < Count; j++)
+        {
+            Size = PdbIndexRead32((const UINT8 *)&Sizes[j]);
+
+            if (Size == 0xffffffff)
+            {
+                Size = 0;
+            }
+
+            if (i + j == StreamIndex)
+            {
+                Stream->Msf             = Msf;
+                Stream->Size            = Size;
+                Stream->BlockListOffset = (UINT32)BlockListOffset;
+                Stream->IsDirectory     = FALSE;
+            }
+            else
+            {
+                BlockListOffset += ((UINT64)Size + Msf->BlockSize - 1) / Msf->BlockSize * 4;
+            }
+        }
+    }
+
+    //
+    // The list of the blocks should be in the directory
+    //
+    return BlockListOffset + ((UINT64)Stream->Size + Msf->BlockSize - 1) / Msf->BlockSize * 4 <= Msf->DirectorySize;
+}
+
+/**
+ * @brief Read the identity of a PDB file
+ *
+ * @param Msf
+ * @param PdbInfo
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexReadPdbInfo(PPDB_INDEX_MSF Msf, PPDB_INDEX_PDB_INFO PdbInfo)
+{
+    PDB_INDEX_STREAM Stream;
+    UINT8            Buffer[28];
+
+    if (!PdbIndexOpenStream(Msf, PDB_INDEX_PDB_STREAM, &Stream) ||
+        !PdbIndexReadStream(&Stream, 0, Buffer, sizeof(Buffer)))
+    {
+        return FALSE;
+    }
+
+    memset(PdbInfo, 0, sizeof(PDB_INDEX_PDB_INFO));
+
+    PdbInfo->Signature = PdbIndexRead32(&Buffer[4]);
+    PdbInfo->Age       = PdbIndexRead32(&Buffer[8]);
+    PdbInfo->FileSize  = Msf->PdbSize;
+
+    memcpy(PdbInfo->Guid, &Buffer[12], sizeof(PdbInfo->Guid));
+
+    return TRUE;
+}
+
+/**
+ * @brief Add a symbol to the index (or count it)
+ *
+ * @param Builder
+ * @param Segment
+ * @param Offset
+ * @param Size
+ * @param Kind
+ * @param Name
+ * @param NameLength
+ *
+ * @return VOID
+ */
+static VOID
+PdbIndexAddSymbol(PPDB_INDEX_BUILDER    Builder,
+                  UINT16                Segment,
+                  UINT32                Offset,
+                  UINT32                Size,
+                  PDB_INDEX_SYMBOL_KIND Kind,
+                  const CHAR *          Name,
+                  UINT32                NameLength)
+{
+    PDB_INDEX_SYMBOL * Symbol;
+    UINT8              Buffer[4];
+
+    //
+    // The absolute symbols (and the unnamed symbols) are not indexed
+    //
+    if (Segment == 0 || NameLength == 0)
+    {
+        return;
+    }
+
+    //
+    // The RVA is from the section headers (the virtual address is the
+    // twelfth byte of the image section header)
+    //
+    if (!PdbIndexReadStream(&Builder->SectionHeaders, (Segment - 1) * 40 + 12, Buffer, 4))
+    {
+        return;
+    }
+
+    if (Builder->Header != NULL)
+    {
+        Symbol = &Builder->Symbols[Builder->SymbolCount];
+
+        Symbol->Rva        = PdbIndexRead32(Buffer) + Offset;
+        Symbol->Size       = Size;
+        Symbol->NameOffset = (UINT32)Builder->NamesSize;
+        Symbol->Kind       = (UINT16)Kind;
+        Symbol->Reserved   = 0;
+        Symbol->Next       = PDB_INDEX_NO_SYMBOL;
+
+        memcpy(&Builder->Names[Builder->NamesSize], Name, NameLength);
+        Builder->Names[Builder->NamesSize + NameLength] = '\0';
+
+        Symbol->NameHash = PdbIndexHashName(&Builder->Names[Builder->NamesSize]);
+    }
+
+    Builder->SymbolCount++;
+    Builder->NamesSize += NameLength + 1;
+}
+
+/**
+ * @brief Add the symbols of a range of a symbol records stream
+ *
+ * @param Builder
+ * @param Stream
+ * @param Offset Start of the records
+ * @param End End of the records
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexAddRecords(PPDB_INDEX_BUILDER Builder, PPDB_INDEX_STREAM Stream, UINT32 Offset, UINT32 End)
+{
+    UINT8 *               Record = Builder->Record;
+    UINT32                RecordLength;
+    UINT32                NameOffset;
+    UINT32                NameLength;
+    UINT32                Size;
+    UINT32                SymbolOffset;
+    UINT16                Segment;
+    UINT16                Kind;
+    PDB_INDEX_SYMBOL_KIND SymbolKind;
+
+    if (End > Stream->Size)
+    {
+        return FALSE;
+    }
+
+    while (End - Offset >= 4)
+    {
+        if (!PdbIndexReadStream(Stream, Offset, Record, 4))
+        {
+            return FALSE;
+        }
+
+        RecordLength = PdbIndexRead16(Record);
+        Kind         = PdbIndexRead16(&Record[2]);
+
+        if (RecordLength < 2 || RecordLength + 2 > End - Offset)
+        {
+            return FALSE;
+        }
+
+        switch (Kind)
+        {
+        case PDB_INDEX_S_PUB32:
+            NameOffset = 14;
+            SymbolKind = PDB_INDEX_SYMBOL_PUBLIC;
+            break;
+
+        case PDB_INDEX_S_GDATA32:
+        case PDB_INDEX_S_LDATA32:
+            NameOffset = 14;
+            SymbolKind = PDB_INDEX_SYMBOL_DATA;
+            break;
+
+        case PDB_INDEX_S_GPROC32:
+        case PDB_INDEX_S_LPROC32:
+        case PDB_INDEX_S_GPROC32_ID:
+        case PDB_INDEX_S_LPROC32_ID:
+            NameOffset = 39;
+            SymbolKind = PDB_INDEX_SYMBOL_FUNCTION;
+            break;
+
+        default:
+            NameOffset = 0;
+            SymbolKind = PDB_INDEX_SYMBOL_PUBLIC;
+            break;
+        }
+
+        if (NameOffset != 0 && RecordLength + 2 > NameOffset)
+        {
+            if (!PdbIndexReadStream(Stream, Offset + 4, &Record[4], RecordLength - 2))
+            {
+                return FALSE;
+            }
+
+            if (SymbolKind == PDB_INDEX_SYMBOL_FUNCTION)
+            {
+                Size         = PdbIndexRead32(&Record[16]);
+                SymbolOffset = PdbIndexRead32(&Record[32]);
+                Segment      = PdbIndexRead16(&Record[36]);
+            }
+            else
+            {
+                Size         = 0;
+                SymbolOffset = PdbIndexRead32(&Record[8]);
+                Segment      = PdbIndexRead16(&Record[12]);
+            }
+
+            //
+            // The names are null-terminated (followed by the padding)
+            //
+            for (NameLength = 0; NameOffset + NameLength < RecordLength + 2; NameLength++)
+            {
+                if (Record[NameOffset + NameLength] == 0)
+                {
+                    break;
+                }
+            }
+
+            PdbIndexAddSymbol(Builder,
+                              Segment,
+                              SymbolOffset,
+                              Size,
+                              SymbolKind,
+                              (const CHAR *)&Record[NameOffset],
+                              NameLength);
+        }
+
+        Offset += RecordLength + 2;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Add the functions of the modules
+ *
+ * @param Builder
+ * @param Dbi The DBI stream
+ * @param Offset Start of the module info substream
+ * @param End End of the module info substream
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexAddModules(PPDB_INDEX_BUILDER Builder, PPDB_INDEX_STREAM Dbi, UINT32 Offset, UINT32 End)
+{
+    UINT8 *          Buffer = Builder->Record;
+    PDB_INDEX_STREAM Stream;
+    UINT32           Length;
+    UINT32           Position;
+    UINT32           SymbolsSize;
+    UINT32           Strings;
+    UINT16           StreamIndex;
+
+    while (Offset < End && End - Offset >= 64)
+    {
+        Length = End - Offset;
+
+        if (Length > PDB_INDEX_MAXIMUM_RECORD_SIZE)
+        {
+            Length = PDB_INDEX_MAXIMUM_RECORD_SIZE;
+        }
+
+        if (!PdbIndexReadStream(Dbi, Offset, Buffer, Length))
+        {
+            return FALSE;
+        }
+
+        StreamIndex = PdbIndexRead16(&Buffer[34]);
+        SymbolsSize = PdbIndexRead32(&Buffer[36]);
+
+        //
+        // Skip the name of the module and the name of the object file
+        //
+        Strings = 0;
+
+        for (Position = 64; Position < Length && Strings != 2; Position++)
+        {
+            if (Buffer[Position] == 0)
+            {
+                Strings++;
+            }
+        }
+
+        if (Strings != 2)
+        {
+            return FALSE;
+        }
+
+        //
+        // The symbols of a module are after its signature
+        //
+        if (StreamIndex != PDB_INDEX_NIL_STREAM && SymbolsSize > 4)
+        {
+            if (!PdbIndexOpenStream(&Builder->Msf, StreamIndex, &Stream) ||
+                !PdbIndexAddRecords(Builder, &Stream, 4, SymbolsSize))
+            {
+                return FALSE;
+            }
+        }
+
+        //
+        // The entries are aligned to four bytes
+        //
+        Offset = (Offset + Position + 3) & ~3u;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Add (or count) all of the symbols of a PDB file
+ *
+ * @param Builder
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+PdbIndexAddAllSymbols(PPDB_INDEX_BUILDER Builder, const VOID * Pdb, UINT64 PdbSize)
+{
+    PDB_INDEX_STREAM Dbi;
+    PDB_INDEX_STREAM Records;
+    UINT8            Header[64];
+    UINT8            Buffer[2];
+    UINT32           Offset;
+    UINT32           Substreams[7];
+
+    Builder->SymbolCount = 0;
+    Builder->NamesSize   = 0;
+
+    if (!PdbIndexOpenMsf(&Builder->Msf, Pdb, PdbSize) ||
+        !PdbIndexOpenStream(&Builder->Msf, PDB_INDEX_DBI_STREAM, &Dbi) ||
+        !PdbIndexReadStream(&Dbi, 0, Header, sizeof(Header)) ||
+        PdbIndexRead32(Header) != 0xffffffff)
+    {
+        return FALSE;
+    }
+
+    //
+    // Sizes of the module info, section contribution, section map, source
+    // info, type server map, EC and optional debug header substreams
+    //
+    Substreams[0] = PdbIndexRead32(&Header[24]);
+    Substreams[1] = PdbIndexRead32(&Header[28]);
+    Substreams[2] = PdbIndexRead32(&Header[32]);
+    Substreams[3] = PdbIndexRead32(&Header[36]);
+    Substreams[4] = PdbIndexRead32(&Header[40]);
+    Substreams[5] = PdbIndexRead32(&Header[52]);
+    Substreams[6] = PdbIndexRead32(&Header[48]);
+
+    Offset = sizeof(Header);
+
+    for (UINT32 i = 0; i < 6; i++)
+    {
+        if (Substreams[i] > Dbi.Size - Offset)
+        {
+            return FALSE;
+        }
+
+        Offset += Substreams[i];
+    }
+
+    //
+    // The addresses of the OMAP-translated binaries (e.g., optimized by BBT)
+    // are not the RVAs of the image, these PDB files are left to DbgHelp
+    //
+    if (Substreams[6] < (PDB_INDEX_DBG_HEADER_OMAP_FROM_SOURCE + 1) * 2 ||
+        !PdbIndexReadStream(&Dbi, Offset + PDB_INDEX_DBG_HEADER_OMAP_FROM_SOURCE * 2, Buffer, 2) ||
+        PdbIndexRead16(Buffer) != PDB_INDEX_NIL_STREAM)
+    {
+        return FALSE;
+    }
+
+    //
+    // The section headers are needed for converting the addresses to RVAs
+    //
+    if (Substreams[6] < (PDB_INDEX_DBG_HEADER_SECTION_HEADERS + 1) * 2 ||
+        !PdbIndexReadStream(&Dbi, Offset + PDB_INDEX_DBG_HEADER_SECTION_HEADERS * 2, Buffer, 2) ||
+        !PdbIndexOpenStream(&Builder->Msf, PdbIndexRead16(Buffer), &Builder->SectionHeaders))
+    {
+        return FALSE;
+    }
+
+    //
+    // The public symbols and the global data are in the symbol records stream
+    //
+    if (!PdbIndexOpenStream(&Builder->Msf, PdbIndexRead16(&Header[20]), &Records) ||
+        !PdbIndexAddRecords(Builder, &Records, 0, Records.Size))
+    {
+        return FALSE;
+    }
+
+    //
+    // The functions (including the static functions) are in the modules
+    //
+    return PdbIndexAddModules(Builder, &Dbi, sizeof(Header), sizeof(Header) + Substreams[0]);
+}
+
+/**
+ * @brief Compare two symbols (by their RVAs, then their names)
+ *
+ * @param Symbol1
+ * @param Symbol2
+ * @param Names
+ *
+ * @return INT32
+ */
+static INT32
+PdbIndexCompareSymbols(const PDB_INDEX_SYMBOL * Symbol1, const PDB_INDEX_SYMBOL * Symbol2, const CHAR * Names)
+{
+    INT32 Result;
+
+    if (Symbol1->Rva != Symbol2->Rva)
+    {
+        return Symbol1->Rva < Symbol2->Rva ? -1 : 1;
+    }
+
+    Result = strcmp(&Names[Symbol1->NameOffset], &Names[Symbol2->NameOffset]);
+
+    if (Result != 0)
+    {
+        return Result;
+    }
+
+    //
+    // The functions (with sizes) are before the public symbols
+    //
+    if (Symbol1->Size != Symbol2->Size)
+    {
+        return Symbol1->Size > Symbol2->Size ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Move a symbol down the heap
+ *
+ * @param Symbols
+ * @param Names
+ * @param Index
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+PdbIndexSiftDown(PDB_INDEX_SYMBOL * Symbols, const CHAR * Names, UINT32 Index, UINT32 Count)
+{
+    PDB_INDEX_SYMBOL Temp;
+    UINT32           Child;
+
+    while ((UINT64)Index * 2 + 1 < Count)
+    {
+        Child = Index * 2 + 1;
+
+        if (Child + 1 < Count && PdbIndexCompareSymbols(&Symbols[Child], &Symbols[Child + 1], Names) < 0)
+        {
+            Child++;
+        }
+
+        if (PdbIndexCompareSymbols(&Symbols[Index], &Symbols[Child], Names) >= 0)
+        {
+            return;
+        }
+
+        Temp           = Symbols[Index];
+        Symbols[Index] = Symbols[Child];
+        Symbols[Child] = Temp;
+
+        Index = Child;
+    }
+}
+
+/**
+ * @brief Sort the symbols (heap sort, as the names are needed for comparing)
+ *
+ * @param Symbols
+ * @param Names
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+PdbIndexSortSymbols(PDB_INDEX_SYMBOL * Symbols, const CHAR * Names, UINT32 Count)
+{
+    PDB_INDEX_SYMBOL Temp;
+
+    for (UINT32 i = Count / 2; i != 0; i--)
+    {
+        PdbIndexSiftDown(Symbols, Names, i - 1, Count);
+    }
+
+    for (UINT32 i = Count; i > 1; i--)
+    {
+        Temp           = Symbols[0];
+        Symbols[0]     = Symbols[i - 1];
+        Symbols[i - 1] = Temp;
+
+        PdbIndexSiftDown(Symbols, Names, 0, i - 1);
+    }
+}
+
+/**
+ * @brief Get the layout of an index
+ *
+ * @param SymbolCount
+ * @param NamesSize
+ * @param BucketCount
+ * @param IndexSize
+ *
+ * @return BOOLEAN FALSE if the index is too large
+ */
+static BOOLEAN
+PdbIndexGetLayout(UINT32 SymbolCount, UINT64 NamesSize, UINT32 * BucketCount, UINT32 * IndexSize)
+{
+    UINT64 Size;
+
+    *BucketCount = 1;
+
+    while (*BucketCount < SymbolCount && *BucketCount < 0x80000000)
+    {
+        *BucketCount *= 2;
+    }
+
+    Size = sizeof(PDB_INDEX_HEADER) + (UINT64)SymbolCount * sizeof(PDB_INDEX_SYMBOL) +
+           (UINT64)*BucketCount * sizeof(UINT32) + NamesSize;
+
+    if (Size > 0xffffffff)
+    {
+        return FALSE;
+    }
+
+    *IndexSize = (UINT32)Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the identity of a PDB file
+ * @details The index of a PDB file is used only if it's built from a PDB
+ * file with the same identity
+ *
+ * @param Pdb The mapped PDB file
+ * @param PdbSize
+ * @param PdbInfo
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbIndexGetPdbInfo(const VOID * Pdb, UINT64 PdbSize, PPDB_INDEX_PDB_INFO PdbInfo)
+{
+    PDB_INDEX_MSF Msf;
+
+    return PdbIndexOpenMsf(&Msf, Pdb, PdbSize) && PdbIndexReadPdbInfo(&Msf, PdbInfo);
+}
+
+/**
+ * @brief Get the size of the index of a PDB file
+ *
+ * @param Pdb The mapped PDB file
+ * @param PdbSize
+ * @param IndexSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbIndexGetRequiredSize(const VOID * Pdb, UINT64 PdbSize, UINT32 * IndexSize)
+{
+    PDB_INDEX_BUILDER Builder;
+    UINT32            BucketCount;
+
+    Builder.Header = NULL;
+
+    if (!PdbIndexAddAllSymbols(&Builder, Pdb, PdbSize))
+    {
+        return FALSE;
+    }
+
+    return PdbIndexGetLayout(Builder.SymbolCount, Builder.NamesSize, &BucketCount, IndexSize);
+}
+
+/**
+ * @brief Build the index of a PDB file
+ * @details The same symbols (with the same names and RVAs) from the public
+ * symbols and the modules are added once
+ *
+ * @param Pdb The mapped PDB file
+ * @param PdbSize
+ * @param Index
+ * @param IndexSize Should be at least the size from PdbIndexGetRequiredSize
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbIndexBuild(const VOID * Pdb, UINT64 PdbSize, VOID * Index, UINT32 IndexSize)
+{
+    PDB_INDEX_BUILDER  Builder;
+    PPDB_INDEX_HEADER  Header = (PPDB_INDEX_HEADER)Index;
+    PDB_INDEX_SYMBOL * Symbols;
+    UINT32 *           Buckets;
+    UINT32             Count;
+    UINT32             BucketCount;
+    UINT32             RequiredSize;
+    UINT32             Bucket;
+
+    //
+    // Count the symbols for the layout of the index
+    //
+    Builder.Header = NULL;
+
+    if (!PdbIndexAddAllSymbols(&Builder, Pdb, PdbSize) ||
+        !PdbIndexGetLayout(Builder.SymbolCount, Builder.NamesSize, &BucketCount, &RequiredSize) ||
+        IndexSize < RequiredSize)
+    {
+        return FALSE;
+    }
+
+    memset(Header, 0, sizeof(PDB_INDEX_HEADER));
+
+    Header->Magic         = PDB_INDEX_MAGIC;
+    Header->Version       = PDB_INDEX_VERSION;
+    Header->TotalSize     = RequiredSize;
+    Header->SymbolsOffset = sizeof(PDB_INDEX_HEADER);
+    Header->BucketCount   = BucketCount;
+    Header->BucketsOffset = Header->SymbolsOffset + Builder.SymbolCount * (UINT32)sizeof(PDB_INDEX_SYMBOL);
+    Header->NamesOffset   = Header->BucketsOffset + BucketCount * (UINT32)sizeof(UINT32);
+    Header->NamesSize     = (UINT32)Builder.NamesSize;
+
+    //
+    // Add the symbols
+    //
+    Count = Builder.SymbolCount;
+
+    Builder.Header  = Header;
+    Builder.Symbols = (PDB_INDEX_SYMBOL *)((UINT8 *)Index + Header->SymbolsOffset);
+    Builder.Names   = (CHAR *)Index + Header->NamesOffset;
+
+    if (!PdbIndexAddAllSymbols(&Builder, Pdb, PdbSize) ||
+        Builder.SymbolCount != Count ||
+        !PdbIndexReadPdbInfo(&Builder.Msf, &Header->PdbInfo))
+    {
+        return FALSE;
+    }
+
+    //
+    // Sort the symbols by their RVAs and remove the duplicates
+    //
+    Symbols = Builder.Symbols;
+
+    PdbIndexSortSymbols(Symbols, Builder.Names, Count);
+
+    Header->SymbolCount = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        if (Header->SymbolCount != 0 &&
+            Symbols[Header->SymbolCount - 1].Rva == Symbols[i].Rva &&
+            strcmp(&Builder.Names[Symbols[Header->SymbolCount - 1].NameOffset], &Builder.Names[Symbols[i].NameOffset]) == 0)
+        {
+            continue;
+        }
+
+        Symbols[Header->SymbolCount++] = Symbols[i];
+    }
+
+    //
+    // Chain the symbols in the buckets (the symbols with lower RVAs are
+    // found first)
+    //
+    Buckets = (UINT32 *)((UINT8 *)Index + Header->BucketsOffset);
+
+    memset(Buckets, 0xff, BucketCount * sizeof(UINT32));
+
+    for (UINT32 i = Header->SymbolCount; i != 0; i--)
+    {
+        Bucket = Symbols[i - 1].NameHash & (BucketCount - 1);
+
+        Symbols[i - 1].Next = Buckets[Bucket];
+        Buckets[Bucket]     = i - 1;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check an index (e.g., an index that is read from a file)
+ * @details All of the offsets are checked, so a corrupted index file is
+ * rebuilt instead of being used
+ *
+ * @param Index
+ * @param IndexSize
+ * @param PdbInfo The identity of the PDB file (optional)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PdbIndexValidate(const VOID * Index, UINT64 IndexSize, const PDB_INDEX_PDB_INFO * PdbInfo)
+{
+    const PDB_INDEX_HEADER * Header = (const PDB_INDEX_HEADER *)Index;
+    const PDB_INDEX_SYMBOL * Symbols;
+    const UINT32 *           Buckets;
+    const CHAR *             Names;
+
+    if (IndexSize < sizeof(PDB_INDEX_HEADER) ||
+        Header->Magic != PDB_INDEX_MAGIC ||
+        Header->Version != PDB_INDEX_VERSION ||
+        Header->TotalSize > IndexSize)
+    {
+        return FALSE;
+    }
+
+    if (PdbInfo != NULL && memcmp(&Header->PdbInfo, PdbInfo, sizeof(PDB_INDEX_PDB_INFO)) != 0)
+    {
+        return FALSE;
+    }
+
+    if (Header->BucketCount == 0 ||
+        (Header->BucketCount & (Header->BucketCount - 1)) != 0 ||
+        Header->SymbolsOffset < sizeof(PDB_INDEX_HEADER) ||
+        Header->SymbolsOffset % sizeof(UINT32) != 0 ||
+        Header->BucketsOffset % sizeof(UINT32) != 0 ||
+        Header->SymbolsOffset + (UINT64)Header->SymbolCount * sizeof(PDB_INDEX_SYMBOL) > Header->TotalSize ||
+        Header->BucketsOffset + (UINT64)Header->BucketCount * sizeof(UINT32) > Header->TotalSize ||
+        Header->NamesOffset + (UINT64)Header->NamesSize > Header->TotalSize ||
+        Header->NamesSize == 0)
+    {
+        return FALSE;
+    }
+
+    Symbols = (const PDB_INDEX_SYMBOL *)((const UINT8 *)Index + Header->SymbolsOffset);
+    Buckets = (const UINT32 *)((const UINT8 *)Index + Header->BucketsOffset);
+    Names   = (const CHAR *)Index + Header->NamesOffset;
+
+    if (Names[Header->NamesSize - 1] != '\0')
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Header->BucketCount; i++)
+    {
+        if (Buckets[i] != PDB_INDEX_NO_SYMBOL && Buckets[i] >= Header->SymbolCount)
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // The chains only go forward, so they're not circular
+    //
+    for (UINT32 i = 0; i < Header->SymbolCount; i++)
+    {
+        if (Symbols[i].NameOffset >= Header->NamesSize ||
+            (Symbols[i].Next != PDB_INDEX_NO_SYMBOL && (Symbols[i].Next >= Header->SymbolCount || Symbols[i].Next <= i)) ||
+            (i != 0 && Symbols[i].Rva < Symbols[i - 1].Rva))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Find a symbol by its name (case-insensitive)
+ *
+ * @param Index A validated index
+ * @param Name
+ *
+ * @return const PDB_INDEX_SYMBOL * NULL if it's not found
+ */
+const PDB_INDEX_SYMBOL *
+PdbIndexFindByName(const VOID * Index, const CHAR * Name)
+{
+    const PDB_INDEX_HEADER * Header  = (const PDB_INDEX_HEADER *)Index;
+    const PDB_INDEX_SYMBOL * Symbols = (const PDB_INDEX_SYMBOL *)((const UINT8 *)Index + Header->SymbolsOffset);
+    const UINT32 *           Buckets = (const UINT32 *)((const UINT8 *)Index + Header->BucketsOffset);
+    const CHAR *             Names   = (const CHAR *)Index + Header->NamesOffset;
+    UINT32                   Hash    = PdbIndexHashName(Name);
+
+    for (UINT32 i = Buckets[Hash & (Header->BucketCount - 1)]; i != PDB_INDEX_NO_SYMBOL; i = Symbols[i].Next)
+    {
+        if (Symbols[i].NameHash == Hash && PdbIndexIsNameEqual(&Names[Symbols[i].NameOffset], Name))
+        {
+            return &Symbols[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the symbol that contains an RVA (the nearest symbol that is
+ * not after the RVA)
+ *
+ * @param Index A validated index
+ * @param Rva
+ * @param Displacement Distance of the RVA from the symbol (optional)
+ *
+ * @return const PDB_INDEX_SYMBOL * NULL if there is no symbol before the RVA
+ */
+const PDB_INDEX_SYMBOL *
+PdbIndexFindByRva(const VOID * Index, UINT32 Rva, UINT32 * Displacement)
+{
+    const PDB_INDEX_HEADER * Header  = (const PDB_INDEX_HEADER *)Index;
+    const PDB_INDEX_SYMBOL * Symbols = (const PDB_INDEX_SYMBOL *)((const UINT8 *)Index + Header->SymbolsOffset);
+    UINT32                   Low     = 0;
+    UINT32                   High    = Header->SymbolCount;
+    UINT32                   Middle;
+
+    //
+    // Find the first symbol after the RVA
+    //
+    while (Low < High)
+    {
+        Middle = Low + (High - Low) / 2;
+
+        if (Symbols[Middle].Rva <= Rva)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    if (Low == 0)
+    {
+        return NULL;
+    }
+
+    //
+    // Prefer the first one of the symbols with the same RVA
+    //
+    Low--;
+
+    while (Low != 0 && Symbols[Low - 1].Rva == Symbols[Low].Rva)
+    {
+        Low--;
+    }
+
+    if (Displacement != NULL)
+    {
+        *Displacement = Rva - Symbols[Low].Rva;
+    }
+
+    return &Symbols[Low];
+}
+
+/**
+ * @brief Get a symbol of an index (in the order of their RVAs)
+ *
+ * @param Index A validated index
+ * @param SymbolIndex
+ *
+ * @return const PDB_INDEX_SYMBOL * NULL if it's out of the symbols
+ */
+const PDB_INDEX_SYMBOL *
+PdbIndexGetSymbol(const VOID * Index, UINT32 SymbolIndex)
+{
+    const PDB_INDEX_HEADER * Header = (const PDB_INDEX_HEADER *)Index;
+
+    if (SymbolIndex >= Header->SymbolCount)
+    {
+        return NULL;
+    }
+
+    return (const PDB_INDEX_SYMBOL *)((const UINT8 *)Index + Header->SymbolsOffset) + SymbolIndex;
+}
+
+/**
+ * @brief Get the number of the symbols of an index
+ *
+ * @param Index A validated index
+ *
+ * @return UINT32
+ */
+UINT32
+PdbIndexGetSymbolCount(const VOID * Index)
+{
+    return ((const PDB_INDEX_HEADER *)Index)->SymbolCount;
+}
+
+/**
+ * @brief Get the name of a symbol
+ *
+ * @param Index A validated index
+ * @param Symbol
+ *
+ * @return const CHAR *
+ */
+const CHAR *
+PdbIndexGetSymbolName(const VOID * Index, const PDB_INDEX_SYMBOL * Symbol)
+{
+    const PDB_INDEX_HEADER * Header = (const PDB_INDEX_HEADER *)Index;
+
+    return (const CHAR *)Index + Header->NamesOffset + Symbol->NameOffset;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file PdbIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the native PDB reader and the index of its symbols
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature of the index files ('HDPI')
+ *
+ */
+#define PDB_INDEX_MAGIC 0x49504448
+
+/**
+ * @brief Version of the format of the index files (changing the format
+ * or the PDB files that are indexed makes the cached index files rebuilt)
+ *
+ */
+#define PDB_INDEX_VERSION 2
+
+/**
+ * @brief The extension that is added to the path of the PDB file for
+ * caching its index
+ *
+ */
+#define PDB_INDEX_FILE_EXTENSION ".hdbidx"
+
+/**
+ * @brief Index of an empty bucket (or the end of a bucket)
+ *
+ */
+#define PDB_INDEX_NO_SYMBOL 0xffffffff
+
+/**
+ * @brief Maximum size of a symbol record (its 16-bit length and the bytes
+ * after its length)
+ *
+ */
+#define PDB_INDEX_MAXIMUM_RECORD_SIZE 0x10001
+
+/**
+ * @brief Streams and kinds of the symbol records that are used from the
+ * PDB files (based on the format that is published by Microsoft)
+ *
+ */
+#define PDB_INDEX_PDB_STREAM 1
+#define PDB_INDEX_DBI_STREAM 3
+#define PDB_INDEX_NIL_STREAM 0xffff
+
+#define PDB_INDEX_DBG_HEADER_OMAP_FROM_SOURCE 4
+#define PDB_INDEX_DBG_HEADER_SECTION_HEADERS  5
+
+#define PDB_INDEX_S_LDATA32    0x110c
+#define PDB_INDEX_S_GDATA32    0x110d
+#define PDB_INDEX_S_PUB32      0x110e
+#define PDB_INDEX_S_LPROC32    0x110f
+#define PDB_INDEX_S_GPROC32    0x1110
+#define PDB_INDEX_S_LPROC32_ID 0x1146
+#define PDB_INDEX_S_GPROC32_ID 0x1147
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Kinds of the indexed symbols
+ *
+ */
+typedef enum _PDB_INDEX_SYMBOL_KIND
+{
+    PDB_INDEX_SYMBOL_PUBLIC,
+    PDB_INDEX_SYMBOL_FUNCTION,
+    PDB_INDEX_SYMBOL_DATA,
+
+} PDB_INDEX_SYMBOL_KIND;
+
+/**
+ * @brief Identity of a PDB file (from its PDB info stream)
+ *
+ */
+typedef struct _PDB_INDEX_PDB_INFO
+{
+    UINT32 Signature;
+    UINT32 Age;
+    UINT8  Guid[16];
+    UINT64 FileSize;
+
+} PDB_INDEX_PDB_INFO, *PPDB_INDEX_PDB_INFO;
+
+/**
+ * @brief An indexed symbol
+ *
+ */
+typedef struct _PDB_INDEX_SYMBOL
+{
+    UINT32 Rva;
+    UINT32 Size;       // Size of the functions (zero if it's not known)
+    UINT32 NameOffset; // Offset of the name in the names
+    UINT32 NameHash;
+    UINT32 Next; // Next symbol of the bucket
+    UINT16 Kind;
+    UINT16 Reserved;
+
+} PDB_INDEX_SYMBOL, *PPDB_INDEX_SYMBOL;
+
+/**
+ * @brief A mapped PDB (MSF) file
+ *
+ */
+typedef struct _PDB_INDEX_MSF
+{
+    const UINT8 * Pdb;
+    UINT64        PdbSize;
+    UINT32        BlockSize;
+    UINT32        BlockCount;
+    const UINT8 * DirectoryBlocks; // Block numbers of the stream directory
+    UINT32        DirectorySize;
+    UINT32        StreamCount;
+
+} PDB_INDEX_MSF, *PPDB_INDEX_MSF;
+
+/**
+ * @brief A stream of a PDB file
+ * @details The blocks of the streams are not contiguous, the list of their
+ * blocks is in the stream directory
+ *
+ */
+typedef struct _PDB_INDEX_STREAM
+{
+    PPDB_INDEX_MSF Msf;
+    UINT32         Size;
+    UINT32         BlockListOffset; // Offset of the list of the blocks in the directory
+    BOOLEAN        IsDirectory;
+
+} PDB_INDEX_STREAM, *PPDB_INDEX_STREAM;
+
+/**
+ * @brief Header of an index
+ * @details The index is position independent, so it's used directly from
+ * the mapped index file. The symbols are sorted by their RVAs, and they're
+ * also chained in the buckets of the hash of their (case-insensitive) names.
+ * All of the offsets are from the start of the header
+ *
+ */
+typedef struct _PDB_INDEX_HEADER
+{
+    UINT32             Magic;
+    UINT32             Version;
+    PDB_INDEX_PDB_INFO PdbInfo;
+    UINT32             TotalSize;
+    UINT32             SymbolCount;
+    UINT32             SymbolsOffset;
+    UINT32             BucketCount; // A power of two
+    UINT32             BucketsOffset;
+    UINT32             NamesOffset;
+    UINT32             NamesSize;
+    UINT32             Reserved;
+
+} PDB_INDEX_HEADER, *PPDB_INDEX_HEADER;
+
+/**
+ * @brief State of building an index
+ * @details The symbols are counted first (without an index), then they're
+ * added to the index
+ *
+ */
+typedef struct _PDB_INDEX_BUILDER
+{
+    PDB_INDEX_MSF      Msf;
+    PDB_INDEX_STREAM   SectionHeaders;
+    PPDB_INDEX_HEADER  Header;
+    PDB_INDEX_SYMBOL * Symbols;
+    CHAR *             Names;
+    UINT32             SymbolCount;
+    UINT64             NamesSize;
+    UINT8              Record[PDB_INDEX_MAXIMUM_RECORD_SIZE];
+
+} PDB_INDEX_BUILDER, *PPDB_INDEX_BUILDER;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+PdbIndexGetPdbInfo(const VOID * Pdb, UINT64 PdbSize, PPDB_INDEX_PDB_INFO PdbInfo);
+
+BOOLEAN
+PdbIndexGetRequiredSize(const VOID * Pdb, UINT64 PdbSize, UINT32 * IndexSize);
+
+BOOLEAN
+PdbIndexBuild(const VOID * Pdb, UINT64 PdbSize, VOID * Index, UINT32 IndexSize);
+
+BOOLEAN
+PdbIndexValidate(const VOID * Index, UINT64 IndexSize, const PDB_INDEX_PDB_INFO * PdbInfo);
+
+const PDB_INDEX_SYMBOL *
+PdbIndexFindByName(const VOID * Index, const CHAR * Name);
+
+const PDB_INDEX_SYMBOL *
+PdbIndexFindByRva(const VOID * Index, UINT32 Rva, UINT32 * Displacement);
+
+const PDB_INDEX_SYMBOL *
+PdbIndexGetSymbol(const VOID * Index, UINT32 SymbolIndex);
+
+UINT32
+PdbIndexGetSymbolCount(const VOID * Index);
+
+const CHAR *
+PdbIndexGetSymbolName(const VOID * Index, const PDB_INDEX_SYMBOL * Symbol);
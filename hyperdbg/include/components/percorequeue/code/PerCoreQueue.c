@@ -0,0 +1,305 @@
+/**
+ * @file PerCoreQueue.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the per-core lock-free queues
+ * @details Each core writes its records to its own single-producer
+ * single-consumer queue without taking any lock, the only shared write is
+ * the increment of the global sequence number. The consumer merges the
+ * queues in the order of the sequence numbers, so the records of each core
+ * remain in order. This file doesn't use any platform-specific function
+ * except the atomic operations in the header
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the size of the buffer that should be allocated for the queues
+ *
+ * @param QueueCount
+ * @param QueueSize Size of the buffer of each queue
+ *
+ * @return UINT64
+ */
+UINT64
+PerCoreQueuesGetRequiredSize(UINT32 QueueCount, UINT32 QueueSize)
+{
+    QueueSize = QueueSize & ~(PER_CORE_QUEUE_RECORD_ALIGNMENT - 1);
+
+    return (UINT64)QueueCount * (sizeof(PER_CORE_QUEUE) + QueueSize);
+}
+
+/**
+ * @brief Initialize the queues
+ *
+ * @param Queues
+ * @param Buffer A buffer with the size of PerCoreQueuesGetRequiredSize
+ * @param QueueCount
+ * @param QueueSize Size of the buffer of each queue
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PerCoreQueuesInitialize(PPER_CORE_QUEUES Queues, PVOID Buffer, UINT32 QueueCount, UINT32 QueueSize)
+{
+    UINT8 * QueueBuffer;
+
+    memset(Queues, 0, sizeof(PER_CORE_QUEUES));
+
+    //
+    // Headers should never be split, so the size is aligned
+    //
+    QueueSize = QueueSize & ~(PER_CORE_QUEUE_RECORD_ALIGNMENT - 1);
+
+    if (Buffer == NULL || QueueCount == 0 || QueueSize < PER_CORE_QUEUE_RECORD_SIZE(0))
+    {
+        return FALSE;
+    }
+
+    memset(Buffer, 0, (size_t)PerCoreQueuesGetRequiredSize(QueueCount, QueueSize));
+
+    //
+    // The queue structures are placed first (so they're aligned to the cache
+    // lines if the buffer is) and the buffers of the records are after them
+    //
+    Queues->Queues     = (PPER_CORE_QUEUE)Buffer;
+    Queues->QueueCount = QueueCount;
+
+    QueueBuffer = (UINT8 *)Buffer + (UINT64)QueueCount * sizeof(PER_CORE_QUEUE);
+
+    for (UINT32 i = 0; i < QueueCount; i++)
+    {
+        Queues->Queues[i].Buffer = QueueBuffer + (UINT64)i * QueueSize;
+        Queues->Queues[i].Size   = QueueSize;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Write a record to the queue of a core
+ * @details Should only be called on the owner core (there should be only
+ * one producer for each queue)
+ *
+ * @param Queues
+ * @param Core
+ * @param OperationNumber
+ * @param Buffer
+ * @param BufferLength
+ *
+ * @return BOOLEAN FALSE if the queue is full and the record is dropped
+ */
+BOOLEAN
+PerCoreQueuesWrite(PPER_CORE_QUEUES Queues, UINT32 Core, UINT32 OperationNumber, PVOID Buffer, UINT32 BufferLength)
+{
+    PPER_CORE_QUEUE              Queue = &Queues->Queues[Core];
+    PER_CORE_QUEUE_RECORD_HEADER Header;
+    UINT64                       RecordSize    = PER_CORE_QUEUE_RECORD_SIZE(BufferLength);
+    UINT64                       WritePosition = Queue->WritePosition;
+    UINT64                       BodyOffset;
+    UINT64                       FirstPart;
+
+    //
+    // The read position is only loaded from the consumer's cache line if the
+    // last seen position is not enough for the new record
+    //
+    if (WritePosition + RecordSize - Queue->CachedReadPosition > Queue->Size)
+    {
+        Queue->CachedReadPosition = PerCoreQueueLoadAcquire(&Queue->ReadPosition);
+
+        if (WritePosition + RecordSize - Queue->CachedReadPosition > Queue->Size)
+        {
+            //
+            // The consumer can't be blocked, so the new record is dropped
+            //
+            Queue->DroppedCount++;
+            return FALSE;
+        }
+    }
+
+    Header.Sequence        = PerCoreQueueIncrement(&Queues->Sequence);
+    Header.OperationNumber = OperationNumber;
+    Header.BufferLength    = BufferLength;
+
+    //
+    // The header never wraps as both the positions and the size are aligned
+    //
+    memcpy(Queue->Buffer + WritePosition % Queue->Size, &Header, sizeof(PER_CORE_QUEUE_RECORD_HEADER));
+
+    BodyOffset = (WritePosition + sizeof(PER_CORE_QUEUE_RECORD_HEADER)) % Queue->Size;
+    FirstPart  = Queue->Size - BodyOffset;
+
+    if (BufferLength <= FirstPart)
+    {
+        memcpy(Queue->Buffer + BodyOffset, Buffer, BufferLength);
+    }
+    else
+    {
+        memcpy(Queue->Buffer + BodyOffset, Buffer, (size_t)FirstPart);
+        memcpy(Queue->Buffer, (UINT8 *)Buffer + FirstPart, (size_t)(BufferLength - FirstPart));
+    }
+
+    //
+    // Publish the record
+    //
+    PerCoreQueueStoreRelease(&Queue->WritePosition, WritePosition + RecordSize);
+
+    return TRUE;
+}
+
+/**
+ * @brief Checks whether a record could be written to the queue of a core
+ *
+ * @param Queues
+ * @param Core
+ * @param BufferLength Length of the body of the record
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PerCoreQueuesCheckIfFull(PPER_CORE_QUEUES Queues, UINT32 Core, UINT32 BufferLength)
+{
+    PPER_CORE_QUEUE Queue = &Queues->Queues[Core];
+
+    return Queue->WritePosition + PER_CORE_QUEUE_RECORD_SIZE(BufferLength) -
+               PerCoreQueueLoadAcquire(&Queue->ReadPosition) >
+           Queue->Size;
+}
+
+/**
+ * @brief Check whether there is any unread record in the queues
+ *
+ * @param Queues
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+PerCoreQueuesIsEmpty(PPER_CORE_QUEUES Queues)
+{
+    for (UINT32 i = 0; i < Queues->QueueCount; i++)
+    {
+        if (Queues->Queues[i].ReadPosition != PerCoreQueueLoadAcquire(&Queues->Queues[i].WritePosition))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read (and remove) the record with the lowest sequence number
+ * @details The caller should serialize the consumers
+ *
+ * @param Queues
+ * @param OperationNumber The operation number of the record
+ * @param Sequence The global sequence number of the record
+ * @param BufferToSave Target buffer to save the body of the record
+ * @param BufferToSaveSize Size of the target buffer
+ * @param ReturnedLength Length of the body of the record
+ *
+ * @return BOOLEAN FALSE if there is no record or the target buffer is small
+ */
+BOOLEAN
+PerCoreQueuesRead(PPER_CORE_QUEUES Queues,
+                  UINT32 *         OperationNumber,
+                  UINT64 *         Sequence,
+                  PVOID            BufferToSave,
+                  UINT32           BufferToSaveSize,
+                  UINT32 *         ReturnedLength)
+{
+    PPER_CORE_QUEUE               Queue  = NULL;
+    PPER_CORE_QUEUE_RECORD_HEADER Header = NULL;
+    PPER_CORE_QUEUE_RECORD_HEADER CurrentHeader;
+    UINT64                        BodyOffset;
+    UINT64                        FirstPart;
+
+    //
+    // Find the oldest record between the heads of the queues
+    //
+    for (UINT32 i = 0; i < Queues->QueueCount; i++)
+    {
+        PPER_CORE_QUEUE CurrentQueue = &Queues->Queues[i];
+
+        if (CurrentQueue->ReadPosition == PerCoreQueueLoadAcquire(&CurrentQueue->WritePosition))
+        {
+            continue;
+        }
+
+        CurrentHeader = (PPER_CORE_QUEUE_RECORD_HEADER)(CurrentQueue->Buffer + CurrentQueue->ReadPosition % CurrentQueue->Size);
+
+        if (Header == NULL || CurrentHeader->Sequence < Header->Sequence)
+        {
+            Queue  = CurrentQueue;
+            Header = CurrentHeader;
+        }
+    }
+
+    if (Header == NULL || Header->BufferLength > BufferToSaveSize)
+    {
+        return FALSE;
+    }
+
+    BodyOffset = (Queue->ReadPosition + sizeof(PER_CORE_QUEUE_RECORD_HEADER)) % Queue->Size;
+    FirstPart  = Queue->Size - BodyOffset;
+
+    if (Header->BufferLength <= FirstPart)
+    {
+        memcpy(BufferToSave, Queue->Buffer + BodyOffset, Header->BufferLength);
+    }
+    else
+    {
+        memcpy(BufferToSave, Queue->Buffer + BodyOffset, (size_t)FirstPart);
+        memcpy((UINT8 *)BufferToSave + FirstPart, Queue->Buffer, (size_t)(Header->BufferLength - FirstPart));
+    }
+
+    *OperationNumber = Header->OperationNumber;
+    *Sequence        = Header->Sequence;
+    *ReturnedLength  = Header->BufferLength;
+
+    //
+    // Release the space of the record to the producer
+    //
+    PerCoreQueueStoreRelease(&Queue->ReadPosition, Queue->ReadPosition + PER_CORE_QUEUE_RECORD_SIZE(Header->BufferLength));
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove all of the unread records
+ * @details The caller should serialize the consumers
+ *
+ * @param Queues
+ *
+ * @return UINT32 Number of removed records
+ */
+UINT32
+PerCoreQueuesDiscardAll(PPER_CORE_QUEUES Queues)
+{
+    UINT32 RecordCount = 0;
+
+    for (UINT32 i = 0; i < Queues->QueueCount; i++)
+    {
+        PPER_CORE_QUEUE Queue         = &Queues->Queues[i];
+        UINT64          ReadPosition  = Queue->ReadPosition;
+        UINT64          WritePosition = PerCoreQueueLoadAcquire(&Queue->WritePosition);
+
+        //
+        // Records are walked to count them
+        //
+        while (ReadPosition != WritePosition)
+        {
+            PPER_CORE_QUEUE_RECORD_HEADER Header = (PPER_CORE_QUEUE_RECORD_HEADER)(Queue->Buffer + ReadPosition % Queue->Size);
+
+            ReadPosition += PER_CORE_QUEUE_RECORD_SIZE(Header->BufferLength);
+            RecordCount++;
+        }
+
+        PerCoreQueueStoreRelease(&Queue->ReadPosition, ReadPosition);
+    }
+
+    return RecordCount;
+}
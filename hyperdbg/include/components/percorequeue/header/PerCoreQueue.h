@@ -0,0 +1,138 @@
+/**
+ * @file PerCoreQueue.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the per-core lock-free queues
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Alignment of the records (and the size of each queue)
+ *
+ */
+#define PER_CORE_QUEUE_RECORD_ALIGNMENT 8
+
+/**
+ * @brief Size of a record (header + aligned body) that holds a buffer with
+ * the specified length
+ *
+ */
+#define PER_CORE_QUEUE_RECORD_SIZE(BufferLength)                                                         \
+    ((sizeof(PER_CORE_QUEUE_RECORD_HEADER) + (BufferLength) + PER_CORE_QUEUE_RECORD_ALIGNMENT - 1) & \
+     ~((UINT64)PER_CORE_QUEUE_RECORD_ALIGNMENT - 1))
+
+/**
+ * @brief Size of a cache line, the producer and the consumer fields of the
+ * queues are placed on different cache lines
+ *
+ */
+#define PER_CORE_QUEUE_CACHE_LINE_SIZE 64
+
+//
+// Atomic operations (only 64-bit loads, stores and increments are needed)
+//
+#ifdef _MSC_VER
+#    define PerCoreQueueLoadAcquire(Address)         ((UINT64)ReadAcquire64((volatile LONG64 *)(Address)))
+#    define PerCoreQueueStoreRelease(Address, Value) WriteRelease64((volatile LONG64 *)(Address), (LONG64)(Value))
+#    define PerCoreQueueIncrement(Address)           ((UINT64)InterlockedIncrement64((volatile LONG64 *)(Address)))
+#else
+#    define PerCoreQueueLoadAcquire(Address)         __atomic_load_n((Address), __ATOMIC_ACQUIRE)
+#    define PerCoreQueueStoreRelease(Address, Value) __atomic_store_n((Address), (Value), __ATOMIC_RELEASE)
+#    define PerCoreQueueIncrement(Address)           __atomic_add_fetch((Address), 1, __ATOMIC_SEQ_CST)
+#endif // _MSC_VER
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of each record in the queues
+ *
+ */
+typedef struct _PER_CORE_QUEUE_RECORD_HEADER
+{
+    UINT64 Sequence;        // Global sequence number of the record
+    UINT32 OperationNumber; // Operation ID to user-mode
+    UINT32 BufferLength;    // The actual length of the body
+
+} PER_CORE_QUEUE_RECORD_HEADER, *PPER_CORE_QUEUE_RECORD_HEADER;
+
+/**
+ * @brief A single-producer single-consumer queue of variable-length records
+ * @details Positions are not wrapped (they only grow), the offset in the
+ * buffer is the position modulo the size of the buffer
+ *
+ */
+typedef struct _PER_CORE_QUEUE
+{
+    //
+    // Written by the producer (the owner core)
+    //
+    volatile UINT64 WritePosition;      // Position that the next record is written to
+    UINT64          CachedReadPosition; // Last seen ReadPosition (avoids touching the consumer's line)
+    UINT64          DroppedCount;       // Number of records that are dropped as the queue was full
+    UINT8 *         Buffer;             // Start address of the buffer
+    UINT64          Size;               // Size of the buffer
+    UINT8           ProducerPadding[PER_CORE_QUEUE_CACHE_LINE_SIZE - 5 * sizeof(UINT64)];
+
+    //
+    // Written by the consumer
+    //
+    volatile UINT64 ReadPosition; // Position of the oldest (unread) record
+    UINT8           ConsumerPadding[PER_CORE_QUEUE_CACHE_LINE_SIZE - sizeof(UINT64)];
+
+} PER_CORE_QUEUE, *PPER_CORE_QUEUE;
+
+/**
+ * @brief Queues of all cores
+ * @details Each core only writes to its own queue, a single consumer (the
+ * caller should serialize the consumers) merges the queues by the global
+ * sequence number of the records
+ *
+ */
+typedef struct _PER_CORE_QUEUES
+{
+    PPER_CORE_QUEUE Queues;     // One queue for each core
+    UINT32          QueueCount; // Number of cores
+    volatile UINT64 Sequence;   // The last global sequence number
+
+} PER_CORE_QUEUES, *PPER_CORE_QUEUES;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+PerCoreQueuesGetRequiredSize(UINT32 QueueCount, UINT32 QueueSize);
+
+BOOLEAN
+PerCoreQueuesInitialize(PPER_CORE_QUEUES Queues, PVOID Buffer, UINT32 QueueCount, UINT32 QueueSize);
+
+BOOLEAN
+PerCoreQueuesWrite(PPER_CORE_QUEUES Queues, UINT32 Core, UINT32 OperationNumber, PVOID Buffer, UINT32 BufferLength);
+
+BOOLEAN
+PerCoreQueuesCheckIfFull(PPER_CORE_QUEUES Queues, UINT32 Core, UINT32 BufferLength);
+
+BOOLEAN
+PerCoreQueuesIsEmpty(PPER_CORE_QUEUES Queues);
+
+BOOLEAN
+PerCoreQueuesRead(PPER_CORE_QUEUES Queues,
+                  UINT32 *         OperationNumber,
+                  UINT64 *         Sequence,
+                  PVOID            BufferToSave,
+                  UINT32           BufferToSaveSize,
+                  UINT32 *         ReturnedLength);
+
+UINT32
+PerCoreQueuesDiscardAll(PPER_CORE_QUEUES Queues);
@@ -0,0 +1,259 @@
+/**
+ * @file RingBuffer.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the variable-length record ring buffer
+ * @details Records (header + body) are packed contiguously, so a small
+ * message only takes as much space as its length instead of a full chunk.
+ * This file doesn't use any platform-specific function and the caller is
+ * responsible for synchronization
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Initialize the ring buffer
+ *
+ * @param Ring
+ * @param Buffer The buffer that holds the records
+ * @param Size Size of the buffer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+RingBufferInitialize(PRING_BUFFER Ring, PVOID Buffer, UINT32 Size)
+{
+    memset(Ring, 0, sizeof(RING_BUFFER));
+
+    //
+    // Headers should never be split, so the size is aligned
+    //
+    Size = Size & ~(RING_BUFFER_RECORD_ALIGNMENT - 1);
+
+    if (Buffer == NULL || Size < RING_BUFFER_RECORD_SIZE(0))
+    {
+        return FALSE;
+    }
+
+    Ring->Buffer = (UINT8 *)Buffer;
+    Ring->Size   = Size;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether there is any unread record in the ring buffer
+ *
+ * @param Ring
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+RingBufferIsEmpty(PRING_BUFFER Ring)
+{
+    return Ring->RecordCount == 0;
+}
+
+/**
+ * @brief Checks whether writing a record would overwrite unread records
+ *
+ * @param Ring
+ * @param BufferLength Length of the body of the record
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+RingBufferCheckIfFull(PRING_BUFFER Ring, UINT32 BufferLength)
+{
+    return RING_BUFFER_RECORD_SIZE(BufferLength) > (UINT64)Ring->Size - Ring->UsedSize;
+}
+
+/**
+ * @brief Copy to the ring buffer, the target might wrap around the end
+ *
+ * @param Ring
+ * @param Offset
+ * @param Source
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+RingBufferCopyTo(PRING_BUFFER Ring, UINT32 Offset, const VOID * Source, UINT32 Length)
+{
+    UINT32 FirstPart = Ring->Size - Offset;
+
+    if (Length <= FirstPart)
+    {
+        memcpy(Ring->Buffer + Offset, Source, Length);
+        return;
+    }
+
+    memcpy(Ring->Buffer + Offset, Source, FirstPart);
+    memcpy(Ring->Buffer, (const UINT8 *)Source + FirstPart, Length - FirstPart);
+}
+
+/**
+ * @brief Copy from the ring buffer, the source might wrap around the end
+ *
+ * @param Ring
+ * @param Offset
+ * @param Destination
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+RingBufferCopyFrom(PRING_BUFFER Ring, UINT32 Offset, VOID * Destination, UINT32 Length)
+{
+    UINT32 FirstPart = Ring->Size - Offset;
+
+    if (Length <= FirstPart)
+    {
+        memcpy(Destination, Ring->Buffer + Offset, Length);
+        return;
+    }
+
+    memcpy(Destination, Ring->Buffer + Offset, FirstPart);
+    memcpy((UINT8 *)Destination + FirstPart, Ring->Buffer, Length - FirstPart);
+}
+
+/**
+ * @brief Remove the oldest record of the ring buffer
+ *
+ * @param Ring
+ *
+ * @return VOID
+ */
+static VOID
+RingBufferRemoveOldest(PRING_BUFFER Ring)
+{
+    PRING_BUFFER_RECORD_HEADER Header     = (PRING_BUFFER_RECORD_HEADER)(Ring->Buffer + Ring->ReadOffset);
+    UINT32                     RecordSize = (UINT32)RING_BUFFER_RECORD_SIZE(Header->BufferLength);
+
+    Ring->ReadOffset = (UINT32)(((UINT64)Ring->ReadOffset + RecordSize) % Ring->Size);
+    Ring->UsedSize -= RecordSize;
+    Ring->RecordCount--;
+}
+
+/**
+ * @brief Write a record to the ring buffer
+ * @details If there is not enough space, the oldest records are overwritten
+ *
+ * @param Ring
+ * @param OperationNumber
+ * @param Buffer
+ * @param BufferLength
+ *
+ * @return BOOLEAN FALSE if the record is larger than the ring buffer
+ */
+BOOLEAN
+RingBufferWrite(PRING_BUFFER Ring, UINT32 OperationNumber, PVOID Buffer, UINT32 BufferLength)
+{
+    RING_BUFFER_RECORD_HEADER Header;
+    UINT64                    RecordSize = RING_BUFFER_RECORD_SIZE(BufferLength);
+
+    if (RecordSize > Ring->Size)
+    {
+        return FALSE;
+    }
+
+    //
+    // Overwrite the oldest records until the new record fits
+    //
+    while (RecordSize > (UINT64)Ring->Size - Ring->UsedSize)
+    {
+        RingBufferRemoveOldest(Ring);
+        Ring->LostCount++;
+    }
+
+    Header.OperationNumber = OperationNumber;
+    Header.BufferLength    = BufferLength;
+
+    //
+    // The header never wraps as both the offset and the size are aligned
+    //
+    memcpy(Ring->Buffer + Ring->WriteOffset, &Header, sizeof(RING_BUFFER_RECORD_HEADER));
+
+    RingBufferCopyTo(Ring,
+                     (UINT32)(((UINT64)Ring->WriteOffset + sizeof(RING_BUFFER_RECORD_HEADER)) % Ring->Size),
+                     Buffer,
+                     BufferLength);
+
+    Ring->WriteOffset = (UINT32)(((UINT64)Ring->WriteOffset + RecordSize) % Ring->Size);
+    Ring->UsedSize += (UINT32)RecordSize;
+
+    //
+    // The record count is updated last, it's checked without holding the lock
+    //
+    Ring->RecordCount++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read (and remove) the oldest record of the ring buffer
+ *
+ * @param Ring
+ * @param OperationNumber The operation number of the record
+ * @param BufferToSave Target buffer to save the body of the record
+ * @param BufferToSaveSize Size of the target buffer
+ * @param ReturnedLength Length of the body of the record
+ *
+ * @return BOOLEAN FALSE if there is no record or the target buffer is small
+ */
+BOOLEAN
+RingBufferRead(PRING_BUFFER Ring,
+               UINT32 *     OperationNumber,
+               PVOID        BufferToSave,
+               UINT32       BufferToSaveSize,
+               UINT32 *     ReturnedLength)
+{
+    PRING_BUFFER_RECORD_HEADER Header;
+
+    if (Ring->RecordCount == 0)
+    {
+        return FALSE;
+    }
+
+    Header = (PRING_BUFFER_RECORD_HEADER)(Ring->Buffer + Ring->ReadOffset);
+
+    if (Header->BufferLength > BufferToSaveSize)
+    {
+        return FALSE;
+    }
+
+    RingBufferCopyFrom(Ring,
+                       (UINT32)(((UINT64)Ring->ReadOffset + sizeof(RING_BUFFER_RECORD_HEADER)) % Ring->Size),
+                       BufferToSave,
+                       Header->BufferLength);
+
+    *OperationNumber = Header->OperationNumber;
+    *ReturnedLength  = Header->BufferLength;
+
+    RingBufferRemoveOldest(Ring);
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove all of the unread records
+ *
+ * @param Ring
+ *
+ * @return UINT32 Number of removed records
+ */
+UINT32
+RingBufferDiscardAll(PRING_BUFFER Ring)
+{
+    UINT32 RecordCount = Ring->RecordCount;
+
+    Ring->ReadOffset  = Ring->WriteOffset;
+    Ring->UsedSize    = 0;
+    Ring->RecordCount = 0;
+
+    return RecordCount;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file RingBuffer.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the variable-length record ring buffer
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Alignment of the records (and the size of the ring buffer)
+ *
+ */
+#define RING_BUFFER_RECORD_ALIGNMENT 8
+
+/**
+ * @brief Size of a record (header + aligned body) that holds a buffer with
+ * the specified length
+ *
+ */
+#define RING_BUFFER_RECORD_SIZE(BufferLength)                                                      \
+    ((sizeof(RING_BUFFER_RECORD_HEADER) + (BufferLength) + RING_BUFFER_RECORD_ALIGNMENT - 1) & \
+     ~((UINT64)RING_BUFFER_RECORD_ALIGNMENT - 1))
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of each record in the ring buffer
+ *
+ */
+typedef struct _RING_BUFFER_RECORD_HEADER
+{
+    UINT32 OperationNumber; // Operation ID to user-mode
+    UINT32 BufferLength;    // The actual length of the body
+
+} RING_BUFFER_RECORD_HEADER, *PRING_BUFFER_RECORD_HEADER;
+
+/**
+ * @brief A ring buffer of variable-length records
+ * @details The ring buffer itself is not synchronized, the caller should
+ * hold a lock for both writing and reading
+ *
+ */
+typedef struct _RING_BUFFER
+{
+    UINT8 * Buffer; // Start address of the buffer
+    UINT32  Size;   // Size of the buffer (aligned to RING_BUFFER_RECORD_ALIGNMENT)
+
+    UINT32 ReadOffset;  // Offset of the oldest (unread) record
+    UINT32 WriteOffset; // Offset that the next record is written to
+    UINT32 UsedSize;    // Size of the unread records
+
+    volatile UINT32 RecordCount; // Number of unread records
+    UINT64          LostCount;   // Number of records that are overwritten before they're read
+
+} RING_BUFFER, *PRING_BUFFER;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+Records are packed one after another, the header is always contiguous (the
+offsets and the size are aligned) but the body of a record might wrap around
+the end of the buffer. Once there is not enough space for a new record, the
+oldest records are overwritten.
+
+             _________________________
+            |       body (cont.)      |
+            |_________________________|  <-- ReadOffset
+            |  RING_BUFFER_RECORD_HDR |
+            |_________________________|
+            |           body          |
+            |_________________________|
+            |  RING_BUFFER_RECORD_HDR |
+            |_________________________|
+            |           body          |
+            |_________________________|  <-- WriteOffset
+            |                         |
+            |          (free)         |
+            |_________________________|
+            |  RING_BUFFER_RECORD_HDR |
+            |_________________________|
+            |           body          |
+            |_________________________|
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+RingBufferInitialize(PRING_BUFFER Ring, PVOID Buffer, UINT32 Size);
+
+BOOLEAN
+RingBufferIsEmpty(PRING_BUFFER Ring);
+
+BOOLEAN
+RingBufferCheckIfFull(PRING_BUFFER Ring, UINT32 BufferLength);
+
+BOOLEAN
+RingBufferWrite(PRING_BUFFER Ring, UINT32 OperationNumber, PVOID Buffer, UINT32 BufferLength);
+
+BOOLEAN
+RingBufferRead(PRING_BUFFER Ring,
+               UINT32 *     OperationNumber,
+               PVOID        BufferToSave,
+               UINT32       BufferToSaveSize,
+               UINT32 *     ReturnedLength);
+
+UINT32
+RingBufferDiscardAll(PRING_BUFFER Ring);
@@ -0,0 +1,98 @@
+/**
+ * @file SerialFrame.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the framing of the serial (kernel debugger) transport
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Signature at the start of each frame ('HDBF')
+ *
+ */
+#define SERIAL_FRAME_MAGIC 0x46424448
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Header of a frame
+ * @details The payload is right after the header. The complement of the
+ * length is used to find the real headers after a corruption (or when a
+ * frame is received from its middle), the payload is checked by CRC32
+ *
+ */
+typedef struct _SERIAL_FRAME_HEADER
+{
+    UINT32 Magic;
+    UINT32 Length;      // Length of the payload
+    UINT32 LengthCheck; // Complement of the length
+    UINT32 Crc32;       // CRC32 of the payload
+
+} SERIAL_FRAME_HEADER, *PSERIAL_FRAME_HEADER;
+
+/**
+ * @brief Reassembles the frames from the bytes that are received in bulk
+ * @details The bytes are read directly into a ring (its capacity should be
+ * a power of two and a whole frame should fit in it). The frames that are
+ * received together are kept in the ring until they're read
+ *
+ */
+typedef struct _SERIAL_FRAME_RECEIVER
+{
+    UINT8 * Ring;
+    UINT32  Capacity;
+    UINT32  MaximumPayloadLength;
+    UINT64  ReadPosition;
+    UINT64  WritePosition;
+    UINT64  DiscardedBytes;  // Bytes that are skipped to find the next frame
+    UINT64  CorruptedFrames; // Frames with an invalid CRC32
+
+} SERIAL_FRAME_RECEIVER, *PSERIAL_FRAME_RECEIVER;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT32
+SerialFrameCrc32(UINT32 Crc, const VOID * Buffer, UINT32 Length);
+
+VOID
+SerialFrameInitializeHeader(PSERIAL_FRAME_HEADER Header);
+
+VOID
+SerialFrameAppendToHeader(PSERIAL_FRAME_HEADER Header, const VOID * Buffer, UINT32 Length);
+
+VOID
+SerialFrameFinalizeHeader(PSERIAL_FRAME_HEADER Header);
+
+BOOLEAN
+SerialFrameCheckHeader(const SERIAL_FRAME_HEADER * Header, UINT32 MaximumPayloadLength);
+
+BOOLEAN
+SerialFrameReceiverInitialize(PSERIAL_FRAME_RECEIVER Receiver,
+                              UINT8 *                Ring,
+                              UINT32                 Capacity,
+                              UINT32                 MaximumPayloadLength);
+
+UINT8 *
+SerialFrameReceiverGetWriteBuffer(PSERIAL_FRAME_RECEIVER Receiver, UINT32 * Length);
+
+VOID
+SerialFrameReceiverCommit(PSERIAL_FRAME_RECEIVER Receiver, UINT32 Length);
+
+UINT32
+SerialFrameReceiverWrite(PSERIAL_FRAME_RECEIVER Receiver, const VOID * Buffer, UINT32 Length);
+
+BOOLEAN
+SerialFrameReceiverRead(PSERIAL_FRAME_RECEIVER Receiver, VOID * Buffer, UINT32 * Length);
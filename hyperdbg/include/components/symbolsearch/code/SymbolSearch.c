@@ -0,0 +1,780 @@
+/**
+ * @file SymbolSearch.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the wildcard search index of the names of the symbols
+ * @details The index is built once for the names of a module, then each mask
+ * (e.g., 'nt!*Pool*') only checks the names of the smallest candidate set of
+ * the mask, instead of checking all of the names of the module
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Convert a character to lowercase
+ *
+ * @param Ch
+ *
+ * @return UINT8
+ */
+static UINT8
+SymbolSearchToLower(CHAR Ch)
+{
+    if (Ch >= 'A' && Ch <= 'Z')
+    {
+        return (UINT8)(Ch - 'A' + 'a');
+    }
+
+    return (UINT8)Ch;
+}
+
+/**
+ * @brief Check whether a character of a mask is a wildcard
+ *
+ * @param Ch
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymbolSearchIsWildcard(CHAR Ch)
+{
+    return Ch == '*' || Ch == '?';
+}
+
+/**
+ * @brief Get the bucket of the trigram at the start of a text
+ *
+ * @param Text
+ *
+ * @return UINT32
+ */
+static UINT32
+SymbolSearchGetBucket(const CHAR * Text)
+{
+    UINT32 Trigram = (UINT32)SymbolSearchToLower(Text[0]) << 16 |
+                     (UINT32)SymbolSearchToLower(Text[1]) << 8 |
+                     (UINT32)SymbolSearchToLower(Text[2]);
+
+    return (Trigram * 0x9e3779b1) >> 16 & (SYMBOL_SEARCH_BUCKET_COUNT - 1);
+}
+
+/**
+ * @brief Compare two names (case-insensitive)
+ *
+ * @param Index
+ * @param First
+ * @param Second
+ * @param IsReverse Whether the reversed names are compared
+ *
+ * @return INT32
+ */
+static INT32
+SymbolSearchCompareNames(PSYMBOL_SEARCH_INDEX Index, UINT32 First, UINT32 Second, BOOLEAN IsReverse)
+{
+    const CHAR * FirstName    = Index->Names[First];
+    const CHAR * SecondName   = Index->Names[Second];
+    UINT32       FirstLength  = Index->Lengths[First];
+    UINT32       SecondLength = Index->Lengths[Second];
+
+    for (UINT32 i = 0; i < FirstLength && i < SecondLength; i++)
+    {
+        UINT8 FirstCh  = SymbolSearchToLower(IsReverse ? FirstName[FirstLength - 1 - i] : FirstName[i]);
+        UINT8 SecondCh = SymbolSearchToLower(IsReverse ? SecondName[SecondLength - 1 - i] : SecondName[i]);
+
+        if (FirstCh != SecondCh)
+        {
+            return FirstCh < SecondCh ? -1 : 1;
+        }
+    }
+
+    if (FirstLength != SecondLength)
+    {
+        return FirstLength < SecondLength ? -1 : 1;
+    }
+
+    //
+    // The same names are sorted by their ids
+    //
+    return First < Second ? -1 : (First > Second ? 1 : 0);
+}
+
+/**
+ * @brief Compare the start (or the end) of a name with a literal part of a
+ * mask (case-insensitive)
+ *
+ * @param Index
+ * @param Id
+ * @param Literal
+ * @param LiteralLength
+ * @param IsReverse Whether the end of the name is compared
+ *
+ * @return INT32 Zero if the name starts (or ends) with the literal
+ */
+static INT32
+SymbolSearchCompareLiteral(PSYMBOL_SEARCH_INDEX Index,
+                           UINT32               Id,
+                           const CHAR *         Literal,
+                           UINT32               LiteralLength,
+                           BOOLEAN              IsReverse)
+{
+    const CHAR * Name   = Index->Names[Id];
+    UINT32       Length = Index->Lengths[Id];
+
+    for (UINT32 i = 0; i < LiteralLength; i++)
+    {
+        UINT8 NameCh;
+        UINT8 LiteralCh;
+
+        if (i == Length)
+        {
+            return -1;
+        }
+
+        NameCh    = SymbolSearchToLower(IsReverse ? Name[Length - 1 - i] : Name[i]);
+        LiteralCh = SymbolSearchToLower(IsReverse ? Literal[LiteralLength - 1 - i] : Literal[i]);
+
+        if (NameCh != LiteralCh)
+        {
+            return NameCh < LiteralCh ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the sort key of a name (its first, or its last, 8 characters)
+ *
+ * @param Index
+ * @param Id
+ * @param IsReverse Whether the key is the reversed end of the name
+ *
+ * @return UINT64
+ */
+static UINT64
+SymbolSearchGetSortKey(PSYMBOL_SEARCH_INDEX Index, UINT32 Id, BOOLEAN IsReverse)
+{
+    const CHAR * Name   = Index->Names[Id];
+    UINT32       Length = Index->Lengths[Id];
+    UINT64       Key    = 0;
+
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        UINT8 Ch = 0;
+
+        if (i < Length)
+        {
+            Ch = SymbolSearchToLower(IsReverse ? Name[Length - 1 - i] : Name[i]);
+        }
+
+        Key = Key << 8 | Ch;
+    }
+
+    return Key;
+}
+
+/**
+ * @brief Compare two entries of sorting the names
+ *
+ * @param Index
+ * @param First
+ * @param Second
+ * @param IsReverse
+ *
+ * @return INT32
+ */
+static INT32
+SymbolSearchCompareEntries(PSYMBOL_SEARCH_INDEX             Index,
+                           const SYMBOL_SEARCH_SORT_ENTRY * First,
+                           const SYMBOL_SEARCH_SORT_ENTRY * Second,
+                           BOOLEAN                          IsReverse)
+{
+    if (First->Key != Second->Key)
+    {
+        return First->Key < Second->Key ? -1 : 1;
+    }
+
+    return SymbolSearchCompareNames(Index, First->Id, Second->Id, IsReverse);
+}
+
+/**
+ * @brief Sort the ids by their names (or their reversed names)
+ * @details The entries are merged (bottom-up) between the two halves of the
+ * scratch buffer
+ *
+ * @param Index
+ * @param Ids
+ * @param Scratch Buffer of (2 * NameCount) entries
+ * @param IsReverse
+ *
+ * @return VOID
+ */
+static VOID
+SymbolSearchSortIds(PSYMBOL_SEARCH_INDEX Index, UINT32 * Ids, SYMBOL_SEARCH_SORT_ENTRY * Scratch, BOOLEAN IsReverse)
+{
+    UINT32                     Count       = Index->NameCount;
+    SYMBOL_SEARCH_SORT_ENTRY * Source      = Scratch;
+    SYMBOL_SEARCH_SORT_ENTRY * Destination = Scratch + Count;
+    SYMBOL_SEARCH_SORT_ENTRY * Temp;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Source[i].Key      = SymbolSearchGetSortKey(Index, i, IsReverse);
+        Source[i].Id       = i;
+        Source[i].Reserved = 0;
+    }
+
+    for (UINT64 Width = 1; Width < Count; Width *= 2)
+    {
+        for (UINT64 Start = 0; Start < Count; Start += Width * 2)
+        {
+            UINT64 Middle = Start + Width < Count ? Start + Width : Count;
+            UINT64 End    = Start + Width * 2 < Count ? Start + Width * 2 : Count;
+            UINT64 Left   = Start;
+            UINT64 Right  = Middle;
+
+            for (UINT64 i = Start; i < End; i++)
+            {
+                if (Left < Middle && (Right == End || SymbolSearchCompareEntries(Index, &Source[Left], &Source[Right], IsReverse) <= 0))
+                {
+                    Destination[i] = Source[Left++];
+                }
+                else
+                {
+                    Destination[i] = Source[Right++];
+                }
+            }
+        }
+
+        Temp        = Source;
+        Source      = Destination;
+        Destination = Temp;
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Ids[i] = Source[i].Id;
+    }
+}
+
+/**
+ * @brief Find the range of the sorted ids that start (or end) with a literal
+ *
+ * @param Index
+ * @param Ids
+ * @param Literal
+ * @param LiteralLength
+ * @param IsReverse
+ * @param Start
+ * @param End
+ *
+ * @return VOID
+ */
+static VOID
+SymbolSearchFindRange(PSYMBOL_SEARCH_INDEX Index,
+                      const UINT32 *       Ids,
+                      const CHAR *         Literal,
+                      UINT32               LiteralLength,
+                      BOOLEAN              IsReverse,
+                      UINT32 *             Start,
+                      UINT32 *             End)
+{
+    UINT32 Low  = 0;
+    UINT32 High = Index->NameCount;
+
+    //
+    // The first name that is not before the literal
+    //
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (SymbolSearchCompareLiteral(Index, Ids[Middle], Literal, LiteralLength, IsReverse) < 0)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    *Start = Low;
+
+    //
+    // The first name that is after the literal
+    //
+    High = Index->NameCount;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (SymbolSearchCompareLiteral(Index, Ids[Middle], Literal, LiteralLength, IsReverse) <= 0)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    *End = Low;
+}
+
+/**
+ * @brief Get the size of the storage of the index of the names
+ *
+ * @param Names
+ * @param NameCount
+ * @param StorageSize
+ *
+ * @return BOOLEAN FALSE if there are too many names
+ */
+BOOLEAN
+SymbolSearchGetRequiredSize(const CHAR * const * Names, UINT32 NameCount, UINT64 * StorageSize)
+{
+    UINT64 TrigramCount = 0;
+    UINT64 PostingsSize;
+
+    if (NameCount == SYMBOL_SEARCH_NO_NAME)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < NameCount; i++)
+    {
+        UINT64 Length = strlen(Names[i]);
+
+        if (Length > 2)
+        {
+            TrigramCount += Length - 2;
+        }
+    }
+
+    //
+    // The postings are addressed by 32-bit offsets
+    //
+    if (TrigramCount > 0xffffffff)
+    {
+        return FALSE;
+    }
+
+    //
+    // The postings are also the scratch of sorting the names
+    //
+    PostingsSize = TrigramCount * sizeof(UINT32);
+
+    if (PostingsSize < (UINT64)NameCount * 2 * sizeof(SYMBOL_SEARCH_SORT_ENTRY))
+    {
+        PostingsSize = (UINT64)NameCount * 2 * sizeof(SYMBOL_SEARCH_SORT_ENTRY);
+    }
+
+    *StorageSize = PostingsSize + ((UINT64)NameCount * 3 + SYMBOL_SEARCH_BUCKET_COUNT * 2 + 1) * sizeof(UINT32);
+
+    return TRUE;
+}
+
+/**
+ * @brief Build the index of the names
+ * @details The names should remain valid (and unchanged) while the index
+ * is used
+ *
+ * @param Index
+ * @param Storage Storage of the index (aligned to 8 bytes)
+ * @param StorageSize Size of the storage (from SymbolSearchGetRequiredSize)
+ * @param Names
+ * @param NameCount
+ *
+ * @return BOOLEAN FALSE if the storage is too small
+ */
+BOOLEAN
+SymbolSearchInitialize(PSYMBOL_SEARCH_INDEX Index,
+                       PVOID                Storage,
+                       UINT64               StorageSize,
+                       const CHAR * const * Names,
+                       UINT32               NameCount)
+{
+    UINT64 RequiredSize;
+    UINT32 Offset = 0;
+
+    if (!SymbolSearchGetRequiredSize(Names, NameCount, &RequiredSize) || StorageSize < RequiredSize)
+    {
+        return FALSE;
+    }
+
+    Index->Names            = Names;
+    Index->NameCount        = NameCount;
+    Index->Postings         = (UINT32 *)Storage;
+    Index->Lengths          = (UINT32 *)((UINT8 *)Storage + RequiredSize) - ((UINT64)NameCount * 3 + SYMBOL_SEARCH_BUCKET_COUNT * 2 + 1);
+    Index->SortedIds        = Index->Lengths + NameCount;
+    Index->ReverseSortedIds = Index->SortedIds + NameCount;
+    Index->BucketOffsets    = Index->ReverseSortedIds + NameCount;
+    Index->BucketCounts     = Index->BucketOffsets + SYMBOL_SEARCH_BUCKET_COUNT + 1;
+
+    for (UINT32 i = 0; i < NameCount; i++)
+    {
+        Index->Lengths[i] = (UINT32)strlen(Names[i]);
+    }
+
+    SymbolSearchSortIds(Index, Index->SortedIds, (SYMBOL_SEARCH_SORT_ENTRY *)Index->Postings, FALSE);
+    SymbolSearchSortIds(Index, Index->ReverseSortedIds, (SYMBOL_SEARCH_SORT_ENTRY *)Index->Postings, TRUE);
+
+    //
+    // Reserve the place of all of the trigrams of the buckets, then add the
+    // names of the buckets (a name is added once even if it has the same
+    // trigram more than once)
+    //
+    memset(Index->BucketCounts, 0, SYMBOL_SEARCH_BUCKET_COUNT * sizeof(UINT32));
+
+    for (UINT32 i = 0; i < NameCount; i++)
+    {
+        for (UINT32 j = 0; j + 2 < Index->Lengths[i]; j++)
+        {
+            Index->BucketCounts[SymbolSearchGetBucket(&Names[i][j])]++;
+        }
+    }
+
+    for (UINT32 i = 0; i < SYMBOL_SEARCH_BUCKET_COUNT; i++)
+    {
+        Index->BucketOffsets[i] = Offset;
+        Offset += Index->BucketCounts[i];
+        Index->BucketCounts[i] = 0;
+    }
+
+    Index->BucketOffsets[SYMBOL_SEARCH_BUCKET_COUNT] = Offset;
+
+    for (UINT32 i = 0; i < NameCount; i++)
+    {
+        for (UINT32 j = 0; j + 2 < Index->Lengths[i]; j++)
+        {
+            UINT32   Bucket  = SymbolSearchGetBucket(&Names[i][j]);
+            UINT32 * Posting = &Index->Postings[Index->BucketOffsets[Bucket] + Index->BucketCounts[Bucket]];
+
+            if (Index->BucketCounts[Bucket] != 0 && Posting[-1] == i)
+            {
+                continue;
+            }
+
+            *Posting = i;
+            Index->BucketCounts[Bucket]++;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Check whether a name matches a mask (case-insensitive)
+ * @details '*' matches any number of characters and '?' matches a single
+ * character (the same as the masks of DbgHelp)
+ *
+ * @param Name
+ * @param Mask
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymbolSearchMatch(const CHAR * Name, const CHAR * Mask)
+{
+    const CHAR * StarMask = NULL;
+    const CHAR * StarName = NULL;
+
+    while (*Name != '\0')
+    {
+        if (*Mask == '*')
+        {
+            //
+            // Match nothing by the star first, more characters are matched
+            // by the star if the rest of the mask is not matched
+            //
+            StarMask = ++Mask;
+            StarName = Name;
+        }
+        else if (*Mask == '?' || (*Mask != '\0' && SymbolSearchToLower(*Mask) == SymbolSearchToLower(*Name)))
+        {
+            Mask++;
+            Name++;
+        }
+        else if (StarMask != NULL)
+        {
+            //
+            // Match one more character by the star, the characters that
+            // are not the first character of the rest of the mask are
+            // matched by the star too
+            //
+            Name = ++StarName;
+            Mask = StarMask;
+
+            if (*Mask != '?')
+            {
+                while (*Name != '\0' && SymbolSearchToLower(*Name) != SymbolSearchToLower(*Mask))
+                {
+                    Name++;
+                }
+
+                StarName = Name;
+            }
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    while (*Mask == '*')
+    {
+        Mask++;
+    }
+
+    return *Mask == '\0';
+}
+
+/**
+ * @brief Find the first position of a bucket that its id is not below an id
+ *
+ * @param Postings
+ * @param Low
+ * @param High
+ * @param Id
+ *
+ * @return UINT32
+ */
+static UINT32
+SymbolSearchLowerBound(const UINT32 * Postings, UINT32 Low, UINT32 High, UINT32 Id)
+{
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (Postings[Middle] < Id)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return Low;
+}
+
+/**
+ * @brief Check whether a name is in a filter bucket of a query
+ * @details The candidates are ascending, so the cursor of the bucket moves
+ * forward (galloping) and the bucket is searched once for all of the
+ * candidates
+ *
+ * @param Iterator
+ * @param Filter
+ * @param Id
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+SymbolSearchIsInFilter(PSYMBOL_SEARCH_ITERATOR Iterator, UINT32 Filter, UINT32 Id)
+{
+    PSYMBOL_SEARCH_INDEX Index  = Iterator->Index;
+    UINT32               Bucket = Iterator->FilterBuckets[Filter];
+    UINT32               Low    = Iterator->FilterCursors[Filter];
+    UINT32               End    = Index->BucketOffsets[Bucket] + Index->BucketCounts[Bucket];
+    UINT32               High   = End;
+    UINT32               Step   = 1;
+
+    while (Step < End - Low && Index->Postings[Low + Step] < Id)
+    {
+        Low += Step;
+        Step *= 2;
+    }
+
+    if (Step < End - Low)
+    {
+        High = Low + Step + 1;
+    }
+
+    Low = SymbolSearchLowerBound(Index->Postings, Low, High, Id);
+
+    Iterator->FilterCursors[Filter] = Low;
+
+    return Low < End && Index->Postings[Low] == Id;
+}
+
+/**
+ * @brief Start a query of a mask
+ * @details The candidates are the names that start with the literal prefix
+ * of the mask, the names that end with its literal suffix, or the names of
+ * the bucket of one of its trigrams, whichever has fewer names. The buckets
+ * of the other (rarest) trigrams filter the candidates
+ *
+ * @param Index
+ * @param Iterator
+ * @param Mask The mask should remain valid while the query is used
+ *
+ * @return VOID
+ */
+VOID
+SymbolSearchBeginQuery(PSYMBOL_SEARCH_INDEX Index, PSYMBOL_SEARCH_ITERATOR Iterator, const CHAR * Mask)
+{
+    UINT32 Buckets[SYMBOL_SEARCH_MAXIMUM_TRIGRAMS];
+    UINT32 BucketCount  = 0;
+    UINT32 MaskLength   = (UINT32)strlen(Mask);
+    UINT32 PrefixLength = 0;
+    UINT32 SuffixLength = 0;
+    UINT32 Start;
+    UINT32 End;
+
+    Iterator->Index       = Index;
+    Iterator->Mask        = Mask;
+    Iterator->Candidates  = NULL;
+    Iterator->Position    = 0;
+    Iterator->End         = Index->NameCount;
+    Iterator->IsAscending = TRUE;
+    Iterator->FilterCount = 0;
+
+    while (PrefixLength < MaskLength && !SymbolSearchIsWildcard(Mask[PrefixLength]))
+    {
+        PrefixLength++;
+    }
+
+    if (PrefixLength != 0)
+    {
+        SymbolSearchFindRange(Index, Index->SortedIds, Mask, PrefixLength, FALSE, &Start, &End);
+
+        Iterator->Candidates  = Index->SortedIds;
+        Iterator->Position    = Start;
+        Iterator->End         = End;
+        Iterator->IsAscending = FALSE;
+    }
+
+    //
+    // The whole mask is the prefix if it doesn't have any wildcard
+    //
+    if (PrefixLength == MaskLength)
+    {
+        return;
+    }
+
+    while (SuffixLength < MaskLength && !SymbolSearchIsWildcard(Mask[MaskLength - 1 - SuffixLength]))
+    {
+        SuffixLength++;
+    }
+
+    if (SuffixLength != 0)
+    {
+        SymbolSearchFindRange(Index, Index->ReverseSortedIds, &Mask[MaskLength - SuffixLength], SuffixLength, TRUE, &Start, &End);
+
+        if (End - Start < Iterator->End - Iterator->Position)
+        {
+            Iterator->Candidates  = Index->ReverseSortedIds;
+            Iterator->Position    = Start;
+            Iterator->End         = End;
+            Iterator->IsAscending = FALSE;
+        }
+    }
+
+    //
+    // Sort the (distinct) buckets of the trigrams of the mask by their sizes
+    //
+    for (UINT32 i = 0; i + 2 < MaskLength && BucketCount < SYMBOL_SEARCH_MAXIMUM_TRIGRAMS; i++)
+    {
+        UINT32 Bucket;
+        UINT32 Position;
+
+        if (SymbolSearchIsWildcard(Mask[i]) || SymbolSearchIsWildcard(Mask[i + 1]) || SymbolSearchIsWildcard(Mask[i + 2]))
+        {
+            continue;
+        }
+
+        Bucket = SymbolSearchGetBucket(&Mask[i]);
+
+        for (Position = 0; Position < BucketCount && Buckets[Position] != Bucket; Position++)
+        {
+        }
+
+        if (Position != BucketCount)
+        {
+            continue;
+        }
+
+        for (Position = BucketCount; Position != 0 && Index->BucketCounts[Buckets[Position - 1]] > Index->BucketCounts[Bucket]; Position--)
+        {
+            Buckets[Position] = Buckets[Position - 1];
+        }
+
+        Buckets[Position] = Bucket;
+        BucketCount++;
+    }
+
+    if (BucketCount == 0)
+    {
+        return;
+    }
+
+    if (Index->BucketCounts[Buckets[0]] < Iterator->End - Iterator->Position)
+    {
+        Iterator->Candidates  = Index->Postings;
+        Iterator->Position    = Index->BucketOffsets[Buckets[0]];
+        Iterator->End         = Index->BucketOffsets[Buckets[0]] + Index->BucketCounts[Buckets[0]];
+        Iterator->IsAscending = TRUE;
+    }
+
+    //
+    // The sorted names are not filtered, as their ids are not ascending
+    // (searching each of them in the buckets costs more than checking it)
+    //
+    if (!Iterator->IsAscending)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < BucketCount && Iterator->FilterCount < SYMBOL_SEARCH_MAXIMUM_FILTERS; i++)
+    {
+        if (Iterator->Candidates == Index->Postings && i == 0)
+        {
+            continue;
+        }
+
+        Iterator->FilterBuckets[Iterator->FilterCount] = Buckets[i];
+        Iterator->FilterCursors[Iterator->FilterCount] = Index->BucketOffsets[Buckets[i]];
+        Iterator->FilterCount++;
+    }
+}
+
+/**
+ * @brief Get the next name that matches the mask of a query
+ *
+ * @param Iterator
+ *
+ * @return UINT32 Id of the name, or SYMBOL_SEARCH_NO_NAME if there is no
+ * other name
+ */
+UINT32
+SymbolSearchGetNext(PSYMBOL_SEARCH_ITERATOR Iterator)
+{
+    PSYMBOL_SEARCH_INDEX Index = Iterator->Index;
+
+    while (Iterator->Position < Iterator->End)
+    {
+        UINT32 Id     = Iterator->Candidates != NULL ? Iterator->Candidates[Iterator->Position] : Iterator->Position;
+        UINT32 Filter = 0;
+
+        Iterator->Position++;
+
+        while (Filter < Iterator->FilterCount && SymbolSearchIsInFilter(Iterator, Filter, Id))
+        {
+            Filter++;
+        }
+
+        if (Filter == Iterator->FilterCount && SymbolSearchMatch(Index->Names[Id], Iterator->Mask))
+        {
+            return Id;
+        }
+    }
+
+    return SYMBOL_SEARCH_NO_NAME;
+}
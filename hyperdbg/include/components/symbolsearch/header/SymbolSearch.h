@@ -0,0 +1,127 @@
+/**
+ * @file SymbolSearch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the wildcard search index of the names of the symbols
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the buckets of the trigrams (a power of two)
+ *
+ */
+#define SYMBOL_SEARCH_BUCKET_COUNT 0x10000
+
+/**
+ * @brief Maximum number of the trigram buckets that the candidates of a
+ * query are filtered by (besides the source of the candidates)
+ *
+ */
+#define SYMBOL_SEARCH_MAXIMUM_FILTERS 4
+
+/**
+ * @brief Maximum number of the trigrams of a mask that are checked for
+ * choosing the candidates (the others are only checked by the mask)
+ *
+ */
+#define SYMBOL_SEARCH_MAXIMUM_TRIGRAMS 64
+
+/**
+ * @brief The end of the results of a query
+ *
+ */
+#define SYMBOL_SEARCH_NO_NAME 0xffffffff
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief An entry of sorting the names
+ * @details The first characters of the names are compared from the keys,
+ * so the names themselves are only compared if their keys are the same
+ *
+ */
+typedef struct _SYMBOL_SEARCH_SORT_ENTRY
+{
+    UINT64 Key; // The first 8 characters (lowercase, big-endian)
+    UINT32 Id;
+    UINT32 Reserved;
+
+} SYMBOL_SEARCH_SORT_ENTRY, *PSYMBOL_SEARCH_SORT_ENTRY;
+
+/**
+ * @brief The search index of the names of a module
+ * @details The names are kept by the caller (they're not copied). The index
+ * has the names sorted (for the prefixes), the names sorted by their reversed
+ * names (for the suffixes), and the names of each trigram bucket (for the
+ * other parts of the masks). All of them are case-insensitive
+ *
+ */
+typedef struct _SYMBOL_SEARCH_INDEX
+{
+    const CHAR * const * Names;
+    UINT32               NameCount;
+    UINT32 *             Postings;         // Ids of the names of the buckets (ascending)
+    UINT32 *             Lengths;          // Lengths of the names
+    UINT32 *             SortedIds;        // Ids of the names, sorted by the names
+    UINT32 *             ReverseSortedIds; // Ids of the names, sorted by the reversed names
+    UINT32 *             BucketOffsets;    // Start of the ids of each bucket in the postings
+    UINT32 *             BucketCounts;     // Number of the ids of each bucket
+
+} SYMBOL_SEARCH_INDEX, *PSYMBOL_SEARCH_INDEX;
+
+/**
+ * @brief State of a query
+ * @details The candidates are the smallest set of the names that is found
+ * from the index (a range of the sorted names or a bucket). The candidates
+ * that are not in the buckets of the other trigrams of the mask are skipped
+ * without touching their names, the others are checked by the mask one by
+ * one when the results are taken
+ *
+ */
+typedef struct _SYMBOL_SEARCH_ITERATOR
+{
+    PSYMBOL_SEARCH_INDEX Index;
+    const CHAR *         Mask;
+    const UINT32 *       Candidates; // NULL means all of the names
+    UINT32               Position;
+    UINT32               End;
+    BOOLEAN              IsAscending; // Whether the ids of the candidates are ascending
+    UINT32               FilterCount;
+    UINT32               FilterBuckets[SYMBOL_SEARCH_MAXIMUM_FILTERS];
+    UINT32               FilterCursors[SYMBOL_SEARCH_MAXIMUM_FILTERS]; // Positions in the postings (for ascending candidates)
+
+} SYMBOL_SEARCH_ITERATOR, *PSYMBOL_SEARCH_ITERATOR;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+BOOLEAN
+SymbolSearchGetRequiredSize(const CHAR * const * Names, UINT32 NameCount, UINT64 * StorageSize);
+
+BOOLEAN
+SymbolSearchInitialize(PSYMBOL_SEARCH_INDEX Index,
+                       PVOID                Storage,
+                       UINT64               StorageSize,
+                       const CHAR * const * Names,
+                       UINT32               NameCount);
+
+BOOLEAN
+SymbolSearchMatch(const CHAR * Name, const CHAR * Mask);
+
+VOID
+SymbolSearchBeginQuery(PSYMBOL_SEARCH_INDEX Index, PSYMBOL_SEARCH_ITERATOR Iterator, const CHAR * Mask);
+
+UINT32
+SymbolSearchGetNext(PSYMBOL_SEARCH_ITERATOR Iterator);
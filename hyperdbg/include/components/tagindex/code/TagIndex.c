@@ -0,0 +1,208 @@
+/**
+ * @file TagIndex.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the index of the sequential tags
+ * @details A tag of the dense range is found by a single array access and the
+ * other tags by the hash index. This file doesn't use any platform-specific
+ * function, so it's used in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check whether a tag is in the dense range or not
+ *
+ * @param Index
+ * @param Tag
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TagIndexIsDense(PTAG_INDEX Index, UINT64 Tag)
+{
+    return Tag >= Index->Base && Tag - Index->Base < Index->DenseCount;
+}
+
+/**
+ * @brief Get the size of the storage that should be allocated for the index
+ *
+ * @param DenseCount Number of the tags in the dense range
+ * @param OverflowCapacity Number of slots of the other tags (a power of two)
+ *
+ * @return UINT64
+ */
+UINT64
+TagIndexGetRequiredSize(UINT32 DenseCount, UINT32 OverflowCapacity)
+{
+    return (UINT64)DenseCount * sizeof(PVOID) + HashIndexGetRequiredSize(OverflowCapacity);
+}
+
+/**
+ * @brief Initialize the index
+ *
+ * @param Index
+ * @param Storage A buffer with the size of TagIndexGetRequiredSize
+ * @param Base First tag of the dense range
+ * @param DenseCount Number of the tags in the dense range
+ * @param OverflowCapacity Number of slots of the other tags (a power of two)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TagIndexInitialize(PTAG_INDEX Index, PVOID Storage, UINT64 Base, UINT32 DenseCount, UINT32 OverflowCapacity)
+{
+    memset(Index, 0, sizeof(TAG_INDEX));
+
+    if (Storage == NULL ||
+        !HashIndexInitialize(&Index->Overflow, (UINT8 *)Storage + (UINT64)DenseCount * sizeof(PVOID), OverflowCapacity))
+    {
+        return FALSE;
+    }
+
+    Index->DenseTable = (PVOID volatile *)Storage;
+    Index->Base       = Base;
+    Index->DenseCount = DenseCount;
+
+    TagIndexClear(Index);
+
+    return TRUE;
+}
+
+/**
+ * @brief Insert a tag to the index
+ *
+ * @param Index
+ * @param Tag Should not be already in the index
+ * @param Value Should not be NULL
+ *
+ * @return BOOLEAN FALSE if the tag is not inserted (it's counted as missing)
+ */
+BOOLEAN
+TagIndexInsert(PTAG_INDEX Index, UINT64 Tag, PVOID Value)
+{
+    BOOLEAN Result;
+
+    if (TagIndexIsDense(Index, Tag))
+    {
+        Result = Value != NULL && Index->DenseTable[Tag - Index->Base] == NULL;
+
+        if (Result)
+        {
+            Index->DenseTable[Tag - Index->Base] = Value;
+        }
+    }
+    else
+    {
+        Result = HashIndexFind(&Index->Overflow, Tag, NULL) == NULL && HashIndexInsert(&Index->Overflow, Tag, Value);
+    }
+
+    if (Result)
+    {
+        Index->Count++;
+    }
+    else
+    {
+        Index->MissingCount++;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Find the value of a tag
+ *
+ * @param Index
+ * @param Tag
+ *
+ * @return PVOID NULL if the tag is not in the index
+ */
+PVOID
+TagIndexFind(PTAG_INDEX Index, UINT64 Tag)
+{
+    if (TagIndexIsDense(Index, Tag))
+    {
+        return Index->DenseTable[Tag - Index->Base];
+    }
+
+    return HashIndexFind(&Index->Overflow, Tag, NULL);
+}
+
+/**
+ * @brief Check whether all of the inserted tags are in the index or not
+ *
+ * @param Index
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TagIndexIsComplete(PTAG_INDEX Index)
+{
+    return Index->MissingCount == 0;
+}
+
+/**
+ * @brief Remove a tag from the index
+ * @details Should only be called for the inserted tags, if the tag is not
+ * found, it's one of the missing tags
+ *
+ * @param Index
+ * @param Tag
+ * @param Value The value of the tag
+ *
+ * @return BOOLEAN FALSE if the tag was not found
+ */
+BOOLEAN
+TagIndexRemove(PTAG_INDEX Index, UINT64 Tag, PVOID Value)
+{
+    BOOLEAN Result;
+
+    if (TagIndexIsDense(Index, Tag))
+    {
+        Result = Value != NULL && Index->DenseTable[Tag - Index->Base] == Value;
+
+        if (Result)
+        {
+            Index->DenseTable[Tag - Index->Base] = NULL;
+        }
+    }
+    else
+    {
+        Result = HashIndexRemove(&Index->Overflow, Tag, Value);
+    }
+
+    if (Result)
+    {
+        Index->Count--;
+    }
+    else if (Index->MissingCount != 0)
+    {
+        Index->MissingCount--;
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Remove all of the tags from the index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+VOID
+TagIndexClear(PTAG_INDEX Index)
+{
+    for (UINT32 i = 0; i < Index->DenseCount; i++)
+    {
+        Index->DenseTable[i] = NULL;
+    }
+
+    HashIndexClear(&Index->Overflow);
+
+    Index->Count        = 0;
+    Index->MissingCount = 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file TagIndex.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the index of the sequential tags
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief An index from unique tags to values
+ * @details The tags are mostly allocated sequentially, so the tags in the
+ * range of [Base, Base + DenseCount) are kept in a dense table and the other
+ * tags are kept in a hash index (see HashIndex.h). The storage is given by
+ * the caller so the index never allocates and can be used in vmx-root. If a
+ * tag couldn't be inserted, it's counted as a missing tag and the caller
+ * should find the tags by itself until all of the missing tags are removed
+ *
+ */
+typedef struct _TAG_INDEX
+{
+    PVOID volatile * DenseTable;   // Values of the tags in the dense range
+    UINT64           Base;         // First tag of the dense range
+    UINT32           DenseCount;   // Number of the tags in the dense range
+    UINT32           Count;        // Number of the items
+    UINT32           MissingCount; // Number of the tags that couldn't be inserted
+    HASH_INDEX       Overflow;     // Tags out of the dense range
+
+} TAG_INDEX, *PTAG_INDEX;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+TagIndexGetRequiredSize(UINT32 DenseCount, UINT32 OverflowCapacity);
+
+BOOLEAN
+TagIndexInitialize(PTAG_INDEX Index, PVOID Storage, UINT64 Base, UINT32 DenseCount, UINT32 OverflowCapacity);
+
+BOOLEAN
+TagIndexInsert(PTAG_INDEX Index, UINT64 Tag, PVOID Value);
+
+PVOID
+TagIndexFind(PTAG_INDEX Index, UINT64 Tag);
+
+BOOLEAN
+TagIndexIsComplete(PTAG_INDEX Index);
+
+BOOLEAN
+TagIndexRemove(PTAG_INDEX Index, UINT64 Tag, PVOID Value);
+
+VOID
+TagIndexClear(PTAG_INDEX Index);
@@ -0,0 +1,367 @@
+/**
+ * @file TrackTrace.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the records of tracking the 'call' and the 'ret' instructions
+ * @details The debuggee steps the instructions by itself and appends a compact
+ * record for each executed 'call' and 'ret' to a buffer, the debugger decodes
+ * the records and builds the call tree from them. This file doesn't use any
+ * platform-specific function, so it's used in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Write a zigzag LEB128 delta
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Offset
+ * @param Delta
+ *
+ * @return UINT32 The offset after the value or zero if there is no space
+ */
+static UINT32
+TrackTraceWriteDelta(BYTE * Buffer, UINT32 BufferSize, UINT32 Offset, UINT64 Delta)
+{
+    UINT64 Value = (Delta << 1) ^ (0 - (Delta >> 63));
+
+    do
+    {
+        if (Offset >= BufferSize)
+        {
+            return 0;
+        }
+
+        Buffer[Offset++] = (BYTE)((Value & 0x7f) | (Value > 0x7f ? 0x80 : 0));
+        Value >>= 7;
+
+    } while (Value != 0);
+
+    return Offset;
+}
+
+/**
+ * @brief Read a zigzag LEB128 delta
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param Offset
+ * @param Delta
+ *
+ * @return UINT32 The offset after the value or zero if it's invalid
+ */
+static UINT32
+TrackTraceReadDelta(const BYTE * Buffer, UINT32 BufferSize, UINT32 Offset, UINT64 * Delta)
+{
+    UINT64 Value = 0;
+    UINT32 Shift = 0;
+    BYTE   Byte;
+
+    do
+    {
+        //
+        // The last (tenth) byte only has the highest bit of the value
+        //
+        if (Offset >= BufferSize || Shift > 63)
+        {
+            return 0;
+        }
+
+        Byte = Buffer[Offset++];
+
+        if (Shift == 63 && (Byte & 0x7e) != 0)
+        {
+            return 0;
+        }
+
+        Value |= (UINT64)(Byte & 0x7f) << Shift;
+        Shift += 7;
+
+    } while ((Byte & 0x80) != 0);
+
+    *Delta = (Value >> 1) ^ (0 - (Value & 1));
+
+    return Offset;
+}
+
+/**
+ * @brief Encode a record
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param PreviousTarget Target of the previous record (zero for the first record)
+ * @param Record
+ *
+ * @return UINT32 Size of the encoded record or zero if there is no space or
+ * the record is invalid
+ */
+UINT32
+TrackTraceEncode(BYTE * Buffer, UINT32 BufferSize, UINT64 PreviousTarget, const TRACK_TRACE_RECORD * Record)
+{
+    UINT32 Offset;
+
+    if ((Record->Kind != TRACK_TRACE_KIND_CALL && Record->Kind != TRACK_TRACE_KIND_RET) ||
+        Record->Length == 0 ||
+        Record->Length > TRACK_TRACE_LENGTH_MASK ||
+        BufferSize == 0)
+    {
+        return 0;
+    }
+
+    Buffer[0] = (BYTE)(Record->Kind | (Record->Length << TRACK_TRACE_LENGTH_SHIFT));
+
+    Offset = TrackTraceWriteDelta(Buffer, BufferSize, 1, Record->Rip - PreviousTarget);
+
+    if (Offset == 0)
+    {
+        return 0;
+    }
+
+    return TrackTraceWriteDelta(Buffer, BufferSize, Offset, Record->Target - (Record->Rip + Record->Length));
+}
+
+/**
+ * @brief Decode a record
+ *
+ * @param Buffer
+ * @param BufferSize
+ * @param PreviousTarget Target of the previous record (zero for the first record)
+ * @param Record
+ *
+ * @return UINT32 Size of the decoded record or zero if the record is
+ * truncated or invalid
+ */
+UINT32
+TrackTraceDecode(const BYTE * Buffer, UINT32 BufferSize, UINT64 PreviousTarget, TRACK_TRACE_RECORD * Record)
+{
+    UINT32 Offset;
+    UINT64 Delta;
+    BYTE   Header;
+
+    if (BufferSize == 0)
+    {
+        return 0;
+    }
+
+    Header = Buffer[0];
+
+    Record->Kind   = Header & TRACK_TRACE_KIND_MASK;
+    Record->Length = (Header >> TRACK_TRACE_LENGTH_SHIFT) & TRACK_TRACE_LENGTH_MASK;
+
+    if ((Record->Kind != TRACK_TRACE_KIND_CALL && Record->Kind != TRACK_TRACE_KIND_RET) ||
+        Record->Length == 0 ||
+        (Header >> TRACK_TRACE_LENGTH_SHIFT) > TRACK_TRACE_LENGTH_MASK)
+    {
+        return 0;
+    }
+
+    Offset = TrackTraceReadDelta(Buffer, BufferSize, 1, &Delta);
+
+    if (Offset == 0)
+    {
+        return 0;
+    }
+
+    Record->Rip = PreviousTarget + Delta;
+
+    Offset = TrackTraceReadDelta(Buffer, BufferSize, Offset, &Delta);
+
+    if (Offset == 0)
+    {
+        return 0;
+    }
+
+    Record->Target = Record->Rip + Record->Length + Delta;
+
+    return Offset;
+}
+
+/**
+ * @brief Empty a buffer of records (the next record is encoded from zero)
+ *
+ * @param TraceBuffer
+ *
+ * @return VOID
+ */
+VOID
+TrackTraceBufferReset(TRACK_TRACE_BUFFER * TraceBuffer)
+{
+    TraceBuffer->PreviousTarget = 0;
+    TraceBuffer->Size           = 0;
+    TraceBuffer->RecordCount    = 0;
+}
+
+/**
+ * @brief Append a record to a buffer
+ *
+ * @param TraceBuffer
+ * @param Record
+ *
+ * @return BOOLEAN FALSE if the buffer is full (or the record is invalid)
+ */
+BOOLEAN
+TrackTraceBufferAdd(TRACK_TRACE_BUFFER * TraceBuffer, const TRACK_TRACE_RECORD * Record)
+{
+    UINT32 Size;
+
+    Size = TrackTraceEncode(&TraceBuffer->Data[TraceBuffer->Size],
+                            TRACK_TRACE_BUFFER_SIZE - TraceBuffer->Size,
+                            TraceBuffer->PreviousTarget,
+                            Record);
+
+    if (Size == 0)
+    {
+        return FALSE;
+    }
+
+    TraceBuffer->PreviousTarget = Record->Target;
+    TraceBuffer->Size += Size;
+    TraceBuffer->RecordCount++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Check a received buffer before its records are used
+ * @details The size and the count of the records come from the debuggee, so
+ * the whole buffer is decoded to make sure that each record is valid and ends
+ * within the size, and that the count matches
+ *
+ * @param TraceBuffer
+ * @param BufferLength Number of the received bytes (including the header)
+ *
+ * @return BOOLEAN TRUE if all of the records can be decoded
+ */
+BOOLEAN
+TrackTraceBufferValidate(const TRACK_TRACE_BUFFER * TraceBuffer, UINT32 BufferLength)
+{
+    TRACK_TRACE_RECORD Record;
+    UINT64             PreviousTarget = 0;
+    UINT32             Offset         = 0;
+    UINT32             Count          = 0;
+    UINT32             Size;
+
+    if (BufferLength < TRACK_TRACE_BUFFER_HEADER_SIZE ||
+        TraceBuffer->Size > TRACK_TRACE_BUFFER_SIZE ||
+        BufferLength - TRACK_TRACE_BUFFER_HEADER_SIZE < TraceBuffer->Size)
+    {
+        return FALSE;
+    }
+
+    while (Offset < TraceBuffer->Size)
+    {
+        Size = TrackTraceDecode(&TraceBuffer->Data[Offset], TraceBuffer->Size - Offset, PreviousTarget, &Record);
+
+        if (Size == 0)
+        {
+            return FALSE;
+        }
+
+        Offset += Size;
+        PreviousTarget = Record.Target;
+        Count++;
+    }
+
+    return Count == TraceBuffer->RecordCount;
+}
+
+/**
+ * @brief Initialize (or reset) the state of building the call tree
+ *
+ * @param Tree
+ *
+ * @return VOID
+ */
+VOID
+TrackTraceTreeInitialize(TRACK_TRACE_TREE * Tree)
+{
+    Tree->Top        = 0;
+    Tree->FrameCount = 0;
+    Tree->Depth      = 0;
+}
+
+/**
+ * @brief Add a record to the call tree
+ * @details A 'ret' is matched to the nearest tracked 'call' that it returns
+ * to, so the frames that are skipped (e.g., by exceptions or longjmps) are
+ * also removed. If there is no such 'call', the 'ret' is assumed to return
+ * from the last frame (or from a frame before starting the tracking)
+ *
+ * @param Tree
+ * @param Record
+ * @param Node The record and its depth
+ *
+ * @return VOID
+ */
+VOID
+TrackTraceTreeAdd(TRACK_TRACE_TREE * Tree, const TRACK_TRACE_RECORD * Record, TRACK_TRACE_NODE * Node)
+{
+    UINT32 Popped;
+    UINT32 Index;
+
+    Node->Rip       = Record->Rip;
+    Node->Target    = Record->Target;
+    Node->Kind      = Record->Kind;
+    Node->IsMatched = FALSE;
+
+    if (Record->Kind == TRACK_TRACE_KIND_CALL)
+    {
+        Node->Depth = Tree->Depth;
+
+        Tree->ReturnAddresses[Tree->Top] = Record->Rip + Record->Length;
+        Tree->Top                        = (Tree->Top + 1) % TRACK_TRACE_MAXIMUM_FRAMES;
+
+        if (Tree->FrameCount < TRACK_TRACE_MAXIMUM_FRAMES)
+        {
+            Tree->FrameCount++;
+        }
+
+        Tree->Depth++;
+
+        return;
+    }
+
+    //
+    // Find the frame that the 'ret' returns to
+    //
+    Index = Tree->Top;
+
+    for (Popped = 1; Popped <= Tree->FrameCount; Popped++)
+    {
+        Index = (Index + TRACK_TRACE_MAXIMUM_FRAMES - 1) % TRACK_TRACE_MAXIMUM_FRAMES;
+
+        if (Tree->ReturnAddresses[Index] == Record->Target)
+        {
+            Node->IsMatched = TRUE;
+            break;
+        }
+    }
+
+    if (!Node->IsMatched)
+    {
+        //
+        // Return from the last frame (if the frames are overwritten or the
+        // 'ret' is for a 'call' before the tracking, there is no frame)
+        //
+        Popped = Tree->FrameCount != 0 ? 1 : 0;
+        Index  = (Tree->Top + TRACK_TRACE_MAXIMUM_FRAMES - Popped) % TRACK_TRACE_MAXIMUM_FRAMES;
+
+        if (Tree->Depth != 0 && Popped == 0)
+        {
+            Tree->Depth--;
+        }
+    }
+
+    //
+    // The frames are never more than the depth
+    //
+    Tree->Top = Index;
+    Tree->FrameCount -= Popped;
+    Tree->Depth -= Popped;
+
+    Node->Depth = Tree->Depth;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file TrackTrace.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the records of tracking the 'call' and the 'ret' instructions
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the records in each buffer of tracking (each buffer is sent
+ * to the debugger in one packet)
+ *
+ */
+#define TRACK_TRACE_BUFFER_SIZE 0x1000
+
+/**
+ * @brief Maximum size of an encoded record (one byte of the kind and the
+ * length, and two 64-bit LEB128 values)
+ *
+ */
+#define TRACK_TRACE_MAXIMUM_RECORD_SIZE 21
+
+/**
+ * @brief Maximum number of the return addresses that are kept for matching
+ * the 'ret' instructions (the deeper calls overwrite the oldest frames)
+ *
+ */
+#define TRACK_TRACE_MAXIMUM_FRAMES 256
+
+/**
+ * @brief Bits of the first byte of a record
+ *
+ */
+#define TRACK_TRACE_KIND_MASK    0x03
+#define TRACK_TRACE_LENGTH_SHIFT 2
+#define TRACK_TRACE_LENGTH_MASK  0x0f
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Kinds of the tracked instructions
+ *
+ */
+typedef enum _TRACK_TRACE_KIND
+{
+    TRACK_TRACE_KIND_NONE = 0,
+    TRACK_TRACE_KIND_CALL,
+    TRACK_TRACE_KIND_RET,
+
+} TRACK_TRACE_KIND;
+
+/**
+ * @brief A decoded record of an executed 'call' or 'ret' instruction
+ *
+ */
+typedef struct _TRACK_TRACE_RECORD
+{
+    UINT64 Rip;    // Address of the 'call' or the 'ret' instruction
+    UINT64 Target; // Address of the next executed instruction (the callee or the return address)
+    UINT32 Kind;   // TRACK_TRACE_KIND
+    UINT32 Length; // Length of the instruction
+
+} TRACK_TRACE_RECORD, *PTRACK_TRACE_RECORD;
+
+/**
+ * @brief A buffer of the encoded records
+ * @details Only the first FIELD_OFFSET(Data) + Size bytes are sent to the
+ * debugger, the first record of each buffer is encoded from zero
+ *
+ */
+typedef struct _TRACK_TRACE_BUFFER
+{
+    UINT64 PreviousTarget; // Base of the delta of the next record
+    UINT32 Size;
+    UINT32 RecordCount;
+    BYTE   Data[TRACK_TRACE_BUFFER_SIZE];
+
+} TRACK_TRACE_BUFFER, *PTRACK_TRACE_BUFFER;
+
+/**
+ * @brief Size of the fields of a buffer before the records
+ *
+ */
+#define TRACK_TRACE_BUFFER_HEADER_SIZE (sizeof(TRACK_TRACE_BUFFER) - TRACK_TRACE_BUFFER_SIZE)
+
+/**
+ * @brief A node of the call tree (a record along with its depth)
+ *
+ */
+typedef struct _TRACK_TRACE_NODE
+{
+    UINT64  Rip;
+    UINT64  Target;
+    UINT32  Kind;
+    UINT32  Depth;     // Depth of the call, or the depth of the call that the 'ret' returns from
+    BOOLEAN IsMatched; // Whether the 'ret' returns to the address after a tracked 'call'
+
+} TRACK_TRACE_NODE, *PTRACK_TRACE_NODE;
+
+/**
+ * @brief State of building the call tree
+ * @details The return addresses of the calls are kept in a ring, so the
+ * depth is still valid if the calls go deeper than TRACK_TRACE_MAXIMUM_FRAMES
+ *
+ */
+typedef struct _TRACK_TRACE_TREE
+{
+    UINT64 ReturnAddresses[TRACK_TRACE_MAXIMUM_FRAMES];
+    UINT32 Top;        // Index of the next frame in the ring
+    UINT32 FrameCount; // Number of valid frames in the ring
+    UINT32 Depth;
+
+} TRACK_TRACE_TREE, *PTRACK_TRACE_TREE;
+
+//////////////////////////////////////////////////
+//					Illustration				//
+//////////////////////////////////////////////////
+
+/*
+
+Each record is a byte of the kind and the length of the instruction, and then
+the address of the instruction and its target as zigzag LEB128 deltas. The
+address is relative to the target of the previous record (the code runs from
+there until the next 'call' or 'ret'), and the target is relative to the end
+of the instruction.
+
+      _________________________________________________________________
+     | length | kind | rip - previous target | target - (rip + length) |
+     |___4b___|__2b__|_____1 to 10 bytes_____|_____1 to 10 bytes_______|
+
+The previous target is fffff801`12340000:
+
+     call fffff801`12340010 (5 bytes) -> fffff801`12345000   : 15 | 20    | d6 bf 02
+     ret  fffff801`12345042 (1 byte)  -> fffff801`12340015   : 06 | 84 01 | db c0 02
+
+*/
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT32
+TrackTraceEncode(BYTE * Buffer, UINT32 BufferSize, UINT64 PreviousTarget, const TRACK_TRACE_RECORD * Record);
+
+UINT32
+TrackTraceDecode(const BYTE * Buffer, UINT32 BufferSize, UINT64 PreviousTarget, TRACK_TRACE_RECORD * Record);
+
+VOID
+TrackTraceBufferReset(TRACK_TRACE_BUFFER * TraceBuffer);
+
+BOOLEAN
+TrackTraceBufferAdd(TRACK_TRACE_BUFFER * TraceBuffer, const TRACK_TRACE_RECORD * Record);
+
+BOOLEAN
+TrackTraceBufferValidate(const TRACK_TRACE_BUFFER * TraceBuffer, UINT32 BufferLength);
+
+VOID
+TrackTraceTreeInitialize(TRACK_TRACE_TREE * Tree);
+
+VOID
+TrackTraceTreeAdd(TRACK_TRACE_TREE * Tree, const TRACK_TRACE_RECORD * Record, TRACK_TRACE_NODE * Node);
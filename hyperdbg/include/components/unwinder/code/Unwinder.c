@@ -0,0 +1,750 @@
+/**
+ * @file Unwinder.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Implementation of the x64 stack unwinder
+ * @details The frames are unwound based on the exception directory (.pdata)
+ * and the unwind infos of the images that are loaded in the memory (the same
+ * as RtlVirtualUnwind). The memory of the target is only accessed through a
+ * callback, so this file is used in both the kernel and the user-mode
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Unwind operations
+//
+#define UNWINDER_UWOP_PUSH_NONVOL     0
+#define UNWINDER_UWOP_ALLOC_LARGE     1
+#define UNWINDER_UWOP_ALLOC_SMALL     2
+#define UNWINDER_UWOP_SET_FPREG       3
+#define UNWINDER_UWOP_SAVE_NONVOL     4
+#define UNWINDER_UWOP_SAVE_NONVOL_FAR 5
+#define UNWINDER_UWOP_EPILOG          6
+#define UNWINDER_UWOP_SPARE_CODE      7
+#define UNWINDER_UWOP_SAVE_XMM128     8
+#define UNWINDER_UWOP_SAVE_XMM128_FAR 9
+#define UNWINDER_UWOP_PUSH_MACHFRAME  10
+
+//
+// Flags of the unwind infos
+//
+#define UNWINDER_UNW_FLAG_CHAININFO 0x4
+
+/**
+ * @brief Header of an unwind info and its codes
+ * @details The (aligned) codes are followed by the runtime function of the
+ * parent if the info is chained
+ *
+ */
+typedef struct _UNWINDER_UNWIND_INFO
+{
+    UINT8  VersionAndFlags;
+    UINT8  SizeOfProlog;
+    UINT8  CountOfCodes;
+    UINT8  FrameRegisterAndOffset;
+    UINT16 UnwindCodes[256 + (sizeof(UNWINDER_RUNTIME_FUNCTION) / sizeof(UINT16))];
+
+} UNWINDER_UNWIND_INFO, *PUNWINDER_UNWIND_INFO;
+
+/**
+ * @brief Read a 64-bit value from the target
+ *
+ * @param Unwinder
+ * @param Address
+ * @param Value
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+UnwinderReadUint64(PUNWINDER Unwinder, UINT64 Address, UINT64 * Value)
+{
+    return Unwinder->ReadMemory(Unwinder->ReadMemoryContext, Address, Value, sizeof(UINT64));
+}
+
+/**
+ * @brief Get a 32-bit value from a buffer
+ *
+ * @param Buffer
+ *
+ * @return UINT32
+ */
+static UINT32
+UnwinderGetUint32(const UINT8 * Buffer)
+{
+    UINT32 Value;
+
+    memcpy(&Value, Buffer, sizeof(UINT32));
+
+    return Value;
+}
+
+/**
+ * @brief Get the number of the slots of an unwind code
+ *
+ * @param UnwindCode
+ *
+ * @return UINT32
+ */
+static UINT32
+UnwinderGetCodeSlots(UINT16 UnwindCode)
+{
+    UINT8 Operation = (UnwindCode >> 8) & 0xf;
+    UINT8 Info      = (UnwindCode >> 12) & 0xf;
+
+    switch (Operation)
+    {
+    case UNWINDER_UWOP_ALLOC_LARGE:
+        return Info == 0 ? 2 : 3;
+    case UNWINDER_UWOP_SAVE_NONVOL:
+    case UNWINDER_UWOP_SAVE_XMM128:
+    case UNWINDER_UWOP_EPILOG:
+        return 2;
+    case UNWINDER_UWOP_SAVE_NONVOL_FAR:
+    case UNWINDER_UWOP_SAVE_XMM128_FAR:
+    case UNWINDER_UWOP_SPARE_CODE:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+/**
+ * @brief Check the headers of an image and add it to the cache
+ *
+ * @param Unwinder
+ * @param ImageBase
+ * @param Address The address that should be in the image
+ *
+ * @return PUNWINDER_MODULE NULL if it's not a valid x64 image that contains
+ * the address
+ */
+static PUNWINDER_MODULE
+UnwinderAddModule(PUNWINDER Unwinder, UINT64 ImageBase, UINT64 Address)
+{
+    UINT8            Headers[24 + 144]; // Signature, file header and the optional header up to the exception directory
+    UINT32           NtHeadersOffset;
+    UINT32           SizeOfImage;
+    UINT32           ExceptionDirectorySize;
+    PUNWINDER_MODULE Module;
+
+    if (!Unwinder->ReadMemory(Unwinder->ReadMemoryContext, ImageBase + 0x3c, &NtHeadersOffset, sizeof(UINT32)) ||
+        NtHeadersOffset >= UNWINDER_PAGE_SIZE ||
+        !Unwinder->ReadMemory(Unwinder->ReadMemoryContext, ImageBase + NtHeadersOffset, Headers, sizeof(Headers)))
+    {
+        return NULL;
+    }
+
+    //
+    // PE signature, AMD64 machine, PE32+ optional header that has the exception directory
+    //
+    if (UnwinderGetUint32(&Headers[0]) != 0x00004550 ||
+        (Headers[4] | (Headers[5] << 8)) != 0x8664 ||
+        (Headers[20] | (Headers[21] << 8)) < 144 ||
+        (Headers[24] | (Headers[25] << 8)) != 0x20b ||
+        UnwinderGetUint32(&Headers[24 + 108]) <= 3)
+    {
+        return NULL;
+    }
+
+    SizeOfImage = UnwinderGetUint32(&Headers[24 + 56]);
+
+    if (Address - ImageBase >= SizeOfImage)
+    {
+        return NULL;
+    }
+
+    if (Unwinder->ModuleCount < UNWINDER_MODULE_CACHE_SIZE)
+    {
+        Module = &Unwinder->Modules[Unwinder->ModuleCount++];
+    }
+    else
+    {
+        Module                       = &Unwinder->Modules[Unwinder->NextReplacedModule];
+        Unwinder->NextReplacedModule = (Unwinder->NextReplacedModule + 1) % UNWINDER_MODULE_CACHE_SIZE;
+    }
+
+    ExceptionDirectorySize = UnwinderGetUint32(&Headers[24 + 140]);
+
+    Module->ImageBase             = ImageBase;
+    Module->SizeOfImage           = SizeOfImage;
+    Module->ExceptionDirectoryRva = UnwinderGetUint32(&Headers[24 + 136]);
+    Module->NumberOfFunctions     = ExceptionDirectorySize / sizeof(UNWINDER_RUNTIME_FUNCTION);
+
+    return Module;
+}
+
+/**
+ * @brief Unwind the frame if the instruction pointer is in an epilog
+ * @details The epilog is an optional 'add rsp, imm' or 'lea rsp, [FrameReg
+ * + disp]', then the pops of the nonvolatile registers and a 'ret' or a jump
+ * out of the function. The unwind codes don't describe the epilogs, so they're
+ * emulated
+ *
+ * @param Unwinder
+ * @param Context
+ * @param Function The primary function of the instruction pointer
+ * @param ImageBase
+ * @param FrameRegister
+ *
+ * @return BOOLEAN TRUE if it was an epilog and the frame is unwound
+ */
+static BOOLEAN
+UnwinderUnwindEpilog(PUNWINDER                  Unwinder,
+                     PUNWINDER_CONTEXT          Context,
+                     PUNWINDER_RUNTIME_FUNCTION Function,
+                     UINT64                     ImageBase,
+                     UINT8                      FrameRegister)
+{
+    UINT8            Code[UNWINDER_MAXIMUM_EPILOG_SIZE];
+    UINT32           Size   = UNWINDER_MAXIMUM_EPILOG_SIZE;
+    UINT32           Offset = 0;
+    UINT32           PopsOffset;
+    UINT32           ReturnOffset;
+    UINT64           Target;
+    UNWINDER_CONTEXT NewContext = *Context;
+
+    //
+    // The code is only read up to the end of the page (the next page might
+    // not be accessible)
+    //
+    if (UNWINDER_PAGE_SIZE - (Context->Rip & (UNWINDER_PAGE_SIZE - 1)) < Size)
+    {
+        Size = (UINT32)(UNWINDER_PAGE_SIZE - (Context->Rip & (UNWINDER_PAGE_SIZE - 1)));
+    }
+
+    if (!Unwinder->ReadMemory(Unwinder->ReadMemoryContext, Context->Rip, Code, Size))
+    {
+        return FALSE;
+    }
+
+    if (Size >= 4 && Code[0] == 0x48 && Code[1] == 0x83 && Code[2] == 0xc4)
+    {
+        //
+        // add rsp, imm8
+        //
+        NewContext.Gpr[UNWINDER_REGISTER_RSP] += (INT64)(INT8)Code[3];
+        Offset = 4;
+    }
+    else if (Size >= 7 && Code[0] == 0x48 && Code[1] == 0x81 && Code[2] == 0xc4)
+    {
+        //
+        // add rsp, imm32
+        //
+        NewContext.Gpr[UNWINDER_REGISTER_RSP] += (INT64)(INT32)UnwinderGetUint32(&Code[3]);
+        Offset = 7;
+    }
+    else if (Size >= 4 && FrameRegister != 0 && (Code[0] & 0xfe) == 0x48 && Code[1] == 0x8d &&
+             ((Code[2] >> 3) & 7) == UNWINDER_REGISTER_RSP &&
+             ((Code[2] & 7) | ((Code[0] & 1) << 3)) == FrameRegister && (Code[2] & 7) != UNWINDER_REGISTER_RSP)
+    {
+        //
+        // lea rsp, [FrameReg + disp8/disp32]
+        //
+        if ((Code[2] >> 6) == 1)
+        {
+            NewContext.Gpr[UNWINDER_REGISTER_RSP] = Context->Gpr[FrameRegister] + (INT64)(INT8)Code[3];
+            Offset                                = 4;
+        }
+        else if ((Code[2] >> 6) == 2 && Size >= 7)
+        {
+            NewContext.Gpr[UNWINDER_REGISTER_RSP] = Context->Gpr[FrameRegister] + (INT64)(INT32)UnwinderGetUint32(&Code[3]);
+            Offset                                = 7;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // Pops of the nonvolatile registers (their values are read after the
+    // whole epilog is matched)
+    //
+    PopsOffset = Offset;
+
+    while (Offset < Size)
+    {
+        if (Code[Offset] >= 0x58 && Code[Offset] <= 0x5f)
+        {
+            Offset += 1;
+        }
+        else if (Offset + 1 < Size && Code[Offset] == 0x41 && Code[Offset + 1] >= 0x58 && Code[Offset + 1] <= 0x5f)
+        {
+            Offset += 2;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (Offset >= Size)
+    {
+        return FALSE;
+    }
+
+    ReturnOffset = Offset;
+
+    //
+    // ret, rep ret, ret imm16, jmp rel32 (out of the function) or jmp [rip + disp32]
+    //
+    if (Code[Offset] == 0xc3 || (Code[Offset] == 0xc2 && Offset + 3 <= Size) || (Offset + 1 < Size && Code[Offset] == 0xf3 && Code[Offset + 1] == 0xc3))
+    {
+    }
+    else if (Code[Offset] == 0xe9 && Offset + 5 <= Size)
+    {
+        Target = Context->Rip + Offset + 5 + (INT64)(INT32)UnwinderGetUint32(&Code[Offset + 1]);
+
+        if (Target >= ImageBase + Function->BeginAddress && Target < ImageBase + Function->EndAddress)
+        {
+            return FALSE;
+        }
+    }
+    else if ((Offset + 2 < Size && Code[Offset] == 0xff && Code[Offset + 1] == 0x25) ||
+             (Offset + 3 < Size && Code[Offset] == 0x48 && Code[Offset + 1] == 0xff && Code[Offset + 2] == 0x25))
+    {
+    }
+    else
+    {
+        return FALSE;
+    }
+
+    //
+    // Emulate the pops and the return
+    //
+    for (Offset = PopsOffset; Offset < ReturnOffset;)
+    {
+        UINT32 Register = (Code[Offset] == 0x41) ? (8U + (Code[Offset + 1] - 0x58U)) : (Code[Offset] - 0x58U);
+
+        if (!UnwinderReadUint64(Unwinder, NewContext.Gpr[UNWINDER_REGISTER_RSP], &NewContext.Gpr[Register]))
+        {
+            return FALSE;
+        }
+
+        NewContext.Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+        Offset += (Code[Offset] == 0x41) ? 2 : 1;
+    }
+
+    if (!UnwinderReadUint64(Unwinder, NewContext.Gpr[UNWINDER_REGISTER_RSP], &NewContext.Rip))
+    {
+        return FALSE;
+    }
+
+    NewContext.Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+
+    if (Code[ReturnOffset] == 0xc2)
+    {
+        NewContext.Gpr[UNWINDER_REGISTER_RSP] += (UINT16)(Code[ReturnOffset + 1] | (Code[ReturnOffset + 2] << 8));
+    }
+
+    *Context = NewContext;
+
+    return TRUE;
+}
+
+/**
+ * @brief Initialize an unwinder
+ *
+ * @param Unwinder
+ * @param ReadMemory Reads the memory of the target
+ * @param ReadMemoryContext Passed to the callback
+ *
+ * @return VOID
+ */
+VOID
+UnwinderInitialize(PUNWINDER Unwinder, UNWINDER_READ_MEMORY ReadMemory, PVOID ReadMemoryContext)
+{
+    memset(Unwinder, 0, sizeof(UNWINDER));
+
+    Unwinder->ReadMemory        = ReadMemory;
+    Unwinder->ReadMemoryContext = ReadMemoryContext;
+}
+
+/**
+ * @brief Find the image that contains an address
+ * @details The image is first searched in the cache, then the headers of the
+ * image are searched backward from the page of the address
+ *
+ * @param Unwinder
+ * @param Address
+ *
+ * @return PUNWINDER_MODULE NULL if the address is not in an image
+ */
+PUNWINDER_MODULE
+UnwinderFindModule(PUNWINDER Unwinder, UINT64 Address)
+{
+    UINT64 Page = Address & ~((UINT64)UNWINDER_PAGE_SIZE - 1);
+    UINT16 Signature;
+
+    for (UINT32 i = 0; i < Unwinder->ModuleCount; i++)
+    {
+        if (Address - Unwinder->Modules[i].ImageBase < Unwinder->Modules[i].SizeOfImage)
+        {
+            return &Unwinder->Modules[i];
+        }
+    }
+
+    for (UINT32 i = 0; i < UNWINDER_MAXIMUM_IMAGE_SEARCH_PAGES && Page != 0; i++, Page -= UNWINDER_PAGE_SIZE)
+    {
+        //
+        // Pages that are not accessible (e.g., discarded sections) are skipped
+        //
+        if (Unwinder->ReadMemory(Unwinder->ReadMemoryContext, Page, &Signature, sizeof(UINT16)) && Signature == 0x5a4d)
+        {
+            PUNWINDER_MODULE Module = UnwinderAddModule(Unwinder, Page, Address);
+
+            if (Module != NULL)
+            {
+                return Module;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the runtime function of an address
+ * @details The exception directory is sorted, so it's binary searched
+ *
+ * @param Unwinder
+ * @param Module
+ * @param Address
+ * @param RuntimeFunction
+ *
+ * @return BOOLEAN FALSE if the address is not in a function that has unwind
+ * data (it's a leaf function)
+ */
+BOOLEAN
+UnwinderLookupFunction(PUNWINDER                  Unwinder,
+                       PUNWINDER_MODULE           Module,
+                       UINT64                     Address,
+                       PUNWINDER_RUNTIME_FUNCTION RuntimeFunction)
+{
+    UINT32 Low  = 0;
+    UINT32 High = Module->NumberOfFunctions;
+    UINT64 Rva  = Address - Module->ImageBase;
+
+    while (Low < High)
+    {
+        UINT32 Middle = Low + (High - Low) / 2;
+
+        if (!Unwinder->ReadMemory(Unwinder->ReadMemoryContext,
+                                  Module->ImageBase + Module->ExceptionDirectoryRva + (UINT64)Middle * sizeof(UNWINDER_RUNTIME_FUNCTION),
+                                  RuntimeFunction,
+                                  sizeof(UNWINDER_RUNTIME_FUNCTION)))
+        {
+            return FALSE;
+        }
+
+        if (Rva < RuntimeFunction->BeginAddress)
+        {
+            High = Middle;
+        }
+        else if (Rva >= RuntimeFunction->EndAddress)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            //
+            // The entry might point to the entry of the primary function
+            //
+            if ((RuntimeFunction->UnwindData & 1) != 0 &&
+                !Unwinder->ReadMemory(Unwinder->ReadMemoryContext,
+                                      Module->ImageBase + RuntimeFunction->UnwindData - 1,
+                                      RuntimeFunction,
+                                      sizeof(UNWINDER_RUNTIME_FUNCTION)))
+            {
+                return FALSE;
+            }
+
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Unwind a frame
+ *
+ * @param Unwinder
+ * @param Context The registers of the frame, changed to the registers of
+ * the caller
+ * @param IsReturnAddress Whether the instruction pointer is a return address
+ * (the function is found by the address of the call)
+ * @param IsMachineFrame Set if the caller is unwound from a machine frame
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+UnwinderStep(PUNWINDER Unwinder, PUNWINDER_CONTEXT Context, BOOLEAN IsReturnAddress, BOOLEAN * IsMachineFrame)
+{
+    UNWINDER_RUNTIME_FUNCTION Function;
+    UNWINDER_UNWIND_INFO      Info;
+    PUNWINDER_MODULE          Module;
+    UINT64                    PrologOffset;
+    UINT64                    LookupAddress = IsReturnAddress ? Context->Rip - 1 : Context->Rip;
+
+    *IsMachineFrame = FALSE;
+
+    Module = UnwinderFindModule(Unwinder, LookupAddress);
+
+    if (Module == NULL || !UnwinderLookupFunction(Unwinder, Module, LookupAddress, &Function))
+    {
+        //
+        // Leaf function, the return address is on the top of the stack
+        //
+        if (!UnwinderReadUint64(Unwinder, Context->Gpr[UNWINDER_REGISTER_RSP], &Context->Rip))
+        {
+            return FALSE;
+        }
+
+        Context->Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+
+        return TRUE;
+    }
+
+    PrologOffset = Context->Rip - (Module->ImageBase + Function.BeginAddress);
+
+    for (UINT32 Depth = 0;; Depth++)
+    {
+        UINT8  FrameRegister;
+        UINT64 Frame = Context->Gpr[UNWINDER_REGISTER_RSP];
+        UINT32 CodesSize;
+
+        if (Depth == UNWINDER_MAXIMUM_CHAIN_DEPTH ||
+            !Unwinder->ReadMemory(Unwinder->ReadMemoryContext, Module->ImageBase + Function.UnwindData, &Info, 4))
+        {
+            return FALSE;
+        }
+
+        if ((Info.VersionAndFlags & 7) != 1 && (Info.VersionAndFlags & 7) != 2)
+        {
+            return FALSE;
+        }
+
+        //
+        // Codes are aligned to two slots, then the parent function of the chained infos
+        //
+        CodesSize = ((Info.CountOfCodes + 1) & ~1) * sizeof(UINT16);
+
+        if ((Info.VersionAndFlags >> 3) & UNWINDER_UNW_FLAG_CHAININFO)
+        {
+            CodesSize += sizeof(UNWINDER_RUNTIME_FUNCTION);
+        }
+
+        if (CodesSize != 0 &&
+            !Unwinder->ReadMemory(Unwinder->ReadMemoryContext, Module->ImageBase + Function.UnwindData + 4, Info.UnwindCodes, CodesSize))
+        {
+            return FALSE;
+        }
+
+        FrameRegister = Info.FrameRegisterAndOffset & 0xf;
+
+        if (Depth == 0 && PrologOffset >= Info.SizeOfProlog &&
+            UnwinderUnwindEpilog(Unwinder, Context, &Function, Module->ImageBase, FrameRegister))
+        {
+            return TRUE;
+        }
+
+        if (Depth != 0 || PrologOffset >= Info.SizeOfProlog)
+        {
+            //
+            // The whole prolog is executed (the prologs of the parents are
+            // always executed)
+            //
+            PrologOffset = (UINT64)-1;
+        }
+
+        //
+        // The establisher frame is based on the frame register after it's set
+        //
+        if (FrameRegister != 0)
+        {
+            for (UINT32 i = 0; i < Info.CountOfCodes; i += UnwinderGetCodeSlots(Info.UnwindCodes[i]))
+            {
+                if (((Info.UnwindCodes[i] >> 8) & 0xf) == UNWINDER_UWOP_SET_FPREG && (Info.UnwindCodes[i] & 0xff) <= PrologOffset)
+                {
+                    Frame = Context->Gpr[FrameRegister] - (UINT64)(Info.FrameRegisterAndOffset >> 4) * 16;
+                    break;
+                }
+            }
+        }
+
+        for (UINT32 i = 0; i < Info.CountOfCodes; i += UnwinderGetCodeSlots(Info.UnwindCodes[i]))
+        {
+            UINT8 Operation = (Info.UnwindCodes[i] >> 8) & 0xf;
+            UINT8 OpInfo    = (Info.UnwindCodes[i] >> 12) & 0xf;
+
+            if (i + UnwinderGetCodeSlots(Info.UnwindCodes[i]) > Info.CountOfCodes)
+            {
+                return FALSE;
+            }
+
+            //
+            // The instructions after the instruction pointer are not executed
+            //
+            if ((Info.UnwindCodes[i] & 0xff) > PrologOffset)
+            {
+                continue;
+            }
+
+            switch (Operation)
+            {
+            case UNWINDER_UWOP_PUSH_NONVOL:
+
+                if (!UnwinderReadUint64(Unwinder, Context->Gpr[UNWINDER_REGISTER_RSP], &Context->Gpr[OpInfo]))
+                {
+                    return FALSE;
+                }
+
+                Context->Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+                break;
+
+            case UNWINDER_UWOP_ALLOC_LARGE:
+
+                if (OpInfo == 0)
+                {
+                    Context->Gpr[UNWINDER_REGISTER_RSP] += (UINT64)Info.UnwindCodes[i + 1] * 8;
+                }
+                else
+                {
+                    Context->Gpr[UNWINDER_REGISTER_RSP] += Info.UnwindCodes[i + 1] | ((UINT64)Info.UnwindCodes[i + 2] << 16);
+                }
+                break;
+
+            case UNWINDER_UWOP_ALLOC_SMALL:
+
+                Context->Gpr[UNWINDER_REGISTER_RSP] += (UINT64)OpInfo * 8 + 8;
+                break;
+
+            case UNWINDER_UWOP_SET_FPREG:
+
+                Context->Gpr[UNWINDER_REGISTER_RSP] = Frame;
+                break;
+
+            case UNWINDER_UWOP_SAVE_NONVOL:
+
+                if (!UnwinderReadUint64(Unwinder, Frame + (UINT64)Info.UnwindCodes[i + 1] * 8, &Context->Gpr[OpInfo]))
+                {
+                    return FALSE;
+                }
+                break;
+
+            case UNWINDER_UWOP_SAVE_NONVOL_FAR:
+
+                if (!UnwinderReadUint64(Unwinder,
+                                        Frame + (Info.UnwindCodes[i + 1] | ((UINT64)Info.UnwindCodes[i + 2] << 16)),
+                                        &Context->Gpr[OpInfo]))
+                {
+                    return FALSE;
+                }
+                break;
+
+            case UNWINDER_UWOP_PUSH_MACHFRAME:
+
+                //
+                // The error code is pushed after the machine frame
+                //
+                if (OpInfo != 0)
+                {
+                    Context->Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+                }
+
+                if (!UnwinderReadUint64(Unwinder, Context->Gpr[UNWINDER_REGISTER_RSP], &Context->Rip) ||
+                    !UnwinderReadUint64(Unwinder, Context->Gpr[UNWINDER_REGISTER_RSP] + 24, &Context->Gpr[UNWINDER_REGISTER_RSP]))
+                {
+                    return FALSE;
+                }
+
+                *IsMachineFrame = TRUE;
+                break;
+
+            default:
+
+                //
+                // XMM registers are not unwound, epilog codes are only used
+                // by the unwinders that don't read the code
+                //
+                break;
+            }
+        }
+
+        if (((Info.VersionAndFlags >> 3) & UNWINDER_UNW_FLAG_CHAININFO) == 0)
+        {
+            break;
+        }
+
+        memcpy(&Function, &Info.UnwindCodes[(Info.CountOfCodes + 1) & ~1], sizeof(UNWINDER_RUNTIME_FUNCTION));
+    }
+
+    if (!*IsMachineFrame)
+    {
+        if (!UnwinderReadUint64(Unwinder, Context->Gpr[UNWINDER_REGISTER_RSP], &Context->Rip))
+        {
+            return FALSE;
+        }
+
+        Context->Gpr[UNWINDER_REGISTER_RSP] += sizeof(UINT64);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Walk the frames of a stack
+ * @details The walk is stopped at the end of the stack (null instruction
+ * pointer), if a frame can't be unwound or if the stack doesn't move up
+ *
+ * @param Unwinder
+ * @param Context The registers of the first frame
+ * @param Frames Buffer to save the frames
+ * @param MaximumFrames
+ *
+ * @return UINT32 Number of the frames (including the first frame)
+ */
+UINT32
+UnwinderWalkStack(PUNWINDER Unwinder, PUNWINDER_CONTEXT Context, PUNWINDER_FRAME Frames, UINT32 MaximumFrames)
+{
+    UINT32  FrameCount     = 0;
+    BOOLEAN IsMachineFrame = FALSE;
+
+    while (FrameCount < MaximumFrames)
+    {
+        UINT64 PreviousRip = Context->Rip;
+        UINT64 PreviousRsp = Context->Gpr[UNWINDER_REGISTER_RSP];
+
+        Frames[FrameCount].Rip            = Context->Rip;
+        Frames[FrameCount].Rsp            = Context->Gpr[UNWINDER_REGISTER_RSP];
+        Frames[FrameCount].IsMachineFrame = IsMachineFrame;
+        FrameCount++;
+
+        //
+        // The first frame and the frames that are interrupted are not called,
+        // so their instruction pointer is not a return address
+        //
+        if (FrameCount == MaximumFrames ||
+            !UnwinderStep(Unwinder, Context, FrameCount != 1 && !Frames[FrameCount - 1].IsMachineFrame, &IsMachineFrame) ||
+            Context->Rip == 0)
+        {
+            break;
+        }
+
+        //
+        // Stack switches are only possible through the machine frames
+        //
+        if (IsMachineFrame ? (Context->Rip == PreviousRip && Context->Gpr[UNWINDER_REGISTER_RSP] == PreviousRsp)
+                           : (Context->Gpr[UNWINDER_REGISTER_RSP] <= PreviousRsp))
+        {
+            break;
+        }
+    }
+
+    return FrameCount;
+}
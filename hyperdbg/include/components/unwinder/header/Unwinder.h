@@ -0,0 +1,152 @@
+/**
+ * @file Unwinder.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the x64 stack unwinder
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Definitions					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the modules that are kept in the cache of an unwinder
+ *
+ */
+#define UNWINDER_MODULE_CACHE_SIZE 16
+
+/**
+ * @brief Maximum number of the pages that are searched (backward) to find
+ * the image that contains an address
+ *
+ */
+#define UNWINDER_MAXIMUM_IMAGE_SEARCH_PAGES 0x1000
+
+/**
+ * @brief Size of the pages that are searched for the image headers
+ *
+ */
+#define UNWINDER_PAGE_SIZE 0x1000
+
+/**
+ * @brief Maximum number of the chained unwind infos of a function
+ *
+ */
+#define UNWINDER_MAXIMUM_CHAIN_DEPTH 32
+
+/**
+ * @brief Maximum number of the bytes of an epilog
+ *
+ */
+#define UNWINDER_MAXIMUM_EPILOG_SIZE 32
+
+/**
+ * @brief Index of the rsp register (x64 register numbers)
+ *
+ */
+#define UNWINDER_REGISTER_RSP 4
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Callback for reading the memory of the target
+ *
+ * @return BOOLEAN FALSE if the memory is not accessible
+ */
+typedef BOOLEAN (*UNWINDER_READ_MEMORY)(PVOID Context, UINT64 Address, PVOID Buffer, UINT32 Size);
+
+/**
+ * @brief Registers of a frame
+ * @details The general-purpose registers are in the order of the x64
+ * register numbers (the same as GUEST_REGS)
+ *
+ */
+typedef struct _UNWINDER_CONTEXT
+{
+    UINT64 Gpr[16];
+    UINT64 Rip;
+
+} UNWINDER_CONTEXT, *PUNWINDER_CONTEXT;
+
+/**
+ * @brief An entry of the exception directory (.pdata) of an image
+ *
+ */
+typedef struct _UNWINDER_RUNTIME_FUNCTION
+{
+    UINT32 BeginAddress;
+    UINT32 EndAddress;
+    UINT32 UnwindData;
+
+} UNWINDER_RUNTIME_FUNCTION, *PUNWINDER_RUNTIME_FUNCTION;
+
+/**
+ * @brief A loaded image and its runtime functions
+ * @details The exception directory of an image is sorted by the address of
+ * the functions, so it's searched in place
+ *
+ */
+typedef struct _UNWINDER_MODULE
+{
+    UINT64 ImageBase;
+    UINT32 SizeOfImage;
+    UINT32 ExceptionDirectoryRva;
+    UINT32 NumberOfFunctions;
+
+} UNWINDER_MODULE, *PUNWINDER_MODULE;
+
+/**
+ * @brief A frame of the stack
+ *
+ */
+typedef struct _UNWINDER_FRAME
+{
+    UINT64  Rip;
+    UINT64  Rsp;
+    BOOLEAN IsMachineFrame; // The frame is unwound from an interrupt (trap) frame
+
+} UNWINDER_FRAME, *PUNWINDER_FRAME;
+
+/**
+ * @brief State of an unwinder
+ *
+ */
+typedef struct _UNWINDER
+{
+    UNWINDER_READ_MEMORY ReadMemory;
+    PVOID                ReadMemoryContext;
+    UNWINDER_MODULE      Modules[UNWINDER_MODULE_CACHE_SIZE];
+    UINT32               ModuleCount;
+    UINT32               NextReplacedModule; // The cache is replaced in a round-robin order
+
+} UNWINDER, *PUNWINDER;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+UnwinderInitialize(PUNWINDER Unwinder, UNWINDER_READ_MEMORY ReadMemory, PVOID ReadMemoryContext);
+
+PUNWINDER_MODULE
+UnwinderFindModule(PUNWINDER Unwinder, UINT64 Address);
+
+BOOLEAN
+UnwinderLookupFunction(PUNWINDER                  Unwinder,
+                       PUNWINDER_MODULE           Module,
+                       UINT64                     Address,
+                       PUNWINDER_RUNTIME_FUNCTION RuntimeFunction);
+
+BOOLEAN
+UnwinderStep(PUNWINDER Unwinder, PUNWINDER_CONTEXT Context, BOOLEAN IsReturnAddress, BOOLEAN * IsMachineFrame);
+
+UINT32
+UnwinderWalkStack(PUNWINDER Unwinder, PUNWINDER_CONTEXT Context, PUNWINDER_FRAME Frames, UINT32 MaximumFrames);
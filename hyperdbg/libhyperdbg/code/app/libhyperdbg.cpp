@@ -161,6 +161,202 @@ ShowMessages(const char * Fmt, ...)
     }
 }
 
+/**
+ * @brief Handle a message that is received from the kernel
+ *
+ * @param OperationCode Operation code of the message
+ * @param Message The (null-terminated) body of the message
+ * @param ReturnedLength Length of the message (including the operation code)
+ * @return VOID
+ */
+VOID
+ReadIrpBasedBufferHandleMessage(UINT32 OperationCode, CHAR * Message, UINT32 ReturnedLength)
+{
+    UINT32 MessageLength;
+    UINT32 RecordSize;
+
+    /*
+    ShowMessages("Returned Length : 0x%x \n", ReturnedLength);
+    ShowMessages("Operation Code : 0x%x \n", OperationCode);
+    */
+
+    switch (OperationCode)
+    {
+    case OPERATION_LOG_NON_IMMEDIATE_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        //
+        // The buffer is a mix of the texts and the records of the events
+        //
+        ForwardingShowEventMessages(Message, ReturnedLength - sizeof(UINT32));
+
+        break;
+    case OPERATION_LOG_INFO_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+    case OPERATION_LOG_ERROR_MESSAGE:
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+    case OPERATION_LOG_WARNING_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+
+    case OPERATION_COMMAND_FROM_DEBUGGER_CLOSE_AND_UNLOAD_VMM:
+
+        KdCloseConnection();
+
+        break;
+
+    case OPERATION_DEBUGGEE_USER_INPUT:
+
+        KdHandleUserInputInDebuggee((DEBUGGEE_USER_INPUT_PACKET *)Message);
+
+        break;
+
+    case OPERATION_DEBUGGEE_REGISTER_EVENT:
+
+        KdRegisterEventInDebuggee(
+            (PDEBUGGER_GENERAL_EVENT_DETAIL)Message,
+            ReturnedLength);
+
+        break;
+
+    case OPERATION_DEBUGGEE_ADD_ACTION_TO_EVENT:
+
+        KdAddActionToEventInDebuggee(
+            (PDEBUGGER_GENERAL_ACTION)Message,
+            ReturnedLength);
+
+        break;
+
+    case OPERATION_DEBUGGEE_CLEAR_EVENTS:
+
+        KdSendModifyEventInDebuggee(
+            (PDEBUGGER_MODIFY_EVENTS)Message,
+            TRUE);
+
+        break;
+
+    case OPERATION_DEBUGGEE_CLEAR_EVENTS_WITHOUT_NOTIFYING_DEBUGGER:
+
+        KdSendModifyEventInDebuggee(
+            (PDEBUGGER_MODIFY_EVENTS)Message,
+            FALSE);
+
+        break;
+
+    case OPERATION_HYPERVISOR_DRIVER_IS_SUCCESSFULLY_LOADED:
+
+        //
+        // Indicate that driver (Hypervisor) is loaded successfully
+        //
+        SetEvent(g_IsDriverLoadedSuccessfully);
+
+        break;
+
+    case OPERATION_HYPERVISOR_DRIVER_END_OF_IRPS:
+
+        //
+        // End of receiving messages (IRPs), nothing to do
+        //
+        break;
+
+    case OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL:
+
+        //
+        // Pause debugger after getting the results
+        //
+        KdReloadSymbolsInDebuggee(TRUE,
+                                  ((PDEBUGGEE_SYMBOL_REQUEST_PACKET)Message)->ProcessId);
+
+        break;
+
+    case OPERATION_NOTIFICATION_FROM_USER_DEBUGGER_PAUSE:
+
+        //
+        // handle pausing packet from user debugger
+        //
+        UdHandleUserDebuggerPausing(
+            (PDEBUGGEE_UD_PAUSED_PACKET)Message);
+
+        break;
+
+    default:
+
+        //
+        // The records are forwarded with their exact sizes, but the texts
+        // are forwarded without their nulls
+        //
+        MessageLength = ReturnedLength - sizeof(UINT32);
+
+        if (EventRecordGetType(Message, MessageLength, &RecordSize) == EVENT_RECORD_TYPE_TEXT && MessageLength != 0)
+        {
+            MessageLength--;
+        }
+
+        //
+        // Check if there are available output sources
+        //
+        if (!g_OutputSourcesInitialized || !ForwardingCheckAndPerformEventForwarding(OperationCode,
+                                                                                     Message,
+                                                                                     MessageLength))
+        {
+            if (g_BreakPrintingOutput)
+            {
+                //
+                // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+                // we shouldn't show or save anything in this case
+                //
+                return;
+            }
+
+            ForwardingShowEventMessages(Message, ReturnedLength - sizeof(UINT32));
+        }
+
+        break;
+    }
+}
+
 /**
  * @brief Read kernel buffers using IRP Pending
  *
@@ -177,9 +373,28 @@ ReadIrpBasedBuffer()
     DWORD                  ErrorNum;
     HANDLE                 Handle;
 
+#if UseBatchedLogDelivery == TRUE
+
+    UINT32 Offset;
+    PVOID  Message;
+    UINT32 MessageLength;
+    UINT32 OutputBufferSize = UsermodeBatchBufferSize;
+
+    //
+    // Multiple messages are returned in each IRP
+    //
+    RegisterEvent.hEvent = NULL;
+    RegisterEvent.Type   = IRP_BASED_BATCHED;
+
+#else
+
+    UINT32 OutputBufferSize = UsermodeBufferSize;
+
     RegisterEvent.hEvent = NULL;
     RegisterEvent.Type   = IRP_BASED;
 
+#endif // UseBatchedLogDelivery == TRUE
+
     //
     // Create another handle to be used in for reading kernel messages,
     // it is because I noticed that if I use a same handle for IRP Pending
@@ -225,7 +440,7 @@ ReadIrpBasedBuffer()
     //
     // allocate buffer for transferring messages
     //
-    char * OutputBuffer = (char *)malloc(UsermodeBufferSize);
+    char * OutputBuffer = (char *)malloc(OutputBufferSize);
 
     try
     {
@@ -233,11 +448,15 @@ ReadIrpBasedBuffer()
         {
             if (!g_IsVmxOffProcessStart)
             {
+#if UseBatchedLogDelivery == FALSE
+
                 //
                 // Clear the buffer
                 //
                 ZeroMemory(OutputBuffer, UsermodeBufferSize);
 
+#endif // UseBatchedLogDelivery == FALSE
+
                 Sleep(DefaultSpeedOfReadingKernelMessages); // we're not trying to eat all of the CPU ;)
 
                 Status = DeviceIoControl(
@@ -247,7 +466,7 @@ ReadIrpBasedBuffer()
                     SIZEOF_REGISTER_EVENT * 2, // Length of input buffer in bytes. (x 2 is bcuz as the
                                                // driver is x64 and has 64 bit values)
                     OutputBuffer,              // Output Buffer from driver.
-                    UsermodeBufferSize,        // Length of output buffer in bytes.
+                    OutputBufferSize,          // Length of output buffer in bytes.
                     &ReturnedLength,           // Bytes placed in buffer.
                     NULL                       // synchronous call
                 );
@@ -266,178 +485,30 @@ ReadIrpBasedBuffer()
                     continue;
                 }
 
+#if UseBatchedLogDelivery == TRUE
+
                 //
-                // Compute the received buffer's operation code
+                // Handle all of the messages of the batch, the messages are
+                // used in place
                 //
-                OperationCode = 0;
-                memcpy(&OperationCode, OutputBuffer, sizeof(UINT32));
-
-                /*
-        ShowMessages("Returned Length : 0x%x \n", ReturnedLength);
-        ShowMessages("Operation Code : 0x%x \n", OperationCode);
-                */
+                Offset = 0;
 
-                switch (OperationCode)
+                while (LogBatchReadRecord(OutputBuffer, ReturnedLength, &Offset, &OperationCode, &Message, &MessageLength))
                 {
-                case OPERATION_LOG_NON_IMMEDIATE_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_INFO_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_ERROR_MESSAGE:
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_WARNING_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-
-                case OPERATION_COMMAND_FROM_DEBUGGER_CLOSE_AND_UNLOAD_VMM:
-
-                    KdCloseConnection();
-
-                    break;
-
-                case OPERATION_DEBUGGEE_USER_INPUT:
-
-                    KdHandleUserInputInDebuggee((DEBUGGEE_USER_INPUT_PACKET *)(OutputBuffer + sizeof(UINT32)));
-
-                    break;
-
-                case OPERATION_DEBUGGEE_REGISTER_EVENT:
-
-                    KdRegisterEventInDebuggee(
-                        (PDEBUGGER_GENERAL_EVENT_DETAIL)(OutputBuffer + sizeof(UINT32)),
-                        ReturnedLength);
-
-                    break;
-
-                case OPERATION_DEBUGGEE_ADD_ACTION_TO_EVENT:
-
-                    KdAddActionToEventInDebuggee(
-                        (PDEBUGGER_GENERAL_ACTION)(OutputBuffer + sizeof(UINT32)),
-                        ReturnedLength);
-
-                    break;
-
-                case OPERATION_DEBUGGEE_CLEAR_EVENTS:
-
-                    KdSendModifyEventInDebuggee(
-                        (PDEBUGGER_MODIFY_EVENTS)(OutputBuffer + sizeof(UINT32)),
-                        TRUE);
-
-                    break;
-
-                case OPERATION_DEBUGGEE_CLEAR_EVENTS_WITHOUT_NOTIFYING_DEBUGGER:
-
-                    KdSendModifyEventInDebuggee(
-                        (PDEBUGGER_MODIFY_EVENTS)(OutputBuffer + sizeof(UINT32)),
-                        FALSE);
-
-                    break;
-
-                case OPERATION_HYPERVISOR_DRIVER_IS_SUCCESSFULLY_LOADED:
-
-                    //
-                    // Indicate that driver (Hypervisor) is loaded successfully
-                    //
-                    SetEvent(g_IsDriverLoadedSuccessfully);
-
-                    break;
-
-                case OPERATION_HYPERVISOR_DRIVER_END_OF_IRPS:
-
-                    //
-                    // End of receiving messages (IRPs), nothing to do
-                    //
-                    break;
-
-                case OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL:
-
-                    //
-                    // Pause debugger after getting the results
-                    //
-                    KdReloadSymbolsInDebuggee(TRUE,
-                                              ((PDEBUGGEE_SYMBOL_REQUEST_PACKET)(OutputBuffer + sizeof(UINT32)))->ProcessId);
-
-                    break;
+                    ReadIrpBasedBufferHandleMessage(OperationCode, (CHAR *)Message, MessageLength + sizeof(UINT32));
+                }
 
-                case OPERATION_NOTIFICATION_FROM_USER_DEBUGGER_PAUSE:
+#else
 
-                    //
-                    // handle pausing packet from user debugger
-                    //
-                    UdHandleUserDebuggerPausing(
-                        (PDEBUGGEE_UD_PAUSED_PACKET)(OutputBuffer + sizeof(UINT32)));
-
-                    break;
+                //
+                // Compute the received buffer's operation code
+                //
+                OperationCode = 0;
+                memcpy(&OperationCode, OutputBuffer, sizeof(UINT32));
 
-                default:
+                ReadIrpBasedBufferHandleMessage(OperationCode, OutputBuffer + sizeof(UINT32), ReturnedLength);
 
-                    //
-                    // Check if there are available output sources
-                    //
-                    if (!g_OutputSourcesInitialized || !ForwardingCheckAndPerformEventForwarding(OperationCode,
-                                                                                                 OutputBuffer + sizeof(UINT32),
-                                                                                                 ReturnedLength - sizeof(UINT32) - 1))
-                    {
-                        if (g_BreakPrintingOutput)
-                        {
-                            //
-                            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                            // we shouldn't show or save anything in this case
-                            //
-                            continue;
-                        }
-
-                        ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-                    }
-
-                    break;
-                }
+#endif // UseBatchedLogDelivery == TRUE
             }
             else
             {
@@ -31,6 +31,7 @@ CommandEvalHelp()
     ShowMessages("\n");
     ShowMessages("\t\te.g : ? print(dq(poi(@rcx)));\n");
     ShowMessages("\t\te.g : ? json(dq(poi(@rcx)));\n");
+    ShowMessages("\t\te.g : ? test\n");
 }
 
 /**
@@ -261,6 +262,11 @@ CommandEval(vector<CommandToken> CommandTokens, string Command)
             return;
         }
 
+        //
+        // Optimize the script before it's sent to the debuggee
+        //
+        ScriptEngineWrapperOptimizeSymbolBuffer(CodeBuffer);
+
         //
         // Print symbols (test)
         //
@@ -294,6 +300,6 @@ CommandEval(vector<CommandToken> CommandTokens, string Command)
                      "ONLY in debugger-mode\n\n");
 
         ShowMessages("test expression : %s \n", Command.c_str());
-        ScriptEngineWrapperTestParser(Command);
+        ScriptEngineWrapperTestParser(Command, TRUE);
     }
 }
@@ -423,6 +423,12 @@ CommandEventClearEvent(UINT64 Tag)
                 //
                 RemoveEntryList(&CommandDetail->CommandsEventList);
 
+                //
+                // Its messages are not forwarded anymore
+                //
+                ForwardingRemoveEventOutputSources(CommandDetail->Tag);
+                ForwardingRemoveEventScript(CommandDetail->Tag);
+
                 //
                 // Free the event it self
                 //
@@ -456,6 +462,12 @@ CommandEventClearEvent(UINT64 Tag)
         // Reinitialize list head
         //
         InitializeListHead(&g_EventTrace);
+
+        //
+        // None of the messages are forwarded anymore
+        //
+        ForwardingRemoveEventOutputSources(DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG);
+        ForwardingRemoveEventScript(DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG);
     }
 
     //
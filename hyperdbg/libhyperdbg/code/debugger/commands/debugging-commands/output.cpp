@@ -29,7 +29,7 @@ CommandOutputHelp()
                  "forwarding.\n\n");
 
     ShowMessages("syntax : \toutput\n");
-    ShowMessages("syntax : \toutput [create Name (string)] [file|namedpipe|tcp|module Address (string)]\n");
+    ShowMessages("syntax : \toutput [create Name (string)] [file|namedpipe|tcp|module Address (string)] [block|drop]\n");
     ShowMessages("syntax : \toutput [open|close Name (string)]\n");
 
     ShowMessages("\n");
@@ -39,12 +39,17 @@ CommandOutputHelp()
     ShowMessages("\t\te.g : output create MyOutputName1 file "
                  "\"c:\\rev\\output file.txt\"\n");
     ShowMessages("\t\te.g : output create MyOutputName2 tcp 192.168.1.10:8080\n");
+    ShowMessages("\t\te.g : output create MyOutputName2 tcp 192.168.1.10:8080 drop\n");
     ShowMessages("\t\te.g : output create MyOutputName3 namedpipe "
                  "\\\\.\\Pipe\\HyperDbgOutput\n");
     ShowMessages("\t\te.g : output create MyOutputName1 module "
                  "c:\\rev\\event_forwarding.dll\n");
     ShowMessages("\t\te.g : output open MyOutputName1\n");
     ShowMessages("\t\te.g : output close MyOutputName1\n");
+
+    ShowMessages("\n");
+    ShowMessages("the messages are queued and written to the output in batches, once the queue "
+                 "is full, 'block' (default) waits for the output and 'drop' drops the new messages\n");
 }
 
 /**
@@ -60,15 +65,17 @@ CommandOutput(vector<CommandToken> CommandTokens, string Command)
     PDEBUGGER_EVENT_FORWARDING     EventForwardingObject;
     DEBUGGER_EVENT_FORWARDING_TYPE Type;
     DEBUGGER_OUTPUT_SOURCE_STATUS  Status;
+    FORWARD_QUEUE_STATISTICS       Statistics;
     string                         DetailsOfSource;
     UINT32                         IndexToShowList;
+    FORWARD_QUEUE_POLICY           Policy            = FORWARD_QUEUE_POLICY_BLOCK;
     PLIST_ENTRY                    TempList          = 0;
     BOOLEAN                        OutputSourceFound = FALSE;
     HANDLE                         SourceHandle      = INVALID_HANDLE_VALUE;
     SOCKET                         Socket            = NULL;
     HMODULE                        Module            = NULL;
 
-    if ((CommandTokens.size() != 1 && CommandTokens.size() <= 2) || CommandTokens.size() >= 6)
+    if ((CommandTokens.size() != 1 && CommandTokens.size() <= 2) || CommandTokens.size() >= 7)
     {
         ShowMessages("incorrect use of the '%s'\n\n",
                      GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
@@ -136,6 +143,22 @@ CommandOutput(vector<CommandToken> CommandTokens, string Command)
                 }
 
                 ShowMessages("%x  %s   %s\t%s\n", IndexToShowList, TempTypeString.c_str(), TempStateString.c_str(), CurrentOutputSourceDetails->Name);
+
+                //
+                // Show the counters of the messages of the opened (or closed) outputs
+                //
+                if (CurrentOutputSourceDetails->State != EVENT_FORWARDING_STATE_NOT_OPENED)
+                {
+                    ForwardingGetOutputSourceStatistics(CurrentOutputSourceDetails, &Statistics);
+
+                    ShowMessages("\t(%s) written: %llx messages (%llx bytes in %llx batches), dropped: %llx messages, failed: %llx messages\n",
+                                 CurrentOutputSourceDetails->Policy == FORWARD_QUEUE_POLICY_DROP ? "drop" : "block",
+                                 Statistics.WrittenMessages,
+                                 Statistics.WrittenBytes,
+                                 Statistics.Batches,
+                                 Statistics.DroppedMessages,
+                                 Statistics.FailedMessages);
+                }
             }
         }
         else
@@ -193,6 +216,24 @@ CommandOutput(vector<CommandToken> CommandTokens, string Command)
             return;
         }
 
+        //
+        // Check for the policy of the queue of the output source
+        //
+        if (CommandTokens.size() == 6)
+        {
+            if (CompareLowerCaseStrings(CommandTokens.at(5), "drop"))
+            {
+                Policy = FORWARD_QUEUE_POLICY_DROP;
+            }
+            else if (!CompareLowerCaseStrings(CommandTokens.at(5), "block"))
+            {
+                ShowMessages("incorrect policy near '%s'\n\n",
+                             GetCaseSensitiveStringFromCommandToken(CommandTokens.at(5)).c_str());
+                CommandOutputHelp();
+                return;
+            }
+        }
+
         //
         // Check to make sure that the name doesn't exceed the maximum character
         //
@@ -288,6 +329,11 @@ CommandOutput(vector<CommandToken> CommandTokens, string Command)
         //
         EventForwardingObject->Type = Type;
 
+        //
+        // Set the policy of the queue
+        //
+        EventForwardingObject->Policy = Policy;
+
         //
         // Get a new tag
         //
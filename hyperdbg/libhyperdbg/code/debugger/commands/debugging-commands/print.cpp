@@ -99,6 +99,11 @@ CommandPrint(vector<CommandToken> CommandTokens, string Command)
             return;
         }
 
+        //
+        // Optimize the script before it's sent to the debuggee
+        //
+        ScriptEngineWrapperOptimizeSymbolBuffer(CodeBuffer);
+
         //
         // Print symbols (test)
         //
@@ -545,6 +545,11 @@ CommandR(vector<CommandToken> CommandTokens, string Command)
                         return;
                     }
 
+                    //
+                    // Optimize the script before it's sent to the debuggee
+                    //
+                    ScriptEngineWrapperOptimizeSymbolBuffer(CodeBuffer);
+
                     //
                     // Print symbols (test)
                     //
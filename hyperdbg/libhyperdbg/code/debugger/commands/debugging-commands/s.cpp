@@ -437,6 +437,17 @@ CommandSearchMemory(vector<CommandToken> CommandTokens, string Command)
         return;
     }
 
+    //
+    // Check the length of the pattern (in bytes)
+    //
+    if (CountOfValues * (SearchMemoryRequest.ByteSize == SEARCH_BYTE ? 1 : (SearchMemoryRequest.ByteSize == SEARCH_DWORD ? 4 : 8)) >
+        MaximumSearchPatternLength)
+    {
+        ShowMessages("err, the pattern is too long (maximum length is 0x%x bytes)\n\n",
+                     MaximumSearchPatternLength);
+        return;
+    }
+
     //
     // Now it's time to put everything together in one structure
     //
@@ -14,11 +14,13 @@
 //
 // Global Variables
 //
-extern BOOLEAN g_AutoUnpause;
-extern BOOLEAN g_AutoFlush;
-extern BOOLEAN g_AddressConversion;
-extern BOOLEAN g_IsConnectedToRemoteDebuggee;
-extern UINT32  g_DisassemblerSyntax;
+extern BOOLEAN    g_AutoUnpause;
+extern BOOLEAN    g_AutoFlush;
+extern BOOLEAN    g_AddressConversion;
+extern BOOLEAN    g_KdMemoryCacheEnabled;
+extern BOOLEAN    g_IsConnectedToRemoteDebuggee;
+extern UINT32     g_DisassemblerSyntax;
+extern PAGE_CACHE g_KdMemoryCache;
 
 /**
  * @brief help of the settings command
@@ -44,6 +46,8 @@ CommandSettingsHelp()
     ShowMessages("\t\te.g : settings addressconversion off\n");
     ShowMessages("\t\te.g : settings autoflush on\n");
     ShowMessages("\t\te.g : settings autoflush off\n");
+    ShowMessages("\t\te.g : settings memorycache on\n");
+    ShowMessages("\t\te.g : settings memorycache off\n");
     ShowMessages("\t\te.g : settings syntax intel\n");
     ShowMessages("\t\te.g : settings syntax att\n");
     ShowMessages("\t\te.g : settings syntax masm\n");
@@ -261,6 +265,28 @@ CommandSettingsLoadDefaultValuesFromConfigFile()
             ShowMessages("err, incorrect address conversion settings\n");
         }
     }
+
+    //
+    // Set the memory cache
+    //
+    if (CommandSettingsGetValueFromConfigFile("MemoryCache", OptionValue))
+    {
+        if (!OptionValue.compare("on"))
+        {
+            g_KdMemoryCacheEnabled = TRUE;
+        }
+        else if (!OptionValue.compare("off"))
+        {
+            g_KdMemoryCacheEnabled = FALSE;
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("err, incorrect memory cache settings\n");
+        }
+    }
 }
 
 /**
@@ -542,6 +568,77 @@ CommandSettingsSyntax(vector<CommandToken> CommandTokens)
     }
 }
 
+/**
+ * @brief set the cache of the debuggee's memory (in the Debugger Mode)
+ * to enabled or disabled and query the status of this mode
+ *
+ * @param CommandTokens
+ * @return VOID
+ */
+VOID
+CommandSettingsMemoryCache(vector<CommandToken> CommandTokens)
+{
+    if (CommandTokens.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_KdMemoryCacheEnabled)
+        {
+            ShowMessages("memory cache is enabled\n");
+        }
+        else
+        {
+            ShowMessages("memory cache is disabled\n");
+        }
+    }
+    else if (CommandTokens.size() == 3)
+    {
+        //
+        // The user tries to set a value as the memory cache
+        //
+        if (CompareLowerCaseStrings(CommandTokens.at(2), "on"))
+        {
+            g_KdMemoryCacheEnabled = TRUE;
+            CommandSettingsSetValueFromConfigFile("MemoryCache", "on");
+
+            ShowMessages("set memory cache to enabled\n");
+        }
+        else if (CompareLowerCaseStrings(CommandTokens.at(2), "off"))
+        {
+            g_KdMemoryCacheEnabled = FALSE;
+            CommandSettingsSetValueFromConfigFile("MemoryCache", "off");
+
+            //
+            // The cached pages are not invalidated while it's disabled
+            //
+            PageCacheInvalidate(&g_KdMemoryCache);
+
+            ShowMessages("set memory cache to disabled\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                         GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of the '%s', please use 'help %s' for more information\n",
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str(),
+                     GetCaseSensitiveStringFromCommandToken(CommandTokens.at(0)).c_str());
+        return;
+    }
+}
+
 /**
  * @brief settings command handler
  *
@@ -624,6 +721,14 @@ CommandSettings(vector<CommandToken> CommandTokens, string Command)
             CommandSettingsAddressConversion(CommandTokens);
         }
     }
+    else if (CompareLowerCaseStrings(CommandTokens.at(1), "memorycache"))
+    {
+        //
+        // The memory of the debuggee is cached in this debugger, so
+        // it's handled locally
+        //
+        CommandSettingsMemoryCache(CommandTokens);
+    }
     else
     {
         //
@@ -23,7 +23,7 @@ CommandEptHookHelp()
 
     ShowMessages(
         "syntax : \t!epthook [Address (hex)] [pid ProcessId (hex)] [core CoreId (hex)] "
-        "[imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] [script { Script (string) }] "
+        "[imm IsImmediate (yesno)] [rec SendRecords (yesno)] [buffer PreAllocatedBuffer (hex)] [script { Script (string) }] "
         "[asm condition { Condition (assembly/hex) }] [asm code { Code (assembly/hex) }] [output {OutputName (string)}]\n");
 
     ShowMessages("\n");
@@ -23,7 +23,7 @@ CommandEptHook2Help()
 
     ShowMessages(
         "syntax : \t!epthook2 [Address (hex)] [pid ProcessId (hex)] "
-        "[core CoreId (hex)] [imm IsImmediate (yesno)] [buffer PreAllocatedBuffer (hex)] "
+        "[core CoreId (hex)] [imm IsImmediate (yesno)] [rec SendRecords (yesno)] [buffer PreAllocatedBuffer (hex)] "
         "[script { Script (string) }] [asm condition { Condition (assembly/hex) }] [asm code { Code (assembly/hex) }] "
         "[output {OutputName (string)}]\n");
 
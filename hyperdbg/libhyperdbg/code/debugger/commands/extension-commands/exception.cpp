@@ -24,7 +24,7 @@ CommandExceptionHelp()
 
     ShowMessages(
         "syntax : \t!exception [IdtIndex (hex)] [pid ProcessId (hex)] "
-        "[core CoreId (hex)] [imm IsImmediate (yesno)] [sc EnableShortCircuiting (onoff)] "
+        "[core CoreId (hex)] [imm IsImmediate (yesno)] [rec SendRecords (yesno)] [sc EnableShortCircuiting (onoff)] "
         "[stage CallingStage (prepostall)] [buffer PreAllocatedBuffer (hex)] [script { Script (string) }] "
         "[asm condition { Condition (assembly/hex) }] [asm code { Code (assembly/hex) }] [output {OutputName (string)}]\n");
 
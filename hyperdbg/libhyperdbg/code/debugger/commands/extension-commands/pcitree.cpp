@@ -95,20 +95,11 @@ CommandPcitree(vector<CommandToken> CommandTokens, string Command)
             ShowMessages("%-12s | %-9s | %-17s | %s \n%s\n", "DBDF", "VID:DID", "Vendor Name", "Device Name", "----------------------------------------------------------------------");
             for (UINT8 i = 0; i < (PcitreePacket.DeviceInfoListNum < DEV_MAX_NUM ? PcitreePacket.DeviceInfoListNum : DEV_MAX_NUM); i++)
             {
-                Vendor * CurrentVendor     = GetVendorById(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId);
-                CHAR *   CurrentVendorName = (CHAR *)"N/A";
-                CHAR *   CurrentDeviceName = (CHAR *)"N/A";
+                const char * CurrentVendorName = GetVendorNameById(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId);
+                const char * CurrentDeviceName = GetDeviceNameById(PcitreePacket.DeviceInfoList[i].ConfigSpace.VendorId, PcitreePacket.DeviceInfoList[i].ConfigSpace.DeviceId);
 
-                if (CurrentVendor != NULL)
-                {
-                    CurrentVendorName      = CurrentVendor->VendorName;
-                    Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcitreePacket.DeviceInfoList[i].ConfigSpace.DeviceId);
-
-                    if (CurrentDevice != NULL)
-                    {
-                        CurrentDeviceName = CurrentDevice->DeviceName;
-                    }
-                }
+                CurrentVendorName = CurrentVendorName != NULL ? CurrentVendorName : "N/A";
+                CurrentDeviceName = CurrentDeviceName != NULL ? CurrentDeviceName : "N/A";
 
                 ShowMessages("%04x:%02x:%02x:%x | %04x:%04x | %-17.*s | %.*s\n",
                              0, // TODO: Add support for domains beyond 0000
@@ -123,8 +114,6 @@ CommandPcitree(vector<CommandToken> CommandTokens, string Command)
                              CurrentDeviceName
 
                 );
-
-                FreeVendor(CurrentVendor);
             }
             FreePciIdDatabase();
         }
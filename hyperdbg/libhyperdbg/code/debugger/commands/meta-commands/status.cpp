@@ -14,13 +14,15 @@
 //
 // Global Variables
 //
-extern BOOLEAN g_IsConnectedToHyperDbgLocally;
-extern BOOLEAN g_IsConnectedToRemoteDebuggee;
-extern BOOLEAN g_IsConnectedToRemoteDebugger;
-extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
-extern BOOLEAN g_IsSerialConnectedToRemoteDebugger;
-extern string  g_ServerPort;
-extern string  g_ServerIp;
+extern BOOLEAN    g_IsConnectedToHyperDbgLocally;
+extern BOOLEAN    g_IsConnectedToRemoteDebuggee;
+extern BOOLEAN    g_IsConnectedToRemoteDebugger;
+extern BOOLEAN    g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN    g_IsSerialConnectedToRemoteDebugger;
+extern BOOLEAN    g_KdMemoryCacheEnabled;
+extern PAGE_CACHE g_KdMemoryCache;
+extern string     g_ServerPort;
+extern string     g_ServerIp;
 
 /**
  * @brief help of the .status command
@@ -63,6 +65,28 @@ CommandStatus(vector<CommandToken> CommandTokens, string Command)
         // Connected to a remote debugger (serial port)
         //
         ShowMessages("remote debugging - debugger ('debugger mode')\n");
+
+        //
+        // Show the state of the cache of the debuggee's memory
+        //
+        if (g_KdMemoryCacheEnabled)
+        {
+            PAGE_CACHE_STATISTICS * Statistics = &g_KdMemoryCache.Statistics;
+            UINT64                  Accesses   = Statistics->Hits + Statistics->Misses;
+
+            ShowMessages("memory cache : %llu hits, %llu misses (%llu%% hit rate), %llu reads, "
+                         "%llu prefetched pages, %llu invalidations\n",
+                         Statistics->Hits,
+                         Statistics->Misses,
+                         Accesses == 0 ? 0 : Statistics->Hits * 100 / Accesses,
+                         Statistics->Reads,
+                         Statistics->PrefetchedPages,
+                         Statistics->Invalidations);
+        }
+        else
+        {
+            ShowMessages("memory cache : disabled\n");
+        }
     }
     else if (g_IsSerialConnectedToRemoteDebugger)
     {
@@ -14,9 +14,12 @@
 //
 // Global Variables
 //
-extern UINT64     g_OutputSourceTag;
-extern LIST_ENTRY g_OutputSources;
-extern LIST_ENTRY g_EventTrace;
+extern UINT64                                                             g_OutputSourceTag;
+extern LIST_ENTRY                                                         g_OutputSources;
+extern std::unordered_map<UINT32, std::vector<PDEBUGGER_EVENT_FORWARDING>> g_OutputSourcesOfEvents;
+extern SRWLOCK                                                            g_OutputSourcesOfEventsLock;
+extern std::unordered_map<UINT64, DEBUGGER_EVENT_SCRIPT>                  g_ScriptsOfEvents;
+extern SRWLOCK                                                            g_ScriptsOfEventsLock;
 
 /**
  * @brief Get the output source tag and increase the
@@ -30,6 +33,288 @@ ForwardingGetNewOutputSourceTag()
     return g_OutputSourceTag++;
 }
 
+/**
+ * @brief Write a batch of the messages to the output source
+ * @param SourceDescriptor Descriptor of the source
+ * @param BatchLength Length of the batch
+ * @param MessageCount Number of the messages of the batch
+ *
+ * @details files and tcp sockets get the whole batch at once, but the
+ * namedpipes and the modules get each message on its own
+ *
+ * @return BOOLEAN whether the batch is written or not
+ */
+static BOOLEAN
+ForwardingWriteBatch(PDEBUGGER_EVENT_FORWARDING SourceDescriptor,
+                     UINT32                     BatchLength,
+                     UINT32                     MessageCount)
+{
+    BOOLEAN Result = TRUE;
+    UINT32  Offset = 0;
+
+    switch (SourceDescriptor->Type)
+    {
+    case EVENT_FORWARDING_FILE:
+        return ForwardingWriteToFile(SourceDescriptor->Handle,
+                                     SourceDescriptor->Batch,
+                                     BatchLength);
+    case EVENT_FORWARDING_TCP:
+        return ForwardingSendToTcpSocket(SourceDescriptor->Socket,
+                                         SourceDescriptor->Batch,
+                                         BatchLength);
+    case EVENT_FORWARDING_NAMEDPIPE:
+        for (UINT32 i = 0; i < MessageCount; i++)
+        {
+            if (!ForwardingSendToNamedPipe(SourceDescriptor->Handle,
+                                           SourceDescriptor->Batch + Offset,
+                                           SourceDescriptor->BatchLengths[i]))
+            {
+                Result = FALSE;
+            }
+
+            Offset += SourceDescriptor->BatchLengths[i];
+        }
+        return Result;
+    case EVENT_FORWARDING_MODULE:
+        for (UINT32 i = 0; i < MessageCount; i++)
+        {
+            ((hyperdbg_event_forwarding_t)SourceDescriptor->Handle)(
+                SourceDescriptor->Batch + Offset,
+                SourceDescriptor->BatchLengths[i]);
+
+            Offset += SourceDescriptor->BatchLengths[i];
+        }
+        return TRUE;
+    default:
+        break;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief The worker thread of an output source
+ * @param Parameter Descriptor of the source
+ *
+ * @details takes all of the queued messages at once and writes them
+ * (out of the lock), until the source is closed and its queue is empty
+ *
+ * @return DWORD
+ */
+static DWORD WINAPI
+ForwardingOutputSourceWorker(LPVOID Parameter)
+{
+    PDEBUGGER_EVENT_FORWARDING SourceDescriptor = (PDEBUGGER_EVENT_FORWARDING)Parameter;
+    UINT32 *                   Lengths          = NULL;
+    UINT32                     BatchLength;
+    UINT32                     MessageCount;
+    BOOLEAN                    IsWritten;
+
+    //
+    // Only the namedpipes and the modules need the boundaries of the messages
+    //
+    if (SourceDescriptor->Type == EVENT_FORWARDING_NAMEDPIPE ||
+        SourceDescriptor->Type == EVENT_FORWARDING_MODULE)
+    {
+        Lengths = SourceDescriptor->BatchLengths;
+    }
+
+    EnterCriticalSection(&SourceDescriptor->QueueLock);
+
+    while (TRUE)
+    {
+        while (ForwardQueueIsEmpty(&SourceDescriptor->Queue) && !SourceDescriptor->StopWorker)
+        {
+            SleepConditionVariableCS(&SourceDescriptor->QueueNotEmpty, &SourceDescriptor->QueueLock, INFINITE);
+        }
+
+        if (ForwardQueueIsEmpty(&SourceDescriptor->Queue))
+        {
+            //
+            // The source is closed and everything is written
+            //
+            break;
+        }
+
+        BatchLength = ForwardQueueTakeBatch(&SourceDescriptor->Queue,
+                                            SourceDescriptor->Batch,
+                                            EVENT_FORWARDING_BATCH_SIZE,
+                                            Lengths,
+                                            EVENT_FORWARDING_MAXIMUM_BATCH_MESSAGES,
+                                            &MessageCount);
+
+        WakeAllConditionVariable(&SourceDescriptor->QueueNotFull);
+        LeaveCriticalSection(&SourceDescriptor->QueueLock);
+
+        IsWritten = MessageCount == 0 || ForwardingWriteBatch(SourceDescriptor, BatchLength, MessageCount);
+
+        EnterCriticalSection(&SourceDescriptor->QueueLock);
+
+        ForwardQueueCompleteBatch(&SourceDescriptor->Queue, BatchLength, MessageCount, IsWritten);
+    }
+
+    LeaveCriticalSection(&SourceDescriptor->QueueLock);
+
+    return 0;
+}
+
+/**
+ * @brief Create the queue and the worker thread of an output source
+ * @param SourceDescriptor Descriptor of the source
+ *
+ * @return BOOLEAN whether the worker is started or not
+ */
+static BOOLEAN
+ForwardingStartOutputSourceWorker(PDEBUGGER_EVENT_FORWARDING SourceDescriptor)
+{
+    SourceDescriptor->QueueBuffer  = malloc(EVENT_FORWARDING_QUEUE_SIZE);
+    SourceDescriptor->Batch        = (CHAR *)malloc(EVENT_FORWARDING_BATCH_SIZE);
+    SourceDescriptor->BatchLengths = (UINT32 *)malloc(EVENT_FORWARDING_MAXIMUM_BATCH_MESSAGES * sizeof(UINT32));
+
+    if (SourceDescriptor->QueueBuffer == NULL || SourceDescriptor->Batch == NULL || SourceDescriptor->BatchLengths == NULL ||
+        !ForwardQueueInitialize(&SourceDescriptor->Queue,
+                                SourceDescriptor->QueueBuffer,
+                                EVENT_FORWARDING_QUEUE_SIZE,
+                                SourceDescriptor->Policy))
+    {
+        ShowMessages("err, unable to allocate the queue of the output source\n");
+        goto Failed;
+    }
+
+    InitializeCriticalSection(&SourceDescriptor->QueueLock);
+    InitializeConditionVariable(&SourceDescriptor->QueueNotEmpty);
+    InitializeConditionVariable(&SourceDescriptor->QueueNotFull);
+
+    SourceDescriptor->StopWorker   = FALSE;
+    SourceDescriptor->WorkerThread = CreateThread(NULL, 0, ForwardingOutputSourceWorker, SourceDescriptor, 0, NULL);
+
+    if (SourceDescriptor->WorkerThread == NULL)
+    {
+        ShowMessages("err, unable to create the worker thread of the output source (%x)\n", GetLastError());
+
+        DeleteCriticalSection(&SourceDescriptor->QueueLock);
+        goto Failed;
+    }
+
+    return TRUE;
+
+Failed:
+    free(SourceDescriptor->QueueBuffer);
+    free(SourceDescriptor->Batch);
+    free(SourceDescriptor->BatchLengths);
+
+    SourceDescriptor->QueueBuffer  = NULL;
+    SourceDescriptor->Batch        = NULL;
+    SourceDescriptor->BatchLengths = NULL;
+
+    return FALSE;
+}
+
+/**
+ * @brief Stop the worker thread of an output source
+ * @param SourceDescriptor Descriptor of the source
+ *
+ * @details the queued messages are written before the worker stops, the
+ * lock is not deleted as the source is still in the list of the sources
+ * (the messages that are forwarded after closing it are ignored)
+ *
+ * @return VOID
+ */
+static VOID
+ForwardingStopOutputSourceWorker(PDEBUGGER_EVENT_FORWARDING SourceDescriptor)
+{
+    EnterCriticalSection(&SourceDescriptor->QueueLock);
+
+    SourceDescriptor->StopWorker = TRUE;
+
+    WakeAllConditionVariable(&SourceDescriptor->QueueNotEmpty);
+    WakeAllConditionVariable(&SourceDescriptor->QueueNotFull);
+    LeaveCriticalSection(&SourceDescriptor->QueueLock);
+
+    WaitForSingleObject(SourceDescriptor->WorkerThread, INFINITE);
+    CloseHandle(SourceDescriptor->WorkerThread);
+
+    free(SourceDescriptor->QueueBuffer);
+    free(SourceDescriptor->Batch);
+    free(SourceDescriptor->BatchLengths);
+
+    SourceDescriptor->WorkerThread = NULL;
+    SourceDescriptor->QueueBuffer  = NULL;
+    SourceDescriptor->Batch        = NULL;
+    SourceDescriptor->BatchLengths = NULL;
+}
+
+/**
+ * @brief Add a message to the queue of an output source
+ * @param SourceDescriptor Descriptor of the source
+ * @param Message The message
+ * @param MessageLength Length of the message
+ *
+ * @details if the queue is full, based on the policy of the source, either
+ * the message is dropped (and counted) or the caller waits for the worker
+ *
+ * @return BOOLEAN FALSE if the source is closed
+ */
+static BOOLEAN
+ForwardingQueueMessage(PDEBUGGER_EVENT_FORWARDING SourceDescriptor,
+                       CHAR *                     Message,
+                       UINT32                     MessageLength)
+{
+    FORWARD_QUEUE_STATUS Status   = FORWARD_QUEUE_STATUS_FULL;
+    BOOLEAN              WasEmpty = FALSE;
+
+    EnterCriticalSection(&SourceDescriptor->QueueLock);
+
+    while (!SourceDescriptor->StopWorker)
+    {
+        WasEmpty = ForwardQueueIsEmpty(&SourceDescriptor->Queue);
+        Status   = ForwardQueuePush(&SourceDescriptor->Queue, Message, MessageLength);
+
+        if (Status != FORWARD_QUEUE_STATUS_FULL)
+        {
+            break;
+        }
+
+        SleepConditionVariableCS(&SourceDescriptor->QueueNotFull, &SourceDescriptor->QueueLock, INFINITE);
+    }
+
+    //
+    // The worker only waits once the queue is empty
+    //
+    if (Status == FORWARD_QUEUE_STATUS_QUEUED && WasEmpty)
+    {
+        WakeConditionVariable(&SourceDescriptor->QueueNotEmpty);
+    }
+
+    LeaveCriticalSection(&SourceDescriptor->QueueLock);
+
+    return Status != FORWARD_QUEUE_STATUS_FULL;
+}
+
+/**
+ * @brief Get the counters of the messages of an output source
+ * @param SourceDescriptor Descriptor of the source
+ * @param Statistics The counters
+ *
+ * @return VOID
+ */
+VOID
+ForwardingGetOutputSourceStatistics(PDEBUGGER_EVENT_FORWARDING SourceDescriptor,
+                                    PFORWARD_QUEUE_STATISTICS  Statistics)
+{
+    if (SourceDescriptor->State == EVENT_FORWARDING_STATE_NOT_OPENED)
+    {
+        RtlZeroMemory(Statistics, sizeof(FORWARD_QUEUE_STATISTICS));
+        return;
+    }
+
+    EnterCriticalSection(&SourceDescriptor->QueueLock);
+
+    *Statistics = SourceDescriptor->Queue.Statistics;
+
+    LeaveCriticalSection(&SourceDescriptor->QueueLock);
+}
+
 /**
  * @brief Opens the output source
  * @param SourceDescriptor Descriptor of the source
@@ -55,6 +340,14 @@ ForwardingOpenOutputSource(PDEBUGGER_EVENT_FORWARDING SourceDescriptor)
         return DEBUGGER_OUTPUT_SOURCE_STATUS_ALREADY_OPENED;
     }
 
+    //
+    // Start the worker that writes the messages to the source
+    //
+    if (!ForwardingStartOutputSourceWorker(SourceDescriptor))
+    {
+        return DEBUGGER_OUTPUT_SOURCE_STATUS_UNKNOWN_ERROR;
+    }
+
     //
     // Set the status to opened
     //
@@ -134,6 +427,11 @@ ForwardingCloseOutputSource(PDEBUGGER_EVENT_FORWARDING SourceDescriptor)
     //
     SourceDescriptor->State = EVENT_FORWARDING_CLOSED;
 
+    //
+    // Write the remaining messages and stop the worker before closing
+    //
+    ForwardingStopOutputSourceWorker(SourceDescriptor);
+
     //
     // Now, it's time to close the source based on its type
     //
@@ -329,23 +627,25 @@ ForwardingCreateOutputSource(DEBUGGER_EVENT_FORWARDING_TYPE SourceType,
 }
 
 /**
- * @brief Send the event result to the corresponding sources
+ * @brief Find the output sources of an event and add them to the index
  * @param EventDetail Description saved about the event in the
  * user-mode
- * @param MessageLength Length of the message
- * @details This function will not check whether the event has an
- * output source or not, the caller if this function should make
- * sure that the following event has valid output sources or not
+ * @details The messages of the events are forwarded from another thread,
+ * so the output sources of each event are found once (by their tags) and
+ * the messages only look up the tag of the event
  *
- * @return BOOLEAN whether sending results was successful or not
+ * @return VOID
  */
-BOOLEAN
-ForwardingPerformEventForwarding(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail,
-                                 CHAR *                         Message,
-                                 UINT32                         MessageLength)
+VOID
+ForwardingAddEventOutputSources(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail)
 {
-    BOOLEAN     Result   = FALSE;
-    PLIST_ENTRY TempList = 0;
+    PLIST_ENTRY                        TempList = 0;
+    vector<PDEBUGGER_EVENT_FORWARDING> OutputSources;
+
+    if (!EventDetail->HasCustomOutput)
+    {
+        return;
+    }
 
     for (size_t i = 0; i < DebuggerOutputSourceMaximumRemoteSourceForSingleEvent; i++)
     {
@@ -354,7 +654,7 @@ ForwardingPerformEventForwarding(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail,
         //
         if (EventDetail->OutputSourceTags[i] == NULL)
         {
-            return Result;
+            break;
         }
 
         //
@@ -376,43 +676,7 @@ ForwardingPerformEventForwarding(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail,
             if (EventDetail->OutputSourceTags[i] ==
                 CurrentOutputSourceDetails->OutputUniqueTag)
             {
-                //
-                // Indicate that we found a tag that matches this item
-                // Now, we should check whether the output is opened or
-                // not closed
-                //
-                if (CurrentOutputSourceDetails->State ==
-                    EVENT_FORWARDING_STATE_OPENED)
-                {
-                    switch (CurrentOutputSourceDetails->Type)
-                    {
-                    case EVENT_FORWARDING_NAMEDPIPE:
-                        Result = ForwardingSendToNamedPipe(
-                            CurrentOutputSourceDetails->Handle,
-                            Message,
-                            MessageLength);
-                        break;
-                    case EVENT_FORWARDING_FILE:
-                        Result = ForwardingWriteToFile(CurrentOutputSourceDetails->Handle,
-                                                       Message,
-                                                       MessageLength);
-                        break;
-                    case EVENT_FORWARDING_TCP:
-                        Result = ForwardingSendToTcpSocket(
-                            CurrentOutputSourceDetails->Socket,
-                            Message,
-                            MessageLength);
-                        break;
-                    case EVENT_FORWARDING_MODULE:
-                        ((hyperdbg_event_forwarding_t)CurrentOutputSourceDetails->Handle)(
-                            Message,
-                            MessageLength);
-                        Result = TRUE;
-                        break;
-                    default:
-                        break;
-                    }
-                }
+                OutputSources.push_back(CurrentOutputSourceDetails);
 
                 //
                 // No need to search through the list anymore
@@ -422,67 +686,347 @@ ForwardingPerformEventForwarding(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail,
         }
     }
 
-    return FALSE;
+    //
+    // The event is added even if it has no source, so its messages are
+    // still not shown
+    //
+    AcquireSRWLockExclusive(&g_OutputSourcesOfEventsLock);
+
+    g_OutputSourcesOfEvents[(UINT32)EventDetail->Tag] = OutputSources;
+
+    ReleaseSRWLockExclusive(&g_OutputSourcesOfEventsLock);
+}
+
+/**
+ * @brief Remove the output sources of an event from the index
+ * @param Tag The tag of the event (or DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+ *
+ * @return VOID
+ */
+VOID
+ForwardingRemoveEventOutputSources(UINT64 Tag)
+{
+    AcquireSRWLockExclusive(&g_OutputSourcesOfEventsLock);
+
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+    {
+        g_OutputSourcesOfEvents.clear();
+    }
+    else
+    {
+        g_OutputSourcesOfEvents.erase((UINT32)Tag);
+    }
+
+    ReleaseSRWLockExclusive(&g_OutputSourcesOfEventsLock);
+}
+
+/**
+ * @brief Keep a copy of the script of an event that sends the binary records
+ * @param Tag The tag of the event
+ * @param Script The script buffer
+ * @param ScriptSize Size of the script buffer
+ * @details The records only have the offsets of their formats in the
+ * script, so they're formatted from this copy
+ *
+ * @return VOID
+ */
+VOID
+ForwardingAddEventScript(UINT64 Tag, const CHAR * Script, UINT32 ScriptSize)
+{
+    AcquireSRWLockExclusive(&g_ScriptsOfEventsLock);
+
+    DEBUGGER_EVENT_SCRIPT & EventScript = g_ScriptsOfEvents[Tag];
+
+    EventScript.Buffer.assign(Script, Script + ScriptSize);
+    EventScript.ForwardedFormats.clear();
+
+    ReleaseSRWLockExclusive(&g_ScriptsOfEventsLock);
+}
+
+/**
+ * @brief Remove the copy of the script of an event
+ * @param Tag The tag of the event (or DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+ *
+ * @return VOID
+ */
+VOID
+ForwardingRemoveEventScript(UINT64 Tag)
+{
+    AcquireSRWLockExclusive(&g_ScriptsOfEventsLock);
+
+    if (Tag == DEBUGGER_MODIFY_EVENTS_APPLY_TO_ALL_TAG)
+    {
+        g_ScriptsOfEvents.clear();
+    }
+    else
+    {
+        g_ScriptsOfEvents.erase(Tag);
+    }
+
+    ReleaseSRWLockExclusive(&g_ScriptsOfEventsLock);
+}
+
+/**
+ * @brief Get a format from the copy of the script of an event
+ * @param EventScript The copy of the script
+ * @param FormatOffset Offset of the format in the script
+ * @details The caller should hold g_ScriptsOfEventsLock
+ *
+ * @return const CHAR * the format or NULL if the offset is not valid
+ */
+static const CHAR *
+ForwardingGetEventRecordFormat(const DEBUGGER_EVENT_SCRIPT & EventScript, UINT32 FormatOffset)
+{
+    const CHAR * Format;
+
+    if (FormatOffset >= EventScript.Buffer.size())
+    {
+        return NULL;
+    }
+
+    //
+    // The format should be null-terminated in the script
+    //
+    Format = &EventScript.Buffer[FormatOffset];
+
+    if (memchr(Format, 0, EventScript.Buffer.size() - FormatOffset) == NULL)
+    {
+        return NULL;
+    }
+
+    return Format;
+}
+
+/**
+ * @brief Show the messages of the events
+ * @param Buffer The messages
+ * @param Length Length of the messages
+ * @details The buffers of the non-immediate messages are a mix of the
+ * (null-terminated) texts and the records, the records are formatted
+ * from the copies of the scripts
+ *
+ * @return VOID
+ */
+VOID
+ForwardingShowEventMessages(const CHAR * Buffer, UINT32 Length)
+{
+    EVENT_RECORD                                                Record;
+    UINT32                                                      Offset = 0;
+    UINT32                                                      Size;
+    const CHAR *                                                Format;
+    std::unordered_map<UINT64, DEBUGGER_EVENT_SCRIPT>::iterator EventScript;
+    CHAR                                                        Text[PacketChunkSize];
+
+    while (Offset < Length)
+    {
+        switch (EventRecordGetType(&Buffer[Offset], Length - Offset, &Size))
+        {
+        case EVENT_RECORD_TYPE_TEXT:
+
+            Size = (UINT32)strnlen(&Buffer[Offset], Length - Offset);
+
+            if (Size != 0)
+            {
+                ShowMessages("%.*s", (int)Size, &Buffer[Offset]);
+            }
+
+            //
+            // Skip the text and its null
+            //
+            Offset += Size + 1;
+
+            break;
+
+        case EVENT_RECORD_TYPE_VALUES:
+
+            memcpy(&Record, &Buffer[Offset], Size);
+
+            AcquireSRWLockShared(&g_ScriptsOfEventsLock);
+
+            EventScript = g_ScriptsOfEvents.find(Record.Tag);
+
+            Format = EventScript != g_ScriptsOfEvents.end() ? ForwardingGetEventRecordFormat(EventScript->second, Record.FormatOffset) : NULL;
+
+            if (Format != NULL)
+            {
+                EventRecordFormat(Format, Record.Values, Record.ValueCount, Text, sizeof(Text));
+            }
+            else
+            {
+                sprintf_s(Text, sizeof(Text), "(a record of the event 0x%llx without its format)\n", Record.Tag);
+            }
+
+            ReleaseSRWLockShared(&g_ScriptsOfEventsLock);
+
+            ShowMessages("%s", Text);
+
+            Offset += Size;
+
+            break;
+
+        case EVENT_RECORD_TYPE_FORMAT:
+
+            //
+            // The formats are not shown
+            //
+            Offset += Size;
+
+            break;
+
+        default:
+
+            ShowMessages("err, a record of an event is corrupted\n");
+
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Send the event result to the corresponding sources
+ * @param OutputSources The output sources of the event
+ * @param Message The message
+ * @param MessageLength Length of the message
+ * @details The message is only queued for each opened source, the
+ * workers of the sources write it
+ *
+ * @return BOOLEAN whether queueing the results was successful or not
+ */
+BOOLEAN
+ForwardingPerformEventForwarding(const vector<PDEBUGGER_EVENT_FORWARDING> & OutputSources,
+                                 CHAR *                                     Message,
+                                 UINT32                                     MessageLength)
+{
+    BOOLEAN Result = TRUE;
+
+    for (auto CurrentOutputSourceDetails : OutputSources)
+    {
+        //
+        // Check whether the output is opened or not closed
+        //
+        if (CurrentOutputSourceDetails->State == EVENT_FORWARDING_STATE_OPENED &&
+            !ForwardingQueueMessage(CurrentOutputSourceDetails, Message, MessageLength))
+        {
+            Result = FALSE;
+        }
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Write the format of a record to the output sources (once)
+ * @param OutputSources The output sources of the event
+ * @param Message The message
+ * @param MessageLength Length of the message
+ * @details The records are written raw, so the format of each record
+ * is written before the first record that uses it
+ *
+ * @return VOID
+ */
+static VOID
+ForwardingPerformEventRecordFormatForwarding(const vector<PDEBUGGER_EVENT_FORWARDING> & OutputSources,
+                                             const CHAR *                               Message,
+                                             UINT32                                     MessageLength)
+{
+    EVENT_RECORD Record;
+    UINT32       Size;
+    const CHAR * Format;
+    vector<CHAR> FormatRecord;
+
+    if (EventRecordGetType(Message, MessageLength, &Size) != EVENT_RECORD_TYPE_VALUES)
+    {
+        return;
+    }
+
+    memcpy(&Record, Message, EVENT_RECORD_HEADER_SIZE);
+
+    AcquireSRWLockExclusive(&g_ScriptsOfEventsLock);
+
+    auto EventScript = g_ScriptsOfEvents.find(Record.Tag);
+
+    if (EventScript != g_ScriptsOfEvents.end() &&
+        EventScript->second.ForwardedFormats.insert(Record.FormatOffset).second)
+    {
+        Format = ForwardingGetEventRecordFormat(EventScript->second, Record.FormatOffset);
+
+        if (Format != NULL)
+        {
+            FormatRecord.resize(EVENT_RECORD_FORMAT_HEADER_SIZE + strlen(Format) + 8);
+
+            FormatRecord.resize(EventRecordBuildFormat(FormatRecord.data(),
+                                                       (UINT32)FormatRecord.size(),
+                                                       Record.Tag,
+                                                       Record.FormatOffset,
+                                                       Format));
+        }
+    }
+
+    ReleaseSRWLockExclusive(&g_ScriptsOfEventsLock);
+
+    //
+    // Queued without holding the lock as the queues might block
+    //
+    if (!FormatRecord.empty())
+    {
+        ForwardingPerformEventForwarding(OutputSources, FormatRecord.data(), (UINT32)FormatRecord.size());
+    }
 }
 
 /**
  * @brief Check and send the event result to the corresponding sources
  * @param OperationCode The target operation code or tag
+ * @param Message The message
  * @param MessageLength Length of the message
  * @details This function will not check whether the event has an
  * output source or not, the caller if this function should make
  * sure that the following event has valid output sources or not
  *
- * @return BOOLEAN whether sending results was successful or not
+ * @return BOOLEAN whether the event has custom outputs or not
  */
 BOOLEAN
 ForwardingCheckAndPerformEventForwarding(UINT32 OperationCode,
                                          CHAR * Message,
                                          UINT32 MessageLength)
 {
-    PLIST_ENTRY TempList;
-    BOOLEAN     OutputSourceFound = FALSE;
+    BOOLEAN OutputSourceFound = FALSE;
 
     //
     // We should check whether the following flag matches
     // with an output or not, also this is not where we want to
     // check output resources
     //
-    TempList = &g_EventTrace;
-    while (&g_EventTrace != TempList->Blink)
-    {
-        TempList = TempList->Blink;
+    AcquireSRWLockShared(&g_OutputSourcesOfEventsLock);
 
-        PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail = CONTAINING_RECORD(
-            TempList,
-            DEBUGGER_GENERAL_EVENT_DETAIL,
-            CommandsEventList);
+    auto OutputSources = g_OutputSourcesOfEvents.find(OperationCode);
 
-        if (EventDetail->HasCustomOutput && (UINT32)EventDetail->Tag == OperationCode)
-        {
-            //
-            // Output source found
-            //
-            OutputSourceFound = TRUE;
+    if (OutputSources != g_OutputSourcesOfEvents.end())
+    {
+        //
+        // Output source found
+        //
+        OutputSourceFound = TRUE;
 
-            //
-            // Send the event to output sources
-            // Minus one (-1) is because we want to
-            // remove the null character at end of the message
-            //
-            if (!ForwardingPerformEventForwarding(
-                    EventDetail,
-                    Message,
-                    MessageLength))
-            {
-                ShowMessages("err, there was an error transferring the "
-                             "message to the remote sources\n");
-            }
+        //
+        // The records need their formats in the output sources
+        //
+        ForwardingPerformEventRecordFormatForwarding(OutputSources->second, Message, MessageLength);
 
-            break;
+        //
+        // Send the event to output sources
+        //
+        if (!ForwardingPerformEventForwarding(
+                OutputSources->second,
+                Message,
+                MessageLength))
+        {
+            ShowMessages("err, there was an error transferring the "
+                         "message to the remote sources\n");
         }
     }
 
+    ReleaseSRWLockShared(&g_OutputSourcesOfEventsLock);
+
     return OutputSourceFound;
 }
 
@@ -876,6 +876,11 @@ InterpretScript(vector<CommandToken> * CommandTokens,
         *ScriptSyntaxErrors = FALSE;
     }
 
+    //
+    // Optimize the script before it's sent to the debuggee
+    //
+    ScriptEngineWrapperOptimizeSymbolBuffer(CodeBuffer);
+
     //
     // Print symbols (test)
     //
@@ -1548,6 +1553,17 @@ RegisterActionToEvent(PDEBUGGER_GENERAL_EVENT_DETAIL Event,
         }
     }
 
+    //
+    // The records of the script are formatted based on its copy (as the
+    // buffer of the action is freed)
+    //
+    if (ActionScript != NULL && ActionScript->SendRecords)
+    {
+        ForwardingAddEventScript(Event->Tag,
+                                 (CHAR *)ActionScript + sizeof(DEBUGGER_GENERAL_ACTION),
+                                 ActionScript->ScriptBufferSize);
+    }
+
     //
     // As we're not needing any of action buffer, we'll free all of the
     // here in the case of a successful registration of action, however
@@ -1562,6 +1578,11 @@ RegisterActionToEvent(PDEBUGGER_GENERAL_EVENT_DETAIL Event,
     //
     InsertHeadList(&g_EventTrace, &(Event->CommandsEventList));
 
+    //
+    // Index the output sources of the event (if any) for forwarding its messages
+    //
+    ForwardingAddEventOutputSources(Event);
+
     return TRUE;
 }
 
@@ -1675,9 +1696,11 @@ InterpretGeneralEventAndActionsFields(
     BOOLEAN                               IsNextCommandCoreId              = FALSE;
     BOOLEAN                               IsNextCommandBufferSize          = FALSE;
     BOOLEAN                               IsNextCommandImmediateMessaging  = FALSE;
+    BOOLEAN                               IsNextCommandSendRecords         = FALSE;
     BOOLEAN                               IsNextCommandExecutionStage      = FALSE;
     BOOLEAN                               IsNextCommandSc                  = FALSE;
     BOOLEAN                               ImmediateMessagePassing          = UseImmediateMessagingByDefaultOnEvents;
+    BOOLEAN                               SendRecords                      = FALSE;
     UINT32                                CoreId;
     UINT32                                ProcessId;
     UINT32                                IndexOfValidSourceTags;
@@ -2277,6 +2300,37 @@ InterpretGeneralEventAndActionsFields(
             continue;
         }
 
+        if (IsNextCommandSendRecords)
+        {
+            if (CompareLowerCaseStrings(Section, "yes"))
+            {
+                SendRecords = TRUE;
+            }
+            else if (CompareLowerCaseStrings(Section, "no"))
+            {
+                SendRecords = FALSE;
+            }
+            else
+            {
+                //
+                // err, not token recognized error
+                //
+
+                ShowMessages("err, sending records token is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                goto ReturnWithError;
+            }
+
+            IsNextCommandSendRecords = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
         if (IsNextCommandExecutionStage)
         {
             if (CompareLowerCaseStrings(Section, "pre"))
@@ -2437,6 +2491,21 @@ InterpretGeneralEventAndActionsFields(
             continue;
         }
 
+        if (CompareLowerCaseStrings(Section, "rec"))
+        {
+            //
+            // the next command is the indicator of sending the binary records
+            //
+            IsNextCommandSendRecords = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
         if (CompareLowerCaseStrings(Section, "stage"))
         {
             //
@@ -2519,6 +2588,27 @@ InterpretGeneralEventAndActionsFields(
         goto ReturnWithError;
     }
 
+    if (IsNextCommandSendRecords)
+    {
+        ShowMessages("err, please specify a value for 'rec'\n");
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
+    //
+    // Only the printf of the scripts sends the binary records
+    //
+    if (SendRecords && TempActionScript == NULL)
+    {
+        ShowMessages("err, sending the records ('rec') is only supported for the scripts\n");
+
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+
+        goto ReturnWithError;
+    }
+
     if (IsNextCommandExecutionStage)
     {
         ShowMessages("err, please specify a value for 'stage'\n");
@@ -2595,6 +2685,7 @@ InterpretGeneralEventAndActionsFields(
     if (TempActionScript != NULL)
     {
         TempActionScript->ImmediateMessagePassing = ImmediateMessagePassing;
+        TempActionScript->SendRecords             = SendRecords;
     }
     if (TempActionCustomCode != NULL)
     {
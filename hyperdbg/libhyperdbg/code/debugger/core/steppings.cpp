@@ -71,6 +71,31 @@ SteppingInstrumentationStepInForTracking()
     return KdSendStepPacketToDebuggee(RequestFormat);
 }
 
+/**
+ * @brief Perform Instrumentation Step-in for Tracking in batches
+ * @details The debuggee steps the instructions by itself and only sends the
+ * records of the 'call' and the 'ret' instructions
+ *
+ * @param StepCount Number of the instructions to step (up to
+ * DEBUGGER_REMOTE_TRACKING_MAXIMUM_COUNT_OF_STEPPING_IN_BATCH)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SteppingInstrumentationStepInForBatchedTracking(UINT32 StepCount)
+{
+    //
+    // Check if we're in VMI mode
+    //
+    if (g_ActiveProcessDebuggingState.IsActive)
+    {
+        ShowMessages("the instrumentation step-in is only supported in Debugger Mode\n");
+        return FALSE;
+    }
+
+    return KdSendBatchedTrackingPacketToDebuggee(StepCount);
+}
+
 /**
  * @brief Perform Regular Step-in
  *
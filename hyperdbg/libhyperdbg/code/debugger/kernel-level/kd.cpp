@@ -27,6 +27,7 @@ extern BOOLEAN                          g_IsConnectedToHyperDbgLocally;
 extern OVERLAPPED                       g_OverlappedIoStructureForReadDebugger;
 extern OVERLAPPED                       g_OverlappedIoStructureForWriteDebugger;
 extern OVERLAPPED                       g_OverlappedIoStructureForReadDebuggee;
+extern PAGE_CACHE                       g_KdMemoryCache;
 extern DEBUGGER_EVENT_AND_ACTION_RESULT g_DebuggeeResultOfRegisteringEvent;
 extern DEBUGGER_EVENT_AND_ACTION_RESULT
                g_DebuggeeResultOfAddingActionsToEvent;
@@ -42,9 +43,17 @@ extern BOOLEAN g_IsRunningInstruction32Bit;
 extern BOOLEAN g_IgnorePauseRequests;
 extern BOOLEAN g_IsDebuggeeInHandshakingPhase;
 extern BOOLEAN g_ShouldPreviousCommandBeContinued;
-extern BYTE    g_EndOfBufferCheckSerial[4];
 extern ULONG   g_CurrentRemoteCore;
 
+#if UseSerialFraming == TRUE
+extern SERIAL_FRAME_RECEIVER g_SerialFrameReceiver;
+extern BYTE                  g_SerialFrameReceiverRing[SERIAL_FRAME_RECEIVER_RING_SIZE];
+#else
+extern BYTE g_EndOfBufferCheckSerial[4];
+#endif // UseSerialFraming == TRUE
+
+#if UseSerialFraming == FALSE
+
 /**
  * @brief compares the buffer with a string
  *
@@ -90,6 +99,8 @@ KdCheckForTheEndOfTheBuffer(PUINT32 CurrentLoopIndex, BYTE * Buffer)
     return FALSE;
 }
 
+#endif // UseSerialFraming == FALSE
+
 /**
  * @brief compares the buffer with a string
  *
@@ -159,6 +170,11 @@ KdSendContinuePacketToDebuggee()
     //
     g_CurrentRemoteCore = DEBUGGER_DEBUGGEE_IS_RUNNING_NO_CORE;
 
+    //
+    // The memory of the debuggee is changed after it continues
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send 'g' as continue packet
     //
@@ -196,6 +212,11 @@ KdSendSwitchCorePacketToDebuggee(UINT32 NewCore)
         return FALSE;
     }
 
+    //
+    // The current process (and its memory) might be different on another core
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send '~' as switch packet
     //
@@ -350,9 +371,8 @@ KdSendCallStackPacketToDebuggee(UINT64                            BaseAddress,
                                 DEBUGGER_CALLSTACK_DISPLAY_METHOD DisplayMethod,
                                 BOOLEAN                           Is32Bit)
 {
-    UINT32                      FrameCount;
-    UINT32                      CallstackRequestSize = 0;
-    PDEBUGGER_CALLSTACK_REQUEST CallstackPacket      = NULL;
+    UINT32                     FrameCount;
+    DEBUGGER_CALLSTACK_REQUEST CallstackPacket = {0};
 
     if (Size == 0)
     {
@@ -368,40 +388,26 @@ KdSendCallStackPacketToDebuggee(UINT64                            BaseAddress,
         FrameCount = Size / sizeof(UINT64);
     }
 
-    CallstackRequestSize = sizeof(DEBUGGER_CALLSTACK_REQUEST) + (sizeof(DEBUGGER_SINGLE_CALLSTACK_FRAME) * FrameCount);
-
-    //
-    // Allocate buffer for request
-    //
-    CallstackPacket = (PDEBUGGER_CALLSTACK_REQUEST)malloc(CallstackRequestSize);
-
-    if (CallstackPacket == NULL)
-    {
-        return FALSE;
-    }
-
-    RtlZeroMemory(CallstackPacket, CallstackRequestSize);
-
     //
     // Set the details
     //
-    CallstackPacket->BaseAddress   = BaseAddress;
-    CallstackPacket->Is32Bit       = Is32Bit;
-    CallstackPacket->Size          = Size;
-    CallstackPacket->BufferSize    = CallstackRequestSize;
-    CallstackPacket->FrameCount    = FrameCount;
-    CallstackPacket->DisplayMethod = DisplayMethod;
+    CallstackPacket.BaseAddress   = BaseAddress;
+    CallstackPacket.Is32Bit       = Is32Bit;
+    CallstackPacket.Size          = Size;
+    CallstackPacket.BufferSize    = sizeof(DEBUGGER_CALLSTACK_REQUEST) + (sizeof(DEBUGGER_SINGLE_CALLSTACK_FRAME) * FrameCount);
+    CallstackPacket.FrameCount    = FrameCount;
+    CallstackPacket.DisplayMethod = DisplayMethod;
 
     //
-    // Send 'k' command as callstack request packet
+    // Send 'k' command as callstack request packet, the frames are filled
+    // by the debuggee, so only the request is sent
     //
     if (!KdCommandPacketAndBufferToDebuggee(
             DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
             DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_CALLSTACK,
-            (CHAR *)CallstackPacket,
-            CallstackRequestSize))
+            (CHAR *)&CallstackPacket,
+            sizeof(DEBUGGER_CALLSTACK_REQUEST)))
     {
-        free(CallstackPacket);
         return FALSE;
     }
 
@@ -410,7 +416,6 @@ KdSendCallStackPacketToDebuggee(UINT64                            BaseAddress,
     //
     DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_CALLSTACK_RESULT);
 
-    free(CallstackPacket);
     return TRUE;
 }
 
@@ -622,6 +627,121 @@ KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, UINT32 RequestSi
     return TRUE;
 }
 
+/**
+ * @brief Read the pages of the debuggee for the memory cache
+ * @details The read is done as a whole (all of the pages should be
+ * accessible), the address mode of the pages is returned as their attributes
+ *
+ * @param Context The read memory request that the pages are read for
+ * @param AddressSpace
+ * @param Address
+ * @param PageCount
+ * @param Buffer
+ * @param Attributes
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReadMemoryPagesFromDebuggee(PVOID    Context,
+                              UINT64   AddressSpace,
+                              UINT64   Address,
+                              UINT32   PageCount,
+                              UINT8 *  Buffer,
+                              UINT32 * Attributes)
+{
+    PDEBUGGER_READ_MEMORY ReadMem = (PDEBUGGER_READ_MEMORY)Context;
+    PDEBUGGER_READ_MEMORY MemReadRequest;
+    UINT32                Size               = PageCount * PAGE_CACHE_PAGE_SIZE;
+    UINT32                SizeOfTargetBuffer = sizeof(DEBUGGER_READ_MEMORY) + Size;
+    BOOLEAN               Result             = FALSE;
+
+    UNREFERENCED_PARAMETER(AddressSpace);
+
+    MemReadRequest = (PDEBUGGER_READ_MEMORY)malloc(SizeOfTargetBuffer);
+
+    if (MemReadRequest == NULL)
+    {
+        return FALSE;
+    }
+
+    ZeroMemory(MemReadRequest, SizeOfTargetBuffer);
+
+    MemReadRequest->Address        = Address;
+    MemReadRequest->Pid            = ReadMem->Pid;
+    MemReadRequest->Size           = Size;
+    MemReadRequest->MemoryType     = ReadMem->MemoryType;
+    MemReadRequest->ReadingType    = ReadMem->ReadingType;
+    MemReadRequest->GetAddressMode = ReadMem->MemoryType == DEBUGGER_READ_VIRTUAL_ADDRESS;
+
+    if (KdSendReadMemoryPacketToDebuggee(MemReadRequest, SizeOfTargetBuffer))
+    {
+        //
+        // Keep the error so the caller shows it
+        //
+        ReadMem->KernelStatus = MemReadRequest->KernelStatus;
+
+        if (MemReadRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFUL &&
+            MemReadRequest->ReturnLength == Size)
+        {
+            memcpy(Buffer, ((CHAR *)MemReadRequest) + sizeof(DEBUGGER_READ_MEMORY), Size);
+            *Attributes = MemReadRequest->AddressMode;
+
+            Result = TRUE;
+        }
+    }
+
+    std::free(MemReadRequest);
+
+    return Result;
+}
+
+/**
+ * @brief Read the memory of the debuggee through the memory cache
+ * @details The pages are kept until the debuggee continues (or its memory
+ * is changed). The address spaces are separated by the type of the memory,
+ * the reading type and the process (for virtual addresses). The physical
+ * addresses should not be read through the cache as reading the whole pages
+ * (and prefetching the next pages) might touch MMIO
+ *
+ * @param ReadMem The read memory request, its results (return length,
+ * address mode and kernel status) are set here
+ * @param Buffer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReadMemoryWithCache(PDEBUGGER_READ_MEMORY ReadMem, BYTE * Buffer)
+{
+    UINT64 AddressSpace;
+    UINT32 Attributes = 0;
+
+    AddressSpace = (UINT64)ReadMem->MemoryType | ((UINT64)ReadMem->ReadingType << 1);
+
+    if (ReadMem->MemoryType == DEBUGGER_READ_VIRTUAL_ADDRESS)
+    {
+        AddressSpace |= (UINT64)ReadMem->Pid << 32;
+    }
+
+    ReadMem->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFUL;
+
+    if (!PageCacheRead(&g_KdMemoryCache,
+                       ReadMem,
+                       AddressSpace,
+                       ReadMem->Address,
+                       Buffer,
+                       ReadMem->Size,
+                       &Attributes))
+    {
+        ReadMem->ReturnLength = 0;
+        return FALSE;
+    }
+
+    ReadMem->ReturnLength = ReadMem->Size;
+    ReadMem->AddressMode  = (DEBUGGER_READ_MEMORY_ADDRESS_MODE)Attributes;
+
+    return TRUE;
+}
+
 /**
  * @brief Send an Edit memory packet to the debuggee
  * @param EditMem
@@ -637,6 +757,11 @@ KdSendEditMemoryPacketToDebuggee(PDEBUGGER_EDIT_MEMORY EditMem, UINT32 Size)
     //
     DbgWaitSetRequestData(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_EDIT_MEMORY, EditMem, sizeof(DEBUGGER_EDIT_MEMORY));
 
+    //
+    // The cached pages are no longer valid after editing the memory
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send d command as read memory packet
     //
@@ -824,6 +949,11 @@ KdSendSwitchProcessPacketToDebuggee(DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_TYPE Act
         memcpy(&ProcessChangePacket.ProcessListSymDetails, SymDetailsForProcessList, sizeof(DEBUGGEE_PROCESS_LIST_NEEDED_DETAILS));
     }
 
+    //
+    // The cached pages might belong to another process
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send '.process' as switch packet
     //
@@ -877,6 +1007,11 @@ KdSendSwitchThreadPacketToDebuggee(DEBUGGEE_DETAILS_AND_SWITCH_THREAD_TYPE Actio
         memcpy(&ThreadChangePacket.ThreadListSymDetails, SymDetailsForThreadList, sizeof(DEBUGGEE_THREAD_LIST_NEEDED_DETAILS));
     }
 
+    //
+    // The cached pages might belong to another thread (process)
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send '.thread' as switch packet
     //
@@ -935,6 +1070,11 @@ KdSendPtePacketToDebuggee(PDEBUGGER_READ_PAGE_TABLE_ENTRIES_DETAILS PtePacket)
 BOOLEAN
 KdSendPageinPacketToDebuggee(PDEBUGGER_PAGE_IN_REQUEST PageinPacket)
 {
+    //
+    // The page-fault is injected after the debuggee continues
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send the '.pagein' packet
     //
@@ -1063,6 +1203,11 @@ KdSendQueryIdtPacketsToDebuggee(PINTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS IdtR
 BOOLEAN
 KdSendBpPacketToDebuggee(PDEBUGGEE_BP_PACKET BpPacket)
 {
+    //
+    // Setting the breakpoint modifies the memory (and pages it in)
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send 'bp' as a breakpoint packet
     //
@@ -1093,6 +1238,11 @@ BOOLEAN
 KdSendListOrModifyPacketToDebuggee(
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET ListOrModifyPacket)
 {
+    //
+    // Clearing, enabling or disabling the breakpoints modifies the memory
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send list or modify breakpoint packet
     //
@@ -1148,6 +1298,11 @@ KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 P
            (PVOID)BufferAddress,
            BufferLength);
 
+    //
+    // The script might modify the memory
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send script packet
     //
@@ -1211,6 +1366,11 @@ KdSendUserInputPacketToDebuggee(const char * Sendbuf, int Len, BOOLEAN IgnoreBre
            (PVOID)Sendbuf,
            Len);
 
+    //
+    // The command might modify the memory
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Send user-input packet
     //
@@ -1278,6 +1438,11 @@ KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType)
     DEBUGGEE_STEP_PACKET StepPacket = {0};
     UINT32               CallInstructionSize;
 
+    //
+    // The memory of the debuggee is changed after stepping
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
     //
     // Set the type of step packet
     //
@@ -1348,6 +1513,51 @@ KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType)
     return TRUE;
 }
 
+/**
+ * @brief Sends a packet of tracking instructions in batches to the debuggee
+ * @details The debuggee steps the instructions by itself and sends the records
+ * of the 'call' and the 'ret' instructions before pausing
+ *
+ * @param StepCount Number of the instructions to step
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendBatchedTrackingPacketToDebuggee(UINT32 StepCount)
+{
+    DEBUGGEE_STEP_PACKET StepPacket = {0};
+
+    //
+    // The memory of the debuggee is changed after stepping
+    //
+    PageCacheInvalidate(&g_KdMemoryCache);
+
+    //
+    // Set the type of step packet and the number of instructions
+    //
+    StepPacket.StepType      = DEBUGGER_REMOTE_STEPPING_REQUEST_INSTRUMENTATION_STEP_IN_FOR_BATCHED_TRACKING;
+    StepPacket.TrackingCount = StepCount;
+
+    //
+    // Send step packet to the serial
+    //
+    if (!KdCommandPacketAndBufferToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_STEP,
+            (CHAR *)&StepPacket,
+            sizeof(DEBUGGEE_STEP_PACKET)))
+    {
+        return FALSE;
+    }
+
+    //
+    // Wait until the batch is finished (the records are received before it)
+    //
+    DbgWaitForKernelResponse(DEBUGGER_SYNCRONIZATION_OBJECT_KERNEL_DEBUGGER_IS_DEBUGGER_RUNNING);
+
+    return TRUE;
+}
+
 /**
  * @brief Sends a PAUSE packet to the debuggee
  *
@@ -1441,6 +1651,209 @@ KdGetWindowVersion(CHAR * BufferToSave)
     return TRUE;
 }
 
+#if UseSerialFraming == TRUE
+
+/**
+ * @brief Receive packet from the debuggee
+ * @details The bytes are read in bulk into the ring of the frame receiver,
+ * the frames that are received together are kept there for the next calls
+ *
+ * @param BufferToSave
+ * @param LengthReceived
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceivePacketFromDebuggee(CHAR *   BufferToSave,
+                            UINT32 * LengthReceived)
+{
+    BYTE * WriteBuffer;
+    UINT32 WriteBufferLength;
+    DWORD  NoBytesRead = 0; /* Bytes read by ReadFile() */
+
+    //
+    // The corrupted frames (and the bytes between the frames) are skipped
+    // by the receiver
+    //
+    while (!SerialFrameReceiverRead(&g_SerialFrameReceiver, BufferToSave, LengthReceived))
+    {
+        //
+        // It's in the debugger, the ring is never full here as a whole
+        // frame fits in it
+        //
+        WriteBuffer = SerialFrameReceiverGetWriteBuffer(&g_SerialFrameReceiver, &WriteBufferLength);
+
+        //
+        // Try to read all of the available bytes in overlapped I/O (in debugger)
+        //
+        if (!ReadFile(g_SerialRemoteComPortHandle, WriteBuffer, WriteBufferLength, NULL, &g_OverlappedIoStructureForReadDebugger))
+        {
+            DWORD e = GetLastError();
+
+            if (e != ERROR_IO_PENDING)
+            {
+                return FALSE;
+            }
+        }
+
+        //
+        // Wait till the bytes become available
+        //
+        WaitForSingleObject(g_OverlappedIoStructureForReadDebugger.hEvent,
+                            INFINITE);
+
+        //
+        // Get the result
+        //
+        if (!GetOverlappedResult(g_SerialRemoteComPortHandle,
+                                 &g_OverlappedIoStructureForReadDebugger,
+                                 &NoBytesRead,
+                                 FALSE))
+        {
+            ResetEvent(g_OverlappedIoStructureForReadDebugger.hEvent);
+            return FALSE;
+        }
+
+        //
+        // Reset event for next try
+        //
+        ResetEvent(g_OverlappedIoStructureForReadDebugger.hEvent);
+
+        SerialFrameReceiverCommit(&g_SerialFrameReceiver, NoBytesRead);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read an exact number of bytes from the debugger (in debuggee)
+ *
+ * @param Buffer
+ * @param Length
+ * @param TimedOut Whether the read is timed out
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+KdReadFromDebugger(PVOID Buffer, UINT32 Length, BOOLEAN * TimedOut)
+{
+    DWORD NoBytesRead = 0; /* Bytes read by ReadFile() */
+
+    while (Length != 0)
+    {
+        if (!ReadFile(g_SerialRemoteComPortHandle, Buffer, Length, &NoBytesRead, NULL))
+        {
+            return FALSE;
+        }
+
+        if (NoBytesRead == 0)
+        {
+            *TimedOut = TRUE;
+            return FALSE;
+        }
+
+        Buffer = (PVOID)((UINT64)Buffer + NoBytesRead);
+        Length -= NoBytesRead;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Receive packet from the debugger
+ * @details Only the bytes of the frame are read, so the next frames (that
+ * might be received by the kernel) are not consumed here. In the case of
+ * a timeout, a single null character is received
+ *
+ * @param BufferToSave
+ * @param LengthReceived
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceivePacketFromDebugger(CHAR *   BufferToSave,
+                            UINT32 * LengthReceived)
+{
+    SERIAL_FRAME_HEADER Header;
+    BYTE *              HeaderBytes = (BYTE *)&Header;
+    BOOLEAN             TimedOut    = FALSE;
+
+    //
+    // Set the timeout in milliseconds (e.g., 5000 ms = 5 seconds)
+    //
+    DWORD ReadTimeout = 5000;
+
+    //
+    // Set the read timeout using SetCommTimeouts
+    //
+    COMMTIMEOUTS Timeouts;
+    GetCommTimeouts(g_SerialRemoteComPortHandle, &Timeouts);
+    Timeouts.ReadIntervalTimeout         = MAXDWORD;
+    Timeouts.ReadTotalTimeoutConstant    = ReadTimeout;
+    Timeouts.ReadTotalTimeoutMultiplier  = 0;
+    Timeouts.WriteTotalTimeoutConstant   = 0;
+    Timeouts.WriteTotalTimeoutMultiplier = 0;
+    SetCommTimeouts(g_SerialRemoteComPortHandle, &Timeouts);
+
+    while (TRUE)
+    {
+        //
+        // Read the header, slide it byte by byte until it's valid
+        //
+        if (!KdReadFromDebugger(&Header, sizeof(SERIAL_FRAME_HEADER), &TimedOut))
+        {
+            goto Failed;
+        }
+
+        while (!SerialFrameCheckHeader(&Header, MaxSerialPacketSize))
+        {
+            memmove(HeaderBytes, HeaderBytes + 1, sizeof(SERIAL_FRAME_HEADER) - 1);
+
+            if (!KdReadFromDebugger(&HeaderBytes[sizeof(SERIAL_FRAME_HEADER) - 1], sizeof(BYTE), &TimedOut))
+            {
+                goto Failed;
+            }
+        }
+
+        //
+        // Read the payload
+        //
+        if (!KdReadFromDebugger(BufferToSave, Header.Length, &TimedOut))
+        {
+            goto Failed;
+        }
+
+        if (SerialFrameCrc32(0, BufferToSave, Header.Length) != Header.Crc32)
+        {
+            //
+            // The frame is corrupted, wait for the next frame
+            //
+            ShowMessages("err, a corrupted frame received (invalid CRC32)\n");
+            continue;
+        }
+
+        //
+        // Set the length
+        //
+        *LengthReceived = Header.Length;
+
+        return TRUE;
+    }
+
+Failed:
+    if (TimedOut)
+    {
+        BufferToSave[0] = NULL;
+        *LengthReceived = 1;
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+#else
+
 /**
  * @brief Receive packet from the debuggee
  *
@@ -1638,6 +2051,8 @@ KdReceivePacketFromDebugger(CHAR *   BufferToSave,
     return TRUE;
 }
 
+#endif // UseSerialFraming == TRUE
+
 /**
  * @brief Sends a special packet to the debuggee
  *
@@ -1646,7 +2061,7 @@ KdReceivePacketFromDebugger(CHAR *   BufferToSave,
  * @return BOOLEAN
  */
 BOOLEAN
-KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length, BOOLEAN SendEndOfBuffer)
+KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length)
 {
     BOOL  Status;
     DWORD BytesWritten  = 0;
@@ -1657,18 +2072,6 @@ KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length, BOOLEAN SendEndOfBuff
     //
     g_IgnoreNewLoggingMessages = FALSE;
 
-    //
-    // Double check if buffer not pass the boundary
-    //
-    if (Length + SERIAL_END_OF_BUFFER_CHARS_COUNT > MaxSerialPacketSize)
-    {
-        ShowMessages("err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
-                     "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size\n",
-                     Length + SERIAL_END_OF_BUFFER_CHARS_COUNT,
-                     MaxSerialPacketSize);
-        return FALSE;
-    }
-
     //
     // Check if the remote code's handle found or not
     //
@@ -1745,25 +2148,100 @@ KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length, BOOLEAN SendEndOfBuff
     }
 
 Out:
-    if (SendEndOfBuffer)
+    //
+    // All the bytes are sent
+    //
+    return TRUE;
+}
+
+#if UseSerialFraming == TRUE
+
+/**
+ * @brief Sends a frame to the debuggee
+ * @details The header, the packet and the buffer are sent by one write
+ *
+ * @param Packet
+ * @param PacketLength
+ * @param Buffer
+ * @param BufferLength
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendFrameToDebuggee(const CHAR * Packet, UINT32 PacketLength, const CHAR * Buffer, UINT32 BufferLength)
+{
+    SERIAL_FRAME_HEADER Header;
+    CHAR *              Frame;
+    BOOLEAN             Result;
+
+    SerialFrameInitializeHeader(&Header);
+    SerialFrameAppendToHeader(&Header, Packet, PacketLength);
+    SerialFrameAppendToHeader(&Header, Buffer, BufferLength);
+    SerialFrameFinalizeHeader(&Header);
+
+    Frame = (CHAR *)malloc(sizeof(SERIAL_FRAME_HEADER) + Header.Length);
+
+    if (Frame == NULL)
     {
-        //
-        // Send End of Buffer Packet
-        //
-        if (!KdSendPacketToDebuggee((const CHAR *)g_EndOfBufferCheckSerial,
-                                    sizeof(g_EndOfBufferCheckSerial),
-                                    FALSE))
-        {
-            return FALSE;
-        }
+        ShowMessages("err, unable to allocate memory for the frame\n");
+        return FALSE;
+    }
+
+    memcpy(Frame, &Header, sizeof(SERIAL_FRAME_HEADER));
+    memcpy(Frame + sizeof(SERIAL_FRAME_HEADER), Packet, PacketLength);
+    memcpy(Frame + sizeof(SERIAL_FRAME_HEADER) + PacketLength, Buffer, BufferLength);
+
+    Result = KdSendPacketToDebuggee(Frame, sizeof(SERIAL_FRAME_HEADER) + Header.Length);
+
+    free(Frame);
+
+    return Result;
+}
+
+#else
+
+/**
+ * @brief Sends a packet and a buffer to the debuggee, followed by the end
+ * of buffer characters
+ *
+ * @param Packet
+ * @param PacketLength
+ * @param Buffer
+ * @param BufferLength
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendFrameToDebuggee(const CHAR * Packet, UINT32 PacketLength, const CHAR * Buffer, UINT32 BufferLength)
+{
+    //
+    // Double check if buffer not pass the boundary
+    //
+    if (PacketLength + BufferLength + SERIAL_END_OF_BUFFER_CHARS_COUNT > MaxSerialPacketSize)
+    {
+        ShowMessages("err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
+                     "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size\n",
+                     PacketLength + BufferLength + SERIAL_END_OF_BUFFER_CHARS_COUNT,
+                     MaxSerialPacketSize);
+        return FALSE;
+    }
+
+    if (!KdSendPacketToDebuggee(Packet, PacketLength))
+    {
+        return FALSE;
+    }
+
+    if (BufferLength != 0 && !KdSendPacketToDebuggee(Buffer, BufferLength))
+    {
+        return FALSE;
     }
 
     //
-    // All the bytes are sent
+    // Send End of Buffer Packet
     //
-    return TRUE;
+    return KdSendPacketToDebuggee((const CHAR *)g_EndOfBufferCheckSerial, sizeof(g_EndOfBufferCheckSerial));
 }
 
+#endif // UseSerialFraming == TRUE
+
 /**
  * @brief Sends a HyperDbg packet to the debuggee
  *
@@ -1800,9 +2278,10 @@ KdCommandPacketToDebuggee(
         KdComputeDataChecksum((PVOID)((UINT64)&Packet + 1),
                               sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(BYTE));
 
-    if (!KdSendPacketToDebuggee((const CHAR *)&Packet,
-                                sizeof(DEBUGGER_REMOTE_PACKET),
-                                TRUE))
+    if (!KdSendFrameToDebuggee((const CHAR *)&Packet,
+                               sizeof(DEBUGGER_REMOTE_PACKET),
+                               NULL,
+                               0))
     {
         return FALSE;
     }
@@ -1829,12 +2308,11 @@ KdCommandPacketAndBufferToDebuggee(
     //
     // Check if buffer not pass the boundary
     //
-    if (sizeof(DEBUGGER_REMOTE_PACKET) + BufferLength + SERIAL_END_OF_BUFFER_CHARS_COUNT >
-        MaxSerialPacketSize)
+    if (sizeof(DEBUGGER_REMOTE_PACKET) + BufferLength > MaxSerialPacketSize)
     {
         ShowMessages("err, buffer is above the maximum buffer size that can be sent to debuggee (%d > %d), "
                      "for more information, please visit https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/increase-communication-buffer-size",
-                     sizeof(DEBUGGER_REMOTE_PACKET) + BufferLength + SERIAL_END_OF_BUFFER_CHARS_COUNT,
+                     sizeof(DEBUGGER_REMOTE_PACKET) + BufferLength,
                      MaxSerialPacketSize);
 
         return FALSE;
@@ -1861,19 +2339,12 @@ KdCommandPacketAndBufferToDebuggee(
     Packet.Checksum += KdComputeDataChecksum((PVOID)Buffer, BufferLength);
 
     //
-    // Send the first buffer (without ending buffer indication)
-    //
-    if (!KdSendPacketToDebuggee((const CHAR *)&Packet,
-                                sizeof(DEBUGGER_REMOTE_PACKET),
-                                FALSE))
-    {
-        return FALSE;
-    }
-
-    //
-    // Send the second buffer (with ending buffer indication)
+    // Send the packet and the buffer in one frame
     //
-    if (!KdSendPacketToDebuggee((const CHAR *)Buffer, BufferLength, TRUE))
+    if (!KdSendFrameToDebuggee((const CHAR *)&Packet,
+                               sizeof(DEBUGGER_REMOTE_PACKET),
+                               (const CHAR *)Buffer,
+                               BufferLength))
     {
         return FALSE;
     }
@@ -2450,24 +2921,28 @@ KdPrepareAndConnectDebugPort(const CHAR * PortName,
             return FALSE;
         }
 
-        //
-        // Setting Timeouts (not use it anymore as we use special signature for
-        // ending buffer)
-        // (no need anymore as we use end buffer detection mechanism)
-        //
+#if UseSerialFraming == TRUE
 
-        /*
-    Timeouts.ReadIntervalTimeout = 50;
-    Timeouts.ReadTotalTimeoutConstant = 50;
-    Timeouts.ReadTotalTimeoutMultiplier = 10;
-    Timeouts.WriteTotalTimeoutConstant = 50;
-    Timeouts.WriteTotalTimeoutMultiplier = 10;
+        if (!IsPreparing)
+        {
+            //
+            // Setting Timeouts for the debugger, the reads return as soon as
+            // any byte is available (so the frames are read in bulk), the
+            // debuggee sets its timeouts before reading the frames
+            //
+            Timeouts.ReadIntervalTimeout        = MAXDWORD;
+            Timeouts.ReadTotalTimeoutMultiplier = MAXDWORD;
+            Timeouts.ReadTotalTimeoutConstant   = MAXDWORD - 1;
 
-    if (SetCommTimeouts(Comm, &Timeouts) == FALSE) {
-      ShowMessages("err, to Setting Time outs (%x).\n", GetLastError());
-      return FALSE;
-    }
-    */
+            if (SetCommTimeouts(Comm, &Timeouts) == FALSE)
+            {
+                CloseHandle(Comm);
+                ShowMessages("err, to Setting Time outs (%x).\n", GetLastError());
+                return FALSE;
+            }
+        }
+
+#endif // UseSerialFraming == TRUE
     }
     else
     {
@@ -2736,6 +3211,23 @@ KdPrepareAndConnectDebugPort(const CHAR * PortName,
         //
         g_SerialRemoteComPortHandle = Comm;
 
+#if UseSerialFraming == TRUE
+
+        //
+        // Nothing is received from the debuggee yet
+        //
+        SerialFrameReceiverInitialize(&g_SerialFrameReceiver,
+                                      g_SerialFrameReceiverRing,
+                                      SERIAL_FRAME_RECEIVER_RING_SIZE,
+                                      MaxSerialPacketSize);
+
+#endif // UseSerialFraming == TRUE
+
+        //
+        // Nothing is cached from the memory of the debuggee yet
+        //
+        PageCacheInitialize(&g_KdMemoryCache, KdReadMemoryPagesFromDebuggee, KD_MEMORY_CACHE_PREFETCH_PAGES);
+
         //
         // If we are here, then it's a debugger (not debuggee)
         // let's prepare the debuggee
@@ -33,6 +33,7 @@ extern DEBUGGER_EVENT_AND_ACTION_RESULT g_DebuggeeResultOfAddingActionsToEvent;
 extern UINT64                           g_ResultOfEvaluatedExpression;
 extern UINT32                           g_ErrorStateOfResultOfEvaluatedExpression;
 extern UINT64                           g_KernelBaseAddress;
+extern PAGE_CACHE                       g_KdMemoryCache;
 
 /**
  * @brief Check if the remote debuggee needs to pause the system
@@ -78,11 +79,14 @@ ListeningSerialPortInDebugger()
     PDEBUGGEE_PCITREE_REQUEST_RESPONSE_PACKET    PcitreePacket;
     PINTERRUPT_DESCRIPTOR_TABLE_ENTRIES_PACKETS  IdtEntryRequestPacket;
     PDEBUGGEE_PCIDEVINFO_REQUEST_RESPONSE_PACKET PcidevinfoPacket;
+    PTRACK_TRACE_BUFFER                          TrackingRecordsPacket;
 
 StartAgain:
 
     CHAR   BufferToReceive[MaxSerialPacketSize] = {0};
     UINT32 LengthReceived                       = 0;
+    UINT32 MessageLength                        = 0;
+    UINT32 RecordSize                           = 0;
 
     //
     // Wait for handshake to complete or in other words
@@ -197,12 +201,24 @@ StartAgain:
 
             MessagePacket = (DEBUGGEE_MESSAGE_PACKET *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
 
+            //
+            // The message might be a binary record of an event, so its length
+            // is computed from the received packet (the texts are still
+            // forwarded without their nulls)
+            //
+            MessageLength = LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(UINT32);
+
+            if (EventRecordGetType(MessagePacket->Message, MessageLength, &RecordSize) == EVENT_RECORD_TYPE_TEXT)
+            {
+                MessageLength = (UINT32)strnlen(MessagePacket->Message, MessageLength);
+            }
+
             //
             // Check if there are available output sources
             //
             if (!g_OutputSourcesInitialized || !ForwardingCheckAndPerformEventForwarding(MessagePacket->OperationCode,
                                                                                          MessagePacket->Message,
-                                                                                         (UINT32)strlen(MessagePacket->Message)))
+                                                                                         MessageLength))
             {
                 //
                 // We check g_IgnoreNewLoggingMessages here because we want to
@@ -210,7 +226,7 @@ StartAgain:
                 //
                 if (!g_IgnoreNewLoggingMessages)
                 {
-                    ShowMessages("%s", MessagePacket->Message);
+                    ForwardingShowEventMessages(MessagePacket->Message, MessageLength);
                 }
             }
 
@@ -230,6 +246,11 @@ StartAgain:
             //
             g_IsDebuggeeRunning = FALSE;
 
+            //
+            // Nothing from the memory of the debuggee is cached when it's paused
+            //
+            PageCacheInvalidate(&g_KdMemoryCache);
+
             //
             // Set the current core
             //
@@ -358,6 +379,7 @@ StartAgain:
             case DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED:
             case DEBUGGEE_PAUSING_REASON_DEBUGGEE_PROCESS_SWITCHED:
             case DEBUGGEE_PAUSING_REASON_DEBUGGEE_THREAD_SWITCHED:
+            case DEBUGGEE_PAUSING_REASON_DEBUGGEE_TRACKING_BATCH_FINISHED:
 
                 //
                 // Unpause the debugger to get commands
@@ -589,7 +611,8 @@ StartAgain:
                 CallstackShowFrames(CallstackFramePacket,
                                     CallstackPacket->FrameCount,
                                     CallstackPacket->DisplayMethod,
-                                    CallstackPacket->Is32Bit);
+                                    CallstackPacket->Is32Bit,
+                                    CallstackPacket->IsUnwound);
             }
             else
             {
@@ -877,6 +900,19 @@ StartAgain:
 
             break;
 
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_TRACKING_RECORDS:
+
+            TrackingRecordsPacket = (TRACK_TRACE_BUFFER *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
+
+            //
+            // Show the 'call' and the 'ret' instructions that are tracked by the
+            // debuggee (the batch is not finished yet, so nothing is signaled)
+            //
+            CommandTrackHandleReceivedRecords(TrackingRecordsPacket,
+                                              LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET));
+
+            break;
+
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_MEMORY:
 
             ReadMemoryPacket = (DEBUGGER_READ_MEMORY *)(((CHAR *)TheActualPacket) + sizeof(DEBUGGER_REMOTE_PACKET));
@@ -1080,20 +1116,11 @@ StartAgain:
                 ShowMessages("%-12s | %-9s | %-17s | %s \n%s\n", "DBDF", "VID:DID", "Vendor Name", "Device Name", "----------------------------------------------------------------------");
                 for (UINT8 i = 0; i < (PcitreePacket->DeviceInfoListNum < DEV_MAX_NUM ? PcitreePacket->DeviceInfoListNum : DEV_MAX_NUM); i++)
                 {
-                    Vendor * CurrentVendor     = GetVendorById(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId);
-                    char *   CurrentVendorName = (char *)"N/A";
-                    char *   CurrentDeviceName = (char *)"N/A";
+                    const char * CurrentVendorName = GetVendorNameById(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId);
+                    const char * CurrentDeviceName = GetDeviceNameById(PcitreePacket->DeviceInfoList[i].ConfigSpace.VendorId, PcitreePacket->DeviceInfoList[i].ConfigSpace.DeviceId);
 
-                    if (CurrentVendor != NULL)
-                    {
-                        CurrentVendorName      = CurrentVendor->VendorName;
-                        Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcitreePacket->DeviceInfoList[i].ConfigSpace.DeviceId);
-
-                        if (CurrentDevice != NULL)
-                        {
-                            CurrentDeviceName = CurrentDevice->DeviceName;
-                        }
-                    }
+                    CurrentVendorName = CurrentVendorName != NULL ? CurrentVendorName : "N/A";
+                    CurrentDeviceName = CurrentDeviceName != NULL ? CurrentDeviceName : "N/A";
 
                     ShowMessages("%04x:%02x:%02x:%x | %04x:%04x | %-17.*s | %.*s\n",
                                  0, // TODO: Add support for domains beyond 0000
@@ -1108,8 +1135,6 @@ StartAgain:
                                  CurrentDeviceName
 
                     );
-
-                    FreeVendor(CurrentVendor);
                 }
                 FreePciIdDatabase();
             }
@@ -1147,20 +1172,11 @@ StartAgain:
 
                 if (!PcidevinfoPacket->PrintRaw)
                 {
-                    Vendor * CurrentVendor     = GetVendorById(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId);
-                    CHAR *   CurrentVendorName = (CHAR *)"N/A";
-                    CHAR *   CurrentDeviceName = (CHAR *)"N/A";
-
-                    if (CurrentVendor != NULL)
-                    {
-                        CurrentVendorName      = CurrentVendor->VendorName;
-                        Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
+                    const char * CurrentVendorName = GetVendorNameById(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId);
+                    const char * CurrentDeviceName = GetDeviceNameById(PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId, PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
 
-                        if (CurrentDevice != NULL)
-                        {
-                            CurrentDeviceName = CurrentDevice->DeviceName;
-                        }
-                    }
+                    CurrentVendorName = CurrentVendorName != NULL ? CurrentVendorName : "N/A";
+                    CurrentDeviceName = CurrentDeviceName != NULL ? CurrentDeviceName : "N/A";
 
                     ShowMessages("\nCommon Header:\nVID:DID: %04x:%04x\nVendor Name: %-17.*s\nDevice Name: %.*s\nCommand: %04x\n",
                                  PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.VendorId,
@@ -1188,7 +1204,6 @@ StartAgain:
                                  PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.HeaderType,
                                  (PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.HeaderType & 0x1) ? "True" : "False",
                                  PcidevinfoPacket->DeviceInfo.ConfigSpace.CommonHeader.Bist);
-                    FreeVendor(CurrentVendor);
                     FreePciIdDatabase();
 
                     ShowMessages("\nDevice Header:\n");
@@ -1377,10 +1392,8 @@ StartAgain:
     BOOL Status; /* Status */
     char SerialBuffer[MaxSerialPacketSize] = {
         0};                                         /* Buffer to send and receive data */
-    DWORD                   EventMask       = 0;    /* Event mask to trigger */
-    char                    ReadData        = NULL; /* temperory Character */
-    DWORD                   NoBytesRead     = 0;    /* Bytes read by ReadFile() */
-    UINT32                  Loop            = 0;
+    DWORD                   EventMask       = 0; /* Event mask to trigger */
+    UINT32                  LengthReceived  = 0;
     PDEBUGGER_REMOTE_PACKET TheActualPacket = (PDEBUGGER_REMOTE_PACKET)SerialBuffer;
 
     //
@@ -1411,6 +1424,34 @@ StartAgain:
         // return FALSE;
     }
 
+#if UseSerialFraming == TRUE
+
+    //
+    // Read the frame (only the frame, the next bytes might belong to the
+    // kernel)
+    //
+    if (!KdReceivePacketFromDebugger(SerialBuffer, &LengthReceived))
+    {
+        //
+        // Invalid buffer
+        //
+        ShowMessages("err, unable to receive the buffer in debuggee\n");
+        goto StartAgain;
+    }
+
+    //
+    // The read is timed out, restart reading again
+    //
+    if (LengthReceived == 1 && SerialBuffer[0] == NULL)
+    {
+        goto StartAgain;
+    }
+
+#else
+
+    char  ReadData    = NULL; /* temperory Character */
+    DWORD NoBytesRead = 0;    /* Bytes read by ReadFile() */
+
     //
     // Read data and store in a buffer
     //
@@ -1421,7 +1462,7 @@ StartAgain:
         //
         // Check to make sure that we don't pass the boundaries
         //
-        if (!Status || !(MaxSerialPacketSize > Loop))
+        if (!Status || !(MaxSerialPacketSize > LengthReceived))
         {
             //
             // Invalid buffer
@@ -1431,14 +1472,14 @@ StartAgain:
             goto StartAgain;
         }
 
-        SerialBuffer[Loop] = ReadData;
+        SerialBuffer[LengthReceived] = ReadData;
 
-        if (KdCheckForTheEndOfTheBuffer(&Loop, (BYTE *)SerialBuffer))
+        if (KdCheckForTheEndOfTheBuffer(&LengthReceived, (BYTE *)SerialBuffer))
         {
             break;
         }
 
-        ++Loop;
+        ++LengthReceived;
     } while (NoBytesRead > 0);
 
     //
@@ -1446,7 +1487,7 @@ StartAgain:
     // the debuggee might cancel the read so it returns, if it returns
     // then we should restart reading again
     //
-    if (Loop == 1 && SerialBuffer[0] == NULL)
+    if (LengthReceived == 1 && SerialBuffer[0] == NULL)
     {
         //
         // Chunk data to cancel non async read
@@ -1454,11 +1495,13 @@ StartAgain:
         goto StartAgain;
     }
 
+#endif // UseSerialFraming == TRUE
+
     //
     // Get actual length of received data
     //
-    // ShowMessages("\nNumber of bytes received = %d\n", Loop);
-    // for (size_t i = 0; i < Loop; i++) {
+    // ShowMessages("\nNumber of bytes received = %d\n", LengthReceived);
+    // for (size_t i = 0; i < LengthReceived; i++) {
     //   ShowMessages("%x ", SerialBuffer[i]);
     // }
     // ShowMessages("\n");
@@ -1470,7 +1513,7 @@ StartAgain:
         // Check checksum
         //
         if (KdComputeDataChecksum((PVOID)&TheActualPacket->Indicator,
-                                  Loop - sizeof(BYTE)) != TheActualPacket->Checksum)
+                                  LengthReceived - sizeof(BYTE)) != TheActualPacket->Checksum)
         {
             ShowMessages("err checksum is invalid\n");
             goto StartAgain;
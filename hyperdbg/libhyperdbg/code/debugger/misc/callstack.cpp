@@ -198,6 +198,46 @@ CallstackReturnAddressToCallingAddress(UCHAR * ReturnAddress, PUINT32 IndexOfCal
     return FALSE;
 }
 
+/**
+ * @brief Show the frames that are unwound by the debuggee
+ * @details Each frame is the instruction pointer of a function (the current
+ * instruction for the first frame and the return address for the callers)
+ * and its offset is based on the stack pointer of the first frame
+ *
+ * @param CallstackFrames
+ * @param FrameCount
+ *
+ * @return VOID
+ */
+VOID
+CallstackShowUnwoundFrames(PDEBUGGER_SINGLE_CALLSTACK_FRAME CallstackFrames,
+                           UINT32                           FrameCount)
+{
+    UINT64 UsedBaseAddress;
+
+    for (size_t i = 0; i < FrameCount; i++)
+    {
+        ShowMessages("[$+%03llx]   %016llx    (%s ",
+                     CallstackFrames[i].StackAddress - CallstackFrames[0].StackAddress,
+                     CallstackFrames[i].Value,
+                     i == 0 ? "at " : "ret");
+
+        //
+        // Show the name of the function if available
+        // Apply addressconversion of settings here
+        //
+        if (g_AddressConversion)
+        {
+            if (SymbolShowFunctionNameBasedOnAddress(CallstackFrames[i].Value, &UsedBaseAddress))
+            {
+                ShowMessages(" ");
+            }
+        }
+
+        ShowMessages("<%016llx>)\n", CallstackFrames[i].Value);
+    }
+}
+
 /**
  * @brief Show stack frames
  *
@@ -205,6 +245,7 @@ CallstackReturnAddressToCallingAddress(UCHAR * ReturnAddress, PUINT32 IndexOfCal
  * @param FrameCount
  * @param DisplayMethod
  * @param Is32Bit
+ * @param IsUnwound
  *
  * @return VOID
  */
@@ -212,7 +253,8 @@ VOID
 CallstackShowFrames(PDEBUGGER_SINGLE_CALLSTACK_FRAME  CallstackFrames,
                     UINT32                            FrameCount,
                     DEBUGGER_CALLSTACK_DISPLAY_METHOD DisplayMethod,
-                    BOOLEAN                           Is32Bit)
+                    BOOLEAN                           Is32Bit,
+                    BOOLEAN                           IsUnwound)
 {
     UINT32                                                 CallLength;
     UINT64                                                 TargetAddress;
@@ -220,6 +262,12 @@ CallstackShowFrames(PDEBUGGER_SINGLE_CALLSTACK_FRAME  CallstackFrames,
     BOOLEAN                                                IsCall = FALSE;
     std::map<UINT64, LOCAL_FUNCTION_DESCRIPTION>::iterator Iterate;
 
+    if (IsUnwound)
+    {
+        CallstackShowUnwoundFrames(CallstackFrames, FrameCount);
+        return;
+    }
+
     //
     // Print callstack frames
     //
@@ -16,6 +16,7 @@
 // Global Variables
 //
 extern BOOLEAN g_IsSerialConnectedToRemoteDebuggee;
+extern BOOLEAN g_KdMemoryCacheEnabled;
 
 /**
  * @brief Read memory and disassembler
@@ -66,6 +67,37 @@ HyperDbgReadMemory(UINT64                              TargetAddress,
     ReadMem.ReadingType    = ReadingType;
     ReadMem.GetAddressMode = GetAddressMode;
 
+    //
+    // In the Debugger Mode, the memory of the halted debuggee is read
+    // through the cache (if it's not disabled), the physical addresses are
+    // always read directly as the cache reads the whole pages and prefetches
+    // the next pages, which might be MMIO with side effects
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee && g_KdMemoryCacheEnabled && MemoryType != DEBUGGER_READ_PHYSICAL_ADDRESS)
+    {
+        if (!KdReadMemoryWithCache(&ReadMem, TargetBufferToStore))
+        {
+            if (ReadMem.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFUL)
+            {
+                ShowErrorMessage(ReadMem.KernelStatus);
+            }
+
+            return FALSE;
+        }
+
+        *ReturnLength = ReadMem.ReturnLength;
+
+        //
+        // Set address mode (if requested)
+        //
+        if (GetAddressMode)
+        {
+            *AddressMode = ReadMem.AddressMode;
+        }
+
+        return TRUE;
+    }
+
     //
     // allocate buffer for transferring messages
     //
@@ -18,12 +18,13 @@
 //
 // Global Variables
 //
-extern UINT64 * g_ScriptGlobalVariables;
-extern UINT64 * g_ScriptStackBuffer;
-extern UINT64   g_CurrentExprEvalResult;
-extern BOOLEAN  g_CurrentExprEvalResultHasError;
-extern UINT64 * g_HwdbgPinsStatus;
-extern BOOLEAN  g_HwdbgInstanceInfoIsValid;
+extern UINT64 *           g_ScriptGlobalVariables;
+extern UINT64 *           g_ScriptStackBuffer;
+extern SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
+extern UINT64             g_CurrentExprEvalResult;
+extern BOOLEAN            g_CurrentExprEvalResultHasError;
+extern UINT64 *           g_HwdbgPinsStatus;
+extern BOOLEAN            g_HwdbgInstanceInfoIsValid;
 
 //
 // Temporary structures used only for testing
@@ -292,6 +293,29 @@ ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny)
     }
 }
 
+/**
+ * @brief Optimize the symbol buffer of a script that is sent to the debuggee
+ * @details The other users of the script engine (e.g., hwdbg) use the
+ * generated code as is
+ *
+ * @param SymbolBuffer
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperOptimizeSymbolBuffer(PVOID SymbolBuffer)
+{
+#if UseScriptEngineOptimizer == TRUE
+
+    ScriptEngineOptimizeSymbolBuffer(SymbolBuffer);
+
+#else
+
+    UNREFERENCED_PARAMETER(SymbolBuffer);
+
+#endif // UseScriptEngineOptimizer == TRUE
+}
+
 /**
  * @brief PrintSymbolBuffer wrapper
  * @details Print symbol buffer wrapper
@@ -309,12 +333,15 @@ PrintSymbolBufferWrapper(PVOID SymbolBuffer)
  * @brief Script engine evaluation wrapper
  * @param GuestRegs
  * @param Expr
+ * @param UseDecodedInterpreter Whether to run the script by the pre-decoded
+ * interpreter (the same as the actions in the kernel) or the regular one
  *
  * @return VOID
  */
 VOID
 ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
-                        string      Expr)
+                        string      Expr,
+                        BOOLEAN     UseDecodedInterpreter)
 {
     SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
 
@@ -354,6 +381,24 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
         }
     }
 
+    //
+    // Allocate aggregation maps, same as the stack buffer, only one core
+    // runs the scripts in user-mode so one table is enough
+    //
+    if (!g_ScriptEngineMaps.Tables)
+    {
+        PVOID MapsBuffer = malloc((size_t)ScriptEngineMapsGetRequiredSize(1));
+
+        if (MapsBuffer == NULL)
+        {
+            ShowMessages("err, could not allocate memory for user-mode aggregation maps");
+
+            return;
+        }
+
+        ScriptEngineMapsInitialize(&g_ScriptEngineMaps, MapsBuffer, 1);
+    }
+
     //
     // Run Parser
     //
@@ -366,8 +411,11 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
     PrintSymbolBuffer((PVOID)CodeBuffer);
 #endif
 
-    ACTION_BUFFER ActionBuffer = {0};
-    SYMBOL        ErrorSymbol  = {0};
+    ACTION_BUFFER                          ActionBuffer      = {0};
+    SYMBOL                                 ErrorSymbol       = {0};
+    PSCRIPT_ENGINE_DECODED_BUFFER          DecodedBuffer     = NULL;
+    UINT32                                 DecodedBufferSize = 0;
+    SCRIPT_ENGINE_DECODED_EXECUTION_STATUS Status            = SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL;
 
     UINT64 EXECUTENUMBER = 0;
 
@@ -375,7 +423,55 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
     ScriptGeneralRegisters.GlobalVariablesList = g_ScriptGlobalVariables;
     RtlZeroMemory(g_ScriptStackBuffer, MAX_STACK_BUFFER_COUNT * sizeof(UINT64));
 
-    if (CodeBuffer->Message == NULL)
+    //
+    // Fill the action buffer but as we're in user-mode here
+    // then there is nothing to fill
+    //
+    ActionBuffer.Context                   = NULL;
+    ActionBuffer.CurrentAction             = NULL;
+    ActionBuffer.ImmediatelySendTheResults = FALSE;
+    ActionBuffer.Tag                       = NULL;
+
+#if UseScriptEnginePreDecodedInterpreter == TRUE && !defined(_SCRIPT_ENGINE_CODEEXEC_DBG_EN)
+
+    //
+    // Pre-decode the script (the same as the kernel does for the actions)
+    //
+    if (CodeBuffer->Message == NULL && UseDecodedInterpreter)
+    {
+        DecodedBufferSize = ScriptEngineDecodeGetBufferSize(CodeBuffer);
+        DecodedBuffer     = (PSCRIPT_ENGINE_DECODED_BUFFER)malloc(DecodedBufferSize);
+
+        if (DecodedBuffer != NULL && !ScriptEngineDecode(CodeBuffer, DecodedBuffer, DecodedBufferSize))
+        {
+            free(DecodedBuffer);
+            DecodedBuffer = NULL;
+        }
+    }
+
+#else
+
+    UNREFERENCED_PARAMETER(UseDecodedInterpreter);
+
+#endif // UseScriptEnginePreDecodedInterpreter == TRUE && !defined(_SCRIPT_ENGINE_CODEEXEC_DBG_EN)
+
+    if (CodeBuffer->Message != NULL)
+    {
+        ShowMessages("%s\n", CodeBuffer->Message);
+    }
+    else if (DecodedBuffer != NULL)
+    {
+        Status = ScriptEngineExecuteDecoded(GuestRegs,
+                                            &ActionBuffer,
+                                            &ScriptGeneralRegisters,
+                                            CodeBuffer,
+                                            DecodedBuffer,
+                                            &ErrorSymbol,
+                                            NULL);
+
+        free(DecodedBuffer);
+    }
+    else
     {
 #ifdef _SCRIPT_ENGINE_CODEEXEC_DBG_EN
         printf("\nScriptEngineExecute:\n");
@@ -383,15 +479,6 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
         UINT64 i = 0;
         for (; i < CodeBuffer->Pointer;)
         {
-            //
-            // Fill the action buffer but as we're in user-mode here
-            // then there is nothing to fill
-            //
-            ActionBuffer.Context                   = NULL;
-            ActionBuffer.CurrentAction             = NULL;
-            ActionBuffer.ImmediatelySendTheResults = FALSE;
-            ActionBuffer.Tag                       = NULL;
-
 #ifdef _SCRIPT_ENGINE_CODEEXEC_DBG_EN
             printf("Address = %lld, StackIndx = %lld, StackBaseIndx = %lld\n", i, ScriptGeneralRegisters.StackIndx, ScriptGeneralRegisters.StackBaseIndx);
             PSYMBOL Operator = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
@@ -412,7 +499,7 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
 #endif
 
             //
-            // If has error, show error message and abort
+            // If has error, abort
             //
             if (ScriptEngineExecute(GuestRegs,
                                     &ActionBuffer,
@@ -421,33 +508,50 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
                                     &i,
                                     &ErrorSymbol) == TRUE)
             {
-                ShowMessages("err, ScriptEngineExecute, function = %s\n",
-                             FunctionNames[ErrorSymbol.Value]);
-                g_CurrentExprEvalResultHasError = TRUE;
-                g_CurrentExprEvalResult         = NULL;
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_ERROR;
                 break;
             }
             else if (ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
             {
-                ShowMessages("err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
-                g_CurrentExprEvalResultHasError = TRUE;
-                g_CurrentExprEvalResult         = NULL;
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW;
                 break;
             }
             else if (EXECUTENUMBER >= MAX_EXECUTION_COUNT)
             {
-                ShowMessages("err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
-                g_CurrentExprEvalResultHasError = TRUE;
-                g_CurrentExprEvalResult         = NULL;
+                Status = SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT;
                 break;
             }
 
             EXECUTENUMBER++;
         }
     }
-    else
+
+    //
+    // Show error message (the same for both of the interpreters)
+    //
+    switch (Status)
     {
-        ShowMessages("%s\n", CodeBuffer->Message);
+    case SCRIPT_ENGINE_DECODED_EXECUTION_ERROR:
+        ShowMessages("err, ScriptEngineExecute, function = %s\n",
+                     FunctionNames[ErrorSymbol.Value]);
+        break;
+
+    case SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW:
+        ShowMessages("err, stack buffer overflow (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+        break;
+
+    case SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT:
+        ShowMessages("err, exceeding the max execution count (more information: https://docs.hyperdbg.org/tips-and-tricks/misc/customize-build/change-script-engine-limitations)\n");
+        break;
+
+    default:
+        break;
+    }
+
+    if (Status != SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL)
+    {
+        g_CurrentExprEvalResultHasError = TRUE;
+        g_CurrentExprEvalResult         = NULL;
     }
 
     RemoveSymbolBuffer(CodeBuffer);
@@ -457,6 +561,9 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
 
 /**
  * @brief massive tests for script engine statements
+ * @details Each statement is tested by both of the regular and the pre-decoded
+ * interpreters, the global variables are restored before the second run
+ *
  * @param Expr The expression to test
  * @param ExpectationValue What value this statements expects (not
  * used if ExceptError is TRUE)
@@ -467,29 +574,71 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
 BOOLEAN
 ScriptAutomaticStatementsTestWrapper(const string & Expr, UINT64 ExpectationValue, BOOLEAN ExceptError)
 {
-    //
-    // Set the global variable indicator of test_statement to 0
-    //
-    g_CurrentExprEvalResult = 0;
+    const BOOLEAN Interpreters[]          = {FALSE, TRUE};
+    UINT64 *      GlobalVariablesSnapshot = NULL;
+    BOOLEAN       HasErrorSnapshot        = g_CurrentExprEvalResultHasError;
+    BOOLEAN       Result                  = TRUE;
 
     //
-    // Call the test parser
+    // Keep the global variables as the statements might modify them
     //
-    ScriptEngineWrapperTestParser(Expr);
-
-    //
-    // Check the global variable to see the results
-    //
-    if (g_CurrentExprEvalResultHasError && ExceptError)
+    if (g_ScriptGlobalVariables != NULL)
     {
-        return TRUE;
+        GlobalVariablesSnapshot = (UINT64 *)malloc(MAX_VAR_COUNT * sizeof(UINT64));
+
+        if (GlobalVariablesSnapshot == NULL)
+        {
+            ShowMessages("err, could not allocate memory for the snapshot of global variables");
+            return FALSE;
+        }
+
+        memcpy(GlobalVariablesSnapshot, g_ScriptGlobalVariables, MAX_VAR_COUNT * sizeof(UINT64));
     }
-    else if (ExpectationValue == g_CurrentExprEvalResult)
+
+    for (BOOLEAN UseDecodedInterpreter : Interpreters)
     {
-        return TRUE;
+        //
+        // Restore the state to what the previous run has seen
+        //
+        if (UseDecodedInterpreter && g_ScriptGlobalVariables != NULL)
+        {
+            if (GlobalVariablesSnapshot != NULL)
+            {
+                memcpy(g_ScriptGlobalVariables, GlobalVariablesSnapshot, MAX_VAR_COUNT * sizeof(UINT64));
+            }
+            else
+            {
+                RtlZeroMemory(g_ScriptGlobalVariables, MAX_VAR_COUNT * sizeof(UINT64));
+            }
+        }
+
+        g_CurrentExprEvalResultHasError = HasErrorSnapshot;
+
+        //
+        // Set the global variable indicator of test_statement to 0
+        //
+        g_CurrentExprEvalResult = 0;
+
+        //
+        // Call the test parser
+        //
+        ScriptEngineWrapperTestParser(Expr, UseDecodedInterpreter);
+
+        //
+        // Check the global variable to see the results
+        //
+        if (!(g_CurrentExprEvalResultHasError && ExceptError) &&
+            ExpectationValue != g_CurrentExprEvalResult)
+        {
+            ShowMessages("err, unexpected result from the %s interpreter\n",
+                         UseDecodedInterpreter ? "pre-decoded" : "regular");
+            Result = FALSE;
+        }
     }
 
-    return FALSE;
+    free(GlobalVariablesSnapshot);
+
+    return Result;
 }
 
 /**
@@ -638,11 +787,12 @@ AllocateStructForCasting(PALLOCATED_MEMORY_FOR_SCRIPT_ENGINE_CASTING Allocations
 /**
  * @brief test parser
  * @param Expr
+ * @param UseDecodedInterpreter
  *
  * @return VOID
  */
 VOID
-ScriptEngineWrapperTestParser(const string & Expr)
+ScriptEngineWrapperTestParser(const string & Expr, BOOLEAN UseDecodedInterpreter)
 {
     ALLOCATED_MEMORY_FOR_SCRIPT_ENGINE_CASTING AllocationsForCastings = {0};
 
@@ -701,7 +851,7 @@ ScriptEngineWrapperTestParser(const string & Expr)
     GuestRegs.r14 = (UINT64)testw;
     GuestRegs.r15 = (UINT64)test;
 
-    ScriptEngineEvalWrapper(&GuestRegs, Expr);
+    ScriptEngineEvalWrapper(&GuestRegs, Expr, UseDecodedInterpreter);
 
     free(RspReg);
     free(TestStruct);
@@ -736,7 +886,7 @@ ScriptEngineWrapperTestParserForHwdbg(const string & Expr)
         RtlZeroMemory(g_HwdbgPinsStatus, MAX_HWDBG_TESTING_PIN_COUNT * sizeof(UINT64));
     }
 
-    ScriptEngineEvalWrapper((PGUEST_REGS)g_HwdbgPinsStatus, Expr);
+    ScriptEngineEvalWrapper((PGUEST_REGS)g_HwdbgPinsStatus, Expr, FALSE);
 }
 
 /**
@@ -755,7 +905,7 @@ ScriptEngineEvalUInt64StyleExpressionWrapper(const string & Expr, PBOOLEAN HasEr
     //
     GUEST_REGS GuestRegs = {0};
 
-    ScriptEngineEvalWrapper(&GuestRegs, Expr);
+    ScriptEngineEvalWrapper(&GuestRegs, Expr, TRUE);
 
     //
     // Set the results and return the value
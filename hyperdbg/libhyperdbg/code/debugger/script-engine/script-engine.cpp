@@ -55,6 +55,11 @@ ScriptEngineEvalSingleExpression(string Expr, PBOOLEAN HasError)
         return NULL;
     }
 
+    //
+    // Optimize the script before it's sent to the debuggee
+    //
+    ScriptEngineWrapperOptimizeSymbolBuffer(CodeBuffer);
+
     //
     // Print symbols (test)
     //
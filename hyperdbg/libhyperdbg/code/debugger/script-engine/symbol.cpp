@@ -18,6 +18,7 @@
 extern PMODULE_SYMBOL_DETAIL                        g_SymbolTable;
 extern UINT32                                       g_SymbolTableSize;
 extern UINT32                                       g_SymbolTableCurrentIndex;
+extern PMODULE_TABLE_ENTRY                          g_SymbolTableModules;
 extern BOOLEAN                                      g_IsExecutingSymbolLoadingRoutines;
 extern BOOLEAN                                      g_IsSerialConnectedToRemoteDebugger;
 extern BOOLEAN                                      g_AddressConversion;
@@ -440,6 +441,25 @@ SymbolDeleteSymTable()
     //
     // Delete symbols
     //
+    return SymbolFreeSymTable();
+}
+
+/**
+ * @brief Free the symbol table (the loaded symbols are not unloaded)
+ * @details The symbols of the modules that are not in the next symbol
+ * table are unloaded when the next table is loaded
+ *
+ * @return BOOLEAN shows whether the operation was successful or not
+ */
+BOOLEAN
+SymbolFreeSymTable()
+{
+    if (g_SymbolTableModules != NULL)
+    {
+        free(g_SymbolTableModules);
+        g_SymbolTableModules = NULL;
+    }
+
     if (g_SymbolTable != NULL)
     {
         free(g_SymbolTable);
@@ -455,9 +475,84 @@ SymbolDeleteSymTable()
     }
 }
 
+/**
+ * @brief Read the details of the PDB file of a module
+ *
+ * @param ModuleDetail The module (its file path and whether it's a 32-bit
+ * module should be set)
+ *
+ * @return VOID
+ */
+VOID
+SymbolReadModulePdbDetails(PMODULE_SYMBOL_DETAIL ModuleDetail)
+{
+    char ModuleSymbolPath[MAX_PATH]                        = {0};
+    char ModuleSymbolGuidAndAge[MAXIMUM_GUID_AND_AGE_SIZE] = {0};
+
+    if (!ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetailsWrapper(ModuleDetail->FilePath,
+                                                                     ModuleSymbolPath,
+                                                                     ModuleSymbolGuidAndAge,
+                                                                     ModuleDetail->Is32Bit))
+    {
+        //
+        // ShowMessages("err, unable to get module pdb details\n");
+        //
+        ModuleDetail->IsSymbolDetailsFound = FALSE;
+        return;
+    }
+
+    ModuleDetail->IsSymbolDetailsFound = TRUE;
+    memcpy(ModuleDetail->ModuleSymbolGuidAndAge, ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE);
+    memcpy(ModuleDetail->ModuleSymbolPath, ModuleSymbolPath, MAX_PATH);
+
+    //
+    // Check if pdb file name is a real path or a module name
+    //
+    string ModuleSymbolPathString(ModuleSymbolPath);
+    if (ModuleSymbolPathString.find(":\\") != std::string::npos)
+        ModuleDetail->IsLocalSymbolPath = TRUE;
+    else
+        ModuleDetail->IsLocalSymbolPath = FALSE;
+}
+
+/**
+ * @brief Get the identity of a module in the symbol table
+ * @details The last write time and the size of the file are a part of the
+ * identity, so a module that is rebuilt at the same path is read again
+ *
+ * @param FilePath
+ *
+ * @return UINT64
+ */
+UINT64
+SymbolGetModuleIdentity(const CHAR * FilePath)
+{
+    WIN32_FILE_ATTRIBUTE_DATA FileAttributes;
+    CHAR                      FileDetails[64] = {0};
+    UINT64                    Identity        = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, FilePath);
+
+    if (GetFileAttributesExA(FilePath, GetFileExInfoStandard, &FileAttributes))
+    {
+        sprintf_s(FileDetails,
+                  sizeof(FileDetails),
+                  "%08x%08x:%08x%08x",
+                  FileAttributes.ftLastWriteTime.dwHighDateTime,
+                  FileAttributes.ftLastWriteTime.dwLowDateTime,
+                  FileAttributes.nFileSizeHigh,
+                  FileAttributes.nFileSizeLow);
+
+        Identity = ModuleTableHashString(Identity, FileDetails);
+    }
+
+    return Identity;
+}
+
 /**
  * @brief make the initial packet required for symbol server
  * or reload packet
+ * @details The modules are compared with the modules of the previous
+ * (locally built) symbol table, and only the details of the changed
+ * modules are read again
  *
  * @param BufferToStoreDetails Pointer to a buffer to store the symbols details
  * this buffer will be allocated by this function and needs to be freed by caller
@@ -476,24 +571,29 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
 {
     BOOLEAN                         Status;
     ULONG                           ReturnedLength;
-    PRTL_PROCESS_MODULES            ModuleInfo                                        = NULL;
-    PMODULE_SYMBOL_DETAIL           ModuleSymDetailArray                              = NULL;
-    char                            SystemRoot[MAX_PATH]                              = {0};
-    char                            ModuleSymbolPath[MAX_PATH]                        = {0};
-    char                            TempPath[MAX_PATH]                                = {0};
-    char                            ModuleSymbolGuidAndAge[MAXIMUM_GUID_AND_AGE_SIZE] = {0};
-    BOOLEAN                         IsSymbolPdbDetailAvailable                        = FALSE;
-    BOOLEAN                         IsFreeUsermodeModulesBuffer                       = FALSE;
-    UINT32                          ModuleDetailsSize                                 = 0;
-    UINT32                          ModulesCount                                      = 0;
-    PUSERMODE_LOADED_MODULE_DETAILS ModuleDetailsRequest                              = NULL;
-    PUSERMODE_LOADED_MODULE_SYMBOLS Modules                                           = NULL;
-    USERMODE_LOADED_MODULE_DETAILS  ModuleCountRequest                                = {0};
-
-    //
-    // Check if we found an already built symbol table
-    //
-    SymbolDeleteSymTable();
+    PRTL_PROCESS_MODULES            ModuleInfo                  = NULL;
+    PMODULE_SYMBOL_DETAIL           ModuleSymDetailArray        = NULL;
+    PMODULE_TABLE_ENTRY             NewModules                  = NULL;
+    char                            SystemRoot[MAX_PATH]        = {0};
+    BOOLEAN                         IsFreeUsermodeModulesBuffer = FALSE;
+    UINT32                          ModuleDetailsSize           = 0;
+    UINT32                          ModulesCount                = 0;
+    UINT32                          TotalModulesCount           = 0;
+    UINT32                          PreviousModulesCount        = 0;
+    UINT64                          StorageSize                 = 0;
+    PUSERMODE_LOADED_MODULE_DETAILS ModuleDetailsRequest        = NULL;
+    PUSERMODE_LOADED_MODULE_SYMBOLS Modules                     = NULL;
+    USERMODE_LOADED_MODULE_DETAILS  ModuleCountRequest          = {0};
+
+    //
+    // An already built symbol table is kept until the new table is built,
+    // so the details of its unchanged modules are reused (the tables that
+    // are received from the debuggee have no modules to compare)
+    //
+    if (*BufferToStoreDetails != NULL && g_SymbolTableModules != NULL)
+    {
+        PreviousModulesCount = *StoredLength / sizeof(MODULE_SYMBOL_DETAIL);
+    }
 
     //
     // Get system root
@@ -676,10 +776,11 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
     //
     // Allocate Details buffer
     //
-    ModuleSymDetailArray = (PMODULE_SYMBOL_DETAIL)malloc(
-        (ModuleInfo->NumberOfModules + ModulesCount) * sizeof(MODULE_SYMBOL_DETAIL));
+    TotalModulesCount    = ModuleInfo->NumberOfModules + ModulesCount;
+    ModuleSymDetailArray = (PMODULE_SYMBOL_DETAIL)malloc(TotalModulesCount * sizeof(MODULE_SYMBOL_DETAIL));
+    NewModules           = (PMODULE_TABLE_ENTRY)malloc(TotalModulesCount * sizeof(MODULE_TABLE_ENTRY));
 
-    if (ModuleSymDetailArray == NULL)
+    if (ModuleSymDetailArray == NULL || NewModules == NULL)
     {
         ShowMessages("err, unable to allocate memory for module list (%x)\n",
                      GetLastError());
@@ -689,6 +790,8 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
             free(ModuleDetailsRequest);
         }
 
+        free(ModuleSymDetailArray);
+        free(NewModules);
         free(ModuleInfo);
         return FALSE;
     }
@@ -696,7 +799,7 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
     //
     // Make sure buffer is zero
     //
-    RtlZeroMemory(ModuleSymDetailArray, (ModuleInfo->NumberOfModules + ModulesCount) * sizeof(MODULE_SYMBOL_DETAIL));
+    RtlZeroMemory(ModuleSymDetailArray, TotalModulesCount * sizeof(MODULE_SYMBOL_DETAIL));
 
     //
     // ----------------------------------------------------------------------------------
@@ -704,88 +807,42 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
     // ----------------------------------------------------------------------------------
     //
 
-    if (ModulesCount != 0)
+    for (UINT32 i = 0; i < ModulesCount; i++)
     {
-        for (UINT32 i = 0; i < ModulesCount; i++)
-        {
-            //
-            // For logging purpose
-            //
-
-            /*
-            ShowMessages("%016llx\t%016llx\t%ws\n",
-                         Modules[i].BaseAddress,
-                         Modules[i].Entrypoint,
-                         Modules[i].FilePath);
-                         */
-
-            //
-            // Read symbol signature details
-            //
-            RtlZeroMemory(ModuleSymbolPath, sizeof(ModuleSymbolPath));
-            RtlZeroMemory(TempPath, sizeof(TempPath));
-            RtlZeroMemory(ModuleSymbolGuidAndAge, sizeof(ModuleSymbolGuidAndAge));
-
-            //
-            // Convert symbol path from unicode to ascii
-            //
-            wcstombs(TempPath, Modules[i].FilePath, MAX_PATH);
-
-            if (ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetailsWrapper(
-                    TempPath,
-                    ModuleSymbolPath,
-                    ModuleSymbolGuidAndAge,
-                    ModuleDetailsRequest->Is32Bit))
-            {
-                IsSymbolPdbDetailAvailable = TRUE;
-
-                // ShowMessages("Hash : %s , Symbol path : %s\n", ModuleSymbolGuidAndAge, ModuleSymbolPath);
-            }
-            else
-            {
-                IsSymbolPdbDetailAvailable = FALSE;
-
-                // ShowMessages("err, unable to get module pdb details\n");
-            }
+        //
+        // For logging purpose
+        //
 
-            //
-            // Build the structure for this module
-            //
-            ModuleSymDetailArray[i].BaseAddress = Modules[i].BaseAddress;
-            ModuleSymDetailArray[i].IsUserMode  = TRUE;
-            ModuleSymDetailArray[i].Is32Bit     = ModuleDetailsRequest->Is32Bit;
+        /*
+        ShowMessages("%016llx\t%016llx\t%ws\n",
+                     Modules[i].BaseAddress,
+                     Modules[i].Entrypoint,
+                     Modules[i].FilePath);
+                     */
 
-            memcpy(ModuleSymDetailArray[i].FilePath, TempPath, strlen(TempPath));
+        //
+        // Convert symbol path from unicode to ascii
+        //
+        wcstombs(ModuleSymDetailArray[i].FilePath, Modules[i].FilePath, MAX_PATH - 1);
 
-            if (IsSymbolPdbDetailAvailable)
-            {
-                ModuleSymDetailArray[i].IsSymbolDetailsFound = TRUE;
-                memcpy(ModuleSymDetailArray[i].ModuleSymbolGuidAndAge, ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE);
-                memcpy(ModuleSymDetailArray[i].ModuleSymbolPath, ModuleSymbolPath, MAX_PATH);
+        //
+        // Build the structure for this module
+        //
+        ModuleSymDetailArray[i].BaseAddress = Modules[i].BaseAddress;
+        ModuleSymDetailArray[i].IsUserMode  = TRUE;
+        ModuleSymDetailArray[i].Is32Bit     = ModuleDetailsRequest->Is32Bit;
 
-                //
-                // Check if pdb file name is a real path or a module name
-                //
-                string ModuleSymbolPathString(ModuleSymbolPath);
-                if (ModuleSymbolPathString.find(":\\") != std::string::npos)
-                    ModuleSymDetailArray[i].IsLocalSymbolPath = TRUE;
-                else
-                    ModuleSymDetailArray[i].IsLocalSymbolPath = FALSE;
-            }
-            else
-            {
-                ModuleSymDetailArray[i].IsSymbolDetailsFound = FALSE;
-            }
+        //
+        // The size of the user-mode modules is not reported, and the same
+        // path is a different file for the 32-bit processes
+        //
+        NewModules[i].BaseAddress = Modules[i].BaseAddress;
+        NewModules[i].Size        = 0;
+        NewModules[i].Identity    = SymbolGetModuleIdentity(ModuleSymDetailArray[i].FilePath);
 
-            //
-            // Check if it should be send to the remote debugger over serial
-            // and also make sure that we're connected to the remote debugger
-            // and this is a debuggee
-            //
-            if (SendOverSerial)
-            {
-                KdSendSymbolDetailPacket(&ModuleSymDetailArray[i], i, ModuleInfo->NumberOfModules + ModulesCount);
-            }
+        if (ModuleDetailsRequest->Is32Bit)
+        {
+            NewModules[i].Identity = ModuleTableHashString(NewModules[i].Identity, "wow64");
         }
     }
 
@@ -799,14 +856,6 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
     {
         UINT32 IndexInSymbolBuffer = ModulesCount + i;
 
-        auto PathName = ModuleInfo->Modules[i].FullPathName + ModuleInfo->Modules[i].OffsetToFileName;
-
-        //
-        // Read symbol signature details
-        //
-        RtlZeroMemory(ModuleSymbolPath, sizeof(ModuleSymbolPath));
-        RtlZeroMemory(ModuleSymbolGuidAndAge, sizeof(ModuleSymbolGuidAndAge));
-
         string ModuleFullPath((const char *)ModuleInfo->Modules[i].FullPathName);
 
         if (ModuleFullPath.rfind("\\SystemRoot\\", 0) == 0)
@@ -820,52 +869,56 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
         }
 
         //
-        // Kernel modules are all 64-bit
+        // Build the structure for this module (kernel modules are all 64-bit)
         //
-        if (ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetailsWrapper(ModuleFullPath.c_str(),
-                                                                        ModuleSymbolPath,
-                                                                        ModuleSymbolGuidAndAge,
-                                                                        FALSE))
-        {
-            IsSymbolPdbDetailAvailable = TRUE;
+        ModuleSymDetailArray[IndexInSymbolBuffer].BaseAddress = (UINT64)ModuleInfo->Modules[i].ImageBase;
+        ModuleSymDetailArray[IndexInSymbolBuffer].ModuleSize  = ModuleInfo->Modules[i].ImageSize;
+        memcpy(ModuleSymDetailArray[IndexInSymbolBuffer].FilePath, ModuleFullPath.c_str(), ModuleFullPath.size());
 
-            //
-            // ShowMessages("Hash : %s , Symbol path : %s\n", ModuleSymbolGuidAndAge, ModuleSymbolPath);
-            //
-        }
-        else
-        {
-            IsSymbolPdbDetailAvailable = FALSE;
+        NewModules[IndexInSymbolBuffer].BaseAddress = (UINT64)ModuleInfo->Modules[i].ImageBase;
+        NewModules[IndexInSymbolBuffer].Size        = ModuleInfo->Modules[i].ImageSize;
+        NewModules[IndexInSymbolBuffer].Identity    = SymbolGetModuleIdentity(ModuleFullPath.c_str());
+    }
 
-            //
-            // ShowMessages("err, unable to get module pdb details\n");
-            //
-        }
+    //
+    // ----------------------------------------------------------------------------------
+    // Read symbol signature details (of the changed modules)
+    // ----------------------------------------------------------------------------------
+    //
 
-        //
-        // Build the structure for this module
-        //
-        ModuleSymDetailArray[IndexInSymbolBuffer].BaseAddress = (UINT64)ModuleInfo->Modules[i].ImageBase;
-        memcpy(ModuleSymDetailArray[IndexInSymbolBuffer].FilePath, ModuleFullPath.c_str(), ModuleFullPath.size());
+    vector<UINT32> OldToNew(PreviousModulesCount);
+    vector<UINT32> NewToOld(TotalModulesCount, MODULE_TABLE_NO_MODULE);
 
-        if (IsSymbolPdbDetailAvailable)
-        {
-            ModuleSymDetailArray[IndexInSymbolBuffer].IsSymbolDetailsFound = TRUE;
-            memcpy(ModuleSymDetailArray[IndexInSymbolBuffer].ModuleSymbolGuidAndAge, ModuleSymbolGuidAndAge, MAXIMUM_GUID_AND_AGE_SIZE);
-            memcpy(ModuleSymDetailArray[IndexInSymbolBuffer].ModuleSymbolPath, ModuleSymbolPath, MAX_PATH);
+    ModuleTableGetRequiredSize(PreviousModulesCount, TotalModulesCount, &StorageSize);
+
+    vector<BYTE> Storage((size_t)StorageSize);
 
+    if (!ModuleTableCompare(g_SymbolTableModules,
+                            PreviousModulesCount,
+                            NewModules,
+                            TotalModulesCount,
+                            Storage.data(),
+                            StorageSize,
+                            OldToNew.data(),
+                            NewToOld.data()))
+    {
+        std::fill(NewToOld.begin(), NewToOld.end(), MODULE_TABLE_NO_MODULE);
+    }
+
+    for (UINT32 i = 0; i < TotalModulesCount; i++)
+    {
+        if (NewToOld[i] != MODULE_TABLE_NO_MODULE)
+        {
             //
-            // Check if pdb file name is a real path or a module name
+            // The module is not changed, so the details of its pdb are the same
             //
-            string ModuleSymbolPathString(ModuleSymbolPath);
-            if (ModuleSymbolPathString.find(":\\") != std::string::npos)
-                ModuleSymDetailArray[IndexInSymbolBuffer].IsLocalSymbolPath = TRUE;
-            else
-                ModuleSymDetailArray[IndexInSymbolBuffer].IsLocalSymbolPath = FALSE;
+            memcpy(&ModuleSymDetailArray[i], &(*BufferToStoreDetails)[NewToOld[i]], sizeof(MODULE_SYMBOL_DETAIL));
         }
         else
         {
-            ModuleSymDetailArray[IndexInSymbolBuffer].IsSymbolDetailsFound = FALSE;
+            SymbolReadModulePdbDetails(&ModuleSymDetailArray[i]);
+
+            // ShowMessages("Hash : %s , Symbol path : %s\n", ModuleSymDetailArray[i].ModuleSymbolGuidAndAge, ModuleSymDetailArray[i].ModuleSymbolPath);
         }
 
         //
@@ -875,7 +928,7 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
         //
         if (SendOverSerial)
         {
-            KdSendSymbolDetailPacket(&ModuleSymDetailArray[IndexInSymbolBuffer], i, ModuleInfo->NumberOfModules + ModulesCount);
+            KdSendSymbolDetailPacket(&ModuleSymDetailArray[i], i, TotalModulesCount);
         }
     }
 
@@ -883,11 +936,18 @@ SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
     // ----------------------------------------------------------------------------------
     //
 
+    //
+    // Free the previous table (its symbols are unloaded by loading the new
+    // table, if they're not in the new table)
+    //
+    SymbolFreeSymTable();
+
     //
     // Store the buffer and length of module symbols details
     //
     *BufferToStoreDetails = ModuleSymDetailArray;
-    *StoredLength         = (ModuleInfo->NumberOfModules + ModulesCount) * sizeof(MODULE_SYMBOL_DETAIL);
+    *StoredLength         = TotalModulesCount * sizeof(MODULE_SYMBOL_DETAIL);
+    g_SymbolTableModules  = NewModules;
 
     free(ModuleInfo);
 
@@ -920,6 +980,16 @@ SymbolBuildAndUpdateSymbolTable(PMODULE_SYMBOL_DETAIL SymbolDetail)
         return FALSE;
     }
 
+    //
+    // The symbol table is not built locally, so it has no modules to compare
+    // with the next (locally built) table
+    //
+    if (g_SymbolTableModules != NULL)
+    {
+        free(g_SymbolTableModules);
+        g_SymbolTableModules = NULL;
+    }
+
     //
     // Check if we found an already built symbol table
     //
@@ -976,9 +1046,10 @@ BOOLEAN
 SymbolReloadSymbolTableInDebuggerMode(UINT32 ProcessId)
 {
     //
-    // Check if we found an already built symbol table
+    // Free the already built symbol table (the symbols of the modules
+    // that are not changed remain loaded)
     //
-    SymbolDeleteSymTable();
+    SymbolFreeSymTable();
 
     //
     // Request to send new symbol details
@@ -181,7 +181,8 @@ VOID
 CallstackShowFrames(PDEBUGGER_SINGLE_CALLSTACK_FRAME  CallstackFrames,
                     UINT32                            FrameCount,
                     DEBUGGER_CALLSTACK_DISPLAY_METHOD DisplayMethod,
-                    BOOLEAN                           Is32Bit);
+                    BOOLEAN                           Is32Bit,
+                    BOOLEAN                           IsUnwound);
 
 UINT64
 GetNewDebuggerEventTag();
@@ -244,6 +245,15 @@ CommandTrackHandleReceivedCallInstructions(const char * NameOfFunctionFromSymbol
 VOID
 CommandTrackHandleReceivedRetInstructions(UINT64 CurrentRip);
 
+VOID
+CommandTrackHandleReceivedRecords(TRACK_TRACE_BUFFER * Records, UINT32 RecordsLength);
+
+VOID
+CommandTrackShowCall(UINT32 Depth, const char * NameOfFunctionFromSymbols, UINT64 ComputedAbsoluteAddress);
+
+VOID
+CommandTrackShowRet(UINT32 Depth, UINT64 CurrentRip);
+
 BOOLEAN
 HyperDbgWriteMemory(PVOID                     DestinationAddress,
                     DEBUGGER_EDIT_MEMORY_TYPE MemoryType,
@@ -31,6 +31,25 @@ typedef void (*hyperdbg_event_forwarding_t)(const char *, unsigned int);
  */
 #define MAXIMUM_CHARACTERS_FOR_EVENT_FORWARDING_NAME 50
 
+/**
+ * @brief size of the queue of the messages of each output source
+ *
+ */
+#define EVENT_FORWARDING_QUEUE_SIZE (1024 * 1024)
+
+/**
+ * @brief size of the batches that are written to the output sources
+ *
+ */
+#define EVENT_FORWARDING_BATCH_SIZE (256 * 1024)
+
+/**
+ * @brief maximum messages of a batch of the output sources that keep
+ * the boundaries of the messages (namedpipes and modules)
+ *
+ */
+#define EVENT_FORWARDING_MAXIMUM_BATCH_MESSAGES 256
+
 /**
  * @brief event forwarding type
  *
@@ -75,6 +94,8 @@ typedef enum _DEBUGGER_OUTPUT_SOURCE_STATUS
 /**
  * @brief structures hold the detail of event forwarding
  *
+ * @details once the source is opened, the messages are queued and a
+ * worker thread writes them to the source in batches
  */
 typedef struct _DEBUGGER_EVENT_FORWARDING
 {
@@ -88,8 +109,32 @@ typedef struct _DEBUGGER_EVENT_FORWARDING
     OutputSourcesList; // Linked-list of output sources list
     CHAR Name[MAXIMUM_CHARACTERS_FOR_EVENT_FORWARDING_NAME];
 
+    FORWARD_QUEUE_POLICY Policy;        // Block or drop the messages once the queue is full
+    FORWARD_QUEUE        Queue;         // Messages that are not written yet
+    CRITICAL_SECTION     QueueLock;     // Lock of the queue
+    CONDITION_VARIABLE   QueueNotEmpty; // The worker waits for the messages
+    CONDITION_VARIABLE   QueueNotFull;  // The blocked messages wait for the worker
+    HANDLE               WorkerThread;
+    BOOLEAN              StopWorker;
+    PVOID                QueueBuffer;
+    CHAR *               Batch;
+    UINT32 *             BatchLengths;
+
 } DEBUGGER_EVENT_FORWARDING, *PDEBUGGER_EVENT_FORWARDING;
 
+/**
+ * @brief copy of the script of an event that sends the binary records
+ *
+ * @details the records only have the offsets of their formats in the
+ * script, and the formats are written once to each output source
+ */
+typedef struct _DEBUGGER_EVENT_SCRIPT
+{
+    std::vector<CHAR>          Buffer;           // Copy of the script (the formats are in it)
+    std::unordered_set<UINT32> ForwardedFormats; // Offsets of the formats that are written to the output sources
+
+} DEBUGGER_EVENT_SCRIPT, *PDEBUGGER_EVENT_SCRIPT;
+
 //////////////////////////////////////////
 //              Functions	            //
 //////////////////////////////////////////
@@ -103,6 +148,25 @@ ForwardingOpenOutputSource(PDEBUGGER_EVENT_FORWARDING SourceDescriptor);
 DEBUGGER_OUTPUT_SOURCE_STATUS
 ForwardingCloseOutputSource(PDEBUGGER_EVENT_FORWARDING SourceDescriptor);
 
+VOID
+ForwardingGetOutputSourceStatistics(PDEBUGGER_EVENT_FORWARDING SourceDescriptor,
+                                    PFORWARD_QUEUE_STATISTICS  Statistics);
+
+VOID
+ForwardingAddEventOutputSources(PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail);
+
+VOID
+ForwardingRemoveEventOutputSources(UINT64 Tag);
+
+VOID
+ForwardingAddEventScript(UINT64 Tag, const CHAR * Script, UINT32 ScriptSize);
+
+VOID
+ForwardingRemoveEventScript(UINT64 Tag);
+
+VOID
+ForwardingShowEventMessages(const CHAR * Buffer, UINT32 Length);
+
 BOOLEAN
 ForwardingCheckAndPerformEventForwarding(UINT32 OperationCode,
                                          CHAR * Message,
@@ -179,6 +179,22 @@ DEBUGGER_SYNCRONIZATION_EVENTS_STATE g_UserSyncronizationObjectsHandleTable
 //		 Serial Debugging Variables             //
 //////////////////////////////////////////////////
 
+#if UseSerialFraming == TRUE
+
+/**
+ * @brief The receiver of the frames from the debuggee (in debugger)
+ *
+ */
+SERIAL_FRAME_RECEIVER g_SerialFrameReceiver = {0};
+
+/**
+ * @brief The ring of the receiver of the frames from the debuggee
+ *
+ */
+BYTE g_SerialFrameReceiverRing[SERIAL_FRAME_RECEIVER_RING_SIZE] = {0};
+
+#else
+
 /**
  * @brief the buffer that we set at the end of buffers for serial
  */
@@ -188,6 +204,20 @@ BYTE g_EndOfBufferCheckSerial[SERIAL_END_OF_BUFFER_CHARS_COUNT] = {
     SERIAL_END_OF_BUFFER_CHAR_3,
     SERIAL_END_OF_BUFFER_CHAR_4};
 
+#endif // UseSerialFraming == TRUE
+
+/**
+ * @brief The cache of the memory of the halted debuggee (in debugger)
+ *
+ */
+PAGE_CACHE g_KdMemoryCache = {0};
+
+/**
+ * @brief Whether the memory of the debuggee is read through the cache
+ *
+ */
+BOOLEAN g_KdMemoryCacheEnabled = TRUE;
+
 /**
  * @brief In debugger (not debuggee), we save the handle
  * of the user-mode listening thread for pauses here for kernel debugger
@@ -329,6 +359,12 @@ CommandType g_CommandsList;
  */
 UINT64 * g_ScriptGlobalVariables;
 
+/**
+ * @brief Aggregation maps of the script engine
+ *
+ */
+SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
+
 /**
  * @brief Holder of stack buffer for script engine
  *
@@ -410,6 +446,37 @@ BOOLEAN g_OutputSourcesInitialized = FALSE;
  */
 LIST_ENTRY g_OutputSources = {0};
 
+/**
+ * @brief Holds the output sources of each event (by the tag of the event)
+ *
+ * @details the messages of the events are forwarded by looking up this
+ * index instead of the list of the events
+ *
+ */
+std::unordered_map<UINT32, std::vector<PDEBUGGER_EVENT_FORWARDING>> g_OutputSourcesOfEvents;
+
+/**
+ * @brief Lock of g_OutputSourcesOfEvents (the messages are forwarded
+ * from the threads that receive them)
+ *
+ */
+SRWLOCK g_OutputSourcesOfEventsLock = SRWLOCK_INIT;
+
+/**
+ * @brief Holds the copies of the scripts of the events that send the
+ * binary records (by the tag of the event)
+ *
+ * @details the formats of the records are only offsets in these scripts
+ *
+ */
+std::unordered_map<UINT64, DEBUGGER_EVENT_SCRIPT> g_ScriptsOfEvents;
+
+/**
+ * @brief Lock of g_ScriptsOfEvents
+ *
+ */
+SRWLOCK g_ScriptsOfEventsLock = SRWLOCK_INIT;
+
 /**
  * @brief Holds the location driver to install it
  *
@@ -621,6 +688,13 @@ UINT32 g_SymbolTableSize = NULL;
  */
 UINT32 g_SymbolTableCurrentIndex = NULL;
 
+/**
+ * @brief The modules of the (locally built) symbol table, so
+ * the next reload only processes the changed modules
+ *
+ */
+PMODULE_TABLE_ENTRY g_SymbolTableModules = NULL;
+
 /**
  * @brief Result of the expression that is evaluated in the
  * debuggee
@@ -60,6 +60,20 @@
         SetEvent(SyncronizationObject->EventHandle);                       \
     } while (FALSE);
 
+/**
+ * @brief Size of the ring that the frames from the debuggee are received in
+ * @details A power of two that a whole frame (MaxSerialPacketSize) fits in it
+ *
+ */
+#define SERIAL_FRAME_RECEIVER_RING_SIZE 0x40000
+
+/**
+ * @brief Number of the pages that are read after the pages that are not
+ * cached (the memory of the debuggee is mostly read sequentially)
+ *
+ */
+#define KD_MEMORY_CACHE_PREFETCH_PAGES 2
+
 //////////////////////////////////////////////////
 //		    Display Windows Details             //
 //////////////////////////////////////////////////
@@ -117,7 +131,10 @@ KdPrepareAndConnectDebugPort(const CHAR * PortName,
                              BOOLEAN      PauseAfterConnection);
 
 BOOLEAN
-KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length, BOOLEAN SendEndOfBuffer);
+KdSendPacketToDebuggee(const CHAR * Buffer, UINT32 Length);
+
+BOOLEAN
+KdSendFrameToDebuggee(const CHAR * Packet, UINT32 PacketLength, const CHAR * Buffer, UINT32 BufferLength);
 
 BOOLEAN
 KdReceivePacketFromDebuggee(CHAR * BufferToSave, UINT32 * LengthReceived);
@@ -125,9 +142,13 @@ KdReceivePacketFromDebuggee(CHAR * BufferToSave, UINT32 * LengthReceived);
 BOOLEAN
 KdReceivePacketFromDebugger(CHAR * BufferToSave, UINT32 * LengthReceived);
 
+#if UseSerialFraming == FALSE
+
 BOOLEAN
 KdCheckForTheEndOfTheBuffer(PUINT32 CurrentLoopIndex, BYTE * Buffer);
 
+#endif // UseSerialFraming == FALSE
+
 BOOLEAN
 KdSendSwitchCorePacketToDebuggee(UINT32 NewCore);
 
@@ -167,6 +188,17 @@ KdSendWriteRegisterPacketToDebuggee(PDEBUGGEE_REGISTER_WRITE_DESCRIPTION RegDes)
 BOOLEAN
 KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, UINT32 RequestSize);
 
+BOOLEAN
+KdReadMemoryPagesFromDebuggee(PVOID    Context,
+                              UINT64   AddressSpace,
+                              UINT64   Address,
+                              UINT32   PageCount,
+                              UINT8 *  Buffer,
+                              UINT32 * Attributes);
+
+BOOLEAN
+KdReadMemoryWithCache(PDEBUGGER_READ_MEMORY ReadMem, BYTE * Buffer);
+
 BOOLEAN
 KdSendEditMemoryPacketToDebuggee(PDEBUGGER_EDIT_MEMORY EditMem, UINT32 Size);
 
@@ -226,6 +258,9 @@ KdSendSearchRequestPacketToDebuggee(UINT64 * SearchRequestBuffer, UINT32 SearchR
 BOOLEAN
 KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType);
 
+BOOLEAN
+KdSendBatchedTrackingPacketToDebuggee(UINT32 StepCount);
+
 BYTE
 KdComputeDataChecksum(PVOID Buffer, UINT32 Length);
 
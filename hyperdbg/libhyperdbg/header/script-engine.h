@@ -73,7 +73,7 @@ ScriptEngineSymbolAbortLoadingWrapper();
 //////////////////////////////////////////////////
 
 VOID
-ScriptEngineWrapperTestParser(const string & Expr);
+ScriptEngineWrapperTestParser(const string & Expr, BOOLEAN UseDecodedInterpreter);
 
 VOID
 ScriptEngineWrapperTestParserForHwdbg(const string & Expr);
@@ -84,6 +84,9 @@ ScriptAutomaticStatementsTestWrapper(const string & Expr, UINT64 ExpectationValu
 PVOID
 ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny);
 
+VOID
+ScriptEngineWrapperOptimizeSymbolBuffer(PVOID SymbolBuffer);
+
 VOID
 PrintSymbolBufferWrapper(PVOID SymbolBuffer);
 
@@ -27,5 +27,8 @@ SteppingStepOver();
 BOOLEAN
 SteppingInstrumentationStepInForTracking();
 
+BOOLEAN
+SteppingInstrumentationStepInForBatchedTracking(UINT32 StepCount);
+
 BOOLEAN
 SteppingStepOverForGu(BOOLEAN LastInstruction);
@@ -51,6 +51,15 @@ SymbolConvertNameOrExprToAddress(const string & TextToConvert, PUINT64 Result);
 BOOLEAN
 SymbolDeleteSymTable();
 
+BOOLEAN
+SymbolFreeSymTable();
+
+VOID
+SymbolReadModulePdbDetails(PMODULE_SYMBOL_DETAIL ModuleDetail);
+
+UINT64
+SymbolGetModuleIdentity(const CHAR * FilePath);
+
 BOOLEAN
 SymbolBuildSymbolTable(PMODULE_SYMBOL_DETAIL * BufferToStoreDetails,
                        PUINT32                 StoredLength,
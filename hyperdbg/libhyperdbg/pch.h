@@ -102,6 +102,7 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include <cctype>
 #include <cstring>
 #include <unordered_set>
+#include <unordered_map>
 #include <regex>
 
 //
@@ -141,6 +142,46 @@ typedef const wchar_t *LPCWCHAR, *PCWCHAR;
 #include "SDK/imports/user/HyperDbgScriptImports.h"
 #include "SDK/imports/user/HyperDbgLibImports.h"
 
+//
+// Batched messages of the kernel
+//
+#include "components/logbatch/header/LogBatch.h"
+
+//
+// Frames of the serial connection
+//
+#include "components/serialframe/header/SerialFrame.h"
+
+//
+// Cache of the memory of the debuggee
+//
+#include "components/pagecache/header/PageCache.h"
+
+//
+// Comparing the tables of the modules (reloading the symbols)
+//
+#include "components/moduletable/header/ModuleTable.h"
+
+//
+// Queues of the output sources (event forwarding)
+//
+#include "components/forwardqueue/header/ForwardQueue.h"
+
+//
+// Binary records of the messages of the events (printf of the scripts)
+//
+#include "components/eventrecord/header/EventRecord.h"
+
+//
+// Binary index of the PCI ID database
+//
+#include "components/pciindex/header/PciIndex.h"
+
+//
+// Records of tracking the 'call' and the 'ret' instructions (used in the '!track' command)
+//
+#include "components/tracktrace/header/TrackTrace.h"
+
 //
 // PCI IDs
 //
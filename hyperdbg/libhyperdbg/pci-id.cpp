@@ -2,7 +2,8 @@
  * @file pci-id.cpp
  * @author Bjrn Ruytenberg (bjorn@bjornweb.nl)
  * @brief Provides runtime access to PCI ID database
- * @details
+ * @details The database is compiled into a binary index (see PciIndex.c) that
+ * is cached next to it, and it's rebuilt if the hash of the database is changed
  * @version 0.12
  * @date 2024-12-04
  *
@@ -11,243 +12,220 @@
  */
 #include "pch.h"
 
-static char * PciIdDatabaseBuffer = NULL;
+/**
+ * @brief The index of the PCI ID database (if it's loaded)
+ *
+ */
+static const VOID * PciIdIndex         = NULL;
+static BOOLEAN      PciIdIndexIsMapped = FALSE;
 
 /**
- * @brief Trims whitespaces in passed string
+ * @brief Get the path of the PCI ID database (next to the executable)
  *
- * @param Str
- * @param MaxLen
- * @return char *
+ * @param Path
+ * @param PathSize
+ * @return VOID
  */
-char *
-TrimWhitespace(char * Str, UINT8 MaxLen)
+static VOID
+GetPciIdDatabasePath(char * Path, DWORD PathSize)
 {
-    char * End;
-    while (*Str == ' ')
-        Str++; // Trim leading space
-    if (*Str == '\0')
-        return Str;
-    End = Str + strnlen_s(Str, MaxLen) - 1;
-    while (End > Str && (*End == ' ' || *End == '\n' || *End == '\r'))
-        End--;
-    *(End + 1) = '\0';
-    return Str;
+    HMODULE hModule = GetModuleHandle(NULL);
+
+    GetModuleFileName(hModule, Path, PathSize);
+
+    // Extract executable name
+    char * ExecutableName = strrchr(Path, '\\');
+    if (ExecutableName != NULL)
+    {
+        ExecutableName++;
+    }
+    else
+    {
+        ExecutableName = Path;
+    }
+
+    // Swap executable name for PCI_ID_DATABASE_PATH
+    strncpy_s(ExecutableName, PathSize - (ExecutableName - Path), PCI_ID_DATABASE_PATH, _TRUNCATE);
 }
 
 /**
- * @brief Converts passed string to lowercase
+ * @brief Map a file (read-only)
  *
- * @param Str
- * @return char *
+ * @param FilePath
+ * @param FileSize
+ * @return const VOID * NULL if the file is not mapped
  */
-char *
-ToLower(char * Str)
+static const VOID *
+PciIdMapFile(const char * FilePath, UINT64 * FileSize)
 {
-    UINT8  StrLength   = (UINT8)strnlen_s(Str, PCI_ID_AS_STR_LENGTH);
-    char * CurrentChar = Str;
+    HANDLE        FileHandle;
+    HANDLE        MappingHandle;
+    LARGE_INTEGER Size;
+    const VOID *  View = NULL;
+
+    FileHandle = CreateFileA(FilePath,
+                             GENERIC_READ,
+                             FILE_SHARE_READ | FILE_SHARE_DELETE,
+                             NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
 
-    while (CurrentChar < Str + StrLength)
+    if (!GetFileSizeEx(FileHandle, &Size) || Size.QuadPart == 0)
     {
-        *CurrentChar = tolower(*CurrentChar);
-        CurrentChar++;
+        CloseHandle(FileHandle);
+        return NULL;
     }
-    return Str;
+
+    MappingHandle = CreateFileMappingA(FileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (MappingHandle != NULL)
+    {
+        //
+        // The view remains valid after closing the handles
+        //
+        View = MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(MappingHandle);
+    }
+
+    CloseHandle(FileHandle);
+
+    *FileSize = (UINT64)Size.QuadPart;
+
+    return View;
 }
 
 /**
- * @brief Read line from string. Treats SrcBuffer as a stream (similar to fgets and friends), i.e. updates SrcBuffer by number of characters read.
+ * @brief Save the index next to the database
+ * @details It's not a problem if it's not saved (e.g., the directory of the
+ * database is read-only), an incomplete index file is not valid and it's
+ * rebuilt the next time
  *
- * @param DestBuffer
- * @param CharLimit
- * @param SrcBuffer
- * @return char *
+ * @param IndexPath
+ * @param Index
+ * @param IndexSize
+ * @return VOID
  */
-char *
-ReadLine(char * DestBuffer, UINT64 CharLimit, char ** SrcBuffer)
+static VOID
+PciIdSaveIndex(const char * IndexPath, const VOID * Index, UINT32 IndexSize)
 {
-    char * Line = strchr(*SrcBuffer, '\n');
-    if (!Line)
+    HANDLE FileHandle;
+    DWORD  WrittenBytes = 0;
+
+    FileHandle = CreateFileA(IndexPath,
+                             GENERIC_WRITE,
+                             0,
+                             NULL,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
     {
-        return NULL;
+        return;
     }
-    else
+
+    if (!WriteFile(FileHandle, Index, IndexSize, &WrittenBytes, NULL) || WrittenBytes != IndexSize)
     {
-        strncpy_s(DestBuffer, CharLimit, *SrcBuffer, (Line - *SrcBuffer));
-        *SrcBuffer += (Line - *SrcBuffer + 1);
-        return *SrcBuffer;
+        CloseHandle(FileHandle);
+        DeleteFileA(IndexPath);
+        return;
     }
+
+    CloseHandle(FileHandle);
 }
 
 /**
- * @brief Get Vendor by PCI ID, encoded in ASCII. Do not call directly - use GetVendorById() instead.
+ * @brief Load the index of the PCI ID database
+ * @details The cached index file is used if it's built from the same
+ * database (by its hash), otherwise the index is built and cached
  *
- * @param Filename
- * @param VendorId
- * @return Vendor *
+ * @return const VOID * NULL if the database is not loaded
  */
-Vendor *
-GetVendorByIdStr(const char * Filename, const char * VendorId)
+static const VOID *
+LoadPciIdIndex()
 {
-    Vendor *    MatchedVendor = NULL;
-    BOOLEAN     FoundVendorId = FALSE;
-    Device *    LastDevice    = NULL;
-    SubDevice * LastSubDevice = NULL;
-    char *      PciIdDbBufPtr = NULL;
-    char        Line[1024]    = {'\0'};
-
-    if (!PciIdDatabaseBuffer)
+    char         DatabasePath[MAX_PATH] = {0};
+    const VOID * Text;
+    const VOID * Index;
+    VOID *       BuiltIndex = NULL;
+    UINT64       TextSize   = 0;
+    UINT64       IndexSize  = 0;
+    UINT64       TextHash;
+    UINT32       BuiltIndexSize;
+    std::string  IndexPath;
+
+    if (PciIdIndex != NULL)
     {
-        FILE * f      = fopen(Filename, "rb");
-        size_t Length = 0;
+        return PciIdIndex;
+    }
 
-        if (f == NULL)
-        {
-            ShowMessages("Error: Cannot open file '%s': error %d\n", Filename, errno);
-            return NULL;
-        }
+    GetPciIdDatabasePath(DatabasePath, sizeof(DatabasePath));
 
-        fseek(f, 0, SEEK_END);
-        Length = ftell(f);
+    IndexPath = DatabasePath;
+    IndexPath += PCI_INDEX_FILE_EXTENSION;
 
-        PciIdDatabaseBuffer = (char *)malloc(Length);
-        if (!PciIdDatabaseBuffer)
-        {
-            return NULL;
-        }
+    Text = PciIdMapFile(DatabasePath, &TextSize);
 
-        fseek(f, 0, SEEK_SET);
-        fread(PciIdDatabaseBuffer, 1, Length, f);
-        fclose(f);
+    if (Text == NULL)
+    {
+        ShowMessages("Error: Cannot open file '%s': error %d\n", DatabasePath, GetLastError());
+        return NULL;
     }
 
-    PciIdDbBufPtr = PciIdDatabaseBuffer;
+    TextHash = PciIndexHashText((const CHAR *)Text, TextSize);
 
-    while (ReadLine(Line, sizeof(Line), &PciIdDbBufPtr) != NULL)
-    {
-        char FormatStr[24];
-
-        // Skip comments and empty lines
-        if (Line[0] == '#' || Line[0] == '\0')
-        {
-            continue;
-        }
+    //
+    // Use the cached index (if it's built from this database)
+    //
+    Index = PciIdMapFile(IndexPath.c_str(), &IndexSize);
 
-        // Find vendor
-        // We assume PCI ID database comprises unique entries only, i.e. we return the first matching entry
-        if (Line[0] != '\t' && FoundVendorId == FALSE)
+    if (Index != NULL)
+    {
+        if (PciIndexValidate(Index, IndexSize, TextHash, TextSize))
         {
-            char VendorBuf[PCI_ID_AS_STR_LENGTH + 1], VendorNameBuf[PCI_NAME_STR_LENGTH + 1];
+            UnmapViewOfFile(Text);
 
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line, FormatStr, VendorBuf, VendorNameBuf) == 2)
-            {
-                if (strncmp(VendorBuf, VendorId, sizeof(VendorId)) == 0)
-                {
-                    MatchedVendor = (Vendor *)malloc(sizeof(Vendor));
-                    if (!MatchedVendor)
-                    {
-                        return NULL;
-                    }
-
-                    int result = sscanf(VendorBuf, "%hx", &(MatchedVendor->VendorId));
-                    if (result != 1)
-                    {
-                        return NULL;
-                    }
-                    strncpy_s(MatchedVendor->VendorName, sizeof(MatchedVendor->VendorName), TrimWhitespace(VendorNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                    FoundVendorId = TRUE;
-                }
-            }
+            PciIdIndex         = Index;
+            PciIdIndexIsMapped = TRUE;
+            return PciIdIndex;
         }
-        // Get all devices for vendor
-        else if (Line[0] == '\t' && Line[1] != '\t' && FoundVendorId == TRUE)
-        {
-            char DeviceBuf[PCI_ID_AS_STR_LENGTH + 1], DeviceNameBuf[PCI_NAME_STR_LENGTH + 1];
 
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line + 1, FormatStr, DeviceBuf, DeviceNameBuf) == 2)
-            {
-                Device * NewDevice = (Device *)malloc(sizeof(Device));
-                if (!NewDevice)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                int Result = sscanf(DeviceBuf, "%hx", &(NewDevice->DeviceId));
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                strncpy_s(NewDevice->DeviceName, sizeof(NewDevice->DeviceName), TrimWhitespace(DeviceNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                NewDevice->SubDevices = NULL;
-                NewDevice->Next       = NULL;
-
-                if (LastDevice)
-                {
-                    LastDevice->Next = NewDevice;
-                }
-                else
-                {
-                    MatchedVendor->Devices = NewDevice; // First device
-                }
-                LastDevice    = NewDevice;
-                LastSubDevice = NULL;
-            }
-        }
-        // Get all subdevices for device
-        else if (Line[0] == '\t' && Line[1] == '\t' && FoundVendorId == TRUE && LastDevice)
-        {
-            char SubVendorBuf[PCI_ID_AS_STR_LENGTH + 1], SubDeviceBuf[PCI_ID_AS_STR_LENGTH + 1], SubsystemNameBuf[PCI_NAME_STR_LENGTH + 1];
+        UnmapViewOfFile(Index);
+    }
 
-            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%4s %%%d[^\n]", PCI_NAME_STR_LENGTH); // FormatStr = "%4s %4s %PCI_NAME_STR_LENGTH[^\n]"
-            if (sscanf(Line + 2, FormatStr, SubVendorBuf, SubDeviceBuf, SubsystemNameBuf) == 3)
-            {
-                SubDevice * NewSubDevice = (SubDevice *)malloc(sizeof(SubDevice));
-                if (!NewSubDevice)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                int Result = sscanf(SubVendorBuf, "%hx", &NewSubDevice->SubVendorId);
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                Result = sscanf(SubDeviceBuf, "%hx", &NewSubDevice->SubDeviceId);
-                if (Result != 1)
-                {
-                    FreeVendor(MatchedVendor);
-                    return NULL;
-                }
-
-                strncpy_s(NewSubDevice->SubSystemName, sizeof(NewSubDevice->SubSystemName), TrimWhitespace(SubsystemNameBuf, PCI_NAME_STR_LENGTH), _TRUNCATE);
-                NewSubDevice->Next = NULL;
-
-                if (LastSubDevice)
-                {
-                    LastSubDevice->Next = NewSubDevice;
-                }
-                else
-                {
-                    LastDevice->SubDevices = NewSubDevice; // First subdevice
-                }
-                LastSubDevice = NewSubDevice;
-            }
-        }
-        else if (Line[0] != '\t' && FoundVendorId == TRUE) // We hit the next vendor entry, so we're done parsing
+    //
+    // Build the index and cache it
+    //
+    if (PciIndexGetRequiredSize((const CHAR *)Text, TextSize, &BuiltIndexSize))
+    {
+        BuiltIndex = malloc(BuiltIndexSize);
+
+        if (BuiltIndex != NULL && !PciIndexBuild((const CHAR *)Text, TextSize, BuiltIndex, BuiltIndexSize))
         {
-            break;
+            free(BuiltIndex);
+            BuiltIndex = NULL;
         }
     }
 
-    return MatchedVendor;
+    UnmapViewOfFile(Text);
+
+    if (BuiltIndex == NULL)
+    {
+        ShowMessages("Error: Cannot build the index of '%s'\n", DatabasePath);
+        return NULL;
+    }
+
+    PciIdSaveIndex(IndexPath.c_str(), BuiltIndex, ((PPCI_INDEX_HEADER)BuiltIndex)->TotalSize);
+
+    PciIdIndex         = BuiltIndex;
+    PciIdIndexIsMapped = FALSE;
+    return PciIdIndex;
 }
 
 /**
@@ -278,25 +256,84 @@ FreeVendor(Vendor * VendorToFree)
         free(CurrentDevice);
         CurrentDevice = NextDevice;
     }
+
+    free(VendorToFree);
 }
 
 /**
- * @brief Frees PciIdDatabaseBuffer
+ * @brief Frees the index of the PCI ID database
  * @return void
  */
 void
 FreePciIdDatabase()
 {
-    if (PciIdDatabaseBuffer != NULL)
+    if (PciIdIndex != NULL)
+    {
+        if (PciIdIndexIsMapped)
+        {
+            UnmapViewOfFile(PciIdIndex);
+        }
+        else
+        {
+            free((VOID *)PciIdIndex);
+        }
+
+        PciIdIndex = NULL;
+    }
+}
+
+/**
+ * @brief Returns the name of a vendor
+ * @details First call will initialize database - call FreePciIdDatabase() once
+ * done querying
+ *
+ * @param VendorId
+ * @return const char * NULL if the vendor is not found
+ */
+const char *
+GetVendorNameById(UINT16 VendorId)
+{
+    const VOID *             Index = LoadPciIdIndex();
+    const PCI_INDEX_VENDOR * IndexVendor;
+
+    if (Index == NULL || (IndexVendor = PciIndexFindVendor(Index, VendorId)) == NULL)
+    {
+        return NULL;
+    }
+
+    return PciIndexGetName(Index, IndexVendor->NameOffset);
+}
+
+/**
+ * @brief Returns the name of a device of a vendor
+ * @details First call will initialize database - call FreePciIdDatabase() once
+ * done querying
+ *
+ * @param VendorId
+ * @param DeviceId
+ * @return const char * NULL if the device is not found
+ */
+const char *
+GetDeviceNameById(UINT16 VendorId, UINT16 DeviceId)
+{
+    const VOID *             Index = LoadPciIdIndex();
+    const PCI_INDEX_VENDOR * IndexVendor;
+    const PCI_INDEX_DEVICE * IndexDevice;
+
+    if (Index == NULL ||
+        (IndexVendor = PciIndexFindVendor(Index, VendorId)) == NULL ||
+        (IndexDevice = PciIndexFindDevice(Index, IndexVendor, DeviceId)) == NULL)
     {
-        free(PciIdDatabaseBuffer);
-        PciIdDatabaseBuffer = NULL;
+        return NULL;
     }
+
+    return PciIndexGetName(Index, IndexDevice->NameOffset);
 }
 
 /**
  * @brief Returns Vendor entry, including corresponding devices and subdevices
- * @details Use FreeVendor() on returned Vendor pointer after usage. First call will initialize database - call FreeDatabase() once done querying.
+ * @details Use FreeVendor() on returned Vendor pointer after usage. First call will initialize database - call FreePciIdDatabase() once done querying.
+ * For the names of the devices, GetVendorNameById() and GetDeviceNameById() don't copy the vendor
  *
  * @param VendorId
  * @return Vendor
@@ -304,28 +341,81 @@ FreePciIdDatabase()
 Vendor *
 GetVendorById(UINT16 VendorId)
 {
-    char    VendorIdAsStr[5];
-    char    ExecutablePath[MAX_PATH];
-    HMODULE hModule = GetModuleHandle(NULL);
-
-    snprintf(VendorIdAsStr, sizeof(VendorIdAsStr), "%04X", VendorId);
-    GetModuleFileName(hModule, ExecutablePath, sizeof(ExecutablePath));
-
-    // Extract executable name
-    char * ExecutableName = strrchr(ExecutablePath, '\\');
-    if (ExecutableName != NULL)
+    const VOID *                Index = LoadPciIdIndex();
+    const PCI_INDEX_VENDOR *    IndexVendor;
+    const PCI_INDEX_DEVICE *    IndexDevices;
+    const PCI_INDEX_SUBDEVICE * IndexSubDevices;
+    Vendor *                    MatchedVendor;
+    Device *                    LastDevice = NULL;
+    SubDevice *                 LastSubDevice;
+
+    if (Index == NULL || (IndexVendor = PciIndexFindVendor(Index, VendorId)) == NULL)
     {
-        ExecutableName++;
+        return NULL;
     }
-    else
+
+    MatchedVendor = (Vendor *)calloc(1, sizeof(Vendor));
+    if (!MatchedVendor)
     {
-        ExecutableName = ExecutablePath;
+        return NULL;
     }
 
-    // Swap executable name for PCI_ID_DATABASE_PATH
-    strncpy(ExecutableName, PCI_ID_DATABASE_PATH, sizeof(PCI_ID_DATABASE_PATH));
+    MatchedVendor->VendorId = IndexVendor->VendorId;
+    strncpy_s(MatchedVendor->VendorName, sizeof(MatchedVendor->VendorName), PciIndexGetName(Index, IndexVendor->NameOffset), _TRUNCATE);
+
+    IndexDevices = PciIndexGetDevices(Index, IndexVendor);
+
+    for (UINT32 i = 0; i < IndexVendor->DeviceCount; i++)
+    {
+        Device * NewDevice = (Device *)calloc(1, sizeof(Device));
+        if (!NewDevice)
+        {
+            FreeVendor(MatchedVendor);
+            return NULL;
+        }
+
+        NewDevice->DeviceId = IndexDevices[i].DeviceId;
+        strncpy_s(NewDevice->DeviceName, sizeof(NewDevice->DeviceName), PciIndexGetName(Index, IndexDevices[i].NameOffset), _TRUNCATE);
+
+        if (LastDevice)
+        {
+            LastDevice->Next = NewDevice;
+        }
+        else
+        {
+            MatchedVendor->Devices = NewDevice; // First device
+        }
+        LastDevice = NewDevice;
+
+        IndexSubDevices = PciIndexGetSubDevices(Index, &IndexDevices[i]);
+        LastSubDevice   = NULL;
+
+        for (UINT32 j = 0; j < IndexDevices[i].SubDeviceCount; j++)
+        {
+            SubDevice * NewSubDevice = (SubDevice *)calloc(1, sizeof(SubDevice));
+            if (!NewSubDevice)
+            {
+                FreeVendor(MatchedVendor);
+                return NULL;
+            }
+
+            NewSubDevice->SubVendorId = IndexSubDevices[j].SubVendorId;
+            NewSubDevice->SubDeviceId = IndexSubDevices[j].SubDeviceId;
+            strncpy_s(NewSubDevice->SubSystemName, sizeof(NewSubDevice->SubSystemName), PciIndexGetName(Index, IndexSubDevices[j].NameOffset), _TRUNCATE);
 
-    return GetVendorByIdStr(ExecutablePath, ToLower(VendorIdAsStr));
+            if (LastSubDevice)
+            {
+                LastSubDevice->Next = NewSubDevice;
+            }
+            else
+            {
+                NewDevice->SubDevices = NewSubDevice; // First subdevice
+            }
+            LastSubDevice = NewSubDevice;
+        }
+    }
+
+    return MatchedVendor;
 }
 
 /**
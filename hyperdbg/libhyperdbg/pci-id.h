@@ -46,6 +46,10 @@ typedef struct Vendor
 //////////////////////////////////////////////////
 //					  Functions                 //
 //////////////////////////////////////////////////
+const char *
+GetVendorNameById(UINT16 VendorId);
+const char *
+GetDeviceNameById(UINT16 VendorId, UINT16 DeviceId);
 Vendor *
 GetVendorById(UINT16 VendorId);
 void
@@ -165,20 +165,11 @@ CommandPcicam(vector<CommandToken> CommandTokens, string Command)
 
             if (!PcidevinfoPacket.PrintRaw)
             {
-                Vendor * CurrentVendor     = GetVendorById(PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.VendorId);
-                CHAR *   CurrentVendorName = (CHAR *)"N/A";
-                CHAR *   CurrentDeviceName = (CHAR *)"N/A";
+                const char * CurrentVendorName = GetVendorNameById(PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.VendorId);
+                const char * CurrentDeviceName = GetDeviceNameById(PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.VendorId, PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
 
-                if (CurrentVendor != NULL)
-                {
-                    CurrentVendorName      = CurrentVendor->VendorName;
-                    Device * CurrentDevice = GetDeviceFromVendor(CurrentVendor, PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.DeviceId);
-
-                    if (CurrentDevice != NULL)
-                    {
-                        CurrentDeviceName = CurrentDevice->DeviceName;
-                    }
-                }
+                CurrentVendorName = CurrentVendorName != NULL ? CurrentVendorName : "N/A";
+                CurrentDeviceName = CurrentDeviceName != NULL ? CurrentDeviceName : "N/A";
 
                 ShowMessages("\nCommon Header:\nVID:DID: %04x:%04x\nVendor Name: %-17.*s\nDevice Name: %.*s\nCommand: %04x\n",
                              PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.VendorId,
@@ -206,7 +197,6 @@ CommandPcicam(vector<CommandToken> CommandTokens, string Command)
                              PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.HeaderType,
                              (PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.HeaderType & 0x1) ? "True" : "False",
                              PcidevinfoPacket.DeviceInfo.ConfigSpace.CommonHeader.Bist);
-                FreeVendor(CurrentVendor);
                 FreePciIdDatabase();
 
                 ShowMessages("\nDevice Header:\n");
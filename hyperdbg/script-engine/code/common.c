@@ -11,8 +11,156 @@
  */
 #include "pch.h"
 
+/**
+ * @brief The arena of the current compilation
+ */
+static SCRIPT_ENGINE_ARENA CompilationArena;
+
+/**
+ * @brief Allocates a zeroed buffer from the compilation arena or from the
+ * heap if the arena is not active
+ *
+ * @param Size
+ * @return void *
+ */
+void *
+ArenaAllocate(unsigned long long Size)
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Chunk      = CompilationArena.Head;
+    unsigned long long         HeaderSize = SCRIPT_ENGINE_ARENA_ALIGN(sizeof(SCRIPT_ENGINE_ARENA_CHUNK));
+    void *                     Buffer;
+
+    if (!CompilationArena.IsActive)
+    {
+        return calloc(1, Size);
+    }
+
+    Size = SCRIPT_ENGINE_ARENA_ALIGN(Size);
+
+    if (Chunk == NULL || Chunk->Used + Size > Chunk->Size)
+    {
+        //
+        // The current chunk is full, allocate a new chunk that is twice
+        // as large as the previous one (or large enough for this buffer)
+        //
+        unsigned long long ChunkSize = Chunk ? Chunk->Size * 2 : SCRIPT_ENGINE_ARENA_CHUNK_SIZE;
+
+        if (ChunkSize < HeaderSize + Size)
+        {
+            ChunkSize = HeaderSize + Size;
+        }
+
+        PSCRIPT_ENGINE_ARENA_CHUNK NewChunk = (PSCRIPT_ENGINE_ARENA_CHUNK)malloc(ChunkSize);
+
+        if (NewChunk == NULL)
+        {
+            //
+            // There was an error allocating buffer
+            //
+            return NULL;
+        }
+
+        NewChunk->Next        = Chunk;
+        NewChunk->Size        = ChunkSize;
+        NewChunk->Used        = HeaderSize;
+        CompilationArena.Head = NewChunk;
+        Chunk                 = NewChunk;
+    }
+
+    Buffer = (char *)Chunk + Chunk->Used;
+    Chunk->Used += Size;
+
+    CompilationArena.AllocationCount++;
+    CompilationArena.AllocatedBytes += Size;
+
+    memset(Buffer, 0, Size);
+    return Buffer;
+}
+
+/**
+ * @brief Frees a buffer allocated by ArenaAllocate
+ * @details buffers of the arena are released by ArenaReset, so only
+ * the buffers that are allocated from the heap are freed here
+ *
+ * @param Buffer
+ */
+void
+ArenaFree(void * Buffer)
+{
+    for (PSCRIPT_ENGINE_ARENA_CHUNK Chunk = CompilationArena.Head; Chunk != NULL; Chunk = Chunk->Next)
+    {
+        if ((char *)Buffer >= (char *)Chunk && (char *)Buffer < (char *)Chunk + Chunk->Size)
+        {
+            return;
+        }
+    }
+
+    free(Buffer);
+}
+
+/**
+ * @brief Activates or deactivates the compilation arena
+ * @details objects that outlive the compilation (e.g., global ids) should
+ * be allocated while the arena is not active
+ *
+ * @param IsActive
+ * @return char previous state of the arena
+ */
+char
+ArenaSetActive(char IsActive)
+{
+    char PreviousState        = CompilationArena.IsActive;
+    CompilationArena.IsActive = IsActive;
+    return PreviousState;
+}
+
+/**
+ * @brief Releases all of the buffers of the compilation arena and
+ * deactivates it
+ * @details the largest chunk is kept for the next compilation
+ */
+void
+ArenaReset(void)
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Chunk = CompilationArena.Head;
+
+    if (Chunk != NULL)
+    {
+        //
+        // The head is the largest chunk, free the others
+        //
+        PSCRIPT_ENGINE_ARENA_CHUNK Next = Chunk->Next;
+
+        while (Next != NULL)
+        {
+            PSCRIPT_ENGINE_ARENA_CHUNK Temp = Next;
+            Next                            = Next->Next;
+            free(Temp);
+        }
+
+        Chunk->Next = NULL;
+        Chunk->Used = SCRIPT_ENGINE_ARENA_ALIGN(sizeof(SCRIPT_ENGINE_ARENA_CHUNK));
+    }
+
+    CompilationArena.IsActive        = 0;
+    CompilationArena.AllocationCount = 0;
+    CompilationArena.AllocatedBytes  = 0;
+}
+
+/**
+ * @brief Returns the state (and statistics) of the compilation arena
+ *
+ * @return PSCRIPT_ENGINE_ARENA
+ */
+PSCRIPT_ENGINE_ARENA
+ArenaGetState(void)
+{
+    return &CompilationArena;
+}
+
 /**
  * @brief Allocates a new token
+ * @details the value of the token is stored inline, right after the token
  *
  * @return Token
  */
@@ -24,7 +172,7 @@ NewUnknownToken()
     //
     // Allocate memory for token and its value
     //
-    Token = (PTOKEN)malloc(sizeof(TOKEN));
+    Token = (PTOKEN)ArenaAllocate(sizeof(TOKEN) + TOKEN_VALUE_MAX_LEN + 1);
 
     if (Token == NULL)
     {
@@ -34,21 +182,10 @@ NewUnknownToken()
         return NULL;
     }
 
-    Token->Value = (char *)calloc(TOKEN_VALUE_MAX_LEN + 1, sizeof(char));
-
-    if (Token->Value == NULL)
-    {
-        //
-        // There was an error allocating buffer
-        //
-        free(Token);
-        return NULL;
-    }
-
     //
     // Init fields
     //
-    strcpy(Token->Value, "");
+    Token->Value        = (char *)(Token + 1);
     Token->Type         = UNKNOWN;
     Token->Len          = 0;
     Token->MaxLen       = TOKEN_VALUE_MAX_LEN;
@@ -61,9 +198,10 @@ PTOKEN
 NewToken(TOKEN_TYPE Type, char * Value)
 {
     //
-    // Allocate memory for token]
+    // Allocate memory for token and its value
     //
-    PTOKEN Token = (PTOKEN)malloc(sizeof(TOKEN));
+    unsigned int Len   = (unsigned int)strlen(Value);
+    PTOKEN       Token = (PTOKEN)ArenaAllocate(sizeof(TOKEN) + Len + 1);
 
     if (Token == NULL)
     {
@@ -76,22 +214,12 @@ NewToken(TOKEN_TYPE Type, char * Value)
     //
     // Init fields
     //
-    unsigned int Len    = (unsigned int)strlen(Value);
     Token->Type         = Type;
     Token->Len          = Len;
     Token->MaxLen       = Len;
-    Token->Value        = (char *)calloc(Token->MaxLen + 1, sizeof(char));
+    Token->Value        = (char *)(Token + 1);
     Token->VariableType = 0;
 
-    if (Token->Value == NULL)
-    {
-        //
-        // There was an error allocating buffer
-        //
-        free(Token);
-        return NULL;
-    }
-
     strcpy(Token->Value, Value);
 
     return Token;
@@ -105,8 +233,14 @@ NewToken(TOKEN_TYPE Type, char * Value)
 void
 RemoveToken(PTOKEN * Token)
 {
-    free((*Token)->Value);
-    free(*Token);
+    //
+    // The value is only allocated separately if it's grown
+    //
+    if ((*Token)->Value != (char *)(*Token + 1))
+    {
+        ArenaFree((*Token)->Value);
+    }
+    ArenaFree(*Token);
     *Token = NULL;
     return;
 }
@@ -236,7 +370,7 @@ AppendByte(PTOKEN Token, char c)
         // Double the length of the allocated space for the string
         //
         Token->MaxLen *= 2;
-        char * NewValue = (char *)calloc(Token->MaxLen + 1, sizeof(char));
+        char * NewValue = (char *)ArenaAllocate(Token->MaxLen + 1);
 
         if (NewValue == NULL)
         {
@@ -245,10 +379,13 @@ AppendByte(PTOKEN Token, char c)
         }
 
         //
-        // Free Old buffer and update the pointer
+        // Free Old buffer (if it's not inline) and update the pointer
         //
         memcpy(NewValue, Token->Value, Token->Len);
-        free(Token->Value);
+        if (Token->Value != (char *)(Token + 1))
+        {
+            ArenaFree(Token->Value);
+        }
         Token->Value = NewValue;
     }
 
@@ -277,7 +414,7 @@ AppendWchar(PTOKEN Token, wchar_t c)
         // Double the length of the allocated space for the wstring
         //
         Token->MaxLen *= 2;
-        char * NewValue = (char *)calloc(Token->MaxLen + 2, sizeof(char));
+        char * NewValue = (char *)ArenaAllocate(Token->MaxLen + 2);
 
         if (NewValue == NULL)
         {
@@ -286,10 +423,13 @@ AppendWchar(PTOKEN Token, wchar_t c)
         }
 
         //
-        // Free Old buffer and update the pointer
+        // Free Old buffer (if it's not inline) and update the pointer
         //
         memcpy(NewValue, Token->Value, Token->Len);
-        free(Token->Value);
+        if (Token->Value != (char *)(Token + 1))
+        {
+            ArenaFree(Token->Value);
+        }
         Token->Value = NewValue;
     }
 
@@ -308,7 +448,7 @@ AppendWchar(PTOKEN Token, wchar_t c)
 PTOKEN
 CopyToken(PTOKEN Token)
 {
-    PTOKEN TokenCopy = (PTOKEN)malloc(sizeof(TOKEN));
+    PTOKEN TokenCopy = (PTOKEN)ArenaAllocate(sizeof(TOKEN) + strlen(Token->Value) + 1);
 
     if (TokenCopy == NULL)
     {
@@ -321,18 +461,9 @@ CopyToken(PTOKEN Token)
     TokenCopy->Type         = Token->Type;
     TokenCopy->MaxLen       = Token->MaxLen;
     TokenCopy->Len          = Token->Len;
-    TokenCopy->Value        = (char *)calloc(strlen(Token->Value) + 1, sizeof(char));
+    TokenCopy->Value        = (char *)(TokenCopy + 1);
     TokenCopy->VariableType = Token->VariableType;
 
-    if (TokenCopy->Value == NULL)
-    {
-        //
-        // There was an error allocating buffer
-        //
-        free(TokenCopy);
-        return NULL;
-    }
-
     strcpy(TokenCopy->Value, Token->Value);
 
     return TokenCopy;
@@ -351,7 +482,7 @@ NewTokenList(void)
     //
     // Allocation of memory for TOKEN_LIST structure
     //
-    TokenList = (PTOKEN_LIST)malloc(sizeof(*TokenList));
+    TokenList = (PTOKEN_LIST)ArenaAllocate(sizeof(*TokenList));
 
     if (TokenList == NULL)
     {
@@ -370,7 +501,7 @@ NewTokenList(void)
     //
     // Allocation of memory for TOKEN_LIST buffer
     //
-    TokenList->Head = (PTOKEN *)malloc(TokenList->Size * sizeof(PTOKEN));
+    TokenList->Head = (PTOKEN *)ArenaAllocate(TokenList->Size * sizeof(PTOKEN));
 
     return TokenList;
 }
@@ -389,8 +520,8 @@ RemoveTokenList(PTOKEN_LIST TokenList)
         Token = *(TokenList->Head + i);
         RemoveToken(&Token);
     }
-    free(TokenList->Head);
-    free(TokenList);
+    ArenaFree(TokenList->Head);
+    ArenaFree(TokenList);
 
     return;
 }
@@ -446,7 +577,7 @@ Push(PTOKEN_LIST TokenList, PTOKEN Token)
         //
         // Allocate a new buffer for string list with doubled length
         //
-        PTOKEN * NewHead = (PTOKEN *)malloc(2 * TokenList->Size * sizeof(PTOKEN));
+        PTOKEN * NewHead = (PTOKEN *)ArenaAllocate(2 * TokenList->Size * sizeof(PTOKEN));
 
         if (NewHead == NULL)
         {
@@ -462,7 +593,7 @@ Push(PTOKEN_LIST TokenList, PTOKEN Token)
         //
         // Free old buffer
         //
-        free(TokenList->Head);
+        ArenaFree(TokenList->Head);
 
         //
         // Update Head and size of TokenList
@@ -513,6 +644,148 @@ Top(PTOKEN_LIST TokenList)
     return *ReadAddr;
 }
 
+/**
+ * @brief Allocates a new IDENTIFIER_TABLE
+ *
+ * @return PIDENTIFIER_TABLE
+ */
+PIDENTIFIER_TABLE
+NewIdentifierTable(void)
+{
+    PIDENTIFIER_TABLE IdentifierTable = (PIDENTIFIER_TABLE)malloc(sizeof(*IdentifierTable));
+
+    if (IdentifierTable == NULL)
+    {
+        //
+        // There was an error allocating buffer
+        //
+        return NULL;
+    }
+
+    IdentifierTable->Count = 0;
+    IdentifierTable->Size  = IDENTIFIER_TABLE_INIT_SIZE;
+    IdentifierTable->Head  = (PIDENTIFIER_ENTRY)calloc(IdentifierTable->Size, sizeof(IDENTIFIER_ENTRY));
+
+    if (IdentifierTable->Head == NULL)
+    {
+        free(IdentifierTable);
+        return NULL;
+    }
+
+    return IdentifierTable;
+}
+
+/**
+ * @brief Removes an IDENTIFIER_TABLE (the names are not freed)
+ *
+ * @param IdentifierTable
+ */
+void
+RemoveIdentifierTable(PIDENTIFIER_TABLE IdentifierTable)
+{
+    free(IdentifierTable->Head);
+    free(IdentifierTable);
+}
+
+/**
+ * @brief Returns the slot of the name in the identifier table or the
+ * empty slot that the name should be placed in
+ *
+ * @param Head
+ * @param Size
+ * @param Name
+ * @return PIDENTIFIER_ENTRY
+ */
+PIDENTIFIER_ENTRY
+GetIdentifierSlot(PIDENTIFIER_ENTRY Head, unsigned int Size, const char * Name)
+{
+    unsigned int i = PerfectHashString(Name, 0) & (Size - 1);
+
+    while (Head[i].Name != NULL && strcmp(Head[i].Name, Name))
+    {
+        i = (i + 1) & (Size - 1);
+    }
+
+    return &Head[i];
+}
+
+/**
+ * @brief Adds a name to the identifier table, if the name already exists
+ * the previous value is kept
+ *
+ * @param IdentifierTable
+ * @param Name
+ * @param Value
+ * @return char 1 if the name is added, otherwise 0
+ */
+char
+InsertIdentifier(PIDENTIFIER_TABLE IdentifierTable, const char * Name, unsigned long long Value)
+{
+    PIDENTIFIER_ENTRY Entry;
+
+    //
+    // Keep the load factor under 50%
+    //
+    if ((IdentifierTable->Count + 1) * 2 > IdentifierTable->Size)
+    {
+        unsigned int      NewSize = IdentifierTable->Size * 2;
+        PIDENTIFIER_ENTRY NewHead = (PIDENTIFIER_ENTRY)calloc(NewSize, sizeof(IDENTIFIER_ENTRY));
+
+        if (NewHead == NULL)
+        {
+            printf("err, could not allocate buffer");
+            return 0;
+        }
+
+        for (unsigned int i = 0; i < IdentifierTable->Size; i++)
+        {
+            if (IdentifierTable->Head[i].Name != NULL)
+            {
+                *GetIdentifierSlot(NewHead, NewSize, IdentifierTable->Head[i].Name) = IdentifierTable->Head[i];
+            }
+        }
+
+        free(IdentifierTable->Head);
+        IdentifierTable->Head = NewHead;
+        IdentifierTable->Size = NewSize;
+    }
+
+    Entry = GetIdentifierSlot(IdentifierTable->Head, IdentifierTable->Size, Name);
+
+    if (Entry->Name != NULL)
+    {
+        return 0;
+    }
+
+    Entry->Name  = Name;
+    Entry->Value = Value;
+    IdentifierTable->Count++;
+
+    return 1;
+}
+
+/**
+ * @brief Finds the value of a name in the identifier table
+ *
+ * @param IdentifierTable
+ * @param Name
+ * @param Value
+ * @return char 1 if the name is found, otherwise 0
+ */
+char
+FindIdentifier(PIDENTIFIER_TABLE IdentifierTable, const char * Name, unsigned long long * Value)
+{
+    PIDENTIFIER_ENTRY Entry = GetIdentifierSlot(IdentifierTable->Head, IdentifierTable->Size, Name);
+
+    if (Entry->Name == NULL)
+    {
+        return 0;
+    }
+
+    *Value = Entry->Value;
+    return 1;
+}
+
 /**
  * @brief Checks whether input char belongs to hexadecimal digit-set or not
  *
@@ -1034,6 +1307,104 @@ IsSemanticRule(PTOKEN Token)
         return 0;
 }
 
+/**
+ * @brief Hashes a string for the generated perfect hash tables
+ * @details It should be the same as PerfectHashString in hash_table.py
+ *
+ * @param Str
+ * @param Seed
+ * @return unsigned int
+ */
+unsigned int
+PerfectHashString(const char * Str, unsigned int Seed)
+{
+    unsigned int Hash = 0x811c9dc5 ^ Seed;
+
+    while (*Str)
+    {
+        Hash = (Hash ^ (unsigned char)*Str) * 0x01000193;
+        Str++;
+    }
+
+    Hash ^= Hash >> 16;
+    Hash *= 0x7feb352d;
+    Hash ^= Hash >> 15;
+
+    return Hash;
+}
+
+/**
+ * @brief Finds the candidate index of a string in a generated perfect hash table
+ * @details The caller should compare the string with the item of the candidate
+ * index as the strings that are not in the map also return an index
+ *
+ * @param Str
+ * @param Displacements
+ * @param Values
+ * @param TableSize
+ * @return unsigned int
+ */
+unsigned int
+PerfectHashLookup(const char * Str, const int * Displacements, const unsigned short * Values, unsigned int TableSize)
+{
+    int Displacement = Displacements[PerfectHashString(Str, 0) % TableSize];
+
+    if (Displacement < 0)
+    {
+        return Values[-Displacement - 1];
+    }
+
+    return Values[PerfectHashString(Str, Displacement) % TableSize];
+}
+
+/**
+ * @brief Gets the name of the terminal that a token type represents
+ *
+ * @param Token
+ * @param IsLalr
+ * @return const char *
+ */
+const char *
+GetTerminalName(PTOKEN Token, BOOLEAN IsLalr)
+{
+    switch (Token->Type)
+    {
+    case HEX:
+        return "_hex";
+    case GLOBAL_ID:
+    case GLOBAL_UNRESOLVED_ID:
+        return "_global_id";
+    case LOCAL_ID:
+    case LOCAL_UNRESOLVED_ID:
+        return "_local_id";
+    case FUNCTION_ID:
+        return "_function_id";
+    case FUNCTION_PARAMETER_ID:
+        return "_function_parameter_id";
+    case REGISTER:
+        return "_register";
+    case PSEUDO_REGISTER:
+        return "_pseudo_register";
+    case SCRIPT_VARIABLE_TYPE:
+        //
+        // Script variable types are only a terminal in the LL(1) grammar
+        //
+        return IsLalr ? Token->Value : "_script_variable_type";
+    case DECIMAL:
+        return "_decimal";
+    case BINARY:
+        return "_binary";
+    case OCTAL:
+        return "_octal";
+    case STRING:
+        return "_string";
+    case WSTRING:
+        return "_wstring";
+    default: // Keyword
+        return Token->Value;
+    }
+}
+
 /**
  * @brief Gets the Non Terminal Id object
  *
@@ -1043,11 +1414,14 @@ IsSemanticRule(PTOKEN Token)
 int
 GetNonTerminalId(PTOKEN Token)
 {
-    for (int i = 0; i < NONETERMINAL_COUNT; i++)
-    {
-        if (!strcmp(Token->Value, NoneTerminalMap[i]))
-            return i;
-    }
+    unsigned int i = PerfectHashLookup(Token->Value,
+                                       NoneTerminalMapHashDisplacements,
+                                       NoneTerminalMapHashValues,
+                                       NONE_TERMINAL_MAP_HASH_TABLE_SIZE);
+
+    if (!strcmp(Token->Value, NoneTerminalMap[i]))
+        return i;
+
     return INVALID;
 }
 
@@ -1060,103 +1434,15 @@ GetNonTerminalId(PTOKEN Token)
 int
 GetTerminalId(PTOKEN Token)
 {
-    for (int i = 0; i < TERMINAL_COUNT; i++)
-    {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", TerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_ID)
-        {
-            if (!strcmp("_function_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_PARAMETER_ID)
-        {
-            if (!strcmp("_function_parameter_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
-        {
-            if (!strcmp("_pseudo_register", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == SCRIPT_VARIABLE_TYPE)
-        {
-            if (!strcmp("_script_variable_type", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == DECIMAL)
-        {
-            if (!strcmp("_decimal", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == BINARY)
-        {
-            if (!strcmp("_binary", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == OCTAL)
-        {
-            if (!strcmp("_octal", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == STRING)
-        {
-            if (!strcmp("_string", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == WSTRING)
-        {
-            if (!strcmp("_wstring", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else // Keyword
-        {
-            if (!strcmp(Token->Value, TerminalMap[i]))
-                return i;
-        }
-    }
+    const char * Name = GetTerminalName(Token, FALSE);
+    unsigned int i    = PerfectHashLookup(Name,
+                                       TerminalMapHashDisplacements,
+                                       TerminalMapHashValues,
+                                       TERMINAL_MAP_HASH_TABLE_SIZE);
+
+    if (!strcmp(Name, TerminalMap[i]))
+        return i;
+
     return INVALID;
 }
 
@@ -1169,11 +1455,14 @@ GetTerminalId(PTOKEN Token)
 int
 LalrGetNonTerminalId(PTOKEN Token)
 {
-    for (int i = 0; i < LALR_NONTERMINAL_COUNT; i++)
-    {
-        if (!strcmp(Token->Value, LalrNoneTerminalMap[i]))
-            return i;
-    }
+    unsigned int i = PerfectHashLookup(Token->Value,
+                                       LalrNoneTerminalMapHashDisplacements,
+                                       LalrNoneTerminalMapHashValues,
+                                       LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE);
+
+    if (!strcmp(Token->Value, LalrNoneTerminalMap[i]))
+        return i;
+
     return INVALID;
 }
 
@@ -1186,96 +1475,15 @@ LalrGetNonTerminalId(PTOKEN Token)
 int
 LalrGetTerminalId(PTOKEN Token)
 {
-    for (int i = 0; i < LALR_TERMINAL_COUNT; i++)
-    {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", LalrTerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_ID)
-        {
-            if (!strcmp("_function_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == FUNCTION_PARAMETER_ID)
-        {
-            if (!strcmp("_function_parameter_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
-        {
-            if (!strcmp("_pseudo_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == DECIMAL)
-        {
-            if (!strcmp("_decimal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == BINARY)
-        {
-            if (!strcmp("_binary", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == OCTAL)
-        {
-            if (!strcmp("_octal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == STRING)
-        {
-            if (!strcmp("_string", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == WSTRING)
-        {
-            if (!strcmp("_wstring", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else // Keyword
-        {
-            if (!strcmp(Token->Value, LalrTerminalMap[i]))
-                return i;
-        }
-    }
+    const char * Name = GetTerminalName(Token, TRUE);
+    unsigned int i    = PerfectHashLookup(Name,
+                                       LalrTerminalMapHashDisplacements,
+                                       LalrTerminalMapHashValues,
+                                       LALR_TERMINAL_MAP_HASH_TABLE_SIZE);
+
+    if (!strcmp(Name, LalrTerminalMap[i]))
+        return i;
+
     return INVALID;
 }
 
@@ -0,0 +1,1252 @@
+/**
+ * @file optimizer.c
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ *
+ * @details Optimization passes over the generated symbol buffer
+ * @details The code generator emits the three-address code directly into the
+ * symbol buffer, this module runs constant folding, copy propagation,
+ * dead-temp elimination and jump threading over the buffer before it's
+ * sent to the debuggee. Only the temps and the local variables (stack
+ * temps) are tracked, operators that are not known to the optimizer are
+ * treated conservatively (their temp operands are considered as used and
+ * modified)
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Returns the class and the number of operands of an operator
+ *
+ * @param Operator
+ * @param OperandCount
+ * @return OPTIMIZER_OPERATOR_CLASS
+ */
+OPTIMIZER_OPERATOR_CLASS
+OptimizerGetOperatorClass(unsigned long long Operator, unsigned int * OperandCount)
+{
+    switch (Operator)
+    {
+    case FUNC_MOV:
+    case FUNC_NOT:
+    case FUNC_NEG:
+        *OperandCount = 2;
+        return OPTIMIZER_OPERATOR_VALUE;
+
+    case FUNC_ADD:
+    case FUNC_SUB:
+    case FUNC_MUL:
+    case FUNC_DIV:
+    case FUNC_MOD:
+    case FUNC_OR:
+    case FUNC_XOR:
+    case FUNC_AND:
+    case FUNC_ASR:
+    case FUNC_ASL:
+    case FUNC_GT:
+    case FUNC_LT:
+    case FUNC_EGT:
+    case FUNC_ELT:
+    case FUNC_EQUAL:
+    case FUNC_NEQ:
+        *OperandCount = 3;
+        return OPTIMIZER_OPERATOR_VALUE;
+
+    case FUNC_INC:
+    case FUNC_DEC:
+        *OperandCount = 1;
+        return OPTIMIZER_OPERATOR_INC_DEC;
+
+    case FUNC_JMP:
+        *OperandCount = 1;
+        return OPTIMIZER_OPERATOR_JMP;
+
+    case FUNC_JZ:
+    case FUNC_JNZ:
+        *OperandCount = 2;
+        return OPTIMIZER_OPERATOR_CONDITIONAL_JMP;
+
+    case FUNC_CALL:
+        *OperandCount = 1;
+        return OPTIMIZER_OPERATOR_CALL;
+
+    case FUNC_RET:
+        *OperandCount = 0;
+        return OPTIMIZER_OPERATOR_RET;
+
+    case FUNC_PUSH:
+        *OperandCount = 1;
+        return OPTIMIZER_OPERATOR_PUSH;
+
+    case FUNC_POP:
+        *OperandCount = 1;
+        return OPTIMIZER_OPERATOR_POP;
+
+    default:
+        *OperandCount = 0;
+        return OPTIMIZER_OPERATOR_OTHER;
+    }
+}
+
+/**
+ * @brief Computes the result of an operator with constant operands
+ * @details the result should be exactly the same as the result of the
+ * operator in ScriptEngineExecute
+ *
+ * @param Operator
+ * @param Src0
+ * @param Src1
+ * @param Result
+ * @return char
+ */
+char
+OptimizerFold(unsigned long long Operator, unsigned long long Src0, unsigned long long Src1, unsigned long long * Result)
+{
+    switch (Operator)
+    {
+    case FUNC_NOT:
+        *Result = ~Src0;
+        return TRUE;
+    case FUNC_NEG:
+        *Result = (unsigned long long)(-(long long)Src0);
+        return TRUE;
+    case FUNC_ADD:
+        *Result = Src1 + Src0;
+        return TRUE;
+    case FUNC_SUB:
+        *Result = Src1 - Src0;
+        return TRUE;
+    case FUNC_MUL:
+        *Result = Src1 * Src0;
+        return TRUE;
+    case FUNC_DIV:
+
+        //
+        // Division by zero is an error in the runtime, so it's kept
+        //
+        if (Src0 == 0)
+            return FALSE;
+
+        *Result = Src1 / Src0;
+        return TRUE;
+    case FUNC_MOD:
+        if (Src0 == 0)
+            return FALSE;
+
+        *Result = Src1 % Src0;
+        return TRUE;
+    case FUNC_OR:
+        *Result = Src1 | Src0;
+        return TRUE;
+    case FUNC_XOR:
+        *Result = Src1 ^ Src0;
+        return TRUE;
+    case FUNC_AND:
+        *Result = Src1 & Src0;
+        return TRUE;
+    case FUNC_ASR:
+
+        //
+        // Shifting more than the width depends on the processor
+        //
+        if (Src0 >= 64)
+            return FALSE;
+
+        *Result = Src1 >> Src0;
+        return TRUE;
+    case FUNC_ASL:
+        if (Src0 >= 64)
+            return FALSE;
+
+        *Result = Src1 << Src0;
+        return TRUE;
+    case FUNC_GT:
+        *Result = (long long)Src1 > (long long)Src0;
+        return TRUE;
+    case FUNC_LT:
+        *Result = (long long)Src1 < (long long)Src0;
+        return TRUE;
+    case FUNC_EGT:
+        *Result = (long long)Src1 >= (long long)Src0;
+        return TRUE;
+    case FUNC_ELT:
+        *Result = (long long)Src1 <= (long long)Src0;
+        return TRUE;
+    case FUNC_EQUAL:
+        *Result = Src1 == Src0;
+        return TRUE;
+    case FUNC_NEQ:
+        *Result = Src1 != Src0;
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Checks whether the symbol is a temp (or a local variable) with no flags
+ *
+ * @param Symbol
+ * @return char
+ */
+char
+OptimizerIsTemp(PSYMBOL Symbol)
+{
+    return Symbol->Type == SYMBOL_TEMP_TYPE;
+}
+
+/**
+ * @brief Checks whether the symbol is a temp (the flags of the variadic
+ * arguments are ignored)
+ *
+ * @param Symbol
+ * @return char
+ */
+char
+OptimizerIsAnyTemp(PSYMBOL Symbol)
+{
+    return (Symbol->Type & 0x7fffffff) == SYMBOL_TEMP_TYPE;
+}
+
+/**
+ * @brief Returns the number of symbols that are used by an operand
+ *
+ * @param Symbol
+ * @return unsigned int
+ */
+unsigned int
+OptimizerGetOperandSize(PSYMBOL Symbol)
+{
+    if (Symbol->Type == SYMBOL_STRING_TYPE || Symbol->Type == SYMBOL_WSTRING_TYPE)
+    {
+        return GetSymbolHeapSize(Symbol);
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Splits the symbol buffer into instructions and resolves the
+ * targets of the jumps
+ *
+ * @param Context
+ * @return char FALSE if the buffer could not be optimized
+ */
+char
+OptimizerDecode(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL                Head           = Context->CodeBuffer->Head;
+    unsigned int           Pointer        = Context->CodeBuffer->Pointer;
+    unsigned int *         InstructionMap = NULL;
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int           OperandCount;
+    unsigned int           i = 0;
+
+    Context->Instructions = (POPTIMIZER_INSTRUCTION)calloc(Pointer, sizeof(OPTIMIZER_INSTRUCTION));
+    InstructionMap        = (unsigned int *)malloc((Pointer + 1) * sizeof(unsigned int));
+
+    if (Context->Instructions == NULL || InstructionMap == NULL)
+    {
+        free(InstructionMap);
+        return FALSE;
+    }
+
+    memset(InstructionMap, 0xff, (Pointer + 1) * sizeof(unsigned int));
+
+    while (i < Pointer)
+    {
+        //
+        // Each instruction starts with an operator
+        //
+        if (Head[i].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            free(InstructionMap);
+            return FALSE;
+        }
+
+        Instruction         = &Context->Instructions[Context->InstructionCount];
+        Instruction->Offset = i;
+        Instruction->Target = OPTIMIZER_INVALID_INDEX;
+        Instruction->Class  = OptimizerGetOperatorClass(Head[i].Value, &OperandCount);
+
+        InstructionMap[i] = Context->InstructionCount;
+        i++;
+
+        while (i < Pointer && Head[i].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            i += OptimizerGetOperandSize(&Head[i]);
+        }
+
+        if (i > Pointer)
+        {
+            free(InstructionMap);
+            return FALSE;
+        }
+
+        Instruction->Size = i - Instruction->Offset;
+
+        if (Instruction->Class != OPTIMIZER_OPERATOR_OTHER && Instruction->Size != OperandCount + 1)
+        {
+            if (Instruction->Class == OPTIMIZER_OPERATOR_JMP ||
+                Instruction->Class == OPTIMIZER_OPERATOR_CONDITIONAL_JMP ||
+                Instruction->Class == OPTIMIZER_OPERATOR_CALL ||
+                Instruction->Class == OPTIMIZER_OPERATOR_RET)
+            {
+                free(InstructionMap);
+                return FALSE;
+            }
+
+            Instruction->Class = OPTIMIZER_OPERATOR_OTHER;
+        }
+
+        Context->InstructionCount++;
+    }
+
+    InstructionMap[Pointer] = Context->InstructionCount;
+
+    for (unsigned int j = 0; j < Context->InstructionCount; j++)
+    {
+        Instruction = &Context->Instructions[j];
+
+        //
+        // Resolve the targets of the jumps, jumps to computed addresses
+        // are not supported
+        //
+        if (Instruction->Class == OPTIMIZER_OPERATOR_JMP ||
+            Instruction->Class == OPTIMIZER_OPERATOR_CONDITIONAL_JMP ||
+            Instruction->Class == OPTIMIZER_OPERATOR_CALL)
+        {
+            PSYMBOL Target = &Head[Instruction->Offset + 1];
+
+            if (Target->Type != SYMBOL_NUM_TYPE || Target->Value > Pointer ||
+                InstructionMap[Target->Value] == OPTIMIZER_INVALID_INDEX)
+            {
+                free(InstructionMap);
+                return FALSE;
+            }
+
+            Instruction->Target = InstructionMap[Target->Value];
+        }
+
+        //
+        // Find the number of slots
+        //
+        for (unsigned int k = Instruction->Offset + 1; k < Instruction->Offset + Instruction->Size; k += OptimizerGetOperandSize(&Head[k]))
+        {
+            if (OptimizerIsAnyTemp(&Head[k]) && Head[k].Value >= Context->SlotCount)
+            {
+                if (Head[k].Value >= OPTIMIZER_MAX_SLOT_COUNT)
+                {
+                    free(InstructionMap);
+                    return FALSE;
+                }
+                Context->SlotCount = (unsigned int)Head[k].Value + 1;
+            }
+        }
+    }
+
+    free(InstructionMap);
+
+    Context->Blocks       = (POPTIMIZER_BLOCK)calloc(Context->InstructionCount + 1, sizeof(OPTIMIZER_BLOCK));
+    Context->AddressTaken = (char *)calloc(Context->SlotCount + 1, sizeof(char));
+    Context->SlotStates   = (POPTIMIZER_SLOT_STATE)calloc(Context->SlotCount + 1, sizeof(OPTIMIZER_SLOT_STATE));
+    Context->SlotVersions = (unsigned long long *)calloc(Context->SlotCount + 1, sizeof(unsigned long long));
+    Context->NewOffsets   = (unsigned int *)calloc(Context->InstructionCount + 1, sizeof(unsigned int));
+
+    if (Context->Blocks == NULL || Context->AddressTaken == NULL || Context->SlotStates == NULL ||
+        Context->SlotVersions == NULL || Context->NewOffsets == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // The slots that their address is taken could be modified through
+    // the memory, so they are not optimized
+    //
+    for (unsigned int j = 0; j < Context->InstructionCount; j++)
+    {
+        Instruction = &Context->Instructions[j];
+
+        if (Head[Instruction->Offset].Value != FUNC_REFERENCE)
+        {
+            continue;
+        }
+
+        for (unsigned int k = Instruction->Offset + 1; k < Instruction->Offset + Instruction->Size; k += OptimizerGetOperandSize(&Head[k]))
+        {
+            if (OptimizerIsAnyTemp(&Head[k]))
+            {
+                Context->AddressTaken[Head[k].Value] = TRUE;
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Returns the first instruction (at or after the index) that is not removed
+ *
+ * @param Context
+ * @param Index
+ * @return unsigned int InstructionCount if there is no instruction after the index
+ */
+unsigned int
+OptimizerResolve(POPTIMIZER_CONTEXT Context, unsigned int Index)
+{
+    while (Index < Context->InstructionCount && Context->Instructions[Index].IsRemoved)
+    {
+        Index++;
+    }
+
+    return Index;
+}
+
+/**
+ * @brief Returns the block of an instruction
+ *
+ * @param Context
+ * @param Index
+ * @return unsigned int
+ */
+unsigned int
+OptimizerGetBlock(POPTIMIZER_CONTEXT Context, unsigned int Index)
+{
+    Index = OptimizerResolve(Context, Index);
+
+    if (Index >= Context->InstructionCount)
+    {
+        return OPTIMIZER_INVALID_INDEX;
+    }
+
+    return Context->Instructions[Index].Block;
+}
+
+/**
+ * @brief Splits the instructions (that are not removed) into basic blocks
+ *
+ * @param Context
+ * @return char
+ */
+char
+OptimizerBuildBlocks(POPTIMIZER_CONTEXT Context)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    char *                 IsLeader = (char *)calloc(Context->InstructionCount + 1, sizeof(char));
+
+    if (IsLeader == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Targets of the jumps and the instructions after them are leaders
+    //
+    IsLeader[OptimizerResolve(Context, 0)] = TRUE;
+
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        Instruction = &Context->Instructions[i];
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        if (Instruction->Target != OPTIMIZER_INVALID_INDEX)
+        {
+            IsLeader[OptimizerResolve(Context, Instruction->Target)] = TRUE;
+        }
+
+        if (Instruction->Class == OPTIMIZER_OPERATOR_JMP ||
+            Instruction->Class == OPTIMIZER_OPERATOR_CONDITIONAL_JMP ||
+            Instruction->Class == OPTIMIZER_OPERATOR_CALL ||
+            Instruction->Class == OPTIMIZER_OPERATOR_RET)
+        {
+            IsLeader[OptimizerResolve(Context, i + 1)] = TRUE;
+        }
+    }
+
+    Context->BlockCount = 0;
+
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        if (Context->Instructions[i].IsRemoved)
+        {
+            continue;
+        }
+
+        if (IsLeader[i])
+        {
+            Context->Blocks[Context->BlockCount].First = i;
+            Context->BlockCount++;
+        }
+
+        Context->Instructions[i].Block                 = Context->BlockCount - 1;
+        Context->Blocks[Context->BlockCount - 1].Last = i;
+    }
+
+    free(IsLeader);
+
+    //
+    // Find the successors of the blocks
+    //
+    for (unsigned int i = 0; i < Context->BlockCount; i++)
+    {
+        POPTIMIZER_BLOCK Block = &Context->Blocks[i];
+        Instruction            = &Context->Instructions[Block->Last];
+
+        Block->Successors[0] = OPTIMIZER_INVALID_INDEX;
+        Block->Successors[1] = OPTIMIZER_INVALID_INDEX;
+
+        switch (Instruction->Class)
+        {
+        case OPTIMIZER_OPERATOR_JMP:
+            Block->Successors[0] = OptimizerGetBlock(Context, Instruction->Target);
+            break;
+
+        case OPTIMIZER_OPERATOR_CONDITIONAL_JMP:
+        case OPTIMIZER_OPERATOR_CALL:
+            Block->Successors[0] = OptimizerGetBlock(Context, Instruction->Target);
+            Block->Successors[1] = OptimizerGetBlock(Context, Block->Last + 1);
+            break;
+
+        case OPTIMIZER_OPERATOR_RET:
+            break;
+
+        default:
+            Block->Successors[0] = OptimizerGetBlock(Context, Block->Last + 1);
+            break;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Replaces a temp operand with its known constant or its copy source
+ *
+ * @param Context
+ * @param Symbol
+ * @return char TRUE if the operand is changed
+ */
+char
+OptimizerReplaceOperand(POPTIMIZER_CONTEXT Context, PSYMBOL Symbol)
+{
+    POPTIMIZER_SLOT_STATE State;
+
+    if (!OptimizerIsTemp(Symbol) || Context->AddressTaken[Symbol->Value])
+    {
+        return FALSE;
+    }
+
+    State = &Context->SlotStates[Symbol->Value];
+
+    if (State->Epoch != Context->Epoch)
+    {
+        return FALSE;
+    }
+
+    if (State->Kind == OPTIMIZER_SLOT_CONSTANT)
+    {
+        Symbol->Type  = SYMBOL_NUM_TYPE;
+        Symbol->Len   = 0;
+        Symbol->Value = State->Value;
+        return TRUE;
+    }
+
+    if (State->Kind == OPTIMIZER_SLOT_COPY && Context->SlotVersions[State->Value] == State->SourceVersion)
+    {
+        Symbol->Value = State->Value;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Records a new value for a temp
+ *
+ * @param Context
+ * @param Destination
+ * @param Source the source symbol if the value is copied, NULL otherwise
+ */
+void
+OptimizerDefine(POPTIMIZER_CONTEXT Context, PSYMBOL Destination, PSYMBOL Source)
+{
+    POPTIMIZER_SLOT_STATE State;
+
+    if (!OptimizerIsAnyTemp(Destination))
+    {
+        return;
+    }
+
+    Context->SlotVersions[Destination->Value]++;
+
+    State        = &Context->SlotStates[Destination->Value];
+    State->Epoch = Context->Epoch;
+    State->Kind  = OPTIMIZER_SLOT_UNKNOWN;
+
+    if (Source == NULL || !OptimizerIsTemp(Destination) || Context->AddressTaken[Destination->Value])
+    {
+        return;
+    }
+
+    if (Source->Type == SYMBOL_NUM_TYPE)
+    {
+        State->Kind  = OPTIMIZER_SLOT_CONSTANT;
+        State->Value = Source->Value;
+    }
+    else if (OptimizerIsTemp(Source) && Source->Value != Destination->Value && !Context->AddressTaken[Source->Value])
+    {
+        State->Kind          = OPTIMIZER_SLOT_COPY;
+        State->Value         = Source->Value;
+        State->SourceVersion = Context->SlotVersions[Source->Value];
+    }
+}
+
+/**
+ * @brief Constant folding and copy propagation inside the basic blocks
+ *
+ * @param Context
+ * @return char TRUE if anything is changed
+ */
+char
+OptimizerPropagateConstants(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL                Head    = Context->CodeBuffer->Head;
+    char                   Changed = FALSE;
+    POPTIMIZER_INSTRUCTION Instruction;
+    PSYMBOL                Symbol;
+    unsigned long long     Result;
+
+    if (!OptimizerBuildBlocks(Context))
+    {
+        return FALSE;
+    }
+
+    for (unsigned int b = 0; b < Context->BlockCount; b++)
+    {
+        //
+        // Nothing is known at the start of a block
+        //
+        Context->Epoch++;
+
+        for (unsigned int i = Context->Blocks[b].First; i <= Context->Blocks[b].Last; i++)
+        {
+            Instruction = &Context->Instructions[i];
+            Symbol      = &Head[Instruction->Offset];
+
+            if (Instruction->IsRemoved)
+            {
+                continue;
+            }
+
+            switch (Instruction->Class)
+            {
+            case OPTIMIZER_OPERATOR_VALUE:
+
+                for (unsigned int j = 1; j < Instruction->Size - 1; j++)
+                {
+                    Changed |= OptimizerReplaceOperand(Context, &Symbol[j]);
+                }
+
+                //
+                // Fold the operator if all of the sources are constant
+                //
+                if (Symbol->Value != FUNC_MOV && Symbol[1].Type == SYMBOL_NUM_TYPE &&
+                    (Instruction->Size == 3 || Symbol[2].Type == SYMBOL_NUM_TYPE) &&
+                    OptimizerFold(Symbol->Value, Symbol[1].Value, Instruction->Size == 3 ? 0 : Symbol[2].Value, &Result))
+                {
+                    Symbol[0].Value   = FUNC_MOV;
+                    Symbol[1].Value   = Result;
+                    Symbol[2]         = Symbol[Instruction->Size - 1];
+                    Instruction->Size = 3;
+                    Changed           = TRUE;
+                }
+
+                //
+                // Moving a temp to itself does nothing
+                //
+                if (Symbol->Value == FUNC_MOV && OptimizerIsTemp(&Symbol[1]) && OptimizerIsTemp(&Symbol[2]) &&
+                    Symbol[1].Value == Symbol[2].Value)
+                {
+                    Instruction->IsRemoved = TRUE;
+                    Changed                = TRUE;
+                    break;
+                }
+
+                OptimizerDefine(Context, &Symbol[Instruction->Size - 1], Symbol->Value == FUNC_MOV ? &Symbol[1] : NULL);
+                break;
+
+            case OPTIMIZER_OPERATOR_INC_DEC:
+            case OPTIMIZER_OPERATOR_POP:
+                OptimizerDefine(Context, &Symbol[1], NULL);
+                break;
+
+            case OPTIMIZER_OPERATOR_CONDITIONAL_JMP:
+                Changed |= OptimizerReplaceOperand(Context, &Symbol[2]);
+                break;
+
+            case OPTIMIZER_OPERATOR_PUSH:
+                Changed |= OptimizerReplaceOperand(Context, &Symbol[1]);
+                break;
+
+            case OPTIMIZER_OPERATOR_CALL:
+                Context->Epoch++;
+                break;
+
+            case OPTIMIZER_OPERATOR_OTHER:
+
+                //
+                // The temps might be modified by the operator
+                //
+                for (unsigned int j = 1; j < Instruction->Size; j += OptimizerGetOperandSize(&Symbol[j]))
+                {
+                    if (OptimizerIsAnyTemp(&Symbol[j]))
+                    {
+                        OptimizerDefine(Context, &Symbol[j], NULL);
+                    }
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    return Changed;
+}
+
+/**
+ * @brief Jump threading, folding the constant conditions and removing
+ * the unreachable instructions
+ *
+ * @param Context
+ * @return char TRUE if anything is changed
+ */
+char
+OptimizerThreadJumps(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL                Head    = Context->CodeBuffer->Head;
+    char                   Changed = FALSE;
+    POPTIMIZER_INSTRUCTION Instruction;
+    PSYMBOL                Symbol;
+    unsigned int *         WorkList;
+    unsigned int           WorkListCount = 0;
+    char *                 IsReachable;
+
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        Instruction = &Context->Instructions[i];
+        Symbol      = &Head[Instruction->Offset];
+
+        if (Instruction->IsRemoved ||
+            (Instruction->Class != OPTIMIZER_OPERATOR_JMP && Instruction->Class != OPTIMIZER_OPERATOR_CONDITIONAL_JMP))
+        {
+            continue;
+        }
+
+        //
+        // Jump directly to the target of the jumps that only jump
+        //
+        unsigned int Target = OptimizerResolve(Context, Instruction->Target);
+
+        for (unsigned int j = 0; j < OPTIMIZER_MAX_JUMP_THREADING; j++)
+        {
+            if (Target >= Context->InstructionCount || Target == i ||
+                Context->Instructions[Target].Class != OPTIMIZER_OPERATOR_JMP)
+            {
+                break;
+            }
+
+            Target = OptimizerResolve(Context, Context->Instructions[Target].Target);
+        }
+
+        if (Target != OptimizerResolve(Context, Instruction->Target))
+        {
+            Changed = TRUE;
+        }
+
+        Instruction->Target = Target;
+
+        //
+        // Conditional jumps with a constant condition are either a jump or nothing
+        //
+        if (Instruction->Class == OPTIMIZER_OPERATOR_CONDITIONAL_JMP && Symbol[2].Type == SYMBOL_NUM_TYPE)
+        {
+            if ((Symbol->Value == FUNC_JZ) == (Symbol[2].Value == 0))
+            {
+                Symbol->Value      = FUNC_JMP;
+                Instruction->Size  = 2;
+                Instruction->Class = OPTIMIZER_OPERATOR_JMP;
+            }
+            else
+            {
+                Instruction->IsRemoved = TRUE;
+            }
+            Changed = TRUE;
+            continue;
+        }
+
+        //
+        // Jumping to the next instruction does nothing
+        //
+        if (Target == OptimizerResolve(Context, i + 1) &&
+            (Instruction->Class == OPTIMIZER_OPERATOR_JMP || Symbol[2].Type == SYMBOL_NUM_TYPE ||
+             Symbol[2].Type == SYMBOL_TEMP_TYPE || Symbol[2].Type == SYMBOL_GLOBAL_ID_TYPE))
+        {
+            Instruction->IsRemoved = TRUE;
+            Changed                = TRUE;
+        }
+    }
+
+    //
+    // Remove the instructions that are not reachable from the start
+    //
+    WorkList    = (unsigned int *)malloc((Context->InstructionCount * 2 + 1) * sizeof(unsigned int));
+    IsReachable = (char *)calloc(Context->InstructionCount + 1, sizeof(char));
+
+    if (WorkList == NULL || IsReachable == NULL)
+    {
+        free(WorkList);
+        free(IsReachable);
+        return Changed;
+    }
+
+    WorkList[WorkListCount++] = OptimizerResolve(Context, 0);
+
+    while (WorkListCount != 0)
+    {
+        unsigned int i = WorkList[--WorkListCount];
+
+        if (i >= Context->InstructionCount || IsReachable[i])
+        {
+            continue;
+        }
+
+        IsReachable[i] = TRUE;
+        Instruction    = &Context->Instructions[i];
+
+        if (Instruction->Target != OPTIMIZER_INVALID_INDEX)
+        {
+            WorkList[WorkListCount++] = OptimizerResolve(Context, Instruction->Target);
+        }
+
+        if (Instruction->Class != OPTIMIZER_OPERATOR_JMP && Instruction->Class != OPTIMIZER_OPERATOR_RET)
+        {
+            WorkList[WorkListCount++] = OptimizerResolve(Context, i + 1);
+        }
+    }
+
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        if (!Context->Instructions[i].IsRemoved && !IsReachable[i])
+        {
+            Context->Instructions[i].IsRemoved = TRUE;
+            Changed                            = TRUE;
+        }
+    }
+
+    free(WorkList);
+    free(IsReachable);
+
+    return Changed;
+}
+
+/**
+ * @brief Applies the definitions and the uses of an instruction on a
+ * liveness set (from the end of the instruction to its start)
+ *
+ * @param Context
+ * @param Instruction
+ * @param Live
+ */
+void
+OptimizerUpdateLiveness(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction, unsigned long long * Live)
+{
+    PSYMBOL Symbol = &Context->CodeBuffer->Head[Instruction->Offset];
+
+#define OPTIMIZER_KILL(Slot) Live[(Slot) / 64] &= ~(1ull << ((Slot) % 64))
+#define OPTIMIZER_GEN(Slot)  Live[(Slot) / 64] |= (1ull << ((Slot) % 64))
+
+    switch (Instruction->Class)
+    {
+    case OPTIMIZER_OPERATOR_VALUE:
+
+        if (OptimizerIsTemp(&Symbol[Instruction->Size - 1]))
+        {
+            OPTIMIZER_KILL(Symbol[Instruction->Size - 1].Value);
+        }
+
+        for (unsigned int j = 1; j < Instruction->Size - 1; j++)
+        {
+            if (OptimizerIsAnyTemp(&Symbol[j]))
+            {
+                OPTIMIZER_GEN(Symbol[j].Value);
+            }
+        }
+        break;
+
+    case OPTIMIZER_OPERATOR_POP:
+
+        if (OptimizerIsTemp(&Symbol[1]))
+        {
+            OPTIMIZER_KILL(Symbol[1].Value);
+        }
+        break;
+
+    case OPTIMIZER_OPERATOR_JMP:
+    case OPTIMIZER_OPERATOR_CALL:
+    case OPTIMIZER_OPERATOR_RET:
+        break;
+
+    default:
+
+        //
+        // The temps of other operators are only considered as used
+        //
+        for (unsigned int j = 1; j < Instruction->Size; j += OptimizerGetOperandSize(&Symbol[j]))
+        {
+            if (OptimizerIsAnyTemp(&Symbol[j]))
+            {
+                OPTIMIZER_GEN(Symbol[j].Value);
+            }
+        }
+        break;
+    }
+
+#undef OPTIMIZER_KILL
+#undef OPTIMIZER_GEN
+}
+
+/**
+ * @brief Checks whether an instruction could be removed if its result is not used
+ *
+ * @param Context
+ * @param Instruction
+ * @return char
+ */
+char
+OptimizerIsRemovable(POPTIMIZER_CONTEXT Context, POPTIMIZER_INSTRUCTION Instruction)
+{
+    PSYMBOL Symbol = &Context->CodeBuffer->Head[Instruction->Offset];
+
+    if (Instruction->Class != OPTIMIZER_OPERATOR_VALUE || !OptimizerIsTemp(&Symbol[Instruction->Size - 1]) ||
+        Context->AddressTaken[Symbol[Instruction->Size - 1].Value])
+    {
+        return FALSE;
+    }
+
+    //
+    // Division by zero should still be reported
+    //
+    if ((Symbol->Value == FUNC_DIV || Symbol->Value == FUNC_MOD) &&
+        (Symbol[1].Type != SYMBOL_NUM_TYPE || Symbol[1].Value == 0))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Removes the instructions that their results (temps) are never used
+ * and writes the results directly to the destination of the following move
+ *
+ * @param Context
+ * @return char TRUE if anything is changed
+ */
+char
+OptimizerEliminateDeadTemps(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL                Head    = Context->CodeBuffer->Head;
+    char                   Changed = FALSE;
+    char                   IsLiveInChanged;
+    unsigned int           Words;
+    unsigned long long *   Use;
+    unsigned long long *   Def;
+    unsigned long long *   LiveIn;
+    unsigned long long *   Live;
+    POPTIMIZER_INSTRUCTION Instruction;
+    PSYMBOL                Symbol;
+
+    if (!OptimizerBuildBlocks(Context))
+    {
+        return FALSE;
+    }
+
+    Words = (Context->SlotCount + 63) / 64;
+
+    if (Words == 0 || (unsigned long long)Words * Context->BlockCount > OPTIMIZER_MAX_LIVENESS_WORDS)
+    {
+        return FALSE;
+    }
+
+    Use    = (unsigned long long *)calloc((unsigned long long)Words * Context->BlockCount, sizeof(unsigned long long));
+    Def    = (unsigned long long *)calloc((unsigned long long)Words * Context->BlockCount, sizeof(unsigned long long));
+    LiveIn = (unsigned long long *)calloc((unsigned long long)Words * Context->BlockCount, sizeof(unsigned long long));
+    Live   = (unsigned long long *)calloc(Words, sizeof(unsigned long long));
+
+    if (Use == NULL || Def == NULL || LiveIn == NULL || Live == NULL)
+    {
+        goto Cleanup;
+    }
+
+    //
+    // Compute the used and the defined temps of each block (from the end
+    // of the block to its start)
+    //
+    for (unsigned int b = 0; b < Context->BlockCount; b++)
+    {
+        unsigned long long * BlockUse = &Use[b * Words];
+        unsigned long long * BlockDef = &Def[b * Words];
+
+        for (unsigned int i = Context->Blocks[b].Last + 1; i-- > Context->Blocks[b].First;)
+        {
+            if (Context->Instructions[i].IsRemoved)
+            {
+                continue;
+            }
+
+            //
+            // Def = all of the temps that are killed, Use = temps that are
+            // used before being killed
+            //
+            memset(Live, 0xff, Words * sizeof(unsigned long long));
+            OptimizerUpdateLiveness(Context, &Context->Instructions[i], Live);
+
+            for (unsigned int w = 0; w < Words; w++)
+            {
+                BlockDef[w] |= ~Live[w];
+                BlockUse[w] &= Live[w];
+            }
+
+            memset(Live, 0, Words * sizeof(unsigned long long));
+            OptimizerUpdateLiveness(Context, &Context->Instructions[i], Live);
+
+            for (unsigned int w = 0; w < Words; w++)
+            {
+                BlockUse[w] |= Live[w];
+            }
+        }
+    }
+
+    //
+    // Solve the liveness equations
+    //
+    do
+    {
+        IsLiveInChanged = FALSE;
+
+        for (unsigned int b = Context->BlockCount; b-- > 0;)
+        {
+            for (unsigned int w = 0; w < Words; w++)
+            {
+                unsigned long long Out = 0;
+                unsigned long long In;
+
+                for (unsigned int s = 0; s < 2; s++)
+                {
+                    if (Context->Blocks[b].Successors[s] != OPTIMIZER_INVALID_INDEX)
+                    {
+                        Out |= LiveIn[Context->Blocks[b].Successors[s] * Words + w];
+                    }
+                }
+
+                In = Use[b * Words + w] | (Out & ~Def[b * Words + w]);
+
+                if (In != LiveIn[b * Words + w])
+                {
+                    LiveIn[b * Words + w] = In;
+                    IsLiveInChanged       = TRUE;
+                }
+            }
+        }
+    } while (IsLiveInChanged);
+
+    //
+    // Remove the dead instructions
+    //
+    for (unsigned int b = 0; b < Context->BlockCount; b++)
+    {
+        memset(Live, 0, Words * sizeof(unsigned long long));
+
+        for (unsigned int s = 0; s < 2; s++)
+        {
+            if (Context->Blocks[b].Successors[s] != OPTIMIZER_INVALID_INDEX)
+            {
+                for (unsigned int w = 0; w < Words; w++)
+                {
+                    Live[w] |= LiveIn[Context->Blocks[b].Successors[s] * Words + w];
+                }
+            }
+        }
+
+        for (unsigned int i = Context->Blocks[b].Last + 1; i-- > Context->Blocks[b].First;)
+        {
+            Instruction = &Context->Instructions[i];
+            Symbol      = &Head[Instruction->Offset];
+
+            if (Instruction->IsRemoved)
+            {
+                continue;
+            }
+
+            if (OptimizerIsRemovable(Context, Instruction))
+            {
+                unsigned long long Slot = Symbol[Instruction->Size - 1].Value;
+
+                if (!(Live[Slot / 64] & (1ull << (Slot % 64))))
+                {
+                    Instruction->IsRemoved = TRUE;
+                    Changed                = TRUE;
+                    continue;
+                }
+            }
+
+            //
+            // Write the result of the previous instruction directly to the
+            // destination of the move if its temp is not used anymore
+            //
+            if (Symbol->Value == FUNC_MOV && Instruction->Class == OPTIMIZER_OPERATOR_VALUE && OptimizerIsTemp(&Symbol[1]) &&
+                !Context->AddressTaken[Symbol[1].Value] && !(Live[Symbol[1].Value / 64] & (1ull << (Symbol[1].Value % 64))))
+            {
+                unsigned int Previous = i;
+
+                while (Previous-- > Context->Blocks[b].First && Context->Instructions[Previous].IsRemoved)
+                    ;
+
+                if (Previous != OPTIMIZER_INVALID_INDEX && Previous >= Context->Blocks[b].First &&
+                    Context->Instructions[Previous].Class == OPTIMIZER_OPERATOR_VALUE)
+                {
+                    POPTIMIZER_INSTRUCTION PreviousInstruction = &Context->Instructions[Previous];
+                    PSYMBOL                PreviousDestination = &Head[PreviousInstruction->Offset + PreviousInstruction->Size - 1];
+
+                    if (OptimizerIsTemp(PreviousDestination) && PreviousDestination->Value == Symbol[1].Value)
+                    {
+                        *PreviousDestination   = Symbol[2];
+                        Instruction->IsRemoved = TRUE;
+                        Changed                = TRUE;
+                        continue;
+                    }
+                }
+            }
+
+            OptimizerUpdateLiveness(Context, Instruction, Live);
+        }
+    }
+
+Cleanup:
+    free(Use);
+    free(Def);
+    free(LiveIn);
+    free(Live);
+
+    return Changed;
+}
+
+/**
+ * @brief Removes the eliminated instructions from the symbol buffer and
+ * relocates the targets of the jumps
+ *
+ * @param Context
+ */
+void
+OptimizerCompact(POPTIMIZER_CONTEXT Context)
+{
+    PSYMBOL                Head       = Context->CodeBuffer->Head;
+    unsigned int *         NewOffsets = Context->NewOffsets;
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int           Pointer = 0;
+
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        NewOffsets[i] = Pointer;
+
+        if (!Context->Instructions[i].IsRemoved)
+        {
+            Pointer += Context->Instructions[i].Size;
+        }
+    }
+
+    NewOffsets[Context->InstructionCount] = Pointer;
+
+    //
+    // The new offsets are never after the old ones, so moving the
+    // instructions from the start is safe
+    //
+    for (unsigned int i = 0; i < Context->InstructionCount; i++)
+    {
+        Instruction = &Context->Instructions[i];
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        memmove(&Head[NewOffsets[i]], &Head[Instruction->Offset], Instruction->Size * sizeof(SYMBOL));
+
+        if (Instruction->Target != OPTIMIZER_INVALID_INDEX)
+        {
+            Head[NewOffsets[i] + 1].Value = NewOffsets[OptimizerResolve(Context, Instruction->Target)];
+        }
+    }
+
+    Context->CodeBuffer->Pointer = Pointer;
+}
+
+/**
+ * @brief Optimizes the symbol buffer that is generated by ScriptEngineParse
+ * @details constant folding, copy propagation, dead-temp elimination and
+ * jump threading are repeated until nothing changes
+ *
+ * @param SymbolBuffer
+ * @return BOOLEAN TRUE if the buffer is optimized
+ */
+BOOLEAN
+ScriptEngineOptimizeSymbolBuffer(PVOID SymbolBuffer)
+{
+    OPTIMIZER_CONTEXT Context = {0};
+    BOOLEAN           Result  = FALSE;
+
+    Context.CodeBuffer = (PSYMBOL_BUFFER)SymbolBuffer;
+
+    if (Context.CodeBuffer == NULL || Context.CodeBuffer->Message != NULL || Context.CodeBuffer->Pointer == 0)
+    {
+        return FALSE;
+    }
+
+    if (OptimizerDecode(&Context))
+    {
+        for (unsigned int i = 0; i < OPTIMIZER_MAX_ITERATIONS; i++)
+        {
+            char Changed = FALSE;
+
+            Changed |= OptimizerPropagateConstants(&Context);
+            Changed |= OptimizerThreadJumps(&Context);
+            Changed |= OptimizerEliminateDeadTemps(&Context);
+
+            if (!Changed)
+            {
+                break;
+            }
+        }
+
+        OptimizerCompact(&Context);
+        Result = TRUE;
+    }
+
+    free(Context.Instructions);
+    free(Context.Blocks);
+    free(Context.AddressTaken);
+    free(Context.SlotStates);
+    free(Context.SlotVersions);
+    free(Context.NewOffsets);
+
+    return Result;
+}
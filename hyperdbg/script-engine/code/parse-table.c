@@ -117,6 +117,13 @@ const struct _TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "IF_STATEMENT"},
@@ -307,6 +314,8 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "spinlock_lock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_unlock"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_UNLOCK"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_sc"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_SC"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_print"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_PRINT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_clear"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_CLEAR"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "printf"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@PRINTF"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "pause"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PAUSE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "flush"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@FLUSH"},{SPECIAL_TOKEN, ")"}},
@@ -317,6 +326,8 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "event_trace_instrumentation_step_in"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@EVENT_TRACE_INSTRUMENTATION_STEP_IN"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_lock_custom_wait"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK_CUSTOM_WAIT"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "event_inject"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_INJECT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_COUNT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@HIST"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "poi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@POI"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "db"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DB"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{KEYWORD, "dd"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
@@ -360,6 +371,9 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "event_inject_error_code"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EVENT_INJECT_ERROR_CODE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "memcpy"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCPY"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "memcpy_pa"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MEMCPY_PA"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_SUM"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MIN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MAX"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "wcsncmp"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "WstringNumber"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "WstringNumber"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSNCMP"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{NON_TERMINAL, "VA"}},
 	{{EPSILON, "eps"}},
@@ -551,6 +565,8 @@ const unsigned int RhsSize[RULES_COUNT]=
 5,
 5,
 5,
+5,
+5,
 7,
 4,
 4,
@@ -561,6 +577,8 @@ const unsigned int RhsSize[RULES_COUNT]=
 4,
 7,
 7,
+7,
+7,
 6,
 6,
 6,
@@ -604,6 +622,9 @@ const unsigned int RhsSize[RULES_COUNT]=
 9,
 9,
 9,
+9,
+9,
+9,
 10,
 3,
 1,
@@ -733,237 +754,246 @@ const unsigned int RhsSize[RULES_COUNT]=
 };
 const char* NoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"CALL_FUNC_STATEMENT",
-"END_OF_IF",
-"STRING",
-"MULTIPLE_ASSIGNMENT",
-"L_VALUE",
-"ASSIGNMENT_STATEMENT'",
-"E1",
-"FOR_STATEMENT",
-"BOOLEAN_EXPRESSION",
+"S",
+"IF_STATEMENT",
+"MULTIPLE_ASSIGNMENT2",
 "E0'",
 "VA",
-"WHILE_STATEMENT",
-"VARIABLE_TYPE1",
-"S2",
-"STATEMENT",
-"VARIABLE_TYPE6",
-"IF_STATEMENT",
-"E4",
-"ELSIF_STATEMENT'",
+"WSTRING",
+"FOR_STATEMENT",
+"ELSIF_STATEMENT",
 "StringNumber",
-"EXPRESSION",
-"VARIABLE_TYPE4",
 "VARIABLE_TYPE3",
-"WstringNumber",
-"S",
-"DO_WHILE_STATEMENT",
+"CALL_FUNC_STATEMENT",
+"MULTIPLE_ASSIGNMENT",
+"INC_DEC'",
+"E4'",
+"E3'",
+"E3",
+"VARIABLE_TYPE5",
+"E4",
+"STATEMENT",
+"E2",
+"VARIABLE_TYPE4",
+"END_OF_IF",
+"S2",
 "VA2",
-"ELSIF_STATEMENT",
-"ASSIGNMENT_STATEMENT",
+"E5",
 "ELSE_STATEMENT",
-"SIMPLE_ASSIGNMENT",
-"E1'",
-"E12",
-"VARIABLE_TYPE2",
+"ASSIGNMENT_STATEMENT'",
 "E5'",
-"E3'",
-"MULTIPLE_ASSIGNMENT2",
-"INC_DEC",
-"INC_DEC'",
-"WSTRING",
-"VARIABLE_TYPE5",
-"E4'",
+"SIMPLE_ASSIGNMENT",
+"WstringNumber",
+"BOOLEAN_EXPRESSION",
 "RETURN",
-"E5",
-"STATEMENT2",
 "VA3",
+"E1'",
+"STATEMENT2",
 "E2'",
-"E2",
-"E3"
+"EXPRESSION",
+"ASSIGNMENT_STATEMENT",
+"L_VALUE",
+"DO_WHILE_STATEMENT",
+"VARIABLE_TYPE2",
+"ELSIF_STATEMENT'",
+"E12",
+"INC_DEC",
+"VARIABLE_TYPE1",
+"E1",
+"STRING",
+"WHILE_STATEMENT",
+"VARIABLE_TYPE6"
 };
 const char* TerminalMap[TERMINAL_COUNT]= 
 {
-"pause",
-"check_address",
+"dd_pa",
+"return",
+"memcpy",
+";",
+"map_count",
 "~",
-"while",
-"event_trace_instrumentation_step",
-"memcmp",
-"flush",
-"break",
-"wcscmp",
-"print",
-"_string",
+"/=",
+"eb_pa",
+"hist",
+"eq_pa",
+"event_trace_instrumentation_step_in",
+"ed_pa",
+"++",
+"test_statement",
+"interlocked_exchange",
+"+=",
 "poi",
-"(",
+"&",
+"%=",
+"/",
+"event_inject_error_code",
+">>=",
 "_script_variable_type",
-"event_inject",
-"interlocked_compare_exchange",
-"_function_id",
-"not",
-"dq",
-"hi",
-"dw_pa",
 "strlen",
-"for",
-"event_trace_instrumentation_step_in",
-"eq",
-"_global_id",
-"_decimal",
+"*=",
 "spinlock_unlock",
-"elsif",
-"strcmp",
-"_pseudo_register",
-"}",
-">>=",
-"&",
+"wcsncmp",
+"reference",
+"do",
+"_function_id",
+"disassemble_len",
+"continue",
+"_wstring",
+"poi_pa",
 "spinlock_lock_custom_wait",
+"}",
+"_binary",
+"check_address",
+">>",
+"_hex",
+"|=",
+"event_trace_step",
+"_register",
+"|",
 "$",
-"_function_parameter_id",
-"&=",
-"<<",
-"return",
+"dq_pa",
+"wcslen",
+"if",
+"disassemble_len32",
+"memcpy_pa",
+"*",
+"<<=",
+"event_trace_instrumentation_step",
 "hi_pa",
-"^=",
-"event_sc",
-"/=",
-"interlocked_increment",
-"interlocked_exchange_add",
-"*=",
+"event_trace_step_out",
+"interlocked_compare_exchange",
+"spinlock_lock",
+"elsif",
+"{",
+"map_sum",
+"map_print",
+"-",
+"--",
+"_decimal",
+"event_clear",
+"&=",
 "%",
+"^",
+")",
 "db_pa",
-"interlocked_exchange",
-"wcslen",
-"else",
-"ed",
-",",
 "dw",
+"eq",
+"printf",
+"interlocked_exchange_add",
+"memcmp",
+"pause",
+"event_enable",
+"_global_id",
+"strncmp",
+"(",
+"map_max",
+"hi",
+"while",
+"ed",
+"interlocked_increment",
+"virtual_to_physical",
 "-=",
+"map_min",
+",",
+"dw_pa",
+"low",
+"print",
+"flush",
+"not",
+"_pseudo_register",
+"dq",
+"event_trace_step_in",
+"event_sc",
+"_string",
+"+",
+"_function_parameter_id",
+"_octal",
+"wcscmp",
+"interlocked_decrement",
+"strcmp",
+"break",
+"formats",
+"^=",
+"disassemble_len64",
+"event_disable",
+"event_inject",
 "eb",
-"event_trace_step_out",
+"else",
+"neg",
+"map_clear",
+"dd",
 "low_pa",
-"event_inject_error_code",
-"--",
-"dd_pa",
-"spinlock_lock",
-"memcpy_pa",
-"disassemble_len",
 "physical_to_virtual",
-"_wstring",
-"-",
-"+=",
-"++",
+"<<",
+"for",
 "db",
-"%=",
-"test_statement",
-"interlocked_decrement",
-";",
-"reference",
-"virtual_to_physical",
-"dq_pa",
-"disassemble_len32",
-">>",
-"continue",
-"neg",
-"ed_pa",
-"event_trace_step_in",
-"_binary",
-"disassemble_len64",
-"+",
-"do",
-"<<=",
-"poi_pa",
-"=",
-"if",
-"|",
-"event_disable",
-"{",
-"low",
-"memcpy",
-"^",
-"/",
-")",
-"event_trace_step",
-"_register",
-"event_clear",
-"dd",
-"_local_id",
-"formats",
-"event_enable",
-"eq_pa",
-"_octal",
-"_hex",
-"printf",
-"*",
-"strncmp",
-"wcsncmp",
-"|=",
-"eb_pa"
-};
-const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
-{
-	{63		,81		,2147483648		,2147483648		,68		,108		,64		,2147483648		,111		,53		,2147483648		,72		,2147483648		,2147483648		,71		,105		,2147483648		,80		,76		,78		,95		,106		,2147483648		,69		,99		,2147483648		,2147483648		,60		,2147483648		,107		,2147483648		,2147483648		,2147483648		,2147483648		,70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,91		,2147483648		,61		,2147483648		,85		,101		,2147483648		,2147483648		,93		,100		,110		,2147483648		,97		,2147483648		,75		,2147483648		,98		,67		,92		,112		,2147483648		,94		,59		,114		,82		,88		,2147483648		,2147483648		,2147483648		,2147483648		,73		,2147483648		,58		,86		,2147483648		,87		,89		,96		,83		,2147483648		,2147483648		,77		,103		,66		,2147483648		,84		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,56		,2147483648		,79		,113		,2147483648		,2147483648		,2147483648		,65		,2147483648		,57		,74		,2147483648		,54		,55		,104		,2147483648		,2147483648		,62		,2147483648		,109		,115		,2147483648		,102	},
-	{124		,124		,2147483648		,124		,124		,124		,124		,124		,124		,124		,2147483648		,124		,2147483648		,124		,124		,124		,124		,124		,124		,124		,124		,124		,124		,124		,124		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,2147483648		,2147483648		,124		,124		,124		,2147483648		,2147483648		,124		,124		,2147483648		,124		,2147483648		,124		,124		,2147483648		,2147483648		,124		,124		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,124		,124		,124		,124		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,124		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,124		,124		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,2147483648		,124		,124		,124		,124		,2147483648		,2147483648		,2147483648		,124		,124		,124		,124		,124		,124		,124		,124		,2147483648		,2147483648		,124		,2147483648		,124		,124		,2147483648		,124	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,148		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,49		,2147483648		,2147483648		,2147483648		,2147483648		,50		,2147483648		,2147483648		,2147483648		,51		,2147483648		,46		,2147483648		,2147483648		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,43		,40		,2147483648		,47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648	},
-	{2147483648		,154		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,154		,154		,2147483648		,2147483648		,154		,154		,154		,154		,154		,154		,154		,2147483648		,2147483648		,154		,154		,154		,2147483648		,2147483648		,154		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,154		,154		,2147483648		,2147483648		,154		,154		,154		,2147483648		,154		,2147483648		,154		,2147483648		,154		,2147483648		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,154		,154		,2147483648		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,154		,2147483648		,154		,154		,154		,154		,2147483648		,2147483648		,154		,154		,2147483648		,154		,154		,154		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,154		,154		,2147483648		,2147483648		,154		,154		,154		,2147483648		,154		,154		,154		,2147483648		,154	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,146		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,146		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,116		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,117		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,125		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,2147483648		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,2147483648		,13		,2147483648		,15		,2147483648		,2147483648		,13		,2147483648		,13		,2147483648		,2147483648		,13		,13		,2147483648		,13		,2147483648		,13		,13		,2147483648		,2147483648		,13		,13		,13		,2147483648		,13		,2147483648		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,2147483648		,2147483648		,2147483648		,13		,2147483648		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,2147483648		,13		,2147483648		,13		,2147483648		,13		,2147483648		,13		,14		,13		,13		,2147483648		,2147483648		,2147483648		,13		,13		,13		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,13		,13		,2147483648		,13	},
-	{9		,9		,2147483648		,4		,9		,9		,9		,10		,9		,9		,2147483648		,9		,2147483648		,12		,9		,9		,8		,9		,9		,9		,9		,9		,6		,9		,9		,7		,2147483648		,9		,2147483648		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,2147483648		,7		,2147483648		,2147483648		,2147483648		,9		,2147483648		,9		,2147483648		,9		,9		,2147483648		,2147483648		,9		,9		,9		,2147483648		,9		,2147483648		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,9		,9		,9		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,2147483648		,9		,9		,2147483648		,9		,9		,9		,9		,2147483648		,11		,9		,9		,9		,2147483648		,9		,2147483648		,5		,2147483648		,9		,2147483648		,3		,2147483648		,9		,2147483648		,9		,9		,2147483648		,2147483648		,2147483648		,9		,7		,9		,9		,7		,9		,9		,9		,2147483648		,2147483648		,9		,2147483648		,9		,9		,2147483648		,9	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,164		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,164		,2147483648		,2147483648		,164		,164		,164		,164		,164		,164		,164		,2147483648		,2147483648		,164		,164		,164		,2147483648		,2147483648		,164		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,164		,164		,2147483648		,2147483648		,164		,164		,164		,2147483648		,164		,2147483648		,164		,2147483648		,164		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,164		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,164		,164		,164		,164		,2147483648		,2147483648		,164		,164		,2147483648		,164		,164		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,164		,164		,2147483648		,2147483648		,164		,164		,164		,2147483648		,164		,164		,164		,2147483648		,164	},
-	{121		,121		,2147483648		,121		,121		,121		,121		,121		,121		,121		,2147483648		,121		,2147483648		,121		,121		,121		,121		,121		,121		,121		,121		,121		,121		,121		,121		,121		,2147483648		,121		,2147483648		,121		,2147483648		,121		,2147483648		,2147483648		,121		,121		,121		,2147483648		,2147483648		,121		,121		,2147483648		,121		,2147483648		,121		,121		,2147483648		,2147483648		,121		,121		,121		,121		,121		,2147483648		,121		,2147483648		,121		,121		,121		,121		,2147483648		,121		,121		,121		,121		,121		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,121		,121		,2147483648		,121		,121		,121		,121		,2147483648		,121		,121		,121		,121		,2147483648		,121		,2147483648		,121		,2147483648		,121		,2147483648		,121		,2147483648		,121		,121		,121		,121		,2147483648		,2147483648		,2147483648		,121		,121		,121		,121		,121		,121		,121		,121		,2147483648		,2147483648		,121		,2147483648		,121		,121		,2147483648		,121	},
-	{2147483648		,237		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,238		,237		,237		,2147483648		,2147483648		,237		,237		,237		,237		,237		,237		,237		,2147483648		,2147483648		,237		,237		,237		,2147483648		,2147483648		,237		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,237		,237		,2147483648		,2147483648		,237		,237		,237		,2147483648		,237		,2147483648		,237		,2147483648		,237		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,237		,237		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,237		,2147483648		,237		,237		,237		,237		,2147483648		,2147483648		,237		,237		,2147483648		,237		,237		,237		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,237		,237		,2147483648		,2147483648		,237		,237		,237		,2147483648		,237		,237		,237		,2147483648		,237	},
-	{2147483648		,151		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,151		,151		,2147483648		,2147483648		,151		,151		,151		,151		,151		,151		,151		,2147483648		,2147483648		,151		,151		,151		,2147483648		,2147483648		,151		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,151		,151		,2147483648		,2147483648		,151		,151		,151		,2147483648		,151		,2147483648		,151		,2147483648		,151		,2147483648		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,151		,151		,2147483648		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,151		,2147483648		,151		,151		,151		,151		,2147483648		,2147483648		,151		,151		,2147483648		,151		,151		,151		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,151		,151		,2147483648		,2147483648		,151		,151		,151		,2147483648		,151		,151		,151		,2147483648		,151	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,239		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,239		,239		,239		,239		,239		,2147483648		,2147483648		,239		,239		,239		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,239		,2147483648		,239		,2147483648		,239		,2147483648		,239		,2147483648		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,239		,240		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,239		,2147483648		,239		,239		,239		,239		,2147483648		,2147483648		,239		,239		,2147483648		,239		,239		,239		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,239		,239		,2147483648		,2147483648		,239		,239		,239		,2147483648		,239		,239		,239		,2147483648		,239	},
-	{0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,2147483648		,0		,2147483648		,2		,2147483648		,2147483648		,0		,2		,0		,2147483648		,2147483648		,2147483648		,0		,2147483648		,0		,2147483648		,0		,0		,2147483648		,2147483648		,0		,0		,0		,2147483648		,0		,2147483648		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,2147483648		,2147483648		,2147483648		,0		,2147483648		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,2147483648		,0		,2147483648		,0		,2147483648		,0		,2147483648		,0		,1		,0		,0		,2147483648		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,0		,0		,2147483648		,0	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,126		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,234		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,234		,2147483648		,2147483648		,234		,234		,234		,234		,234		,234		,234		,2147483648		,2147483648		,234		,234		,234		,2147483648		,2147483648		,234		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,234		,234		,2147483648		,2147483648		,234		,234		,234		,2147483648		,234		,2147483648		,234		,2147483648		,234		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,234		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,234		,2147483648		,234		,234		,234		,234		,2147483648		,2147483648		,234		,234		,2147483648		,234		,234		,234		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,233		,2147483648		,234		,2147483648		,234		,234		,2147483648		,2147483648		,234		,234		,234		,2147483648		,234		,234		,234		,2147483648		,234	},
-	{120		,120		,2147483648		,120		,120		,120		,120		,120		,120		,120		,2147483648		,120		,2147483648		,120		,120		,120		,120		,120		,120		,120		,120		,120		,120		,120		,120		,120		,2147483648		,120		,119		,120		,2147483648		,120		,2147483648		,2147483648		,120		,120		,120		,2147483648		,2147483648		,120		,120		,2147483648		,120		,2147483648		,120		,120		,2147483648		,2147483648		,120		,120		,120		,120		,120		,2147483648		,120		,2147483648		,120		,120		,120		,120		,2147483648		,120		,120		,120		,120		,120		,2147483648		,2147483648		,2147483648		,2147483648		,120		,2147483648		,120		,120		,2147483648		,120		,120		,120		,120		,2147483648		,120		,120		,120		,120		,2147483648		,120		,2147483648		,120		,2147483648		,120		,2147483648		,120		,2147483648		,120		,120		,120		,120		,2147483648		,2147483648		,2147483648		,120		,120		,120		,120		,120		,120		,120		,120		,2147483648		,2147483648		,120		,2147483648		,120		,120		,2147483648		,120	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{123		,123		,2147483648		,123		,123		,123		,123		,123		,123		,123		,2147483648		,123		,2147483648		,123		,123		,123		,123		,123		,123		,123		,123		,123		,123		,123		,123		,123		,2147483648		,123		,2147483648		,123		,2147483648		,123		,2147483648		,2147483648		,123		,123		,123		,2147483648		,2147483648		,123		,123		,2147483648		,123		,2147483648		,123		,123		,2147483648		,2147483648		,123		,123		,123		,122		,123		,2147483648		,123		,2147483648		,123		,123		,123		,123		,2147483648		,123		,123		,123		,123		,123		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648		,123		,123		,2147483648		,123		,123		,123		,123		,2147483648		,123		,123		,123		,123		,2147483648		,123		,2147483648		,123		,2147483648		,123		,2147483648		,123		,2147483648		,123		,123		,123		,123		,2147483648		,2147483648		,2147483648		,123		,123		,123		,123		,123		,123		,123		,123		,2147483648		,2147483648		,123		,2147483648		,123		,123		,2147483648		,123	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,129		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,155		,2147483648		,156		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,182		,224		,2147483648		,2147483648		,209		,2147483648		,2147483648		,212		,2147483648		,2147483648		,173		,214		,2147483648		,2147483648		,206		,216		,181		,177		,179		,196		,207		,2147483648		,2147483648		,200		,215		,218		,2147483648		,2147483648		,208		,221		,2147483648		,2147483648		,226		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,192		,2147483648		,2147483648		,2147483648		,186		,202		,2147483648		,2147483648		,194		,201		,211		,2147483648		,198		,2147483648		,176		,2147483648		,199		,2147483648		,193		,2147483648		,2147483648		,195		,2147483648		,2147483648		,183		,189		,2147483648		,222		,2147483648		,2147483648		,174		,2147483648		,2147483648		,187		,2147483648		,188		,190		,197		,184		,2147483648		,2147483648		,178		,204		,2147483648		,220		,185		,223		,2147483648		,2147483648		,191		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,180		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,175		,215		,2147483648		,2147483648		,205		,219		,217		,2147483648		,225		,210		,213		,2147483648		,203	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,172		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,172		,169		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,141		,2147483648		,2147483648		,2147483648		,2147483648		,142		,2147483648		,2147483648		,2147483648		,143		,2147483648		,138		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,132		,2147483648		,139		,2147483648		,2147483648		,145		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,140		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,145		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,144		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,28		,28		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,27		,28		,28		,28		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,28		,28		,28		,2147483648		,28	},
-	{2147483648		,168		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,168		,168		,2147483648		,2147483648		,168		,168		,168		,168		,168		,168		,168		,2147483648		,2147483648		,168		,168		,168		,2147483648		,2147483648		,168		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,168		,168		,2147483648		,2147483648		,168		,168		,168		,2147483648		,168		,2147483648		,168		,2147483648		,168		,2147483648		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,168		,168		,2147483648		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,168		,2147483648		,168		,168		,168		,168		,2147483648		,2147483648		,168		,168		,2147483648		,168		,168		,168		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,168		,2147483648		,168		,168		,2147483648		,2147483648		,168		,168		,168		,2147483648		,168		,168		,168		,2147483648		,168	},
-	{22		,22		,2147483648		,17		,22		,22		,22		,23		,22		,22		,2147483648		,22		,2147483648		,25		,22		,22		,21		,22		,22		,22		,22		,22		,19		,22		,22		,20		,2147483648		,22		,2147483648		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,2147483648		,20		,2147483648		,2147483648		,26		,22		,2147483648		,22		,2147483648		,22		,22		,2147483648		,2147483648		,22		,22		,22		,2147483648		,22		,2147483648		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,22		,22		,22		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,2147483648		,22		,22		,2147483648		,22		,22		,22		,22		,2147483648		,24		,22		,22		,22		,2147483648		,22		,2147483648		,18		,2147483648		,22		,2147483648		,16		,2147483648		,22		,2147483648		,22		,22		,2147483648		,2147483648		,2147483648		,22		,20		,22		,22		,20		,22		,22		,22		,2147483648		,2147483648		,22		,2147483648		,22		,22		,2147483648		,22	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,157		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,157		,157		,157		,157		,157		,2147483648		,2147483648		,157		,157		,157		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,157		,2147483648		,157		,2147483648		,157		,2147483648		,157		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,157		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,157		,2147483648		,157		,157		,157		,157		,2147483648		,2147483648		,157		,157		,2147483648		,157		,157		,157		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,157		,157		,2147483648		,2147483648		,157		,157		,157		,2147483648		,157		,157		,157		,2147483648		,157	},
-	{2147483648		,160		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,160		,160		,160		,160		,160		,2147483648		,2147483648		,160		,160		,160		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,160		,2147483648		,160		,2147483648		,160		,2147483648		,160		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,160		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,160		,2147483648		,160		,160		,160		,160		,2147483648		,2147483648		,160		,160		,2147483648		,160		,160		,160		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,160		,160		,2147483648		,2147483648		,160		,160		,160		,2147483648		,160		,160		,160		,2147483648		,160	}
-};
-const char* KeywordList[]= {
-"print",
-"formats",
-"event_enable",
-"event_disable",
-"event_clear",
+"=",
+"_local_id"
+};
+const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
+{
+	{0		,2147483648		,0		,2147483648		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,2147483648		,0		,2147483648		,2147483648		,2147483648		,0		,2147483648		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,2		,2147483648		,0		,2147483648		,2147483648		,2147483648		,0		,0		,2147483648		,2		,0		,0		,0		,0		,0		,2147483648		,2147483648		,0		,0		,0		,0		,0		,2147483648		,1		,0		,0		,2147483648		,2147483648		,2147483648		,0		,2147483648		,2147483648		,2147483648		,2147483648		,0		,0		,0		,0		,0		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,0		,0		,2147483648		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,2147483648		,2147483648		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,2147483648		,0		,0		,0		,0		,0		,2147483648		,0		,0		,2147483648		,0	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,125		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648	},
+	{127		,127		,127		,2147483648		,127		,2147483648		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127		,2147483648		,2147483648		,2147483648		,127		,2147483648		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,2147483648		,127		,2147483648		,2147483648		,2147483648		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,2147483648		,127		,127		,127		,127		,127		,126		,127		,127		,127		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,127		,127		,127		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,2147483648		,127		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,2147483648		,2147483648		,127		,2147483648		,127		,127		,127		,127		,127		,2147483648		,127		,127		,127		,127		,127		,127		,127		,127		,127		,127		,2147483648		,127		,127		,2147483648		,127	},
+	{244		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,244		,2147483648		,244		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,244		,244		,2147483648		,244		,244		,2147483648		,2147483648		,244		,2147483648		,2147483648		,244		,244		,2147483648		,244		,2147483648		,2147483648		,244		,2147483648		,2147483648		,244		,244		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,244		,244		,2147483648		,244		,244		,2147483648		,2147483648		,244		,244		,244		,2147483648		,244		,2147483648		,244		,244		,244		,2147483648		,2147483648		,2147483648		,244		,244		,2147483648		,2147483648		,244		,244		,244		,2147483648		,2147483648		,245		,244		,244		,244		,244		,244		,244		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,244		,2147483648		,244		,2147483648		,244		,244		,244		,2147483648		,2147483648		,244		,2147483648		,244	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{98		,2147483648		,117		,2147483648		,74		,2147483648		,2147483648		,106		,75		,108		,71		,107		,2147483648		,58		,104		,2147483648		,76		,2147483648		,2147483648		,2147483648		,116		,2147483648		,2147483648		,110		,2147483648		,60		,122		,91		,2147483648		,2147483648		,86		,2147483648		,2147483648		,94		,72		,2147483648		,2147483648		,85		,2147483648		,2147483648		,2147483648		,67		,2147483648		,2147483648		,2147483648		,100		,114		,2147483648		,87		,118		,2147483648		,2147483648		,70		,95		,69		,109		,59		,2147483648		,2147483648		,119		,62		,2147483648		,2147483648		,2147483648		,57		,2147483648		,2147483648		,2147483648		,2147483648		,97		,79		,103		,64		,105		,112		,65		,55		,2147483648		,113		,2147483648		,121		,82		,2147483648		,101		,89		,93		,2147483648		,120		,2147483648		,99		,83		,53		,66		,84		,2147483648		,80		,68		,61		,2147483648		,2147483648		,2147483648		,2147483648		,115		,90		,111		,2147483648		,54		,2147483648		,88		,56		,73		,102		,2147483648		,81		,63		,78		,96		,92		,2147483648		,2147483648		,77		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,155		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,152		,2147483648		,2147483648		,145		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,142		,2147483648		,2147483648		,146		,2147483648		,2147483648		,148		,2147483648		,2147483648		,144		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,140		,2147483648		,2147483648		,149		,2147483648		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,143		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,141		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,174		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,168		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,169		,2147483648		,2147483648		,170		,2147483648	},
+	{167		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,167		,2147483648		,167		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,167		,167		,2147483648		,167		,167		,2147483648		,2147483648		,167		,2147483648		,2147483648		,167		,167		,2147483648		,167		,2147483648		,2147483648		,167		,2147483648		,2147483648		,167		,167		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,167		,167		,167		,2147483648		,167		,167		,2147483648		,2147483648		,167		,167		,167		,2147483648		,167		,2147483648		,167		,167		,167		,2147483648		,2147483648		,2147483648		,167		,167		,2147483648		,2147483648		,167		,167		,167		,2147483648		,2147483648		,2147483648		,167		,167		,167		,167		,167		,167		,2147483648		,2147483648		,2147483648		,167		,2147483648		,2147483648		,167		,2147483648		,167		,2147483648		,167		,167		,167		,2147483648		,2147483648		,167		,2147483648		,167	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{171		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,171		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,171		,2147483648		,171		,171		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,171		,171		,2147483648		,171		,171		,2147483648		,2147483648		,171		,2147483648		,2147483648		,171		,171		,2147483648		,171		,2147483648		,2147483648		,171		,2147483648		,2147483648		,171		,171		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,171		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,171		,171		,2147483648		,171		,171		,2147483648		,2147483648		,171		,171		,171		,2147483648		,171		,2147483648		,171		,171		,171		,2147483648		,2147483648		,2147483648		,171		,171		,2147483648		,2147483648		,171		,171		,171		,2147483648		,2147483648		,2147483648		,171		,171		,171		,171		,171		,171		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,171		,2147483648		,171		,2147483648		,171		,171		,171		,2147483648		,2147483648		,171		,2147483648		,171	},
+	{9		,2147483648		,9		,2147483648		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,2147483648		,9		,9		,2147483648		,9		,2147483648		,2147483648		,2147483648		,9		,2147483648		,12		,9		,2147483648		,9		,9		,9		,5		,8		,9		,11		,2147483648		,9		,9		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,9		,7		,2147483648		,2147483648		,9		,9		,3		,9		,9		,2147483648		,2147483648		,9		,9		,9		,9		,9		,2147483648		,2147483648		,9		,9		,2147483648		,2147483648		,2147483648		,9		,2147483648		,2147483648		,2147483648		,2147483648		,9		,9		,9		,9		,9		,9		,9		,9		,7		,9		,2147483648		,9		,9		,4		,9		,9		,9		,2147483648		,9		,2147483648		,9		,9		,9		,9		,9		,2147483648		,9		,9		,9		,2147483648		,2147483648		,7		,2147483648		,9		,9		,9		,10		,9		,2147483648		,9		,9		,9		,9		,2147483648		,9		,9		,9		,9		,9		,2147483648		,6		,9		,2147483648		,7	},
+	{164		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,164		,2147483648		,164		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,164		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,164		,2147483648		,164		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,164		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,164		,2147483648		,164		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,2147483648		,164		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,164		,164		,164		,2147483648		,164		,164		,2147483648		,2147483648		,164		,164		,164		,2147483648		,164		,2147483648		,164		,164		,164		,2147483648		,2147483648		,2147483648		,164		,164		,2147483648		,2147483648		,164		,164		,164		,2147483648		,2147483648		,2147483648		,164		,164		,164		,164		,164		,164		,2147483648		,2147483648		,2147483648		,164		,2147483648		,2147483648		,164		,2147483648		,164		,2147483648		,164		,164		,164		,2147483648		,2147483648		,164		,2147483648		,164	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,33		,2147483648	},
+	{131		,131		,131		,2147483648		,131		,2147483648		,2147483648		,131		,131		,131		,131		,131		,2147483648		,131		,131		,2147483648		,131		,2147483648		,2147483648		,2147483648		,131		,2147483648		,131		,131		,2147483648		,131		,131		,131		,131		,131		,131		,131		,2147483648		,131		,131		,131		,2147483648		,131		,2147483648		,2147483648		,2147483648		,131		,131		,2147483648		,131		,131		,131		,131		,131		,131		,2147483648		,2147483648		,131		,131		,131		,131		,131		,2147483648		,131		,131		,131		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,131		,131		,131		,131		,131		,131		,131		,131		,131		,131		,2147483648		,131		,131		,131		,131		,131		,131		,2147483648		,131		,2147483648		,131		,131		,131		,131		,131		,2147483648		,131		,131		,131		,2147483648		,2147483648		,131		,2147483648		,131		,131		,131		,131		,131		,2147483648		,131		,131		,131		,131		,2147483648		,131		,131		,131		,131		,131		,2147483648		,131		,131		,2147483648		,131	},
+	{13		,13		,13		,2147483648		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13		,2147483648		,2147483648		,2147483648		,13		,2147483648		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,15		,2147483648		,13		,2147483648		,2147483648		,2147483648		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,2147483648		,2147483648		,13		,13		,13		,13		,13		,2147483648		,14		,13		,13		,2147483648		,2147483648		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,13		,13		,13		,13		,13		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,13		,13		,2147483648		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,2147483648		,2147483648		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,2147483648		,13		,13		,13		,13		,13		,2147483648		,13		,13		,2147483648		,13	},
+	{241		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,241		,2147483648		,241		,2147483648		,241		,2147483648		,2147483648		,241		,2147483648		,241		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,241		,241		,2147483648		,241		,241		,2147483648		,2147483648		,241		,2147483648		,2147483648		,241		,241		,2147483648		,241		,2147483648		,2147483648		,241		,2147483648		,2147483648		,241		,241		,2147483648		,241		,2147483648		,241		,2147483648		,2147483648		,241		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,240		,241		,241		,241		,2147483648		,241		,241		,2147483648		,2147483648		,241		,241		,241		,2147483648		,241		,2147483648		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,241		,2147483648		,2147483648		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,241		,241		,241		,241		,241		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,241		,2147483648		,241		,2147483648		,241		,241		,241		,2147483648		,2147483648		,241		,2147483648		,241	},
+	{175		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,175		,2147483648		,175		,2147483648		,175		,2147483648		,2147483648		,175		,2147483648		,175		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,175		,175		,2147483648		,175		,175		,2147483648		,2147483648		,175		,2147483648		,2147483648		,175		,175		,2147483648		,175		,2147483648		,2147483648		,175		,2147483648		,2147483648		,175		,175		,2147483648		,175		,2147483648		,175		,2147483648		,2147483648		,175		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,175		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,175		,175		,2147483648		,175		,175		,2147483648		,2147483648		,175		,175		,175		,2147483648		,175		,2147483648		,175		,175		,175		,2147483648		,2147483648		,2147483648		,175		,175		,2147483648		,2147483648		,175		,175		,175		,2147483648		,2147483648		,2147483648		,175		,175		,175		,175		,175		,175		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,175		,2147483648		,175		,2147483648		,175		,175		,175		,2147483648		,2147483648		,175		,2147483648		,175	},
+	{130		,130		,130		,2147483648		,130		,2147483648		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,2147483648		,130		,2147483648		,2147483648		,2147483648		,130		,2147483648		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,2147483648		,130		,2147483648		,2147483648		,2147483648		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,2147483648		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,130		,130		,130		,130		,130		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,130		,130		,2147483648		,130		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,2147483648		,2147483648		,130		,2147483648		,130		,130		,130		,130		,130		,2147483648		,130		,130		,130		,130		,129		,130		,130		,130		,130		,130		,2147483648		,130		,130		,2147483648		,130	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,40		,2147483648		,2147483648		,43		,2147483648		,2147483648		,47		,2147483648		,2147483648		,49		,2147483648		,2147483648		,45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,41		,2147483648		,2147483648		,50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,42		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,176		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,177		,179		,179		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,179		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136	},
+	{246		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,246		,2147483648		,246		,2147483648		,246		,2147483648		,2147483648		,246		,2147483648		,246		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,246		,246		,2147483648		,246		,246		,2147483648		,247		,246		,2147483648		,2147483648		,246		,246		,2147483648		,246		,2147483648		,2147483648		,246		,2147483648		,2147483648		,246		,246		,2147483648		,246		,2147483648		,246		,2147483648		,2147483648		,246		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,246		,246		,2147483648		,246		,246		,2147483648		,2147483648		,246		,246		,246		,2147483648		,246		,2147483648		,246		,246		,246		,2147483648		,2147483648		,2147483648		,246		,246		,2147483648		,2147483648		,246		,246		,246		,2147483648		,2147483648		,2147483648		,246		,246		,246		,246		,246		,246		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,246		,2147483648		,246		,2147483648		,246		,246		,246		,2147483648		,2147483648		,246		,2147483648		,246	},
+	{2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{28		,2147483648		,2147483648		,27		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,28		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,28		,28		,28		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,28		,2147483648		,28		,28		,28		,2147483648		,2147483648		,2147483648		,28		,28		,2147483648		,2147483648		,28		,28		,28		,2147483648		,2147483648		,2147483648		,28		,28		,28		,28		,28		,28		,2147483648		,2147483648		,2147483648		,28		,2147483648		,2147483648		,28		,2147483648		,28		,2147483648		,28		,28		,28		,2147483648		,2147483648		,28		,2147483648		,28	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,162		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,163		,2147483648	},
+	{22		,26		,22		,2147483648		,22		,2147483648		,2147483648		,22		,22		,22		,22		,22		,2147483648		,22		,22		,2147483648		,22		,2147483648		,2147483648		,2147483648		,22		,2147483648		,25		,22		,2147483648		,22		,22		,22		,18		,21		,22		,24		,2147483648		,22		,22		,2147483648		,2147483648		,22		,2147483648		,2147483648		,2147483648		,22		,20		,2147483648		,2147483648		,22		,22		,16		,22		,22		,2147483648		,2147483648		,22		,22		,22		,22		,22		,2147483648		,2147483648		,22		,22		,2147483648		,2147483648		,2147483648		,22		,2147483648		,2147483648		,2147483648		,2147483648		,22		,22		,22		,22		,22		,22		,22		,22		,20		,22		,2147483648		,22		,22		,17		,22		,22		,22		,2147483648		,22		,2147483648		,22		,22		,22		,22		,22		,2147483648		,22		,22		,22		,2147483648		,2147483648		,20		,2147483648		,22		,22		,22		,23		,22		,2147483648		,22		,22		,22		,22		,2147483648		,22		,22		,22		,22		,22		,2147483648		,19		,22		,2147483648		,20	},
+	{2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,165		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648	},
+	{158		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,158		,2147483648		,158		,2147483648		,158		,2147483648		,2147483648		,158		,2147483648		,158		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,158		,158		,2147483648		,158		,158		,2147483648		,2147483648		,158		,2147483648		,2147483648		,158		,158		,2147483648		,158		,2147483648		,2147483648		,158		,2147483648		,2147483648		,158		,158		,2147483648		,158		,2147483648		,158		,2147483648		,2147483648		,158		,2147483648		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,158		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,158		,158		,2147483648		,158		,158		,2147483648		,2147483648		,158		,158		,158		,2147483648		,158		,2147483648		,158		,158		,158		,2147483648		,2147483648		,2147483648		,158		,158		,2147483648		,2147483648		,158		,158		,158		,2147483648		,2147483648		,2147483648		,158		,158		,158		,158		,158		,158		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,158		,2147483648		,158		,2147483648		,158		,158		,158		,2147483648		,2147483648		,158		,2147483648		,158	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,39	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,31	},
+	{128		,128		,128		,2147483648		,128		,2147483648		,2147483648		,128		,128		,128		,128		,128		,2147483648		,128		,128		,2147483648		,128		,2147483648		,2147483648		,2147483648		,128		,2147483648		,128		,128		,2147483648		,128		,128		,128		,128		,128		,128		,128		,2147483648		,128		,128		,128		,2147483648		,128		,2147483648		,2147483648		,2147483648		,128		,128		,2147483648		,128		,128		,128		,128		,128		,128		,2147483648		,2147483648		,128		,128		,128		,128		,128		,2147483648		,128		,128		,128		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,128		,128		,128		,128		,128		,128		,128		,128		,128		,128		,2147483648		,128		,128		,128		,128		,128		,128		,2147483648		,128		,2147483648		,128		,128		,128		,128		,128		,2147483648		,128		,128		,128		,2147483648		,2147483648		,128		,2147483648		,128		,128		,128		,128		,128		,2147483648		,128		,128		,128		,128		,128		,128		,128		,128		,128		,128		,2147483648		,128		,128		,2147483648		,128	},
+	{202		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,210		,2147483648		,212		,2147483648		,211		,2147483648		,2147483648		,208		,2147483648		,180		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,214		,2147483648		,2147483648		,220		,195		,2147483648		,223		,190		,2147483648		,2147483648		,198		,2147483648		,2147483648		,227		,189		,2147483648		,224		,2147483648		,2147483648		,222		,2147483648		,2147483648		,204		,218		,2147483648		,191		,2147483648		,232		,2147483648		,2147483648		,199		,2147483648		,213		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,229		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,183		,207		,2147483648		,209		,216		,2147483648		,2147483648		,222		,217		,221		,2147483648		,186		,2147483648		,205		,193		,197		,2147483648		,2147483648		,2147483648		,203		,187		,2147483648		,2147483648		,188		,228		,184		,2147483648		,2147483648		,2147483648		,230		,222		,226		,219		,194		,215		,2147483648		,2147483648		,2147483648		,192		,2147483648		,2147483648		,206		,2147483648		,185		,2147483648		,182		,200		,196		,2147483648		,2147483648		,181		,2147483648		,222	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{161		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,161		,2147483648		,161		,2147483648		,161		,2147483648		,2147483648		,161		,2147483648		,161		,161		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,161		,161		,2147483648		,161		,161		,2147483648		,2147483648		,161		,2147483648		,2147483648		,161		,161		,2147483648		,161		,2147483648		,2147483648		,161		,2147483648		,2147483648		,161		,161		,2147483648		,161		,2147483648		,161		,2147483648		,2147483648		,161		,2147483648		,161		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,161		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,161		,161		,2147483648		,161		,161		,2147483648		,2147483648		,161		,161		,161		,2147483648		,161		,2147483648		,161		,161		,161		,2147483648		,2147483648		,2147483648		,161		,161		,2147483648		,2147483648		,161		,161		,161		,2147483648		,2147483648		,2147483648		,161		,161		,161		,161		,161		,161		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,161		,2147483648		,161		,2147483648		,161		,161		,161		,2147483648		,2147483648		,161		,2147483648		,161	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	}
+};
+const char* KeywordList[]= {
+"print",
+"formats",
+"event_enable",
+"event_disable",
+"event_clear",
 "test_statement",
 "spinlock_lock",
 "spinlock_unlock",
 "event_sc",
+"map_print",
+"map_clear",
 "printf",
 "pause",
 "flush",
@@ -974,6 +1004,8 @@ const char* KeywordList[]= {
 "event_trace_instrumentation_step_in",
 "spinlock_lock_custom_wait",
 "event_inject",
+"map_count",
+"hist",
 "poi",
 "db",
 "dd",
@@ -1017,6 +1049,9 @@ const char* KeywordList[]= {
 "event_inject_error_code",
 "memcpy",
 "memcpy_pa",
+"map_sum",
+"map_min",
+"map_max",
 "wcsncmp",
 "poi",
 "db",
@@ -1103,6 +1138,9 @@ const char* ThreeOpFunc2[] = {
 "@EVENT_INJECT_ERROR_CODE",
 "@MEMCPY",
 "@MEMCPY_PA",
+"@MAP_SUM",
+"@MAP_MIN",
+"@MAP_MAX",
 };
 const char* TwoOpFunc1[] = {
 "@ED",
@@ -1117,6 +1155,8 @@ const char* TwoOpFunc1[] = {
 const char* TwoOpFunc2[] = {
 "@SPINLOCK_LOCK_CUSTOM_WAIT",
 "@EVENT_INJECT",
+"@MAP_COUNT",
+"@HIST",
 };
 const char* OneOpFunc1[] = {
 "@POI",
@@ -1155,6 +1195,8 @@ const char* OneOpFunc2[] = {
 "@SPINLOCK_LOCK",
 "@SPINLOCK_UNLOCK",
 "@EVENT_SC",
+"@MAP_PRINT",
+"@MAP_CLEAR",
 };
 const char* OneOpFunc3[] = {
 "@STRLEN"
@@ -1233,6 +1275,8 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@SPINLOCK_LOCK", FUNC_SPINLOCK_LOCK},
 {"@SPINLOCK_UNLOCK", FUNC_SPINLOCK_UNLOCK},
 {"@EVENT_SC", FUNC_EVENT_SC},
+{"@MAP_PRINT", FUNC_MAP_PRINT},
+{"@MAP_CLEAR", FUNC_MAP_CLEAR},
 {"@PRINTF", FUNC_PRINTF},
 {"@PAUSE", FUNC_PAUSE},
 {"@FLUSH", FUNC_FLUSH},
@@ -1243,6 +1287,8 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EVENT_TRACE_INSTRUMENTATION_STEP_IN", FUNC_EVENT_TRACE_INSTRUMENTATION_STEP_IN},
 {"@SPINLOCK_LOCK_CUSTOM_WAIT", FUNC_SPINLOCK_LOCK_CUSTOM_WAIT},
 {"@EVENT_INJECT", FUNC_EVENT_INJECT},
+{"@MAP_COUNT", FUNC_MAP_COUNT},
+{"@HIST", FUNC_HIST},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
 {"@DD", FUNC_DD},
@@ -1286,6 +1332,9 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EVENT_INJECT_ERROR_CODE", FUNC_EVENT_INJECT_ERROR_CODE},
 {"@MEMCPY", FUNC_MEMCPY},
 {"@MEMCPY_PA", FUNC_MEMCPY_PA},
+{"@MAP_SUM", FUNC_MAP_SUM},
+{"@MAP_MIN", FUNC_MAP_MIN},
+{"@MAP_MAX", FUNC_MAP_MAX},
 {"@WCSNCMP", FUNC_WCSNCMP},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
@@ -1811,111 +1860,111 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 };
 const char* LalrNoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"CMP",
-"BE",
-"STRING",
-"B1",
-"B3",
-"E4",
-"StringNumber",
-"WstringNumber",
 "S",
-"VA2",
-"B5",
-"B4",
-"B2",
-"B6",
-"E10",
 "E13",
 "WSTRING",
+"B2",
+"StringNumber",
+"E3",
+"E4",
+"VA2",
 "E5",
+"WstringNumber",
+"B3",
+"B1",
 "VA3",
+"CMP",
 "EXP",
+"B5",
+"BE",
 "E12",
-"E3"
+"STRING",
+"B4",
+"B6",
+"E10"
 };
 const char* LalrTerminalMap[TERMINAL_COUNT]= 
 {
+"dd_pa",
+"_function_id",
+"disassemble_len",
+"+",
+"<=",
+"poi_pa",
+"_wstring",
+"-",
+"_function_parameter_id",
+"~",
+"_decimal",
+"_octal",
+"wcscmp",
+"eb_pa",
+"<",
+"interlocked_decrement",
 ">>",
-"!=",
-"ed",
-",",
-"dw",
 "check_address",
-"~",
-"memcmp",
-"neg",
-"ed_pa",
+"%",
+"||",
+"^",
+"eq_pa",
 "strcmp",
-"eb",
-"wcscmp",
-"_string",
+"_hex",
 "_binary",
+")",
+"db_pa",
+"ed_pa",
+">",
+"dw",
+"eq",
+"_register",
+"|",
+"_string",
+"interlocked_exchange_add",
 "disassemble_len64",
-"low_pa",
-"poi",
+"dq_pa",
+"eb",
+"memcmp",
+"$",
+"wcslen",
+"_global_id",
+">=",
+"strncmp",
+"disassemble_len32",
+"interlocked_exchange",
 "_pseudo_register",
-"+",
+"_local_id",
+"==",
+"*",
+"poi",
+"neg",
 "&",
-"<=",
 "(",
-"poi_pa",
-"dd_pa",
-"==",
-"$",
-"&&",
-"|",
-"_global_id",
-"disassemble_len",
-"interlocked_compare_exchange",
-"/",
-"low",
-"^",
-"physical_to_virtual",
-"<<",
-")",
-"<",
-"_function_parameter_id",
-"_function_id",
-"_wstring",
-"not",
-"hi_pa",
-"dq",
-"-",
-"_register",
 "hi",
-"dw_pa",
+"hi_pa",
+"ed",
+"!=",
 "dd",
-"_local_id",
-">=",
-"strlen",
-"db",
 "interlocked_increment",
-"eq",
-"interlocked_exchange_add",
-"eq_pa",
-"_hex",
-"%",
-"_octal",
-"interlocked_decrement",
-"db_pa",
-"*",
-"wcslen",
-"reference",
+"physical_to_virtual",
+"/",
+"<<",
+"low_pa",
 "virtual_to_physical",
-">",
-"dq_pa",
-"interlocked_exchange",
-"eb_pa",
-"strncmp",
+"db",
+",",
+"dw_pa",
+"low",
+"interlocked_compare_exchange",
+"strlen",
+"not",
+"dq",
 "wcsncmp",
-"_decimal",
-"disassemble_len32",
-"||"
+"&&",
+"reference"
 };
 const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]= 
 {
-	{9		,2		,2147483648		,3		,5		,12		,2147483648		,2147483648		,1		,2147483648		,7		,6		,4		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
+	{1		,16		,2147483648		,4		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,3		,2147483648		,9		,10		,7		,2		,15		,2147483648		,6		,8		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -1935,14 +1984,11 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,94		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,99		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,101		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -1957,104 +2003,107 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,113		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,4		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,3		,2147483648		,9		,10		,7		,113		,15		,2147483648		,6		,8		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,120		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{9		,129		,2147483648		,3		,5		,12		,2147483648		,2147483648		,2147483648		,2147483648		,7		,6		,4		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,126		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{9		,2147483648		,2147483648		,2147483648		,5		,12		,2147483648		,2147483648		,2147483648		,2147483648		,7		,6		,140		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
-	{9		,2147483648		,2147483648		,2147483648		,141		,12		,2147483648		,2147483648		,2147483648		,2147483648		,7		,6		,2147483648		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
-	{9		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,7		,142		,2147483648		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
-	{9		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,143		,2147483648		,2147483648		,8		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
-	{9		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,144		,14		,16		,2147483648		,13		,2147483648		,10		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,145		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,146		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,147		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,148		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,149		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,150		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,153		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,154		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,155		,16		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,156		,16		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,157		,16		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,159		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,158		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,160		,15		,11	},
+	{2147483648		,16		,2147483648		,140		,2147483648		,11		,12		,2147483648		,13		,2147483648		,5		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,6		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,141		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,6		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,7		,2147483648		,15		,2147483648		,142		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,143		,2147483648		,15		,2147483648		,2147483648		,8		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,9		,10		,2147483648		,2147483648		,15		,2147483648		,2147483648		,144		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,145		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,146		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,147		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,148		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,149		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,150		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,151		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,152		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,153		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,154		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,155	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,156	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,157	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,159		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,158		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,160		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,161		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,164		,2147483648		,2147483648		,2147483648		,2147483648		,162		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,168		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,170		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,171		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,172		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,173		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,174		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,175		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,176		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,177		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,178		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,179		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,181		,2147483648		,2147483648		,2147483648		,2147483648		,180		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,183		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,182		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,184		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,185		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,186		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,187		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,161		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,162		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,163		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,164		,15		,11	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,190		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,191		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,192		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,193		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,194		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,195		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,165		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,196		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,197		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,198		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,199		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,200		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,166		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,167		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,168		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,169		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,170		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,171		,15		,11	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,174		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,178		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,177		,13		,2147483648		,176		,15		,11	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,180		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,181		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,182		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,201		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,202		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,203		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,204		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,183		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,184		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,185		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,187		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,177		,13		,2147483648		,186		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,188		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,189		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,190		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,191		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,192		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,205		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,206		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,207		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,208		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,209		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,193		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,194		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,195		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,196		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,198		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,177		,13		,2147483648		,197		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,201		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,200		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,202		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,203		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,204		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,205		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,206		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,207		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,208		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,209		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,210		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,210		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2073,7 +2122,7 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,211		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2127,53 +2176,53 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,258		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,258		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,259		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,259		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,260		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,260		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,261		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,262		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,263		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,264		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,265		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,261		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,266		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,267		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,262		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,263		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,177		,13		,2147483648		,176		,15		,11	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,264		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,173		,2147483648		,2147483648		,12		,265		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,172		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,266		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,267		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,268		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,269		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,270		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,177		,13		,2147483648		,176		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,268		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,163		,2147483648		,2147483648		,11		,12		,2147483648		,13		,269		,2147483648		,2147483648		,2147483648		,2147483648		,189		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,270		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,166		,2147483648		,2147483648		,15		,167		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,271		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,272		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,273		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,271		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,272		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,273		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,274		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,274		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2193,17 +2242,17 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,290		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,290		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,291		,15		,11	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,292		,15		,11	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,291		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,292		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
+	{2147483648		,16		,2147483648		,2147483648		,2147483648		,11		,12		,2147483648		,13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,293		,2147483648		,2147483648		,15		,2147483648		,2147483648		,2147483648		,14	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,14		,16		,2147483648		,13		,2147483648		,293		,15		,11	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
 	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
@@ -2216,304 +2265,304 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 };
 const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT]= 
 {
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483647		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-1		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,-6		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,-8		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,77		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,-10		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,-12		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12	},
-	{2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,81		,2147483648		,2147483648		,2147483648		,82		,-13		,-13		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,-13		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13	},
-	{2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,-20		,2147483648		,2147483648		,2147483648		,-20		,-20		,-20		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20	},
-	{85		,-21		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,-21		,2147483648		,2147483648		,2147483648		,-21		,-21		,-21		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,86		,-21		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21	},
-	{-24		,-24		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,-24		,-24		,2147483648		,2147483648		,2147483648		,-24		,-24		,-24		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,-24		,-24		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24	},
-	{-27		,-27		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,-27		,-27		,2147483648		,2147483648		,2147483648		,-27		,-27		,-27		,-27		,2147483648		,2147483648		,2147483648		,91		,2147483648		,-27		,2147483648		,-27		,-27		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,89		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27	},
-	{-31		,-31		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,-31		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,-31		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31	},
-	{-32		,-32		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,-32		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,-32		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-85		,-85		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,-85		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,-85		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,2147483648		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,2147483648		,2147483648		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,2147483648		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,2147483648		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,2147483648		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,2147483648		,2147483648		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,2147483648		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,2147483648		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,2147483648		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,2147483648		,2147483648		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,2147483648		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,2147483648		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-90		,-90		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,-90		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,-90		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,104		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,105		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-86		,-86		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,-86		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,-86		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,106		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-88		,-88		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,-88		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,-88		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,107		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,108		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,109		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,110		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,111		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,112		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,2147483648		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,2147483648		,2147483648		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,2147483648		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,2147483648		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,114		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,115		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,116		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,117		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,119		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-89		,-89		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,-89		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,-89		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,120		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,122		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,2147483648		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,2147483648		,2147483648		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,2147483648		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,2147483648		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-87		,-87		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,-87		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,-87		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,125		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,126		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-83		,-83		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,-83		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,-83		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-84		,-84		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,-84		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,-84		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,131		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-91		,-91		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,-91		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,-91		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,137		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,138		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,-94		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-35		,-35		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,-35		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,-35		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-36		,-36		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,-36		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,-36		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-37		,-37		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,-37		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,-37		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,179		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-34		,-34		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,-34		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,-34		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,179		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-33		,-33		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,-33		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,-33		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,179		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,199		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,-5		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,-7		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,77		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,-9		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,-11		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11	},
-	{2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,-16		,2147483648		,2147483648		,2147483648		,-16		,-16		,-16		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16	},
-	{2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,-15		,2147483648		,2147483648		,2147483648		,-15		,-15		,-15		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15	},
-	{2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,-17		,2147483648		,2147483648		,2147483648		,-17		,-17		,-17		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17	},
-	{2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,-18		,2147483648		,2147483648		,2147483648		,-18		,-18		,-18		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18	},
-	{2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,-14		,2147483648		,2147483648		,2147483648		,-14		,-14		,-14		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14	},
-	{2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,-19		,2147483648		,2147483648		,2147483648		,-19		,-19		,-19		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19	},
-	{-22		,-22		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,-22		,-22		,2147483648		,2147483648		,2147483648		,-22		,-22		,-22		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,-22		,-22		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22	},
-	{-23		,-23		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,87		,-23		,-23		,2147483648		,2147483648		,2147483648		,-23		,-23		,-23		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,-23		,-23		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23	},
-	{-25		,-25		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,-25		,-25		,2147483648		,2147483648		,2147483648		,-25		,-25		,-25		,-25		,2147483648		,2147483648		,2147483648		,91		,2147483648		,-25		,2147483648		,-25		,-25		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,89		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25	},
-	{-26		,-26		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,-26		,-26		,2147483648		,2147483648		,2147483648		,-26		,-26		,-26		,-26		,2147483648		,2147483648		,2147483648		,91		,2147483648		,-26		,2147483648		,-26		,-26		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,90		,2147483648		,2147483648		,2147483648		,89		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26	},
-	{-30		,-30		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,-30		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,-30		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30	},
-	{-29		,-29		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,-29		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,-29		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29	},
-	{-28		,-28		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,-28		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,-28		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28	},
-	{2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,213		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,214		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,216		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,217		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,220		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,221		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,224		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,229		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-82		,-82		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,-82		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,-82		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,250		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,251		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,252		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,253		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,254		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,255		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,256		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,257		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-92		,-92		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,-92		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,-92		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92	},
-	{-46		,-46		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,-46		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,-46		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46	},
-	{-55		,-55		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,-55		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,-55		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55	},
-	{-61		,-61		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,-61		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,-61		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-44		,-44		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,-44		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,-44		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-50		,-50		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,-50		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,-50		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50	},
-	{-52		,-52		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,-52		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,-52		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52	},
-	{-62		,-62		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,-62		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,-62		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62	},
-	{-39		,-39		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,-39		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,-39		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-45		,-45		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,-45		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,-45		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,179		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,175		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-40		,-40		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,-40		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,-40		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,179		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-41		,-41		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,-41		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,-41		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41	},
-	{-60		,-60		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,-60		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,-60		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60	},
-	{-64		,-64		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,-64		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,-64		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64	},
-	{-43		,-43		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,-43		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,-43		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43	},
-	{-58		,-58		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,-58		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,-58		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58	},
-	{-38		,-38		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,-38		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,-38		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38	},
-	{-54		,-54		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,-54		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,-54		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54	},
-	{-57		,-57		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,-57		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,-57		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57	},
-	{-42		,-42		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,-42		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,-42		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42	},
-	{-49		,-49		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,-49		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,-49		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49	},
-	{-79		,-79		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,-79		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,-79		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79	},
-	{-48		,-48		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,-48		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,-48		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48	},
-	{-75		,-75		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,-75		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,-75		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75	},
-	{-56		,-56		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,-56		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,-56		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56	},
-	{-59		,-59		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,-59		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,-59		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59	},
-	{-51		,-51		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,-51		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,-51		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-63		,-63		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,-63		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,-63		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-53		,-53		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,-53		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,-53		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53	},
-	{-47		,-47		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,-47		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,-47		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,275		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,276		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,277		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,278		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,279		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,280		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,281		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,282		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,283		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,284		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,285		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,286		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,287		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,288		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,289		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-72		,-72		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,-72		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,-72		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72	},
-	{-66		,-66		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,-66		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,-66		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66	},
-	{-69		,-69		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,-69		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,-69		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69	},
-	{-76		,-76		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,-76		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,-76		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-73		,-73		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,-73		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,-73		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73	},
-	{-68		,-68		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,-68		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,-68		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68	},
-	{-67		,-67		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,-67		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,-67		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67	},
-	{-70		,-70		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,-70		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,-70		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70	},
-	{-80		,-80		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,-80		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,-80		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80	},
-	{-71		,-71		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,-71		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,-71		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71	},
-	{2147483648		,2147483648		,73		,2147483648		,47		,72		,20		,39		,51		,23		,37		,26		,46		,2147483648		,29		,30		,48		,54		,65		,42		,27		,2147483648		,62		,52		,31		,2147483648		,2147483648		,2147483648		,2147483648		,61		,28		,70		,2147483648		,36		,2147483648		,64		,2147483648		,2147483648		,2147483648		,33		,19		,2147483648		,18		,66		,58		,53		,59		,24		,69		,43		,17		,2147483648		,63		,32		,71		,45		,34		,41		,55		,2147483648		,49		,56		,22		,25		,60		,21		,57		,2147483648		,50		,44		,68		,40		,38		,35		,67		,2147483648	},
-	{-65		,-65		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,-65		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,-65		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,294		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,295		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,296		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
-	{-81		,-81		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,-81		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,-81		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81	},
-	{-77		,-77		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,-77		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,-77		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77	},
-	{-78		,-78		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,-78		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,-78		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78	},
-	{-74		,-74		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,-74		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,-74		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74	}
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483647		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-1		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-2		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-4		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-6		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,77		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-8		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-10		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-12		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,84		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,82		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,81		,2147483648		,2147483648		,2147483648		,-13		,2147483648		,2147483648		,2147483648		,2147483648		,80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-13		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-20		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,86		,2147483648		,2147483648		,-21		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,85		,2147483648		,2147483648		,2147483648		,-21		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-21		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-24		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,-24		,2147483648		,2147483648		,-24		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,-24		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-24		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-27		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,-27		,2147483648		,90		,-27		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,91		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,89		,-27		,2147483648		,2147483648		,2147483648		,-27		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-27		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,-31		,2147483648		,-31		,-31		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,-31		,-31		,2147483648		,2147483648		,2147483648		,-31		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-31		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,-32		,2147483648		,-32		,-32		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,-32		,-32		,2147483648		,2147483648		,2147483648		,-32		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-32		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,94		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,-88		,2147483648		,-88		,-88		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,-88		,-88		,2147483648		,2147483648		,2147483648		,-88		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-88		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-93		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,-84		,2147483648		,-84		,-84		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,-84		,-84		,2147483648		,2147483648		,2147483648		,-84		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-84		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,-83		,2147483648		,-83		,-83		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,-83		,-83		,2147483648		,2147483648		,2147483648		,-83		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-83		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,-89		,2147483648		,-89		,-89		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,-89		,-89		,2147483648		,2147483648		,2147483648		,-89		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-89		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,104		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,105		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,-86		,2147483648		,-86		,-86		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,-86		,-86		,2147483648		,2147483648		,2147483648		,-86		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-86		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,106		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,107		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,108		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,109		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,110		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,111		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,-85		,2147483648		,-85		,-85		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,-85		,-85		,2147483648		,2147483648		,2147483648		,-85		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-85		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,112		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,114		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,-90		,2147483648		,-90		,-90		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,-90		,-90		,2147483648		,2147483648		,2147483648		,-90		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-90		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,115		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,116		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,117		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,118		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,-91		,2147483648		,-91		,-91		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,-91		,-91		,2147483648		,2147483648		,2147483648		,-91		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-91		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,119		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,-87		,2147483648		,-87		,-87		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,-87		,-87		,2147483648		,2147483648		,2147483648		,-87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-87		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,121		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,122		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,123		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,124		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,125		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,127		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,128		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,129		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,130		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,132		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,133		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,134		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,135		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,136		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,2147483648		,2147483648		,69		,2147483648		,2147483648		,35		,2147483648		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,2147483648		,59		,48		,2147483648		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,139		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,-94		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,188		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,-33		,2147483648		,-33		,-33		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,-33		,-33		,2147483648		,2147483648		,2147483648		,-33		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-33		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,-37		,2147483648		,-37		,-37		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,-37		,-37		,2147483648		,2147483648		,2147483648		,-37		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-37		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,-35		,2147483648		,-35		,-35		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,-35		,-35		,2147483648		,2147483648		,2147483648		,-35		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-35		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,-34		,2147483648		,-34		,-34		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,-34		,-34		,2147483648		,2147483648		,2147483648		,-34		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-34		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,-36		,2147483648		,-36		,-36		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,-36		,-36		,2147483648		,2147483648		,2147483648		,-36		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-36		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-3		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-5		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,77		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-7		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-9		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-11		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-17		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-19		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-18		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-14		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-16		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-15		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-23		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,-23		,2147483648		,2147483648		,-23		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,-23		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-23		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,88		,-22		,2147483648		,2147483648		,87		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,-22		,2147483648		,2147483648		,-22		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,-22		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-22		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-26		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,-26		,2147483648		,90		,-26		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,91		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,89		,-26		,2147483648		,2147483648		,2147483648		,-26		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-26		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-25		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,-25		,2147483648		,90		,-25		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,91		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,89		,-25		,2147483648		,2147483648		,2147483648		,-25		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-25		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,-28		,2147483648		,-28		,-28		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,-28		,-28		,2147483648		,2147483648		,2147483648		,-28		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-28		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,-29		,2147483648		,-29		,-29		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,-29		,-29		,2147483648		,2147483648		,2147483648		,-29		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-29		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,-30		,2147483648		,-30		,-30		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,-30		,-30		,2147483648		,2147483648		,2147483648		,-30		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-30		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,213		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,214		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,215		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,216		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-103		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,217		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-99		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-100		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-101		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,218		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-98		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,219		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,220		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,221		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,222		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,223		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,224		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,225		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,226		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,227		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,228		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,230		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,231		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,232		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,233		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,234		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,235		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,236		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,-82		,2147483648		,-82		,-82		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,-82		,-82		,2147483648		,2147483648		,2147483648		,-82		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-82		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-102		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,237		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,238		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,239		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,240		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,241		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,242		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,243		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,244		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,245		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,246		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,247		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,248		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,249		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,250		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,251		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,252		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,253		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,254		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,255		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,256		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,257		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-95		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,-92		,2147483648		,-92		,-92		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,-92		,-92		,2147483648		,2147483648		,2147483648		,-92		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-92		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,-45		,2147483648		,-45		,-45		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,-45		,-45		,2147483648		,2147483648		,2147483648		,-45		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-45		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,-49		,2147483648		,-49		,-49		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,-49		,-49		,2147483648		,2147483648		,2147483648		,-49		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-49		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,-79		,2147483648		,-79		,-79		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,-79		,-79		,2147483648		,2147483648		,2147483648		,-79		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-79		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,-52		,2147483648		,-52		,-52		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,-52		,-52		,2147483648		,2147483648		,2147483648		,-52		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-52		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,-40		,2147483648		,-40		,-40		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,-40		,-40		,2147483648		,2147483648		,2147483648		,-40		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-40		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,-47		,2147483648		,-47		,-47		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,-47		,-47		,2147483648		,2147483648		,2147483648		,-47		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-47		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,-60		,2147483648		,-60		,-60		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,-60		,-60		,2147483648		,2147483648		,2147483648		,-60		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-60		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,-54		,2147483648		,-54		,-54		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,-54		,-54		,2147483648		,2147483648		,2147483648		,-54		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-54		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,-48		,2147483648		,-48		,-48		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,-48		,-48		,2147483648		,2147483648		,2147483648		,-48		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-48		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,-75		,2147483648		,-75		,-75		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,-75		,-75		,2147483648		,2147483648		,2147483648		,-75		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-75		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,-62		,2147483648		,-62		,-62		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,-62		,-62		,2147483648		,2147483648		,2147483648		,-62		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-62		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,-61		,2147483648		,-61		,-61		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,-61		,-61		,2147483648		,2147483648		,2147483648		,-61		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-61		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,-41		,2147483648		,-41		,-41		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,-41		,-41		,2147483648		,2147483648		,2147483648		,-41		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-41		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,165		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,169		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,-43		,2147483648		,-43		,-43		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,-43		,-43		,2147483648		,2147483648		,2147483648		,-43		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-43		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,-59		,2147483648		,-59		,-59		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,-59		,-59		,2147483648		,2147483648		,2147483648		,-59		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-59		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,-57		,2147483648		,-57		,-57		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,-57		,-57		,2147483648		,2147483648		,2147483648		,-57		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-57		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,-51		,2147483648		,-51		,-51		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,-51		,-51		,2147483648		,2147483648		,2147483648		,-51		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-51		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,-39		,2147483648		,-39		,-39		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,-39		,-39		,2147483648		,2147483648		,2147483648		,-39		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-39		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,-55		,2147483648		,-55		,-55		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,-55		,-55		,2147483648		,2147483648		,2147483648		,-55		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-55		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,-38		,2147483648		,-38		,-38		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,-38		,-38		,2147483648		,2147483648		,2147483648		,-38		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-38		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,-42		,2147483648		,-42		,-42		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,-42		,-42		,2147483648		,2147483648		,2147483648		,-42		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-42		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,-44		,2147483648		,-44		,-44		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,-44		,-44		,2147483648		,2147483648		,2147483648		,-44		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-44		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,-50		,2147483648		,-50		,-50		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,-50		,-50		,2147483648		,2147483648		,2147483648		,-50		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-50		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,-63		,2147483648		,-63		,-63		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,-63		,-63		,2147483648		,2147483648		,2147483648		,-63		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-63		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,-46		,2147483648		,-46		,-46		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,-46		,-46		,2147483648		,2147483648		,2147483648		,-46		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-46		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,-56		,2147483648		,-56		,-56		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,-56		,-56		,2147483648		,2147483648		,2147483648		,-56		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-56		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,-58		,2147483648		,-58		,-58		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,-58		,-58		,2147483648		,2147483648		,2147483648		,-58		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-58		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,-64		,2147483648		,-64		,-64		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,-64		,-64		,2147483648		,2147483648		,2147483648		,-64		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-64		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,-53		,2147483648		,-53		,-53		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,-53		,-53		,2147483648		,2147483648		,2147483648		,-53		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-53		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-97		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,212		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,275		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,276		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,277		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,278		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,279		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,280		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,281		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,282		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,283		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,284		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,285		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,286		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,287		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,288		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,289		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-96		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,-68		,2147483648		,-68		,-68		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,-68		,-68		,2147483648		,2147483648		,2147483648		,-68		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-68		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,-76		,2147483648		,-76		,-76		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,-76		,-76		,2147483648		,2147483648		,2147483648		,-76		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-76		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,-71		,2147483648		,-71		,-71		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,-71		,-71		,2147483648		,2147483648		,2147483648		,-71		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-71		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,-73		,2147483648		,-73		,-73		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,-73		,-73		,2147483648		,2147483648		,2147483648		,-73		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-73		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,-67		,2147483648		,-67		,-67		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,-67		,-67		,2147483648		,2147483648		,2147483648		,-67		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-67		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,-70		,2147483648		,-70		,-70		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,-70		,-70		,2147483648		,2147483648		,2147483648		,-70		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-70		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,-80		,2147483648		,-80		,-80		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,-80		,-80		,2147483648		,2147483648		,2147483648		,-80		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-80		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,-72		,2147483648		,-72		,-72		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,-72		,-72		,2147483648		,2147483648		,2147483648		,-72		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-72		,2147483648	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{39		,22		,63		,71		,2147483648		,69		,2147483648		,54		,35		,65		,19		,32		,37		,27		,2147483648		,36		,2147483648		,25		,2147483648		,2147483648		,2147483648		,30		,21		,53		,46		,2147483648		,40		,41		,2147483648		,43		,34		,29		,2147483648		,2147483648		,58		,23		,70		,49		,47		,2147483648		,20		,26		,2147483648		,31		,55		,18		,51		,42		,2147483648		,72		,59		,48		,60		,44		,62		,50		,67		,2147483648		,24		,73		,68		,2147483648		,2147483648		,33		,52		,56		,2147483648		,64		,17		,28		,38		,66		,61		,45		,2147483648		,57	},
+	{2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,-66		,2147483648		,-66		,-66		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,-66		,-66		,2147483648		,2147483648		,2147483648		,-66		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-66		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,-69		,2147483648		,-69		,-69		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,-69		,-69		,2147483648		,2147483648		,2147483648		,-69		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-69		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,-65		,2147483648		,-65		,-65		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,-65		,-65		,2147483648		,2147483648		,2147483648		,-65		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-65		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,294		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,295		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,296		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,297		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,-74		,2147483648		,-74		,-74		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,-74		,-74		,2147483648		,2147483648		,2147483648		,-74		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-74		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,-78		,2147483648		,-78		,-78		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,-78		,-78		,2147483648		,2147483648		,2147483648		,-78		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-78		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,-81		,2147483648		,-81		,-81		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,-81		,-81		,2147483648		,2147483648		,2147483648		,-81		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-81		,2147483648	},
+	{2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,-77		,2147483648		,-77		,-77		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,-77		,-77		,2147483648		,2147483648		,2147483648		,-77		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,2147483648		,-77		,2147483648	}
 };
 const struct _TOKEN LalrSemanticRules[RULES_COUNT]= 
 {
@@ -2621,3 +2670,1259 @@ const struct _TOKEN LalrSemanticRules[RULES_COUNT]=
 	{UNKNOWN, ""},
 	{UNKNOWN, ""}
 };
+const int TerminalMapHashDisplacements[TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+2,
+1,
+2,
+0,
+0,
+0,
+1,
+-123,
+-121,
+2,
+-117,
+-116,
+0,
+-107,
+-104,
+4,
+-100,
+3,
+0,
+1,
+8,
+-99,
+-97,
+-94,
+-93,
+0,
+0,
+-92,
+0,
+2,
+0,
+-88,
+0,
+0,
+-86,
+2,
+0,
+0,
+-85,
+0,
+0,
+0,
+-81,
+1,
+0,
+0,
+-80,
+-79,
+0,
+-77,
+-75,
+1,
+10,
+0,
+0,
+2,
+0,
+1,
+-74,
+-72,
+1,
+-66,
+-64,
+1,
+1,
+0,
+-60,
+-57,
+-52,
+0,
+-49,
+0,
+-48,
+0,
+-47,
+0,
+3,
+-44,
+-38,
+-37,
+4,
+-36,
+3,
+-31,
+0,
+-29,
+0,
+3,
+-27,
+-26,
+0,
+1,
+0,
+-25,
+0,
+0,
+-24,
+-20,
+-19,
+0,
+-18,
+0,
+1,
+-17,
+0,
+0,
+1,
+0,
+2,
+-15,
+0,
+-13,
+12,
+-11,
+9,
+-9,
+0,
+1,
+-5,
+0,
+-4,
+1,
+0
+};
+const unsigned short TerminalMapHashValues[TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+84,
+30,
+47,
+46,
+50,
+39,
+25,
+7,
+81,
+63,
+23,
+6,
+52,
+61,
+67,
+90,
+102,
+54,
+108,
+38,
+94,
+104,
+82,
+28,
+20,
+95,
+27,
+100,
+115,
+35,
+79,
+9,
+77,
+24,
+80,
+22,
+13,
+64,
+3,
+26,
+117,
+1,
+106,
+4,
+0,
+96,
+109,
+112,
+44,
+118,
+31,
+111,
+19,
+40,
+91,
+49,
+18,
+36,
+107,
+89,
+92,
+59,
+48,
+72,
+51,
+103,
+97,
+70,
+120,
+55,
+98,
+41,
+62,
+34,
+119,
+99,
+2,
+29,
+83,
+110,
+121,
+10,
+15,
+68,
+42,
+58,
+17,
+45,
+85,
+71,
+32,
+33,
+113,
+105,
+11,
+56,
+122,
+53,
+101,
+78,
+87,
+76,
+5,
+16,
+114,
+65,
+66,
+116,
+43,
+14,
+12,
+21,
+57,
+8,
+88,
+86,
+74,
+75,
+60,
+93,
+37,
+73,
+69
+};
+const int NoneTerminalMapHashDisplacements[NONE_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+-44,
+2,
+-43,
+-33,
+1,
+0,
+-30,
+1,
+3,
+1,
+1,
+0,
+0,
+-28,
+6,
+0,
+2,
+0,
+1,
+0,
+-27,
+0,
+-26,
+12,
+0,
+3,
+0,
+4,
+11,
+0,
+0,
+-22,
+-18,
+-15,
+-12,
+0,
+0,
+0,
+1,
+-11,
+-9,
+0,
+-7,
+0,
+0,
+0,
+0,
+0,
+-4
+};
+const unsigned short NoneTerminalMapHashValues[NONE_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+48,
+25,
+34,
+45,
+1,
+15,
+12,
+16,
+4,
+3,
+31,
+0,
+41,
+11,
+17,
+27,
+2,
+10,
+24,
+6,
+23,
+36,
+8,
+32,
+7,
+44,
+39,
+42,
+9,
+30,
+35,
+26,
+37,
+33,
+18,
+38,
+20,
+14,
+29,
+43,
+19,
+47,
+40,
+21,
+13,
+28,
+5,
+46,
+22
+};
+const int LalrTerminalMapHashDisplacements[LALR_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+0,
+0,
+-75,
+0,
+1,
+-74,
+0,
+-72,
+-69,
+0,
+1,
+1,
+0,
+-67,
+0,
+0,
+-66,
+0,
+-65,
+1,
+0,
+0,
+-62,
+2,
+0,
+0,
+0,
+-57,
+-56,
+-55,
+2,
+-50,
+-49,
+-46,
+1,
+0,
+-44,
+1,
+0,
+-43,
+2,
+-40,
+0,
+-36,
+-30,
+4,
+7,
+3,
+2,
+0,
+11,
+1,
+0,
+-28,
+-23,
+1,
+-18,
+-16,
+0,
+-11,
+0,
+-10,
+1,
+12,
+0,
+-8,
+-7,
+5,
+0,
+-6,
+0,
+-4,
+-3,
+-2,
+0,
+2
+};
+const unsigned short LalrTerminalMapHashValues[LALR_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+8,
+74,
+14,
+6,
+5,
+56,
+54,
+72,
+53,
+1,
+4,
+28,
+37,
+46,
+22,
+49,
+10,
+45,
+32,
+17,
+75,
+73,
+59,
+36,
+21,
+42,
+19,
+66,
+52,
+39,
+40,
+23,
+31,
+0,
+44,
+13,
+15,
+16,
+41,
+71,
+3,
+30,
+60,
+29,
+18,
+33,
+12,
+68,
+26,
+63,
+9,
+55,
+47,
+7,
+11,
+35,
+43,
+62,
+69,
+48,
+57,
+51,
+24,
+38,
+67,
+65,
+34,
+27,
+61,
+58,
+50,
+70,
+20,
+2,
+64,
+25
+};
+const int LalrNoneTerminalMapHashDisplacements[LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+-22,
+2,
+-19,
+0,
+-17,
+0,
+-14,
+-13,
+-12,
+2,
+1,
+-11,
+-9,
+0,
+-7,
+3,
+0,
+0,
+-6,
+0,
+-5,
+-4
+};
+const unsigned short LalrNoneTerminalMapHashValues[LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE]= 
+{
+17,
+8,
+21,
+15,
+3,
+7,
+12,
+11,
+9,
+2,
+13,
+14,
+20,
+19,
+10,
+1,
+0,
+6,
+18,
+16,
+5,
+4
+};
+const int KeywordListHashDisplacements[KEYWORD_LIST_HASH_TABLE_SIZE]= 
+{
+-65,
+-57,
+1,
+0,
+0,
+-54,
+0,
+0,
+3,
+-52,
+0,
+-51,
+0,
+0,
+4,
+0,
+0,
+2,
+0,
+0,
+1,
+0,
+-50,
+0,
+2,
+-46,
+-45,
+0,
+-43,
+1,
+-42,
+0,
+0,
+0,
+5,
+3,
+-40,
+6,
+-39,
+0,
+0,
+0,
+0,
+2,
+-36,
+4,
+-35,
+-34,
+-33,
+0,
+0,
+-32,
+5,
+2,
+-29,
+4,
+0,
+-27,
+0,
+1,
+0,
+6,
+1,
+-20,
+-16,
+0,
+-12,
+-8,
+-7,
+2
+};
+const unsigned short KeywordListHashValues[KEYWORD_LIST_HASH_TABLE_SIZE]= 
+{
+46,
+63,
+54,
+60,
+39,
+66,
+11,
+25,
+19,
+47,
+13,
+3,
+61,
+10,
+34,
+26,
+6,
+58,
+53,
+41,
+23,
+52,
+31,
+21,
+9,
+33,
+68,
+30,
+51,
+32,
+38,
+69,
+40,
+43,
+24,
+59,
+14,
+28,
+35,
+29,
+12,
+49,
+56,
+27,
+7,
+5,
+36,
+42,
+16,
+2,
+62,
+55,
+37,
+20,
+1,
+67,
+0,
+22,
+64,
+15,
+57,
+8,
+45,
+65,
+18,
+48,
+50,
+4,
+17,
+44
+};
+const int SemanticRulesMapListHashDisplacements[SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+-113,
+1,
+1,
+0,
+-111,
+4,
+-110,
+0,
+0,
+-109,
+-107,
+2,
+1,
+-99,
+1,
+-98,
+1,
+-95,
+-93,
+0,
+-90,
+0,
+0,
+0,
+-89,
+0,
+-88,
+0,
+0,
+0,
+7,
+0,
+0,
+0,
+-84,
+-83,
+0,
+0,
+-82,
+-77,
+-73,
+-67,
+0,
+4,
+0,
+-65,
+-64,
+0,
+-61,
+-60,
+0,
+-57,
+-55,
+1,
+2,
+-54,
+-52,
+-50,
+-49,
+2,
+0,
+1,
+0,
+0,
+-47,
+0,
+0,
+-44,
+2,
+-41,
+0,
+1,
+2,
+0,
+0,
+1,
+-40,
+2,
+4,
+-39,
+1,
+0,
+4,
+0,
+-35,
+-32,
+0,
+-29,
+3,
+-27,
+0,
+-25,
+13,
+0,
+1,
+0,
+0,
+-21,
+-20,
+-15,
+-14,
+0,
+-10,
+1,
+-9,
+9,
+-6,
+9,
+0,
+0,
+2,
+0,
+-2,
+0,
+0
+};
+const unsigned short SemanticRulesMapListHashValues[SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+73,
+57,
+92,
+45,
+31,
+88,
+46,
+151,
+38,
+104,
+156,
+11,
+69,
+60,
+76,
+102,
+79,
+75,
+1,
+48,
+0,
+81,
+56,
+65,
+7,
+27,
+40,
+97,
+66,
+41,
+30,
+150,
+32,
+33,
+91,
+22,
+154,
+23,
+6,
+47,
+26,
+50,
+62,
+36,
+87,
+147,
+5,
+14,
+85,
+13,
+105,
+101,
+29,
+20,
+18,
+49,
+90,
+67,
+155,
+4,
+51,
+28,
+9,
+12,
+63,
+93,
+8,
+15,
+96,
+148,
+86,
+89,
+98,
+82,
+95,
+21,
+64,
+71,
+103,
+61,
+24,
+19,
+70,
+52,
+72,
+34,
+84,
+68,
+152,
+153,
+17,
+80,
+42,
+99,
+83,
+94,
+77,
+16,
+55,
+149,
+2,
+25,
+58,
+59,
+100,
+78,
+44,
+53,
+43,
+54,
+39,
+10,
+37,
+35,
+3
+};
+const int RegisterMapListHashDisplacements[REGISTER_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+5,
+0,
+-116,
+1,
+-110,
+-108,
+-107,
+2,
+0,
+0,
+1,
+0,
+0,
+4,
+1,
+-106,
+-102,
+-100,
+0,
+-95,
+-92,
+-91,
+0,
+-87,
+0,
+1,
+0,
+0,
+1,
+0,
+-81,
+-80,
+0,
+0,
+-77,
+14,
+0,
+-68,
+0,
+-67,
+0,
+0,
+-62,
+6,
+0,
+-61,
+-60,
+0,
+0,
+2,
+1,
+0,
+-59,
+3,
+-58,
+2,
+0,
+0,
+0,
+-57,
+1,
+-52,
+4,
+2,
+0,
+1,
+2,
+0,
+-51,
+-50,
+0,
+5,
+1,
+3,
+-49,
+0,
+-46,
+0,
+-45,
+0,
+0,
+1,
+-41,
+0,
+3,
+-34,
+0,
+0,
+10,
+-33,
+0,
+-32,
+2,
+-31,
+0,
+-29,
+-27,
+0,
+2,
+-26,
+-24,
+-19,
+-17,
+-16,
+7,
+0,
+0,
+2,
+-15,
+0,
+-12,
+4,
+-8,
+-6,
+0,
+0,
+0,
+5,
+0,
+0
+};
+const unsigned short RegisterMapListHashValues[REGISTER_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+2,
+12,
+118,
+69,
+1,
+80,
+10,
+74,
+5,
+50,
+22,
+11,
+3,
+37,
+15,
+108,
+79,
+90,
+39,
+105,
+8,
+78,
+82,
+114,
+63,
+21,
+106,
+19,
+111,
+4,
+92,
+81,
+32,
+41,
+104,
+9,
+44,
+83,
+42,
+38,
+89,
+59,
+57,
+46,
+70,
+100,
+84,
+95,
+61,
+77,
+68,
+49,
+93,
+113,
+97,
+99,
+107,
+31,
+101,
+43,
+115,
+14,
+94,
+0,
+23,
+13,
+109,
+66,
+35,
+98,
+65,
+85,
+112,
+24,
+73,
+91,
+54,
+47,
+119,
+60,
+58,
+96,
+62,
+110,
+25,
+29,
+53,
+27,
+86,
+52,
+76,
+18,
+33,
+87,
+116,
+45,
+7,
+51,
+103,
+88,
+34,
+28,
+36,
+64,
+20,
+67,
+75,
+48,
+6,
+40,
+71,
+117,
+102,
+17,
+55,
+30,
+26,
+72,
+16,
+56
+};
+const int PseudoRegisterMapListHashDisplacements[PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+-15,
+0,
+1,
+0,
+0,
+2,
+1,
+-13,
+-5,
+0,
+4,
+7,
+-1,
+5,
+0,
+0
+};
+const unsigned short PseudoRegisterMapListHashValues[PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE]= 
+{
+11,
+12,
+4,
+7,
+13,
+9,
+6,
+0,
+2,
+3,
+5,
+15,
+1,
+8,
+10,
+14
+};
+const int ScriptVariableTypeListHashDisplacements[SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE]= 
+{
+-10,
+-9,
+-7,
+0,
+0,
+1,
+1,
+2,
+-3,
+0
+};
+const unsigned short ScriptVariableTypeListHashValues[SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE]= 
+{
+3,
+1,
+5,
+6,
+2,
+4,
+9,
+7,
+0,
+8
+};
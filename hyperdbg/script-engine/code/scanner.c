@@ -1031,21 +1031,20 @@ sgetc(char * str)
 char
 IsKeyword(char * str)
 {
-    int n = KEYWORD_LIST_LENGTH;
-    for (int i = 0; i < n; i++)
+    unsigned int i;
+
+    i = PerfectHashLookup(str, KeywordListHashDisplacements, KeywordListHashValues, KEYWORD_LIST_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, KeywordList[i]))
     {
-        if (!strcmp(str, KeywordList[i]))
-        {
-            return 1;
-        }
+        return 1;
     }
-    n = TERMINAL_COUNT;
-    for (int i = 0; i < n; i++)
+
+    i = PerfectHashLookup(str, TerminalMapHashDisplacements, TerminalMapHashValues, TERMINAL_MAP_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, TerminalMap[i]))
     {
-        if (!strcmp(str, TerminalMap[i]))
-        {
-            return 1;
-        }
+        return 1;
     }
 
     return 0;
@@ -1074,12 +1073,14 @@ IsRegister(char * str)
 char
 IsVariableType(char * str)
 {
-    for (int i = 0; i < SCRIPT_VARIABLE_TYPE_LIST_LENGTH; i++)
+    unsigned int i = PerfectHashLookup(str,
+                                       ScriptVariableTypeListHashDisplacements,
+                                       ScriptVariableTypeListHashValues,
+                                       SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, ScriptVariableTypeList[i]))
     {
-        if (!strcmp(str, ScriptVariableTypeList[i]))
-        {
-            return 1;
-        }
+        return 1;
     }
 
     return 0;
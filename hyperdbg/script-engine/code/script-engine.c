@@ -309,6 +309,20 @@ ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath,
 PVOID
 ScriptEngineParse(char * str)
 {
+    static FirstCall = 1;
+    if (FirstCall)
+    {
+        GlobalIdTable     = NewTokenList();
+        GlobalIdHashTable = NewIdentifierTable();
+        FirstCall         = 0;
+    }
+
+    //
+    // Tokens, token lists and symbols of this compilation are allocated
+    // from the arena and released at once at the end of the compilation
+    //
+    ArenaSetActive(TRUE);
+
     PTOKEN_LIST Stack = NewTokenList();
 
     PTOKEN_LIST    MatchedStack = NewTokenList();
@@ -316,24 +330,22 @@ ScriptEngineParse(char * str)
 
     UserDefinedFunctionHead = malloc(sizeof(USER_DEFINED_FUNCTION_NODE));
     RtlZeroMemory(UserDefinedFunctionHead, sizeof(USER_DEFINED_FUNCTION_NODE));
-    UserDefinedFunctionHead->Name                     = _strdup("main");
-    UserDefinedFunctionHead->IdTable                  = (unsigned long long)NewTokenList();
-    UserDefinedFunctionHead->FunctionParameterIdTable = (unsigned long long)NewTokenList();
-    UserDefinedFunctionHead->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
-    UserDefinedFunctionHead->VariableType             = (unsigned long long)VARIABLE_TYPE_VOID;
+    UserDefinedFunctionHead->Name                         = _strdup("main");
+    UserDefinedFunctionHead->IdTable                      = (unsigned long long)NewTokenList();
+    UserDefinedFunctionHead->FunctionParameterIdTable     = (unsigned long long)NewTokenList();
+    UserDefinedFunctionHead->IdHashTable                  = (unsigned long long)NewIdentifierTable();
+    UserDefinedFunctionHead->FunctionParameterIdHashTable = (unsigned long long)NewIdentifierTable();
+    UserDefinedFunctionHead->TempMap                      = calloc(MAX_TEMP_COUNT, 1);
+    UserDefinedFunctionHead->VariableType                 = (unsigned long long)VARIABLE_TYPE_VOID;
+
+    UserDefinedFunctionTable = NewIdentifierTable();
+    InsertIdentifier(UserDefinedFunctionTable, UserDefinedFunctionHead->Name, (unsigned long long)UserDefinedFunctionHead);
 
     CurrentUserDefinedFunction = UserDefinedFunctionHead;
 
     SCRIPT_ENGINE_ERROR_TYPE Error        = SCRIPT_ENGINE_ERROR_FREE;
     char *                   ErrorMessage = NULL;
 
-    static FirstCall = 1;
-    if (FirstCall)
-    {
-        GlobalIdTable = NewTokenList();
-        FirstCall     = 0;
-    }
-
     PTOKEN TopToken = NewUnknownToken();
 
     int  NonTerminalId;
@@ -374,6 +386,7 @@ ScriptEngineParse(char * str)
         RemoveTokenList(Stack);
         RemoveTokenList(MatchedStack);
         RemoveToken(&CurrentIn);
+        ArenaReset();
         return (PVOID)CodeBuffer;
     }
 
@@ -605,6 +618,12 @@ ScriptEngineParse(char * str)
             if (Node->FunctionParameterIdTable)
                 RemoveTokenList((PTOKEN_LIST)Node->FunctionParameterIdTable);
 
+            if (Node->IdHashTable)
+                RemoveIdentifierTable((PIDENTIFIER_TABLE)Node->IdHashTable);
+
+            if (Node->FunctionParameterIdHashTable)
+                RemoveIdentifierTable((PIDENTIFIER_TABLE)Node->FunctionParameterIdHashTable);
+
             if (Node->TempMap)
                 free(Node->TempMap);
 
@@ -615,12 +634,20 @@ ScriptEngineParse(char * str)
         UserDefinedFunctionHead = 0;
     }
 
+    if (UserDefinedFunctionTable)
+    {
+        RemoveIdentifierTable(UserDefinedFunctionTable);
+        UserDefinedFunctionTable = NULL;
+    }
+
     if (CurrentIn)
         RemoveToken(&CurrentIn);
 
     if (TopToken)
         RemoveToken(&TopToken);
 
+    ArenaReset();
+
     return (PVOID)CodeBuffer;
 }
 
@@ -710,12 +737,16 @@ CodeGen(PTOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PTOKEN Operator, PS
             RtlZeroMemory(Node->NextNode, sizeof(USER_DEFINED_FUNCTION_NODE));
             CurrentUserDefinedFunction = Node->NextNode;
 
-            CurrentUserDefinedFunction->Name                     = _strdup(Op0->Value);
-            CurrentUserDefinedFunction->Address                  = CodeBuffer->Pointer; // CurrentPointer
-            CurrentUserDefinedFunction->VariableType             = (long long unsigned)VariableType;
-            CurrentUserDefinedFunction->IdTable                  = (unsigned long long)NewTokenList();
-            CurrentUserDefinedFunction->FunctionParameterIdTable = (unsigned long long)NewTokenList();
-            CurrentUserDefinedFunction->TempMap                  = calloc(MAX_TEMP_COUNT, 1);
+            CurrentUserDefinedFunction->Name                         = _strdup(Op0->Value);
+            CurrentUserDefinedFunction->Address                      = CodeBuffer->Pointer; // CurrentPointer
+            CurrentUserDefinedFunction->VariableType                 = (long long unsigned)VariableType;
+            CurrentUserDefinedFunction->IdTable                      = (unsigned long long)NewTokenList();
+            CurrentUserDefinedFunction->FunctionParameterIdTable     = (unsigned long long)NewTokenList();
+            CurrentUserDefinedFunction->IdHashTable                  = (unsigned long long)NewIdentifierTable();
+            CurrentUserDefinedFunction->FunctionParameterIdHashTable = (unsigned long long)NewIdentifierTable();
+            CurrentUserDefinedFunction->TempMap                      = calloc(MAX_TEMP_COUNT, 1);
+
+            InsertIdentifier(UserDefinedFunctionTable, CurrentUserDefinedFunction->Name, (unsigned long long)CurrentUserDefinedFunction);
 
             //
             // push stack base index
@@ -1888,6 +1919,8 @@ CodeGen(PTOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, PTOKEN Operator, PS
             Op0Symbol = ToSymbol(Op0, Error);
 
             PushSymbol(CodeBuffer, Op0Symbol);
+
+            FreeTemp(Op0);
             if (*Error != SCRIPT_ENGINE_ERROR_FREE)
             {
                 break;
@@ -2635,7 +2668,7 @@ PSYMBOL
 NewSymbol(void)
 {
     PSYMBOL Symbol;
-    Symbol = (PSYMBOL)malloc(sizeof(SYMBOL));
+    Symbol = (PSYMBOL)ArenaAllocate(sizeof(SYMBOL));
 
     if (Symbol == NULL)
     {
@@ -2645,9 +2678,6 @@ NewSymbol(void)
         return NULL;
     }
 
-    Symbol->Value = 0;
-    Symbol->Len   = 0;
-    Symbol->Type  = 0;
     return Symbol;
 }
 
@@ -2662,7 +2692,7 @@ NewStringSymbol(PTOKEN Token)
 {
     PSYMBOL Symbol;
     int     BufferSize = (SIZE_SYMBOL_WITHOUT_LEN + Token->Len) / sizeof(SYMBOL) + 1;
-    Symbol             = (PSYMBOL)calloc(sizeof(SYMBOL), BufferSize);
+    Symbol             = (PSYMBOL)ArenaAllocate(BufferSize * sizeof(SYMBOL));
 
     if (Symbol == NULL)
     {
@@ -2689,7 +2719,7 @@ NewWstringSymbol(PTOKEN Token)
 {
     PSYMBOL Symbol;
     int     BufferSize = (SIZE_SYMBOL_WITHOUT_LEN + Token->Len) / sizeof(SYMBOL) + 1;
-    Symbol             = (PSYMBOL)malloc(BufferSize * sizeof(SYMBOL));
+    Symbol             = (PSYMBOL)ArenaAllocate(BufferSize * sizeof(SYMBOL));
 
     if (Symbol == NULL)
     {
@@ -2732,7 +2762,7 @@ GetSymbolHeapSize(PSYMBOL Symbol)
 void
 RemoveSymbol(PSYMBOL * Symbol)
 {
-    free(*Symbol);
+    ArenaFree(*Symbol);
     *Symbol = NULL;
     return;
 }
@@ -3057,12 +3087,14 @@ RegisterToInt(char * str)
     //
     // Check for register names
     //
-    for (int i = 0; i < REGISTER_MAP_LIST_LENGTH; i++)
+    unsigned int i = PerfectHashLookup(str,
+                                       RegisterMapListHashDisplacements,
+                                       RegisterMapListHashValues,
+                                       REGISTER_MAP_LIST_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, RegisterMapList[i].Name))
     {
-        if (!strcmp(str, RegisterMapList[i].Name))
-        {
-            return RegisterMapList[i].Type;
-        }
+        return RegisterMapList[i].Type;
     }
 
     //
@@ -3155,12 +3187,14 @@ RegisterToInt(char * str)
 unsigned long long int
 PseudoRegToInt(char * str)
 {
-    for (int i = 0; i < PSEUDO_REGISTER_MAP_LIST_LENGTH; i++)
+    unsigned int i = PerfectHashLookup(str,
+                                       PseudoRegisterMapListHashDisplacements,
+                                       PseudoRegisterMapListHashValues,
+                                       PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, PseudoRegisterMapList[i].Name))
     {
-        if (!strcmp(str, PseudoRegisterMapList[i].Name))
-        {
-            return PseudoRegisterMapList[i].Type;
-        }
+        return PseudoRegisterMapList[i].Type;
     }
     return INVALID;
 }
@@ -3174,12 +3208,14 @@ PseudoRegToInt(char * str)
 unsigned long long int
 SemanticRuleToInt(char * str)
 {
-    for (int i = 0; i < SEMANTIC_RULES_MAP_LIST_LENGTH; i++)
+    unsigned int i = PerfectHashLookup(str,
+                                       SemanticRulesMapListHashDisplacements,
+                                       SemanticRulesMapListHashValues,
+                                       SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE);
+
+    if (!strcmp(str, SemanticRulesMapList[i].Name))
     {
-        if (!strcmp(str, SemanticRulesMapList[i].Name))
-        {
-            return SemanticRulesMapList[i].Type;
-        }
+        return SemanticRulesMapList[i].Type;
     }
     return INVALID;
 }
@@ -3304,14 +3340,11 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
 int
 GetGlobalIdentifierVal(PTOKEN Token)
 {
-    PTOKEN CurrentToken;
-    for (uintptr_t i = 0; i < GlobalIdTable->Pointer; i++)
+    unsigned long long Value;
+
+    if (FindIdentifier(GlobalIdHashTable, Token->Value, &Value))
     {
-        CurrentToken = *(GlobalIdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
+        return (int)Value;
     }
     return -1;
 }
@@ -3325,14 +3358,11 @@ GetGlobalIdentifierVal(PTOKEN Token)
 int
 GetLocalIdentifierVal(PTOKEN Token)
 {
-    PTOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PTOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer; i++)
+    unsigned long long Value;
+
+    if (FindIdentifier((PIDENTIFIER_TABLE)CurrentUserDefinedFunction->IdHashTable, Token->Value, &Value))
     {
-        CurrentToken = *(((PTOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
+        return (int)Value;
     }
     return -1;
 }
@@ -3346,8 +3376,16 @@ GetLocalIdentifierVal(PTOKEN Token)
 int
 NewGlobalIdentifier(PTOKEN Token)
 {
-    PTOKEN CopiedToken = CopyToken(Token);
-    GlobalIdTable      = Push(GlobalIdTable, CopiedToken);
+    //
+    // Global ids are kept between the compilations, so they're not
+    // allocated from the compilation arena
+    //
+    char   IsArenaActive = ArenaSetActive(FALSE);
+    PTOKEN CopiedToken   = CopyToken(Token);
+    GlobalIdTable        = Push(GlobalIdTable, CopiedToken);
+    ArenaSetActive(IsArenaActive);
+
+    InsertIdentifier(GlobalIdHashTable, CopiedToken->Value, GlobalIdTable->Pointer - 1);
     return GlobalIdTable->Pointer - 1;
 }
 
@@ -3362,6 +3400,9 @@ NewLocalIdentifier(PTOKEN Token)
 {
     PTOKEN CopiedToken = CopyToken(Token);
     Push(((PTOKEN_LIST)CurrentUserDefinedFunction->IdTable), CopiedToken);
+    InsertIdentifier((PIDENTIFIER_TABLE)CurrentUserDefinedFunction->IdHashTable,
+                     CopiedToken->Value,
+                     ((PTOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer - 1);
     CurrentUserDefinedFunction->LocalVariableNumber++;
     return ((PTOKEN_LIST)CurrentUserDefinedFunction->IdTable)->Pointer - 1;
 }
@@ -3377,6 +3418,9 @@ NewFunctionParameterIdentifier(PTOKEN Token)
 {
     PTOKEN CopiedToken = CopyToken(Token);
     Push(((PTOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable), CopiedToken);
+    InsertIdentifier((PIDENTIFIER_TABLE)CurrentUserDefinedFunction->FunctionParameterIdHashTable,
+                     CopiedToken->Value,
+                     ((PTOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Pointer - 1);
     return ((PTOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Pointer - 1;
 }
 
@@ -3389,14 +3433,11 @@ NewFunctionParameterIdentifier(PTOKEN Token)
 int
 GetFunctionParameterIdentifier(PTOKEN Token)
 {
-    PTOKEN CurrentToken;
-    for (uintptr_t i = 0; i < ((PTOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Pointer; i++)
+    unsigned long long Value;
+
+    if (FindIdentifier((PIDENTIFIER_TABLE)CurrentUserDefinedFunction->FunctionParameterIdHashTable, Token->Value, &Value))
     {
-        CurrentToken = *(((PTOKEN_LIST)CurrentUserDefinedFunction->FunctionParameterIdTable)->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
+        return (int)Value;
     }
     return -1;
 }
@@ -3410,15 +3451,11 @@ GetFunctionParameterIdentifier(PTOKEN Token)
 PUSER_DEFINED_FUNCTION_NODE
 GetUserDefinedFunctionNode(PTOKEN Token)
 {
-    PUSER_DEFINED_FUNCTION_NODE Node = UserDefinedFunctionHead;
-    while (Node)
+    unsigned long long Node;
+
+    if (UserDefinedFunctionTable && FindIdentifier(UserDefinedFunctionTable, Token->Value, &Node))
     {
-        if (!strcmp((const char *)Token->Value, Node->Name))
-        {
-            return Node;
-            break;
-        }
-        Node = Node->NextNode;
+        return (PUSER_DEFINED_FUNCTION_NODE)Node;
     }
     return 0;
 }
@@ -21,15 +21,37 @@ initial size of symbol buffer
 #    define SYMBOL_BUFFER_INIT_SIZE 64
 
 /**
- * @brief maximum length of string in the token
+ * @brief maximum length of string in the token (stored inline
+ * with the token, longer values are reallocated)
  */
-#    define TOKEN_VALUE_MAX_LEN 8
+#    define TOKEN_VALUE_MAX_LEN 32
 
 /**
  * @brief init size of token list
  */
 #    define TOKEN_LIST_INIT_SIZE 256
 
+/**
+ * @brief init size of identifier table (should be a power of two)
+ */
+#    define IDENTIFIER_TABLE_INIT_SIZE 64
+
+/**
+ * @brief size of the first chunk of the compilation arena
+ */
+#    define SCRIPT_ENGINE_ARENA_CHUNK_SIZE 0x10000
+
+/**
+ * @brief alignment of the allocations from the compilation arena
+ */
+#    define SCRIPT_ENGINE_ARENA_ALIGNMENT 16
+
+/**
+ * @brief rounds up the size to the alignment of the compilation arena
+ */
+#    define SCRIPT_ENGINE_ARENA_ALIGN(Size) \
+        (((Size) + SCRIPT_ENGINE_ARENA_ALIGNMENT - 1) & ~((unsigned long long)SCRIPT_ENGINE_ARENA_ALIGNMENT - 1))
+
 /**
  * @brief enumerates possible types for token
  */
@@ -75,6 +97,29 @@ typedef struct _TOKEN
     unsigned long long VariableType;
 } TOKEN, *PTOKEN;
 
+/**
+ * @brief a chunk of the compilation arena (the buffer is placed
+ * right after the header)
+ */
+typedef struct _SCRIPT_ENGINE_ARENA_CHUNK
+{
+    struct _SCRIPT_ENGINE_ARENA_CHUNK * Next;
+    unsigned long long                  Size;
+    unsigned long long                  Used;
+} SCRIPT_ENGINE_ARENA_CHUNK, *PSCRIPT_ENGINE_ARENA_CHUNK;
+
+/**
+ * @brief bump allocator that holds the tokens, token lists and symbols
+ * of a single compilation so they could be released at once
+ */
+typedef struct _SCRIPT_ENGINE_ARENA
+{
+    PSCRIPT_ENGINE_ARENA_CHUNK Head;
+    char                       IsActive;
+    unsigned long long         AllocationCount;
+    unsigned long long         AllocatedBytes;
+} SCRIPT_ENGINE_ARENA, *PSCRIPT_ENGINE_ARENA;
+
 /**
  * @brief this structure is a dynamic container of TOKENS
  */
@@ -85,6 +130,47 @@ typedef struct _TOKEN_LIST
     unsigned int Size;
 } TOKEN_LIST, *PTOKEN_LIST;
 
+/**
+ * @brief an entry of the identifier table
+ */
+typedef struct _IDENTIFIER_ENTRY
+{
+    const char *       Name;
+    unsigned long long Value;
+} IDENTIFIER_ENTRY, *PIDENTIFIER_ENTRY;
+
+/**
+ * @brief this structure is a hash table (open addressing) that maps
+ * the names of identifiers to their values
+ * @details the names are not copied, they should be valid as long as
+ * the table is used
+ */
+typedef struct _IDENTIFIER_TABLE
+{
+    PIDENTIFIER_ENTRY Head;
+    unsigned int      Count;
+    unsigned int      Size;
+} IDENTIFIER_TABLE, *PIDENTIFIER_TABLE;
+
+////////////////////////////////////////////////////
+//			Arena related functions				  //
+////////////////////////////////////////////////////
+
+void *
+ArenaAllocate(unsigned long long Size);
+
+void
+ArenaFree(void * Buffer);
+
+char
+ArenaSetActive(char IsActive);
+
+void
+ArenaReset(void);
+
+PSCRIPT_ENGINE_ARENA
+ArenaGetState(void);
+
 ////////////////////////////////////////////////////
 // PTOKEN related functions						  //
 ////////////////////////////////////////////////////
@@ -137,6 +223,25 @@ Pop(PTOKEN_LIST TokenList);
 PTOKEN
 Top(PTOKEN_LIST TokenList);
 
+////////////////////////////////////////////////////
+//		IDENTIFIER_TABLE related functions		  //
+////////////////////////////////////////////////////
+
+PIDENTIFIER_TABLE
+NewIdentifierTable(void);
+
+void
+RemoveIdentifierTable(PIDENTIFIER_TABLE IdentifierTable);
+
+PIDENTIFIER_ENTRY
+GetIdentifierSlot(PIDENTIFIER_ENTRY Head, unsigned int Size, const char * Name);
+
+char
+InsertIdentifier(PIDENTIFIER_TABLE IdentifierTable, const char * Name, unsigned long long Value);
+
+char
+FindIdentifier(PIDENTIFIER_TABLE IdentifierTable, const char * Name, unsigned long long * Value);
+
 char
 IsNoneTerminal(PTOKEN Token);
 
@@ -146,6 +251,15 @@ IsSemanticRule(PTOKEN Token);
 char
 IsEqual(const PTOKEN Token1, const PTOKEN Token2);
 
+unsigned int
+PerfectHashString(const char * Str, unsigned int Seed);
+
+unsigned int
+PerfectHashLookup(const char * Str, const int * Displacements, const unsigned short * Values, unsigned int TableSize);
+
+const char *
+GetTerminalName(PTOKEN Token, BOOLEAN IsLalr);
+
 int
 GetNonTerminalId(PTOKEN Token);
 
@@ -269,6 +383,8 @@ typedef struct USER_DEFINED_FUNCTION_NODE
     long long unsigned                  LocalVariableNumber;
     long long unsigned                  IdTable;
     long long unsigned                  FunctionParameterIdTable;
+    long long unsigned                  IdHashTable;
+    long long unsigned                  FunctionParameterIdHashTable;
     char *                              TempMap;
     struct USER_DEFINED_FUNCTION_NODE * NextNode;
 } USER_DEFINED_FUNCTION_NODE, *PUSER_DEFINED_FUNCTION_NODE;
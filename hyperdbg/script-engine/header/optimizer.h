@@ -0,0 +1,155 @@
+/**
+ * @file optimizer.h
+ * @author M.H. Gholamrezaei (mh@hyperdbg.org)
+ *
+ * @details Symbol buffer optimizer headers
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#ifndef OPTIMIZER_H
+#    define OPTIMIZER_H
+
+/**
+ * @brief maximum number of times that the optimization passes are repeated
+ */
+#    define OPTIMIZER_MAX_ITERATIONS 8
+
+/**
+ * @brief maximum number of jumps that are followed for threading a jump
+ */
+#    define OPTIMIZER_MAX_JUMP_THREADING 16
+
+/**
+ * @brief maximum number of slots (temps and local variables) that are
+ * tracked by the optimizer
+ */
+#    define OPTIMIZER_MAX_SLOT_COUNT 0x10000
+
+/**
+ * @brief maximum size of the liveness sets (in 64-bit words), dead-temp
+ * elimination is skipped for larger scripts
+ */
+#    define OPTIMIZER_MAX_LIVENESS_WORDS 0x400000
+
+/**
+ * @brief invalid index of an instruction or a block
+ */
+#    define OPTIMIZER_INVALID_INDEX 0xffffffff
+
+/**
+ * @brief classes of the operators from the optimizer's point of view
+ */
+typedef enum _OPTIMIZER_OPERATOR_CLASS
+{
+    OPTIMIZER_OPERATOR_OTHER,
+    OPTIMIZER_OPERATOR_VALUE,
+    OPTIMIZER_OPERATOR_INC_DEC,
+    OPTIMIZER_OPERATOR_JMP,
+    OPTIMIZER_OPERATOR_CONDITIONAL_JMP,
+    OPTIMIZER_OPERATOR_CALL,
+    OPTIMIZER_OPERATOR_RET,
+    OPTIMIZER_OPERATOR_PUSH,
+    OPTIMIZER_OPERATOR_POP
+} OPTIMIZER_OPERATOR_CLASS;
+
+/**
+ * @brief kinds of the values that are known for a slot
+ */
+typedef enum _OPTIMIZER_SLOT_KIND
+{
+    OPTIMIZER_SLOT_UNKNOWN,
+    OPTIMIZER_SLOT_CONSTANT,
+    OPTIMIZER_SLOT_COPY
+} OPTIMIZER_SLOT_KIND;
+
+/**
+ * @brief an instruction (operator and its operands) of the symbol buffer
+ */
+typedef struct _OPTIMIZER_INSTRUCTION
+{
+    unsigned int             Offset;
+    unsigned int             Size;
+    unsigned int             Target;
+    unsigned int             Block;
+    OPTIMIZER_OPERATOR_CLASS Class;
+    char                     IsRemoved;
+} OPTIMIZER_INSTRUCTION, *POPTIMIZER_INSTRUCTION;
+
+/**
+ * @brief a basic block of the instructions
+ */
+typedef struct _OPTIMIZER_BLOCK
+{
+    unsigned int First;
+    unsigned int Last;
+    unsigned int Successors[2];
+} OPTIMIZER_BLOCK, *POPTIMIZER_BLOCK;
+
+/**
+ * @brief the value that is known for a slot in the current block
+ * @details copies are only valid as long as the version of the source is
+ * not changed
+ */
+typedef struct _OPTIMIZER_SLOT_STATE
+{
+    unsigned int        Epoch;
+    OPTIMIZER_SLOT_KIND Kind;
+    unsigned long long  Value;
+    unsigned long long  SourceVersion;
+} OPTIMIZER_SLOT_STATE, *POPTIMIZER_SLOT_STATE;
+
+/**
+ * @brief state of the optimizer
+ */
+typedef struct _OPTIMIZER_CONTEXT
+{
+    PSYMBOL_BUFFER         CodeBuffer;
+    POPTIMIZER_INSTRUCTION Instructions;
+    unsigned int           InstructionCount;
+    POPTIMIZER_BLOCK       Blocks;
+    unsigned int           BlockCount;
+    unsigned int           SlotCount;
+    char *                 AddressTaken;
+    POPTIMIZER_SLOT_STATE  SlotStates;
+    unsigned long long *   SlotVersions;
+    unsigned int *         NewOffsets;
+    unsigned int           Epoch;
+} OPTIMIZER_CONTEXT, *POPTIMIZER_CONTEXT;
+
+////////////////////////////////////////////////////
+//			Optimizer functions					  //
+////////////////////////////////////////////////////
+
+OPTIMIZER_OPERATOR_CLASS
+OptimizerGetOperatorClass(unsigned long long Operator, unsigned int * OperandCount);
+
+char
+OptimizerFold(unsigned long long Operator, unsigned long long Src0, unsigned long long Src1, unsigned long long * Result);
+
+char
+OptimizerDecode(POPTIMIZER_CONTEXT Context);
+
+unsigned int
+OptimizerResolve(POPTIMIZER_CONTEXT Context, unsigned int Index);
+
+char
+OptimizerBuildBlocks(POPTIMIZER_CONTEXT Context);
+
+char
+OptimizerPropagateConstants(POPTIMIZER_CONTEXT Context);
+
+char
+OptimizerThreadJumps(POPTIMIZER_CONTEXT Context);
+
+char
+OptimizerEliminateDeadTemps(POPTIMIZER_CONTEXT Context);
+
+void
+OptimizerCompact(POPTIMIZER_CONTEXT Context);
+
+#endif // !OPTIMIZER_H
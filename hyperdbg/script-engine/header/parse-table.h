@@ -1,25 +1,25 @@
 #pragma once
 #ifndef PARSE_TABLE_H
 #define PARSE_TABLE_H
-#define RULES_COUNT 241
-#define TERMINAL_COUNT 116
+#define RULES_COUNT 248
+#define TERMINAL_COUNT 123
 #define NONETERMINAL_COUNT 49
 #define START_VARIABLE "S"
 #define MAX_RHS_LEN 15
-#define KEYWORD_LIST_LENGTH 104
+#define KEYWORD_LIST_LENGTH 111
 #define OPERATORS_ONE_OPERAND_LIST_LENGTH 4
 #define OPERATORS_TWO_OPERAND_LIST_LENGTH 16
 #define REGISTER_MAP_LIST_LENGTH 120
 #define PSEUDO_REGISTER_MAP_LIST_LENGTH 16
 #define SCRIPT_VARIABLE_TYPE_LIST_LENGTH 10
 #define ASSIGNMENT_OPERATOR_LIST_LENGTH 10
-#define SEMANTIC_RULES_MAP_LIST_LENGTH 150
+#define SEMANTIC_RULES_MAP_LIST_LENGTH 157
 #define THREEOPFUNC1_LENGTH 1
-#define THREEOPFUNC2_LENGTH 3
+#define THREEOPFUNC2_LENGTH 6
 #define TWOOPFUNC1_LENGTH 8
-#define TWOOPFUNC2_LENGTH 2
+#define TWOOPFUNC2_LENGTH 4
 #define ONEOPFUNC1_LENGTH 25
-#define ONEOPFUNC2_LENGTH 9
+#define ONEOPFUNC2_LENGTH 11
 #define ONEOPFUNC3_LENGTH 1
 #define TWOOPFUNC3_LENGTH 1
 #define THREEOPFUNC3_LENGTH 2
@@ -71,4 +71,31 @@ extern const char* LalrTerminalMap[TERMINAL_COUNT];
 extern const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT];
 extern const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT];
 extern const struct _TOKEN LalrSemanticRules[RULES_COUNT];
+#define TERMINAL_MAP_HASH_TABLE_SIZE 123
+extern const int TerminalMapHashDisplacements[TERMINAL_MAP_HASH_TABLE_SIZE];
+extern const unsigned short TerminalMapHashValues[TERMINAL_MAP_HASH_TABLE_SIZE];
+#define NONE_TERMINAL_MAP_HASH_TABLE_SIZE 49
+extern const int NoneTerminalMapHashDisplacements[NONE_TERMINAL_MAP_HASH_TABLE_SIZE];
+extern const unsigned short NoneTerminalMapHashValues[NONE_TERMINAL_MAP_HASH_TABLE_SIZE];
+#define LALR_TERMINAL_MAP_HASH_TABLE_SIZE 76
+extern const int LalrTerminalMapHashDisplacements[LALR_TERMINAL_MAP_HASH_TABLE_SIZE];
+extern const unsigned short LalrTerminalMapHashValues[LALR_TERMINAL_MAP_HASH_TABLE_SIZE];
+#define LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE 22
+extern const int LalrNoneTerminalMapHashDisplacements[LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE];
+extern const unsigned short LalrNoneTerminalMapHashValues[LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE];
+#define KEYWORD_LIST_HASH_TABLE_SIZE 70
+extern const int KeywordListHashDisplacements[KEYWORD_LIST_HASH_TABLE_SIZE];
+extern const unsigned short KeywordListHashValues[KEYWORD_LIST_HASH_TABLE_SIZE];
+#define SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE 115
+extern const int SemanticRulesMapListHashDisplacements[SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE];
+extern const unsigned short SemanticRulesMapListHashValues[SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE];
+#define REGISTER_MAP_LIST_HASH_TABLE_SIZE 120
+extern const int RegisterMapListHashDisplacements[REGISTER_MAP_LIST_HASH_TABLE_SIZE];
+extern const unsigned short RegisterMapListHashValues[REGISTER_MAP_LIST_HASH_TABLE_SIZE];
+#define PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE 16
+extern const int PseudoRegisterMapListHashDisplacements[PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE];
+extern const unsigned short PseudoRegisterMapListHashValues[PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE];
+#define SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE 10
+extern const int ScriptVariableTypeListHashDisplacements[SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE];
+extern const unsigned short ScriptVariableTypeListHashValues[SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE];
 #endif
@@ -46,6 +46,7 @@
 #include "parse-table.h"
 #include "type.h"
 #include "hardware.h"
+#include "optimizer.h"
 
 //
 // Import/export definitions
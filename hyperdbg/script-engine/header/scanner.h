@@ -19,11 +19,21 @@
  */
 PTOKEN_LIST GlobalIdTable;
 
+/**
+ * @brief hash table of the global Ids (name to index of GlobalIdTable)
+ */
+PIDENTIFIER_TABLE GlobalIdHashTable;
+
 /**
  * @brief
  */
 PUSER_DEFINED_FUNCTION_NODE UserDefinedFunctionHead;
 
+/**
+ * @brief hash table of the user defined functions (name to node)
+ */
+PIDENTIFIER_TABLE UserDefinedFunctionTable;
+
 PUSER_DEFINED_FUNCTION_NODE CurrentUserDefinedFunction;
 
 /**
@@ -16,6 +16,7 @@
 
 from ll1_parser import *
 from lalr1_parser import *
+from hash_table import *
 
 class Generator():
     def __init__(self): 
@@ -41,6 +42,9 @@ class Generator():
 
         self.lalr.Run()
 
+        self.WriteHashTables()
+        self.HeaderFile.write("#endif\n")
+
         self.CommonHeaderFile.write("#endif\n")
 
 
@@ -50,6 +54,25 @@ class Generator():
         self.CommonHeaderFile.close()
 
 
+    def WriteHashTables(self):
+
+        #
+        # Write perfect hash tables for the maps that are searched by the scanner and the parser
+        #
+        SemanticRulesNames = []
+        for X in self.ll1.OperatorsOneOperand + self.ll1.OperatorsTwoOperand + self.ll1.SemantiRulesList + self.ll1.keywordList + self.ll1.AssignmentOperator:
+            SemanticRulesNames.append("@" + X.upper())
+
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "TerminalMap", self.ll1.TerminalList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "NoneTerminalMap", self.ll1.NonTerminalList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "LalrTerminalMap", self.lalr.TerminalList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "LalrNoneTerminalMap", self.lalr.NonTerminalList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "KeywordList", self.ll1.keywordList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "SemanticRulesMapList", SemanticRulesNames)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "RegisterMapList", self.ll1.RegistersList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "PseudoRegisterMapList", self.ll1.PseudoRegistersList)
+        WritePerfectHashTable(self.SourceFile, self.HeaderFile, "ScriptVariableTypeList", self.ll1.VariableTypeList)
+
     def WriteCommonHeader(self):
     
         #
@@ -145,6 +168,7 @@ typedef struct ACTION_BUFFER {
   char ImmediatelySendTheResults;
   long long unsigned Context;
   char CallingStage;
+  char SendRecords;
 } ACTION_BUFFER, *PACTION_BUFFER;
 
 #define SYMBOL_UNDEFINED 0
@@ -0,0 +1,122 @@
+"""
+ * @file hash_table.py
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Script engine perfect hash table generator
+ * @details This module creates minimal perfect hash tables (hash and
+ *          displace) for the string maps of the script engine so the
+ *          scanner and the parser could look up the terminals, keywords,
+ *          registers and semantic rules in O(1) instead of a linear scan.
+ *          The hash function should be the same as PerfectHashString
+ *          in common.c
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+
+ """
+
+# FNV-1a offset basis and prime
+FNV_OFFSET_BASIS = 0x811c9dc5
+FNV_PRIME = 0x01000193
+
+# Maximum number of seeds that are tried for each bucket
+MAX_SEED_TRIES = 0x100000
+
+
+# Hash of a string by using a seed (it's the same as PerfectHashString in common.c)
+def PerfectHashString(Seed, Key):
+    Hash = (FNV_OFFSET_BASIS ^ Seed) & 0xffffffff
+    for C in Key.encode("ascii"):
+        Hash = ((Hash ^ C) * FNV_PRIME) & 0xffffffff
+
+    # Final mix, otherwise the low bits are weak for the small tables
+    Hash ^= Hash >> 16
+    Hash = (Hash * 0x7feb352d) & 0xffffffff
+    Hash ^= Hash >> 15
+    return Hash
+
+
+# Creates the displacement and the value tables for the keys
+# Returns (Displacements, Values) where a negative displacement means the
+# value is directly stored on Values[-Displacement - 1]
+def CreatePerfectHashTable(Keys):
+    Size = len(Keys)
+    Buckets = [[] for X in range(Size)]
+    Displacements = [0] * Size
+    Values = [None] * Size
+
+    for Index in range(Size):
+        Buckets[PerfectHashString(0, Keys[Index]) % Size].append(Index)
+
+    # Place the largest buckets first
+    Buckets.sort(key=len, reverse=True)
+
+    BucketIndex = 0
+    while BucketIndex < Size and len(Buckets[BucketIndex]) > 1:
+        Bucket = Buckets[BucketIndex]
+        Seed = 1
+        Slots = []
+
+        while len(Slots) < len(Bucket):
+            Slot = PerfectHashString(Seed, Keys[Bucket[len(Slots)]]) % Size
+            if Values[Slot] is not None or Slot in Slots:
+                Seed += 1
+                Slots = []
+                if Seed > MAX_SEED_TRIES:
+                    raise Exception("unable to create the perfect hash table")
+                continue
+            Slots.append(Slot)
+
+        Displacements[PerfectHashString(0, Keys[Bucket[0]]) % Size] = Seed
+        for i in range(len(Bucket)):
+            Values[Slots[i]] = Bucket[i]
+
+        BucketIndex += 1
+
+    # Buckets with only one item are placed directly on the free slots
+    FreeSlots = [X for X in range(Size) if Values[X] is None]
+    while BucketIndex < Size and len(Buckets[BucketIndex]) > 0:
+        Bucket = Buckets[BucketIndex]
+        Slot = FreeSlots.pop()
+        Displacements[PerfectHashString(0, Keys[Bucket[0]]) % Size] = -Slot - 1
+        Values[Slot] = Bucket[0]
+        BucketIndex += 1
+
+    # Empty slots never match, they point to the first item which is
+    # checked by the caller
+    Values = [0 if X is None else X for X in Values]
+
+    return Displacements, Values
+
+
+# Writes the perfect hash table of a map into the output files
+# Duplicated keys are ignored so the first item (same as the linear search) is returned
+def WritePerfectHashTable(SourceFile, HeaderFile, Name, Keys):
+    UniqueKeys = []
+    UniqueIndexes = []
+    for Index in range(len(Keys)):
+        if Keys[Index] not in UniqueKeys:
+            UniqueKeys.append(Keys[Index])
+            UniqueIndexes.append(Index)
+
+    Displacements, Values = CreatePerfectHashTable(UniqueKeys)
+    Values = [UniqueIndexes[X] for X in Values]
+
+    SizeName = ""
+    for i in range(len(Name)):
+        if i != 0 and Name[i].isupper() and not Name[i - 1].isupper():
+            SizeName += "_"
+        SizeName += Name[i].upper()
+    SizeName += "_HASH_TABLE_SIZE"
+
+    HeaderFile.write("#define " + SizeName + " " + str(len(UniqueKeys)) + "\n")
+    HeaderFile.write("extern const int " + Name + "HashDisplacements[" + SizeName + "];\n")
+    HeaderFile.write("extern const unsigned short " + Name + "HashValues[" + SizeName + "];\n")
+
+    SourceFile.write("const int " + Name + "HashDisplacements[" + SizeName + "]= \n{\n")
+    SourceFile.write(",\n".join(str(X) for X in Displacements) + "\n")
+    SourceFile.write("};\n")
+
+    SourceFile.write("const unsigned short " + Name + "HashValues[" + SizeName + "]= \n{\n")
+    SourceFile.write(",\n".join(str(X) for X in Values) + "\n")
+    SourceFile.write("};\n")
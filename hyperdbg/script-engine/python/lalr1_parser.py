@@ -87,8 +87,6 @@ class LALR1Parser:
 
         self.WriteParseTable()
         self.WriteSemanticRules()
-
-        self.HeaderFile.write("#endif\n")
         
         
 
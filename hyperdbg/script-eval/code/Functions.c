@@ -17,8 +17,9 @@
 //
 #ifdef SCRIPT_ENGINE_USER_MODE
 
-extern UINT64  g_CurrentExprEvalResult;
-extern BOOLEAN g_CurrentExprEvalResultHasError;
+extern UINT64             g_CurrentExprEvalResult;
+extern BOOLEAN            g_CurrentExprEvalResultHasError;
+extern SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
 
 #endif // SCRIPT_ENGINE_USER_MODE
 
@@ -1712,6 +1713,90 @@ ScriptEngineFunctionPrintf(PGUEST_REGS                       GuestRegs,
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
+/**
+ * @brief Implementation of printf function (as a binary record)
+ * @details The values are sent without formatting them, and the debugger
+ * formats them (based on the format in its copy of the script). Strings
+ * (%s and %ws) are not in the records, so they're formatted as texts
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param ScriptGeneralRegisters
+ * @param Format
+ * @param FormatOffset Offset of the format in the script
+ * @param ArgCount
+ * @param FirstArg
+ * @return BOOLEAN FALSE if the message should be formatted as a text
+ */
+BOOLEAN
+ScriptEngineFunctionPrintfRecord(PGUEST_REGS                       GuestRegs,
+                                 ACTION_BUFFER *                   ActionDetail,
+                                 SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+                                 char *                            Format,
+                                 UINT32                            FormatOffset,
+                                 UINT64                            ArgCount,
+                                 PSYMBOL                           FirstArg)
+{
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    EVENT_RECORD Record;
+    PSYMBOL      Symbol;
+    SYMBOL       TempSymbol;
+    BOOLEAN      IsString;
+    UINT32       Size;
+
+    if (ArgCount > EVENT_RECORD_MAXIMUM_VALUES)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < ArgCount; i++)
+    {
+        Symbol = FirstArg + i;
+
+        EventRecordGetSpecifierLength(&Format[(Symbol->Type >> 32) + 1], &IsString);
+
+        if (IsString)
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < ArgCount; i++)
+    {
+        memcpy(&TempSymbol, FirstArg + i, sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
+
+        Record.Values[i] = GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &TempSymbol, FALSE);
+    }
+
+    Size = EventRecordInitialize(&Record,
+                                 ActionDetail->Tag,
+                                 KeGetCurrentProcessorNumberEx(NULL),
+                                 __rdtsc(),
+                                 ActionDetail->Context,
+                                 FormatOffset,
+                                 (UINT32)ArgCount);
+
+    LogSimpleWithTag((UINT32)ActionDetail->Tag, ActionDetail->ImmediatelySendTheResults, (CHAR *)&Record, Size);
+
+    return TRUE;
+
+#else
+
+    UNREFERENCED_PARAMETER(GuestRegs);
+    UNREFERENCED_PARAMETER(ActionDetail);
+    UNREFERENCED_PARAMETER(ScriptGeneralRegisters);
+    UNREFERENCED_PARAMETER(Format);
+    UNREFERENCED_PARAMETER(FormatOffset);
+    UNREFERENCED_PARAMETER(ArgCount);
+    UNREFERENCED_PARAMETER(FirstArg);
+
+    return FALSE;
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
 /**
  * @brief Implementation of event_inject function
  *
@@ -1951,3 +2036,182 @@ ScriptEngineFunctionEventTraceStepIn()
 
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
+
+/**
+ * @brief Get the aggregation table of the current core
+ *
+ * @param MapId
+ * @param Kind
+ * @param HasError
+ * @return PSCRIPT_ENGINE_MAP_TABLE
+ */
+PSCRIPT_ENGINE_MAP_TABLE
+ScriptEngineFunctionMapGetCoreTable(UINT64 MapId, SCRIPT_ENGINE_MAP_KIND Kind, BOOL * HasError)
+{
+    UINT32 CurrentCore = 0;
+    LONG   PreviousKind;
+
+    if (MapId >= SCRIPT_ENGINE_MAP_MAXIMUM_COUNT || g_ScriptEngineMaps.Tables == NULL)
+    {
+        *HasError = TRUE;
+        return NULL;
+    }
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+    CurrentCore = KeGetCurrentProcessorNumberEx(NULL);
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+    //
+    // In user-mode, scripts are never run on multiple cores, so there
+    // is only one table
+    //
+    if (CurrentCore >= g_ScriptEngineMaps.CoreCount)
+    {
+        *HasError = TRUE;
+        return NULL;
+    }
+
+    //
+    // The first update determines whether the map is a histogram or not
+    //
+    PreviousKind = InterlockedCompareExchange(&g_ScriptEngineMaps.Kinds[MapId], Kind, SCRIPT_ENGINE_MAP_KIND_UNUSED);
+
+    if (PreviousKind != SCRIPT_ENGINE_MAP_KIND_UNUSED && PreviousKind != (LONG)Kind)
+    {
+        *HasError = TRUE;
+        return NULL;
+    }
+
+    return &g_ScriptEngineMaps.Tables[CurrentCore];
+}
+
+/**
+ * @brief Implementation of map_count, map_sum, map_min, map_max and hist functions
+ *
+ * @param MapId
+ * @param Key
+ * @param Operation
+ * @param Value
+ * @param HasError
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionMapUpdate(UINT64 MapId, UINT64 Key, SCRIPT_ENGINE_MAP_OPERATION Operation, UINT64 Value, BOOL * HasError)
+{
+    PSCRIPT_ENGINE_MAP_TABLE Table;
+
+    Table = ScriptEngineFunctionMapGetCoreTable(MapId,
+                                                Operation == SCRIPT_ENGINE_MAP_OPERATION_HISTOGRAM ? SCRIPT_ENGINE_MAP_KIND_HISTOGRAM : SCRIPT_ENGINE_MAP_KIND_KEYED,
+                                                HasError);
+
+    if (Table == NULL)
+    {
+        return;
+    }
+
+    //
+    // If the table is full, the update is counted as a dropped update
+    //
+    ScriptEngineMapUpdate(&g_ScriptEngineMaps, Table, (UINT32)MapId, Key, Operation, Value);
+}
+
+/**
+ * @brief Show a line of the results of the aggregation maps
+ *
+ * @param Tag
+ * @param ImmediateMessagePassing
+ * @param Line
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionMapShowLine(UINT64 Tag, BOOLEAN ImmediateMessagePassing, CHAR * Line)
+{
+    UNREFERENCED_PARAMETER(Tag);
+    UNREFERENCED_PARAMETER(ImmediateMessagePassing);
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+    ShowMessages("%s", Line);
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+    LogSimpleWithTag((UINT32)Tag, ImmediateMessagePassing, Line, (UINT32)strlen(Line) + 1);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
+
+/**
+ * @brief Implementation of map_print function
+ * @details Merges the tables of all cores and shows the result
+ *
+ * @param Tag
+ * @param ImmediateMessagePassing
+ * @param MapId
+ * @param HasError
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionMapPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT64 MapId, BOOL * HasError)
+{
+    PSCRIPT_ENGINE_MAP_ENTRY Entry;
+    UINT32                   Count;
+    UINT64                   DroppedCount;
+    CHAR                     Line[SCRIPT_ENGINE_MAP_LINE_SIZE] = {0};
+
+    if (MapId >= SCRIPT_ENGINE_MAP_MAXIMUM_COUNT || g_ScriptEngineMaps.Tables == NULL)
+    {
+        *HasError = TRUE;
+        return;
+    }
+
+    SpinlockLock(&g_ScriptEngineMaps.MergeLock);
+
+    Count = ScriptEngineMapMerge(&g_ScriptEngineMaps, (UINT32)MapId, &DroppedCount);
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Entry = &g_ScriptEngineMaps.Tables[g_ScriptEngineMaps.CoreCount].Entries[i];
+
+        ScriptEngineMapFormatEntry(Entry, g_ScriptEngineMaps.Kinds[MapId] == SCRIPT_ENGINE_MAP_KIND_HISTOGRAM, Line);
+        ScriptEngineFunctionMapShowLine(Tag, ImmediateMessagePassing, Line);
+    }
+
+    if (DroppedCount != 0)
+    {
+        sprintf(Line, "dropped: %llx\n", DroppedCount);
+        ScriptEngineFunctionMapShowLine(Tag, ImmediateMessagePassing, Line);
+    }
+
+    SpinlockUnlock(&g_ScriptEngineMaps.MergeLock);
+}
+
+/**
+ * @brief Implementation of map_clear function
+ *
+ * @param MapId
+ * @param HasError
+ * @return VOID
+ */
+VOID
+ScriptEngineFunctionMapClear(UINT64 MapId, BOOL * HasError)
+{
+    if (MapId >= SCRIPT_ENGINE_MAP_MAXIMUM_COUNT || g_ScriptEngineMaps.Tables == NULL)
+    {
+        *HasError = TRUE;
+        return;
+    }
+
+    //
+    // Entries of the older generations are ignored by all of the cores, so
+    // there is no need to touch the tables of other cores
+    //
+    InterlockedExchange(&g_ScriptEngineMaps.Kinds[MapId], SCRIPT_ENGINE_MAP_KIND_UNUSED);
+
+    if (InterlockedIncrement(&g_ScriptEngineMaps.Generations[MapId]) == 0)
+    {
+        //
+        // Generation zero is reserved for the empty slots
+        //
+        InterlockedIncrement(&g_ScriptEngineMaps.Generations[MapId]);
+    }
+}
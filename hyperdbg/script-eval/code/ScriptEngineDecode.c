@@ -0,0 +1,839 @@
+/**
+ * @file ScriptEngineDecode.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Pre-decoded (threaded) interpreter for the script engine
+ * @details The SYMBOL_BUFFER is decoded once (when the action is registered)
+ * into a compact instruction stream with resolved operand kinds, the hot
+ * operators are then dispatched directly (computed goto on compilers that
+ * support it and a dense switch on others) and the rest of the operators
+ * are passed to the regular interpreter (ScriptEngineExecute)
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+#include "../script-eval/header/ScriptEngineInternalHeader.h"
+
+//
+// *** Definitions ***
+//
+UINT64
+GetValue(PGUEST_REGS                      GuestRegs,
+         PACTION_BUFFER                   ActionBuffer,
+         PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+         PSYMBOL                          Symbol,
+         BOOLEAN                          ReturnReference);
+
+VOID
+SetValue(PGUEST_REGS                       GuestRegs,
+         SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+         PSYMBOL                           Symbol,
+         UINT64                            Value);
+
+//
+// Labels as values are only available on GCC and Clang, MSVC uses
+// the dense switch instead
+//
+#if defined(__GNUC__) || defined(__clang__)
+#    define SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+#endif
+
+/**
+ * @brief Resolve the kind of a single operand
+ *
+ * @param Symbol The symbol of the operand
+ * @param Operand The resolved operand
+ *
+ * @return BOOLEAN TRUE if the operand could be resolved
+ */
+static BOOLEAN
+ScriptEngineDecodeOperand(PSYMBOL Symbol, PSCRIPT_ENGINE_DECODED_OPERAND Operand)
+{
+    Operand->Value = Symbol->Value;
+
+    switch (Symbol->Type)
+    {
+    case SYMBOL_NUM_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_IMMEDIATE;
+        return TRUE;
+
+    case SYMBOL_GLOBAL_ID_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_GLOBAL;
+        return TRUE;
+
+    case SYMBOL_TEMP_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_TEMP;
+        return TRUE;
+
+    case SYMBOL_FUNCTION_PARAMETER_ID_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_FUNCTION_PARAMETER;
+        return TRUE;
+
+    case SYMBOL_STACK_INDEX_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_STACK_INDEX;
+        return TRUE;
+
+    case SYMBOL_STACK_BASE_INDEX_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_STACK_BASE_INDEX;
+        return TRUE;
+
+    case SYMBOL_RETURN_VALUE_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_DECODED_OPERAND_RETURN_VALUE;
+        return TRUE;
+
+    case SYMBOL_REGISTER_TYPE:
+    case SYMBOL_PSEUDO_REG_TYPE:
+
+        //
+        // Registers are read and written through the original symbol
+        //
+        Operand->Kind  = SCRIPT_ENGINE_DECODED_OPERAND_SYMBOL;
+        Operand->Value = (UINT64)Symbol;
+        return TRUE;
+
+    default:
+
+        //
+        // Strings, wide strings, etc. are left to the regular interpreter
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Get the pre-decoded opcode and the operand count of an operator
+ *
+ * @param Operator The operator value (FUNC_*)
+ * @param OperandCount Number of operands that follow the operator
+ *
+ * @return UINT32 The decoded opcode
+ */
+static UINT32
+ScriptEngineDecodeOperator(UINT64 Operator, UINT32 * OperandCount)
+{
+    switch (Operator)
+    {
+    case FUNC_MOV:
+        *OperandCount = 2;
+        return SCRIPT_ENGINE_DECODED_OPCODE_MOV;
+    case FUNC_ADD:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_ADD;
+    case FUNC_SUB:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_SUB;
+    case FUNC_MUL:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_MUL;
+    case FUNC_DIV:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_DIV;
+    case FUNC_MOD:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_MOD;
+    case FUNC_OR:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_OR;
+    case FUNC_XOR:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_XOR;
+    case FUNC_AND:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_AND;
+    case FUNC_ASR:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_ASR;
+    case FUNC_ASL:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_ASL;
+    case FUNC_GT:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_GT;
+    case FUNC_LT:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_LT;
+    case FUNC_EGT:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_EGT;
+    case FUNC_ELT:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_ELT;
+    case FUNC_EQUAL:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_EQUAL;
+    case FUNC_NEQ:
+        *OperandCount = 3;
+        return SCRIPT_ENGINE_DECODED_OPCODE_NEQ;
+    case FUNC_NOT:
+        *OperandCount = 2;
+        return SCRIPT_ENGINE_DECODED_OPCODE_NOT;
+    case FUNC_NEG:
+        *OperandCount = 2;
+        return SCRIPT_ENGINE_DECODED_OPCODE_NEG;
+    case FUNC_INC:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_INC;
+    case FUNC_DEC:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_DEC;
+    case FUNC_JMP:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_JMP;
+    case FUNC_JZ:
+        *OperandCount = 2;
+        return SCRIPT_ENGINE_DECODED_OPCODE_JZ;
+    case FUNC_JNZ:
+        *OperandCount = 2;
+        return SCRIPT_ENGINE_DECODED_OPCODE_JNZ;
+    case FUNC_PUSH:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_PUSH;
+    case FUNC_POP:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_POP;
+    case FUNC_CALL:
+        *OperandCount = 1;
+        return SCRIPT_ENGINE_DECODED_OPCODE_CALL;
+    case FUNC_RET:
+        *OperandCount = 0;
+        return SCRIPT_ENGINE_DECODED_OPCODE_RET;
+    default:
+        *OperandCount = 0;
+        return SCRIPT_ENGINE_DECODED_OPCODE_SLOW;
+    }
+}
+
+/**
+ * @brief Get the offset of the instructions in the pre-decoded buffer
+ *
+ * @param SymbolCount Number of symbols in the original buffer
+ *
+ * @return UINT32
+ */
+static UINT32
+ScriptEngineDecodeGetInstructionsOffset(UINT32 SymbolCount)
+{
+    UINT32 Offset = sizeof(SCRIPT_ENGINE_DECODED_BUFFER) + SymbolCount * sizeof(UINT32);
+
+    //
+    // Keep the instructions 8-byte aligned
+    //
+    return (Offset + 7) & ~7u;
+}
+
+/**
+ * @brief Get the size that is needed for pre-decoding a script buffer
+ *
+ * @param CodeBuffer The script buffer
+ *
+ * @return UINT32 Size of the buffer that should be passed to ScriptEngineDecode
+ */
+UINT32
+ScriptEngineDecodeGetBufferSize(SYMBOL_BUFFER * CodeBuffer)
+{
+    UINT32 OperatorCount = 0;
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i++)
+    {
+        if (CodeBuffer->Head[i].Type == SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            OperatorCount++;
+        }
+    }
+
+    //
+    // One more instruction for the shared slow instruction
+    //
+    return ScriptEngineDecodeGetInstructionsOffset(CodeBuffer->Pointer) +
+           (OperatorCount + 1) * sizeof(SCRIPT_ENGINE_DECODED_INSTRUCTION);
+}
+
+/**
+ * @brief Pre-decode the script buffer into a compact instruction stream
+ * @details Every symbol that looks like an operator is decoded, even if it's
+ * part of a string, as the execution never lands on them, it's harmless
+ *
+ * @param CodeBuffer The script buffer
+ * @param DecodedBuffer The target buffer (at least ScriptEngineDecodeGetBufferSize bytes)
+ * @param DecodedBufferSize Size of the target buffer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineDecode(SYMBOL_BUFFER * CodeBuffer, PVOID DecodedBuffer, UINT32 DecodedBufferSize)
+{
+    PSCRIPT_ENGINE_DECODED_BUFFER      Decoded = (PSCRIPT_ENGINE_DECODED_BUFFER)DecodedBuffer;
+    PSCRIPT_ENGINE_DECODED_INSTRUCTION Instruction;
+    UINT32                             OperandCount;
+    UINT32                             Opcode;
+
+    if (DecodedBuffer == NULL || DecodedBufferSize < ScriptEngineDecodeGetBufferSize(CodeBuffer))
+    {
+        return FALSE;
+    }
+
+    Decoded->SymbolCount      = CodeBuffer->Pointer;
+    Decoded->InstructionCount = 1;
+    Decoded->IndexMap         = (UINT32 *)((CHAR *)DecodedBuffer + sizeof(SCRIPT_ENGINE_DECODED_BUFFER));
+    Decoded->Instructions     = (PSCRIPT_ENGINE_DECODED_INSTRUCTION)((CHAR *)DecodedBuffer +
+                                                                 ScriptEngineDecodeGetInstructionsOffset(CodeBuffer->Pointer));
+
+    //
+    // The first instruction is the shared slow instruction
+    //
+    RtlZeroMemory(&Decoded->Instructions[0], sizeof(SCRIPT_ENGINE_DECODED_INSTRUCTION));
+    Decoded->Instructions[0].Opcode = SCRIPT_ENGINE_DECODED_OPCODE_SLOW;
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i++)
+    {
+        Decoded->IndexMap[i] = 0;
+
+        if (CodeBuffer->Head[i].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            continue;
+        }
+
+        Opcode = ScriptEngineDecodeOperator(CodeBuffer->Head[i].Value, &OperandCount);
+
+        if (Opcode == SCRIPT_ENGINE_DECODED_OPCODE_SLOW || i + OperandCount >= CodeBuffer->Pointer)
+        {
+            continue;
+        }
+
+        Instruction = &Decoded->Instructions[Decoded->InstructionCount];
+        RtlZeroMemory(Instruction, sizeof(SCRIPT_ENGINE_DECODED_INSTRUCTION));
+
+        Instruction->Opcode = Opcode;
+        Instruction->Next   = i + 1 + OperandCount;
+
+        for (UINT32 j = 0; j < OperandCount; j++)
+        {
+            if (!ScriptEngineDecodeOperand(&CodeBuffer->Head[i + 1 + j], &Instruction->Operands[j]))
+            {
+                Opcode = SCRIPT_ENGINE_DECODED_OPCODE_SLOW;
+                break;
+            }
+        }
+
+        if (Opcode == SCRIPT_ENGINE_DECODED_OPCODE_SLOW)
+        {
+            continue;
+        }
+
+        Decoded->IndexMap[i] = Decoded->InstructionCount;
+        Decoded->InstructionCount++;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Read the value of a pre-decoded operand
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param ScriptGeneralRegisters
+ * @param Operand
+ *
+ * @return UINT64
+ */
+static inline UINT64
+ScriptEngineDecodedGetValue(PGUEST_REGS                      GuestRegs,
+                            PACTION_BUFFER                   ActionDetail,
+                            PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                            PSCRIPT_ENGINE_DECODED_OPERAND   Operand)
+{
+    switch (Operand->Kind)
+    {
+    case SCRIPT_ENGINE_DECODED_OPERAND_IMMEDIATE:
+        return Operand->Value;
+    case SCRIPT_ENGINE_DECODED_OPERAND_GLOBAL:
+        return ScriptGeneralRegisters->GlobalVariablesList[Operand->Value];
+    case SCRIPT_ENGINE_DECODED_OPERAND_TEMP:
+        return ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Operand->Value];
+    case SCRIPT_ENGINE_DECODED_OPERAND_FUNCTION_PARAMETER:
+        return ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx - 3 - Operand->Value];
+    case SCRIPT_ENGINE_DECODED_OPERAND_STACK_INDEX:
+        return ScriptGeneralRegisters->StackIndx;
+    case SCRIPT_ENGINE_DECODED_OPERAND_STACK_BASE_INDEX:
+        return ScriptGeneralRegisters->StackBaseIndx;
+    case SCRIPT_ENGINE_DECODED_OPERAND_RETURN_VALUE:
+        return ScriptGeneralRegisters->ReturnValue;
+    default:
+        return GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, (PSYMBOL)Operand->Value, FALSE);
+    }
+}
+
+/**
+ * @brief Write the value of a pre-decoded operand
+ *
+ * @param GuestRegs
+ * @param ScriptGeneralRegisters
+ * @param Operand
+ * @param Value
+ *
+ * @return VOID
+ */
+static inline VOID
+ScriptEngineDecodedSetValue(PGUEST_REGS                      GuestRegs,
+                            PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                            PSCRIPT_ENGINE_DECODED_OPERAND   Operand,
+                            UINT64                           Value)
+{
+    switch (Operand->Kind)
+    {
+    case SCRIPT_ENGINE_DECODED_OPERAND_GLOBAL:
+        ScriptGeneralRegisters->GlobalVariablesList[Operand->Value] = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_TEMP:
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx + Operand->Value] = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_FUNCTION_PARAMETER:
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackBaseIndx - 3 - Operand->Value] = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_STACK_INDEX:
+        ScriptGeneralRegisters->StackIndx = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_STACK_BASE_INDEX:
+        ScriptGeneralRegisters->StackBaseIndx = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_RETURN_VALUE:
+        ScriptGeneralRegisters->ReturnValue = Value;
+        return;
+    case SCRIPT_ENGINE_DECODED_OPERAND_SYMBOL:
+        SetValue(GuestRegs, ScriptGeneralRegisters, (PSYMBOL)Operand->Value, Value);
+        return;
+    default:
+
+        //
+        // Immediate values are not writable (same as SetValue)
+        //
+        return;
+    }
+}
+
+//
+// Helpers of the dispatch loop
+//
+#define DecodedGet(OperandIndex) \
+    ScriptEngineDecodedGetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, &Instruction->Operands[OperandIndex])
+
+#define DecodedSet(OperandIndex, Value) \
+    ScriptEngineDecodedSetValue(GuestRegs, ScriptGeneralRegisters, &Instruction->Operands[OperandIndex], Value)
+
+#ifdef SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+#    define DecodedHandler(Name) \
+        case SCRIPT_ENGINE_DECODED_OPCODE_##Name: \
+        Handler##Name
+#    define DecodedDispatch() goto *DispatchTable[Instruction->Opcode]
+#else
+#    define DecodedHandler(Name) case SCRIPT_ENGINE_DECODED_OPCODE_##Name
+#    define DecodedDispatch()    goto Dispatch
+#endif // SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+
+//
+// Report the number of the executed instructions (if requested) and return
+//
+#define DecodedReturn(Status)                \
+    do                                       \
+    {                                        \
+        if (ExecutedCount != NULL)           \
+            *ExecutedCount = ExecutionCount; \
+        return Status;                       \
+    } while (FALSE)
+
+//
+// The instruction that has the error is also counted
+//
+#define DecodedReturnError()                                  \
+    do                                                        \
+    {                                                         \
+        ExecutionCount++;                                     \
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_ERROR); \
+    } while (FALSE)
+
+//
+// Same checks as the regular interpreter's loop, performed after each instruction
+//
+#define DecodedNext()                                                                 \
+    ExecutionCount++;                                                                 \
+    if (ScriptGeneralRegisters->StackIndx >= MAX_STACK_BUFFER_COUNT)                  \
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW);                \
+    if (ExecutionCount > MAX_EXECUTION_COUNT)                                         \
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT); \
+    if (Indx >= DecodedBuffer->SymbolCount)                                           \
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL);                    \
+    Instruction = &DecodedBuffer->Instructions[DecodedBuffer->IndexMap[Indx]];        \
+    DecodedDispatch()
+
+#define DecodedBinary(Expression) \
+    SrcVal0 = DecodedGet(0);          \
+    SrcVal1 = DecodedGet(1);          \
+    DecodedSet(2, (UINT64)(Expression))
+
+/**
+ * @brief Execute the whole pre-decoded script
+ *
+ * @param GuestRegs General purpose registers
+ * @param ActionDetail Detail of the specific action
+ * @param ScriptGeneralRegisters Script general registers
+ * @param CodeBuffer The original script buffer (used by the slow instructions)
+ * @param DecodedBuffer The pre-decoded buffer of the same script
+ * @param ErrorOperator Error in operator
+ * @param ExecutedCount Number of the executed instructions (optional, can be NULL)
+ *
+ * @return SCRIPT_ENGINE_DECODED_EXECUTION_STATUS
+ */
+SCRIPT_ENGINE_DECODED_EXECUTION_STATUS
+ScriptEngineExecuteDecoded(PGUEST_REGS                      GuestRegs,
+                           ACTION_BUFFER *                  ActionDetail,
+                           PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                           SYMBOL_BUFFER *                  CodeBuffer,
+                           PSCRIPT_ENGINE_DECODED_BUFFER    DecodedBuffer,
+                           SYMBOL *                         ErrorOperator,
+                           UINT64 *                         ExecutedCount)
+{
+    PSCRIPT_ENGINE_DECODED_INSTRUCTION Instruction;
+    UINT64                             Indx           = 0;
+    UINT64                             ExecutionCount = 0;
+    UINT64                             SrcVal0;
+    UINT64                             SrcVal1;
+
+#ifdef SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+    static const void * const DispatchTable[SCRIPT_ENGINE_DECODED_OPCODE_COUNT] = {
+        [SCRIPT_ENGINE_DECODED_OPCODE_SLOW]  = &&HandlerSLOW,
+        [SCRIPT_ENGINE_DECODED_OPCODE_MOV]   = &&HandlerMOV,
+        [SCRIPT_ENGINE_DECODED_OPCODE_ADD]   = &&HandlerADD,
+        [SCRIPT_ENGINE_DECODED_OPCODE_SUB]   = &&HandlerSUB,
+        [SCRIPT_ENGINE_DECODED_OPCODE_MUL]   = &&HandlerMUL,
+        [SCRIPT_ENGINE_DECODED_OPCODE_DIV]   = &&HandlerDIV,
+        [SCRIPT_ENGINE_DECODED_OPCODE_MOD]   = &&HandlerMOD,
+        [SCRIPT_ENGINE_DECODED_OPCODE_OR]    = &&HandlerOR,
+        [SCRIPT_ENGINE_DECODED_OPCODE_XOR]   = &&HandlerXOR,
+        [SCRIPT_ENGINE_DECODED_OPCODE_AND]   = &&HandlerAND,
+        [SCRIPT_ENGINE_DECODED_OPCODE_ASR]   = &&HandlerASR,
+        [SCRIPT_ENGINE_DECODED_OPCODE_ASL]   = &&HandlerASL,
+        [SCRIPT_ENGINE_DECODED_OPCODE_GT]    = &&HandlerGT,
+        [SCRIPT_ENGINE_DECODED_OPCODE_LT]    = &&HandlerLT,
+        [SCRIPT_ENGINE_DECODED_OPCODE_EGT]   = &&HandlerEGT,
+        [SCRIPT_ENGINE_DECODED_OPCODE_ELT]   = &&HandlerELT,
+        [SCRIPT_ENGINE_DECODED_OPCODE_EQUAL] = &&HandlerEQUAL,
+        [SCRIPT_ENGINE_DECODED_OPCODE_NEQ]   = &&HandlerNEQ,
+        [SCRIPT_ENGINE_DECODED_OPCODE_NOT]   = &&HandlerNOT,
+        [SCRIPT_ENGINE_DECODED_OPCODE_NEG]   = &&HandlerNEG,
+        [SCRIPT_ENGINE_DECODED_OPCODE_INC]   = &&HandlerINC,
+        [SCRIPT_ENGINE_DECODED_OPCODE_DEC]   = &&HandlerDEC,
+        [SCRIPT_ENGINE_DECODED_OPCODE_JMP]   = &&HandlerJMP,
+        [SCRIPT_ENGINE_DECODED_OPCODE_JZ]    = &&HandlerJZ,
+        [SCRIPT_ENGINE_DECODED_OPCODE_JNZ]   = &&HandlerJNZ,
+        [SCRIPT_ENGINE_DECODED_OPCODE_PUSH]  = &&HandlerPUSH,
+        [SCRIPT_ENGINE_DECODED_OPCODE_POP]   = &&HandlerPOP,
+        [SCRIPT_ENGINE_DECODED_OPCODE_CALL]  = &&HandlerCALL,
+        [SCRIPT_ENGINE_DECODED_OPCODE_RET]   = &&HandlerRET,
+    };
+#endif // SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+
+    if (DecodedBuffer->SymbolCount != CodeBuffer->Pointer)
+    {
+        //
+        // The pre-decoded buffer doesn't belong to this script
+        //
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_ERROR);
+    }
+
+    if (Indx >= DecodedBuffer->SymbolCount)
+    {
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL);
+    }
+
+    Instruction = &DecodedBuffer->Instructions[DecodedBuffer->IndexMap[Indx]];
+
+#ifndef SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+Dispatch:
+#endif // !SCRIPT_ENGINE_DECODED_THREADED_DISPATCH
+
+    switch (Instruction->Opcode)
+    {
+    DecodedHandler(SLOW):
+    {
+        //
+        // Not a hot operator, let the regular interpreter run it
+        //
+        if (ScriptEngineExecute(GuestRegs,
+                                ActionDetail,
+                                ScriptGeneralRegisters,
+                                CodeBuffer,
+                                &Indx,
+                                ErrorOperator) == TRUE)
+        {
+            DecodedReturnError();
+        }
+
+        DecodedNext();
+    }
+
+    DecodedHandler(MOV):
+    {
+        DecodedSet(1, DecodedGet(0));
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(ADD):
+    {
+        DecodedBinary(SrcVal1 + SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(SUB):
+    {
+        DecodedBinary(SrcVal1 - SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(MUL):
+    {
+        DecodedBinary(SrcVal1 * SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(OR):
+    {
+        DecodedBinary(SrcVal1 | SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(XOR):
+    {
+        DecodedBinary(SrcVal1 ^ SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(AND):
+    {
+        DecodedBinary(SrcVal1 & SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(ASR):
+    {
+        DecodedBinary(SrcVal1 >> SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(ASL):
+    {
+        DecodedBinary(SrcVal1 << SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(GT):
+    {
+        DecodedBinary((INT64)SrcVal1 > (INT64)SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(LT):
+    {
+        DecodedBinary((INT64)SrcVal1 < (INT64)SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(EGT):
+    {
+        DecodedBinary((INT64)SrcVal1 >= (INT64)SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(ELT):
+    {
+        DecodedBinary((INT64)SrcVal1 <= (INT64)SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(EQUAL):
+    {
+        DecodedBinary(SrcVal1 == SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(NEQ):
+    {
+        DecodedBinary(SrcVal1 != SrcVal0);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(DIV):
+    DecodedHandler(MOD):
+    {
+        SrcVal0 = DecodedGet(0);
+        SrcVal1 = DecodedGet(1);
+
+        if (SrcVal0 == 0)
+        {
+            //
+            // Division by zero, report the operator
+            //
+            *ErrorOperator = CodeBuffer->Head[Indx];
+            DecodedReturnError();
+        }
+
+        if (Instruction->Opcode == SCRIPT_ENGINE_DECODED_OPCODE_DIV)
+        {
+            DecodedSet(2, SrcVal1 / SrcVal0);
+        }
+        else
+        {
+            DecodedSet(2, SrcVal1 % SrcVal0);
+        }
+
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(NOT):
+    {
+        DecodedSet(1, ~DecodedGet(0));
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(NEG):
+    {
+        DecodedSet(1, (UINT64)(-(INT64)DecodedGet(0)));
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(INC):
+    {
+        DecodedSet(0, DecodedGet(0) + 1);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(DEC):
+    {
+        DecodedSet(0, DecodedGet(0) - 1);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(JMP):
+    {
+        Indx = DecodedGet(0);
+
+        DecodedNext();
+    }
+
+    DecodedHandler(JZ):
+    {
+        SrcVal0 = DecodedGet(0);
+        SrcVal1 = DecodedGet(1);
+        Indx    = SrcVal1 == 0 ? SrcVal0 : Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(JNZ):
+    {
+        SrcVal0 = DecodedGet(0);
+        SrcVal1 = DecodedGet(1);
+        Indx    = SrcVal1 != 0 ? SrcVal0 : Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(PUSH):
+    {
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx] = DecodedGet(0);
+        ScriptGeneralRegisters->StackIndx++;
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(POP):
+    {
+        ScriptGeneralRegisters->StackIndx--;
+        DecodedSet(0, ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx]);
+        Indx = Instruction->Next;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(CALL):
+    {
+        SrcVal0 = DecodedGet(0);
+
+        //
+        // The return address is the symbol index right after the call
+        //
+        ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx] = Instruction->Next;
+        ScriptGeneralRegisters->StackIndx++;
+        Indx = SrcVal0;
+
+        DecodedNext();
+    }
+
+    DecodedHandler(RET):
+    {
+        ScriptGeneralRegisters->StackIndx--;
+        Indx = ScriptGeneralRegisters->StackBuffer[ScriptGeneralRegisters->StackIndx];
+
+        DecodedNext();
+    }
+
+    default:
+
+        //
+        // Shouldn't reach here
+        //
+        DecodedReturn(SCRIPT_ENGINE_DECODED_EXECUTION_ERROR);
+    }
+}
+
+#undef DecodedGet
+#undef DecodedSet
+#undef DecodedHandler
+#undef DecodedDispatch
+#undef DecodedNext
+#undef DecodedReturn
+#undef DecodedReturnError
+#undef DecodedBinary
@@ -718,6 +718,119 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
 
         break;
 
+    case FUNC_MAP_COUNT:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
+
+        ScriptEngineFunctionMapUpdate(SrcVal1, SrcVal0, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0, &HasError);
+
+        break;
+
+    case FUNC_HIST:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
+
+        ScriptEngineFunctionMapUpdate(SrcVal1, 0, SCRIPT_ENGINE_MAP_OPERATION_HISTOGRAM, SrcVal0, &HasError);
+
+        break;
+
+    case FUNC_MAP_SUM:
+    case FUNC_MAP_MIN:
+    case FUNC_MAP_MAX:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        Src1 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src1, FALSE);
+
+        Src2 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src2, FALSE);
+
+        ScriptEngineFunctionMapUpdate(SrcVal2,
+                                      SrcVal1,
+                                      Operator->Value == FUNC_MAP_SUM   ? SCRIPT_ENGINE_MAP_OPERATION_SUM
+                                      : Operator->Value == FUNC_MAP_MIN ? SCRIPT_ENGINE_MAP_OPERATION_MIN
+                                                                      : SCRIPT_ENGINE_MAP_OPERATION_MAX,
+                                      SrcVal0,
+                                      &HasError);
+
+        break;
+
+    case FUNC_MAP_PRINT:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        ScriptEngineFunctionMapPrint(ActionDetail->Tag,
+                                     ActionDetail->ImmediatelySendTheResults,
+                                     SrcVal0,
+                                     &HasError);
+
+        break;
+
+    case FUNC_MAP_CLEAR:
+
+        Src0 = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+
+        *Indx = *Indx + 1;
+
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, ScriptGeneralRegisters, Src0, FALSE);
+
+        ScriptEngineFunctionMapClear(SrcVal0, &HasError);
+
+        break;
+
     case FUNC_PAUSE:
 
         ScriptEngineFunctionPause(ActionDetail,
@@ -2274,6 +2387,23 @@ ScriptEngineExecute(PGUEST_REGS                      GuestRegs,
             *Indx = *Indx + Src1->Value;
         }
 
+        //
+        // The format is identified by its offset in the script (if the
+        // message is sent as a binary record)
+        //
+        if (ActionDetail->SendRecords &&
+            ScriptEngineFunctionPrintfRecord(
+                GuestRegs,
+                ActionDetail,
+                ScriptGeneralRegisters,
+                (char *)&Src0->Value,
+                (UINT32)((UINT64)&Src0->Value - (UINT64)CodeBuffer->Head),
+                Src1->Value,
+                Src2))
+        {
+            break;
+        }
+
         ScriptEngineFunctionPrintf(
             GuestRegs,
             ActionDetail,
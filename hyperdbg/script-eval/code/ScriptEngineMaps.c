@@ -0,0 +1,413 @@
+/**
+ * @file ScriptEngineMaps.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Aggregation maps of the script engine
+ * @details Scripts could aggregate the values (count, sum, min, max and
+ * histogram) by key instead of sending a message for each hit. Each core
+ * has its own fixed-capacity open-addressing table which is only modified
+ * by that core, the tables are merged once the results are requested.
+ * This file doesn't use any platform-specific function, the per-core
+ * selection, locking and showing the results are in Functions.c
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Get the size of the buffer that should be allocated for the maps
+ *
+ * @param CoreCount
+ * @return UINT64
+ */
+UINT64
+ScriptEngineMapsGetRequiredSize(UINT32 CoreCount)
+{
+    //
+    // One table for each core plus the table for merging the results
+    //
+    return ((UINT64)CoreCount + 1) * sizeof(SCRIPT_ENGINE_MAP_TABLE);
+}
+
+/**
+ * @brief Initialize the maps
+ *
+ * @param Maps
+ * @param Buffer A buffer with the size of ScriptEngineMapsGetRequiredSize
+ * @param CoreCount
+ * @return VOID
+ */
+VOID
+ScriptEngineMapsInitialize(PSCRIPT_ENGINE_MAPS Maps, PVOID Buffer, UINT32 CoreCount)
+{
+    memset(Buffer, 0, (size_t)ScriptEngineMapsGetRequiredSize(CoreCount));
+    memset(Maps, 0, sizeof(SCRIPT_ENGINE_MAPS));
+
+    Maps->Tables    = (PSCRIPT_ENGINE_MAP_TABLE)Buffer;
+    Maps->CoreCount = CoreCount;
+
+    //
+    // Generation zero is reserved for the empty slots
+    //
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_MAP_MAXIMUM_COUNT; i++)
+    {
+        Maps->Generations[i] = 1;
+    }
+}
+
+/**
+ * @brief Hash of a key of a map
+ *
+ * @param MapId
+ * @param Key
+ * @return UINT64
+ */
+static UINT64
+ScriptEngineMapHash(UINT32 MapId, UINT64 Key)
+{
+    UINT64 Hash = Key ^ ((UINT64)MapId * 0x9e3779b97f4a7c15ull);
+
+    Hash ^= Hash >> 30;
+    Hash *= 0xbf58476d1ce4e5b9ull;
+    Hash ^= Hash >> 27;
+    Hash *= 0x94d049bb133111ebull;
+    Hash ^= Hash >> 31;
+
+    return Hash;
+}
+
+/**
+ * @brief Get the bucket of a value in the histograms (power of two buckets)
+ * @details Bucket zero holds zero and bucket n holds [2^(n-1), 2^n)
+ *
+ * @param Value
+ * @return UINT64
+ */
+UINT64
+ScriptEngineMapGetHistogramBucket(UINT64 Value)
+{
+    UINT64 Bucket = 0;
+
+    while (Value != 0)
+    {
+        Value >>= 1;
+        Bucket++;
+    }
+
+    return Bucket;
+}
+
+/**
+ * @brief Find the entry of a key (or a free slot for it) in a table
+ *
+ * @param Maps
+ * @param Table
+ * @param MapId
+ * @param Generation The current generation of the map
+ * @param Key
+ * @return PSCRIPT_ENGINE_MAP_ENTRY NULL if there is no free slot
+ */
+static PSCRIPT_ENGINE_MAP_ENTRY
+ScriptEngineMapFindEntry(PSCRIPT_ENGINE_MAPS      Maps,
+                         PSCRIPT_ENGINE_MAP_TABLE Table,
+                         UINT32                   MapId,
+                         UINT32                   Generation,
+                         UINT64                   Key)
+{
+    PSCRIPT_ENGINE_MAP_ENTRY Entry;
+    PSCRIPT_ENGINE_MAP_ENTRY ReusableEntry = NULL;
+    UINT64                   Slot          = ScriptEngineMapHash(MapId, Key);
+
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_MAP_MAXIMUM_PROBE_COUNT; i++)
+    {
+        Entry = &Table->Entries[(Slot + i) & (SCRIPT_ENGINE_MAP_TABLE_CAPACITY - 1)];
+
+        if (Entry->Generation == 0)
+        {
+            //
+            // The key is not in the table
+            //
+            break;
+        }
+
+        if (Entry->Generation != (UINT32)Maps->Generations[Entry->MapId])
+        {
+            //
+            // The map of this entry is cleared, so the slot could be reused
+            // (but the key might still be after it)
+            //
+            if (ReusableEntry == NULL)
+            {
+                ReusableEntry = Entry;
+            }
+            continue;
+        }
+
+        if (Entry->MapId == MapId && Entry->Key == Key && Entry->Generation == Generation)
+        {
+            return Entry;
+        }
+    }
+
+    if (ReusableEntry == NULL)
+    {
+        if (Entry->Generation != 0)
+        {
+            return NULL;
+        }
+
+        ReusableEntry = Entry;
+    }
+
+    //
+    // Fill the entry before publishing it by its generation, so the merging
+    // core never sees a half-initialized entry
+    //
+    ReusableEntry->Generation = 0;
+    ReusableEntry->MapId      = MapId;
+    ReusableEntry->Key        = Key;
+    ReusableEntry->Count      = 0;
+    ReusableEntry->Sum        = 0;
+    ReusableEntry->Min        = MAXULONG64;
+    ReusableEntry->Max        = 0;
+    ReusableEntry->Flags      = 0;
+    ReusableEntry->Generation = Generation;
+
+    return ReusableEntry;
+}
+
+/**
+ * @brief Update a key of a map in the table of the current core
+ *
+ * @param Maps
+ * @param Table The table of the current core
+ * @param MapId
+ * @param Key
+ * @param Operation
+ * @param Value
+ * @return BOOLEAN FALSE if the table is full and the update is dropped
+ */
+BOOLEAN
+ScriptEngineMapUpdate(PSCRIPT_ENGINE_MAPS         Maps,
+                      PSCRIPT_ENGINE_MAP_TABLE    Table,
+                      UINT32                      MapId,
+                      UINT64                      Key,
+                      SCRIPT_ENGINE_MAP_OPERATION Operation,
+                      UINT64                      Value)
+{
+    PSCRIPT_ENGINE_MAP_ENTRY Entry;
+    UINT32                   Generation = (UINT32)Maps->Generations[MapId];
+
+    if (Operation == SCRIPT_ENGINE_MAP_OPERATION_HISTOGRAM)
+    {
+        Key = ScriptEngineMapGetHistogramBucket(Value);
+    }
+
+    Entry = ScriptEngineMapFindEntry(Maps, Table, MapId, Generation, Key);
+
+    if (Entry == NULL)
+    {
+        if (Table->DroppedGeneration[MapId] != Generation)
+        {
+            Table->DroppedGeneration[MapId] = Generation;
+            Table->DroppedCount[MapId]      = 0;
+        }
+
+        Table->DroppedCount[MapId]++;
+
+        return FALSE;
+    }
+
+    Entry->Count++;
+
+    switch (Operation)
+    {
+    case SCRIPT_ENGINE_MAP_OPERATION_SUM:
+    case SCRIPT_ENGINE_MAP_OPERATION_HISTOGRAM:
+        Entry->Sum += Value;
+        Entry->Flags |= SCRIPT_ENGINE_MAP_ENTRY_HAS_SUM;
+        break;
+
+    case SCRIPT_ENGINE_MAP_OPERATION_MIN:
+        if (Value < Entry->Min)
+        {
+            Entry->Min = Value;
+        }
+        Entry->Flags |= SCRIPT_ENGINE_MAP_ENTRY_HAS_MIN;
+        break;
+
+    case SCRIPT_ENGINE_MAP_OPERATION_MAX:
+        if (Value > Entry->Max)
+        {
+            Entry->Max = Value;
+        }
+        Entry->Flags |= SCRIPT_ENGINE_MAP_ENTRY_HAS_MAX;
+        break;
+
+    default:
+        break;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Merge the entries of a map from all of the cores
+ * @details The merged entries are sorted by their keys and placed at the
+ * start of the merge table (the table after the tables of the cores), the
+ * caller should hold MergeLock
+ *
+ * @param Maps
+ * @param MapId
+ * @param DroppedCount Number of dropped updates of the map
+ * @return UINT32 Number of merged entries
+ */
+UINT32
+ScriptEngineMapMerge(PSCRIPT_ENGINE_MAPS Maps, UINT32 MapId, PUINT64 DroppedCount)
+{
+    PSCRIPT_ENGINE_MAP_TABLE MergeTable = &Maps->Tables[Maps->CoreCount];
+    PSCRIPT_ENGINE_MAP_ENTRY Source;
+    PSCRIPT_ENGINE_MAP_ENTRY Destination;
+    SCRIPT_ENGINE_MAP_ENTRY  Temp;
+    UINT32                   Generation = (UINT32)Maps->Generations[MapId];
+    UINT32                   Count      = 0;
+
+    memset(MergeTable, 0, sizeof(SCRIPT_ENGINE_MAP_TABLE));
+    *DroppedCount = 0;
+
+    for (UINT32 Core = 0; Core < Maps->CoreCount; Core++)
+    {
+        PSCRIPT_ENGINE_MAP_TABLE Table = &Maps->Tables[Core];
+
+        if (Table->DroppedGeneration[MapId] == Generation)
+        {
+            *DroppedCount += Table->DroppedCount[MapId];
+        }
+
+        for (UINT32 i = 0; i < SCRIPT_ENGINE_MAP_TABLE_CAPACITY; i++)
+        {
+            Source = &Table->Entries[i];
+
+            if (Source->Generation != Generation || Source->MapId != MapId)
+            {
+                continue;
+            }
+
+            //
+            // The merge table is only used by one map, so the cleared entries
+            // never exist there, and as it has the same capacity as the core
+            // tables it could only be full if keys are spread across the cores
+            //
+            Destination = ScriptEngineMapFindEntry(Maps, MergeTable, MapId, Generation, Source->Key);
+
+            if (Destination == NULL)
+            {
+                *DroppedCount += Source->Count;
+                continue;
+            }
+
+            Destination->Count += Source->Count;
+            Destination->Sum += Source->Sum;
+            Destination->Flags |= Source->Flags;
+
+            if (Source->Min < Destination->Min)
+            {
+                Destination->Min = Source->Min;
+            }
+
+            if (Source->Max > Destination->Max)
+            {
+                Destination->Max = Source->Max;
+            }
+        }
+    }
+
+    //
+    // Move the merged entries to the start of the table
+    //
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_MAP_TABLE_CAPACITY; i++)
+    {
+        if (MergeTable->Entries[i].Generation != 0)
+        {
+            MergeTable->Entries[Count++] = MergeTable->Entries[i];
+        }
+    }
+
+    //
+    // Sort the entries by their keys (shell sort, it's only done on demand)
+    //
+    for (UINT32 Gap = Count / 2; Gap > 0; Gap /= 2)
+    {
+        for (UINT32 i = Gap; i < Count; i++)
+        {
+            UINT32 j;
+
+            Temp = MergeTable->Entries[i];
+
+            for (j = i; j >= Gap && MergeTable->Entries[j - Gap].Key > Temp.Key; j -= Gap)
+            {
+                MergeTable->Entries[j] = MergeTable->Entries[j - Gap];
+            }
+
+            MergeTable->Entries[j] = Temp;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Format a merged entry of a map as a line of the results
+ * @details The values that are never recorded for the entry (e.g., min and
+ * max of map_count) are shown as "n/a"
+ *
+ * @param Entry
+ * @param IsHistogram
+ * @param Line A buffer with the size of SCRIPT_ENGINE_MAP_LINE_SIZE
+ * @return VOID
+ */
+VOID
+ScriptEngineMapFormatEntry(PSCRIPT_ENGINE_MAP_ENTRY Entry, BOOLEAN IsHistogram, CHAR * Line)
+{
+    CHAR Sum[20] = "n/a";
+    CHAR Min[20] = "n/a";
+    CHAR Max[20] = "n/a";
+
+    if (IsHistogram)
+    {
+        //
+        // Bucket n holds [2^(n-1), 2^n)
+        //
+        sprintf(Line,
+                "[%llx, %llx): %llx\n",
+                Entry->Key == 0 ? 0 : 1ull << (Entry->Key - 1),
+                Entry->Key == 0 ? 1 : (Entry->Key == 64 ? MAXULONG64 : 1ull << Entry->Key),
+                Entry->Count);
+        return;
+    }
+
+    if (Entry->Flags & SCRIPT_ENGINE_MAP_ENTRY_HAS_SUM)
+    {
+        sprintf(Sum, "%llx", Entry->Sum);
+    }
+
+    if (Entry->Flags & SCRIPT_ENGINE_MAP_ENTRY_HAS_MIN)
+    {
+        sprintf(Min, "%llx", Entry->Min);
+    }
+
+    if (Entry->Flags & SCRIPT_ENGINE_MAP_ENTRY_HAS_MAX)
+    {
+        sprintf(Max, "%llx", Entry->Max);
+    }
+
+    sprintf(Line,
+            "%llx: count: %llx, sum: %s, min: %s, max: %s\n",
+            Entry->Key,
+            Entry->Count,
+            Sum,
+            Min,
+            Max);
+}
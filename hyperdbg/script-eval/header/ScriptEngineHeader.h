@@ -11,6 +11,234 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//			   Pre-decoded Code                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Opcodes of the pre-decoded instruction stream
+ * @details Every operator that is not listed here is executed
+ * by the regular interpreter (SCRIPT_ENGINE_DECODED_OPCODE_SLOW)
+ *
+ */
+typedef enum _SCRIPT_ENGINE_DECODED_OPCODE
+{
+    SCRIPT_ENGINE_DECODED_OPCODE_SLOW = 0,
+    SCRIPT_ENGINE_DECODED_OPCODE_MOV,
+    SCRIPT_ENGINE_DECODED_OPCODE_ADD,
+    SCRIPT_ENGINE_DECODED_OPCODE_SUB,
+    SCRIPT_ENGINE_DECODED_OPCODE_MUL,
+    SCRIPT_ENGINE_DECODED_OPCODE_DIV,
+    SCRIPT_ENGINE_DECODED_OPCODE_MOD,
+    SCRIPT_ENGINE_DECODED_OPCODE_OR,
+    SCRIPT_ENGINE_DECODED_OPCODE_XOR,
+    SCRIPT_ENGINE_DECODED_OPCODE_AND,
+    SCRIPT_ENGINE_DECODED_OPCODE_ASR,
+    SCRIPT_ENGINE_DECODED_OPCODE_ASL,
+    SCRIPT_ENGINE_DECODED_OPCODE_GT,
+    SCRIPT_ENGINE_DECODED_OPCODE_LT,
+    SCRIPT_ENGINE_DECODED_OPCODE_EGT,
+    SCRIPT_ENGINE_DECODED_OPCODE_ELT,
+    SCRIPT_ENGINE_DECODED_OPCODE_EQUAL,
+    SCRIPT_ENGINE_DECODED_OPCODE_NEQ,
+    SCRIPT_ENGINE_DECODED_OPCODE_NOT,
+    SCRIPT_ENGINE_DECODED_OPCODE_NEG,
+    SCRIPT_ENGINE_DECODED_OPCODE_INC,
+    SCRIPT_ENGINE_DECODED_OPCODE_DEC,
+    SCRIPT_ENGINE_DECODED_OPCODE_JMP,
+    SCRIPT_ENGINE_DECODED_OPCODE_JZ,
+    SCRIPT_ENGINE_DECODED_OPCODE_JNZ,
+    SCRIPT_ENGINE_DECODED_OPCODE_PUSH,
+    SCRIPT_ENGINE_DECODED_OPCODE_POP,
+    SCRIPT_ENGINE_DECODED_OPCODE_CALL,
+    SCRIPT_ENGINE_DECODED_OPCODE_RET,
+
+    SCRIPT_ENGINE_DECODED_OPCODE_COUNT
+
+} SCRIPT_ENGINE_DECODED_OPCODE;
+
+/**
+ * @brief Resolved kinds of the operands
+ *
+ */
+typedef enum _SCRIPT_ENGINE_DECODED_OPERAND_KIND
+{
+    SCRIPT_ENGINE_DECODED_OPERAND_IMMEDIATE = 0,
+    SCRIPT_ENGINE_DECODED_OPERAND_GLOBAL,
+    SCRIPT_ENGINE_DECODED_OPERAND_TEMP,
+    SCRIPT_ENGINE_DECODED_OPERAND_FUNCTION_PARAMETER,
+    SCRIPT_ENGINE_DECODED_OPERAND_STACK_INDEX,
+    SCRIPT_ENGINE_DECODED_OPERAND_STACK_BASE_INDEX,
+    SCRIPT_ENGINE_DECODED_OPERAND_RETURN_VALUE,
+    SCRIPT_ENGINE_DECODED_OPERAND_SYMBOL, // registers and pseudo-registers (Value is the PSYMBOL)
+
+} SCRIPT_ENGINE_DECODED_OPERAND_KIND;
+
+/**
+ * @brief A single resolved operand
+ *
+ */
+typedef struct _SCRIPT_ENGINE_DECODED_OPERAND
+{
+    UINT64 Kind;
+    UINT64 Value;
+
+} SCRIPT_ENGINE_DECODED_OPERAND, *PSCRIPT_ENGINE_DECODED_OPERAND;
+
+/**
+ * @brief A single pre-decoded instruction
+ *
+ */
+typedef struct _SCRIPT_ENGINE_DECODED_INSTRUCTION
+{
+    UINT32                        Opcode;
+    UINT32                        Next; // symbol index of the next instruction
+    SCRIPT_ENGINE_DECODED_OPERAND Operands[3];
+
+} SCRIPT_ENGINE_DECODED_INSTRUCTION, *PSCRIPT_ENGINE_DECODED_INSTRUCTION;
+
+/**
+ * @brief The pre-decoded buffer (header of a single contiguous allocation)
+ * @details IndexMap maps each symbol index of the original SYMBOL_BUFFER to
+ * an instruction, index zero of the instructions is always the slow one
+ *
+ */
+typedef struct _SCRIPT_ENGINE_DECODED_BUFFER
+{
+    UINT32                             SymbolCount;
+    UINT32                             InstructionCount;
+    UINT32 *                           IndexMap;
+    PSCRIPT_ENGINE_DECODED_INSTRUCTION Instructions;
+
+} SCRIPT_ENGINE_DECODED_BUFFER, *PSCRIPT_ENGINE_DECODED_BUFFER;
+
+/**
+ * @brief Results of running a pre-decoded script
+ *
+ */
+typedef enum _SCRIPT_ENGINE_DECODED_EXECUTION_STATUS
+{
+    SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL = 0,
+    SCRIPT_ENGINE_DECODED_EXECUTION_ERROR,
+    SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW,
+    SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT,
+
+} SCRIPT_ENGINE_DECODED_EXECUTION_STATUS;
+
+//////////////////////////////////////////////////
+//			    Aggregation Maps                //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of aggregation maps (map ids) in the scripts
+ *
+ */
+#define SCRIPT_ENGINE_MAP_MAXIMUM_COUNT 16
+
+/**
+ * @brief Number of entries of the core specific tables of the aggregation maps
+ * @details Should be a power of two
+ *
+ */
+#define SCRIPT_ENGINE_MAP_TABLE_CAPACITY 2048
+
+/**
+ * @brief Maximum number of slots that are probed for finding a key, the
+ * update is dropped (and counted) if no slot is found
+ *
+ */
+#define SCRIPT_ENGINE_MAP_MAXIMUM_PROBE_COUNT 64
+
+/**
+ * @brief Maximum length of a line of the results of the aggregation maps
+ *
+ */
+#define SCRIPT_ENGINE_MAP_LINE_SIZE 160
+
+/**
+ * @brief Flags of the values that are recorded for an entry of the
+ * aggregation maps (e.g., entries of map_count have no sum, min and max)
+ *
+ */
+#define SCRIPT_ENGINE_MAP_ENTRY_HAS_SUM 0x1
+#define SCRIPT_ENGINE_MAP_ENTRY_HAS_MIN 0x2
+#define SCRIPT_ENGINE_MAP_ENTRY_HAS_MAX 0x4
+
+/**
+ * @brief Operations that update the aggregation maps
+ *
+ */
+typedef enum _SCRIPT_ENGINE_MAP_OPERATION
+{
+    SCRIPT_ENGINE_MAP_OPERATION_COUNT = 0,
+    SCRIPT_ENGINE_MAP_OPERATION_SUM,
+    SCRIPT_ENGINE_MAP_OPERATION_MIN,
+    SCRIPT_ENGINE_MAP_OPERATION_MAX,
+    SCRIPT_ENGINE_MAP_OPERATION_HISTOGRAM,
+
+} SCRIPT_ENGINE_MAP_OPERATION;
+
+/**
+ * @brief Kinds of the aggregation maps (based on their first update)
+ *
+ */
+typedef enum _SCRIPT_ENGINE_MAP_KIND
+{
+    SCRIPT_ENGINE_MAP_KIND_UNUSED = 0,
+    SCRIPT_ENGINE_MAP_KIND_KEYED,
+    SCRIPT_ENGINE_MAP_KIND_HISTOGRAM,
+
+} SCRIPT_ENGINE_MAP_KIND;
+
+/**
+ * @brief An entry of the aggregation maps
+ * @details Generation zero means the slot is empty, entries with an older
+ * generation than their map are cleared entries and their slots are reused
+ *
+ */
+typedef struct _SCRIPT_ENGINE_MAP_ENTRY
+{
+    UINT64          Key;
+    UINT64          Count;
+    UINT64          Sum;
+    UINT64          Min;
+    UINT64          Max;
+    UINT32          MapId;
+    UINT32          Flags;
+    volatile UINT32 Generation;
+
+} SCRIPT_ENGINE_MAP_ENTRY, *PSCRIPT_ENGINE_MAP_ENTRY;
+
+/**
+ * @brief Core specific table of the aggregation maps (open-addressing)
+ * @details Each table is only modified by its own core, so updates don't
+ * need any lock
+ *
+ */
+typedef struct _SCRIPT_ENGINE_MAP_TABLE
+{
+    UINT64                  DroppedCount[SCRIPT_ENGINE_MAP_MAXIMUM_COUNT];
+    UINT32                  DroppedGeneration[SCRIPT_ENGINE_MAP_MAXIMUM_COUNT];
+    SCRIPT_ENGINE_MAP_ENTRY Entries[SCRIPT_ENGINE_MAP_TABLE_CAPACITY];
+
+} SCRIPT_ENGINE_MAP_TABLE, *PSCRIPT_ENGINE_MAP_TABLE;
+
+/**
+ * @brief State of the aggregation maps
+ * @details Tables holds one table for each core followed by the table
+ * that is used for merging the results (protected by MergeLock)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_MAPS
+{
+    PSCRIPT_ENGINE_MAP_TABLE Tables;
+    UINT32                   CoreCount;
+    volatile LONG            Generations[SCRIPT_ENGINE_MAP_MAXIMUM_COUNT];
+    volatile LONG            Kinds[SCRIPT_ENGINE_MAP_MAXIMUM_COUNT];
+    volatile LONG            MergeLock;
+
+} SCRIPT_ENGINE_MAPS, *PSCRIPT_ENGINE_MAPS;
+
 //////////////////////////////////////////////////
 //			        Registers                   //
 //////////////////////////////////////////////////
@@ -47,3 +275,49 @@ ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName);
 
 VOID
 ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName);
+
+//////////////////////////////////////////////////
+//			   Pre-decoded Code                 //
+//////////////////////////////////////////////////
+
+UINT32
+ScriptEngineDecodeGetBufferSize(SYMBOL_BUFFER * CodeBuffer);
+
+BOOLEAN
+ScriptEngineDecode(SYMBOL_BUFFER * CodeBuffer, PVOID DecodedBuffer, UINT32 DecodedBufferSize);
+
+SCRIPT_ENGINE_DECODED_EXECUTION_STATUS
+ScriptEngineExecuteDecoded(PGUEST_REGS                      GuestRegs,
+                           ACTION_BUFFER *                  ActionDetail,
+                           PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters,
+                           SYMBOL_BUFFER *                  CodeBuffer,
+                           PSCRIPT_ENGINE_DECODED_BUFFER    DecodedBuffer,
+                           SYMBOL *                         ErrorOperator,
+                           UINT64 *                         ExecutedCount);
+
+//////////////////////////////////////////////////
+//			    Aggregation Maps                //
+//////////////////////////////////////////////////
+
+UINT64
+ScriptEngineMapsGetRequiredSize(UINT32 CoreCount);
+
+VOID
+ScriptEngineMapsInitialize(PSCRIPT_ENGINE_MAPS Maps, PVOID Buffer, UINT32 CoreCount);
+
+UINT64
+ScriptEngineMapGetHistogramBucket(UINT64 Value);
+
+BOOLEAN
+ScriptEngineMapUpdate(PSCRIPT_ENGINE_MAPS         Maps,
+                      PSCRIPT_ENGINE_MAP_TABLE    Table,
+                      UINT32                      MapId,
+                      UINT64                      Key,
+                      SCRIPT_ENGINE_MAP_OPERATION Operation,
+                      UINT64                      Value);
+
+UINT32
+ScriptEngineMapMerge(PSCRIPT_ENGINE_MAPS Maps, UINT32 MapId, PUINT64 DroppedCount);
+
+VOID
+ScriptEngineMapFormatEntry(PSCRIPT_ENGINE_MAP_ENTRY Entry, BOOLEAN IsHistogram, CHAR * Line);
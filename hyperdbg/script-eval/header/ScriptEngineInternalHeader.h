@@ -242,6 +242,15 @@ ScriptEngineFunctionPrintf(PGUEST_REGS                       GuestRegs,
                            PSYMBOL                           FirstArg,
                            BOOLEAN *                         HasError);
 
+BOOLEAN
+ScriptEngineFunctionPrintfRecord(PGUEST_REGS                       GuestRegs,
+                                 ACTION_BUFFER *                   ActionDetail,
+                                 SCRIPT_ENGINE_GENERAL_REGISTERS * ScriptGeneralRegisters,
+                                 char *                            Format,
+                                 UINT32                            FormatOffset,
+                                 UINT64                            ArgCount,
+                                 PSYMBOL                           FirstArg);
+
 VOID
 ScriptEngineFunctionEventInject(UINT32 InterruptionType, UINT32 Vector, BOOL * HasError);
 
@@ -268,3 +277,12 @@ ScriptEngineFunctionWcsncmp(const wchar_t * Address1, const wchar_t * Address2,
 
 UINT64
 ScriptEngineFunctionMemcmp(const char * Address1, const char * Address2, size_t Count);
+
+VOID
+ScriptEngineFunctionMapUpdate(UINT64 MapId, UINT64 Key, SCRIPT_ENGINE_MAP_OPERATION Operation, UINT64 Value, BOOL * HasError);
+
+VOID
+ScriptEngineFunctionMapPrint(UINT64 Tag, BOOLEAN ImmediateMessagePassing, UINT64 MapId, BOOL * HasError);
+
+VOID
+ScriptEngineFunctionMapClear(UINT64 MapId, BOOL * HasError);
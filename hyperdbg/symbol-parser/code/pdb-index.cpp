@@ -0,0 +1,346 @@
+/**
+ * @file pdb-index.cpp
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Loading the (cached) index of the symbols of PDB files
+ * @details The PDB file is mapped and its symbols are indexed by the native
+ * PDB reader, the index is saved next to the PDB file, so the next time the
+ * same PDB file is loaded, the index file is only mapped and validated
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Map a file (read-only)
+ *
+ * @param FilePath
+ * @param FileSize
+ *
+ * @return const VOID * NULL if the file is not mapped
+ */
+static const VOID *
+SymPdbIndexMapFile(const char * FilePath, UINT64 * FileSize)
+{
+    HANDLE        FileHandle;
+    HANDLE        MappingHandle;
+    LARGE_INTEGER Size;
+    const VOID *  View = NULL;
+
+    FileHandle = CreateFileA(FilePath,
+                             GENERIC_READ,
+                             FILE_SHARE_READ | FILE_SHARE_DELETE,
+                             NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    if (!GetFileSizeEx(FileHandle, &Size) || Size.QuadPart == 0)
+    {
+        CloseHandle(FileHandle);
+        return NULL;
+    }
+
+    MappingHandle = CreateFileMappingA(FileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (MappingHandle != NULL)
+    {
+        //
+        // The view remains valid after closing the handles
+        //
+        View = MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(MappingHandle);
+    }
+
+    CloseHandle(FileHandle);
+
+    *FileSize = (UINT64)Size.QuadPart;
+
+    return View;
+}
+
+/**
+ * @brief Save the index next to the PDB file
+ * @details It's not a problem if it's not saved (e.g., the directory of the
+ * PDB file is read-only), an incomplete index file is not valid and it's
+ * rebuilt the next time
+ *
+ * @param IndexPath
+ * @param Index
+ * @param IndexSize
+ *
+ * @return VOID
+ */
+static VOID
+SymPdbIndexSave(const char * IndexPath, const VOID * Index, UINT32 IndexSize)
+{
+    HANDLE FileHandle;
+    DWORD  WrittenBytes = 0;
+
+    FileHandle = CreateFileA(IndexPath,
+                             GENERIC_WRITE,
+                             0,
+                             NULL,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    if (!WriteFile(FileHandle, Index, IndexSize, &WrittenBytes, NULL) || WrittenBytes != IndexSize)
+    {
+        CloseHandle(FileHandle);
+        DeleteFileA(IndexPath);
+        return;
+    }
+
+    CloseHandle(FileHandle);
+}
+
+/**
+ * @brief Load the index of the symbols of a PDB file
+ * @details The cached index file is used if it's built from the same PDB
+ * file, otherwise the index is built and cached
+ *
+ * @param PdbFilePath
+ * @param IsMapped Whether the index is a mapped index file (or it's allocated)
+ *
+ * @return const VOID * NULL if the PDB file is not indexed
+ */
+const VOID *
+SymPdbIndexLoad(const char * PdbFilePath, PBOOLEAN IsMapped)
+{
+    PDB_INDEX_PDB_INFO PdbInfo;
+    const VOID *       Pdb;
+    const VOID *       Index;
+    VOID *             BuiltIndex = NULL;
+    UINT64             PdbSize    = 0;
+    UINT64             IndexSize  = 0;
+    UINT32             BuiltIndexSize;
+    std::string        IndexPath(PdbFilePath);
+
+    IndexPath += PDB_INDEX_FILE_EXTENSION;
+
+    Pdb = SymPdbIndexMapFile(PdbFilePath, &PdbSize);
+
+    if (Pdb == NULL)
+    {
+        return NULL;
+    }
+
+    if (!PdbIndexGetPdbInfo(Pdb, PdbSize, &PdbInfo))
+    {
+        UnmapViewOfFile(Pdb);
+        return NULL;
+    }
+
+    //
+    // Use the cached index (if it's built from this PDB file)
+    //
+    Index = SymPdbIndexMapFile(IndexPath.c_str(), &IndexSize);
+
+    if (Index != NULL)
+    {
+        if (PdbIndexValidate(Index, IndexSize, &PdbInfo))
+        {
+            UnmapViewOfFile(Pdb);
+
+            *IsMapped = TRUE;
+            return Index;
+        }
+
+        UnmapViewOfFile(Index);
+    }
+
+    //
+    // Build the index and cache it
+    //
+    if (PdbIndexGetRequiredSize(Pdb, PdbSize, &BuiltIndexSize))
+    {
+        BuiltIndex = malloc(BuiltIndexSize);
+
+        if (BuiltIndex != NULL && !PdbIndexBuild(Pdb, PdbSize, BuiltIndex, BuiltIndexSize))
+        {
+            free(BuiltIndex);
+            BuiltIndex = NULL;
+        }
+    }
+
+    UnmapViewOfFile(Pdb);
+
+    if (BuiltIndex == NULL)
+    {
+        return NULL;
+    }
+
+    SymPdbIndexSave(IndexPath.c_str(), BuiltIndex, BuiltIndexSize);
+
+    *IsMapped = FALSE;
+    return BuiltIndex;
+}
+
+/**
+ * @brief Load the indexes of the jobs of a worker
+ *
+ * @param Parameter The worker
+ *
+ * @return DWORD
+ */
+static DWORD WINAPI
+SymPdbIndexLoadWorker(LPVOID Parameter)
+{
+    PSYMBOL_PDB_INDEX_WORKER Worker = (PSYMBOL_PDB_INDEX_WORKER)Parameter;
+    PSYMBOL_PDB_INDEX_JOB    Job;
+
+    for (UINT32 i = 0; i < Worker->JobCount; i++)
+    {
+        if (Worker->Workers[Worker->Order[i]] != Worker->Worker)
+        {
+            continue;
+        }
+
+        Job              = &Worker->Jobs[Worker->Order[i]];
+        Job->SymbolIndex = SymPdbIndexLoad(Job->PdbFilePath, &Job->IsSymbolIndexMapped);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Load the indexes of the symbols of the PDB files in parallel
+ * @details The indexes are independent (each PDB file is mapped and indexed
+ * on its own), so the jobs are divided between the processors by the sizes
+ * of the PDB files, and the current thread is one of the workers
+ *
+ * @param Jobs
+ * @param JobCount
+ *
+ * @return VOID
+ */
+VOID
+SymPdbIndexLoadInParallel(PSYMBOL_PDB_INDEX_JOB Jobs, UINT32 JobCount)
+{
+    SYSTEM_INFO             SystemInfo;
+    SYMBOL_PDB_INDEX_WORKER Workers[MODULE_TABLE_MAXIMUM_WORKERS];
+    HANDLE                  Threads[MODULE_TABLE_MAXIMUM_WORKERS];
+    UINT32                  WorkerCount;
+    UINT32                  ThreadCount = 0;
+    std::vector<UINT64>     Costs(JobCount);
+    std::vector<UINT32>     Order(JobCount);
+    std::vector<UINT32>     JobWorkers(JobCount);
+
+    if (JobCount == 0)
+    {
+        return;
+    }
+
+    GetSystemInfo(&SystemInfo);
+
+    WorkerCount = SystemInfo.dwNumberOfProcessors;
+    WorkerCount = WorkerCount < JobCount ? WorkerCount : JobCount;
+    WorkerCount = WorkerCount < MODULE_TABLE_MAXIMUM_WORKERS ? WorkerCount : MODULE_TABLE_MAXIMUM_WORKERS;
+    WorkerCount = WorkerCount != 0 ? WorkerCount : 1;
+
+    for (UINT32 i = 0; i < JobCount; i++)
+    {
+        Costs[i] = Jobs[i].PdbFileSize;
+    }
+
+    ModuleTableSchedule(Costs.data(), JobCount, WorkerCount, Order.data(), JobWorkers.data());
+
+    for (UINT32 i = 0; i < WorkerCount; i++)
+    {
+        Workers[i].Jobs     = Jobs;
+        Workers[i].JobCount = JobCount;
+        Workers[i].Order    = Order.data();
+        Workers[i].Workers  = JobWorkers.data();
+        Workers[i].Worker   = i;
+    }
+
+    //
+    // The first worker is the current thread (and so are the workers that
+    // their threads are not created)
+    //
+    for (UINT32 i = 1; i < WorkerCount; i++)
+    {
+        Threads[ThreadCount] = CreateThread(NULL, 0, SymPdbIndexLoadWorker, &Workers[i], 0, NULL);
+
+        if (Threads[ThreadCount] == NULL)
+        {
+            SymPdbIndexLoadWorker(&Workers[i]);
+            continue;
+        }
+
+        ThreadCount++;
+    }
+
+    SymPdbIndexLoadWorker(&Workers[0]);
+
+    if (ThreadCount != 0)
+    {
+        WaitForMultipleObjects(ThreadCount, Threads, TRUE, INFINITE);
+    }
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        CloseHandle(Threads[i]);
+    }
+}
+
+/**
+ * @brief Unload the index of the symbols of a PDB file
+ *
+ * @param Index
+ * @param IsMapped
+ *
+ * @return VOID
+ */
+VOID
+SymPdbIndexUnload(const VOID * Index, BOOLEAN IsMapped)
+{
+    if (Index == NULL)
+    {
+        return;
+    }
+
+    if (IsMapped)
+    {
+        UnmapViewOfFile(Index);
+    }
+    else
+    {
+        free((VOID *)Index);
+    }
+}
+
+/**
+ * @brief Undecorate the names of the indexed symbols (like the names that
+ * are shown by DbgHelp)
+ * @details The public symbols have the decorated names (of the C++ functions)
+ *
+ * @param Name
+ * @param Buffer
+ * @param BufferSize
+ *
+ * @return const char * The undecorated name (or the name itself)
+ */
+const char *
+SymPdbIndexUndecorateName(const char * Name, char * Buffer, UINT32 BufferSize)
+{
+    if (Name[0] == '?' && UnDecorateSymbolName(Name, Buffer, BufferSize, UNDNAME_NAME_ONLY) != 0)
+    {
+        return Buffer;
+    }
+
+    return Name;
+}
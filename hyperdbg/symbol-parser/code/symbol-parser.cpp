@@ -389,6 +389,13 @@ SymInit()
     //
     Options |= SYMOPT_DEBUG;
     Options |= SYMOPT_CASE_INSENSITIVE;
+
+    //
+    // The names and the addresses of the symbols are from the indexes of
+    // the PDB files, so DbgHelp loads the PDB files once they're needed
+    // (e.g., for the types)
+    //
+    Options |= SYMOPT_DEFERRED_LOADS;
     SymSetOptions(Options);
 
     //
@@ -530,6 +537,42 @@ SymCheckNtoskrnlPrefix(const char * PdbFileName, std::string & CustomModuleName)
  */
 UINT32
 SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * CustomModuleName)
+{
+    const VOID * SymbolIndex;
+    BOOLEAN      IsSymbolIndexMapped = FALSE;
+
+    //
+    // Load (or build) the index of the symbols
+    //
+    SymbolIndex = SymPdbIndexLoad(PdbFileName, &IsSymbolIndexMapped);
+
+    return SymLoadFileSymbolWithIndex(BaseAddress, PdbFileName, CustomModuleName, SymbolIndex, IsSymbolIndexMapped, 0, 0);
+}
+
+/**
+ * @brief load symbol based on a file name and the (already loaded) index
+ * of its symbols
+ * @details The index belongs to the loaded module, so it's unloaded if the
+ * module is not loaded
+ *
+ * @param BaseAddress
+ * @param PdbFileName
+ * @param CustomModuleName
+ * @param SymbolIndex
+ * @param IsSymbolIndexMapped
+ * @param Identity Identity of the module in the symbol table
+ * @param Size Size of the image of the module in the symbol table
+ *
+ * @return UINT32
+ */
+UINT32
+SymLoadFileSymbolWithIndex(UINT64       BaseAddress,
+                           const char * PdbFileName,
+                           const char * CustomModuleName,
+                           const VOID * SymbolIndex,
+                           BOOLEAN      IsSymbolIndexMapped,
+                           UINT64       Identity,
+                           UINT64       Size)
 {
     DWORD                         FileSize                        = 0;
     int                           Index                           = 0;
@@ -555,6 +598,7 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     if (!SymGetFileParams(PdbFileName, FileSize))
     {
         ShowMessages("err, cannot obtain file parameters (internal error)\n");
+        SymPdbIndexUnload(SymbolIndex, IsSymbolIndexMapped);
         return -1;
     }
 
@@ -592,11 +636,15 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     {
         ShowMessages("err, allocating buffer for storing symbol details (%x)\n",
                      GetLastError());
+        SymPdbIndexUnload(SymbolIndex, IsSymbolIndexMapped);
         return -1;
     }
 
     RtlZeroMemory(ModuleDetails, sizeof(SYMBOL_LOADED_MODULE_DETAILS));
 
+    ModuleDetails->SymbolIndex         = SymbolIndex;
+    ModuleDetails->IsSymbolIndexMapped = IsSymbolIndexMapped;
+
     ModuleDetails->ModuleBase = SymLoadModule64(
         GetCurrentProcess(), // Process handle of the current process
         NULL,                // Handle to the module's image file (not needed)
@@ -613,6 +661,7 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
         ShowMessages("err, loading symbols failed (%x)\n",
                      GetLastError());
 
+        SymPdbIndexUnload(ModuleDetails->SymbolIndex, ModuleDetails->IsSymbolIndexMapped);
         free(ModuleDetails);
         return -1;
     }
@@ -637,6 +686,8 @@ SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * Cus
     // Make the details (to save)
     //
     ModuleDetails->BaseAddress = BaseAddress;
+    ModuleDetails->Identity    = Identity;
+    ModuleDetails->Size        = Size;
     strcpy((char *)ModuleDetails->ModuleName, ModuleName);
     strcpy((char *)ModuleDetails->PdbFilePath, PdbFileName);
 
@@ -690,6 +741,8 @@ SymUnloadModuleSymbol(char * ModuleName)
 
             OneModuleFound = TRUE;
 
+            SymFreeSearchIndex(item);
+            SymPdbIndexUnload(item->SymbolIndex, item->IsSymbolIndexMapped);
             free(item);
 
             break;
@@ -754,6 +807,8 @@ SymUnloadAllSymbols()
             //              GetLastError());
         }
 
+        SymFreeSearchIndex(item);
+        SymPdbIndexUnload(item->SymbolIndex, item->IsSymbolIndexMapped);
         free(item);
     }
 
@@ -803,14 +858,16 @@ SymUnloadAllSymbols()
 UINT64
 SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
 {
-    BOOLEAN      Found   = FALSE;
-    UINT64       Address = NULL;
-    UINT64       Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
-    PSYMBOL_INFO Symbol = (PSYMBOL_INFO)Buffer;
-    string       FinalModuleName;
-    string       TempName(FunctionOrVariableName);
-    string       ExtractedModuleName;
-    string       FunctionName;
+    BOOLEAN                       Found   = FALSE;
+    UINT64                        Address = NULL;
+    UINT64                        Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
+    PSYMBOL_INFO                  Symbol        = (PSYMBOL_INFO)Buffer;
+    PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails = NULL;
+    const PDB_INDEX_SYMBOL *      IndexedSymbol = NULL;
+    string                        FinalModuleName;
+    string                        TempName(FunctionOrVariableName);
+    string                        ExtractedModuleName;
+    string                        FunctionName;
 
     //
     // Not found by default
@@ -856,6 +913,7 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
             {
                 string ModuleName(item->ModuleName);
                 FinalModuleName = ModuleName + "!" + FunctionName;
+                ModuleDetails   = item;
                 break;
             }
 
@@ -869,6 +927,7 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
                 //
                 string ModuleName(item->ModuleName);
                 FinalModuleName = ModuleName + "!" + FunctionName;
+                ModuleDetails   = item;
                 break;
             }
         }
@@ -878,6 +937,8 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
         //
         // It doesn't contain a module name, so we'll use 'nt' by default
         //
+        FunctionName = TempName;
+
         for (auto item : g_LoadedModules)
         {
             //
@@ -890,6 +951,7 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
                 //
                 string ModuleName(item->ModuleName);
                 FinalModuleName = ModuleName + "!" + TempName;
+                ModuleDetails   = item;
                 break;
             }
         }
@@ -904,7 +966,22 @@ SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
         return NULL;
     }
 
-    if (SymFromName(GetCurrentProcess(), FinalModuleName.c_str(), Symbol))
+    //
+    // Find it in the index of the module (without loading the PDB file by
+    // DbgHelp), the undecorated names of the C++ symbols are not indexed,
+    // so they're still found by DbgHelp
+    //
+    if (ModuleDetails->SymbolIndex != NULL)
+    {
+        IndexedSymbol = PdbIndexFindByName(ModuleDetails->SymbolIndex, FunctionName.c_str());
+    }
+
+    if (IndexedSymbol != NULL)
+    {
+        Found   = TRUE;
+        Address = ModuleDetails->BaseAddress + IndexedSymbol->Rva;
+    }
+    else if (SymFromName(GetCurrentProcess(), FinalModuleName.c_str(), Symbol))
     {
         //
         // SymFromName returned success
@@ -1089,6 +1166,123 @@ SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
     return Result;
 }
 
+/**
+ * @brief Build the wildcard search index of the names of a module
+ * @details The names are from the index of the PDB file of the module, so
+ * the ids of the search index are the same as the indexes of the symbols
+ *
+ * @param ModuleDetails
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SymBuildSearchIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    UINT64 StorageSize = 0;
+    UINT32 SymbolCount;
+
+    if (ModuleDetails->SymbolSearchStorage != NULL)
+    {
+        return TRUE;
+    }
+
+    if (ModuleDetails->SymbolIndex == NULL)
+    {
+        return FALSE;
+    }
+
+    SymbolCount                      = PdbIndexGetSymbolCount(ModuleDetails->SymbolIndex);
+    ModuleDetails->SymbolSearchNames = (const CHAR **)malloc((SymbolCount + 1) * sizeof(CHAR *));
+
+    if (ModuleDetails->SymbolSearchNames == NULL)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < SymbolCount; i++)
+    {
+        ModuleDetails->SymbolSearchNames[i] = PdbIndexGetSymbolName(ModuleDetails->SymbolIndex,
+                                                                    PdbIndexGetSymbol(ModuleDetails->SymbolIndex, i));
+    }
+
+    if (SymbolSearchGetRequiredSize(ModuleDetails->SymbolSearchNames, SymbolCount, &StorageSize))
+    {
+        ModuleDetails->SymbolSearchStorage = malloc(StorageSize);
+    }
+
+    if (ModuleDetails->SymbolSearchStorage == NULL ||
+        !SymbolSearchInitialize(&ModuleDetails->SymbolSearchIndex,
+                                ModuleDetails->SymbolSearchStorage,
+                                StorageSize,
+                                ModuleDetails->SymbolSearchNames,
+                                SymbolCount))
+    {
+        SymFreeSearchIndex(ModuleDetails);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the wildcard search index of the names of a module
+ *
+ * @param ModuleDetails
+ *
+ * @return VOID
+ */
+VOID
+SymFreeSearchIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    free(ModuleDetails->SymbolSearchStorage);
+    free((VOID *)ModuleDetails->SymbolSearchNames);
+
+    ModuleDetails->SymbolSearchStorage = NULL;
+    ModuleDetails->SymbolSearchNames   = NULL;
+}
+
+/**
+ * @brief Show the symbols of a module that match a mask from its search
+ * index
+ *
+ * @param ModuleDetails
+ * @param Mask The mask without the module name
+ *
+ * @return VOID
+ */
+VOID
+SymSearchSymbolForMaskFromIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, const char * Mask)
+{
+    SYMBOL_SEARCH_ITERATOR   Iterator;
+    const PDB_INDEX_SYMBOL * IndexedSymbol;
+    UINT32                   Id;
+    UINT64                   Buffer[(sizeof(SYMBOL_INFO) + MAX_SYM_NAME * sizeof(CHAR) + sizeof(UINT64) - 1) / sizeof(UINT64)];
+    PSYMBOL_INFO             Symbol = (PSYMBOL_INFO)Buffer;
+    char                     UndecoratedName[MAX_SYM_NAME];
+
+    RtlZeroMemory(Symbol, sizeof(SYMBOL_INFO));
+
+    Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    Symbol->MaxNameLen   = MAX_SYM_NAME;
+
+    SymbolSearchBeginQuery(&ModuleDetails->SymbolSearchIndex, &Iterator, Mask);
+
+    while ((Id = SymbolSearchGetNext(&Iterator)) != SYMBOL_SEARCH_NO_NAME)
+    {
+        IndexedSymbol = PdbIndexGetSymbol(ModuleDetails->SymbolIndex, Id);
+
+        Symbol->Address = ModuleDetails->BaseAddress + IndexedSymbol->Rva;
+        Symbol->Size    = IndexedSymbol->Size;
+
+        strncpy(Symbol->Name,
+                SymPdbIndexUndecorateName(ModuleDetails->SymbolSearchNames[Id], UndecoratedName, sizeof(UndecoratedName)),
+                MAX_SYM_NAME - 1);
+        Symbol->Name[MAX_SYM_NAME - 1] = '\0';
+
+        SymShowSymbolDetails(*Symbol);
+    }
+}
+
 /**
  * @brief Gets the offset from the symbol
  *
@@ -1101,6 +1295,7 @@ SymSearchSymbolForMask(const char * SearchMask)
 {
     BOOL                          Ret        = FALSE;
     PSYMBOL_LOADED_MODULE_DETAILS SymbolInfo = NULL;
+    const char *                  Mask       = NULL;
 
     //
     // Get the module info
@@ -1118,6 +1313,19 @@ SymSearchSymbolForMask(const char * SearchMask)
         return -1;
     }
 
+    //
+    // Search the names from the search index of the module (if any), it's
+    // built once for each module
+    //
+    if (SymBuildSearchIndex(SymbolInfo))
+    {
+        Mask = strchr(SearchMask, '!');
+
+        SymSearchSymbolForMaskFromIndex(SymbolInfo, Mask != NULL ? Mask + 1 : SearchMask);
+
+        return 0;
+    }
+
     Ret = SymEnumSymbols(
         GetCurrentProcess(),           // Process handle of the current process
         SymbolInfo->ModuleBase,        // Base address of the module
@@ -1164,6 +1372,15 @@ SymCreateSymbolTableForDisassembler(void * CallbackFunction)
         //
         g_CurrentModuleName = (char *)item->ModuleName;
 
+        //
+        // Deliver the symbols from the index of the module (if any)
+        //
+        if (item->SymbolIndex != NULL)
+        {
+            SymDeliverDisassemblerSymbolMapFromIndex(item);
+            continue;
+        }
+
         //
         // Call the callback for the current module
         //
@@ -1188,6 +1405,40 @@ SymCreateSymbolTableForDisassembler(void * CallbackFunction)
     return Result;
 }
 
+/**
+ * @brief Deliver the symbols of the index of a module to the disassembler
+ *
+ * @param ModuleDetails
+ *
+ * @return VOID
+ */
+VOID
+SymDeliverDisassemblerSymbolMapFromIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails)
+{
+    const PDB_INDEX_SYMBOL * IndexedSymbol;
+    const char *             Name;
+    char                     UndecoratedName[MAX_SYM_NAME];
+    UINT32                   SymbolCount = PdbIndexGetSymbolCount(ModuleDetails->SymbolIndex);
+
+    if (g_SymbolMapForDisassembler == NULL)
+    {
+        return;
+    }
+
+    for (UINT32 i = 0; i < SymbolCount; i++)
+    {
+        IndexedSymbol = PdbIndexGetSymbol(ModuleDetails->SymbolIndex, i);
+        Name          = SymPdbIndexUndecorateName(PdbIndexGetSymbolName(ModuleDetails->SymbolIndex, IndexedSymbol),
+                                         UndecoratedName,
+                                         sizeof(UndecoratedName));
+
+        g_SymbolMapForDisassembler(ModuleDetails->BaseAddress + IndexedSymbol->Rva,
+                                   g_CurrentModuleName,
+                                   (char *)Name,
+                                   IndexedSymbol->Size);
+    }
+}
+
 /**
  * @brief add ` between 64 bit values and convert them to string
  *
@@ -1848,8 +2099,33 @@ SymConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath, char * P
     return FALSE;
 }
 
+/**
+ * @brief Get the identity of a module of the symbol table
+ * @details The module is the same (and its symbols are not loaded again) if
+ * its file, its pdb, and the GUID and the age of its pdb are the same
+ *
+ * @param ModuleDetail
+ *
+ * @return UINT64
+ */
+UINT64
+SymGetModuleIdentity(PMODULE_SYMBOL_DETAIL ModuleDetail)
+{
+    UINT64 Identity = MODULE_TABLE_IDENTITY_SEED;
+
+    Identity = ModuleTableHashString(Identity, ModuleDetail->FilePath);
+    Identity = ModuleTableHashString(Identity, ModuleDetail->ModuleSymbolPath);
+    Identity = ModuleTableHashString(Identity, ModuleDetail->ModuleSymbolGuidAndAge);
+
+    return Identity;
+}
+
 /**
  * @brief check if the pdb files of loaded symbols are available or not
+ * @details The modules that are already loaded (from the previous symbol
+ * table) are not loaded again, and the modules that are not in the table
+ * are unloaded. The indexes of the pdb files of the other modules are built
+ * in parallel, and then they're loaded one by one (DbgHelp is single-threaded)
  *
  * @param BufferToStoreDetails Pointer to a buffer to store the symbols details
  * this buffer will be allocated by this function and needs to be freed by caller
@@ -1867,10 +2143,22 @@ SymbolInitLoad(PVOID        BufferToStoreDetails,
                const char * SymbolPath,
                BOOLEAN      IsSilentLoad)
 {
-    string                Tmp, SymDir, CustomModuleNameStr;
-    const char *          CustomModuleName = NULL;
-    string                SymPath(SymbolPath);
-    PMODULE_SYMBOL_DETAIL BufferToStoreDetailsConverted = (PMODULE_SYMBOL_DETAIL)BufferToStoreDetails;
+    string                                Tmp, SymDir, CustomModuleNameStr;
+    const char *                          CustomModuleName = NULL;
+    string                                SymPath(SymbolPath);
+    PMODULE_SYMBOL_DETAIL                 BufferToStoreDetailsConverted = (PMODULE_SYMBOL_DETAIL)BufferToStoreDetails;
+    UINT32                                ModulesCount                  = StoredLength / sizeof(MODULE_SYMBOL_DETAIL);
+    UINT32                                LoadedModulesCount            = (UINT32)g_LoadedModules.size();
+    UINT64                                StorageSize                   = 0;
+    DWORD                                 PdbFileSize                   = 0;
+    vector<MODULE_TABLE_ENTRY>            LoadedModules(LoadedModulesCount);
+    vector<MODULE_TABLE_ENTRY>            Modules(ModulesCount);
+    vector<UINT32>                        LoadedToNew(LoadedModulesCount);
+    vector<UINT32>                        NewToLoaded(ModulesCount);
+    vector<PSYMBOL_LOADED_MODULE_DETAILS> KeptModules;
+    vector<string>                        PdbFilePaths;
+    vector<UINT32>                        JobModules;
+    vector<SYMBOL_PDB_INDEX_JOB>          Jobs;
 
     vector<string> SplitedSymPath = Split(SymPath, '*');
     if (SplitedSymPath.size() < 2)
@@ -1881,9 +2169,63 @@ SymbolInitLoad(PVOID        BufferToStoreDetails,
     Tmp = SymDir = SplitedSymPath[1];
 
     //
-    // Split each module and details
+    // Compare the modules of the table with the loaded modules
+    //
+    for (UINT32 i = 0; i < LoadedModulesCount; i++)
+    {
+        LoadedModules[i].BaseAddress = g_LoadedModules[i]->BaseAddress;
+        LoadedModules[i].Size        = g_LoadedModules[i]->Size;
+        LoadedModules[i].Identity    = g_LoadedModules[i]->Identity;
+    }
+
+    for (UINT32 i = 0; i < ModulesCount; i++)
+    {
+        Modules[i].BaseAddress = BufferToStoreDetailsConverted[i].BaseAddress;
+        Modules[i].Size        = BufferToStoreDetailsConverted[i].ModuleSize;
+        Modules[i].Identity    = SymGetModuleIdentity(&BufferToStoreDetailsConverted[i]);
+    }
+
+    ModuleTableGetRequiredSize(LoadedModulesCount, ModulesCount, &StorageSize);
+
+    vector<BYTE> Storage((size_t)StorageSize);
+
+    if (!ModuleTableCompare(LoadedModules.data(),
+                            LoadedModulesCount,
+                            Modules.data(),
+                            ModulesCount,
+                            Storage.data(),
+                            StorageSize,
+                            LoadedToNew.data(),
+                            NewToLoaded.data()))
+    {
+        std::fill(LoadedToNew.begin(), LoadedToNew.end(), MODULE_TABLE_NO_MODULE);
+        std::fill(NewToLoaded.begin(), NewToLoaded.end(), MODULE_TABLE_NO_MODULE);
+    }
+
+    //
+    // Unload the modules that are not in the table anymore
     //
-    for (size_t i = 0; i < StoredLength / sizeof(MODULE_SYMBOL_DETAIL); i++)
+    for (UINT32 i = 0; i < LoadedModulesCount; i++)
+    {
+        if (LoadedToNew[i] != MODULE_TABLE_NO_MODULE)
+        {
+            KeptModules.push_back(g_LoadedModules[i]);
+            continue;
+        }
+
+        SymUnloadModule64(GetCurrentProcess(), g_LoadedModules[i]->ModuleBase);
+
+        SymFreeSearchIndex(g_LoadedModules[i]);
+        SymPdbIndexUnload(g_LoadedModules[i]->SymbolIndex, g_LoadedModules[i]->IsSymbolIndexMapped);
+        free(g_LoadedModules[i]);
+    }
+
+    g_LoadedModules = KeptModules;
+
+    //
+    // Find the pdb files of the modules that are not loaded
+    //
+    for (UINT32 i = 0; i < ModulesCount; i++)
     {
         //
         // Check for abort
@@ -1905,6 +2247,15 @@ SymbolInitLoad(PVOID        BufferToStoreDetails,
             continue;
         }
 
+        //
+        // Check if the module is already loaded
+        //
+        if (NewToLoaded[i] != MODULE_TABLE_NO_MODULE)
+        {
+            BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
+            continue;
+        }
+
         //
         // Check if it's a local path (a path) or a microsoft symbol
         //
@@ -1913,64 +2264,7 @@ SymbolInitLoad(PVOID        BufferToStoreDetails,
             //
             // If this is a local driver, then load the pdb
             //
-            if (IsFileExists(BufferToStoreDetailsConverted[i].ModuleSymbolPath))
-            {
-                BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
-
-                //
-                // Load symbol locally
-                //
-                if (!IsSilentLoad)
-                {
-                    ShowMessages("loading symbol '%s'...", Tmp.c_str());
-                }
-
-                //
-                // Check if we need an alternative module name (in 32-bit modules)
-                //
-                CustomModuleName = NULL;
-
-                // ShowMessages("name: %s , is 32-bit? %s\n", BufferToStoreDetailsConverted[i].FilePath, BufferToStoreDetailsConverted[i].Is32Bit ? "true" : "false");
-
-                //
-                // Check for alternative module names
-                //
-                if (BufferToStoreDetailsConverted[i].Is32Bit &&
-                    SymCheckAndRemoveWow64Prefix(BufferToStoreDetailsConverted[i].FilePath,
-                                                 BufferToStoreDetailsConverted[i].ModuleSymbolPath,
-                                                 CustomModuleNameStr))
-                {
-                    //
-                    // The name of the module contains a prefix which should be removed
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-                else if (!BufferToStoreDetailsConverted[i].Is32Bit &&
-                         SymCheckNtoskrnlPrefix(BufferToStoreDetailsConverted[i].ModuleSymbolPath, CustomModuleNameStr))
-                {
-                    //
-                    // This is an nt module
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-
-                if (SymLoadFileSymbol(BufferToStoreDetailsConverted[i].BaseAddress,
-                                      BufferToStoreDetailsConverted[i].ModuleSymbolPath,
-                                      CustomModuleName) == 0)
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tloaded\n");
-                    }
-                }
-                else
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tnot loaded (already loaded?)\n");
-                    }
-                }
-            }
+            Tmp = BufferToStoreDetailsConverted[i].ModuleSymbolPath;
         }
         else
         {
@@ -1998,62 +2292,109 @@ SymbolInitLoad(PVOID        BufferToStoreDetails,
                                   SymPath,
                                   IsSilentLoad);
             }
+        }
 
-            //
-            // Check again to see if the symbol already download or not
-            //
-            if (IsFileExists(Tmp))
+        //
+        // Check again to see if the symbol already download or not
+        //
+        if (IsFileExists(Tmp))
+        {
+            BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
+
+            PdbFilePaths.push_back(Tmp);
+            JobModules.push_back(i);
+        }
+    }
+
+    //
+    // Load (or build) the indexes of the pdb files in parallel
+    //
+    Jobs.resize(PdbFilePaths.size());
+
+    for (size_t i = 0; i < Jobs.size(); i++)
+    {
+        Jobs[i].PdbFilePath         = PdbFilePaths[i].c_str();
+        Jobs[i].PdbFileSize         = SymGetFileSize(Jobs[i].PdbFilePath, PdbFileSize) ? PdbFileSize : 0;
+        Jobs[i].SymbolIndex         = NULL;
+        Jobs[i].IsSymbolIndexMapped = FALSE;
+    }
+
+    SymPdbIndexLoadInParallel(Jobs.data(), (UINT32)Jobs.size());
+
+    //
+    // Load the symbols
+    //
+    for (size_t j = 0; j < Jobs.size(); j++)
+    {
+        UINT32 i = JobModules[j];
+
+        //
+        // Check for abort
+        //
+        if (g_AbortLoadingExecution)
+        {
+            g_AbortLoadingExecution = FALSE;
+
+            for (; j < Jobs.size(); j++)
             {
-                BufferToStoreDetailsConverted[i].IsSymbolPDBAvaliable = TRUE;
+                SymPdbIndexUnload(Jobs[j].SymbolIndex, Jobs[j].IsSymbolIndexMapped);
+            }
 
-                if (!IsSilentLoad)
-                {
-                    ShowMessages("loading symbol '%s'...", Tmp.c_str());
-                }
+            return FALSE;
+        }
 
-                //
-                // Check if we need an alternative module name (in 32-bit modules)
-                //
-                CustomModuleName = NULL;
+        if (!IsSilentLoad)
+        {
+            ShowMessages("loading symbol '%s'...", Jobs[j].PdbFilePath);
+        }
 
-                // ShowMessages("name: %s , is 32-bit? %s\n", BufferToStoreDetailsConverted[i].FilePath, BufferToStoreDetailsConverted[i].Is32Bit ? "true" : "false");
+        //
+        // Check if we need an alternative module name (in 32-bit modules)
+        //
+        CustomModuleName = NULL;
 
-                //
-                // Check for alternative module names
-                //
-                if (BufferToStoreDetailsConverted[i].Is32Bit &&
-                    SymCheckAndRemoveWow64Prefix(BufferToStoreDetailsConverted[i].FilePath,
-                                                 Tmp.c_str(),
-                                                 CustomModuleNameStr))
-                {
-                    //
-                    // The name of the module contains a prefix which should be removed
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-                else if (!BufferToStoreDetailsConverted[i].Is32Bit &&
-                         SymCheckNtoskrnlPrefix(Tmp.c_str(), CustomModuleNameStr))
-                {
-                    //
-                    // This is an nt module
-                    //
-                    CustomModuleName = CustomModuleNameStr.c_str();
-                }
-
-                if (SymLoadFileSymbol(BufferToStoreDetailsConverted[i].BaseAddress, Tmp.c_str(), CustomModuleName) == 0)
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tloaded\n");
-                    }
-                }
-                else
-                {
-                    if (!IsSilentLoad)
-                    {
-                        ShowMessages("\tnot loaded (already loaded?)\n");
-                    }
-                }
+        // ShowMessages("name: %s , is 32-bit? %s\n", BufferToStoreDetailsConverted[i].FilePath, BufferToStoreDetailsConverted[i].Is32Bit ? "true" : "false");
+
+        //
+        // Check for alternative module names
+        //
+        if (BufferToStoreDetailsConverted[i].Is32Bit &&
+            SymCheckAndRemoveWow64Prefix(BufferToStoreDetailsConverted[i].FilePath,
+                                         Jobs[j].PdbFilePath,
+                                         CustomModuleNameStr))
+        {
+            //
+            // The name of the module contains a prefix which should be removed
+            //
+            CustomModuleName = CustomModuleNameStr.c_str();
+        }
+        else if (!BufferToStoreDetailsConverted[i].Is32Bit &&
+                 SymCheckNtoskrnlPrefix(Jobs[j].PdbFilePath, CustomModuleNameStr))
+        {
+            //
+            // This is an nt module
+            //
+            CustomModuleName = CustomModuleNameStr.c_str();
+        }
+
+        if (SymLoadFileSymbolWithIndex(BufferToStoreDetailsConverted[i].BaseAddress,
+                                       Jobs[j].PdbFilePath,
+                                       CustomModuleName,
+                                       Jobs[j].SymbolIndex,
+                                       Jobs[j].IsSymbolIndexMapped,
+                                       Modules[i].Identity,
+                                       Modules[i].Size) == 0)
+        {
+            if (!IsSilentLoad)
+            {
+                ShowMessages("\tloaded\n");
+            }
+        }
+        else
+        {
+            if (!IsSilentLoad)
+            {
+                ShowMessages("\tnot loaded (already loaded?)\n");
             }
         }
     }
@@ -0,0 +1,59 @@
+/**
+ * @file pdb-index.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of loading the (cached) index of the symbols of PDB files
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Loading the index of a PDB file (by a worker)
+ *
+ */
+typedef struct _SYMBOL_PDB_INDEX_JOB
+{
+    const char * PdbFilePath;
+    UINT64       PdbFileSize; // The cost of the job
+    const VOID * SymbolIndex; // The result (NULL if the PDB file is not indexed)
+    BOOLEAN      IsSymbolIndexMapped;
+
+} SYMBOL_PDB_INDEX_JOB, *PSYMBOL_PDB_INDEX_JOB;
+
+/**
+ * @brief A worker of loading the indexes of the PDB files
+ *
+ */
+typedef struct _SYMBOL_PDB_INDEX_WORKER
+{
+    PSYMBOL_PDB_INDEX_JOB Jobs;
+    UINT32                JobCount;
+    const UINT32 *        Order;   // The jobs, the costly ones first
+    const UINT32 *        Workers; // The worker of each job
+    UINT32                Worker;
+
+} SYMBOL_PDB_INDEX_WORKER, *PSYMBOL_PDB_INDEX_WORKER;
+
+//////////////////////////////////////////////////
+//					Functions                   //
+//////////////////////////////////////////////////
+
+const VOID *
+SymPdbIndexLoad(const char * PdbFilePath, PBOOLEAN IsMapped);
+
+VOID
+SymPdbIndexLoadInParallel(PSYMBOL_PDB_INDEX_JOB Jobs, UINT32 JobCount);
+
+VOID
+SymPdbIndexUnload(const VOID * Index, BOOLEAN IsMapped);
+
+const char *
+SymPdbIndexUndecorateName(const char * Name, char * Buffer, UINT32 BufferSize);
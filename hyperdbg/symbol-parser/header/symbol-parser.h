@@ -27,11 +27,23 @@
  */
 typedef struct _SYMBOL_LOADED_MODULE_DETAILS
 {
-    UINT64 BaseAddress;
-    UINT64 ModuleBase;
-    char   ModuleName[_MAX_FNAME];
-    char   ModuleAlternativeName[_MAX_FNAME];
-    char   PdbFilePath[MAX_PATH];
+    UINT64       BaseAddress;
+    UINT64       ModuleBase;
+    char         ModuleName[_MAX_FNAME];
+    char         ModuleAlternativeName[_MAX_FNAME];
+    char         PdbFilePath[MAX_PATH];
+    const VOID * SymbolIndex; // Index of the symbols (NULL if the PDB file is not indexed)
+    BOOLEAN      IsSymbolIndexMapped;
+    UINT64       Identity; // Identity of the module in the symbol table (zero if it's not loaded from a table)
+    UINT64       Size;     // Size of the image of the module in the symbol table
+
+    //
+    // Wildcard search index of the names of the symbols (built by the first
+    // search of the module)
+    //
+    SYMBOL_SEARCH_INDEX SymbolSearchIndex;
+    PVOID               SymbolSearchStorage; // NULL if the search index is not built
+    const CHAR **       SymbolSearchNames;
 
 } SYMBOL_LOADED_MODULE_DETAILS, *PSYMBOL_LOADED_MODULE_DETAILS;
 
@@ -62,12 +74,36 @@ SymGetFileSize(const char * FileName, DWORD & FileSize);
 VOID
 SymShowSymbolInfo(UINT64 ModBase);
 
+UINT32
+SymLoadFileSymbolWithIndex(UINT64       BaseAddress,
+                           const char * PdbFileName,
+                           const char * CustomModuleName,
+                           const VOID * SymbolIndex,
+                           BOOLEAN      IsSymbolIndexMapped,
+                           UINT64       Identity,
+                           UINT64       Size);
+
+UINT64
+SymGetModuleIdentity(PMODULE_SYMBOL_DETAIL ModuleDetail);
+
 BOOL CALLBACK
 SymDisplayMaskSymbolsCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext);
 
 BOOL CALLBACK
 SymDeliverDisassemblerSymbolMapCallback(SYMBOL_INFO * SymInfo, ULONG SymbolSize, PVOID UserContext);
 
+VOID
+SymDeliverDisassemblerSymbolMapFromIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+BOOLEAN
+SymBuildSearchIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+VOID
+SymFreeSearchIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails);
+
+VOID
+SymSearchSymbolForMaskFromIndex(PSYMBOL_LOADED_MODULE_DETAILS ModuleDetails, const char * Mask);
+
 VOID
 SymShowSymbolDetails(SYMBOL_INFO & SymInfo);
 
@@ -49,7 +49,11 @@ typedef RFLAGS * PRFLAGS;
 #include "SDK/HyperDbgSdk.h"
 #include "Definition.h"
 #include "SDK/imports/user/HyperDbgLibImports.h"
+#include "components/pdbindex/header/PdbIndex.h"
+#include "components/symbolsearch/header/SymbolSearch.h"
+#include "components/moduletable/header/ModuleTable.h"
 #include "../symbol-parser/header/common-utils.h"
+#include "../symbol-parser/header/pdb-index.h"
 #include "../symbol-parser/header/symbol-parser.h"
 
 //
@@ -0,0 +1,913 @@
+/**
+ * @file chained-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and lookup benchmark of the chained index
+ * @details The details of the user debugger are mocked (the same layout as
+ * USERMODE_DEBUGGING_PROCESS_DETAILS and USERMODE_DEBUGGING_THREAD_HOLDER)
+ * and the threads and the processes that are found by the indexes are
+ * compared with walking the lists after random attachings, detachings and
+ * new threads (including the reused process and thread ids), then finding
+ * the threads of a process with up to 10000 threads is measured. Build and
+ * run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o chained-index-test chained-index-test.c \
+ *       ../../../include/components/chainedindex/code/ChainedIndex.c
+ *   ./chained-index-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum threads of each thread holder (the same as
+ * MAX_THREADS_IN_A_PROCESS_HOLDER)
+ *
+ */
+#define TEST_THREADS_IN_A_HOLDER 100
+
+/**
+ * @brief Number of the buckets of the index of the threads (the same as
+ * USER_DEBUGGING_THREAD_INDEX_BUCKETS)
+ *
+ */
+#define TEST_THREAD_INDEX_BUCKETS 4096
+
+/**
+ * @brief Number of the buckets of the indexes of the processes (the same as
+ * USER_DEBUGGING_PROCESS_INDEX_BUCKETS)
+ *
+ */
+#define TEST_PROCESS_INDEX_BUCKETS 64
+
+/**
+ * @brief Maximum number of the simulated processes
+ *
+ */
+#define TEST_MAXIMUM_PROCESSES 64
+
+/**
+ * @brief Number of random operations
+ *
+ */
+#define TEST_OPERATIONS 1000000
+
+/**
+ * @brief Number of lookups of each benchmark
+ *
+ */
+#define BENCHMARK_LOOKUPS 200000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief Get the structure of a list entry (the same as CONTAINING_RECORD)
+ *
+ */
+#define TEST_CONTAINING_RECORD(Address, Type, Field) ((Type *)((UINT8 *)(Address) - offsetof(Type, Field)))
+
+/**
+ * @brief A mocked LIST_ENTRY
+ *
+ */
+typedef struct _TEST_LIST_ENTRY
+{
+    struct _TEST_LIST_ENTRY * Flink;
+    struct _TEST_LIST_ENTRY * Blink;
+
+} TEST_LIST_ENTRY, *PTEST_LIST_ENTRY;
+
+/**
+ * @brief A simulated thread (similar to USERMODE_DEBUGGING_THREAD_DETAILS)
+ *
+ */
+typedef struct _TEST_THREAD_DETAILS
+{
+    UINT32                         ThreadId;
+    BOOLEAN                        IsPaused;
+    CHAINED_INDEX_ENTRY            ThreadIdIndexEntry;
+    struct _TEST_PROCESS_DETAILS * ProcessDebuggingDetail;
+
+} TEST_THREAD_DETAILS, *PTEST_THREAD_DETAILS;
+
+/**
+ * @brief A simulated thread holder (similar to USERMODE_DEBUGGING_THREAD_HOLDER)
+ *
+ */
+typedef struct _TEST_THREAD_HOLDER
+{
+    TEST_LIST_ENTRY     ThreadHolderList;
+    TEST_THREAD_DETAILS Threads[TEST_THREADS_IN_A_HOLDER];
+
+} TEST_THREAD_HOLDER, *PTEST_THREAD_HOLDER;
+
+/**
+ * @brief A simulated process (similar to USERMODE_DEBUGGING_PROCESS_DETAILS)
+ *
+ */
+typedef struct _TEST_PROCESS_DETAILS
+{
+    UINT64              Token;
+    BOOLEAN             Enabled;
+    BOOLEAN             IsAttached;
+    UINT32              ProcessId;
+    UINT32              ThreadCount;
+    TEST_LIST_ENTRY     AttachedProcessList;
+    TEST_LIST_ENTRY     ThreadsListHead;
+    CHAINED_INDEX_ENTRY ProcessIdIndexEntry;
+    CHAINED_INDEX_ENTRY TokenIndexEntry;
+
+} TEST_PROCESS_DETAILS, *PTEST_PROCESS_DETAILS;
+
+TEST_LIST_ENTRY g_TestProcesses;
+CHAINED_INDEX   g_TestThreadIndex;
+CHAINED_INDEX   g_TestProcessIdIndex;
+CHAINED_INDEX   g_TestTokenIndex;
+UINT64          g_TestSeedOfTokens;
+UINT64          g_RandomState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+
+    return g_RandomState;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Insert an entry to the head of a list (the same as InsertHeadList)
+ *
+ * @param Head
+ * @param Entry
+ *
+ * @return VOID
+ */
+static VOID
+TestInsertHeadList(PTEST_LIST_ENTRY Head, PTEST_LIST_ENTRY Entry)
+{
+    Entry->Flink       = Head->Flink;
+    Entry->Blink       = Head;
+    Head->Flink->Blink = Entry;
+    Head->Flink        = Entry;
+}
+
+/**
+ * @brief Initialize the list of the processes and the indexes
+ *
+ * @return VOID
+ */
+static VOID
+TestInitialize()
+{
+    free((PVOID)g_TestThreadIndex.Buckets);
+    free((PVOID)g_TestProcessIdIndex.Buckets);
+    free((PVOID)g_TestTokenIndex.Buckets);
+
+    g_TestProcesses.Flink = &g_TestProcesses;
+    g_TestProcesses.Blink = &g_TestProcesses;
+    g_TestSeedOfTokens    = 0x1000000;
+
+    TEST_CHECK(ChainedIndexInitialize(&g_TestThreadIndex,
+                                      malloc(ChainedIndexGetRequiredSize(TEST_THREAD_INDEX_BUCKETS)),
+                                      TEST_THREAD_INDEX_BUCKETS));
+    TEST_CHECK(ChainedIndexInitialize(&g_TestProcessIdIndex,
+                                      malloc(ChainedIndexGetRequiredSize(TEST_PROCESS_INDEX_BUCKETS)),
+                                      TEST_PROCESS_INDEX_BUCKETS));
+    TEST_CHECK(ChainedIndexInitialize(&g_TestTokenIndex,
+                                      malloc(ChainedIndexGetRequiredSize(TEST_PROCESS_INDEX_BUCKETS)),
+                                      TEST_PROCESS_INDEX_BUCKETS));
+}
+
+/**
+ * @brief Attach to a process (the same as AttachingCreateProcessDebuggingDetails)
+ *
+ * @param Process
+ * @param ProcessId
+ * @param Enabled
+ *
+ * @return VOID
+ */
+static VOID
+TestCreateProcessDebuggingDetails(PTEST_PROCESS_DETAILS Process, UINT32 ProcessId, BOOLEAN Enabled)
+{
+    memset(Process, 0, sizeof(TEST_PROCESS_DETAILS));
+
+    Process->Token      = g_TestSeedOfTokens++;
+    Process->ProcessId  = ProcessId;
+    Process->Enabled    = Enabled;
+    Process->IsAttached = TRUE;
+
+    Process->ThreadsListHead.Flink = &Process->ThreadsListHead;
+    Process->ThreadsListHead.Blink = &Process->ThreadsListHead;
+
+    TestInsertHeadList(&g_TestProcesses, &Process->AttachedProcessList);
+
+    ChainedIndexInsert(&g_TestProcessIdIndex, &Process->ProcessIdIndexEntry, Process->ProcessId);
+    ChainedIndexInsert(&g_TestTokenIndex, &Process->TokenIndexEntry, Process->Token);
+}
+
+/**
+ * @brief Detach from a process (the same as AttachingRemoveProcessDebuggingDetailsByToken)
+ *
+ * @param Process
+ *
+ * @return VOID
+ */
+static VOID
+TestRemoveProcessDebuggingDetails(PTEST_PROCESS_DETAILS Process)
+{
+    PTEST_LIST_ENTRY Entry = Process->ThreadsListHead.Flink;
+
+    while (Entry != &Process->ThreadsListHead)
+    {
+        PTEST_THREAD_HOLDER ThreadHolder = TEST_CONTAINING_RECORD(Entry, TEST_THREAD_HOLDER, ThreadHolderList);
+
+        Entry = Entry->Flink;
+
+        for (UINT32 i = 0; i < TEST_THREADS_IN_A_HOLDER; i++)
+        {
+            if (ThreadHolder->Threads[i].ThreadId != 0)
+            {
+                TEST_CHECK(ChainedIndexRemove(&g_TestThreadIndex, &ThreadHolder->Threads[i].ThreadIdIndexEntry));
+            }
+        }
+
+        free(ThreadHolder);
+    }
+
+    TEST_CHECK(ChainedIndexRemove(&g_TestProcessIdIndex, &Process->ProcessIdIndexEntry));
+    TEST_CHECK(ChainedIndexRemove(&g_TestTokenIndex, &Process->TokenIndexEntry));
+
+    //
+    // RemoveEntryList
+    //
+    Process->AttachedProcessList.Blink->Flink = Process->AttachedProcessList.Flink;
+    Process->AttachedProcessList.Flink->Blink = Process->AttachedProcessList.Blink;
+
+    Process->IsAttached = FALSE;
+}
+
+/**
+ * @brief Find a process by its id by walking the list (the same as
+ * AttachingFindProcessDebuggingDetailsByProcessId without the index)
+ *
+ * @param ProcessId
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestFindProcessByProcessIdFromList(UINT32 ProcessId)
+{
+    for (PTEST_LIST_ENTRY Entry = g_TestProcesses.Flink; Entry != &g_TestProcesses; Entry = Entry->Flink)
+    {
+        PTEST_PROCESS_DETAILS Process = TEST_CONTAINING_RECORD(Entry, TEST_PROCESS_DETAILS, AttachedProcessList);
+
+        if (Process->ProcessId == ProcessId && Process->Enabled)
+        {
+            return Process;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a process by its id (the same as AttachingFindProcessDebuggingDetailsByProcessId)
+ *
+ * @param ProcessId
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestFindProcessByProcessId(UINT32 ProcessId)
+{
+    PCHAINED_INDEX_ENTRY Entry = NULL;
+
+    while ((Entry = ChainedIndexFind(&g_TestProcessIdIndex, ProcessId, Entry)) != NULL)
+    {
+        PTEST_PROCESS_DETAILS Process = TEST_CONTAINING_RECORD(Entry, TEST_PROCESS_DETAILS, ProcessIdIndexEntry);
+
+        if (Process->Enabled)
+        {
+            return Process;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a process by its token by walking the list (the same as
+ * AttachingFindProcessDebuggingDetailsByToken without the index)
+ *
+ * @param Token
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestFindProcessByTokenFromList(UINT64 Token)
+{
+    for (PTEST_LIST_ENTRY Entry = g_TestProcesses.Flink; Entry != &g_TestProcesses; Entry = Entry->Flink)
+    {
+        PTEST_PROCESS_DETAILS Process = TEST_CONTAINING_RECORD(Entry, TEST_PROCESS_DETAILS, AttachedProcessList);
+
+        if (Process->Token == Token && Process->Enabled)
+        {
+            return Process;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a process by its token (the same as AttachingFindProcessDebuggingDetailsByToken)
+ *
+ * @param Token
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestFindProcessByToken(UINT64 Token)
+{
+    PCHAINED_INDEX_ENTRY Entry = NULL;
+
+    while ((Entry = ChainedIndexFind(&g_TestTokenIndex, Token, Entry)) != NULL)
+    {
+        PTEST_PROCESS_DETAILS Process = TEST_CONTAINING_RECORD(Entry, TEST_PROCESS_DETAILS, TokenIndexEntry);
+
+        if (Process->Enabled)
+        {
+            return Process;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a thread of a process by walking its thread holders
+ *
+ * @param Process
+ * @param ThreadId
+ *
+ * @return PTEST_THREAD_DETAILS
+ */
+static PTEST_THREAD_DETAILS
+TestFindThreadOfProcessFromList(PTEST_PROCESS_DETAILS Process, UINT32 ThreadId)
+{
+    for (PTEST_LIST_ENTRY Entry = Process->ThreadsListHead.Flink; Entry != &Process->ThreadsListHead; Entry = Entry->Flink)
+    {
+        PTEST_THREAD_HOLDER ThreadHolder = TEST_CONTAINING_RECORD(Entry, TEST_THREAD_HOLDER, ThreadHolderList);
+
+        for (UINT32 i = 0; i < TEST_THREADS_IN_A_HOLDER; i++)
+        {
+            if (ThreadHolder->Threads[i].ThreadId == ThreadId)
+            {
+                return &ThreadHolder->Threads[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a thread of a process (the index part of
+ * ThreadHolderGetProcessThreadDetailsByProcessIdAndThreadId)
+ *
+ * @param Process
+ * @param ThreadId
+ *
+ * @return PTEST_THREAD_DETAILS
+ */
+static PTEST_THREAD_DETAILS
+TestFindThreadOfProcess(PTEST_PROCESS_DETAILS Process, UINT32 ThreadId)
+{
+    PCHAINED_INDEX_ENTRY Entry = NULL;
+
+    while ((Entry = ChainedIndexFind(&g_TestThreadIndex, ThreadId, Entry)) != NULL)
+    {
+        PTEST_THREAD_DETAILS Thread = TEST_CONTAINING_RECORD(Entry, TEST_THREAD_DETAILS, ThreadIdIndexEntry);
+
+        if (Thread->ProcessDebuggingDetail == Process)
+        {
+            return Thread;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find a thread by the process id and the thread id by walking the
+ * lists (the same as ThreadHolderGetProcessThreadDetailsByProcessIdAndThreadId
+ * without the indexes)
+ *
+ * @param ProcessId
+ * @param ThreadId
+ *
+ * @return PTEST_THREAD_DETAILS
+ */
+static PTEST_THREAD_DETAILS
+TestGetThreadByProcessIdAndThreadIdFromList(UINT32 ProcessId, UINT32 ThreadId)
+{
+    PTEST_PROCESS_DETAILS Process = TestFindProcessByProcessIdFromList(ProcessId);
+
+    return Process == NULL ? NULL : TestFindThreadOfProcessFromList(Process, ThreadId);
+}
+
+/**
+ * @brief Find a thread by the process id and the thread id (the same as
+ * ThreadHolderGetProcessThreadDetailsByProcessIdAndThreadId)
+ *
+ * @param ProcessId
+ * @param ThreadId
+ *
+ * @return PTEST_THREAD_DETAILS
+ */
+static PTEST_THREAD_DETAILS
+TestGetThreadByProcessIdAndThreadId(UINT32 ProcessId, UINT32 ThreadId)
+{
+    PTEST_PROCESS_DETAILS Process = TestFindProcessByProcessId(ProcessId);
+
+    return Process == NULL ? NULL : TestFindThreadOfProcess(Process, ThreadId);
+}
+
+/**
+ * @brief Find the process of a thread by walking the lists (the same as
+ * ThreadHolderGetProcessDebuggingDetailsByThreadId without the index)
+ *
+ * @param ThreadId
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestGetProcessByThreadIdFromList(UINT32 ThreadId)
+{
+    for (PTEST_LIST_ENTRY Entry = g_TestProcesses.Flink; Entry != &g_TestProcesses; Entry = Entry->Flink)
+    {
+        PTEST_PROCESS_DETAILS Process = TEST_CONTAINING_RECORD(Entry, TEST_PROCESS_DETAILS, AttachedProcessList);
+
+        if (TestFindThreadOfProcessFromList(Process, ThreadId) != NULL)
+        {
+            return Process;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find the process of a thread (the same as
+ * ThreadHolderGetProcessDebuggingDetailsByThreadId)
+ *
+ * @param ThreadId
+ *
+ * @return PTEST_PROCESS_DETAILS
+ */
+static PTEST_PROCESS_DETAILS
+TestGetProcessByThreadId(UINT32 ThreadId)
+{
+    PCHAINED_INDEX_ENTRY Entry = ChainedIndexFind(&g_TestThreadIndex, ThreadId, NULL);
+
+    return Entry == NULL ? NULL : TEST_CONTAINING_RECORD(Entry, TEST_THREAD_DETAILS, ThreadIdIndexEntry)->ProcessDebuggingDetail;
+}
+
+/**
+ * @brief Find or create a thread of a process (the same as
+ * ThreadHolderFindOrCreateThreadDebuggingDetail)
+ *
+ * @param ThreadId Should not be zero
+ * @param Process
+ *
+ * @return PTEST_THREAD_DETAILS
+ */
+static PTEST_THREAD_DETAILS
+TestFindOrCreateThread(UINT32 ThreadId, PTEST_PROCESS_DETAILS Process)
+{
+    PTEST_THREAD_DETAILS Thread = TestFindThreadOfProcess(Process, ThreadId);
+    PTEST_THREAD_HOLDER  NewThreadHolder;
+
+    if (Thread != NULL)
+    {
+        return Thread;
+    }
+
+    //
+    // The first empty place of the thread holders
+    //
+    Thread = TestFindThreadOfProcessFromList(Process, 0);
+
+    if (Thread == NULL)
+    {
+        NewThreadHolder = calloc(1, sizeof(TEST_THREAD_HOLDER));
+
+        TEST_CHECK(NewThreadHolder != NULL);
+
+        TestInsertHeadList(&Process->ThreadsListHead, &NewThreadHolder->ThreadHolderList);
+
+        Thread = &NewThreadHolder->Threads[0];
+    }
+
+    Thread->ThreadId               = ThreadId;
+    Thread->ProcessDebuggingDetail = Process;
+
+    ChainedIndexInsert(&g_TestThreadIndex, &Thread->ThreadIdIndexEntry, ThreadId);
+
+    Process->ThreadCount++;
+
+    return Thread;
+}
+
+/**
+ * @brief Test the index itself (initialization, the duplicated keys, the
+ * removals and the clearing)
+ *
+ * @return VOID
+ */
+static VOID
+TestBasics()
+{
+    CHAINED_INDEX       Index;
+    CHAINED_INDEX_ENTRY Entries[8];
+    UINT64              Storage[4];
+
+    TEST_CHECK(!ChainedIndexInitialize(&Index, Storage, 3));
+    TEST_CHECK(!ChainedIndexInitialize(&Index, NULL, 4));
+    TEST_CHECK(!ChainedIndexInsert(&Index, &Entries[0], 1));
+    TEST_CHECK(ChainedIndexFind(&Index, 1, NULL) == NULL);
+    TEST_CHECK(!ChainedIndexRemove(&Index, &Entries[0]));
+
+    TEST_CHECK(ChainedIndexInitialize(&Index, Storage, 4));
+
+    //
+    // The entries of the same key are found from the last inserted one
+    //
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        TEST_CHECK(ChainedIndexInsert(&Index, &Entries[i], i % 2 == 0 ? 0x1234 : i * 4));
+    }
+
+    TEST_CHECK(Index.Count == 8);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, NULL) == &Entries[6]);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[6]) == &Entries[4]);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[4]) == &Entries[2]);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[2]) == &Entries[0]);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[0]) == NULL);
+    TEST_CHECK(ChainedIndexFind(&Index, 12, NULL) == &Entries[3]);
+    TEST_CHECK(ChainedIndexFind(&Index, 16, NULL) == NULL);
+
+    //
+    // A removed entry keeps its next entry (for the lookups that are on it)
+    //
+    TEST_CHECK(ChainedIndexRemove(&Index, &Entries[4]));
+    TEST_CHECK(!ChainedIndexRemove(&Index, &Entries[4]));
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[6]) == &Entries[2]);
+    TEST_CHECK(ChainedIndexFind(&Index, 0x1234, &Entries[4]) == &Entries[2]);
+    TEST_CHECK(Index.Count == 7);
+
+    ChainedIndexClear(&Index);
+
+    TEST_CHECK(Index.Count == 0);
+
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        TEST_CHECK(ChainedIndexFind(&Index, i % 2 == 0 ? 0x1234 : i * 4, NULL) == NULL);
+    }
+}
+
+/**
+ * @brief Compare the indexes with the lists after random operations
+ *
+ * @param ProcessIdRange Number of the different process ids
+ * @param ThreadIdRange Number of the different thread ids
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomOperations(UINT32 ProcessIdRange, UINT32 ThreadIdRange)
+{
+    PTEST_PROCESS_DETAILS Processes     = calloc(TEST_MAXIMUM_PROCESSES, sizeof(TEST_PROCESS_DETAILS));
+    UINT32                ThreadCount    = 0;
+    UINT32                MaximumThreads = 0;
+    UINT32                ReusedThreads  = 0;
+
+    TEST_CHECK(Processes != NULL);
+
+    TestInitialize();
+
+    for (UINT32 Operation = 0; Operation < TEST_OPERATIONS; Operation++)
+    {
+        UINT32                Random    = (UINT32)(TestRandom() % 1000);
+        PTEST_PROCESS_DETAILS Process   = &Processes[TestRandom() % TEST_MAXIMUM_PROCESSES];
+        UINT32                ProcessId = (UINT32)(TestRandom() % ProcessIdRange + 1) * 4;
+        UINT32                ThreadId  = (UINT32)(TestRandom() % ThreadIdRange + 1) * 4;
+        PTEST_PROCESS_DETAILS FoundProcess;
+        PTEST_THREAD_DETAILS  FoundThread;
+
+        if (Random < 10)
+        {
+            //
+            // Attach to a process (the process ids are reused and the
+            // process might be disabled)
+            //
+            if (!Process->IsAttached)
+            {
+                TestCreateProcessDebuggingDetails(Process, ProcessId, TestRandom() % 8 != 0);
+            }
+        }
+        else if (Random < 18)
+        {
+            //
+            // Detach from a process
+            //
+            if (Process->IsAttached)
+            {
+                ThreadCount -= Process->ThreadCount;
+
+                TestRemoveProcessDebuggingDetails(Process);
+            }
+        }
+        else if (Random < 20)
+        {
+            //
+            // Enable or disable a process
+            //
+            Process->Enabled = !Process->Enabled;
+        }
+        else if (Random < 21)
+        {
+            //
+            // Detach from all of the processes (the same as
+            // AttachingRemoveAndFreeAllProcessDebuggingDetails)
+            //
+            for (UINT32 i = 0; i < TEST_MAXIMUM_PROCESSES; i++)
+            {
+                if (Processes[i].IsAttached)
+                {
+                    TestRemoveProcessDebuggingDetails(&Processes[i]);
+                }
+            }
+
+            TEST_CHECK(g_TestThreadIndex.Count == 0 && g_TestProcessIdIndex.Count == 0 && g_TestTokenIndex.Count == 0);
+
+            ThreadCount = 0;
+        }
+        else if (Random < 400)
+        {
+            //
+            // A thread of an attached process is intercepted
+            //
+            if (Process->IsAttached)
+            {
+                if (TestFindThreadOfProcessFromList(Process, ThreadId) == NULL)
+                {
+                    ThreadCount++;
+
+                    if (TestGetProcessByThreadIdFromList(ThreadId) != NULL)
+                    {
+                        ReusedThreads++;
+                    }
+                }
+
+                FoundThread = TestFindOrCreateThread(ThreadId, Process);
+
+                TEST_CHECK(FoundThread == TestFindThreadOfProcessFromList(Process, ThreadId));
+                TEST_CHECK(FoundThread->ProcessDebuggingDetail == Process);
+            }
+        }
+        else
+        {
+            //
+            // Find a thread or a process
+            //
+            switch (Random % 4)
+            {
+            case 0:
+
+                TEST_CHECK(TestFindProcessByProcessId(ProcessId) == TestFindProcessByProcessIdFromList(ProcessId));
+                break;
+
+            case 1:
+
+                TEST_CHECK(TestFindProcessByToken(Process->Token) == TestFindProcessByTokenFromList(Process->Token));
+                break;
+
+            case 2:
+
+                TEST_CHECK(TestGetThreadByProcessIdAndThreadId(ProcessId, ThreadId) ==
+                           TestGetThreadByProcessIdAndThreadIdFromList(ProcessId, ThreadId));
+                break;
+
+            default:
+
+                //
+                // A reused thread id might be in multiple processes (the
+                // thread holders keep the exited threads), any of them is
+                // valid, but only if the list finds a process too
+                //
+                FoundProcess = TestGetProcessByThreadId(ThreadId);
+
+                if (FoundProcess == NULL)
+                {
+                    TEST_CHECK(TestGetProcessByThreadIdFromList(ThreadId) == NULL);
+                }
+                else
+                {
+                    TEST_CHECK(FoundProcess->IsAttached && TestFindThreadOfProcessFromList(FoundProcess, ThreadId) != NULL);
+                }
+
+                break;
+            }
+        }
+
+        TEST_CHECK(g_TestThreadIndex.Count == ThreadCount);
+
+        if (ThreadCount > MaximumThreads)
+        {
+            MaximumThreads = ThreadCount;
+        }
+    }
+
+    printf("[+] %u process ids, %u thread ids: up to %u threads, %u thread ids were reused by other processes\n",
+           ProcessIdRange,
+           ThreadIdRange,
+           MaximumThreads,
+           ReusedThreads);
+
+    for (UINT32 i = 0; i < TEST_MAXIMUM_PROCESSES; i++)
+    {
+        if (Processes[i].IsAttached)
+        {
+            TestRemoveProcessDebuggingDetails(&Processes[i]);
+        }
+    }
+
+    free(Processes);
+}
+
+/**
+ * @brief Compare finding the threads with and without the indexes
+ *
+ * @param ThreadCount Number of the threads of the debugged process
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(UINT32 ThreadCount)
+{
+    PTEST_PROCESS_DETAILS Processes = calloc(8, sizeof(TEST_PROCESS_DETAILS));
+    UINT32 *              ThreadIds = malloc(BENCHMARK_LOOKUPS * sizeof(UINT32));
+    UINT64                StartTime;
+    UINT64                ListTime;
+    UINT64                IndexTime;
+    UINT64                ProcessListTime;
+    UINT64                ProcessIndexTime;
+    UINT32                Found = 0;
+
+    TEST_CHECK(Processes != NULL && ThreadIds != NULL);
+
+    TestInitialize();
+
+    //
+    // Seven other processes with a few threads, and the debugged process
+    // (attached first, so it's the last one of the list)
+    //
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        TestCreateProcessDebuggingDetails(&Processes[i], 0x1000 + i * 4, TRUE);
+
+        for (UINT32 j = 0; j < (i == 0 ? ThreadCount : 10); j++)
+        {
+            TestFindOrCreateThread(0x10000 * (i + 1) + j * 4, &Processes[i]);
+        }
+    }
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        ThreadIds[i] = 0x10000 + (UINT32)(TestRandom() % ThreadCount) * 4;
+    }
+
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Found += TestGetThreadByProcessIdAndThreadIdFromList(0x1000, ThreadIds[i])->ThreadId == ThreadIds[i];
+    }
+
+    ListTime  = TestGetTime() - StartTime;
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Found += TestGetThreadByProcessIdAndThreadId(0x1000, ThreadIds[i])->ThreadId == ThreadIds[i];
+    }
+
+    IndexTime = TestGetTime() - StartTime;
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Found += TestGetProcessByThreadIdFromList(ThreadIds[i]) == &Processes[0];
+    }
+
+    ProcessListTime = TestGetTime() - StartTime;
+    StartTime       = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Found += TestGetProcessByThreadId(ThreadIds[i]) == &Processes[0];
+    }
+
+    ProcessIndexTime = TestGetTime() - StartTime;
+
+    TEST_CHECK(Found == BENCHMARK_LOOKUPS * 4);
+
+    printf("%-8u %14.1f %14.1f %9.1fx %14.1f %14.1f %9.1fx\n",
+           ThreadCount,
+           (double)ListTime / BENCHMARK_LOOKUPS,
+           (double)IndexTime / BENCHMARK_LOOKUPS,
+           (double)ListTime / IndexTime,
+           (double)ProcessListTime / BENCHMARK_LOOKUPS,
+           (double)ProcessIndexTime / BENCHMARK_LOOKUPS,
+           (double)ProcessListTime / ProcessIndexTime);
+
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        TestRemoveProcessDebuggingDetails(&Processes[i]);
+    }
+
+    free(Processes);
+    free(ThreadIds);
+}
+
+/**
+ * @brief Main function of the chained index tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestBasics();
+
+    TestRandomOperations(16, 2000);
+    TestRandomOperations(4, 50);
+    TestRandomOperations(1000, 100000);
+
+    printf("[+] all of the chained index tests passed\n\n");
+
+    printf("%-8s %14s %14s %10s %14s %14s %10s\n",
+           "threads",
+           "pid+tid list",
+           "pid+tid index",
+           "speedup",
+           "tid list",
+           "tid index",
+           "speedup");
+
+    for (UINT32 ThreadCount = 100; ThreadCount <= 10000; ThreadCount *= 10)
+    {
+        BenchmarkRun(ThreadCount);
+    }
+
+    return 0;
+}
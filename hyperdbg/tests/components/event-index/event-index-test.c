@@ -0,0 +1,430 @@
+/**
+ * @file event-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and dispatch benchmark of the event index
+ * @details The events that are returned by the index are compared with
+ * walking the list of the events (the same checks as DebuggerTriggerEvents)
+ * after random insertions and removals, then the cost of triggering a
+ * syscall event is measured for up to 10000 '!syscall' events.
+ * Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o event-index-test \
+ *       event-index-test.c ../../../include/components/eventindex/code/EventIndex.c
+ *   ./event-index-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum number of the simulated events
+ *
+ */
+#define TEST_MAXIMUM_EVENTS 10000
+
+/**
+ * @brief Number of the simulated syscall numbers
+ *
+ */
+#define TEST_SYSCALL_COUNT 512
+
+/**
+ * @brief Number of the simulated cores
+ *
+ */
+#define TEST_CORE_COUNT 8
+
+/**
+ * @brief Number of the simulated processes
+ *
+ */
+#define TEST_PROCESS_COUNT 16
+
+/**
+ * @brief Number of random operations
+ *
+ */
+#define TEST_OPERATIONS 200000
+
+/**
+ * @brief Number of triggers of each benchmark
+ *
+ */
+#define BENCHMARK_TRIGGERS 200000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A simulated event (similar to DEBUGGER_EVENT)
+ *
+ */
+typedef struct _TEST_EVENT
+{
+    struct _TEST_EVENT * Next; // The list of the events (newest first)
+    BOOLEAN              IsRemoved;
+    BOOLEAN              IsKeyed;
+    UINT64               Key;
+    UINT32               CoreId;
+    UINT32               ProcessId;
+    EVENT_INDEX_NODE     IndexNode;
+
+} TEST_EVENT, *PTEST_EVENT;
+
+/**
+ * @brief A simulated trigger (a vm-exit)
+ *
+ */
+typedef struct _TEST_TRIGGER
+{
+    UINT64 Key;
+    UINT32 CoreId;
+    UINT32 ProcessId;
+
+} TEST_TRIGGER, *PTEST_TRIGGER;
+
+UINT64 g_RandomState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+
+    return g_RandomState;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Get the event of an index node
+ *
+ * @param Node
+ *
+ * @return PTEST_EVENT
+ */
+static PTEST_EVENT
+TestGetEvent(PEVENT_INDEX_NODE Node)
+{
+    return (PTEST_EVENT)((UINT8 *)Node - offsetof(TEST_EVENT, IndexNode));
+}
+
+/**
+ * @brief Create a random event (most of them are on a single syscall)
+ *
+ * @param Event
+ * @param PercentOfKeyed Percent of the events with a syscall number
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomEvent(PTEST_EVENT Event, UINT32 PercentOfKeyed)
+{
+    Event->IsRemoved = FALSE;
+    Event->IsKeyed   = TestRandom() % 100 < PercentOfKeyed;
+    Event->Key       = Event->IsKeyed ? TestRandom() % TEST_SYSCALL_COUNT : 0;
+    Event->CoreId    = TestRandom() % 10 == 0 ? (UINT32)(TestRandom() % TEST_CORE_COUNT) : EVENT_INDEX_ANY;
+    Event->ProcessId = TestRandom() % 10 == 0 ? (UINT32)(TestRandom() % TEST_PROCESS_COUNT) : EVENT_INDEX_ANY;
+
+    EventIndexInitializeNode(&Event->IndexNode);
+}
+
+/**
+ * @brief Create a random trigger
+ *
+ * @param Trigger
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomTrigger(PTEST_TRIGGER Trigger)
+{
+    Trigger->Key       = TestRandom() % TEST_SYSCALL_COUNT;
+    Trigger->CoreId    = (UINT32)(TestRandom() % TEST_CORE_COUNT);
+    Trigger->ProcessId = (UINT32)(TestRandom() % TEST_PROCESS_COUNT);
+}
+
+/**
+ * @brief Add an event to the index
+ *
+ * @param Index
+ * @param Event
+ *
+ * @return VOID
+ */
+static VOID
+TestIndexEvent(PEVENT_INDEX Index, PTEST_EVENT Event)
+{
+    EventIndexInsert(Index, &Event->IndexNode, Event->IsKeyed, Event->Key, Event->CoreId, Event->ProcessId);
+}
+
+/**
+ * @brief Check whether an event matches a trigger (the same checks as the
+ * list walk of DebuggerTriggerEvents)
+ *
+ * @param Event
+ * @param Trigger
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestIsMatched(PTEST_EVENT Event, PTEST_TRIGGER Trigger)
+{
+    if (Event->CoreId != EVENT_INDEX_ANY && Event->CoreId != Trigger->CoreId)
+    {
+        return FALSE;
+    }
+
+    if (Event->ProcessId != EVENT_INDEX_ANY && Event->ProcessId != Trigger->ProcessId)
+    {
+        return FALSE;
+    }
+
+    return !Event->IsKeyed || Event->Key == Trigger->Key;
+}
+
+/**
+ * @brief Check that the index returns the same events with the same order as
+ * the list
+ *
+ * @param Index
+ * @param Head Newest event of the list
+ * @param Trigger
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckTrigger(PEVENT_INDEX Index, PTEST_EVENT Head, PTEST_TRIGGER Trigger)
+{
+    EVENT_INDEX_ITERATOR Iterator;
+    PEVENT_INDEX_NODE    Node;
+
+    EventIndexBeginLookup(Index, &Iterator, Trigger->Key, Trigger->CoreId, Trigger->ProcessId);
+
+    for (PTEST_EVENT Event = Head; Event != NULL; Event = Event->Next)
+    {
+        if (Event->IsRemoved || !TestIsMatched(Event, Trigger))
+        {
+            continue;
+        }
+
+        Node = EventIndexGetNext(&Iterator);
+
+        TEST_CHECK(Node != NULL && TestGetEvent(Node) == Event);
+    }
+
+    TEST_CHECK(EventIndexGetNext(&Iterator) == NULL);
+}
+
+/**
+ * @brief Test the index after random insertions, re-insertions and removals
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomOperations()
+{
+    PTEST_EVENT  Events = calloc(TEST_MAXIMUM_EVENTS, sizeof(TEST_EVENT));
+    PTEST_EVENT  Head   = NULL;
+    UINT32       Count  = 0;
+    UINT32       Indexed;
+    EVENT_INDEX  Index;
+    TEST_TRIGGER Trigger;
+
+    TEST_CHECK(Events != NULL);
+
+    EventIndexInitialize(&Index);
+
+    for (UINT32 Operation = 0; Operation < TEST_OPERATIONS; Operation++)
+    {
+        UINT32      Random = (UINT32)(TestRandom() % 100);
+        PTEST_EVENT Event  = Count != 0 ? &Events[TestRandom() % Count] : NULL;
+
+        if (Random < 40 && Count < TEST_MAXIMUM_EVENTS)
+        {
+            //
+            // Register a new event (at the head of the list)
+            //
+            Event = &Events[Count++];
+
+            TestRandomEvent(Event, 80);
+
+            Event->Next = Head;
+            Head        = Event;
+
+            TestIndexEvent(&Index, Event);
+        }
+        else if (Random < 50 && Event != NULL && !Event->IsRemoved)
+        {
+            //
+            // Remove an event
+            //
+            Event->IsRemoved = TRUE;
+            EventIndexRemove(&Index, &Event->IndexNode);
+            EventIndexRemove(&Index, &Event->IndexNode);
+        }
+        else if (Random < 55 && Event != NULL && !Event->IsRemoved)
+        {
+            //
+            // Apply an event again (the order of the event shouldn't change)
+            //
+            TestIndexEvent(&Index, Event);
+        }
+        else
+        {
+            TestRandomTrigger(&Trigger);
+            TestCheckTrigger(&Index, Head, &Trigger);
+        }
+    }
+
+    Indexed = 0;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Indexed += Events[i].IsRemoved ? 0 : 1;
+    }
+
+    TEST_CHECK(Index.Count == Indexed);
+
+    free(Events);
+}
+
+/**
+ * @brief Compare triggering the events with and without the index
+ *
+ * @param EventCount Number of registered events
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(UINT32 EventCount)
+{
+    PTEST_EVENT          Events   = calloc(EventCount, sizeof(TEST_EVENT));
+    PTEST_TRIGGER        Triggers = malloc(BENCHMARK_TRIGGERS * sizeof(TEST_TRIGGER));
+    PTEST_EVENT          Head     = NULL;
+    EVENT_INDEX          Index;
+    EVENT_INDEX_ITERATOR Iterator;
+    PEVENT_INDEX_NODE    Node;
+    UINT64               StartTime;
+    UINT64               ListTime;
+    UINT64               IndexTime;
+    UINT64               ListMatches  = 0;
+    UINT64               IndexMatches = 0;
+
+    TEST_CHECK(Events != NULL && Triggers != NULL);
+
+    EventIndexInitialize(&Index);
+
+    //
+    // One of each 100 events is applied to all syscalls
+    //
+    for (UINT32 i = 0; i < EventCount; i++)
+    {
+        TestRandomEvent(&Events[i], 99);
+
+        Events[i].Next = Head;
+        Head           = &Events[i];
+
+        TestIndexEvent(&Index, &Events[i]);
+    }
+
+    for (UINT32 i = 0; i < BENCHMARK_TRIGGERS; i++)
+    {
+        TestRandomTrigger(&Triggers[i]);
+    }
+
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_TRIGGERS; i++)
+    {
+        for (PTEST_EVENT Event = Head; Event != NULL; Event = Event->Next)
+        {
+            if (TestIsMatched(Event, &Triggers[i]))
+            {
+                ListMatches += (UINT64)Event;
+            }
+        }
+    }
+
+    ListTime  = TestGetTime() - StartTime;
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_TRIGGERS; i++)
+    {
+        EventIndexBeginLookup(&Index, &Iterator, Triggers[i].Key, Triggers[i].CoreId, Triggers[i].ProcessId);
+
+        while ((Node = EventIndexGetNext(&Iterator)) != NULL)
+        {
+            IndexMatches += (UINT64)TestGetEvent(Node);
+        }
+    }
+
+    IndexTime = TestGetTime() - StartTime;
+
+    TEST_CHECK(ListMatches == IndexMatches);
+
+    printf("%-8u %14.1f %14.1f %9.1fx\n",
+           EventCount,
+           (double)ListTime / BENCHMARK_TRIGGERS,
+           (double)IndexTime / BENCHMARK_TRIGGERS,
+           (double)ListTime / IndexTime);
+
+    free(Events);
+    free(Triggers);
+}
+
+/**
+ * @brief Main function of the event index tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestRandomOperations();
+
+    printf("[+] all of the event index tests passed\n\n");
+
+    printf("%-8s %14s %14s %10s\n", "events", "list (ns)", "index (ns)", "speedup");
+
+    for (UINT32 EventCount = 10; EventCount <= TEST_MAXIMUM_EVENTS; EventCount *= 10)
+    {
+        BenchmarkRun(EventCount);
+    }
+
+    return 0;
+}
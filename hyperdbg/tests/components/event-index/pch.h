@@ -0,0 +1,26 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the event index tests (Linux)
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define __int64 long long
+
+#include "SDK/headers/BasicTypes.h"
+
+typedef void * PVOID;
+
+#include "components/eventindex/header/EventIndex.h"
@@ -0,0 +1,851 @@
+/**
+ * @file event-record-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests, benchmark, and converter of the event records
+ * @details The records are formatted and compared with the same messages that
+ * are formatted by the printf of the C library, then the records are walked in
+ * the buffers of the messages, and making the records is measured against
+ * formatting the messages. Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o event-record-test \
+ *       event-record-test.c ../../../include/components/eventrecord/code/EventRecord.c
+ *   ./event-record-test
+ *
+ * It also converts a file of the records (an output source of an event that
+ * sends the records) to text or CSV:
+ *
+ *   ./event-record-test <file> [text|csv]
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the random formats of the tests
+ *
+ */
+#define TEST_RANDOM_FORMATS 200000
+
+/**
+ * @brief Number of the events of the measurements
+ *
+ */
+#define TEST_MEASURE_EVENTS 2000000
+
+/**
+ * @brief Size of the buffer of the messages of the measurements (like the
+ * buffers of the messages of the debuggee)
+ *
+ */
+#define TEST_LOG_BUFFER_SIZE (1024 * 1024)
+
+/**
+ * @brief Maximum number of the formats of a converted file
+ *
+ */
+#define TEST_MAXIMUM_FORMATS 4096
+
+/**
+ * @brief Size of the texts of the tests
+ *
+ */
+#define TEST_TEXT_SIZE 4096
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief How the C library formats a specifier of the script engine
+ *
+ */
+typedef enum _TEST_VALUE_KIND
+{
+    TEST_VALUE_KIND_INT32,
+    TEST_VALUE_KIND_UINT32,
+    TEST_VALUE_KIND_INT16,
+    TEST_VALUE_KIND_UINT16,
+    TEST_VALUE_KIND_INT64,
+    TEST_VALUE_KIND_UINT64,
+    TEST_VALUE_KIND_CHAR,
+
+} TEST_VALUE_KIND;
+
+/**
+ * @brief A specifier of the script engine and its format in the C library
+ * (of Linux, where 'long' is 64-bit)
+ *
+ */
+typedef struct _TEST_SPECIFIER
+{
+    const CHAR *    Specifier;
+    const CHAR *    HostFormat;
+    TEST_VALUE_KIND Kind;
+
+} TEST_SPECIFIER;
+
+/**
+ * @brief A format of a converted file
+ *
+ */
+typedef struct _TEST_FORMAT
+{
+    UINT64       Tag;
+    UINT32       FormatOffset;
+    const CHAR * Format;
+
+} TEST_FORMAT;
+
+TEST_SPECIFIER g_Specifiers[] = {
+    {"%d", "%d", TEST_VALUE_KIND_INT32},
+    {"%i", "%i", TEST_VALUE_KIND_INT32},
+    {"%u", "%u", TEST_VALUE_KIND_UINT32},
+    {"%o", "%o", TEST_VALUE_KIND_UINT32},
+    {"%x", "%x", TEST_VALUE_KIND_UINT32},
+    {"%c", "%c", TEST_VALUE_KIND_CHAR},
+    {"%p", "%016llX", TEST_VALUE_KIND_UINT64},
+    {"%ld", "%d", TEST_VALUE_KIND_INT32},
+    {"%li", "%i", TEST_VALUE_KIND_INT32},
+    {"%lu", "%u", TEST_VALUE_KIND_UINT32},
+    {"%lo", "%o", TEST_VALUE_KIND_UINT32},
+    {"%lx", "%x", TEST_VALUE_KIND_UINT32},
+    {"%hd", "%hd", TEST_VALUE_KIND_INT16},
+    {"%hi", "%hi", TEST_VALUE_KIND_INT16},
+    {"%hu", "%hu", TEST_VALUE_KIND_UINT16},
+    {"%ho", "%ho", TEST_VALUE_KIND_UINT16},
+    {"%hx", "%hx", TEST_VALUE_KIND_UINT16},
+    {"%lld", "%lld", TEST_VALUE_KIND_INT64},
+    {"%lli", "%lli", TEST_VALUE_KIND_INT64},
+    {"%llu", "%llu", TEST_VALUE_KIND_UINT64},
+    {"%llo", "%llo", TEST_VALUE_KIND_UINT64},
+    {"%llx", "%llx", TEST_VALUE_KIND_UINT64},
+};
+
+//
+// The texts between the specifiers (none of them makes a specifier with the
+// next part of the format)
+//
+const CHAR * g_Texts[] = {
+    "",
+    "value: ",
+    ", ",
+    "\n",
+    "%%-",
+    "%X!",
+    "%l-",
+    "%h=",
+    "\"quoted\"",
+    "100%!",
+    "rip",
+};
+
+//
+// Buffers of the tests (they're big, so they're not on the stack)
+//
+CHAR        g_LogBuffer[TEST_LOG_BUFFER_SIZE + TEST_TEXT_SIZE];
+CHAR        g_Text[TEST_TEXT_SIZE];
+CHAR        g_Expected[TEST_TEXT_SIZE];
+TEST_FORMAT g_Formats[TEST_MAXIMUM_FORMATS];
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get a pseudo-random 64-bit value (mostly the edge cases)
+ *
+ * @param Seed
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandomValue(UINT32 * Seed)
+{
+    UINT64 Value = ((UINT64)TestRandom(Seed) << 40) ^ ((UINT64)TestRandom(Seed) << 20) ^ TestRandom(Seed);
+
+    switch (TestRandom(Seed) % 6)
+    {
+    case 0:
+        return 0;
+    case 1:
+        return 0 - (UINT64)(TestRandom(Seed) % 70000);
+    case 2:
+        return TestRandom(Seed) % 70000;
+    case 3:
+        return 0x8000000000000000ull;
+    default:
+        return Value;
+    }
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Format a value with the C library (the same as the printf of the
+ * debuggee)
+ *
+ * @param Specifier
+ * @param Value
+ * @param Output
+ *
+ * @return UINT32 Length of the text
+ */
+static UINT32
+TestFormatValue(const TEST_SPECIFIER * Specifier, UINT64 Value, CHAR * Output)
+{
+    switch (Specifier->Kind)
+    {
+    case TEST_VALUE_KIND_INT32:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (int)Value);
+    case TEST_VALUE_KIND_UINT32:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (unsigned int)Value);
+    case TEST_VALUE_KIND_INT16:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (short)Value);
+    case TEST_VALUE_KIND_UINT16:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (unsigned short)Value);
+    case TEST_VALUE_KIND_INT64:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (long long)Value);
+    case TEST_VALUE_KIND_UINT64:
+        return (UINT32)sprintf(Output, Specifier->HostFormat, (unsigned long long)Value);
+    default:
+        //
+        // A null character ends the message of the printf
+        //
+        Output[0] = (CHAR)Value;
+        Output[1] = '\0';
+        return Output[0] == '\0' ? 0 : 1;
+    }
+}
+
+/**
+ * @brief Test the specifiers (the same as the ones of the script engine)
+ *
+ * @return VOID
+ */
+static VOID
+TestSpecifiers()
+{
+    BOOLEAN IsString;
+    UINT64  Values[2] = {0x1234, 0xfffffffffffffffeull};
+
+    for (UINT32 i = 0; i < sizeof(g_Specifiers) / sizeof(g_Specifiers[0]); i++)
+    {
+        TEST_CHECK(EventRecordGetSpecifierLength(g_Specifiers[i].Specifier, &IsString) == strlen(g_Specifiers[i].Specifier));
+        TEST_CHECK(!IsString);
+    }
+
+    TEST_CHECK(EventRecordGetSpecifierLength("%s", &IsString) == 2 && IsString);
+    TEST_CHECK(EventRecordGetSpecifierLength("%ws", &IsString) == 3 && IsString);
+    TEST_CHECK(EventRecordGetSpecifierLength("%ls", &IsString) == 3 && IsString);
+
+    TEST_CHECK(EventRecordGetSpecifierLength("%X", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("%l", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("%ll", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("%hc", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("%llc", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("%%d", &IsString) == 0);
+    TEST_CHECK(EventRecordGetSpecifierLength("d", &IsString) == 0);
+
+    //
+    // The second '%' of "%%d" is a specifier (like the script engine), and
+    // the specifiers without values are texts
+    //
+    TEST_CHECK(EventRecordFormat("%%d is %d, %x, %llx\n", Values, 2, g_Text, sizeof(g_Text)) == 22);
+    TEST_CHECK(strcmp(g_Text, "%4660 is -2, %x, %llx\n") == 0);
+
+    TEST_CHECK(EventRecordFormat("%p|%c%c", Values, 2, g_Text, sizeof(g_Text)) == 20);
+    TEST_CHECK(strcmp(g_Text, "0000000000001234|\xfe%c") == 0);
+
+    TEST_CHECK(EventRecordFormat("no values\n", NULL, 0, g_Text, sizeof(g_Text)) == 10);
+    TEST_CHECK(strcmp(g_Text, "no values\n") == 0);
+
+    //
+    // The output is truncated, but it's always null-terminated
+    //
+    TEST_CHECK(EventRecordFormat("value: %llx", &Values[1], 1, g_Text, 10) == 9);
+    TEST_CHECK(strcmp(g_Text, "value: ff") == 0);
+    TEST_CHECK(EventRecordFormat("value", NULL, 0, g_Text, 1) == 0 && g_Text[0] == '\0');
+}
+
+/**
+ * @brief Compare the formatted records with the C library (random formats)
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomFormats()
+{
+    CHAR   Format[TEST_TEXT_SIZE];
+    UINT64 Values[EVENT_RECORD_MAXIMUM_VALUES];
+    UINT32 Seed = 0x13572468;
+    UINT32 FormatLength;
+    UINT32 ExpectedLength;
+    UINT32 ValueCount;
+    UINT32 Index;
+
+    for (UINT32 Round = 0; Round < TEST_RANDOM_FORMATS; Round++)
+    {
+        ValueCount     = TestRandom(&Seed) % (EVENT_RECORD_MAXIMUM_VALUES + 1);
+        FormatLength   = 0;
+        ExpectedLength = 0;
+
+        for (UINT32 i = 0; i <= ValueCount; i++)
+        {
+            Index = TestRandom(&Seed) % (sizeof(g_Texts) / sizeof(g_Texts[0]));
+
+            FormatLength += (UINT32)sprintf(&Format[FormatLength], "%s", g_Texts[Index]);
+            ExpectedLength += (UINT32)sprintf(&g_Expected[ExpectedLength], "%s", g_Texts[Index]);
+
+            if (i == ValueCount)
+            {
+                break;
+            }
+
+            Index     = TestRandom(&Seed) % (sizeof(g_Specifiers) / sizeof(g_Specifiers[0]));
+            Values[i] = TestRandomValue(&Seed);
+
+            FormatLength += (UINT32)sprintf(&Format[FormatLength], "%s", g_Specifiers[Index].Specifier);
+            ExpectedLength += TestFormatValue(&g_Specifiers[Index], Values[i], &g_Expected[ExpectedLength]);
+        }
+
+        TEST_CHECK(EventRecordFormat(Format, Values, ValueCount, g_Text, sizeof(g_Text)) == ExpectedLength);
+        TEST_CHECK(memcmp(g_Text, g_Expected, ExpectedLength) == 0 && g_Text[ExpectedLength] == '\0');
+    }
+}
+
+/**
+ * @brief Test walking the records in a buffer of the messages (the records
+ * and the texts are mixed, like the non-immediate messages)
+ *
+ * @return VOID
+ */
+static VOID
+TestBuffers()
+{
+    EVENT_RECORD        Record;
+    PEVENT_RECORD_FORMAT FormatRecord;
+    UINT32               Length = 0;
+    UINT32               Offset = 0;
+    UINT32               Size;
+    UINT32               Texts   = 0;
+    UINT32               Records = 0;
+    UINT32               Formats = 0;
+
+    TEST_CHECK(EventRecordInitialize(&Record, 1, 0, 0, 0, 0, EVENT_RECORD_MAXIMUM_VALUES + 1) == 0);
+    TEST_CHECK(EventRecordInitialize(&Record, 0x1000003, 5, 123456789, 0xfffff80000001000ull, 0x40, 3) == EVENT_RECORD_HEADER_SIZE + 24);
+    TEST_CHECK(Record.Size % 8 == 0 && EVENT_RECORD_HEADER_SIZE == 40);
+
+    Record.Values[0] = 1;
+    Record.Values[1] = 2;
+    Record.Values[2] = 3;
+
+    TEST_CHECK(EventRecordBuildFormat(g_LogBuffer, 16, 0x1000003, 0x40, "a: %d") == 0);
+
+    Size = EventRecordBuildFormat(g_LogBuffer, sizeof(g_LogBuffer), 0x1000003, 0x40, "%d %d %d\n");
+
+    TEST_CHECK(Size == 40 && Size % 8 == 0);
+
+    Length += Size;
+
+    memcpy(&g_LogBuffer[Length], "first\n", 7);
+    Length += 7;
+
+    memcpy(&g_LogBuffer[Length], &Record, Record.Size);
+    Length += Record.Size;
+
+    memcpy(&g_LogBuffer[Length], "second\n", 8);
+    Length += 8;
+
+    memcpy(&g_LogBuffer[Length], &Record, Record.Size);
+    Length += Record.Size;
+
+    while (Offset < Length)
+    {
+        switch (EventRecordGetType(&g_LogBuffer[Offset], Length - Offset, &Size))
+        {
+        case EVENT_RECORD_TYPE_TEXT:
+
+            Texts++;
+            Offset += (UINT32)strlen(&g_LogBuffer[Offset]) + 1;
+            break;
+
+        case EVENT_RECORD_TYPE_VALUES:
+
+            TEST_CHECK(memcmp(&g_LogBuffer[Offset], &Record, Record.Size) == 0);
+
+            Records++;
+            Offset += Size;
+            break;
+
+        case EVENT_RECORD_TYPE_FORMAT:
+
+            FormatRecord = (PEVENT_RECORD_FORMAT)&g_LogBuffer[Offset];
+
+            TEST_CHECK(FormatRecord->Tag == 0x1000003 && FormatRecord->FormatOffset == 0x40);
+            TEST_CHECK(strcmp(&g_LogBuffer[Offset + EVENT_RECORD_FORMAT_HEADER_SIZE], "%d %d %d\n") == 0);
+
+            Formats++;
+            Offset += Size;
+            break;
+
+        default:
+
+            TEST_CHECK(FALSE);
+        }
+    }
+
+    TEST_CHECK(Offset == Length && Texts == 2 && Records == 2 && Formats == 1);
+
+    //
+    // Truncated and corrupted records
+    //
+    TEST_CHECK(EventRecordGetType(&Record, Record.Size - 1, &Size) == EVENT_RECORD_TYPE_INVALID);
+    TEST_CHECK(EventRecordGetType(&Record, 8, &Size) == EVENT_RECORD_TYPE_INVALID);
+    TEST_CHECK(EventRecordGetType(g_LogBuffer, 39, &Size) == EVENT_RECORD_TYPE_INVALID);
+    TEST_CHECK(EventRecordGetType("text", 5, &Size) == EVENT_RECORD_TYPE_TEXT && Size == 0);
+    TEST_CHECK(EventRecordGetType("ab", 3, &Size) == EVENT_RECORD_TYPE_TEXT);
+
+    Record.Size = (UINT16)(Record.Size + 8);
+    TEST_CHECK(EventRecordGetType(&Record, sizeof(Record), &Size) == EVENT_RECORD_TYPE_INVALID);
+
+    Record.Size       = (UINT16)EVENT_RECORD_SIZE(3);
+    Record.ValueCount = EVENT_RECORD_MAXIMUM_VALUES + 1;
+    TEST_CHECK(EventRecordGetType(&Record, sizeof(Record), &Size) == EVENT_RECORD_TYPE_INVALID);
+
+    g_LogBuffer[EVENT_RECORD_FORMAT_HEADER_SIZE + 9] = 'x';
+    TEST_CHECK(EventRecordGetType(g_LogBuffer, 40, &Size) == EVENT_RECORD_TYPE_INVALID);
+}
+
+/**
+ * @brief Test formatting the records as CSV
+ *
+ * @return VOID
+ */
+static VOID
+TestCsv()
+{
+    EVENT_RECORD Record;
+
+    EventRecordInitialize(&Record, 0x1000002, 3, 987654321, 0x7ff0, 0, 2);
+
+    Record.Values[0] = 0x22;
+    Record.Values[1] = 0xfffffffffffffff0ull;
+
+    TEST_CHECK(EventRecordFormatCsv(&Record, "say \"%c\", %lld\r\n", g_Text, sizeof(g_Text)) == 71);
+    TEST_CHECK(strcmp(g_Text, "0x1000002,3,987654321,0x7ff0,\"say \"\"\"\"\"\", -16\",0x22 0xfffffffffffffff0\n") == 0);
+
+    TEST_CHECK(EventRecordFormatCsv(&Record, NULL, g_Text, sizeof(g_Text)) == 56);
+    TEST_CHECK(strcmp(g_Text, "0x1000002,3,987654321,0x7ff0,\"\",0x22 0xfffffffffffffff0\n") == 0);
+
+    //
+    // It's truncated like the texts
+    //
+    TEST_CHECK(EventRecordFormatCsv(&Record, NULL, g_Text, 12) == 11);
+    TEST_CHECK(strcmp(g_Text, "0x1000002,3") == 0);
+}
+
+/**
+ * @brief Find a format of a converted file
+ *
+ * @param FormatCount
+ * @param Tag
+ * @param FormatOffset
+ *
+ * @return const CHAR * The format, or NULL if it's not found
+ */
+static const CHAR *
+TestFindFormat(UINT32 FormatCount, UINT64 Tag, UINT32 FormatOffset)
+{
+    for (UINT32 i = FormatCount; i > 0; i--)
+    {
+        if (g_Formats[i - 1].Tag == Tag && g_Formats[i - 1].FormatOffset == FormatOffset)
+        {
+            return g_Formats[i - 1].Format;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Convert the records of a buffer (the content of a file of an output
+ * source) to text or CSV
+ * @details The texts (of the other events) are written as they are, the
+ * records of the formats are not written
+ *
+ * @param Buffer
+ * @param Length
+ * @param IsCsv
+ * @param Output
+ *
+ * @return UINT32 Number of the records of the values
+ */
+static UINT32
+TestConvert(const CHAR * Buffer, UINT32 Length, BOOLEAN IsCsv, FILE * Output)
+{
+    const EVENT_RECORD *        Record;
+    const EVENT_RECORD_FORMAT * Format;
+    EVENT_RECORD                AlignedRecord;
+    const CHAR *                FormatString;
+    UINT32                      FormatCount = 0;
+    UINT32                      Records     = 0;
+    UINT32                      Offset      = 0;
+    UINT32                      TextLength;
+    UINT32                      Size;
+
+    while (Offset < Length)
+    {
+        switch (EventRecordGetType(&Buffer[Offset], Length - Offset, &Size))
+        {
+        case EVENT_RECORD_TYPE_FORMAT:
+
+            Format = (const EVENT_RECORD_FORMAT *)&Buffer[Offset];
+
+            if (FormatCount < TEST_MAXIMUM_FORMATS)
+            {
+                g_Formats[FormatCount].Tag          = Format->Tag;
+                g_Formats[FormatCount].FormatOffset = Format->FormatOffset;
+                g_Formats[FormatCount].Format       = &Buffer[Offset + EVENT_RECORD_FORMAT_HEADER_SIZE];
+
+                FormatCount++;
+            }
+
+            Offset += Size;
+            break;
+
+        case EVENT_RECORD_TYPE_VALUES:
+
+            //
+            // The records in a file are not aligned (the texts are between them)
+            //
+            memcpy(&AlignedRecord, &Buffer[Offset], Size);
+
+            Record       = &AlignedRecord;
+            FormatString = TestFindFormat(FormatCount, Record->Tag, Record->FormatOffset);
+
+            if (IsCsv)
+            {
+                EventRecordFormatCsv(Record, FormatString, g_Text, sizeof(g_Text));
+            }
+            else if (FormatString != NULL)
+            {
+                EventRecordFormat(FormatString, Record->Values, Record->ValueCount, g_Text, sizeof(g_Text));
+            }
+            else
+            {
+                sprintf(g_Text, "(a record of the event 0x%llx without its format)\n", (unsigned long long)Record->Tag);
+            }
+
+            fputs(g_Text, Output);
+
+            Records++;
+            Offset += Size;
+            break;
+
+        case EVENT_RECORD_TYPE_TEXT:
+
+            //
+            // A text (of an event without records) is until the next record
+            //
+            TextLength = 0;
+
+            while (Offset + TextLength < Length && Buffer[Offset + TextLength] != '\0' &&
+                   (TextLength == 0 || EventRecordGetType(&Buffer[Offset + TextLength], Length - Offset - TextLength, &Size) == EVENT_RECORD_TYPE_TEXT))
+            {
+                TextLength++;
+            }
+
+            if (!IsCsv)
+            {
+                fwrite(&Buffer[Offset], 1, TextLength, Output);
+            }
+
+            Offset += TextLength == 0 ? 1 : TextLength;
+            break;
+
+        default:
+
+            fprintf(stderr, "err, the record at 0x%x is invalid\n", Offset);
+            return Records;
+        }
+    }
+
+    return Records;
+}
+
+/**
+ * @brief Convert a file of the records
+ *
+ * @param Path
+ * @param IsCsv
+ *
+ * @return int
+ */
+static int
+TestConvertFile(const CHAR * Path, BOOLEAN IsCsv)
+{
+    FILE * File = fopen(Path, "rb");
+    CHAR * Buffer;
+    long   Length;
+
+    if (File == NULL || fseek(File, 0, SEEK_END) != 0 || (Length = ftell(File)) < 0 || fseek(File, 0, SEEK_SET) != 0)
+    {
+        fprintf(stderr, "err, unable to read %s\n", Path);
+        return 1;
+    }
+
+    Buffer = (CHAR *)malloc((size_t)Length + 1);
+
+    if (Buffer == NULL || fread(Buffer, 1, (size_t)Length, File) != (size_t)Length)
+    {
+        fprintf(stderr, "err, unable to read %s\n", Path);
+        return 1;
+    }
+
+    fclose(File);
+
+    if (IsCsv)
+    {
+        printf("tag,core,tsc,context,message,values\n");
+    }
+
+    TestConvert(Buffer, (UINT32)Length, IsCsv, stdout);
+
+    free(Buffer);
+
+    return 0;
+}
+
+/**
+ * @brief Test converting a file of an output source (the formats are written
+ * once, the texts of the other events are mixed with the records)
+ *
+ * @return VOID
+ */
+static VOID
+TestConvertBuffer()
+{
+    EVENT_RECORD Record;
+    CHAR *       Converted;
+    size_t       ConvertedSize;
+    FILE *       Output;
+    UINT32       Length = 0;
+
+    Length += EventRecordBuildFormat(&g_LogBuffer[Length], TEST_TEXT_SIZE, 0x1000001, 0x10, "rax: %llx, core: %d\n");
+
+    for (UINT32 i = 0; i < 3; i++)
+    {
+        EventRecordInitialize(&Record, 0x1000001, i, 100 + i, 0, 0x10, 2);
+
+        Record.Values[0] = 0xabc0 + i;
+        Record.Values[1] = i;
+
+        memcpy(&g_LogBuffer[Length], &Record, Record.Size);
+        Length += Record.Size;
+
+        //
+        // The texts are forwarded without their nulls
+        //
+        Length += (UINT32)sprintf(&g_LogBuffer[Length], "text %u\n", i);
+    }
+
+    //
+    // The format of this one is not known
+    //
+    EventRecordInitialize(&Record, 0x1000009, 0, 0, 0, 0x10, 0);
+    memcpy(&g_LogBuffer[Length], &Record, Record.Size);
+    Length += Record.Size;
+
+    Output = open_memstream(&Converted, &ConvertedSize);
+
+    TEST_CHECK(Output != NULL);
+    TEST_CHECK(TestConvert(g_LogBuffer, Length, FALSE, Output) == 4);
+
+    fclose(Output);
+
+    TEST_CHECK(strcmp(Converted,
+                      "rax: abc0, core: 0\ntext 0\n"
+                      "rax: abc1, core: 1\ntext 1\n"
+                      "rax: abc2, core: 2\ntext 2\n"
+                      "(a record of the event 0x1000009 without its format)\n") == 0);
+
+    free(Converted);
+
+    Output = open_memstream(&Converted, &ConvertedSize);
+
+    TEST_CHECK(Output != NULL);
+    TEST_CHECK(TestConvert(g_LogBuffer, Length, TRUE, Output) == 4);
+
+    fclose(Output);
+
+    TEST_CHECK(strcmp(Converted,
+                      "0x1000001,0,100,0x0,\"rax: abc0, core: 0\",0xabc0 0x0\n"
+                      "0x1000001,1,101,0x0,\"rax: abc1, core: 1\",0xabc1 0x1\n"
+                      "0x1000001,2,102,0x0,\"rax: abc2, core: 2\",0xabc2 0x2\n"
+                      "0x1000009,0,0,0x0,\"\",\n") == 0);
+
+    free(Converted);
+}
+
+/**
+ * @brief Measure sending the messages of the events as texts and as records
+ * @details The texts are formatted with a single snprintf (it's faster than
+ * the printf of the script, which formats each specifier separately), and the
+ * messages are copied to a buffer like the buffers of the messages of the
+ * debuggee
+ *
+ * @return VOID
+ */
+static VOID
+TestMeasure()
+{
+    EVENT_RECORD Record;
+    const CHAR * Format   = "core: %x, rip: %llx, rax: %llx, rcx: %llx\n";
+    UINT32       Position = 0;
+    UINT32       Length;
+    UINT64       TextBytes   = 0;
+    UINT64       RecordBytes = 0;
+    UINT64       Checksum    = 0;
+    UINT64       Start;
+    UINT64       TextTime;
+    UINT64       RecordTime;
+    UINT64       FormatTime;
+
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_MEASURE_EVENTS; i++)
+    {
+        Length = (UINT32)snprintf(g_Text,
+                                  sizeof(g_Text),
+                                  Format,
+                                  i % 16,
+                                  0xfffff80312340000ull + i * 16ull,
+                                  (unsigned long long)i * 0x9e3779b97f4a7c15ull,
+                                  (unsigned long long)i) +
+                 1;
+
+        if (Position + Length > TEST_LOG_BUFFER_SIZE)
+        {
+            Position = 0;
+        }
+
+        memcpy(&g_LogBuffer[Position], g_Text, Length);
+
+        Position += Length;
+        TextBytes += Length;
+    }
+
+    TextTime = TestGetTime() - Start;
+    Position = 0;
+    Start    = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_MEASURE_EVENTS; i++)
+    {
+        Length = EventRecordInitialize(&Record, 0x1000001, i % 16, Start + i, 0, 0x40, 4);
+
+        Record.Values[0] = i % 16;
+        Record.Values[1] = 0xfffff80312340000ull + i * 16ull;
+        Record.Values[2] = (UINT64)i * 0x9e3779b97f4a7c15ull;
+        Record.Values[3] = i;
+
+        if (Position + Length > TEST_LOG_BUFFER_SIZE)
+        {
+            Position = 0;
+        }
+
+        memcpy(&g_LogBuffer[Position], &Record, Length);
+
+        Position += Length;
+        RecordBytes += Length;
+    }
+
+    RecordTime = TestGetTime() - Start;
+
+    //
+    // Formatting the records (only once they're shown by the debugger)
+    //
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_MEASURE_EVENTS; i++)
+    {
+        Record.Values[0] = i % 16;
+        Record.Values[1] = 0xfffff80312340000ull + i * 16ull;
+        Record.Values[2] = (UINT64)i * 0x9e3779b97f4a7c15ull;
+        Record.Values[3] = i;
+
+        Checksum += EventRecordFormat(Format, Record.Values, 4, g_Text, sizeof(g_Text));
+    }
+
+    FormatTime = TestGetTime() - Start;
+
+    TEST_CHECK(Checksum == TextBytes - TEST_MEASURE_EVENTS);
+
+    printf("[*] sending %u messages as texts: %llu ms (%.1f M messages/s, %llu bytes each)\n",
+           TEST_MEASURE_EVENTS,
+           (unsigned long long)(TextTime / 1000000),
+           TEST_MEASURE_EVENTS * 1000.0 / (double)TextTime,
+           (unsigned long long)(TextBytes / TEST_MEASURE_EVENTS));
+    printf("[*] sending %u messages as records: %llu ms (%.1f M records/s, %llu bytes each, with tag, core, tsc, and context)\n",
+           TEST_MEASURE_EVENTS,
+           (unsigned long long)(RecordTime / 1000000),
+           TEST_MEASURE_EVENTS * 1000.0 / (double)RecordTime,
+           (unsigned long long)(RecordBytes / TEST_MEASURE_EVENTS));
+    printf("[*] formatting %u records in the debugger: %llu ms (%.1f M records/s)\n",
+           TEST_MEASURE_EVENTS,
+           (unsigned long long)(FormatTime / 1000000),
+           TEST_MEASURE_EVENTS * 1000.0 / (double)FormatTime);
+}
+
+int
+main(int argc, char ** argv)
+{
+    if (argc > 1)
+    {
+        return TestConvertFile(argv[1], argc > 2 && strcmp(argv[2], "csv") == 0);
+    }
+
+    TestSpecifiers();
+    TestRandomFormats();
+    TestBuffers();
+    TestCsv();
+    TestConvertBuffer();
+    TestMeasure();
+
+    printf("[+] all of the event record tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,882 @@
+/**
+ * @file forward-queue-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and pipeline tests of the queues of the output sources
+ * @details The queues are checked against a simple model of the messages,
+ * then the same pipeline as the event forwarding (a worker thread for each
+ * output source) forwards the messages to a file and to sockets (both of the
+ * policies, with a slow reader for dropping). Build and run it from this
+ * directory:
+ *
+ *   gcc -O2 -pthread -I. -I../../../include -o forward-queue-test \
+ *       forward-queue-test.c ../../../include/components/forwardqueue/code/ForwardQueue.c
+ *   ./forward-queue-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the messages that are forwarded in the pipeline tests
+ *
+ */
+#define TEST_PIPELINE_MESSAGES 200000
+
+/**
+ * @brief Size of the queue of each output source of the pipeline tests
+ *
+ */
+#define TEST_QUEUE_SIZE (1024 * 1024)
+
+/**
+ * @brief Size of the batches of the pipeline tests
+ *
+ */
+#define TEST_BATCH_SIZE (256 * 1024)
+
+/**
+ * @brief Maximum length of the messages of the tests
+ *
+ */
+#define TEST_MAXIMUM_MESSAGE_LENGTH 256
+
+/**
+ * @brief Maximum number of the messages of the model
+ *
+ */
+#define TEST_MODEL_MESSAGES 1024
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief An output source of the pipeline (like the event forwarding)
+ *
+ */
+typedef struct _TEST_SINK
+{
+    FORWARD_QUEUE   Queue;
+    pthread_mutex_t Lock;
+    pthread_cond_t  NotEmpty; // The worker waits for the messages
+    pthread_cond_t  NotFull;  // The blocked messages wait for the worker
+    pthread_t       Worker;
+    BOOLEAN         Stop;
+    int             Fd;
+    UINT64          Writes; // Number of the system calls of the worker
+    UINT8 *         Buffer;
+    UINT8 *         Batch;
+
+} TEST_SINK, *PTEST_SINK;
+
+/**
+ * @brief A socket of the pipeline and what is received from it
+ *
+ */
+typedef struct _TEST_RECEIVER
+{
+    int       Fd;
+    UINT32    Delay; // Microseconds to wait after each read (a slow reader)
+    UINT8 *   Buffer;
+    UINT64    Length;
+    UINT64    Size;
+    pthread_t Thread;
+
+} TEST_RECEIVER, *PTEST_RECEIVER;
+
+/**
+ * @brief The buffers of the tests (they're big, so they're not on the stack)
+ *
+ */
+UINT8  g_QueueBuffer[4096];
+UINT8  g_Batch[4096];
+UINT32 g_Lengths[TEST_MODEL_MESSAGES];
+UINT32 g_ModelLengths[TEST_MODEL_MESSAGES];
+UINT32 g_ModelNumbers[TEST_MODEL_MESSAGES];
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + (UINT64)Time.tv_nsec;
+}
+
+/**
+ * @brief Make a message (like the messages of the events) from its number
+ *
+ * @param Number
+ * @param Message
+ *
+ * @return UINT32 Length of the message
+ */
+static UINT32
+TestMakeMessage(UINT32 Number, CHAR * Message)
+{
+    UINT32 Length     = (UINT32)sprintf(Message, "event %08u:", Number);
+    UINT32 FillLength = (Number * 7) % 120;
+
+    for (UINT32 i = 0; i < FillLength; i++)
+    {
+        Message[Length++] = (CHAR)('a' + (Number + i) % 26);
+    }
+
+    Message[Length++] = '\n';
+
+    return Length;
+}
+
+/**
+ * @brief Make a message of the model (any length, even empty)
+ *
+ * @param Number
+ * @param Length
+ * @param Message
+ *
+ * @return VOID
+ */
+static VOID
+TestMakeModelMessage(UINT32 Number, UINT32 Length, UINT8 * Message)
+{
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Message[i] = (UINT8)(Number * 31 + i);
+    }
+}
+
+/**
+ * @brief Test the simple cases of the queue
+ *
+ * @return VOID
+ */
+static VOID
+TestBasics()
+{
+    FORWARD_QUEUE Queue;
+    UINT32        MessageCount;
+    UINT32        Length;
+
+    TEST_CHECK(!ForwardQueueInitialize(&Queue, g_QueueBuffer, FORWARD_QUEUE_MESSAGE_HEADER_SIZE, FORWARD_QUEUE_POLICY_BLOCK));
+    TEST_CHECK(!ForwardQueueInitialize(&Queue, NULL, 64, FORWARD_QUEUE_POLICY_BLOCK));
+
+    //
+    // Two messages in a batch, the lengths are kept
+    //
+    TEST_CHECK(ForwardQueueInitialize(&Queue, g_QueueBuffer, 64, FORWARD_QUEUE_POLICY_BLOCK));
+    TEST_CHECK(ForwardQueueIsEmpty(&Queue));
+    TEST_CHECK(ForwardQueuePush(&Queue, "hello ", 6) == FORWARD_QUEUE_STATUS_QUEUED);
+    TEST_CHECK(ForwardQueuePush(&Queue, "world", 5) == FORWARD_QUEUE_STATUS_QUEUED);
+    TEST_CHECK(!ForwardQueueIsEmpty(&Queue));
+
+    Length = ForwardQueueTakeBatch(&Queue, g_Batch, sizeof(g_Batch), g_Lengths, TEST_MODEL_MESSAGES, &MessageCount);
+
+    TEST_CHECK(Length == 11 && MessageCount == 2 && memcmp(g_Batch, "hello world", 11) == 0);
+    TEST_CHECK(g_Lengths[0] == 6 && g_Lengths[1] == 5);
+    TEST_CHECK(ForwardQueueIsEmpty(&Queue));
+
+    ForwardQueueCompleteBatch(&Queue, Length, MessageCount, TRUE);
+
+    TEST_CHECK(Queue.Statistics.WrittenMessages == 2 && Queue.Statistics.WrittenBytes == 11);
+    TEST_CHECK(Queue.Statistics.Batches == 1 && Queue.Statistics.MaximumUsedSize == 19);
+
+    //
+    // A full queue, blocking and dropping
+    //
+    TEST_CHECK(ForwardQueuePush(&Queue, g_QueueBuffer + 1024, 40) == FORWARD_QUEUE_STATUS_QUEUED);
+    TEST_CHECK(ForwardQueuePush(&Queue, g_QueueBuffer + 1024, 20) == FORWARD_QUEUE_STATUS_FULL);
+    TEST_CHECK(ForwardQueuePush(&Queue, g_QueueBuffer + 1024, 16) == FORWARD_QUEUE_STATUS_QUEUED);
+    TEST_CHECK(Queue.UsedSize == 64);
+    TEST_CHECK(ForwardQueuePush(&Queue, "", 0) == FORWARD_QUEUE_STATUS_FULL);
+
+    Queue.Policy = FORWARD_QUEUE_POLICY_DROP;
+
+    TEST_CHECK(ForwardQueuePush(&Queue, "x", 1) == FORWARD_QUEUE_STATUS_DROPPED);
+    TEST_CHECK(Queue.Statistics.DroppedMessages == 1 && Queue.Statistics.DroppedBytes == 1);
+
+    //
+    // A message that never fits is dropped even if the policy is to block
+    //
+    Queue.Policy = FORWARD_QUEUE_POLICY_BLOCK;
+
+    TEST_CHECK(ForwardQueuePush(&Queue, g_QueueBuffer + 1024, 61) == FORWARD_QUEUE_STATUS_DROPPED);
+    TEST_CHECK(ForwardQueuePush(&Queue, g_QueueBuffer + 1024, 0xffffffff) == FORWARD_QUEUE_STATUS_DROPPED);
+    TEST_CHECK(Queue.Statistics.DroppedMessages == 3);
+
+    //
+    // The batch is limited by the number of the lengths and its size
+    //
+    Length = ForwardQueueTakeBatch(&Queue, g_Batch, sizeof(g_Batch), g_Lengths, 1, &MessageCount);
+
+    TEST_CHECK(Length == 40 && MessageCount == 1 && Queue.MessageCount == 1);
+
+    ForwardQueueCompleteBatch(&Queue, Length, MessageCount, FALSE);
+
+    TEST_CHECK(Queue.Statistics.FailedMessages == 1 && Queue.Statistics.WrittenMessages == 2);
+
+    Length = ForwardQueueTakeBatch(&Queue, g_Batch, 15, NULL, 0, &MessageCount);
+
+    TEST_CHECK(Length == 0 && MessageCount == 0 && ForwardQueueIsEmpty(&Queue));
+    TEST_CHECK(Queue.Statistics.DroppedMessages == 4 && Queue.Statistics.DroppedBytes == 1 + 61 + 0xffffffffull + 16);
+
+    //
+    // An empty queue gives an empty batch
+    //
+    Length = ForwardQueueTakeBatch(&Queue, g_Batch, sizeof(g_Batch), NULL, 0, &MessageCount);
+
+    TEST_CHECK(Length == 0 && MessageCount == 0 && Queue.Statistics.Batches == 2);
+}
+
+/**
+ * @brief Test the queue against a model (the messages and their order)
+ *
+ * @return VOID
+ */
+static VOID
+TestModel()
+{
+    FORWARD_QUEUE Queue;
+    UINT8         Message[TEST_MAXIMUM_MESSAGE_LENGTH];
+    UINT32        Seed = 0x12345678;
+    UINT32        First;
+    UINT32        Count;
+    UINT32        Number;
+    UINT32        UsedSize;
+    UINT32        QueueSize;
+    UINT32        BatchSize;
+    UINT32        MaximumMessages;
+    UINT32        MessageCount;
+    UINT32        Length;
+    UINT32        Offset;
+    UINT64        Dropped;
+    UINT64        DroppedInBatches;
+    UINT64        Full;
+    UINT64        Queued;
+    UINT64        Taken;
+
+    for (UINT32 Round = 0; Round < 200; Round++)
+    {
+        QueueSize        = TestRandom(&Seed) % 2000 + 64;
+        First            = 0;
+        Count            = 0;
+        Number           = 0;
+        UsedSize         = 0;
+        Dropped          = 0;
+        DroppedInBatches = 0;
+        Full             = 0;
+        Queued           = 0;
+        Taken            = 0;
+
+        TEST_CHECK(ForwardQueueInitialize(&Queue,
+                                          g_QueueBuffer,
+                                          QueueSize,
+                                          (TestRandom(&Seed) & 1) ? FORWARD_QUEUE_POLICY_DROP : FORWARD_QUEUE_POLICY_BLOCK));
+
+        for (UINT32 Step = 0; Step < 2000; Step++)
+        {
+            if (TestRandom(&Seed) % 3 != 0)
+            {
+                //
+                // Add a message
+                //
+                Length = TestRandom(&Seed) % TEST_MAXIMUM_MESSAGE_LENGTH;
+
+                TestMakeModelMessage(Number, Length, Message);
+
+                switch (ForwardQueuePush(&Queue, Message, Length))
+                {
+                case FORWARD_QUEUE_STATUS_QUEUED:
+
+                    TEST_CHECK(Count < TEST_MODEL_MESSAGES && QueueSize - UsedSize >= Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+
+                    g_ModelLengths[(First + Count) % TEST_MODEL_MESSAGES] = Length;
+                    g_ModelNumbers[(First + Count) % TEST_MODEL_MESSAGES] = Number;
+
+                    Count++;
+                    UsedSize += Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE;
+                    Queued++;
+
+                    break;
+
+                case FORWARD_QUEUE_STATUS_FULL:
+
+                    TEST_CHECK(Queue.Policy == FORWARD_QUEUE_POLICY_BLOCK && QueueSize - UsedSize < Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+                    TEST_CHECK(Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE <= QueueSize);
+
+                    Full++;
+
+                    break;
+
+                case FORWARD_QUEUE_STATUS_DROPPED:
+
+                    TEST_CHECK(QueueSize - UsedSize < Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE);
+                    TEST_CHECK(Queue.Policy == FORWARD_QUEUE_POLICY_DROP || Length + FORWARD_QUEUE_MESSAGE_HEADER_SIZE > QueueSize);
+
+                    Dropped++;
+
+                    break;
+                }
+
+                Number++;
+            }
+            else
+            {
+                //
+                // Take a batch (sometimes smaller than the messages)
+                //
+                BatchSize       = TestRandom(&Seed) % sizeof(g_Batch);
+                MaximumMessages = TestRandom(&Seed) % 8 + 1;
+
+                Length = ForwardQueueTakeBatch(&Queue, g_Batch, BatchSize, g_Lengths, MaximumMessages, &MessageCount);
+                Offset = 0;
+
+                TEST_CHECK(MessageCount <= MaximumMessages && Length <= BatchSize);
+
+                for (UINT32 i = 0; i < MessageCount; i++)
+                {
+                    //
+                    // The messages that are larger than the batch are dropped
+                    //
+                    while (Count != 0 && g_ModelLengths[First] > BatchSize)
+                    {
+                        UsedSize -= g_ModelLengths[First] + FORWARD_QUEUE_MESSAGE_HEADER_SIZE;
+                        First = (First + 1) % TEST_MODEL_MESSAGES;
+                        Count--;
+                        Dropped++;
+                        DroppedInBatches++;
+                    }
+
+                    TEST_CHECK(Count != 0 && g_Lengths[i] == g_ModelLengths[First]);
+
+                    TestMakeModelMessage(g_ModelNumbers[First], g_Lengths[i], Message);
+
+                    TEST_CHECK(memcmp(g_Batch + Offset, Message, g_Lengths[i]) == 0);
+
+                    Offset += g_Lengths[i];
+                    UsedSize -= g_Lengths[i] + FORWARD_QUEUE_MESSAGE_HEADER_SIZE;
+                    First = (First + 1) % TEST_MODEL_MESSAGES;
+                    Count--;
+                    Taken++;
+                }
+
+                TEST_CHECK(Offset == Length);
+
+                //
+                // The batch stops at a message that doesn't fit (or a dropped one)
+                //
+                while (MessageCount < MaximumMessages && Count != 0 && g_ModelLengths[First] > BatchSize)
+                {
+                    UsedSize -= g_ModelLengths[First] + FORWARD_QUEUE_MESSAGE_HEADER_SIZE;
+                    First = (First + 1) % TEST_MODEL_MESSAGES;
+                    Count--;
+                    Dropped++;
+                    DroppedInBatches++;
+                }
+
+                if (MessageCount < MaximumMessages && Count != 0)
+                {
+                    TEST_CHECK(g_ModelLengths[First] > BatchSize - Length);
+                }
+
+                ForwardQueueCompleteBatch(&Queue, Length, MessageCount, TRUE);
+            }
+
+            TEST_CHECK(Queue.MessageCount == Count && Queue.UsedSize == UsedSize);
+            TEST_CHECK(ForwardQueueIsEmpty(&Queue) == (Count == 0));
+        }
+
+        TEST_CHECK(Queue.Statistics.QueuedMessages == Queued);
+        TEST_CHECK(Queue.Statistics.DroppedMessages == Dropped);
+        TEST_CHECK(Queue.Statistics.WrittenMessages == Taken);
+        TEST_CHECK(Queued == Taken + Count + DroppedInBatches);
+        TEST_CHECK(Number == Queued + Dropped - DroppedInBatches + Full);
+        TEST_CHECK(Queue.Statistics.MaximumUsedSize <= QueueSize);
+    }
+}
+
+/**
+ * @brief Write a buffer to a file or a socket
+ *
+ * @param Fd
+ * @param Buffer
+ * @param Length
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestWriteAll(int Fd, const UINT8 * Buffer, UINT64 Length, UINT64 * Writes)
+{
+    ssize_t Written;
+
+    while (Length != 0)
+    {
+        Written = write(Fd, Buffer, Length);
+
+        (*Writes)++;
+
+        if (Written <= 0)
+        {
+            return FALSE;
+        }
+
+        Buffer += Written;
+        Length -= (UINT64)Written;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief The worker of an output source (writes the batches)
+ *
+ * @param Parameter The output source
+ *
+ * @return void *
+ */
+static void *
+TestSinkWorker(void * Parameter)
+{
+    PTEST_SINK Sink = (PTEST_SINK)Parameter;
+    UINT32     MessageCount;
+    UINT32     Length;
+    BOOLEAN    IsWritten;
+
+    pthread_mutex_lock(&Sink->Lock);
+
+    for (;;)
+    {
+        while (ForwardQueueIsEmpty(&Sink->Queue) && !Sink->Stop)
+        {
+            pthread_cond_wait(&Sink->NotEmpty, &Sink->Lock);
+        }
+
+        if (ForwardQueueIsEmpty(&Sink->Queue))
+        {
+            break;
+        }
+
+        Length = ForwardQueueTakeBatch(&Sink->Queue, Sink->Batch, TEST_BATCH_SIZE, NULL, 0, &MessageCount);
+
+        pthread_cond_broadcast(&Sink->NotFull);
+        pthread_mutex_unlock(&Sink->Lock);
+
+        IsWritten = TestWriteAll(Sink->Fd, Sink->Batch, Length, &Sink->Writes);
+
+        pthread_mutex_lock(&Sink->Lock);
+
+        ForwardQueueCompleteBatch(&Sink->Queue, Length, MessageCount, IsWritten);
+    }
+
+    pthread_mutex_unlock(&Sink->Lock);
+
+    return NULL;
+}
+
+/**
+ * @brief Start an output source of the pipeline
+ *
+ * @param Sink
+ * @param Fd
+ * @param Policy
+ *
+ * @return VOID
+ */
+static VOID
+TestSinkStart(PTEST_SINK Sink, int Fd, FORWARD_QUEUE_POLICY Policy)
+{
+    memset(Sink, 0, sizeof(TEST_SINK));
+
+    Sink->Fd     = Fd;
+    Sink->Buffer = (UINT8 *)malloc(TEST_QUEUE_SIZE);
+    Sink->Batch  = (UINT8 *)malloc(TEST_BATCH_SIZE);
+
+    TEST_CHECK(Sink->Buffer != NULL && Sink->Batch != NULL);
+    TEST_CHECK(ForwardQueueInitialize(&Sink->Queue, Sink->Buffer, TEST_QUEUE_SIZE, Policy));
+
+    pthread_mutex_init(&Sink->Lock, NULL);
+    pthread_cond_init(&Sink->NotEmpty, NULL);
+    pthread_cond_init(&Sink->NotFull, NULL);
+
+    TEST_CHECK(pthread_create(&Sink->Worker, NULL, TestSinkWorker, Sink) == 0);
+}
+
+/**
+ * @brief Forward a message to an output source of the pipeline
+ *
+ * @param Sink
+ * @param Message
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+TestSinkForward(PTEST_SINK Sink, const CHAR * Message, UINT32 Length)
+{
+    FORWARD_QUEUE_STATUS Status;
+    BOOLEAN              WasEmpty;
+
+    pthread_mutex_lock(&Sink->Lock);
+
+    WasEmpty = ForwardQueueIsEmpty(&Sink->Queue);
+
+    while ((Status = ForwardQueuePush(&Sink->Queue, Message, Length)) == FORWARD_QUEUE_STATUS_FULL)
+    {
+        pthread_cond_wait(&Sink->NotFull, &Sink->Lock);
+
+        WasEmpty = ForwardQueueIsEmpty(&Sink->Queue);
+    }
+
+    //
+    // The worker only waits once the queue is empty
+    //
+    if (Status == FORWARD_QUEUE_STATUS_QUEUED && WasEmpty)
+    {
+        pthread_cond_signal(&Sink->NotEmpty);
+    }
+
+    pthread_mutex_unlock(&Sink->Lock);
+}
+
+/**
+ * @brief Stop an output source of the pipeline (the queued messages are
+ * written)
+ *
+ * @param Sink
+ *
+ * @return VOID
+ */
+static VOID
+TestSinkStop(PTEST_SINK Sink)
+{
+    pthread_mutex_lock(&Sink->Lock);
+
+    Sink->Stop = TRUE;
+
+    pthread_cond_signal(&Sink->NotEmpty);
+    pthread_mutex_unlock(&Sink->Lock);
+
+    pthread_join(Sink->Worker, NULL);
+
+    pthread_mutex_destroy(&Sink->Lock);
+    pthread_cond_destroy(&Sink->NotEmpty);
+    pthread_cond_destroy(&Sink->NotFull);
+
+    free(Sink->Buffer);
+    free(Sink->Batch);
+}
+
+/**
+ * @brief Read everything from a socket of the pipeline
+ *
+ * @param Parameter The receiver
+ *
+ * @return void *
+ */
+static void *
+TestReceiverThread(void * Parameter)
+{
+    PTEST_RECEIVER Receiver = (PTEST_RECEIVER)Parameter;
+    ssize_t        Received;
+
+    for (;;)
+    {
+        TEST_CHECK(Receiver->Length < Receiver->Size);
+
+        Received = read(Receiver->Fd,
+                        Receiver->Buffer + Receiver->Length,
+                        Receiver->Size - Receiver->Length < 4096 ? Receiver->Size - Receiver->Length : 4096);
+
+        if (Received <= 0)
+        {
+            break;
+        }
+
+        Receiver->Length += (UINT64)Received;
+
+        if (Receiver->Delay != 0)
+        {
+            usleep(Receiver->Delay);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Check the messages that are forwarded (in order, some of them might
+ * be dropped)
+ *
+ * @param Buffer
+ * @param Length
+ * @param IsDroppingAllowed
+ *
+ * @return UINT32 Number of the messages
+ */
+static UINT32
+TestCheckForwarded(const UINT8 * Buffer, UINT64 Length, BOOLEAN IsDroppingAllowed)
+{
+    CHAR   Message[TEST_MAXIMUM_MESSAGE_LENGTH];
+    UINT64 Offset       = 0;
+    UINT32 Count        = 0;
+    UINT32 Expected     = 0;
+    UINT32 MessageLength;
+
+    while (Offset < Length)
+    {
+        TEST_CHECK(Length - Offset >= 15 && memcmp(Buffer + Offset, "event ", 6) == 0);
+
+        Expected = (UINT32)strtoul((const CHAR *)Buffer + Offset + 6, NULL, 10);
+
+        TEST_CHECK(Expected >= Count);
+        TEST_CHECK(IsDroppingAllowed || Expected == Count);
+
+        MessageLength = TestMakeMessage(Expected, Message);
+
+        TEST_CHECK(Length - Offset >= MessageLength && memcmp(Buffer + Offset, Message, MessageLength) == 0);
+
+        Offset += MessageLength;
+        Count = Expected + 1;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Forward the messages to a file and sockets (like forwarding an event
+ * to a file and a tcp collector)
+ *
+ * @return VOID
+ */
+static VOID
+TestPipeline()
+{
+    TEST_SINK     FileSink;
+    TEST_SINK     SocketSink;
+    TEST_SINK     SlowSink;
+    TEST_RECEIVER Receiver;
+    TEST_RECEIVER SlowReceiver;
+    CHAR          Path[] = "/tmp/forward-queue-test-XXXXXX";
+    CHAR          Message[TEST_MAXIMUM_MESSAGE_LENGTH];
+    int           Sockets[2];
+    int           SlowSockets[2];
+    int           FileFd;
+    UINT64        TotalLength = 0;
+    UINT8 *       FileBuffer;
+    UINT32        Length;
+    UINT64        Start;
+    UINT64        Elapsed;
+
+    FileFd = mkstemp(Path);
+
+    TEST_CHECK(FileFd >= 0);
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, Sockets) == 0);
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, SlowSockets) == 0);
+
+    for (UINT32 i = 0; i < TEST_PIPELINE_MESSAGES; i++)
+    {
+        TotalLength += TestMakeMessage(i, Message);
+    }
+
+    memset(&Receiver, 0, sizeof(TEST_RECEIVER));
+    memset(&SlowReceiver, 0, sizeof(TEST_RECEIVER));
+
+    Receiver.Fd         = Sockets[1];
+    Receiver.Size       = TotalLength + 1;
+    Receiver.Buffer     = (UINT8 *)malloc(Receiver.Size);
+    SlowReceiver.Fd     = SlowSockets[1];
+    SlowReceiver.Delay  = 50;
+    SlowReceiver.Size   = TotalLength + 1;
+    SlowReceiver.Buffer = (UINT8 *)malloc(SlowReceiver.Size);
+
+    TEST_CHECK(Receiver.Buffer != NULL && SlowReceiver.Buffer != NULL);
+    TEST_CHECK(pthread_create(&Receiver.Thread, NULL, TestReceiverThread, &Receiver) == 0);
+    TEST_CHECK(pthread_create(&SlowReceiver.Thread, NULL, TestReceiverThread, &SlowReceiver) == 0);
+
+    TestSinkStart(&FileSink, FileFd, FORWARD_QUEUE_POLICY_BLOCK);
+    TestSinkStart(&SocketSink, Sockets[0], FORWARD_QUEUE_POLICY_BLOCK);
+    TestSinkStart(&SlowSink, SlowSockets[0], FORWARD_QUEUE_POLICY_DROP);
+
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_PIPELINE_MESSAGES; i++)
+    {
+        Length = TestMakeMessage(i, Message);
+
+        TestSinkForward(&FileSink, Message, Length);
+        TestSinkForward(&SocketSink, Message, Length);
+        TestSinkForward(&SlowSink, Message, Length);
+    }
+
+    Elapsed = TestGetTime() - Start;
+
+    TestSinkStop(&FileSink);
+    TestSinkStop(&SocketSink);
+    TestSinkStop(&SlowSink);
+
+    shutdown(Sockets[0], SHUT_WR);
+    shutdown(SlowSockets[0], SHUT_WR);
+
+    pthread_join(Receiver.Thread, NULL);
+    pthread_join(SlowReceiver.Thread, NULL);
+
+    //
+    // Nothing is dropped from the file and the socket that block
+    //
+    FileBuffer = (UINT8 *)malloc(TotalLength + 1);
+
+    TEST_CHECK(FileBuffer != NULL);
+    TEST_CHECK(pread(FileFd, FileBuffer, TotalLength + 1, 0) == (ssize_t)TotalLength);
+    TEST_CHECK(TestCheckForwarded(FileBuffer, TotalLength, FALSE) == TEST_PIPELINE_MESSAGES);
+    TEST_CHECK(FileSink.Queue.Statistics.WrittenMessages == TEST_PIPELINE_MESSAGES);
+    TEST_CHECK(FileSink.Queue.Statistics.WrittenBytes == TotalLength);
+    TEST_CHECK(FileSink.Queue.Statistics.DroppedMessages == 0);
+
+    TEST_CHECK(Receiver.Length == TotalLength);
+    TEST_CHECK(TestCheckForwarded(Receiver.Buffer, Receiver.Length, FALSE) == TEST_PIPELINE_MESSAGES);
+    TEST_CHECK(SocketSink.Queue.Statistics.WrittenMessages == TEST_PIPELINE_MESSAGES);
+
+    //
+    // The slow socket drops the messages, but the rest of them are whole and
+    // in order
+    //
+    TEST_CHECK(SlowReceiver.Length == SlowSink.Queue.Statistics.WrittenBytes);
+    TEST_CHECK(SlowSink.Queue.Statistics.WrittenMessages + SlowSink.Queue.Statistics.DroppedMessages == TEST_PIPELINE_MESSAGES);
+    TEST_CHECK(SlowSink.Queue.Statistics.FailedMessages == 0);
+
+    TestCheckForwarded(SlowReceiver.Buffer, SlowReceiver.Length, TRUE);
+
+    printf("[*] forwarding %u messages (%llu bytes) to a file and two sockets: %llu ms\n",
+           TEST_PIPELINE_MESSAGES,
+           (unsigned long long)TotalLength,
+           (unsigned long long)(Elapsed / 1000000));
+    printf("[*] file: %llu writes (%llu batches), socket: %llu writes, slow socket: %llu messages dropped\n",
+           (unsigned long long)FileSink.Writes,
+           (unsigned long long)FileSink.Queue.Statistics.Batches,
+           (unsigned long long)SocketSink.Writes,
+           (unsigned long long)SlowSink.Queue.Statistics.DroppedMessages);
+
+    free(FileBuffer);
+    free(Receiver.Buffer);
+    free(SlowReceiver.Buffer);
+
+    close(FileFd);
+    close(Sockets[0]);
+    close(Sockets[1]);
+    close(SlowSockets[0]);
+    close(SlowSockets[1]);
+    unlink(Path);
+}
+
+/**
+ * @brief Measure forwarding the messages to a file, once written directly (a
+ * write for each message) and once through the queue
+ *
+ * @return VOID
+ */
+static VOID
+TestMeasureFile()
+{
+    TEST_SINK Sink;
+    CHAR      Path[] = "/tmp/forward-queue-test-XXXXXX";
+    CHAR      Message[TEST_MAXIMUM_MESSAGE_LENGTH];
+    int       FileFd;
+    UINT32    Length;
+    UINT64    Writes = 0;
+    UINT64    Start;
+    UINT64    DirectTime;
+    UINT64    QueuedTime;
+    UINT64    TotalTime;
+
+    FileFd = mkstemp(Path);
+
+    TEST_CHECK(FileFd >= 0);
+
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_PIPELINE_MESSAGES; i++)
+    {
+        Length = TestMakeMessage(i, Message);
+
+        TEST_CHECK(TestWriteAll(FileFd, (const UINT8 *)Message, Length, &Writes));
+    }
+
+    DirectTime = TestGetTime() - Start;
+
+    TEST_CHECK(ftruncate(FileFd, 0) == 0 && lseek(FileFd, 0, SEEK_SET) == 0);
+
+    TestSinkStart(&Sink, FileFd, FORWARD_QUEUE_POLICY_BLOCK);
+
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_PIPELINE_MESSAGES; i++)
+    {
+        Length = TestMakeMessage(i, Message);
+
+        TestSinkForward(&Sink, Message, Length);
+    }
+
+    QueuedTime = TestGetTime() - Start;
+
+    TestSinkStop(&Sink);
+
+    TotalTime = TestGetTime() - Start;
+
+    TEST_CHECK(Sink.Queue.Statistics.WrittenMessages == TEST_PIPELINE_MESSAGES);
+
+    printf("[*] writing %u messages to a file directly: %llu ms (%llu writes)\n",
+           TEST_PIPELINE_MESSAGES,
+           (unsigned long long)(DirectTime / 1000000),
+           (unsigned long long)Writes);
+    printf("[*] writing %u messages to a file through the queue: %llu ms for the receiver, %llu ms in total (%llu writes)\n",
+           TEST_PIPELINE_MESSAGES,
+           (unsigned long long)(QueuedTime / 1000000),
+           (unsigned long long)(TotalTime / 1000000),
+           (unsigned long long)Sink.Writes);
+
+    close(FileFd);
+    unlink(Path);
+}
+
+int
+main()
+{
+    TestBasics();
+    TestModel();
+    TestPipeline();
+    TestMeasureFile();
+
+    printf("[+] all of the forward queue tests passed\n");
+
+    return 0;
+}
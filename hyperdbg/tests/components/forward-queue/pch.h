@@ -0,0 +1,28 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the forward queue tests (Linux)
+ * @details
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/socket.h>
+
+#define __int64 long long
+
+#include "SDK/headers/BasicTypes.h"
+
+typedef void * PVOID;
+
+#include "components/forwardqueue/header/ForwardQueue.h"
@@ -0,0 +1,457 @@
+/**
+ * @file hash-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and lookup benchmark of the hash index
+ * @details The index is compared with a simple array of items after random
+ * insertions and removals (including duplicated keys and reused tombstones),
+ * then the lookup of the hidden breakpoints is measured against walking a
+ * list of hooked pages (the same as the EPT hooks without the index).
+ * Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o hash-index-test \
+ *       hash-index-test.c ../../../include/components/hashindex/code/HashIndex.c
+ *   ./hash-index-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of slots of the tested index
+ *
+ */
+#define TEST_CAPACITY 1024
+
+/**
+ * @brief Number of random operations
+ *
+ */
+#define TEST_OPERATIONS 2000000
+
+/**
+ * @brief Number of breakpoints on each hooked page in the benchmark (the
+ * same as MaximumHiddenBreakpointsOnPage)
+ *
+ */
+#define BENCHMARK_BREAKPOINTS_ON_PAGE 40
+
+/**
+ * @brief Number of lookups of each benchmark
+ *
+ */
+#define BENCHMARK_LOOKUPS 2000000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A hooked page of the benchmark (similar to EPT_HOOKED_PAGE_DETAIL)
+ *
+ */
+typedef struct _TEST_HOOKED_PAGE
+{
+    struct _TEST_HOOKED_PAGE * Next;
+    UINT64                     PhysicalBaseAddress;
+    UINT64                     BreakpointAddresses[BENCHMARK_BREAKPOINTS_ON_PAGE];
+    UINT64                     CountOfBreakpoints;
+
+} TEST_HOOKED_PAGE, *PTEST_HOOKED_PAGE;
+
+UINT64 g_RandomState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+
+    return g_RandomState;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Check that the values of a key in the index are the same as the
+ * reference items
+ *
+ * @param Index
+ * @param Keys Keys of the reference items
+ * @param Values Values of the reference items
+ * @param Count Number of the reference items
+ * @param Key
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckKey(PHASH_INDEX Index, UINT64 * Keys, PVOID * Values, UINT32 Count, UINT64 Key)
+{
+    UINT32 Cursor   = 0;
+    UINT32 Expected = 0;
+    UINT32 Found    = 0;
+    PVOID  Value;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        if (Keys[i] == Key)
+        {
+            Expected++;
+        }
+    }
+
+    while ((Value = HashIndexFind(Index, Key, &Cursor)) != NULL)
+    {
+        BOOLEAN IsInReference = FALSE;
+
+        for (UINT32 i = 0; i < Count; i++)
+        {
+            if (Keys[i] == Key && Values[i] == Value)
+            {
+                IsInReference = TRUE;
+                break;
+            }
+        }
+
+        TEST_CHECK(IsInReference);
+        Found++;
+    }
+
+    TEST_CHECK(Found == Expected);
+    TEST_CHECK((HashIndexFind(Index, Key, NULL) != NULL) == (Expected != 0));
+}
+
+/**
+ * @brief Test the basic operations and the invalid parameters
+ *
+ * @return VOID
+ */
+static VOID
+TestBasic()
+{
+    HASH_INDEX      Index;
+    HASH_INDEX_SLOT Storage[8];
+    UINT32          Cursor = 0;
+
+    TEST_CHECK(!HashIndexInitialize(&Index, Storage, 6));
+    TEST_CHECK(!HashIndexInitialize(&Index, NULL, 8));
+    TEST_CHECK(HashIndexInitialize(&Index, Storage, 8));
+
+    TEST_CHECK(HashIndexFind(&Index, 0x1000, NULL) == NULL);
+    TEST_CHECK(!HashIndexRemove(&Index, 0x1000, (PVOID)1));
+    TEST_CHECK(!HashIndexInsert(&Index, 0x1000, NULL));
+
+    //
+    // Zero is a valid key, and the same key can have multiple values
+    //
+    TEST_CHECK(HashIndexInsert(&Index, 0, (PVOID)1));
+    TEST_CHECK(HashIndexInsert(&Index, 0x1000, (PVOID)2));
+    TEST_CHECK(HashIndexInsert(&Index, 0x1000, (PVOID)3));
+    TEST_CHECK(HashIndexFind(&Index, 0, NULL) == (PVOID)1);
+    TEST_CHECK(HashIndexFind(&Index, 0x1000, &Cursor) == (PVOID)2);
+    TEST_CHECK(HashIndexFind(&Index, 0x1000, &Cursor) == (PVOID)3);
+    TEST_CHECK(HashIndexFind(&Index, 0x1000, &Cursor) == NULL);
+
+    //
+    // The load of the index is limited (6 of 8 slots)
+    //
+    TEST_CHECK(HashIndexInsert(&Index, 0x2000, (PVOID)4));
+    TEST_CHECK(HashIndexInsert(&Index, 0x3000, (PVOID)5));
+    TEST_CHECK(HashIndexInsert(&Index, 0x4000, (PVOID)6));
+    TEST_CHECK(!HashIndexInsert(&Index, 0x5000, (PVOID)7));
+
+    TEST_CHECK(!HashIndexRemove(&Index, 0x1000, (PVOID)4));
+    TEST_CHECK(HashIndexRemove(&Index, 0x1000, (PVOID)2));
+    TEST_CHECK(HashIndexFind(&Index, 0x1000, NULL) == (PVOID)3);
+
+    //
+    // The removed slot is only reused by the same key
+    //
+    TEST_CHECK(!HashIndexInsert(&Index, 0x5000, (PVOID)7));
+    TEST_CHECK(HashIndexInsert(&Index, 0x1000, (PVOID)8));
+    TEST_CHECK(Index.Count == 6 && Index.UsedCount == 6);
+
+    //
+    // The tombstones are released once the index is empty
+    //
+    TEST_CHECK(HashIndexRemove(&Index, 0, (PVOID)1));
+    TEST_CHECK(HashIndexRemove(&Index, 0x1000, (PVOID)3));
+    TEST_CHECK(HashIndexRemove(&Index, 0x1000, (PVOID)8));
+    TEST_CHECK(HashIndexRemove(&Index, 0x2000, (PVOID)4));
+    TEST_CHECK(HashIndexRemove(&Index, 0x3000, (PVOID)5));
+    TEST_CHECK(Index.Count == 1 && Index.UsedCount == 6);
+    TEST_CHECK(HashIndexRemove(&Index, 0x4000, (PVOID)6));
+    TEST_CHECK(Index.Count == 0 && Index.UsedCount == 0);
+    TEST_CHECK(HashIndexInsert(&Index, 0x5000, (PVOID)7));
+
+    HashIndexClear(&Index);
+
+    TEST_CHECK(Index.Count == 0 && HashIndexFind(&Index, 0x5000, NULL) == NULL);
+}
+
+/**
+ * @brief Compare the index with the reference items after random operations
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomOperations()
+{
+    HASH_INDEX Index;
+    PVOID      Storage      = malloc(HashIndexGetRequiredSize(TEST_CAPACITY));
+    UINT32     MaximumCount = TEST_CAPACITY * HASH_INDEX_MAXIMUM_LOAD_PERCENT / 100;
+    UINT64     Keys[TEST_CAPACITY];
+    PVOID      Values[TEST_CAPACITY];
+    UINT32     Count    = 0;
+    UINT32     Failures = 0;
+
+    TEST_CHECK(HashIndexInitialize(&Index, Storage, TEST_CAPACITY));
+
+    for (UINT32 Operation = 0; Operation < TEST_OPERATIONS; Operation++)
+    {
+        //
+        // A small range of page-aligned keys, so there are many duplicates
+        // and long clusters
+        //
+        UINT64 Key = (TestRandom() % 512) << 12;
+
+        if (Operation % 100000 == 0)
+        {
+            //
+            // Remove all of the items (releases the tombstones)
+            //
+            while (Count != 0)
+            {
+                Count--;
+                TEST_CHECK(HashIndexRemove(&Index, Keys[Count], Values[Count]));
+            }
+
+            TEST_CHECK(Index.UsedCount == 0);
+        }
+        else if (Count < MaximumCount && (Count == 0 || TestRandom() % 2 == 0))
+        {
+            PVOID Value = (PVOID)(UINT64)(Operation + 1);
+
+            if (HashIndexInsert(&Index, Key, Value))
+            {
+                Keys[Count]   = Key;
+                Values[Count] = Value;
+                Count++;
+            }
+            else
+            {
+                //
+                // Only fails if the slots are used by the tombstones
+                //
+                TEST_CHECK(Index.UsedCount == MaximumCount);
+                Failures++;
+            }
+        }
+        else if (Count == MaximumCount && TestRandom() % 4 == 0)
+        {
+            TEST_CHECK(!HashIndexInsert(&Index, Key, (PVOID)1));
+        }
+        else
+        {
+            UINT32 Item = (UINT32)(TestRandom() % Count);
+
+            TEST_CHECK(HashIndexRemove(&Index, Keys[Item], Values[Item]));
+            TEST_CHECK(!HashIndexRemove(&Index, Keys[Item], Values[Item]));
+
+            Count--;
+            Keys[Item]   = Keys[Count];
+            Values[Item] = Values[Count];
+        }
+
+        TEST_CHECK(Index.Count == Count && Index.UsedCount <= MaximumCount);
+
+        if (Operation % 1000 == 0)
+        {
+            for (UINT64 k = 0; k < 512; k++)
+            {
+                TestCheckKey(&Index, Keys, Values, Count, k << 12);
+            }
+        }
+        else
+        {
+            TestCheckKey(&Index, Keys, Values, Count, Key);
+        }
+    }
+
+    printf("[+] %u of the insertions failed because of the tombstones\n", Failures);
+
+    free(Storage);
+}
+
+/**
+ * @brief Find a breakpoint by walking the list of hooked pages
+ *
+ * @param Head
+ * @param Rip
+ *
+ * @return PTEST_HOOKED_PAGE
+ */
+static PTEST_HOOKED_PAGE
+BenchmarkFindByList(PTEST_HOOKED_PAGE Head, UINT64 Rip)
+{
+    for (PTEST_HOOKED_PAGE Page = Head; Page != NULL; Page = Page->Next)
+    {
+        for (UINT64 i = 0; i < Page->CountOfBreakpoints; i++)
+        {
+            if (Page->BreakpointAddresses[i] == Rip)
+            {
+                return Page;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Compare the lookup of the breakpoints with and without the index
+ *
+ * @param PageCount Number of hooked pages
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(UINT32 PageCount)
+{
+    UINT32            BreakpointCount = PageCount * BENCHMARK_BREAKPOINTS_ON_PAGE;
+    UINT32            Capacity        = 2;
+    PTEST_HOOKED_PAGE Pages           = calloc(PageCount, sizeof(TEST_HOOKED_PAGE));
+    UINT64 *          Rips            = malloc(BENCHMARK_LOOKUPS * sizeof(UINT64));
+    PVOID             Storage;
+    HASH_INDEX        Index;
+    UINT64            StartTime;
+    UINT64            ListTime;
+    UINT64            IndexTime;
+    UINT64            Checksum = 0;
+
+    while ((UINT64)Capacity * HASH_INDEX_MAXIMUM_LOAD_PERCENT < (UINT64)BreakpointCount * 100 * 2)
+    {
+        Capacity *= 2;
+    }
+
+    Storage = malloc(HashIndexGetRequiredSize(Capacity));
+
+    TEST_CHECK(Pages != NULL && Rips != NULL && Storage != NULL);
+    TEST_CHECK(HashIndexInitialize(&Index, Storage, Capacity));
+
+    for (UINT32 i = 0; i < PageCount; i++)
+    {
+        Pages[i].Next                = i + 1 < PageCount ? &Pages[i + 1] : NULL;
+        Pages[i].PhysicalBaseAddress = (UINT64)(i + 1) << 12;
+
+        for (UINT32 j = 0; j < BENCHMARK_BREAKPOINTS_ON_PAGE; j++)
+        {
+            UINT64 Rip = 0xfffff80000000000ull + ((UINT64)i << 12) + j * 16;
+
+            Pages[i].BreakpointAddresses[Pages[i].CountOfBreakpoints++] = Rip;
+
+            TEST_CHECK(HashIndexInsert(&Index, Rip, &Pages[i]));
+        }
+    }
+
+    //
+    // Random breakpoints, one of each 16 lookups is not a breakpoint (the
+    // worst case of the list)
+    //
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        UINT32 Breakpoint = (UINT32)(TestRandom() % BreakpointCount);
+
+        Rips[i] = Pages[Breakpoint / BENCHMARK_BREAKPOINTS_ON_PAGE].BreakpointAddresses[Breakpoint % BENCHMARK_BREAKPOINTS_ON_PAGE];
+
+        if (i % 16 == 0)
+        {
+            Rips[i] = Rips[i] + 1;
+        }
+    }
+
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Checksum += (UINT64)BenchmarkFindByList(Pages, Rips[i]);
+    }
+
+    ListTime  = TestGetTime() - StartTime;
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Checksum -= (UINT64)HashIndexFind(&Index, Rips[i], NULL);
+    }
+
+    IndexTime = TestGetTime() - StartTime;
+
+    TEST_CHECK(Checksum == 0);
+
+    printf("%-8u %-12u %14.1f %14.1f %9.1fx\n",
+           PageCount,
+           BreakpointCount,
+           (double)ListTime / BENCHMARK_LOOKUPS,
+           (double)IndexTime / BENCHMARK_LOOKUPS,
+           (double)ListTime / IndexTime);
+
+    free(Pages);
+    free(Rips);
+    free(Storage);
+}
+
+/**
+ * @brief Main function of the hash index tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestBasic();
+    TestRandomOperations();
+
+    printf("[+] all of the hash index tests passed\n\n");
+
+    printf("%-8s %-12s %14s %14s %10s\n", "pages", "breakpoints", "list (ns)", "index (ns)", "speedup");
+
+    for (UINT32 PageCount = 1; PageCount <= 256; PageCount *= 4)
+    {
+        BenchmarkRun(PageCount);
+    }
+
+    return 0;
+}
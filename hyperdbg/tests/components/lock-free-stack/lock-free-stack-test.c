@@ -0,0 +1,540 @@
+/**
+ * @file lock-free-stack-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the lock-free stack (pool manager)
+ * @details The stack is checked by threads that pop and push the same
+ * entries concurrently (an entry should never be popped twice), then the
+ * latency of requesting and freeing pools with 1 to 64 threads is measured
+ * for the pool manager without the stacks (a spinlock and a walk over the
+ * list of all pools) and with the stacks (a pop from the stack of the
+ * intention and an address index lookup for the free). Most of the pools
+ * are held busy during the benchmark, as the pools of the applied hooks and
+ * events remain busy until they're removed. Build and run it
+ * from this directory:
+ *
+ *   gcc -O2 -mcx16 -pthread -I. -I../../../include -o lock-free-stack-test \
+ *       lock-free-stack-test.c ../../../include/components/lockfreestack/code/LockFreeStack.c \
+ *       ../../../include/components/hashindex/code/HashIndex.c
+ *   ./lock-free-stack-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum number of threads
+ *
+ */
+#define TEST_MAXIMUM_THREADS 64
+
+/**
+ * @brief Number of intentions (the same as POOL_MANAGER_NUMBER_OF_INTENTIONS)
+ *
+ */
+#define TEST_INTENTIONS 12
+
+/**
+ * @brief Number of pre-allocated pools of each intention
+ *
+ */
+#define TEST_POOLS_PER_INTENTION 256
+
+/**
+ * @brief Number of pools
+ *
+ */
+#define TEST_POOLS (TEST_INTENTIONS * TEST_POOLS_PER_INTENTION)
+
+/**
+ * @brief Number of the pools of each intention that are held (busy) during
+ * the benchmark, like the pools of the applied hooks and events
+ *
+ */
+#define BENCHMARK_BUSY_POOLS_PER_INTENTION 224
+
+/**
+ * @brief Number of slots of the address index
+ *
+ */
+#define TEST_INDEX_CAPACITY 16384
+
+/**
+ * @brief Number of pop and push operations of each thread in the stress test
+ *
+ */
+#define TEST_STRESS_OPERATIONS 1000000
+
+/**
+ * @brief Number of request and free operations in each run of the benchmark
+ * (by all threads)
+ *
+ */
+#define BENCHMARK_TOTAL_OPERATIONS (1 << 15)
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A pool (the same fields as POOL_TABLE that are used in the requests)
+ *
+ */
+typedef struct _TEST_POOL
+{
+    UINT64                Address;
+    UINT32                Intention;
+    volatile UINT32       IsBusy;
+    struct _TEST_POOL *   Next; // Next pool in the list of all pools
+    LOCK_FREE_STACK_ENTRY FreeStackEntry;
+
+} TEST_POOL, *PTEST_POOL;
+
+TEST_POOL          g_Pools[TEST_POOLS];
+PTEST_POOL         g_ListOfPools;
+LOCK_FREE_STACK    g_FreePools[TEST_INTENTIONS];
+HASH_INDEX         g_AddressIndex;
+pthread_spinlock_t g_PoolsLock;
+BOOLEAN            g_UseStacks;
+UINT32             g_OperationsPerThread;
+UINT64             g_ThreadTimes[TEST_MAXIMUM_THREADS];
+volatile UINT32    g_StartedThreads;
+volatile UINT32    g_StartThreads;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Push all of the pools to the stacks of their intentions and link
+ * them to the list (intentions are interleaved like the real allocations)
+ *
+ * @return VOID
+ */
+static VOID
+TestResetPools()
+{
+    g_ListOfPools = NULL;
+
+    for (UINT32 i = 0; i < TEST_INTENTIONS; i++)
+    {
+        LockFreeStackInitialize(&g_FreePools[i]);
+    }
+
+    for (UINT32 i = 0; i < TEST_POOLS; i++)
+    {
+        PTEST_POOL Pool = &g_Pools[i];
+
+        Pool->Address   = 0xffff800000000000ull + (UINT64)i * 0x1000;
+        Pool->Intention = i % TEST_INTENTIONS;
+        Pool->IsBusy    = FALSE;
+        Pool->Next      = g_ListOfPools;
+        g_ListOfPools   = Pool;
+
+        LockFreeStackPush(&g_FreePools[Pool->Intention], &Pool->FreeStackEntry);
+    }
+}
+
+/**
+ * @brief Check the order and the emptiness of a single-threaded stack
+ *
+ * @return VOID
+ */
+static VOID
+TestSingleThread()
+{
+    LOCK_FREE_STACK       Stack;
+    LOCK_FREE_STACK_ENTRY Entries[16];
+
+    LockFreeStackInitialize(&Stack);
+
+    TEST_CHECK(LockFreeStackIsEmpty(&Stack));
+    TEST_CHECK(LockFreeStackPop(&Stack) == NULL);
+
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        LockFreeStackPush(&Stack, &Entries[i]);
+    }
+
+    TEST_CHECK(!LockFreeStackIsEmpty(&Stack));
+
+    for (INT32 i = 15; i >= 0; i--)
+    {
+        TEST_CHECK(LockFreeStackPop(&Stack) == &Entries[i]);
+    }
+
+    TEST_CHECK(LockFreeStackIsEmpty(&Stack));
+    TEST_CHECK(LockFreeStackPop(&Stack) == NULL);
+    TEST_CHECK(Stack.Tag == 32);
+}
+
+/**
+ * @brief Stress thread, pops the pools of an intention and pushes them back
+ *
+ * @param Parameter Index of the thread
+ * @return PVOID
+ */
+static PVOID
+TestStressThread(PVOID Parameter)
+{
+    UINT32 Thread = (UINT32)(UINT64)Parameter;
+
+    __sync_add_and_fetch(&g_StartedThreads, 1);
+
+    while (!g_StartThreads)
+    {
+        sched_yield();
+    }
+
+    for (UINT32 i = 0; i < TEST_STRESS_OPERATIONS; i++)
+    {
+        //
+        // All of the threads use a few stacks to make the pops collide
+        //
+        UINT32                 Intention = (Thread + i) % 2;
+        PLOCK_FREE_STACK_ENTRY Entry     = LockFreeStackPop(&g_FreePools[Intention]);
+
+        if (Entry == NULL)
+        {
+            continue;
+        }
+
+        PTEST_POOL Pool = CONTAINING_RECORD(Entry, TEST_POOL, FreeStackEntry);
+
+        TEST_CHECK(Pool->Intention == Intention);
+        TEST_CHECK(__sync_lock_test_and_set(&Pool->IsBusy, TRUE) == FALSE);
+
+        __sync_lock_release(&Pool->IsBusy);
+
+        LockFreeStackPush(&g_FreePools[Intention], Entry);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Pop and push the same entries from many threads, then check that
+ * every entry is in its stack exactly once
+ *
+ * @param ThreadCount
+ * @return VOID
+ */
+static VOID
+TestStress(UINT32 ThreadCount)
+{
+    pthread_t Threads[TEST_MAXIMUM_THREADS];
+    UINT32    Found[TEST_INTENTIONS] = {0};
+
+    TestResetPools();
+
+    g_StartedThreads = 0;
+    g_StartThreads   = 0;
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        TEST_CHECK(pthread_create(&Threads[i], NULL, TestStressThread, (PVOID)(UINT64)i) == 0);
+    }
+
+    while (g_StartedThreads != ThreadCount)
+    {
+        sched_yield();
+    }
+
+    g_StartThreads = 1;
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        pthread_join(Threads[i], NULL);
+    }
+
+    for (UINT32 i = 0; i < TEST_INTENTIONS; i++)
+    {
+        PLOCK_FREE_STACK_ENTRY Entry;
+
+        while ((Entry = LockFreeStackPop(&g_FreePools[i])) != NULL)
+        {
+            PTEST_POOL Pool = CONTAINING_RECORD(Entry, TEST_POOL, FreeStackEntry);
+
+            TEST_CHECK(Pool->Intention == i);
+            TEST_CHECK(Pool->IsBusy == FALSE);
+
+            Pool->IsBusy = TRUE;
+            Found[i]++;
+        }
+
+        TEST_CHECK(Found[i] == TEST_POOLS_PER_INTENTION);
+    }
+}
+
+/**
+ * @brief Request a pool by walking the list (without the stacks)
+ *
+ * @param Intention
+ * @return PTEST_POOL
+ */
+static PTEST_POOL
+TestRequestFromList(UINT32 Intention)
+{
+    PTEST_POOL Result = NULL;
+
+    pthread_spin_lock(&g_PoolsLock);
+
+    for (PTEST_POOL Pool = g_ListOfPools; Pool != NULL; Pool = Pool->Next)
+    {
+        if (Pool->Intention == Intention && !Pool->IsBusy)
+        {
+            Pool->IsBusy = TRUE;
+            Result       = Pool;
+            break;
+        }
+    }
+
+    pthread_spin_unlock(&g_PoolsLock);
+
+    return Result;
+}
+
+/**
+ * @brief Free a pool by walking the list (without the address index)
+ *
+ * @param Address
+ * @return VOID
+ */
+static VOID
+TestFreeToList(UINT64 Address)
+{
+    pthread_spin_lock(&g_PoolsLock);
+
+    for (PTEST_POOL Pool = g_ListOfPools; Pool != NULL; Pool = Pool->Next)
+    {
+        if (Pool->Address == Address)
+        {
+            Pool->IsBusy = FALSE;
+            break;
+        }
+    }
+
+    pthread_spin_unlock(&g_PoolsLock);
+}
+
+/**
+ * @brief Request a pool from the stack of its intention
+ *
+ * @param Intention
+ * @return PTEST_POOL
+ */
+static PTEST_POOL
+TestRequestFromStack(UINT32 Intention)
+{
+    PLOCK_FREE_STACK_ENTRY Entry = LockFreeStackPop(&g_FreePools[Intention]);
+
+    if (Entry == NULL)
+    {
+        return NULL;
+    }
+
+    PTEST_POOL Pool = CONTAINING_RECORD(Entry, TEST_POOL, FreeStackEntry);
+
+    Pool->IsBusy = TRUE;
+
+    return Pool;
+}
+
+/**
+ * @brief Free a pool by the address index (the freed pool is pushed back,
+ * the pool manager deallocates it instead)
+ *
+ * @param Address
+ * @return VOID
+ */
+static VOID
+TestFreeToStack(UINT64 Address)
+{
+    PTEST_POOL Pool;
+
+    pthread_spin_lock(&g_PoolsLock);
+    Pool = (PTEST_POOL)HashIndexFind(&g_AddressIndex, Address, NULL);
+    pthread_spin_unlock(&g_PoolsLock);
+
+    TEST_CHECK(Pool != NULL && Pool->Address == Address);
+
+    Pool->IsBusy = FALSE;
+    LockFreeStackPush(&g_FreePools[Pool->Intention], &Pool->FreeStackEntry);
+}
+
+/**
+ * @brief Benchmark thread, requests a pool and frees it
+ *
+ * @param Parameter Index of the thread
+ * @return PVOID
+ */
+static PVOID
+BenchmarkThread(PVOID Parameter)
+{
+    UINT32 Thread = (UINT32)(UINT64)Parameter;
+    UINT64 StartTime;
+
+    __sync_add_and_fetch(&g_StartedThreads, 1);
+
+    while (!g_StartThreads)
+    {
+        sched_yield();
+    }
+
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < g_OperationsPerThread; i++)
+    {
+        UINT32     Intention = (Thread + i) % TEST_INTENTIONS;
+        PTEST_POOL Pool      = g_UseStacks ? TestRequestFromStack(Intention) : TestRequestFromList(Intention);
+
+        TEST_CHECK(Pool != NULL && Pool->Intention == Intention);
+
+        if (g_UseStacks)
+        {
+            TestFreeToStack(Pool->Address);
+        }
+        else
+        {
+            TestFreeToList(Pool->Address);
+        }
+    }
+
+    g_ThreadTimes[Thread] = TestGetTime() - StartTime;
+
+    return NULL;
+}
+
+/**
+ * @brief Run the benchmark once
+ *
+ * @param ThreadCount
+ * @param UseStacks
+ * @return double Average latency of a request and a free (in nanoseconds)
+ */
+static double
+BenchmarkRun(UINT32 ThreadCount, BOOLEAN UseStacks)
+{
+    pthread_t Threads[TEST_MAXIMUM_THREADS];
+    UINT64    TotalTime = 0;
+
+    TestResetPools();
+
+    //
+    // Hold the most recently added pools (the first ones in both the list
+    // and the stacks)
+    //
+    for (UINT32 i = 0; i < TEST_INTENTIONS; i++)
+    {
+        for (UINT32 j = 0; j < BENCHMARK_BUSY_POOLS_PER_INTENTION; j++)
+        {
+            TEST_CHECK(TestRequestFromStack(i) != NULL);
+        }
+    }
+
+    g_UseStacks           = UseStacks;
+    g_OperationsPerThread = BENCHMARK_TOTAL_OPERATIONS / ThreadCount;
+    g_StartedThreads      = 0;
+    g_StartThreads        = 0;
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        TEST_CHECK(pthread_create(&Threads[i], NULL, BenchmarkThread, (PVOID)(UINT64)i) == 0);
+    }
+
+    while (g_StartedThreads != ThreadCount)
+    {
+        sched_yield();
+    }
+
+    g_StartThreads = 1;
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        pthread_join(Threads[i], NULL);
+        TotalTime += g_ThreadTimes[i];
+    }
+
+    //
+    // Only the held pools are busy
+    //
+    UINT32 BusyCount = 0;
+
+    for (UINT32 i = 0; i < TEST_POOLS; i++)
+    {
+        BusyCount += g_Pools[i].IsBusy;
+    }
+
+    TEST_CHECK(BusyCount == TEST_INTENTIONS * BENCHMARK_BUSY_POOLS_PER_INTENTION);
+
+    return (double)TotalTime / ((double)g_OperationsPerThread * ThreadCount);
+}
+
+/**
+ * @brief Main function of the lock-free stack tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    PVOID IndexStorage = malloc(HashIndexGetRequiredSize(TEST_INDEX_CAPACITY));
+
+    TEST_CHECK(IndexStorage != NULL);
+    TEST_CHECK(HashIndexInitialize(&g_AddressIndex, IndexStorage, TEST_INDEX_CAPACITY));
+    TEST_CHECK(pthread_spin_init(&g_PoolsLock, PTHREAD_PROCESS_PRIVATE) == 0);
+
+    TestSingleThread();
+
+    for (UINT32 ThreadCount = 1; ThreadCount <= 16; ThreadCount *= 2)
+    {
+        TestStress(ThreadCount);
+    }
+
+    printf("[+] lock-free stack tests passed\n");
+
+    TestResetPools();
+
+    for (UINT32 i = 0; i < TEST_POOLS; i++)
+    {
+        TEST_CHECK(HashIndexInsert(&g_AddressIndex, g_Pools[i].Address, &g_Pools[i]));
+    }
+
+    printf("%-8s %28s %28s\n", "threads", "locked list (ns/request)", "lock-free stacks (ns/request)");
+
+    for (UINT32 ThreadCount = 1; ThreadCount <= TEST_MAXIMUM_THREADS; ThreadCount *= 2)
+    {
+        double Locked = BenchmarkRun(ThreadCount, FALSE);
+        double Stacks = BenchmarkRun(ThreadCount, TRUE);
+
+        printf("%-8u %28.1f %28.1f\n", ThreadCount, Locked, Stacks);
+    }
+
+    free(IndexStorage);
+
+    return 0;
+}
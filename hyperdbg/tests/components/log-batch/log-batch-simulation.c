@@ -0,0 +1,250 @@
+/**
+ * @file log-batch-simulation.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief User-mode simulation of the batched delivery of the kernel messages
+ * @details A "kernel" thread keeps the messages in a ring buffer (the same as
+ * hyperlog) and a "user" thread requests them, each request is a round-trip
+ * over pipes (similar to the IOCTL and the completion of the pending IRP) and
+ * the batch is copied to the buffer of the requester (similar to the
+ * buffered I/O). The cost of each message is measured for batch sizes of 1
+ * to 4096 messages. Build and run it from this directory:
+ *
+ *   gcc -O2 -pthread -I. -I../../../include -o log-batch-simulation \
+ *       log-batch-simulation.c ../../../include/components/logbatch/code/LogBatch.c \
+ *       ../../../include/components/ringbuffer/code/RingBuffer.c
+ *   ./log-batch-simulation
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of messages that are delivered in each run
+ *
+ */
+#define SIMULATION_TOTAL_MESSAGES (1 << 18)
+
+/**
+ * @brief Maximum number of messages in a batch
+ *
+ */
+#define SIMULATION_MAXIMUM_BATCH 4096
+
+/**
+ * @brief Length of each message (a typical formatted message)
+ *
+ */
+#define SIMULATION_MESSAGE_LENGTH 80
+
+/**
+ * @brief Size of the ring buffer of the kernel
+ *
+ */
+#define SIMULATION_RING_SIZE (SIMULATION_MAXIMUM_BATCH * 2 * RING_BUFFER_RECORD_SIZE(SIMULATION_MESSAGE_LENGTH))
+
+/**
+ * @brief Size of the buffer of the largest batch
+ *
+ */
+#define SIMULATION_BATCH_BUFFER_SIZE (SIMULATION_MAXIMUM_BATCH * LOG_BATCH_RECORD_SIZE(SIMULATION_MESSAGE_LENGTH))
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define SIMULATION_CHECK(Condition)                                                  \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+RING_BUFFER g_Ring;
+UINT8 *     g_KernelBatch;
+UINT8 *     g_UserBatch;
+int         g_RequestPipe[2];
+int         g_ReplyPipe[2];
+UINT32      g_NextSequence;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+SimulationGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief The kernel thread, serves the requests of the user thread
+ * @details Each request is the size of the batch buffer of the user thread,
+ * a zero-sized request stops the thread
+ *
+ * @param Parameter
+ * @return PVOID
+ */
+static PVOID
+SimulationKernel(PVOID Parameter)
+{
+    UINT8  Message[SIMULATION_MESSAGE_LENGTH];
+    UINT32 BatchSize;
+    UINT32 BatchLength;
+    UINT32 OperationCode;
+    UINT32 Length;
+
+    (void)Parameter;
+
+    memset(Message, 'a', sizeof(Message));
+
+    while (read(g_RequestPipe[0], &BatchSize, sizeof(UINT32)) == sizeof(UINT32) && BatchSize != 0)
+    {
+        //
+        // Produce the messages that fit in the batch (the events of the
+        // debuggee), the same amount of work for all of the batch sizes
+        //
+        for (UINT32 i = 0; i < BatchSize / LOG_BATCH_RECORD_SIZE(SIMULATION_MESSAGE_LENGTH); i++)
+        {
+            memcpy(Message, &g_NextSequence, sizeof(UINT32));
+            g_NextSequence++;
+
+            SIMULATION_CHECK(RingBufferWrite(&g_Ring, 0, Message, sizeof(Message)));
+        }
+
+        //
+        // Fill the batch, the same as LogReadBufferBatched
+        //
+        BatchLength = 0;
+
+        while (RingBufferRead(&g_Ring,
+                              &OperationCode,
+                              LogBatchGetRecordBody(g_KernelBatch, BatchLength),
+                              LogBatchGetAvailableLength(BatchSize, BatchLength),
+                              &Length))
+        {
+            BatchLength = LogBatchCommitRecord(g_KernelBatch, BatchLength, OperationCode, Length);
+        }
+
+        //
+        // Copy the batch to the buffer of the user (buffered I/O) and
+        // complete the request
+        //
+        memcpy(g_UserBatch, g_KernelBatch, BatchLength);
+
+        SIMULATION_CHECK(write(g_ReplyPipe[1], &BatchLength, sizeof(UINT32)) == sizeof(UINT32));
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Deliver all of the messages with batches of the specified size
+ *
+ * @param BatchCount Maximum number of messages in each batch
+ * @param RequestCount Number of requests (round-trips)
+ * @return double Nanoseconds for each message
+ */
+static double
+SimulationRun(UINT32 BatchCount, UINT64 * RequestCount)
+{
+    UINT32 BatchSize        = BatchCount * (UINT32)LOG_BATCH_RECORD_SIZE(SIMULATION_MESSAGE_LENGTH);
+    UINT32 ExpectedSequence = g_NextSequence;
+    UINT32 Received         = 0;
+    UINT32 BatchLength;
+    UINT32 Offset;
+    UINT32 OperationCode;
+    UINT32 Sequence;
+    UINT32 Length;
+    PVOID  Message;
+    UINT64 StartTime;
+
+    *RequestCount = 0;
+    StartTime     = SimulationGetTime();
+
+    while (Received < SIMULATION_TOTAL_MESSAGES)
+    {
+        SIMULATION_CHECK(write(g_RequestPipe[1], &BatchSize, sizeof(UINT32)) == sizeof(UINT32));
+        SIMULATION_CHECK(read(g_ReplyPipe[0], &BatchLength, sizeof(UINT32)) == sizeof(UINT32));
+
+        (*RequestCount)++;
+
+        //
+        // Handle the messages in place, the same as the message-reading
+        // thread of libhyperdbg
+        //
+        Offset = 0;
+
+        while (LogBatchReadRecord(g_UserBatch, BatchLength, &Offset, &OperationCode, &Message, &Length))
+        {
+            memcpy(&Sequence, Message, sizeof(UINT32));
+
+            SIMULATION_CHECK(Length == SIMULATION_MESSAGE_LENGTH && ((UINT8 *)Message)[Length] == 0);
+            SIMULATION_CHECK(Sequence == ExpectedSequence);
+
+            ExpectedSequence++;
+            Received++;
+        }
+
+        SIMULATION_CHECK(Offset == BatchLength);
+    }
+
+    return (double)(SimulationGetTime() - StartTime) / Received;
+}
+
+/**
+ * @brief Main function of the batched message delivery simulation
+ *
+ * @return int
+ */
+int
+main()
+{
+    pthread_t Kernel;
+    UINT8 *   RingStorage = malloc(SIMULATION_RING_SIZE);
+    UINT32    StopRequest = 0;
+    UINT64    RequestCount;
+    double    SingleMessageCost = 0;
+
+    g_KernelBatch = malloc(SIMULATION_BATCH_BUFFER_SIZE);
+    g_UserBatch   = malloc(SIMULATION_BATCH_BUFFER_SIZE);
+
+    SIMULATION_CHECK(RingStorage != NULL && g_KernelBatch != NULL && g_UserBatch != NULL);
+    SIMULATION_CHECK(RingBufferInitialize(&g_Ring, RingStorage, SIMULATION_RING_SIZE));
+    SIMULATION_CHECK(pipe(g_RequestPipe) == 0 && pipe(g_ReplyPipe) == 0);
+    SIMULATION_CHECK(pthread_create(&Kernel, NULL, SimulationKernel, NULL) == 0);
+
+    printf("%-8s %12s %18s %10s\n", "batch", "requests", "ns per message", "speedup");
+
+    for (UINT32 BatchCount = 1; BatchCount <= SIMULATION_MAXIMUM_BATCH; BatchCount *= 2)
+    {
+        double Cost = SimulationRun(BatchCount, &RequestCount);
+
+        if (BatchCount == 1)
+        {
+            SingleMessageCost = Cost;
+        }
+
+        printf("%-8u %12llu %18.1f %9.1fx\n", BatchCount, RequestCount, Cost, SingleMessageCost / Cost);
+    }
+
+    SIMULATION_CHECK(write(g_RequestPipe[1], &StopRequest, sizeof(UINT32)) == sizeof(UINT32));
+    pthread_join(Kernel, NULL);
+
+    free(RingStorage);
+    free(g_KernelBatch);
+    free(g_UserBatch);
+
+    return 0;
+}
@@ -0,0 +1,493 @@
+/**
+ * @file memory-search-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the memory search engine
+ * @details The matches of random (masked) patterns in random buffers are
+ * compared with a naive search, both for a whole buffer and for a buffer
+ * that is searched page by page (the same as the 's' command), then the
+ * search speed is measured against comparing the pattern at each position
+ * (the previous search). Build and run it from this directory (add -mavx2
+ * to use the AVX2 filter):
+ *
+ *   gcc -O2 -I. -I../../../include -Wno-unknown-pragmas -o memory-search-test \
+ *       memory-search-test.c ../../../include/components/memorysearch/code/MemorySearch.c
+ *   ./memory-search-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of random tests
+ *
+ */
+#define TEST_ITERATIONS 20000
+
+/**
+ * @brief Maximum length of the random buffers
+ *
+ */
+#define TEST_MAXIMUM_BUFFER_LENGTH 3000
+
+/**
+ * @brief Maximum length of the random patterns
+ *
+ */
+#define TEST_MAXIMUM_PATTERN_LENGTH 48
+
+/**
+ * @brief Maximum number of the recorded matches
+ *
+ */
+#define TEST_MAXIMUM_MATCHES (TEST_MAXIMUM_BUFFER_LENGTH * MEMORY_SEARCH_MAXIMUM_PATTERNS)
+
+/**
+ * @brief Size of the chunks (pages) of the chunked search
+ *
+ */
+#define TEST_CHUNK_SIZE 4096
+
+/**
+ * @brief Size of the benchmark buffer
+ *
+ */
+#define BENCHMARK_BUFFER_SIZE (256ull * 1024 * 1024)
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A match
+ *
+ */
+typedef struct _TEST_MATCH
+{
+    UINT64 Offset;
+    UINT32 PatternIndex;
+
+} TEST_MATCH, *PTEST_MATCH;
+
+/**
+ * @brief Recorded matches
+ *
+ */
+typedef struct _TEST_MATCHES
+{
+    TEST_MATCH Matches[TEST_MAXIMUM_MATCHES];
+    UINT32     Count;
+    UINT32     Limit; // The search is stopped after this number of matches
+
+} TEST_MATCHES, *PTEST_MATCHES;
+
+TEST_MATCHES g_Expected;
+TEST_MATCHES g_Actual;
+UINT8        g_Buffer[TEST_MAXIMUM_BUFFER_LENGTH];
+UINT8        g_PatternBytes[MEMORY_SEARCH_MAXIMUM_PATTERNS][TEST_MAXIMUM_PATTERN_LENGTH];
+UINT8        g_PatternMasks[MEMORY_SEARCH_MAXIMUM_PATTERNS][TEST_MAXIMUM_PATTERN_LENGTH];
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Record a match
+ *
+ * @param Context The matches
+ * @param PatternIndex
+ * @param Offset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestRecordMatch(PVOID Context, UINT32 PatternIndex, UINT64 Offset)
+{
+    PTEST_MATCHES Matches = (PTEST_MATCHES)Context;
+
+    TEST_CHECK(Matches->Count < TEST_MAXIMUM_MATCHES);
+
+    Matches->Matches[Matches->Count].Offset       = Offset;
+    Matches->Matches[Matches->Count].PatternIndex = PatternIndex;
+    Matches->Count++;
+
+    return Matches->Count != Matches->Limit;
+}
+
+/**
+ * @brief Count a match (for the benchmark)
+ *
+ * @param Context The counter
+ * @param PatternIndex
+ * @param Offset
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestCountMatch(PVOID Context, UINT32 PatternIndex, UINT64 Offset)
+{
+    (void)PatternIndex;
+    (void)Offset;
+
+    (*(UINT64 *)Context)++;
+
+    return TRUE;
+}
+
+/**
+ * @brief The naive search (compare every pattern at every position)
+ *
+ * @param Patterns
+ * @param PatternCount
+ * @param Stride
+ * @param Buffer
+ * @param Length
+ * @param ScanLength
+ * @param Matches
+ * @return VOID
+ */
+static VOID
+TestNaiveSearch(PMEMORY_SEARCH_PATTERN Patterns,
+                UINT32                 PatternCount,
+                UINT32                 Stride,
+                const UINT8 *          Buffer,
+                UINT64                 Length,
+                UINT64                 ScanLength,
+                PTEST_MATCHES          Matches)
+{
+    for (UINT64 Position = 0; Position < ScanLength && Position < Length; Position += Stride)
+    {
+        for (UINT32 i = 0; i < PatternCount; i++)
+        {
+            BOOLEAN IsMatched = Position + Patterns[i].Length <= Length;
+
+            for (UINT32 j = 0; IsMatched && j < Patterns[i].Length; j++)
+            {
+                UINT8 Mask = Patterns[i].Mask == NULL ? 0xff : Patterns[i].Mask[j];
+
+                IsMatched = ((Buffer[Position + j] ^ Patterns[i].Bytes[j]) & Mask) == 0;
+            }
+
+            if (IsMatched && !TestRecordMatch(Matches, i, Position))
+            {
+                return;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Search a buffer chunk by chunk (by keeping the unscanned tail of
+ * each chunk), the same as the 's' command
+ *
+ * @param Search
+ * @param Buffer
+ * @param Length
+ * @param ScanLength
+ * @param Matches
+ * @return VOID
+ */
+static VOID
+TestChunkedSearch(PMEMORY_SEARCH Search, const UINT8 * Buffer, UINT64 Length, UINT64 ScanLength, PTEST_MATCHES Matches)
+{
+    static UINT8 Window[TEST_CHUNK_SIZE + TEST_MAXIMUM_PATTERN_LENGTH];
+    UINT64       WindowLength = 0;
+    UINT64       WindowBase   = 0;
+    UINT64       Keep         = Search->MaximumLength - 1;
+
+    for (UINT64 Offset = 0; Offset < Length; Offset += TEST_CHUNK_SIZE)
+    {
+        UINT64 ChunkSize = Length - Offset < TEST_CHUNK_SIZE ? Length - Offset : TEST_CHUNK_SIZE;
+
+        memcpy(Window + WindowLength, Buffer + Offset, ChunkSize);
+        WindowLength += ChunkSize;
+
+        if (WindowLength > Keep)
+        {
+            UINT64 Scan = WindowLength - Keep;
+
+            if (ScanLength < WindowBase + Scan)
+            {
+                Scan = ScanLength > WindowBase ? ScanLength - WindowBase : 0;
+            }
+
+            if (!MemorySearchBuffer(Search, Window, WindowLength, Scan, WindowBase, TestRecordMatch, Matches))
+            {
+                return;
+            }
+
+            memmove(Window, Window + WindowLength - Keep, Keep);
+            WindowBase += WindowLength - Keep;
+            WindowLength = Keep;
+        }
+    }
+
+    //
+    // The tail of the last chunk
+    //
+    MemorySearchBuffer(Search,
+                       Window,
+                       WindowLength,
+                       ScanLength > WindowBase ? ScanLength - WindowBase : 0,
+                       WindowBase,
+                       TestRecordMatch,
+                       Matches);
+}
+
+/**
+ * @brief Compare the recorded matches
+ *
+ * @return VOID
+ */
+static VOID
+TestCompareMatches()
+{
+    TEST_CHECK(g_Expected.Count == g_Actual.Count);
+
+    for (UINT32 i = 0; i < g_Expected.Count; i++)
+    {
+        TEST_CHECK(g_Expected.Matches[i].Offset == g_Actual.Matches[i].Offset);
+        TEST_CHECK(g_Expected.Matches[i].PatternIndex == g_Actual.Matches[i].PatternIndex);
+    }
+}
+
+/**
+ * @brief Compare the engine with the naive search on random inputs
+ *
+ * @return VOID
+ */
+static VOID
+TestRandom()
+{
+    MEMORY_SEARCH         Search;
+    MEMORY_SEARCH_PATTERN Patterns[MEMORY_SEARCH_MAXIMUM_PATTERNS];
+    UINT64                TotalMatches = 0;
+    static const UINT32   Strides[]    = {1, 1, 2, 4, 8, 3};
+
+    for (UINT32 Iteration = 0; Iteration < TEST_ITERATIONS; Iteration++)
+    {
+        //
+        // A small alphabet makes a lot of matches
+        //
+        UINT32 Alphabet     = 2 + rand() % 6;
+        UINT64 Length       = rand() % TEST_MAXIMUM_BUFFER_LENGTH;
+        UINT64 ScanLength   = rand() % 4 == 0 ? rand() % (Length + 1) : Length;
+        UINT32 PatternCount = 1 + rand() % MEMORY_SEARCH_MAXIMUM_PATTERNS;
+        UINT32 Stride       = Strides[rand() % (sizeof(Strides) / sizeof(Strides[0]))];
+
+        for (UINT64 i = 0; i < Length; i++)
+        {
+            g_Buffer[i] = (UINT8)(rand() % Alphabet);
+        }
+
+        for (UINT32 i = 0; i < PatternCount; i++)
+        {
+            UINT32 PatternLength = 1 + rand() % (rand() % 2 ? 6 : TEST_MAXIMUM_PATTERN_LENGTH);
+            UINT32 MaskMode      = rand() % 4;
+
+            for (UINT32 j = 0; j < PatternLength; j++)
+            {
+                g_PatternBytes[i][j] = (UINT8)(rand() % Alphabet);
+
+                //
+                // Wildcards, masked bits or fully compared bytes
+                //
+                g_PatternMasks[i][j] = rand() % 4 == 0 ? 0x00 : (rand() % 4 == 0 ? 0x01 : 0xff);
+
+                if (MaskMode == 3)
+                {
+                    g_PatternMasks[i][j] = 0;
+                }
+            }
+
+            Patterns[i].Bytes  = g_PatternBytes[i];
+            Patterns[i].Mask   = MaskMode == 0 ? NULL : g_PatternMasks[i];
+            Patterns[i].Length = PatternLength;
+        }
+
+        TEST_CHECK(MemorySearchInitialize(&Search, Patterns, PatternCount, Stride));
+
+        g_Expected.Count = 0;
+        g_Expected.Limit = rand() % 8 == 0 ? 1 + rand() % 16 : 0;
+        g_Actual.Count   = 0;
+        g_Actual.Limit   = g_Expected.Limit;
+
+        TestNaiveSearch(Patterns, PatternCount, Stride, g_Buffer, Length, ScanLength, &g_Expected);
+
+        TEST_CHECK(MemorySearchBuffer(&Search, g_Buffer, Length, ScanLength, 0, TestRecordMatch, &g_Actual) ==
+                   (g_Expected.Limit == 0 || g_Expected.Count < g_Expected.Limit));
+
+        TestCompareMatches();
+
+        g_Actual.Count = 0;
+        TestChunkedSearch(&Search, g_Buffer, Length, ScanLength, &g_Actual);
+
+        TestCompareMatches();
+
+        TotalMatches += g_Expected.Count;
+    }
+
+    TEST_CHECK(TotalMatches != 0);
+}
+
+/**
+ * @brief Check the invalid parameters
+ *
+ * @return VOID
+ */
+static VOID
+TestInvalidParameters()
+{
+    MEMORY_SEARCH         Search;
+    MEMORY_SEARCH_PATTERN Pattern = {(const UINT8 *)"\x90", NULL, 1};
+    MEMORY_SEARCH_PATTERN Empty   = {(const UINT8 *)"\x90", NULL, 0};
+
+    TEST_CHECK(!MemorySearchInitialize(&Search, &Pattern, 0, 1));
+    TEST_CHECK(!MemorySearchInitialize(&Search, &Pattern, MEMORY_SEARCH_MAXIMUM_PATTERNS + 1, 1));
+    TEST_CHECK(!MemorySearchInitialize(&Search, &Pattern, 1, 0));
+    TEST_CHECK(!MemorySearchInitialize(&Search, &Empty, 1, 1));
+    TEST_CHECK(MemorySearchInitialize(&Search, &Pattern, 1, 1));
+}
+
+/**
+ * @brief Measure the speed of a search
+ *
+ * @param Buffer
+ * @param Patterns
+ * @param PatternCount
+ * @param UseEngine FALSE to compare the patterns at each position
+ * @param Matches The number of matches
+ * @return double GB/s
+ */
+static double
+BenchmarkRun(const UINT8 * Buffer, PMEMORY_SEARCH_PATTERN Patterns, UINT32 PatternCount, BOOLEAN UseEngine, UINT64 * Matches)
+{
+    MEMORY_SEARCH Search;
+    UINT64        StartTime;
+
+    *Matches = 0;
+
+    TEST_CHECK(MemorySearchInitialize(&Search, Patterns, PatternCount, 1));
+
+    StartTime = TestGetTime();
+
+    if (UseEngine)
+    {
+        MemorySearchBuffer(&Search, Buffer, BENCHMARK_BUFFER_SIZE, BENCHMARK_BUFFER_SIZE, 0, TestCountMatch, Matches);
+    }
+    else
+    {
+        for (UINT64 Position = 0; Position < BENCHMARK_BUFFER_SIZE; Position++)
+        {
+            for (UINT32 i = 0; i < PatternCount; i++)
+            {
+                if (Position + Patterns[i].Length <= BENCHMARK_BUFFER_SIZE &&
+                    Buffer[Position] == Patterns[i].Bytes[0] &&
+                    memcmp(Buffer + Position, Patterns[i].Bytes, Patterns[i].Length) == 0)
+                {
+                    (*Matches)++;
+                }
+            }
+        }
+    }
+
+    return (double)BENCHMARK_BUFFER_SIZE / (double)(TestGetTime() - StartTime);
+}
+
+/**
+ * @brief Measure the speed of the engine and the previous search on a
+ * buffer that looks like the kernel memory (mostly zeros and code)
+ *
+ * @return VOID
+ */
+static VOID
+Benchmark()
+{
+    UINT8 * Buffer = malloc(BENCHMARK_BUFFER_SIZE);
+    UINT64  Matches;
+    UINT64  NaiveMatches;
+
+    TEST_CHECK(Buffer != NULL);
+
+    for (UINT64 i = 0; i < BENCHMARK_BUFFER_SIZE; i++)
+    {
+        Buffer[i] = (i / 4096) % 3 == 0 ? 0 : (UINT8)(rand() >> 7);
+    }
+
+    //
+    // "mov rax, gs:[188h]" with a wildcard displacement in the masked pattern
+    //
+    static const UINT8    Code[]  = {0x65, 0x48, 0x8b, 0x04, 0x25, 0x88, 0x01, 0x00, 0x00};
+    static const UINT8    Mask[]  = {0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00};
+    static const UINT8    Other[] = {0x48, 0x89, 0x5c, 0x24, 0x08};
+    static const UINT8    Pool[]  = {'H', 'v', 'D', 'b'};
+    static const UINT8    Nops[]  = {0x90, 0x90, 0x90, 0x90, 0xcc};
+    MEMORY_SEARCH_PATTERN Single  = {Code, NULL, sizeof(Code)};
+    MEMORY_SEARCH_PATTERN Masked  = {Code, Mask, sizeof(Code)};
+    MEMORY_SEARCH_PATTERN Many[4] = {{Code, NULL, sizeof(Code)},
+                                     {Other, NULL, sizeof(Other)},
+                                     {Pool, NULL, sizeof(Pool)},
+                                     {Nops, NULL, sizeof(Nops)}};
+
+    printf("vector size: %u bytes\n", MEMORY_SEARCH_VECTOR_SIZE);
+    printf("%-28s %16s %16s\n", "search", "previous (GB/s)", "engine (GB/s)");
+
+    double Naive  = BenchmarkRun(Buffer, &Single, 1, FALSE, &NaiveMatches);
+    double Engine = BenchmarkRun(Buffer, &Single, 1, TRUE, &Matches);
+
+    TEST_CHECK(Matches == NaiveMatches);
+    printf("%-28s %16.2f %16.2f\n", "one pattern", Naive, Engine);
+
+    Engine = BenchmarkRun(Buffer, &Masked, 1, TRUE, &Matches);
+    printf("%-28s %16s %16.2f\n", "one masked pattern", "-", Engine);
+
+    Naive  = BenchmarkRun(Buffer, Many, 4, FALSE, &NaiveMatches);
+    Engine = BenchmarkRun(Buffer, Many, 4, TRUE, &Matches);
+
+    TEST_CHECK(Matches == NaiveMatches);
+    printf("%-28s %16.2f %16.2f\n", "four patterns in one pass", Naive, Engine);
+
+    free(Buffer);
+}
+
+/**
+ * @brief Main function of the memory search tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    srand(1);
+
+    TestInvalidParameters();
+    TestRandom();
+
+    printf("[+] memory search tests passed\n");
+
+    Benchmark();
+
+    return 0;
+}
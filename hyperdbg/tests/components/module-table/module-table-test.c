@@ -0,0 +1,539 @@
+/**
+ * @file module-table-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of comparing the tables of the modules and scheduling their jobs
+ * @details Fake tables of the modules (some of them are loaded more than
+ * once) are changed like the modules of a system (loaded, unloaded, and
+ * rebuilt drivers), and the comparisons are checked against comparing all
+ * of the pairs. The schedules are checked against the best schedules of the
+ * small sets of the jobs. Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o module-table-test \
+ *       module-table-test.c ../../../include/components/moduletable/code/ModuleTable.c
+ *   ./module-table-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum number of the modules of the fake tables
+ *
+ */
+#define TEST_MAXIMUM_MODULES 4096
+
+/**
+ * @brief Number of the modules of a typical system (kernel and user modules)
+ *
+ */
+#define TEST_SYSTEM_MODULES 400
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief The fake tables (they're big, so they're not on the stack)
+ *
+ */
+MODULE_TABLE_ENTRY g_OldModules[TEST_MAXIMUM_MODULES];
+MODULE_TABLE_ENTRY g_NewModules[TEST_MAXIMUM_MODULES];
+UINT32             g_OldToNew[TEST_MAXIMUM_MODULES];
+UINT32             g_NewToOld[TEST_MAXIMUM_MODULES];
+UINT32             g_Storage[TEST_MAXIMUM_MODULES * 2];
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Make a fake module
+ * @details The addresses, the sizes, and the identities are chosen from small
+ * sets, so the same values are repeated a lot
+ *
+ * @param Seed
+ * @param Module
+ *
+ * @return VOID
+ */
+static VOID
+TestMakeModule(UINT32 * Seed, PMODULE_TABLE_ENTRY Module)
+{
+    CHAR Path[64];
+
+    Module->BaseAddress = 0xfffff80000000000ull + (UINT64)(TestRandom(Seed) % 64) * 0x100000;
+    Module->Size        = (UINT64)(TestRandom(Seed) % 4 + 1) * 0x1000;
+
+    sprintf(Path, "C:\\Windows\\System32\\drivers\\driver%u.sys", TestRandom(Seed) % 8);
+
+    Module->Identity = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, Path);
+}
+
+/**
+ * @brief Check whether two modules are the same
+ *
+ * @param First
+ * @param Second
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestIsSameModule(const MODULE_TABLE_ENTRY * First, const MODULE_TABLE_ENTRY * Second)
+{
+    return First->BaseAddress == Second->BaseAddress && First->Size == Second->Size && First->Identity == Second->Identity;
+}
+
+/**
+ * @brief Check the result of comparing two tables (by comparing all of the pairs)
+ *
+ * @param OldCount
+ * @param NewCount
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckComparison(UINT32 OldCount, UINT32 NewCount)
+{
+    UINT32 OldSame;
+    UINT32 NewSame;
+    UINT32 Matched;
+
+    for (UINT32 i = 0; i < OldCount; i++)
+    {
+        if (g_OldToNew[i] != MODULE_TABLE_NO_MODULE)
+        {
+            TEST_CHECK(g_OldToNew[i] < NewCount);
+            TEST_CHECK(g_NewToOld[g_OldToNew[i]] == i);
+            TEST_CHECK(TestIsSameModule(&g_OldModules[i], &g_NewModules[g_OldToNew[i]]));
+        }
+    }
+
+    for (UINT32 i = 0; i < NewCount; i++)
+    {
+        if (g_NewToOld[i] != MODULE_TABLE_NO_MODULE)
+        {
+            TEST_CHECK(g_NewToOld[i] < OldCount);
+            TEST_CHECK(g_OldToNew[g_NewToOld[i]] == i);
+        }
+    }
+
+    //
+    // The number of the matched copies of a module is the least number of its
+    // copies in the tables (so nothing that could be reused is processed again)
+    //
+    for (UINT32 i = 0; i < OldCount; i++)
+    {
+        OldSame = 0;
+        NewSame = 0;
+        Matched = 0;
+
+        for (UINT32 j = 0; j < OldCount; j++)
+        {
+            if (TestIsSameModule(&g_OldModules[i], &g_OldModules[j]))
+            {
+                OldSame++;
+                Matched += g_OldToNew[j] != MODULE_TABLE_NO_MODULE;
+            }
+        }
+
+        for (UINT32 j = 0; j < NewCount; j++)
+        {
+            NewSame += TestIsSameModule(&g_OldModules[i], &g_NewModules[j]);
+        }
+
+        TEST_CHECK(Matched == (OldSame < NewSame ? OldSame : NewSame));
+    }
+}
+
+/**
+ * @brief Test the identities
+ *
+ * @return VOID
+ */
+static VOID
+TestIdentities()
+{
+    UINT64 First;
+    UINT64 Second;
+
+    First  = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "C:\\Windows\\System32\\ntoskrnl.exe");
+    Second = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "c:\\windows\\system32\\NTOSKRNL.EXE");
+    TEST_CHECK(First == Second);
+
+    Second = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "C:\\Windows\\System32\\ntkrnlmp.exe");
+    TEST_CHECK(First != Second);
+
+    First  = ModuleTableHashString(ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "ab"), "c");
+    Second = ModuleTableHashString(ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "a"), "bc");
+    TEST_CHECK(First != Second);
+
+    First  = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, "");
+    Second = ModuleTableHashString(First, "");
+    TEST_CHECK(First != MODULE_TABLE_IDENTITY_SEED && First != Second);
+}
+
+/**
+ * @brief Test comparing the tables
+ *
+ * @return VOID
+ */
+static VOID
+TestComparison()
+{
+    UINT32 Seed = 0x1234;
+    UINT32 OldCount;
+    UINT32 NewCount;
+    UINT32 Index;
+    UINT64 StorageSize;
+
+    //
+    // Empty tables and the size of the storage
+    //
+    TEST_CHECK(ModuleTableGetRequiredSize(0, 0, &StorageSize) && StorageSize == 0);
+    TEST_CHECK(ModuleTableCompare(g_OldModules, 0, g_NewModules, 0, g_Storage, 0, g_OldToNew, g_NewToOld));
+
+    TEST_CHECK(ModuleTableGetRequiredSize(3, 5, &StorageSize) && StorageSize == 8 * sizeof(UINT32));
+    TEST_CHECK(!ModuleTableCompare(g_OldModules, 3, g_NewModules, 5, g_Storage, StorageSize - 1, g_OldToNew, g_NewToOld));
+
+    //
+    // Random changes of random tables
+    //
+    for (UINT32 Round = 0; Round < 2000; Round++)
+    {
+        OldCount = TestRandom(&Seed) % 200;
+
+        for (UINT32 i = 0; i < OldCount; i++)
+        {
+            TestMakeModule(&Seed, &g_OldModules[i]);
+        }
+
+        //
+        // The new table is the old one (shuffled) with some of the modules
+        // removed, added, or changed
+        //
+        NewCount = 0;
+
+        for (UINT32 i = 0; i < OldCount; i++)
+        {
+            switch (TestRandom(&Seed) % 8)
+            {
+            case 0:
+                break;
+
+            case 1:
+                TestMakeModule(&Seed, &g_NewModules[NewCount++]);
+                break;
+
+            case 2:
+                g_NewModules[NewCount] = g_OldModules[i];
+                g_NewModules[NewCount++].Size += 0x1000;
+                break;
+
+            case 3:
+                g_NewModules[NewCount] = g_OldModules[i];
+                g_NewModules[NewCount++].Identity ^= 1;
+                break;
+
+            default:
+                g_NewModules[NewCount++] = g_OldModules[i];
+                break;
+            }
+        }
+
+        while (TestRandom(&Seed) % 4 != 0)
+        {
+            TestMakeModule(&Seed, &g_NewModules[NewCount++]);
+        }
+
+        for (UINT32 i = NewCount; i > 1; i--)
+        {
+            MODULE_TABLE_ENTRY Temp = g_NewModules[i - 1];
+
+            Index               = TestRandom(&Seed) % i;
+            g_NewModules[i - 1] = g_NewModules[Index];
+            g_NewModules[Index] = Temp;
+        }
+
+        TEST_CHECK(ModuleTableGetRequiredSize(OldCount, NewCount, &StorageSize) && StorageSize <= sizeof(g_Storage));
+        TEST_CHECK(ModuleTableCompare(g_OldModules, OldCount, g_NewModules, NewCount, g_Storage, StorageSize, g_OldToNew, g_NewToOld));
+
+        TestCheckComparison(OldCount, NewCount);
+    }
+}
+
+/**
+ * @brief Get the time that the last worker finishes
+ *
+ * @param Costs
+ * @param Workers
+ * @param JobCount
+ * @param WorkerCount
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetFinishTime(const UINT64 * Costs, const UINT32 * Workers, UINT32 JobCount, UINT32 WorkerCount)
+{
+    UINT64 Loads[MODULE_TABLE_MAXIMUM_WORKERS] = {0};
+    UINT64 Finish                              = 0;
+
+    for (UINT32 i = 0; i < JobCount; i++)
+    {
+        Loads[Workers[i]] += Costs[i];
+    }
+
+    for (UINT32 i = 0; i < WorkerCount; i++)
+    {
+        Finish = Loads[i] > Finish ? Loads[i] : Finish;
+    }
+
+    return Finish;
+}
+
+/**
+ * @brief Get the best time that the last worker finishes (by checking all
+ * of the schedules)
+ *
+ * @param Costs
+ * @param JobCount
+ * @param WorkerCount
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetBestFinishTime(const UINT64 * Costs, UINT32 JobCount, UINT32 WorkerCount)
+{
+    UINT32 Workers[16];
+    UINT64 Best = (UINT64)-1;
+    UINT64 Finish;
+    UINT64 Schedules = 1;
+
+    for (UINT32 i = 0; i < JobCount; i++)
+    {
+        Schedules *= WorkerCount;
+    }
+
+    for (UINT64 Schedule = 0; Schedule < Schedules; Schedule++)
+    {
+        UINT64 Value = Schedule;
+
+        for (UINT32 i = 0; i < JobCount; i++)
+        {
+            Workers[i] = (UINT32)(Value % WorkerCount);
+            Value /= WorkerCount;
+        }
+
+        Finish = TestGetFinishTime(Costs, Workers, JobCount, WorkerCount);
+        Best   = Finish < Best ? Finish : Best;
+    }
+
+    return Best;
+}
+
+/**
+ * @brief Test scheduling the jobs
+ *
+ * @return VOID
+ */
+static VOID
+TestSchedule()
+{
+    UINT32 Seed                        = 0x5678;
+    UINT64 Costs[TEST_MAXIMUM_MODULES] = {0};
+    UINT32 Order[TEST_MAXIMUM_MODULES];
+    UINT32 Workers[TEST_MAXIMUM_MODULES];
+    UINT32 JobCount;
+    UINT32 WorkerCount;
+    UINT64 Total;
+    UINT64 Largest;
+    UINT64 Finish;
+    UINT64 Best;
+
+    TEST_CHECK(!ModuleTableSchedule(Costs, 0, 0, Order, Workers));
+    TEST_CHECK(!ModuleTableSchedule(Costs, 0, MODULE_TABLE_MAXIMUM_WORKERS + 1, Order, Workers));
+    TEST_CHECK(ModuleTableSchedule(Costs, 0, 1, Order, Workers));
+
+    //
+    // The empty files are divided too
+    //
+    TEST_CHECK(ModuleTableSchedule(Costs, 8, 4, Order, Workers));
+
+    for (UINT32 i = 0; i < 8; i++)
+    {
+        TEST_CHECK(Order[i] == i && Workers[i] == i % 4);
+    }
+
+    //
+    // Big sets of the jobs (the sizes of the PDB files)
+    //
+    for (UINT32 Round = 0; Round < 200; Round++)
+    {
+        JobCount    = TestRandom(&Seed) % 1000 + 1;
+        WorkerCount = TestRandom(&Seed) % MODULE_TABLE_MAXIMUM_WORKERS + 1;
+        Total       = 0;
+        Largest     = 0;
+
+        for (UINT32 i = 0; i < JobCount; i++)
+        {
+            Costs[i] = (UINT64)(TestRandom(&Seed) % 1000) << (TestRandom(&Seed) % 16);
+            Total += Costs[i];
+            Largest = Costs[i] > Largest ? Costs[i] : Largest;
+        }
+
+        TEST_CHECK(ModuleTableSchedule(Costs, JobCount, WorkerCount, Order, Workers));
+
+        for (UINT32 i = 0; i < JobCount; i++)
+        {
+            TEST_CHECK(Workers[i] < WorkerCount);
+            TEST_CHECK(i == 0 || Costs[Order[i - 1]] >= Costs[Order[i]]);
+            TEST_CHECK(Order[i] < JobCount && Workers[Order[i]] < WorkerCount);
+        }
+
+        //
+        // Every job is in the order once
+        //
+        memset(g_Storage, 0, JobCount * sizeof(UINT32));
+
+        for (UINT32 i = 0; i < JobCount; i++)
+        {
+            TEST_CHECK(g_Storage[Order[i]]++ == 0);
+        }
+
+        //
+        // Nobody finishes later than the average work plus the largest job
+        // (plus one unit for each job)
+        //
+        Finish = TestGetFinishTime(Costs, Workers, JobCount, WorkerCount);
+        TEST_CHECK(Finish <= (Total + JobCount) / WorkerCount + Largest + 1);
+    }
+
+    //
+    // Small sets of the jobs (against the best schedules)
+    //
+    for (UINT32 Round = 0; Round < 500; Round++)
+    {
+        JobCount    = TestRandom(&Seed) % 9 + 1;
+        WorkerCount = TestRandom(&Seed) % 3 + 2;
+
+        for (UINT32 i = 0; i < JobCount; i++)
+        {
+            Costs[i] = (UINT64)(TestRandom(&Seed) % 100 + 1) * 1000;
+        }
+
+        TEST_CHECK(ModuleTableSchedule(Costs, JobCount, WorkerCount, Order, Workers));
+
+        Finish = TestGetFinishTime(Costs, Workers, JobCount, WorkerCount);
+        Best   = TestGetBestFinishTime(Costs, JobCount, WorkerCount);
+
+        TEST_CHECK(Finish * 3 <= Best * 4 + 3 * JobCount);
+    }
+}
+
+/**
+ * @brief Measure a reload after a driver is loaded
+ *
+ * @return VOID
+ */
+static VOID
+TestMeasureReload()
+{
+    UINT32 Seed    = 0x9abc;
+    UINT32 Changed = 0;
+    UINT64 StorageSize;
+    UINT64 Start;
+    UINT64 Elapsed;
+    CHAR   Path[64];
+
+    for (UINT32 i = 0; i < TEST_SYSTEM_MODULES; i++)
+    {
+        sprintf(Path, "C:\\Windows\\System32\\drivers\\module%u.sys", i);
+
+        g_OldModules[i].BaseAddress = 0xfffff80000000000ull + (UINT64)i * 0x200000;
+        g_OldModules[i].Size        = (UINT64)(TestRandom(&Seed) % 0x100 + 1) * 0x1000;
+        g_OldModules[i].Identity    = ModuleTableHashString(MODULE_TABLE_IDENTITY_SEED, Path);
+
+        g_NewModules[i] = g_OldModules[i];
+    }
+
+    TestMakeModule(&Seed, &g_NewModules[TEST_SYSTEM_MODULES]);
+    g_NewModules[TEST_SYSTEM_MODULES].BaseAddress = 0xffff800000000000ull;
+
+    TEST_CHECK(ModuleTableGetRequiredSize(TEST_SYSTEM_MODULES, TEST_SYSTEM_MODULES + 1, &StorageSize));
+
+    Start = TestGetTime();
+
+    for (UINT32 Round = 0; Round < 1000; Round++)
+    {
+        TEST_CHECK(ModuleTableCompare(g_OldModules,
+                                      TEST_SYSTEM_MODULES,
+                                      g_NewModules,
+                                      TEST_SYSTEM_MODULES + 1,
+                                      g_Storage,
+                                      StorageSize,
+                                      g_OldToNew,
+                                      g_NewToOld));
+    }
+
+    Elapsed = (TestGetTime() - Start) / 1000;
+
+    for (UINT32 i = 0; i < TEST_SYSTEM_MODULES + 1; i++)
+    {
+        Changed += g_NewToOld[i] == MODULE_TABLE_NO_MODULE;
+    }
+
+    TEST_CHECK(Changed == 1 && g_NewToOld[TEST_SYSTEM_MODULES] == MODULE_TABLE_NO_MODULE);
+
+    printf("[*] comparing the tables of %u modules (a driver is loaded): %llu ns, %u module to process\n",
+           TEST_SYSTEM_MODULES,
+           (unsigned long long)Elapsed,
+           Changed);
+}
+
+int
+main()
+{
+    TestIdentities();
+    TestComparison();
+    TestSchedule();
+    TestMeasureReload();
+
+    printf("[+] all of the module table tests passed\n");
+
+    return 0;
+}
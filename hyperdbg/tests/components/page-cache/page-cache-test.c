@@ -0,0 +1,408 @@
+/**
+ * @file page-cache-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the cache of the pages of a remote memory
+ * @details The remote memory is a fake transport that generates the bytes
+ * of the pages (some pages are not accessible) and counts the round trips.
+ * The reads through the cache are compared with the reads of the fake
+ * transport, and the hit rate of a simulated debugging session is reported.
+ * Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o page-cache-test \
+ *       page-cache-test.c ../../../include/components/pagecache/code/PageCache.c
+ *   ./page-cache-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the pages of the fake remote memory (per address space)
+ *
+ */
+#define TEST_MEMORY_PAGES 1024
+
+/**
+ * @brief Base address of the fake remote memory
+ *
+ */
+#define TEST_MEMORY_BASE 0xfffff80000000000ull
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief The fake remote memory
+ *
+ */
+typedef struct _TEST_TRANSPORT
+{
+    UINT32  Generation; // Changes the bytes of the memory (an edit)
+    BOOLEAN Inaccessible[TEST_MEMORY_PAGES];
+    UINT64  RoundTrips;
+    UINT64  TransferredPages;
+
+} TEST_TRANSPORT, *PTEST_TRANSPORT;
+
+/**
+ * @brief The cache (it's big, so it's not on the stack)
+ *
+ */
+PAGE_CACHE g_Cache;
+
+/**
+ * @brief Get a byte of the fake remote memory
+ *
+ * @param Transport
+ * @param AddressSpace
+ * @param Address
+ *
+ * @return UINT8
+ */
+static UINT8
+TestGetByte(PTEST_TRANSPORT Transport, UINT64 AddressSpace, UINT64 Address)
+{
+    UINT64 Value = (Address ^ (AddressSpace << 40) ^ ((UINT64)Transport->Generation << 20)) * 0x9e3779b97f4a7c15ull;
+
+    return (UINT8)(Value >> 56);
+}
+
+/**
+ * @brief Check whether a page of the fake remote memory is accessible
+ *
+ * @param Transport
+ * @param PageAddress
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestIsAccessible(PTEST_TRANSPORT Transport, UINT64 PageAddress)
+{
+    UINT64 Index = (PageAddress - TEST_MEMORY_BASE) / PAGE_CACHE_PAGE_SIZE;
+
+    return PageAddress >= TEST_MEMORY_BASE && Index < TEST_MEMORY_PAGES && !Transport->Inaccessible[Index];
+}
+
+/**
+ * @brief Read the pages of the fake remote memory (a round trip)
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestReadPages(PVOID Context, UINT64 AddressSpace, UINT64 Address, UINT32 PageCount, UINT8 * Buffer, UINT32 * Attributes)
+{
+    PTEST_TRANSPORT Transport = (PTEST_TRANSPORT)Context;
+
+    TEST_CHECK((Address & (PAGE_CACHE_PAGE_SIZE - 1)) == 0);
+    TEST_CHECK(PageCount != 0 && PageCount <= PAGE_CACHE_MAXIMUM_PAGES_PER_READ);
+
+    Transport->RoundTrips++;
+
+    for (UINT32 i = 0; i < PageCount; i++)
+    {
+        if (!TestIsAccessible(Transport, Address + (UINT64)i * PAGE_CACHE_PAGE_SIZE))
+        {
+            return FALSE;
+        }
+    }
+
+    for (UINT32 i = 0; i < PageCount * PAGE_CACHE_PAGE_SIZE; i++)
+    {
+        Buffer[i] = TestGetByte(Transport, AddressSpace, Address + i);
+    }
+
+    Transport->TransferredPages += PageCount;
+    *Attributes = (UINT32)AddressSpace + 0x100;
+
+    return TRUE;
+}
+
+/**
+ * @brief Read through the cache and compare it with the fake remote memory
+ *
+ * @param Transport
+ * @param AddressSpace
+ * @param Address
+ * @param Size
+ *
+ * @return BOOLEAN the result of the read
+ */
+static BOOLEAN
+TestRead(PTEST_TRANSPORT Transport, UINT64 AddressSpace, UINT64 Address, UINT32 Size)
+{
+    static UINT8 Buffer[64 * PAGE_CACHE_PAGE_SIZE];
+    UINT32       Attributes = 0;
+    BOOLEAN      Expected   = TRUE;
+
+    TEST_CHECK(Size <= sizeof(Buffer));
+
+    for (UINT64 Page = Address & ~0xfffull; Size != 0 && Page <= Address + Size - 1; Page += PAGE_CACHE_PAGE_SIZE)
+    {
+        if (!TestIsAccessible(Transport, Page))
+        {
+            Expected = FALSE;
+        }
+
+        if (Page + PAGE_CACHE_PAGE_SIZE < Page)
+        {
+            break;
+        }
+    }
+
+    if (!PageCacheRead(&g_Cache, Transport, AddressSpace, Address, Buffer, Size, &Attributes))
+    {
+        TEST_CHECK(!Expected);
+        return FALSE;
+    }
+
+    TEST_CHECK(Expected);
+    TEST_CHECK(Size == 0 || Attributes == (UINT32)AddressSpace + 0x100);
+
+    for (UINT32 i = 0; i < Size; i++)
+    {
+        TEST_CHECK(Buffer[i] == TestGetByte(Transport, AddressSpace, Address + i));
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the hits, the misses and the prefetching
+ *
+ * @return VOID
+ */
+static VOID
+TestBasic()
+{
+    static TEST_TRANSPORT Transport;
+    UINT64                Base = TEST_MEMORY_BASE + 0x10 * PAGE_CACHE_PAGE_SIZE;
+
+    memset(&Transport, 0, sizeof(Transport));
+    PageCacheInitialize(&g_Cache, TestReadPages, 2);
+
+    //
+    // A miss (with two prefetched pages) and then a hit
+    //
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0x123, 0x20));
+    TEST_CHECK(Transport.RoundTrips == 1 && Transport.TransferredPages == 3);
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0x100, 0x40));
+    TEST_CHECK(Transport.RoundTrips == 1);
+    TEST_CHECK(g_Cache.Statistics.Hits == 1 && g_Cache.Statistics.Misses == 1);
+
+    //
+    // The prefetched pages are hits
+    //
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0xff0, 0x1020));
+    TEST_CHECK(Transport.RoundTrips == 1);
+    TEST_CHECK(g_Cache.Statistics.PrefetchedPages == 2);
+
+    //
+    // Another address space is not the same memory
+    //
+    TEST_CHECK(TestRead(&Transport, 2, Base + 0x123, 0x20));
+    TEST_CHECK(Transport.RoundTrips == 2);
+
+    //
+    // Only the pages that are not cached are read (as a run)
+    //
+    TEST_CHECK(TestRead(&Transport, 1, Base - 2 * PAGE_CACHE_PAGE_SIZE, 6 * PAGE_CACHE_PAGE_SIZE));
+    TEST_CHECK(Transport.RoundTrips == 4);
+
+    //
+    // The reads that are bigger than a packet are split
+    //
+    TEST_CHECK(TestRead(&Transport, 3, Base, 40 * PAGE_CACHE_PAGE_SIZE));
+    TEST_CHECK(Transport.RoundTrips == 7);
+
+    //
+    // Zero-sized reads are not sent
+    //
+    TEST_CHECK(TestRead(&Transport, 4, Base, 0));
+    TEST_CHECK(Transport.RoundTrips == 7);
+
+    //
+    // The memory is changed (e.g., by an edit), the old pages are invalidated
+    //
+    Transport.Generation++;
+    PageCacheInvalidate(&g_Cache);
+
+    TEST_CHECK(g_Cache.Statistics.Invalidations == 1);
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0x123, 0x20));
+    TEST_CHECK(Transport.RoundTrips == 8);
+}
+
+/**
+ * @brief Test the pages that are not accessible
+ *
+ * @return VOID
+ */
+static VOID
+TestInaccessible()
+{
+    static TEST_TRANSPORT Transport;
+    UINT64                Base = TEST_MEMORY_BASE + 0x100 * PAGE_CACHE_PAGE_SIZE;
+
+    memset(&Transport, 0, sizeof(Transport));
+    PageCacheInitialize(&g_Cache, TestReadPages, 4);
+
+    Transport.Inaccessible[0x101] = TRUE;
+
+    //
+    // The prefetched page is not accessible, the requested page is read again
+    //
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0x10, 0x10));
+    TEST_CHECK(Transport.RoundTrips == 2 && g_Cache.Statistics.FailedPrefetches == 1);
+
+    //
+    // The requested page is not accessible
+    //
+    TEST_CHECK(!TestRead(&Transport, 1, Base + 0xff0, 0x20));
+    TEST_CHECK(!TestRead(&Transport, 1, Base + PAGE_CACHE_PAGE_SIZE, 1));
+
+    //
+    // The inaccessible pages are not cached, they might be paged in
+    //
+    Transport.Inaccessible[0x101] = FALSE;
+    TEST_CHECK(TestRead(&Transport, 1, Base + 0xff0, 0x20));
+
+    //
+    // Out of the memory (and the end of the address space)
+    //
+    TEST_CHECK(!TestRead(&Transport, 1, 0xfffffffffffff000ull, PAGE_CACHE_PAGE_SIZE));
+    TEST_CHECK(!PageCacheRead(&g_Cache, &Transport, 1, 0xfffffffffffffff0ull, NULL, 0x20, NULL));
+}
+
+/**
+ * @brief Test the replacement of the pages and random reads
+ *
+ * @return VOID
+ */
+static VOID
+TestRandom()
+{
+    static TEST_TRANSPORT Transport;
+    UINT32                Seed = 7;
+
+    memset(&Transport, 0, sizeof(Transport));
+    PageCacheInitialize(&g_Cache, TestReadPages, 1);
+
+    for (UINT32 i = 0; i < TEST_MEMORY_PAGES; i += 37)
+    {
+        Transport.Inaccessible[i] = TRUE;
+    }
+
+    for (UINT32 i = 0; i < 20000; i++)
+    {
+        UINT64 Address;
+        UINT32 Size;
+
+        Seed    = Seed * 1103515245 + 12345;
+        Address = TEST_MEMORY_BASE + (Seed >> 8) % (TEST_MEMORY_PAGES * PAGE_CACHE_PAGE_SIZE);
+        Seed    = Seed * 1103515245 + 12345;
+        Size    = (Seed >> 8) % ((Seed & 0x80) ? 0x100 : 0x6000);
+
+        if (Address + Size > TEST_MEMORY_BASE + TEST_MEMORY_PAGES * PAGE_CACHE_PAGE_SIZE)
+        {
+            continue;
+        }
+
+        TestRead(&Transport, (Seed >> 4) & 1, Address, Size);
+
+        if (i % 1000 == 0)
+        {
+            Transport.Generation++;
+            PageCacheInvalidate(&g_Cache);
+        }
+    }
+
+    TEST_CHECK(g_Cache.EntryCount == PAGE_CACHE_ENTRY_COUNT);
+}
+
+/**
+ * @brief Simulate a debugging session (disassembling, dumping and walking
+ * the structures while the debuggee is halted) and report the hit rate
+ *
+ * @return VOID
+ */
+static VOID
+TestSession()
+{
+    static TEST_TRANSPORT Transport;
+    UINT64                Rip  = TEST_MEMORY_BASE + 0x200 * PAGE_CACHE_PAGE_SIZE + 0xf80;
+    UINT64                List = TEST_MEMORY_BASE + 0x300 * PAGE_CACHE_PAGE_SIZE;
+    UINT64                Requests;
+
+    memset(&Transport, 0, sizeof(Transport));
+    PageCacheInitialize(&g_Cache, TestReadPages, 2);
+
+    for (UINT32 Step = 0; Step < 100; Step++)
+    {
+        //
+        // The disassembly window (u) is read after each step
+        //
+        for (UINT32 i = 0; i < 4; i++)
+        {
+            TestRead(&Transport, 1, Rip + i * 0x40, 0x40);
+        }
+
+        //
+        // A structure and its list entries (dt)
+        //
+        for (UINT32 i = 0; i < 16; i++)
+        {
+            TestRead(&Transport, 1, List + (i * 0x2c0) % (8 * PAGE_CACHE_PAGE_SIZE), 0x80);
+        }
+
+        //
+        // The stack (dq)
+        //
+        TestRead(&Transport, 1, TEST_MEMORY_BASE + 0x10 * PAGE_CACHE_PAGE_SIZE + 0xf00, 0x200);
+
+        //
+        // The debuggee continues (t, p)
+        //
+        if (Step % 10 == 9)
+        {
+            PageCacheInvalidate(&g_Cache);
+        }
+
+        Rip += 0x10;
+    }
+
+    Requests = 100 * (4 + 16 + 1);
+
+    printf("[*] %llu reads, %llu round trips (hits: %llu pages, misses: %llu pages, "
+           "prefetched: %llu pages, hit rate: %.1f%%)\n",
+           (unsigned long long)Requests,
+           (unsigned long long)Transport.RoundTrips,
+           (unsigned long long)g_Cache.Statistics.Hits,
+           (unsigned long long)g_Cache.Statistics.Misses,
+           (unsigned long long)g_Cache.Statistics.PrefetchedPages,
+           100.0 * (double)g_Cache.Statistics.Hits / (double)(g_Cache.Statistics.Hits + g_Cache.Statistics.Misses));
+
+    TEST_CHECK(Transport.RoundTrips * 10 < Requests);
+}
+
+int
+main()
+{
+    TestBasic();
+    TestInaccessible();
+    TestRandom();
+    TestSession();
+
+    printf("[+] all of the page cache tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,1234 @@
+/**
+ * @file pci-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the binary index of the PCI ID database
+ * @details Databases in the format of pci.ids are generated (sorted and
+ * shuffled, with comments, CRLFs, and the classes at the end), their indexes
+ * are built and compared with the generated entries and with the parser of
+ * the database that was used before the index (it parsed the database on
+ * each lookup). The index is written to a file, mapped, and checked not to
+ * be used if the database or the index is changed. The time of resolving
+ * the names of the devices of a PCI tree is compared with the old parser.
+ * The real database could also be tested and measured by passing its path.
+ * Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o pci-index-test \
+ *       pci-index-test.c ../../../include/components/pciindex/code/PciIndex.c
+ *   ./pci-index-test [../../../miscellaneous/constants/pciid/pci.ids]
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum number of the entries of the generated databases
+ *
+ */
+#define TEST_MAXIMUM_VENDORS    4096
+#define TEST_MAXIMUM_DEVICES    65536
+#define TEST_MAXIMUM_SUBDEVICES 65536
+#define TEST_NAME_LENGTH        64
+
+/**
+ * @brief Size of the names of the old parser
+ *
+ */
+#define LEGACY_NAME_LENGTH 255
+
+/**
+ * @brief The path of the index file of the tests
+ *
+ */
+#define TEST_INDEX_PATH "pci-index-test" PCI_INDEX_FILE_EXTENSION
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief The generated entries
+ *
+ */
+typedef struct _TEST_VENDOR
+{
+    UINT16 VendorId;
+    CHAR   Name[TEST_NAME_LENGTH];
+    UINT32 FirstDevice;
+    UINT32 DeviceCount;
+
+} TEST_VENDOR;
+
+typedef struct _TEST_DEVICE
+{
+    UINT16 DeviceId;
+    CHAR   Name[TEST_NAME_LENGTH];
+    UINT32 FirstSubDevice;
+    UINT32 SubDeviceCount;
+
+} TEST_DEVICE;
+
+typedef struct _TEST_SUBDEVICE
+{
+    UINT16 SubVendorId;
+    UINT16 SubDeviceId;
+    CHAR   Name[TEST_NAME_LENGTH];
+
+} TEST_SUBDEVICE;
+
+typedef struct _TEST_DATABASE
+{
+    TEST_VENDOR    Vendors[TEST_MAXIMUM_VENDORS];
+    TEST_DEVICE    Devices[TEST_MAXIMUM_DEVICES];
+    TEST_SUBDEVICE SubDevices[TEST_MAXIMUM_SUBDEVICES];
+    UINT32         VendorCount;
+    UINT32         DeviceCount;
+    UINT32         SubDeviceCount;
+    UINT64         NamesSize; // Size of all of the names (without interning)
+    CHAR *         Text;
+    UINT64         TextSize;
+
+} TEST_DATABASE;
+
+/**
+ * @brief The structures of the old parser (from pci-id.h)
+ *
+ */
+typedef struct _LEGACY_SUBDEVICE
+{
+    UINT16                    SubVendorId;
+    UINT16                    SubDeviceId;
+    char                      SubSystemName[LEGACY_NAME_LENGTH];
+    struct _LEGACY_SUBDEVICE * Next;
+
+} LEGACY_SUBDEVICE;
+
+typedef struct _LEGACY_DEVICE
+{
+    UINT16                  DeviceId;
+    char                    DeviceName[LEGACY_NAME_LENGTH];
+    LEGACY_SUBDEVICE *      SubDevices;
+    struct _LEGACY_DEVICE * Next;
+
+} LEGACY_DEVICE;
+
+typedef struct _LEGACY_VENDOR
+{
+    UINT16          VendorId;
+    char            VendorName[LEGACY_NAME_LENGTH];
+    LEGACY_DEVICE * Devices;
+
+} LEGACY_VENDOR;
+
+/**
+ * @brief The generated database (it's big, so it's not on the stack)
+ *
+ */
+TEST_DATABASE g_Database;
+
+/**
+ * @brief Get a random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Map a file (read-only)
+ *
+ * @param Path
+ * @param Size
+ *
+ * @return const VOID * NULL if it's not mapped
+ */
+static const VOID *
+TestMapFile(const CHAR * Path, UINT64 * Size)
+{
+    struct stat Stat;
+    VOID *      View;
+    int         File = open(Path, O_RDONLY);
+
+    if (File < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(File, &Stat) != 0 || Stat.st_size == 0)
+    {
+        close(File);
+        return NULL;
+    }
+
+    View = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+    close(File);
+
+    if (View == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    *Size = (UINT64)Stat.st_size;
+
+    return View;
+}
+
+/**
+ * @brief Build the index of a database
+ *
+ * @param Text
+ * @param TextSize
+ *
+ * @return VOID * The index (its size is in its header)
+ */
+static VOID *
+TestBuildIndex(const CHAR * Text, UINT64 TextSize)
+{
+    VOID * Index;
+    UINT32 IndexSize;
+
+    TEST_CHECK(PciIndexGetRequiredSize(Text, TextSize, &IndexSize));
+
+    Index = malloc(IndexSize);
+    TEST_CHECK(Index != NULL);
+    TEST_CHECK(PciIndexBuild(Text, TextSize, Index, IndexSize));
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->TotalSize <= IndexSize);
+    TEST_CHECK(PciIndexValidate(Index, IndexSize, PciIndexHashText(Text, TextSize), TextSize));
+
+    return Index;
+}
+
+/**
+ * @brief Trim the whitespaces of a string (the old parser)
+ *
+ * @param Str
+ * @param MaxLen
+ *
+ * @return char *
+ */
+static char *
+LegacyTrimWhitespace(char * Str, UINT8 MaxLen)
+{
+    char * End;
+
+    while (*Str == ' ')
+        Str++;
+    if (*Str == '\0')
+        return Str;
+    End = Str + strnlen(Str, MaxLen) - 1;
+    while (End > Str && (*End == ' ' || *End == '\n' || *End == '\r'))
+        End--;
+    *(End + 1) = '\0';
+    return Str;
+}
+
+/**
+ * @brief Read a line of the database (the old parser)
+ *
+ * @param DestBuffer
+ * @param CharLimit
+ * @param SrcBuffer
+ *
+ * @return char *
+ */
+static char *
+LegacyReadLine(char * DestBuffer, UINT64 CharLimit, char ** SrcBuffer)
+{
+    char * Line = strchr(*SrcBuffer, '\n');
+    size_t Length;
+
+    if (!Line)
+    {
+        return NULL;
+    }
+
+    Length = (size_t)(Line - *SrcBuffer) < CharLimit - 1 ? (size_t)(Line - *SrcBuffer) : CharLimit - 1;
+
+    memcpy(DestBuffer, *SrcBuffer, Length);
+    DestBuffer[Length] = '\0';
+
+    *SrcBuffer += (Line - *SrcBuffer + 1);
+    return *SrcBuffer;
+}
+
+/**
+ * @brief Free a vendor of the old parser
+ *
+ * @param VendorToFree
+ *
+ * @return VOID
+ */
+static VOID
+LegacyFreeVendor(LEGACY_VENDOR * VendorToFree)
+{
+    if (VendorToFree == NULL)
+        return;
+
+    LEGACY_DEVICE * CurrentDevice = VendorToFree->Devices;
+    while (CurrentDevice)
+    {
+        LEGACY_SUBDEVICE * CurrentSubDevice = CurrentDevice->SubDevices;
+
+        while (CurrentSubDevice)
+        {
+            LEGACY_SUBDEVICE * NextSubDevice = CurrentSubDevice->Next;
+            free(CurrentSubDevice);
+            CurrentSubDevice = NextSubDevice;
+        }
+
+        LEGACY_DEVICE * NextDevice = CurrentDevice->Next;
+        free(CurrentDevice);
+        CurrentDevice = NextDevice;
+    }
+
+    free(VendorToFree);
+}
+
+/**
+ * @brief Get a vendor by parsing the database (the old parser, which was
+ * called for each device of the PCI tree)
+ *
+ * @param Buffer The null-terminated database
+ * @param VendorId
+ *
+ * @return LEGACY_VENDOR *
+ */
+static LEGACY_VENDOR *
+LegacyGetVendorById(char * Buffer, UINT16 VendorId)
+{
+    LEGACY_VENDOR *    MatchedVendor = NULL;
+    BOOLEAN            FoundVendorId = FALSE;
+    LEGACY_DEVICE *    LastDevice    = NULL;
+    LEGACY_SUBDEVICE * LastSubDevice = NULL;
+    char *             PciIdDbBufPtr = Buffer;
+    char               Line[1024]    = {'\0'};
+    char               VendorIdAsStr[5];
+
+    snprintf(VendorIdAsStr, sizeof(VendorIdAsStr), "%04x", VendorId);
+
+    while (LegacyReadLine(Line, sizeof(Line), &PciIdDbBufPtr) != NULL)
+    {
+        char FormatStr[24];
+
+        if (Line[0] == '#' || Line[0] == '\0')
+        {
+            continue;
+        }
+
+        if (Line[0] != '\t' && FoundVendorId == FALSE)
+        {
+            char VendorBuf[5], VendorNameBuf[LEGACY_NAME_LENGTH + 1];
+
+            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", LEGACY_NAME_LENGTH);
+            if (sscanf(Line, FormatStr, VendorBuf, VendorNameBuf) == 2 && strcmp(VendorBuf, VendorIdAsStr) == 0)
+            {
+                MatchedVendor = (LEGACY_VENDOR *)calloc(1, sizeof(LEGACY_VENDOR));
+                TEST_CHECK(MatchedVendor != NULL);
+                TEST_CHECK(sscanf(VendorBuf, "%hx", &MatchedVendor->VendorId) == 1);
+                snprintf(MatchedVendor->VendorName, sizeof(MatchedVendor->VendorName), "%s", LegacyTrimWhitespace(VendorNameBuf, LEGACY_NAME_LENGTH));
+                FoundVendorId = TRUE;
+            }
+        }
+        else if (Line[0] == '\t' && Line[1] != '\t' && FoundVendorId == TRUE)
+        {
+            char DeviceBuf[5], DeviceNameBuf[LEGACY_NAME_LENGTH + 1];
+
+            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%%d[^\n]", LEGACY_NAME_LENGTH);
+            if (sscanf(Line + 1, FormatStr, DeviceBuf, DeviceNameBuf) == 2)
+            {
+                LEGACY_DEVICE * NewDevice = (LEGACY_DEVICE *)calloc(1, sizeof(LEGACY_DEVICE));
+                TEST_CHECK(NewDevice != NULL);
+                TEST_CHECK(sscanf(DeviceBuf, "%hx", &NewDevice->DeviceId) == 1);
+                snprintf(NewDevice->DeviceName, sizeof(NewDevice->DeviceName), "%s", LegacyTrimWhitespace(DeviceNameBuf, LEGACY_NAME_LENGTH));
+
+                if (LastDevice)
+                    LastDevice->Next = NewDevice;
+                else
+                    MatchedVendor->Devices = NewDevice;
+                LastDevice    = NewDevice;
+                LastSubDevice = NULL;
+            }
+        }
+        else if (Line[0] == '\t' && Line[1] == '\t' && FoundVendorId == TRUE && LastDevice)
+        {
+            char SubVendorBuf[5], SubDeviceBuf[5], SubsystemNameBuf[LEGACY_NAME_LENGTH + 1];
+
+            snprintf(FormatStr, sizeof(FormatStr), "%%4s %%4s %%%d[^\n]", LEGACY_NAME_LENGTH);
+            if (sscanf(Line + 2, FormatStr, SubVendorBuf, SubDeviceBuf, SubsystemNameBuf) == 3)
+            {
+                LEGACY_SUBDEVICE * NewSubDevice = (LEGACY_SUBDEVICE *)calloc(1, sizeof(LEGACY_SUBDEVICE));
+                TEST_CHECK(NewSubDevice != NULL);
+                TEST_CHECK(sscanf(SubVendorBuf, "%hx", &NewSubDevice->SubVendorId) == 1);
+                TEST_CHECK(sscanf(SubDeviceBuf, "%hx", &NewSubDevice->SubDeviceId) == 1);
+                snprintf(NewSubDevice->SubSystemName, sizeof(NewSubDevice->SubSystemName), "%s", LegacyTrimWhitespace(SubsystemNameBuf, LEGACY_NAME_LENGTH));
+
+                if (LastSubDevice)
+                    LastSubDevice->Next = NewSubDevice;
+                else
+                    LastDevice->SubDevices = NewSubDevice;
+                LastSubDevice = NewSubDevice;
+            }
+        }
+        else if (Line[0] != '\t' && FoundVendorId == TRUE)
+        {
+            break;
+        }
+    }
+
+    return MatchedVendor;
+}
+
+/**
+ * @brief Find a device of a vendor of the old parser
+ *
+ * @param VendorToUse
+ * @param DeviceId
+ *
+ * @return LEGACY_DEVICE *
+ */
+static LEGACY_DEVICE *
+LegacyGetDeviceFromVendor(LEGACY_VENDOR * VendorToUse, UINT16 DeviceId)
+{
+    for (LEGACY_DEVICE * CurrentDevice = VendorToUse->Devices; CurrentDevice != NULL; CurrentDevice = CurrentDevice->Next)
+    {
+        if (CurrentDevice->DeviceId == DeviceId)
+        {
+            return CurrentDevice;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Get a random permutation
+ *
+ * @param Order
+ * @param Count
+ * @param Seed
+ * @param Shuffle Whether the permutation is shuffled (or it's the identity)
+ *
+ * @return VOID
+ */
+static VOID
+TestGetOrder(UINT32 * Order, UINT32 Count, UINT32 * Seed, BOOLEAN Shuffle)
+{
+    UINT32 j;
+    UINT32 Temp;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Order[i] = i;
+    }
+
+    for (UINT32 i = Count; Shuffle && i > 1; i--)
+    {
+        j            = TestRandom(Seed) % i;
+        Temp         = Order[i - 1];
+        Order[i - 1] = Order[j];
+        Order[j]     = Temp;
+    }
+}
+
+/**
+ * @brief Get sorted distinct random IDs
+ *
+ * @param Ids
+ * @param Count
+ * @param Seed
+ *
+ * @return VOID
+ */
+static VOID
+TestGetIds(UINT32 * Ids, UINT32 Count, UINT32 * Seed)
+{
+    static UINT8 Used[0x10000];
+    UINT32       Id;
+    UINT32       Added = 0;
+
+    memset(Used, 0, sizeof(Used));
+
+    while (Added < Count)
+    {
+        Id = TestRandom(Seed) & 0xffff;
+
+        if (!Used[Id])
+        {
+            Used[Id] = 1;
+            Added++;
+        }
+    }
+
+    Added = 0;
+
+    for (Id = 0; Id < 0x10000; Id++)
+    {
+        if (Used[Id])
+        {
+            Ids[Added++] = Id;
+        }
+    }
+}
+
+/**
+ * @brief Append a text to the generated database
+ *
+ * @param Database
+ * @param Capacity
+ * @param Text
+ * @param IsCrlf Whether the line ends with a CRLF
+ *
+ * @return VOID
+ */
+static VOID
+TestAppend(TEST_DATABASE * Database, UINT64 * Capacity, const CHAR * Text, BOOLEAN IsCrlf)
+{
+    UINT64 Length = strlen(Text);
+
+    if (Database->TextSize + Length + 3 > *Capacity)
+    {
+        *Capacity      = (*Capacity + Length + 3) * 2;
+        Database->Text = (CHAR *)realloc(Database->Text, *Capacity);
+        TEST_CHECK(Database->Text != NULL);
+    }
+
+    memcpy(&Database->Text[Database->TextSize], Text, Length);
+    Database->TextSize += Length;
+
+    if (IsCrlf)
+    {
+        Database->Text[Database->TextSize++] = '\r';
+    }
+
+    Database->Text[Database->TextSize++] = '\n';
+    Database->Text[Database->TextSize]   = '\0';
+}
+
+/**
+ * @brief Generate a database (like pci.ids)
+ * @details A few vendors have thousands of devices, and the names of the
+ * subsystems are often the same (they're interned by the index)
+ *
+ * @param Database
+ * @param VendorCount
+ * @param Seed
+ * @param Shuffle Whether the entries are not sorted
+ *
+ * @return VOID
+ */
+static VOID
+TestGenerateDatabase(TEST_DATABASE * Database, UINT32 VendorCount, UINT32 Seed, BOOLEAN Shuffle)
+{
+    static UINT32 Ids[0x10000];
+    static UINT32 SubIds[0x10000];
+    static UINT32 Order[0x10000];
+    static UINT32 DeviceOrder[0x10000];
+    static UINT32 SubDeviceOrder[0x10000];
+    CHAR          Line[256];
+    UINT64        Capacity = 0;
+    UINT32        Count;
+
+    free(Database->Text);
+    memset(Database, 0, sizeof(TEST_DATABASE));
+
+    TestGetIds(Ids, VendorCount, &Seed);
+
+    for (UINT32 i = 0; i < VendorCount; i++)
+    {
+        TEST_VENDOR * Vendor = &Database->Vendors[Database->VendorCount++];
+
+        Vendor->VendorId    = (UINT16)Ids[i];
+        Vendor->FirstDevice = Database->DeviceCount;
+
+        snprintf(Vendor->Name, sizeof(Vendor->Name), "Vendor %04x %s", Ids[i], TestRandom(&Seed) % 4 ? "Corporation" : "Inc. [Vendor Inc]");
+        Database->NamesSize += strlen(Vendor->Name) + 1;
+
+        //
+        // A few big vendors (at most 1024 devices) and many small ones
+        //
+        Count = TestRandom(&Seed) % 128 == 0 ? 128 + TestRandom(&Seed) % 896 : TestRandom(&Seed) % 8;
+        Count = Count < TEST_MAXIMUM_DEVICES - Database->DeviceCount ? Count : TEST_MAXIMUM_DEVICES - Database->DeviceCount;
+
+        TestGetIds(SubIds, Count, &Seed);
+
+        for (UINT32 j = 0; j < Count; j++)
+        {
+            TEST_DEVICE * Device = &Database->Devices[Database->DeviceCount++];
+            UINT32        SubDeviceCount;
+
+            Device->DeviceId       = (UINT16)SubIds[j];
+            Device->FirstSubDevice = Database->SubDeviceCount;
+
+            snprintf(Device->Name, sizeof(Device->Name), "Device %04x:%04x Controller", Ids[i], SubIds[j]);
+            Database->NamesSize += strlen(Device->Name) + 1;
+
+            SubDeviceCount = TestRandom(&Seed) % 3 == 0 ? TestRandom(&Seed) % 6 : 0;
+            SubDeviceCount = SubDeviceCount < TEST_MAXIMUM_SUBDEVICES - Database->SubDeviceCount ? SubDeviceCount : TEST_MAXIMUM_SUBDEVICES - Database->SubDeviceCount;
+
+            //
+            // The subsystems are distinct (by their subvendors)
+            //
+            for (UINT32 k = 0; k < SubDeviceCount; k++)
+            {
+                TEST_SUBDEVICE * SubDevice = &Database->SubDevices[Database->SubDeviceCount++];
+                UINT32           Name      = TestRandom(&Seed) % 100;
+
+                SubDevice->SubVendorId = (UINT16)(Ids[TestRandom(&Seed) % VendorCount] + k * 0x100);
+                SubDevice->SubDeviceId = (UINT16)TestRandom(&Seed);
+
+                snprintf(SubDevice->Name, sizeof(SubDevice->Name), "%s Adapter %u", Name % 2 ? "Network" : "Graphics", Name);
+                Database->NamesSize += strlen(SubDevice->Name) + 1;
+            }
+
+            Device->SubDeviceCount = SubDeviceCount;
+
+            //
+            // Sort the subsystems by (subvendor, subdevice)
+            //
+            for (UINT32 k = 1; k < SubDeviceCount; k++)
+            {
+                for (UINT32 l = k; l != 0; l--)
+                {
+                    TEST_SUBDEVICE * Current = &Database->SubDevices[Device->FirstSubDevice + l];
+                    TEST_SUBDEVICE   Temp;
+
+                    if (((UINT32)Current[-1].SubVendorId << 16 | Current[-1].SubDeviceId) <=
+                        ((UINT32)Current->SubVendorId << 16 | Current->SubDeviceId))
+                    {
+                        break;
+                    }
+
+                    Temp        = Current[-1];
+                    Current[-1] = *Current;
+                    *Current    = Temp;
+                }
+            }
+        }
+
+        Vendor->DeviceCount = Count;
+    }
+
+    //
+    // Write the database (the entries are shuffled if it's requested)
+    //
+    TestAppend(Database, &Capacity, "#", FALSE);
+    TestAppend(Database, &Capacity, "#\tList of PCI ID's", FALSE);
+    TestAppend(Database, &Capacity, "#", FALSE);
+    TestAppend(Database, &Capacity, "# Syntax:", FALSE);
+    TestAppend(Database, &Capacity, "# vendor  vendor_name", FALSE);
+    TestAppend(Database, &Capacity, "#\tdevice  device_name\t\t\t\t<-- single tab", FALSE);
+    TestAppend(Database, &Capacity, "#\t\tsubvendor subdevice  subsystem_name\t<-- two tabs", FALSE);
+    TestAppend(Database, &Capacity, "", FALSE);
+
+    TestGetOrder(Order, Database->VendorCount, &Seed, Shuffle);
+
+    for (UINT32 i = 0; i < Database->VendorCount; i++)
+    {
+        TEST_VENDOR * Vendor = &Database->Vendors[Order[i]];
+
+        if (TestRandom(&Seed) % 16 == 0)
+        {
+            TestAppend(Database, &Capacity, "# A comment before a vendor", FALSE);
+        }
+
+        snprintf(Line, sizeof(Line), "%04x  %s", Vendor->VendorId, Vendor->Name);
+        TestAppend(Database, &Capacity, Line, TestRandom(&Seed) % 8 == 0);
+
+        TestGetOrder(DeviceOrder, Vendor->DeviceCount, &Seed, Shuffle);
+
+        for (UINT32 j = 0; j < Vendor->DeviceCount; j++)
+        {
+            TEST_DEVICE * Device = &Database->Devices[Vendor->FirstDevice + DeviceOrder[j]];
+
+            snprintf(Line, sizeof(Line), "\t%04x  %s", Device->DeviceId, Device->Name);
+            TestAppend(Database, &Capacity, Line, TestRandom(&Seed) % 8 == 0);
+
+            if (TestRandom(&Seed) % 64 == 0)
+            {
+                TestAppend(Database, &Capacity, "# A comment between the devices", FALSE);
+            }
+
+            TestGetOrder(SubDeviceOrder, Device->SubDeviceCount, &Seed, Shuffle);
+
+            for (UINT32 k = 0; k < Device->SubDeviceCount; k++)
+            {
+                TEST_SUBDEVICE * SubDevice = &Database->SubDevices[Device->FirstSubDevice + SubDeviceOrder[k]];
+
+                snprintf(Line, sizeof(Line), "\t\t%04x %04x  %s", SubDevice->SubVendorId, SubDevice->SubDeviceId, SubDevice->Name);
+                TestAppend(Database, &Capacity, Line, TestRandom(&Seed) % 8 == 0);
+            }
+        }
+    }
+
+    //
+    // The classes are not vendors, so their entries are ignored
+    //
+    TestAppend(Database, &Capacity, "", FALSE);
+    TestAppend(Database, &Capacity, "# List of known device classes, subclasses and programming interfaces", FALSE);
+    TestAppend(Database, &Capacity, "C 00  Unclassified device", FALSE);
+    TestAppend(Database, &Capacity, "\t00  Non-VGA unclassified device", FALSE);
+    TestAppend(Database, &Capacity, "\t01  VGA compatible unclassified device", FALSE);
+    TestAppend(Database, &Capacity, "\t\t00  Unknown interface", FALSE);
+    TestAppend(Database, &Capacity, "C 02  Network controller", FALSE);
+    TestAppend(Database, &Capacity, "\t00  Ethernet controller", FALSE);
+}
+
+/**
+ * @brief Check the index of a generated database against its entries
+ *
+ * @param Database
+ * @param Index
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckEntries(const TEST_DATABASE * Database, const VOID * Index)
+{
+    const PCI_INDEX_HEADER * Header = (const PCI_INDEX_HEADER *)Index;
+    static UINT8             IsVendor[0x10000];
+    UINT32                   Seed      = 7;
+    UINT64                   NamesSize = Database->NamesSize;
+
+    TEST_CHECK(Header->VendorCount == Database->VendorCount);
+    TEST_CHECK(Header->DeviceCount == Database->DeviceCount);
+    TEST_CHECK(Header->SubDeviceCount == Database->SubDeviceCount);
+
+    //
+    // The names of the subsystems are repeated (there are 100 of them), so
+    // they're stored once
+    //
+    memset(IsVendor, 0, sizeof(IsVendor));
+
+    for (UINT32 i = 0; i < Database->SubDeviceCount; i++)
+    {
+        UINT32 Name = (UINT32)atoi(strrchr(Database->SubDevices[i].Name, ' ') + 1);
+
+        if (IsVendor[Name])
+        {
+            NamesSize -= strlen(Database->SubDevices[i].Name) + 1;
+        }
+
+        IsVendor[Name] = 1;
+    }
+
+    TEST_CHECK(NamesSize + 1 == Header->StringsSize);
+
+    memset(IsVendor, 0, sizeof(IsVendor));
+
+    for (UINT32 i = 0; i < Database->VendorCount; i++)
+    {
+        const TEST_VENDOR *      Vendor      = &Database->Vendors[i];
+        const PCI_INDEX_VENDOR * IndexVendor = PciIndexFindVendor(Index, Vendor->VendorId);
+
+        IsVendor[Vendor->VendorId] = 1;
+
+        TEST_CHECK(IndexVendor != NULL);
+        TEST_CHECK(IndexVendor->VendorId == Vendor->VendorId);
+        TEST_CHECK(IndexVendor->DeviceCount == Vendor->DeviceCount);
+        TEST_CHECK(strcmp(PciIndexGetName(Index, IndexVendor->NameOffset), Vendor->Name) == 0);
+
+        for (UINT32 j = 0; j < Vendor->DeviceCount; j++)
+        {
+            const TEST_DEVICE *      Device      = &Database->Devices[Vendor->FirstDevice + j];
+            const PCI_INDEX_DEVICE * IndexDevice = PciIndexFindDevice(Index, IndexVendor, Device->DeviceId);
+
+            TEST_CHECK(IndexDevice != NULL);
+            TEST_CHECK(IndexDevice == &PciIndexGetDevices(Index, IndexVendor)[j]);
+            TEST_CHECK(IndexDevice->SubDeviceCount == Device->SubDeviceCount);
+            TEST_CHECK(strcmp(PciIndexGetName(Index, IndexDevice->NameOffset), Device->Name) == 0);
+
+            for (UINT32 k = 0; k < Device->SubDeviceCount; k++)
+            {
+                const TEST_SUBDEVICE *      SubDevice      = &Database->SubDevices[Device->FirstSubDevice + k];
+                const PCI_INDEX_SUBDEVICE * IndexSubDevice = PciIndexFindSubDevice(Index, IndexDevice, SubDevice->SubVendorId, SubDevice->SubDeviceId);
+
+                TEST_CHECK(IndexSubDevice != NULL);
+                TEST_CHECK(IndexSubDevice == &PciIndexGetSubDevices(Index, IndexDevice)[k]);
+                TEST_CHECK(strcmp(PciIndexGetName(Index, IndexSubDevice->NameOffset), SubDevice->Name) == 0);
+            }
+
+            TEST_CHECK(PciIndexFindSubDevice(Index, IndexDevice, 0xffff, 0xffff) == NULL || Device->SubDeviceCount != 0);
+        }
+    }
+
+    //
+    // The missing vendors and devices are not found
+    //
+    for (UINT32 i = 0; i < 0x10000; i++)
+    {
+        TEST_CHECK((PciIndexFindVendor(Index, (UINT16)i) != NULL) == IsVendor[i]);
+    }
+
+    for (UINT32 i = 0; i < 1000 && Database->VendorCount != 0; i++)
+    {
+        const TEST_VENDOR *      Vendor      = &Database->Vendors[TestRandom(&Seed) % Database->VendorCount];
+        const PCI_INDEX_VENDOR * IndexVendor = PciIndexFindVendor(Index, Vendor->VendorId);
+        UINT16                   DeviceId    = (UINT16)TestRandom(&Seed);
+        BOOLEAN                  IsDevice    = FALSE;
+
+        for (UINT32 j = 0; j < Vendor->DeviceCount; j++)
+        {
+            IsDevice |= Database->Devices[Vendor->FirstDevice + j].DeviceId == DeviceId;
+        }
+
+        TEST_CHECK((PciIndexFindDevice(Index, IndexVendor, DeviceId) != NULL) == IsDevice);
+    }
+}
+
+/**
+ * @brief Check the index against the old parser (for all of the vendors)
+ *
+ * @param Text The null-terminated database
+ * @param Index
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckLegacy(CHAR * Text, const VOID * Index)
+{
+    const PCI_INDEX_HEADER * Header  = (const PCI_INDEX_HEADER *)Index;
+    const PCI_INDEX_VENDOR * Vendors = (const PCI_INDEX_VENDOR *)((const UINT8 *)Index + Header->VendorsOffset);
+    LEGACY_VENDOR *          Vendor;
+    LEGACY_DEVICE *          Device;
+    LEGACY_SUBDEVICE *       SubDevice;
+    UINT32                   Count;
+
+    for (UINT32 i = 0; i < Header->VendorCount; i++)
+    {
+        //
+        // The old parser uses the first one of the vendors with the same ID
+        //
+        if (i != 0 && Vendors[i].VendorId == Vendors[i - 1].VendorId)
+        {
+            continue;
+        }
+
+        Vendor = LegacyGetVendorById(Text, Vendors[i].VendorId);
+
+        TEST_CHECK(Vendor != NULL);
+        TEST_CHECK(strcmp(Vendor->VendorName, PciIndexGetName(Index, Vendors[i].NameOffset)) == 0);
+
+        Count = 0;
+
+        for (Device = Vendor->Devices; Device != NULL; Device = Device->Next, Count++)
+        {
+            const PCI_INDEX_DEVICE * IndexDevice = PciIndexFindDevice(Index, &Vendors[i], Device->DeviceId);
+
+            TEST_CHECK(IndexDevice != NULL);
+
+            if (LegacyGetDeviceFromVendor(Vendor, Device->DeviceId) != Device)
+            {
+                continue;
+            }
+
+            TEST_CHECK(strcmp(Device->DeviceName, PciIndexGetName(Index, IndexDevice->NameOffset)) == 0);
+
+            for (SubDevice = Device->SubDevices; SubDevice != NULL; SubDevice = SubDevice->Next)
+            {
+                const PCI_INDEX_SUBDEVICE * IndexSubDevice = PciIndexFindSubDevice(Index, IndexDevice, SubDevice->SubVendorId, SubDevice->SubDeviceId);
+
+                TEST_CHECK(IndexSubDevice != NULL);
+            }
+        }
+
+        TEST_CHECK(Count == Vendors[i].DeviceCount);
+
+        LegacyFreeVendor(Vendor);
+    }
+}
+
+/**
+ * @brief Test the index of the generated databases
+ *
+ * @return VOID
+ */
+static VOID
+TestGenerated()
+{
+    const CHAR * Comments  = "# only a comment\n\n";
+    const CHAR * Short     = "8086  Intel Corporation\r\n\t1237  440FX - 82441FX PMC [Natoma]  \n\t\t1af4 1100  Qemu virtual machine";
+    const CHAR * Malformed = "\t1234  Orphan device\n80g6  Not a vendor\n\t1111  Not a device\n1234\n12345 Wrong\n"
+                             "10de  NVIDIA\n\t\t0001 0002  Orphan subsystem\n";
+    VOID *       Index;
+
+    for (UINT32 Seed = 1; Seed <= 4; Seed++)
+    {
+        TestGenerateDatabase(&g_Database, Seed * 300, Seed, Seed % 2 == 0);
+
+        Index = TestBuildIndex(g_Database.Text, g_Database.TextSize);
+
+        TestCheckEntries(&g_Database, Index);
+        TestCheckLegacy(g_Database.Text, Index);
+
+        free(Index);
+    }
+
+    //
+    // The empty databases and a database without the last new line
+    //
+    Index = TestBuildIndex("", 0);
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->VendorCount == 0);
+    TEST_CHECK(PciIndexFindVendor(Index, 0x8086) == NULL);
+    free(Index);
+
+    Index = TestBuildIndex(Comments, strlen(Comments));
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->VendorCount == 0);
+    free(Index);
+
+    Index = TestBuildIndex(Short, strlen(Short));
+    TEST_CHECK(PciIndexFindVendor(Index, 0x8086) != NULL);
+    TEST_CHECK(strcmp(PciIndexGetName(Index, PciIndexFindVendor(Index, 0x8086)->NameOffset), "Intel Corporation") == 0);
+    TEST_CHECK(strcmp(PciIndexGetName(Index, PciIndexFindDevice(Index, PciIndexFindVendor(Index, 0x8086), 0x1237)->NameOffset),
+                      "440FX - 82441FX PMC [Natoma]") == 0);
+    TEST_CHECK(strcmp(PciIndexGetName(Index,
+                                      PciIndexFindSubDevice(Index,
+                                                            PciIndexFindDevice(Index, PciIndexFindVendor(Index, 0x8086), 0x1237),
+                                                            0x1af4,
+                                                            0x1100)
+                                          ->NameOffset),
+                      "Qemu virtual machine") == 0);
+    free(Index);
+
+    //
+    // The malformed lines (and the devices without vendors) are ignored
+    //
+    Index = TestBuildIndex(Malformed, strlen(Malformed));
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->VendorCount == 1);
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->DeviceCount == 0);
+    TEST_CHECK(((PCI_INDEX_HEADER *)Index)->SubDeviceCount == 0);
+    free(Index);
+
+    //
+    // The random texts (made of the characters of the database)
+    //
+    for (UINT32 i = 0; i < 2000; i++)
+    {
+        UINT32 Seed   = i + 1;
+        UINT32 Length = TestRandom(&Seed) % 512 + 1;
+        CHAR * Random = (CHAR *)malloc(Length); // Not null-terminated
+
+        TEST_CHECK(Random != NULL);
+
+        for (UINT32 j = 0; j < Length; j++)
+        {
+            Random[j] = "0123456789abcdef  \t\t\t\n\n\r#CN"[TestRandom(&Seed) % 27];
+        }
+
+        Index = TestBuildIndex(Random, Length);
+
+        free(Index);
+        free(Random);
+    }
+
+    printf("[+] the indexes of the generated databases match the entries and the old parser\n");
+}
+
+/**
+ * @brief Test writing the index to a file, mapping it, and not using the
+ * changed or corrupted index files
+ *
+ * @return VOID
+ */
+static VOID
+TestPersistence()
+{
+    VOID *       Index;
+    VOID *       Corrupted;
+    const VOID * Mapped;
+    UINT64       MappedSize;
+    UINT64       Hash;
+    UINT32       TotalSize;
+    UINT32       Seed  = 99;
+    UINT32       Valid = 0;
+    FILE *       File;
+
+    TestGenerateDatabase(&g_Database, 1000, 12, FALSE);
+
+    Index     = TestBuildIndex(g_Database.Text, g_Database.TextSize);
+    TotalSize = ((PCI_INDEX_HEADER *)Index)->TotalSize;
+    Hash      = PciIndexHashText(g_Database.Text, g_Database.TextSize);
+
+    File = fopen(TEST_INDEX_PATH, "wb");
+    TEST_CHECK(File != NULL);
+    TEST_CHECK(fwrite(Index, 1, TotalSize, File) == TotalSize);
+    fclose(File);
+
+    Mapped = TestMapFile(TEST_INDEX_PATH, &MappedSize);
+    TEST_CHECK(Mapped != NULL);
+    TEST_CHECK(MappedSize == TotalSize);
+    TEST_CHECK(PciIndexValidate(Mapped, MappedSize, Hash, g_Database.TextSize));
+
+    TestCheckEntries(&g_Database, Mapped);
+
+    //
+    // The index of another database, and the truncated index
+    //
+    g_Database.Text[g_Database.TextSize / 2] ^= 1;
+
+    TEST_CHECK(!PciIndexValidate(Mapped, MappedSize, PciIndexHashText(g_Database.Text, g_Database.TextSize), g_Database.TextSize));
+    TEST_CHECK(!PciIndexValidate(Mapped, MappedSize, Hash, g_Database.TextSize + 1));
+    TEST_CHECK(!PciIndexValidate(Mapped, MappedSize - 1, Hash, g_Database.TextSize));
+    TEST_CHECK(!PciIndexValidate(Mapped, sizeof(PCI_INDEX_HEADER) - 1, Hash, g_Database.TextSize));
+
+    g_Database.Text[g_Database.TextSize / 2] ^= 1;
+
+    //
+    // The corrupted indexes are either not valid or safe to be used
+    //
+    Corrupted = malloc(TotalSize);
+    TEST_CHECK(Corrupted != NULL);
+
+    for (UINT32 i = 0; i < 3000; i++)
+    {
+        memcpy(Corrupted, Mapped, TotalSize);
+
+        for (UINT32 j = 0; j < 4; j++)
+        {
+            UINT32 Offset = i % 2 ? TestRandom(&Seed) % sizeof(PCI_INDEX_HEADER) : TestRandom(&Seed) % TotalSize;
+
+            ((UINT8 *)Corrupted)[Offset] = (UINT8)TestRandom(&Seed);
+        }
+
+        if (!PciIndexValidate(Corrupted, TotalSize, Hash, g_Database.TextSize))
+        {
+            continue;
+        }
+
+        Valid++;
+
+        for (UINT32 j = 0; j < 0x10000; j++)
+        {
+            const PCI_INDEX_VENDOR * Vendor = PciIndexFindVendor(Corrupted, (UINT16)j);
+
+            if (Vendor != NULL)
+            {
+                TEST_CHECK(PciIndexGetName(Corrupted, Vendor->NameOffset) != NULL);
+
+                for (UINT32 k = 0; k < Vendor->DeviceCount; k++)
+                {
+                    const PCI_INDEX_DEVICE * Device = PciIndexFindDevice(Corrupted, Vendor, PciIndexGetDevices(Corrupted, Vendor)[k].DeviceId);
+
+                    TEST_CHECK(Device != NULL && strlen(PciIndexGetName(Corrupted, Device->NameOffset)) < TotalSize);
+                }
+            }
+        }
+    }
+
+    printf("[*] %u of the 3000 corrupted indexes were valid (and safe to be used)\n", Valid);
+
+    free(Corrupted);
+    munmap((VOID *)Mapped, MappedSize);
+    unlink(TEST_INDEX_PATH);
+    free(Index);
+
+    printf("[+] the mapped index is used only with the same database\n");
+}
+
+/**
+ * @brief Measure resolving the names of the devices of PCI trees by the
+ * old parser and by the index
+ *
+ * @param Name The name of the database
+ * @param Text The null-terminated database
+ * @param TextSize
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(const CHAR * Name, CHAR * Text, UINT64 TextSize)
+{
+    const PCI_INDEX_HEADER * Header;
+    const PCI_INDEX_VENDOR * Vendors;
+    const PCI_INDEX_DEVICE * Devices;
+    VOID *                   Index;
+    UINT16                   VendorIds[256];
+    UINT16                   DeviceIds[256];
+    UINT32                   Seed  = 5;
+    UINT32                   Found = 0;
+    UINT32                   Count = 0;
+    UINT32                   IndexSize;
+    UINT64                   Start;
+    UINT64                   BuildTime;
+    UINT64                   LoadTime;
+    UINT64                   LegacyTime;
+    UINT64                   IndexTime;
+
+    Start = TestGetTime();
+    TEST_CHECK(PciIndexGetRequiredSize(Text, TextSize, &IndexSize));
+    Index = malloc(IndexSize);
+    TEST_CHECK(Index != NULL && PciIndexBuild(Text, TextSize, Index, IndexSize));
+    BuildTime = TestGetTime() - Start;
+
+    //
+    // Loading the cached index hashes the database and validates the index
+    //
+    Start = TestGetTime();
+    TEST_CHECK(PciIndexValidate(Index, IndexSize, PciIndexHashText(Text, TextSize), TextSize));
+    LoadTime = TestGetTime() - Start;
+
+    Header  = (const PCI_INDEX_HEADER *)Index;
+    Vendors = (const PCI_INDEX_VENDOR *)((const UINT8 *)Index + Header->VendorsOffset);
+    Devices = (const PCI_INDEX_DEVICE *)((const UINT8 *)Index + Header->DevicesOffset);
+
+    printf("\n[*] %s: %llu bytes, %u vendors, %u devices, %u subsystems, index: %u bytes, build: %llu us, load: %llu us\n",
+           Name,
+           TextSize,
+           Header->VendorCount,
+           Header->DeviceCount,
+           Header->SubDeviceCount,
+           Header->TotalSize,
+           BuildTime / 1000,
+           LoadTime / 1000);
+
+    //
+    // The devices of the trees are random devices of the database
+    //
+    while (Count < 256 && Header->DeviceCount != 0)
+    {
+        const PCI_INDEX_VENDOR * Vendor = &Vendors[TestRandom(&Seed) % Header->VendorCount];
+
+        if (Vendor->DeviceCount != 0 && (Vendor == Vendors || Vendor[-1].VendorId != Vendor->VendorId))
+        {
+            VendorIds[Count] = Vendor->VendorId;
+            DeviceIds[Count] = Devices[Vendor->FirstDevice + TestRandom(&Seed) % Vendor->DeviceCount].DeviceId;
+            Count++;
+        }
+    }
+
+    TEST_CHECK(Count == 256);
+
+    printf("%-8s %16s %16s %16s %10s\n", "devices", "parser (us)", "index (us)", "index+load (us)", "speedup");
+
+    for (UINT32 TreeSize = 16; TreeSize <= 256; TreeSize *= 4)
+    {
+        Start = TestGetTime();
+
+        for (UINT32 i = 0; i < TreeSize; i++)
+        {
+            LEGACY_VENDOR * Vendor = LegacyGetVendorById(Text, VendorIds[i]);
+
+            Found += Vendor != NULL && LegacyGetDeviceFromVendor(Vendor, DeviceIds[i]) != NULL;
+            LegacyFreeVendor(Vendor);
+        }
+
+        LegacyTime = TestGetTime() - Start;
+        Start      = TestGetTime();
+
+        for (UINT32 Round = 0; Round < 1000; Round++)
+        {
+            for (UINT32 i = 0; i < TreeSize; i++)
+            {
+                const PCI_INDEX_VENDOR * Vendor = PciIndexFindVendor(Index, VendorIds[i]);
+
+                Found += Vendor != NULL && PciIndexFindDevice(Index, Vendor, DeviceIds[i]) != NULL;
+            }
+        }
+
+        IndexTime = (TestGetTime() - Start) / 1000;
+
+        printf("%-8u %16.1f %16.3f %16.1f %9.1fx\n",
+               TreeSize,
+               (double)LegacyTime / 1000,
+               (double)IndexTime / 1000,
+               (double)(IndexTime + LoadTime) / 1000,
+               (double)LegacyTime / (IndexTime + LoadTime));
+    }
+
+    TEST_CHECK(Found == (16 + 64 + 256) * 1001);
+
+    free(Index);
+}
+
+/**
+ * @brief Main function of the PCI ID index tests
+ *
+ * @param argc
+ * @param argv The path of a real database (optional)
+ *
+ * @return int
+ */
+int
+main(int argc, char ** argv)
+{
+    const VOID * Mapped;
+    UINT64       MappedSize;
+    CHAR *       Text = NULL;
+    VOID *       Index;
+
+    if (argc > 1)
+    {
+        Mapped = TestMapFile(argv[1], &MappedSize);
+
+        if (Mapped == NULL)
+        {
+            printf("[x] cannot map the database '%s'\n", argv[1]);
+            return 1;
+        }
+
+        Text = (CHAR *)malloc(MappedSize + 1);
+        TEST_CHECK(Text != NULL);
+
+        memcpy(Text, Mapped, MappedSize);
+        Text[MappedSize] = '\0';
+
+        munmap((VOID *)Mapped, MappedSize);
+
+        Index = TestBuildIndex(Text, MappedSize);
+        TestCheckLegacy(Text, Index);
+        free(Index);
+
+        printf("[+] the index of '%s' matches the old parser\n", argv[1]);
+    }
+
+    TestGenerated();
+    TestPersistence();
+
+    printf("[+] all of the PCI ID index tests passed\n");
+
+    //
+    // A database of the size of pci.ids
+    //
+    TestGenerateDatabase(&g_Database, 2500, 2024, FALSE);
+    BenchmarkRun("generated database", g_Database.Text, g_Database.TextSize);
+
+    if (Text != NULL)
+    {
+        BenchmarkRun(argv[1], Text, MappedSize);
+        free(Text);
+    }
+
+    free(g_Database.Text);
+
+    return 0;
+}
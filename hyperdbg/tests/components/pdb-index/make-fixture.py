@@ -0,0 +1,175 @@
+#
+# @file make-fixture.py
+# @author Sina Karvandi (sina@hyperdbg.org)
+# @brief Generates the fixture PDB file of the PDB index tests
+# @details The fixture is a small MSF 7.00 file with the streams that are
+# used by the PDB index (PDB info, DBI, symbol records, section headers and
+# the symbols of the modules). The blocks are small (512 bytes) and they're
+# shuffled, so the streams and the records are not contiguous. It can be
+# checked by 'llvm-pdbutil dump --summary --symbols --section-headers fixture.pdb'
+#
+#   python3 make-fixture.py fixture.pdb
+#
+# @version 0.11
+# @date 2026-10-17
+#
+# @copyright This project is released under the GNU Public License v3.
+#
+import random
+import struct
+import sys
+
+BLOCK_SIZE = 512
+
+S_END = 0x0006
+S_UDT = 0x1108
+S_LDATA32 = 0x110C
+S_GDATA32 = 0x110D
+S_PUB32 = 0x110E
+S_LPROC32 = 0x110F
+S_GPROC32 = 0x1110
+S_LPROC32_ID = 0x1146
+S_GPROC32_ID = 0x1147
+
+#
+# The generated public symbols (the tests compute the same symbols)
+#
+SYNTHETIC_COUNT = 5000
+SYNTHETIC_OFFSET = 0x10000
+SYNTHETIC_STEP = 0x10
+
+
+def record(kind, payload):
+    payload += b'\0' * (-(len(payload) + 4) % 4)
+    return struct.pack('<HH', len(payload) + 2, kind) + payload
+
+
+def public(name, segment, offset):
+    return record(S_PUB32, struct.pack('<IIH', 0, offset, segment) + name.encode() + b'\0')
+
+
+def data(kind, name, segment, offset):
+    return record(kind, struct.pack('<IIH', 0x74, offset, segment) + name.encode() + b'\0')
+
+
+def proc(kind, name, segment, offset, size):
+    return (record(kind, struct.pack('<IIIIIIIIHB', 0, 0, 0, size, 0, 0, 0x1001, offset, segment, 0) +
+                   name.encode() + b'\0') +
+            record(S_END, b''))
+
+
+def module_info(stream, symbols_size, name):
+    info = struct.pack('<I', 0)
+    info += struct.pack('<H2siiIH2sII', 0xffff, b'\0\0', 0, 0, 0, 0, b'\0\0', 0, 0)
+    info += struct.pack('<HHIIIH2sIII', 0, stream, symbols_size, 0, 0, 0, b'\0\0', 0, 0, 0)
+    info += name.encode() + b'\0' + name.encode() + b'\0'
+    return info + b'\0' * (-len(info) % 4)
+
+
+def section(name, virtual_address, virtual_size):
+    return struct.pack('<8sIIIIIIHHI', name.encode(), virtual_size, virtual_address,
+                       virtual_size, 0, 0, 0, 0, 0, 0x60000020)
+
+
+def type_stream():
+    return struct.pack('<IIIIIHHIIiIiIiI', 20040203, 56, 0x1000, 0x1000, 0, 0xffff, 0xffff,
+                       4, 0x3ffff, 0, 0, 0, 0, 0, 0)
+
+
+def main():
+    random.seed(0x4844)
+
+    #
+    # The global symbols (publics and data)
+    #
+    records = [
+        public('NtCreateFile', 1, 0x100),
+        public('?Foo@Bar@@QEAAXXZ', 1, 0x200),
+        public('Long' + 'x' * 3000, 1, 0x300),
+        public('AbsoluteSymbol', 0, 0x1234),
+        data(S_GDATA32, 'PsInitialSystemProcess', 2, 0x10),
+        data(S_LDATA32, 'MiStaticData', 2, 0x20),
+        record(S_UDT, struct.pack('<I', 0x1001) + b'SkipMe\0'),
+    ]
+    records += [public('Sym%05d' % i, 1, SYNTHETIC_OFFSET + i * SYNTHETIC_STEP) for i in range(SYNTHETIC_COUNT)]
+    random.shuffle(records)
+
+    #
+    # The symbols of the modules (after their signatures)
+    #
+    module0 = struct.pack('<I', 4)
+    module0 += proc(S_GPROC32, 'NtCreateFile', 1, 0x100, 0x40)
+    module0 += proc(S_LPROC32, 'Helper', 1, 0x400, 0x10)
+    module0 += proc(S_GPROC32_ID, 'KiSystemCall64', 3, 0, 0x100)
+
+    module1 = struct.pack('<I', 4)
+    module1 += proc(S_LPROC32, 'Helper', 1, 0x500, 0x10)
+    module1 += proc(S_LPROC32_ID, 'MiStaticHelper', 3, 0x30, 0x20)
+
+    sections = section('.text', 0x1000, 0x80000) + section('.data', 0x90000, 0x1000) + \
+        section('PAGE', 0xa0000, 0x1000)
+
+    pdb_info = struct.pack('<III16s', 20000404, 0x5eed, 3, bytes(range(16)))
+    pdb_info += struct.pack('<IIIII', 0, 0, 1, 0, 0) + struct.pack('<I', 20140508)
+
+    modules = module_info(9, len(module0), 'a.obj') + module_info(10, len(module1), 'b.obj') + \
+        module_info(0xffff, 0, '* Linker *')
+    source_info = struct.pack('<HH3H3H', 3, 0, 0, 0, 0, 0, 0, 0)
+    debug_header = struct.pack('<11H', *[0xffff] * 5 + [8] + [0xffff] * 5)
+
+    dbi = struct.pack('<iIIHHHHHHiiiiiIiiHHI', -1, 19990903, 3, 0xffff, 0x8e1d, 0xffff, 0, 7, 0,
+                      len(modules), 0, 0, len(source_info), 0, 0, len(debug_header), 0, 0, 0x8664, 0)
+    dbi += modules + source_info + debug_header
+
+    #
+    # The modules end with the (empty) global references
+    #
+    streams = [b'', pdb_info, type_stream(), dbi, type_stream(), b'', b'', b''.join(records),
+               sections, module0 + b'\0' * 4, module1 + b'\0' * 4]
+
+    #
+    # Blocks 0-2 are the super block and the free block maps, the others
+    # are shuffled
+    #
+    block_count = 3 + sum((len(s) + BLOCK_SIZE - 1) // BLOCK_SIZE for s in streams)
+    directory_size = 4 + 4 * len(streams) + 4 * (block_count - 3)
+    directory_blocks = (directory_size + BLOCK_SIZE - 1) // BLOCK_SIZE
+    block_count += directory_blocks + 1
+    free = list(range(3, block_count))
+    random.shuffle(free)
+
+    blocks = {}
+    stream_blocks = []
+
+    for s in streams:
+        numbers = []
+        for i in range(0, len(s), BLOCK_SIZE):
+            numbers.append(free.pop())
+            blocks[numbers[-1]] = s[i:i + BLOCK_SIZE]
+        stream_blocks.append(numbers)
+
+    directory = struct.pack('<I', len(streams)) + b''.join(struct.pack('<I', len(s)) for s in streams)
+    directory += b''.join(struct.pack('<%dI' % len(n), *n) for n in stream_blocks)
+
+    numbers = []
+    for i in range(0, len(directory), BLOCK_SIZE):
+        numbers.append(free.pop())
+        blocks[numbers[-1]] = directory[i:i + BLOCK_SIZE]
+
+    block_map = free.pop()
+    blocks[block_map] = struct.pack('<%dI' % len(numbers), *numbers)
+    assert not free
+
+    blocks[0] = b'Microsoft C/C++ MSF 7.00\r\n\x1aDS\0\0\0' + \
+        struct.pack('<IIIIII', BLOCK_SIZE, 1, block_count, len(directory), 0, block_map)
+    blocks[1] = b'\xff' * BLOCK_SIZE
+    blocks[2] = b'\xff' * BLOCK_SIZE
+
+    with open(sys.argv[1], 'wb') as f:
+        for i in range(block_count):
+            block = blocks.get(i, b'')
+            f.write(block + b'\0' * (BLOCK_SIZE - len(block)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,601 @@
+/**
+ * @file pdb-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the native PDB reader and the index of its symbols
+ * @details The fixture PDB file is mapped (like the symbol parser does), its
+ * index is built, written to a file and mapped again. The symbols of the
+ * index are compared with the symbols of the fixture (see make-fixture.py),
+ * and the corrupted PDB files and index files are checked not to be used.
+ * Build and run it from this directory:
+ *
+ *   python3 make-fixture.py fixture.pdb
+ *   gcc -O2 -I. -I../../../include -o pdb-index-test \
+ *       pdb-index-test.c ../../../include/components/pdbindex/code/PdbIndex.c
+ *   ./pdb-index-test fixture.pdb
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The generated public symbols of the fixture (Sym00000, ...)
+ *
+ */
+#define TEST_SYNTHETIC_COUNT 5000
+#define TEST_SYNTHETIC_RVA   0x11000
+#define TEST_SYNTHETIC_STEP  0x10
+
+/**
+ * @brief Number of the symbols of the fixture (the duplicated NtCreateFile,
+ * the absolute symbol and the UDT are not indexed)
+ *
+ */
+#define TEST_SYMBOL_COUNT (TEST_SYNTHETIC_COUNT + 9)
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A named symbol of the fixture
+ *
+ */
+typedef struct _TEST_SYMBOL
+{
+    const CHAR * Name;
+    UINT32       Rva;
+    UINT32       Size;
+    UINT16       Kind;
+
+} TEST_SYMBOL;
+
+static const TEST_SYMBOL g_TestSymbols[] = {
+    {"NtCreateFile", 0x1100, 0x40, PDB_INDEX_SYMBOL_FUNCTION},
+    {"?Foo@Bar@@QEAAXXZ", 0x1200, 0, PDB_INDEX_SYMBOL_PUBLIC},
+    {"PsInitialSystemProcess", 0x90010, 0, PDB_INDEX_SYMBOL_DATA},
+    {"MiStaticData", 0x90020, 0, PDB_INDEX_SYMBOL_DATA},
+    {"Helper", 0x1400, 0x10, PDB_INDEX_SYMBOL_FUNCTION},
+    {"KiSystemCall64", 0xa0000, 0x100, PDB_INDEX_SYMBOL_FUNCTION},
+    {"MiStaticHelper", 0xa0030, 0x20, PDB_INDEX_SYMBOL_FUNCTION},
+};
+
+/**
+ * @brief Get a random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Map a file (read-only)
+ *
+ * @param Path
+ * @param Size
+ *
+ * @return const VOID * NULL if it's not mapped
+ */
+static const VOID *
+TestMapFile(const CHAR * Path, UINT64 * Size)
+{
+    struct stat Stat;
+    VOID *      View;
+    int         File = open(Path, O_RDONLY);
+
+    if (File < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(File, &Stat) != 0 || Stat.st_size == 0)
+    {
+        close(File);
+        return NULL;
+    }
+
+    View = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+    close(File);
+
+    if (View == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    *Size = (UINT64)Stat.st_size;
+
+    return View;
+}
+
+/**
+ * @brief Build the index of a PDB file
+ *
+ * @param Pdb
+ * @param PdbSize
+ * @param IndexSize
+ *
+ * @return VOID * NULL if the PDB file is not valid
+ */
+static VOID *
+TestBuildIndex(const VOID * Pdb, UINT64 PdbSize, UINT32 * IndexSize)
+{
+    VOID * Index;
+
+    if (!PdbIndexGetRequiredSize(Pdb, PdbSize, IndexSize))
+    {
+        return NULL;
+    }
+
+    Index = malloc(*IndexSize);
+    TEST_CHECK(Index != NULL);
+
+    if (!PdbIndexBuild(Pdb, PdbSize, Index, *IndexSize))
+    {
+        free(Index);
+        return NULL;
+    }
+
+    return Index;
+}
+
+/**
+ * @brief Check all of the symbols of an index
+ *
+ * @param Index
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckSymbols(const VOID * Index)
+{
+    const PDB_INDEX_SYMBOL * Symbol;
+    CHAR                     Name[32];
+    CHAR                     LongName[3005];
+    UINT32                   Displacement;
+
+    TEST_CHECK(PdbIndexGetSymbolCount(Index) == TEST_SYMBOL_COUNT);
+
+    for (UINT32 i = 0; i < sizeof(g_TestSymbols) / sizeof(g_TestSymbols[0]); i++)
+    {
+        Symbol = PdbIndexFindByName(Index, g_TestSymbols[i].Name);
+
+        TEST_CHECK(Symbol != NULL);
+        TEST_CHECK(Symbol->Rva == g_TestSymbols[i].Rva);
+        TEST_CHECK(Symbol->Size == g_TestSymbols[i].Size);
+        TEST_CHECK(Symbol->Kind == g_TestSymbols[i].Kind);
+        TEST_CHECK(strcmp(PdbIndexGetSymbolName(Index, Symbol), g_TestSymbols[i].Name) == 0);
+    }
+
+    //
+    // The names are case-insensitive (like DbgHelp)
+    //
+    Symbol = PdbIndexFindByName(Index, "NTCREATEFILE");
+    TEST_CHECK(Symbol != NULL && Symbol->Rva == 0x1100);
+
+    //
+    // The long name crosses the blocks of the fixture
+    //
+    memcpy(LongName, "Long", 4);
+    memset(&LongName[4], 'x', 3000);
+    LongName[3004] = '\0';
+
+    Symbol = PdbIndexFindByName(Index, LongName);
+    TEST_CHECK(Symbol != NULL && Symbol->Rva == 0x1300);
+
+    LongName[3003] = '\0';
+    TEST_CHECK(PdbIndexFindByName(Index, LongName) == NULL);
+
+    //
+    // The absolute symbols, the types and the partial names are not found
+    //
+    TEST_CHECK(PdbIndexFindByName(Index, "AbsoluteSymbol") == NULL);
+    TEST_CHECK(PdbIndexFindByName(Index, "SkipMe") == NULL);
+    TEST_CHECK(PdbIndexFindByName(Index, "NtCreate") == NULL);
+    TEST_CHECK(PdbIndexFindByName(Index, "") == NULL);
+
+    for (UINT32 i = 0; i < TEST_SYNTHETIC_COUNT; i++)
+    {
+        sprintf(Name, "Sym%05u", i);
+
+        Symbol = PdbIndexFindByName(Index, Name);
+        TEST_CHECK(Symbol != NULL && Symbol->Rva == TEST_SYNTHETIC_RVA + i * TEST_SYNTHETIC_STEP);
+        TEST_CHECK(Symbol->Kind == PDB_INDEX_SYMBOL_PUBLIC);
+
+        Symbol = PdbIndexFindByRva(Index, TEST_SYNTHETIC_RVA + i * TEST_SYNTHETIC_STEP + 5, &Displacement);
+        TEST_CHECK(Symbol != NULL && strcmp(PdbIndexGetSymbolName(Index, Symbol), Name) == 0 && Displacement == 5);
+    }
+
+    //
+    // The addresses are converted to the nearest symbols
+    //
+    Symbol = PdbIndexFindByRva(Index, 0x1120, &Displacement);
+    TEST_CHECK(Symbol != NULL && Symbol->Rva == 0x1100 && Displacement == 0x20);
+    TEST_CHECK(strcmp(PdbIndexGetSymbolName(Index, Symbol), "NtCreateFile") == 0);
+
+    Symbol = PdbIndexFindByRva(Index, 0xa0040, &Displacement);
+    TEST_CHECK(Symbol != NULL && Displacement == 0x10);
+    TEST_CHECK(strcmp(PdbIndexGetSymbolName(Index, Symbol), "MiStaticHelper") == 0);
+
+    TEST_CHECK(PdbIndexFindByRva(Index, 0x10ff, &Displacement) == NULL);
+
+    //
+    // The symbols are sorted by their RVAs
+    //
+    for (UINT32 i = 1; i < PdbIndexGetSymbolCount(Index); i++)
+    {
+        TEST_CHECK(PdbIndexGetSymbol(Index, i - 1)->Rva <= PdbIndexGetSymbol(Index, i)->Rva);
+    }
+
+    TEST_CHECK(PdbIndexGetSymbol(Index, PdbIndexGetSymbolCount(Index)) == NULL);
+}
+
+/**
+ * @brief Test building the index and finding the symbols
+ *
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return VOID
+ */
+static VOID
+TestBuild(const VOID * Pdb, UINT64 PdbSize)
+{
+    PDB_INDEX_PDB_INFO PdbInfo;
+    VOID *             Index;
+    UINT32             IndexSize;
+
+    TEST_CHECK(PdbIndexGetPdbInfo(Pdb, PdbSize, &PdbInfo));
+    TEST_CHECK(PdbInfo.Signature == 0x5eed && PdbInfo.Age == 3 && PdbInfo.FileSize == PdbSize);
+
+    for (UINT32 i = 0; i < sizeof(PdbInfo.Guid); i++)
+    {
+        TEST_CHECK(PdbInfo.Guid[i] == i);
+    }
+
+    Index = TestBuildIndex(Pdb, PdbSize, &IndexSize);
+
+    TEST_CHECK(Index != NULL);
+    TEST_CHECK(PdbIndexValidate(Index, IndexSize, &PdbInfo));
+
+    TestCheckSymbols(Index);
+
+    //
+    // A smaller buffer is not used
+    //
+    TEST_CHECK(!PdbIndexBuild(Pdb, PdbSize, Index, IndexSize - 1));
+
+    free(Index);
+}
+
+/**
+ * @brief Test writing the index to a file and using the mapped index file
+ *
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return VOID
+ */
+static VOID
+TestPersistence(const VOID * Pdb, UINT64 PdbSize)
+{
+    PDB_INDEX_PDB_INFO PdbInfo;
+    PDB_INDEX_PDB_INFO OtherPdbInfo;
+    const VOID *       MappedIndex;
+    UINT8 *            Corrupted;
+    VOID *             Index;
+    UINT64             MappedIndexSize;
+    UINT32             IndexSize;
+    UINT32             Seed     = 0x5eed;
+    UINT32             Accepted = 0;
+    CHAR               Path[]   = "/tmp/pdb-index-test-XXXXXX";
+    int                File;
+
+    TEST_CHECK(PdbIndexGetPdbInfo(Pdb, PdbSize, &PdbInfo));
+
+    Index = TestBuildIndex(Pdb, PdbSize, &IndexSize);
+    TEST_CHECK(Index != NULL);
+
+    File = mkstemp(Path);
+    TEST_CHECK(File >= 0);
+    TEST_CHECK(write(File, Index, IndexSize) == (ssize_t)IndexSize);
+    close(File);
+
+    MappedIndex = TestMapFile(Path, &MappedIndexSize);
+    unlink(Path);
+
+    TEST_CHECK(MappedIndex != NULL && MappedIndexSize == IndexSize);
+    TEST_CHECK(PdbIndexValidate(MappedIndex, MappedIndexSize, &PdbInfo));
+
+    TestCheckSymbols(MappedIndex);
+
+    //
+    // The index of another PDB file (or another version) is not used
+    //
+    OtherPdbInfo = PdbInfo;
+    OtherPdbInfo.Age++;
+    TEST_CHECK(!PdbIndexValidate(MappedIndex, MappedIndexSize, &OtherPdbInfo));
+
+    OtherPdbInfo = PdbInfo;
+    OtherPdbInfo.Guid[15] ^= 1;
+    TEST_CHECK(!PdbIndexValidate(MappedIndex, MappedIndexSize, &OtherPdbInfo));
+
+    OtherPdbInfo = PdbInfo;
+    OtherPdbInfo.FileSize++;
+    TEST_CHECK(!PdbIndexValidate(MappedIndex, MappedIndexSize, &OtherPdbInfo));
+
+    //
+    // The truncated index files are not used
+    //
+    TEST_CHECK(!PdbIndexValidate(MappedIndex, MappedIndexSize - 1, &PdbInfo));
+    TEST_CHECK(!PdbIndexValidate(MappedIndex, sizeof(PDB_INDEX_HEADER) - 1, NULL));
+
+    //
+    // The corrupted index files are either not used or they're safe to be
+    // used (e.g., only a name or an RVA is changed)
+    //
+    Corrupted = (UINT8 *)malloc(IndexSize);
+    TEST_CHECK(Corrupted != NULL);
+
+    for (UINT32 i = 0; i < 2000; i++)
+    {
+        memcpy(Corrupted, Index, IndexSize);
+
+        for (UINT32 j = TestRandom(&Seed) % 4 + 1; j != 0; j--)
+        {
+            UINT32 Offset = TestRandom(&Seed) % (i % 2 == 0 ? IndexSize : sizeof(PDB_INDEX_HEADER) + 256);
+
+            Corrupted[Offset] ^= (UINT8)(1 << (TestRandom(&Seed) % 8));
+        }
+
+        if (PdbIndexValidate(Corrupted, IndexSize, NULL))
+        {
+            UINT32 Displacement;
+
+            Accepted++;
+
+            PdbIndexFindByName(Corrupted, "NtCreateFile");
+            PdbIndexFindByName(Corrupted, "Sym01234");
+            PdbIndexFindByRva(Corrupted, 0x1120, &Displacement);
+        }
+    }
+
+    printf("[*] %u of the 2000 corrupted index files were safe to be used\n", Accepted);
+
+    munmap((VOID *)MappedIndex, MappedIndexSize);
+    free(Corrupted);
+    free(Index);
+}
+
+/**
+ * @brief Test the corrupted (and truncated) PDB files
+ *
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return VOID
+ */
+static VOID
+TestCorruptedPdb(const VOID * Pdb, UINT64 PdbSize)
+{
+    PDB_INDEX_PDB_INFO PdbInfo;
+    UINT8 *            Corrupted;
+    VOID *             Index;
+    UINT32             IndexSize;
+    UINT32             Seed  = 0x1234;
+    UINT32             Built = 0;
+
+    TEST_CHECK(!PdbIndexGetPdbInfo(Pdb, 55, &PdbInfo));
+    TEST_CHECK(!PdbIndexGetRequiredSize(Pdb, 512, &IndexSize));
+    TEST_CHECK(!PdbIndexGetRequiredSize(Pdb, PdbSize / 2, &IndexSize));
+
+    Corrupted = (UINT8 *)malloc(PdbSize);
+    TEST_CHECK(Corrupted != NULL);
+
+    for (UINT32 i = 0; i < 300; i++)
+    {
+        memcpy(Corrupted, Pdb, PdbSize);
+
+        for (UINT32 j = TestRandom(&Seed) % 8 + 1; j != 0; j--)
+        {
+            Corrupted[TestRandom(&Seed) % PdbSize] ^= (UINT8)(1 << (TestRandom(&Seed) % 8));
+        }
+
+        //
+        // The superblock and the directory are corrupted more often
+        //
+        if (i % 3 == 0)
+        {
+            Corrupted[32 + TestRandom(&Seed) % 24] ^= (UINT8)(1 << (TestRandom(&Seed) % 8));
+        }
+
+        Index = TestBuildIndex(Corrupted, PdbSize, &IndexSize);
+
+        if (Index != NULL)
+        {
+            Built++;
+            TEST_CHECK(PdbIndexValidate(Index, IndexSize, NULL));
+            free(Index);
+        }
+    }
+
+    printf("[*] the index of %u of the 300 corrupted PDB files was built\n", Built);
+
+    free(Corrupted);
+}
+
+/**
+ * @brief The PDB files of the OMAP-translated binaries are not indexed (their
+ * addresses are not the RVAs of the image)
+ *
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return VOID
+ */
+static VOID
+TestOmapPdb(const VOID * Pdb, UINT64 PdbSize)
+{
+    //
+    // The optional debug header of the fixture (only the section headers
+    // stream is used)
+    //
+    static const UINT16 DebugHeader[11] = {0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 8, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff};
+    UINT16              Patched[11];
+    UINT8 *             Omap;
+    UINT32              IndexSize;
+    UINT64              Offset;
+
+    Omap = (UINT8 *)malloc(PdbSize);
+    TEST_CHECK(Omap != NULL);
+
+    memcpy(Omap, Pdb, PdbSize);
+
+    for (Offset = 0; Offset + sizeof(DebugHeader) <= PdbSize; Offset++)
+    {
+        if (memcmp(&Omap[Offset], DebugHeader, sizeof(DebugHeader)) == 0)
+        {
+            break;
+        }
+    }
+
+    TEST_CHECK(Offset + sizeof(DebugHeader) <= PdbSize);
+
+    //
+    // The OMAP to the source addresses (any stream) makes the PDB file not
+    // indexed, so the symbols are loaded by DbgHelp
+    //
+    memcpy(Patched, DebugHeader, sizeof(Patched));
+    Patched[PDB_INDEX_DBG_HEADER_OMAP_FROM_SOURCE] = 9;
+    memcpy(&Omap[Offset], Patched, sizeof(Patched));
+
+    TEST_CHECK(!PdbIndexGetRequiredSize(Omap, PdbSize, &IndexSize));
+
+    //
+    // The OMAP from the source addresses is not used for the RVAs
+    //
+    memcpy(Patched, DebugHeader, sizeof(Patched));
+    Patched[PDB_INDEX_DBG_HEADER_OMAP_FROM_SOURCE - 1] = 9;
+    memcpy(&Omap[Offset], Patched, sizeof(Patched));
+
+    TEST_CHECK(PdbIndexGetRequiredSize(Omap, PdbSize, &IndexSize));
+
+    free(Omap);
+}
+
+/**
+ * @brief Measure building the index and finding the symbols
+ *
+ * @param Pdb
+ * @param PdbSize
+ *
+ * @return VOID
+ */
+static VOID
+TestPerformance(const VOID * Pdb, UINT64 PdbSize)
+{
+    VOID * Index;
+    UINT32 IndexSize;
+    UINT32 Found = 0;
+    UINT64 Start;
+    UINT64 BuildTime;
+    UINT64 ValidateTime;
+    UINT64 FindTime;
+    CHAR   Names[TEST_SYNTHETIC_COUNT][16];
+
+    for (UINT32 i = 0; i < TEST_SYNTHETIC_COUNT; i++)
+    {
+        sprintf(Names[i], "sym%05u", i);
+    }
+
+    Start     = TestGetTime();
+    Index     = TestBuildIndex(Pdb, PdbSize, &IndexSize);
+    BuildTime = TestGetTime() - Start;
+
+    TEST_CHECK(Index != NULL);
+
+    Start = TestGetTime();
+    TEST_CHECK(PdbIndexValidate(Index, IndexSize, NULL));
+    ValidateTime = TestGetTime() - Start;
+
+    Start = TestGetTime();
+
+    for (UINT32 Round = 0; Round < 200; Round++)
+    {
+        for (UINT32 i = 0; i < TEST_SYNTHETIC_COUNT; i++)
+        {
+            Found += PdbIndexFindByName(Index, Names[i]) != NULL;
+        }
+    }
+
+    FindTime = TestGetTime() - Start;
+
+    TEST_CHECK(Found == 200 * TEST_SYNTHETIC_COUNT);
+
+    printf("[*] %u symbols, index: %u bytes, build: %llu us, validating the cached index: %llu us, "
+           "finding by name: %llu ns\n",
+           PdbIndexGetSymbolCount(Index),
+           IndexSize,
+           BuildTime / 1000,
+           ValidateTime / 1000,
+           FindTime / (200 * TEST_SYNTHETIC_COUNT));
+
+    free(Index);
+}
+
+int
+main(int argc, char ** argv)
+{
+    const VOID * Pdb;
+    UINT64       PdbSize;
+
+    Pdb = TestMapFile(argc > 1 ? argv[1] : "fixture.pdb", &PdbSize);
+
+    if (Pdb == NULL)
+    {
+        printf("[x] cannot map the fixture (generate it by make-fixture.py)\n");
+        return 1;
+    }
+
+    TestBuild(Pdb, PdbSize);
+    TestPersistence(Pdb, PdbSize);
+    TestCorruptedPdb(Pdb, PdbSize);
+    TestOmapPdb(Pdb, PdbSize);
+    TestPerformance(Pdb, PdbSize);
+
+    munmap((VOID *)Pdb, PdbSize);
+
+    printf("[+] all of the PDB index tests passed\n");
+
+    return 0;
+}
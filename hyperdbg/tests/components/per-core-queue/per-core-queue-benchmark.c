@@ -0,0 +1,297 @@
+/**
+ * @file per-core-queue-benchmark.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Benchmark of the per-core lock-free queues against a locked ring
+ * @details Producer threads (1 to 64) write small records while a single
+ * consumer merges them, the result is compared with all producers writing to
+ * one ring buffer that is protected by a spinlock (the same as the global
+ * logging lock). The order of the records of each producer and the global
+ * sequence numbers are checked as well. Build and run it from this directory:
+ *
+ *   gcc -O2 -pthread -I. -I../../../include -o per-core-queue-benchmark \
+ *       per-core-queue-benchmark.c ../../../include/components/percorequeue/code/PerCoreQueue.c \
+ *       ../../../include/components/ringbuffer/code/RingBuffer.c
+ *   ./per-core-queue-benchmark
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum number of producer threads
+ *
+ */
+#define BENCHMARK_MAXIMUM_THREADS 64
+
+/**
+ * @brief Number of records that are written in each run (by all producers)
+ *
+ */
+#define BENCHMARK_TOTAL_RECORDS (1 << 22)
+
+/**
+ * @brief Length of the body of the records (a short message)
+ *
+ */
+#define BENCHMARK_RECORD_LENGTH 24
+
+/**
+ * @brief Size of the queue of each producer
+ *
+ */
+#define BENCHMARK_QUEUE_SIZE (32 * 4096)
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define BENCHMARK_CHECK(Condition)                                                   \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+PER_CORE_QUEUES    g_Queues;
+RING_BUFFER        g_Ring;
+pthread_spinlock_t g_RingLock;
+BOOLEAN            g_UsePerCoreQueues;
+UINT32             g_RecordsPerThread;
+volatile UINT32    g_StartedProducers;
+volatile UINT32    g_FinishedProducers;
+volatile UINT32    g_StartProducers;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+BenchmarkGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Producer thread, writes records with increasing local sequences
+ *
+ * @param Parameter Index of the producer (and its queue)
+ * @return PVOID
+ */
+static PVOID
+BenchmarkProducer(PVOID Parameter)
+{
+    UINT32 Producer = (UINT32)(UINT64)Parameter;
+    UINT8  Record[BENCHMARK_RECORD_LENGTH];
+
+    memset(Record, (int)Producer, sizeof(Record));
+
+    __sync_add_and_fetch(&g_StartedProducers, 1);
+
+    while (!g_StartProducers)
+    {
+        sched_yield();
+    }
+
+    for (UINT32 Sequence = 0; Sequence < g_RecordsPerThread; Sequence++)
+    {
+        memcpy(Record, &Sequence, sizeof(UINT32));
+
+        if (g_UsePerCoreQueues)
+        {
+            PerCoreQueuesWrite(&g_Queues, Producer, Producer, Record, sizeof(Record));
+        }
+        else
+        {
+            pthread_spin_lock(&g_RingLock);
+            RingBufferWrite(&g_Ring, Producer, Record, sizeof(Record));
+            pthread_spin_unlock(&g_RingLock);
+        }
+    }
+
+    __sync_add_and_fetch(&g_FinishedProducers, 1);
+
+    return NULL;
+}
+
+/**
+ * @brief Read a record from the queues or the locked ring
+ *
+ * @param Producer
+ * @param Sequence The global sequence number (only for the queues)
+ * @param Record
+ * @return BOOLEAN
+ */
+static BOOLEAN
+BenchmarkRead(UINT32 * Producer, UINT64 * Sequence, UINT8 * Record)
+{
+    UINT32  Length;
+    BOOLEAN IsRead;
+
+    if (g_UsePerCoreQueues)
+    {
+        IsRead = PerCoreQueuesRead(&g_Queues, Producer, Sequence, Record, BENCHMARK_RECORD_LENGTH, &Length);
+    }
+    else
+    {
+        pthread_spin_lock(&g_RingLock);
+        IsRead = RingBufferRead(&g_Ring, Producer, Record, BENCHMARK_RECORD_LENGTH, &Length);
+        pthread_spin_unlock(&g_RingLock);
+
+        *Sequence = 0;
+    }
+
+    if (IsRead)
+    {
+        BENCHMARK_CHECK(Length == BENCHMARK_RECORD_LENGTH);
+    }
+
+    return IsRead;
+}
+
+/**
+ * @brief Run the producers and the consumer once
+ *
+ * @param ThreadCount
+ * @param UsePerCoreQueues
+ * @param ReceivedCount Number of records that the consumer received
+ * @return double Messages per second (written by the producers)
+ */
+static double
+BenchmarkRun(UINT32 ThreadCount, BOOLEAN UsePerCoreQueues, UINT64 * ReceivedCount)
+{
+    pthread_t Producers[BENCHMARK_MAXIMUM_THREADS];
+    INT64     LastLocalSequence[BENCHMARK_MAXIMUM_THREADS];
+    UINT64    LastGlobalSequence[BENCHMARK_MAXIMUM_THREADS] = {0};
+    UINT8     Record[BENCHMARK_RECORD_LENGTH];
+    UINT32    Producer;
+    UINT32    LocalSequence;
+    UINT64    Sequence;
+    UINT64    StartTime;
+    UINT64    EndTime = 0;
+
+    g_UsePerCoreQueues  = UsePerCoreQueues;
+    g_RecordsPerThread  = BENCHMARK_TOTAL_RECORDS / ThreadCount;
+    g_StartedProducers  = 0;
+    g_FinishedProducers = 0;
+    g_StartProducers    = 0;
+    *ReceivedCount      = 0;
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        LastLocalSequence[i] = -1;
+        BENCHMARK_CHECK(pthread_create(&Producers[i], NULL, BenchmarkProducer, (PVOID)(UINT64)i) == 0);
+    }
+
+    while (g_StartedProducers != ThreadCount)
+    {
+        sched_yield();
+    }
+
+    StartTime        = BenchmarkGetTime();
+    g_StartProducers = 1;
+
+    for (;;)
+    {
+        BOOLEAN Finished = g_FinishedProducers == ThreadCount;
+
+        if (Finished && EndTime == 0)
+        {
+            EndTime = BenchmarkGetTime();
+        }
+
+        if (!BenchmarkRead(&Producer, &Sequence, Record))
+        {
+            if (Finished)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        //
+        // The records of each producer are in order
+        //
+        BENCHMARK_CHECK(Producer < ThreadCount);
+
+        memcpy(&LocalSequence, Record, sizeof(UINT32));
+
+        BENCHMARK_CHECK((INT64)LocalSequence > LastLocalSequence[Producer]);
+        BENCHMARK_CHECK(!UsePerCoreQueues || Sequence > LastGlobalSequence[Producer]);
+
+        LastLocalSequence[Producer]  = LocalSequence;
+        LastGlobalSequence[Producer] = Sequence;
+        (*ReceivedCount)++;
+    }
+
+    for (UINT32 i = 0; i < ThreadCount; i++)
+    {
+        pthread_join(Producers[i], NULL);
+    }
+
+    return (double)g_RecordsPerThread * ThreadCount * 1e9 / (double)(EndTime - StartTime);
+}
+
+/**
+ * @brief Main function of the per-core queue benchmark
+ *
+ * @return int
+ */
+int
+main()
+{
+    UINT8 * QueuesBuffer = malloc(PerCoreQueuesGetRequiredSize(BENCHMARK_MAXIMUM_THREADS, BENCHMARK_QUEUE_SIZE));
+    UINT8 * RingBuffer   = malloc(BENCHMARK_QUEUE_SIZE);
+    UINT64  ReceivedLocked;
+    UINT64  ReceivedQueues;
+
+    BENCHMARK_CHECK(QueuesBuffer != NULL && RingBuffer != NULL);
+    BENCHMARK_CHECK(pthread_spin_init(&g_RingLock, PTHREAD_PROCESS_PRIVATE) == 0);
+
+    printf("%-8s %24s %24s\n", "threads", "locked ring (msg/s)", "per-core queues (msg/s)");
+
+    for (UINT32 ThreadCount = 1; ThreadCount <= BENCHMARK_MAXIMUM_THREADS; ThreadCount *= 2)
+    {
+        double Locked;
+        double Queues;
+
+        BENCHMARK_CHECK(RingBufferInitialize(&g_Ring, RingBuffer, BENCHMARK_QUEUE_SIZE));
+        Locked = BenchmarkRun(ThreadCount, FALSE, &ReceivedLocked);
+
+        BENCHMARK_CHECK(PerCoreQueuesInitialize(&g_Queues, QueuesBuffer, ThreadCount, BENCHMARK_QUEUE_SIZE));
+        Queues = BenchmarkRun(ThreadCount, TRUE, &ReceivedQueues);
+
+        //
+        // Every record is either received, overwritten (ring) or dropped (queues)
+        //
+        UINT64 Dropped = 0;
+
+        for (UINT32 i = 0; i < ThreadCount; i++)
+        {
+            Dropped += g_Queues.Queues[i].DroppedCount;
+        }
+
+        BENCHMARK_CHECK(ReceivedLocked + g_Ring.LostCount == (UINT64)g_RecordsPerThread * ThreadCount);
+        BENCHMARK_CHECK(PerCoreQueuesIsEmpty(&g_Queues));
+        BENCHMARK_CHECK(ReceivedQueues + Dropped == (UINT64)g_RecordsPerThread * ThreadCount);
+
+        printf("%-8u %24.0f %24.0f\n", ThreadCount, Locked, Queues);
+    }
+
+    free(QueuesBuffer);
+    free(RingBuffer);
+
+    return 0;
+}
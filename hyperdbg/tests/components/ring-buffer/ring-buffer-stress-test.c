@@ -0,0 +1,335 @@
+/**
+ * @file ring-buffer-stress-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Multi-threaded stress test of the variable-length record ring buffer
+ * @details The ring buffer component is platform-independent, so it's tested
+ * on Linux. Build and run it from this directory:
+ *
+ *   gcc -O2 -pthread -I. -I../../../include -o ring-buffer-stress-test \
+ *       ring-buffer-stress-test.c ../../../include/components/ringbuffer/code/RingBuffer.c
+ *   ./ring-buffer-stress-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of producer threads
+ *
+ */
+#define TEST_PRODUCERS_COUNT 4
+
+/**
+ * @brief Number of records that each producer writes
+ *
+ */
+#define TEST_RECORDS_PER_PRODUCER 200000
+
+/**
+ * @brief Maximum length of the body of the records
+ *
+ */
+#define TEST_MAXIMUM_RECORD_LENGTH 300
+
+/**
+ * @brief Size of the ring buffer of the stress test (not aligned on purpose)
+ *
+ */
+#define TEST_RING_SIZE 4099
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+RING_BUFFER     g_Ring;
+pthread_mutex_t g_RingLock = PTHREAD_MUTEX_INITIALIZER;
+volatile UINT32 g_FinishedProducers;
+
+/**
+ * @brief Fill the body of a record based on its producer and sequence
+ *
+ * @param Buffer
+ * @param Producer
+ * @param Sequence
+ * @param Length
+ * @return VOID
+ */
+static VOID
+TestFillRecord(UINT8 * Buffer, UINT32 Producer, UINT32 Sequence, UINT32 Length)
+{
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Buffer[i] = (UINT8)(Producer * 31 + Sequence * 7 + i);
+    }
+
+    if (Length >= sizeof(UINT32))
+    {
+        memcpy(Buffer, &Sequence, sizeof(UINT32));
+    }
+}
+
+/**
+ * @brief Check the body of a record that is filled by TestFillRecord
+ *
+ * @param Buffer
+ * @param Producer
+ * @param Sequence
+ * @param Length
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestCheckRecord(UINT8 * Buffer, UINT32 Producer, UINT32 Sequence, UINT32 Length)
+{
+    UINT8 Expected[TEST_MAXIMUM_RECORD_LENGTH];
+
+    TestFillRecord(Expected, Producer, Sequence, Length);
+
+    return memcmp(Buffer, Expected, Length) == 0;
+}
+
+/**
+ * @brief Length of a record of a producer (deterministic, but mixed)
+ *
+ * @param Producer
+ * @param Sequence
+ * @return UINT32
+ */
+static UINT32
+TestRecordLength(UINT32 Producer, UINT32 Sequence)
+{
+    UINT32 Hash = (Sequence + 1) * 2654435761u ^ (Producer * 40503u);
+
+    return sizeof(UINT32) + (Hash >> 7) % (TEST_MAXIMUM_RECORD_LENGTH - sizeof(UINT32));
+}
+
+/**
+ * @brief Single-threaded tests of the wrap-around, overwrite and discard
+ *
+ * @return VOID
+ */
+static VOID
+TestSingleThreaded()
+{
+    RING_BUFFER Ring;
+    UINT8       Storage[104];
+    UINT8       Record[64];
+    UINT8       Read[64];
+    UINT32      OperationNumber;
+    UINT32      Length;
+    UINT32      Wrapped = 0;
+
+    TEST_CHECK(!RingBufferInitialize(&Ring, Storage, 4));
+    TEST_CHECK(RingBufferInitialize(&Ring, Storage, sizeof(Storage)));
+    TEST_CHECK(RingBufferIsEmpty(&Ring));
+    TEST_CHECK(!RingBufferRead(&Ring, &OperationNumber, Read, sizeof(Read), &Length));
+
+    //
+    // Records that are larger than the ring are rejected
+    //
+    TEST_CHECK(!RingBufferWrite(&Ring, 0, Record, sizeof(Storage)));
+
+    //
+    // Write and read records of all lengths, the bodies wrap around the end
+    //
+    for (UINT32 i = 0; i < 1000; i++)
+    {
+        UINT32 RecordLength = i % 60;
+        UINT32 BodyOffset   = (Ring.WriteOffset + sizeof(RING_BUFFER_RECORD_HEADER)) % Ring.Size;
+
+        if (BodyOffset + RecordLength > Ring.Size)
+        {
+            Wrapped++;
+        }
+
+        TestFillRecord(Record, 0, i, RecordLength);
+        TEST_CHECK(RingBufferWrite(&Ring, i, Record, RecordLength));
+        TEST_CHECK(!RingBufferIsEmpty(&Ring));
+
+        TEST_CHECK(RingBufferRead(&Ring, &OperationNumber, Read, sizeof(Read), &Length));
+        TEST_CHECK(OperationNumber == i && Length == RecordLength);
+        TEST_CHECK(TestCheckRecord(Read, 0, i, Length));
+        TEST_CHECK(RingBufferIsEmpty(&Ring) && Ring.UsedSize == 0);
+    }
+
+    TEST_CHECK(Wrapped != 0);
+
+    //
+    // The oldest records are overwritten once the ring is full
+    //
+    for (UINT32 i = 0; i < 100; i++)
+    {
+        TestFillRecord(Record, 0, i, 20);
+        TEST_CHECK(RingBufferWrite(&Ring, i, Record, 20));
+    }
+
+    TEST_CHECK(Ring.RecordCount == sizeof(Storage) / RING_BUFFER_RECORD_SIZE(20));
+    TEST_CHECK(Ring.LostCount + Ring.RecordCount == 100);
+    TEST_CHECK(RingBufferCheckIfFull(&Ring, 20));
+
+    for (UINT32 i = 100 - Ring.RecordCount; i < 100; i++)
+    {
+        TEST_CHECK(RingBufferRead(&Ring, &OperationNumber, Read, sizeof(Read), &Length));
+        TEST_CHECK(OperationNumber == i && Length == 20 && TestCheckRecord(Read, 0, i, Length));
+    }
+
+    TEST_CHECK(!RingBufferCheckIfFull(&Ring, 20));
+
+    //
+    // A small target buffer doesn't remove the record
+    //
+    TEST_CHECK(RingBufferWrite(&Ring, 1, Record, 30));
+    TEST_CHECK(!RingBufferRead(&Ring, &OperationNumber, Read, 29, &Length));
+    TEST_CHECK(Ring.RecordCount == 1);
+
+    //
+    // Discard all of the records
+    //
+    TEST_CHECK(RingBufferWrite(&Ring, 2, Record, 0));
+    TEST_CHECK(RingBufferDiscardAll(&Ring) == 2);
+    TEST_CHECK(RingBufferIsEmpty(&Ring) && Ring.UsedSize == 0);
+
+    printf("[*] single-threaded tests passed\n");
+}
+
+/**
+ * @brief Producer thread, writes records with increasing sequences
+ *
+ * @param Parameter Index of the producer
+ * @return PVOID
+ */
+static PVOID
+TestProducer(PVOID Parameter)
+{
+    UINT32 Producer = (UINT32)(UINT64)Parameter;
+    UINT8  Record[TEST_MAXIMUM_RECORD_LENGTH];
+
+    for (UINT32 Sequence = 0; Sequence < TEST_RECORDS_PER_PRODUCER; Sequence++)
+    {
+        UINT32 Length = TestRecordLength(Producer, Sequence);
+
+        TestFillRecord(Record, Producer, Sequence, Length);
+
+        pthread_mutex_lock(&g_RingLock);
+        TEST_CHECK(RingBufferWrite(&g_Ring, Producer, Record, Length));
+        pthread_mutex_unlock(&g_RingLock);
+
+        //
+        // Give the consumer a chance, otherwise almost all of the records
+        // are overwritten
+        //
+        if (Sequence % 16 == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    __sync_add_and_fetch(&g_FinishedProducers, 1);
+
+    return NULL;
+}
+
+/**
+ * @brief Multi-threaded test, producers write while one consumer reads
+ *
+ * @return VOID
+ */
+static VOID
+TestMultiThreaded()
+{
+    pthread_t Producers[TEST_PRODUCERS_COUNT];
+    UINT8 *   Storage = malloc(TEST_RING_SIZE);
+    UINT8     Read[TEST_MAXIMUM_RECORD_LENGTH];
+    INT64     LastSequence[TEST_PRODUCERS_COUNT];
+    UINT64    ReceivedCount = 0;
+    UINT32    OperationNumber;
+    UINT32    Length;
+    UINT32    Sequence;
+    BOOLEAN   IsRead;
+
+    TEST_CHECK(Storage != NULL);
+    TEST_CHECK(RingBufferInitialize(&g_Ring, Storage, TEST_RING_SIZE));
+
+    for (UINT32 i = 0; i < TEST_PRODUCERS_COUNT; i++)
+    {
+        LastSequence[i] = -1;
+        TEST_CHECK(pthread_create(&Producers[i], NULL, TestProducer, (PVOID)(UINT64)i) == 0);
+    }
+
+    for (;;)
+    {
+        BOOLEAN Finished = g_FinishedProducers == TEST_PRODUCERS_COUNT;
+
+        pthread_mutex_lock(&g_RingLock);
+        IsRead = RingBufferRead(&g_Ring, &OperationNumber, Read, sizeof(Read), &Length);
+        pthread_mutex_unlock(&g_RingLock);
+
+        if (!IsRead)
+        {
+            if (Finished)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        //
+        // Each record is intact and the records of each producer are in order
+        //
+        TEST_CHECK(OperationNumber < TEST_PRODUCERS_COUNT && Length >= sizeof(UINT32));
+
+        memcpy(&Sequence, Read, sizeof(UINT32));
+
+        TEST_CHECK((INT64)Sequence > LastSequence[OperationNumber]);
+        TEST_CHECK(Length == TestRecordLength(OperationNumber, Sequence));
+        TEST_CHECK(TestCheckRecord(Read, OperationNumber, Sequence, Length));
+
+        LastSequence[OperationNumber] = Sequence;
+        ReceivedCount++;
+    }
+
+    for (UINT32 i = 0; i < TEST_PRODUCERS_COUNT; i++)
+    {
+        pthread_join(Producers[i], NULL);
+    }
+
+    //
+    // Every record is either received or overwritten
+    //
+    TEST_CHECK(RingBufferIsEmpty(&g_Ring) && g_Ring.UsedSize == 0);
+    TEST_CHECK(ReceivedCount + g_Ring.LostCount == (UINT64)TEST_PRODUCERS_COUNT * TEST_RECORDS_PER_PRODUCER);
+
+    printf("[*] multi-threaded test passed (received: %llu, overwritten: %llu)\n",
+           ReceivedCount,
+           g_Ring.LostCount);
+
+    free(Storage);
+}
+
+/**
+ * @brief Main function of the ring buffer stress test
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestSingleThreaded();
+    TestMultiThreaded();
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Headers of the script engine tests (Linux)
+ * @details This header replaces both of the script-engine's and the
+ * libhyperdbg's pre-compiled headers, thus, the script engine (parser) and
+ * the script-eval (interpreters) are compiled the same as the user-mode
+ * without the Windows headers
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#define HYPERDBG_SCRIPT_ENGINE
+#define SCRIPT_ENGINE_USER_MODE
+#define HYPERDBG_USER_MODE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <wchar.h>
+#include <assert.h>
+#include <time.h>
+
+#define __int64 long long
+
+#include "SDK/headers/BasicTypes.h"
+
+typedef void * PVOID;
+typedef void * HANDLE;
+typedef long   LONG;
+typedef size_t SIZE_T;
+
+typedef struct _LIST_ENTRY
+{
+    struct _LIST_ENTRY * Flink;
+    struct _LIST_ENTRY * Blink;
+
+} LIST_ENTRY, *PLIST_ENTRY;
+
+//
+// Windows definitions that are used by the script engine
+//
+#define MAX_PATH      260
+#define MAXULONG64    ((UINT64) ~((UINT64)0))
+#define __declspec(x) /* nothing */
+#define _In_          /* nothing */
+#define _Out_         /* nothing */
+
+#define UNREFERENCED_PARAMETER(P)              (void)(P)
+#define RtlZeroMemory(Destination, Length)     memset((Destination), 0, (Length))
+#define _strdup                                strdup
+#define sprintf_s                              snprintf
+#define vsprintf_s(Buffer, Size, Format, Args) vsnprintf(Buffer, Size, Format, Args)
+
+#define InterlockedIncrement(Addend)                                   __atomic_add_fetch((Addend), 1, __ATOMIC_SEQ_CST)
+#define InterlockedIncrement64(Addend)                                 __atomic_add_fetch((Addend), 1, __ATOMIC_SEQ_CST)
+#define InterlockedDecrement64(Addend)                                 __atomic_sub_fetch((Addend), 1, __ATOMIC_SEQ_CST)
+#define InterlockedExchange(Target, Value)                             __atomic_exchange_n((Target), (Value), __ATOMIC_SEQ_CST)
+#define InterlockedExchange64(Target, Value)                           __atomic_exchange_n((Target), (Value), __ATOMIC_SEQ_CST)
+#define InterlockedExchangeAdd64(Addend, Value)                        __atomic_fetch_add((Addend), (Value), __ATOMIC_SEQ_CST)
+#define InterlockedCompareExchange(Destination, Exchange, Comperand)   __sync_val_compare_and_swap((Destination), (Comperand), (Exchange))
+#define InterlockedCompareExchange64(Destination, Exchange, Comperand) __sync_val_compare_and_swap((Destination), (Comperand), (Exchange))
+
+#include "Configuration.h"
+#include "Definition.h"
+#include "SDK/HyperDbgSdk.h"
+#include "SDK/imports/user/HyperDbgSymImports.h"
+
+//
+// Script engine (parser)
+//
+#include "common.h"
+#include "scanner.h"
+#include "globals.h"
+#include "script-engine.h"
+#include "parse-table.h"
+#include "type.h"
+#include "hardware.h"
+#include "optimizer.h"
+#include "SDK/imports/user/HyperDbgScriptImports.h"
+
+//
+// Script-eval (interpreters)
+//
+#include "../script-eval/header/ScriptEngineHeader.h"
+
+VOID
+ShowMessages(const char * Fmt, ...);
+
+//
+// Implemented by the tests (instead of libhyperdbg)
+//
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size);
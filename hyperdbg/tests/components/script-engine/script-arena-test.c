@@ -0,0 +1,525 @@
+/**
+ * @file script-arena-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the compilation arena of the script
+ * engine (the allocations of the compiler)
+ * @details The heap functions are wrapped by the linker, thus, the allocations
+ * of the arena and of the whole compilation are counted. Build and run it
+ * from this directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free,--wrap=strdup \
+ *       -o script-arena-test script-arena-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-arena-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of times each script is parsed in the benchmark
+ *
+ */
+#define BENCHMARK_ITERATIONS 200
+
+/**
+ * @brief Maximum number of heap allocations of parsing a script that are not
+ * related to the number of its tokens (the chunks of the arena, the symbol
+ * buffer and the tables of the 'main' function)
+ *
+ */
+#define TEST_MAX_ALLOCATIONS_PER_PARSE 32
+
+/**
+ * @brief Heap allocations of each user-defined function (the node, its name,
+ * its identifier tables and its map of the temporary variables)
+ *
+ */
+#define TEST_ALLOCATIONS_PER_FUNCTION 8
+
+/**
+ * @brief Heap allocations of each printf (the temporary symbol buffer of its
+ * arguments)
+ *
+ */
+#define TEST_ALLOCATIONS_PER_PRINTF 2
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+//////////////////////////////////////////////////
+//			   Wrapped heap functions           //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Number of the heap allocations (malloc, calloc, strdup and the
+ * reallocations of a NULL buffer)
+ *
+ */
+static UINT64 g_AllocationsCount;
+
+/**
+ * @brief Number of the live buffers of the heap
+ *
+ */
+static INT64 g_LiveCount;
+
+void * __real_malloc(size_t Size);
+void * __real_calloc(size_t Count, size_t Size);
+void * __real_realloc(void * Buffer, size_t Size);
+void   __real_free(void * Buffer);
+char * __real_strdup(const char * Str);
+
+void *
+__wrap_malloc(size_t Size)
+{
+    void * Buffer = __real_malloc(Size);
+
+    if (Buffer != NULL)
+    {
+        g_AllocationsCount++;
+        g_LiveCount++;
+    }
+
+    return Buffer;
+}
+
+void *
+__wrap_calloc(size_t Count, size_t Size)
+{
+    void * Buffer = __real_calloc(Count, Size);
+
+    if (Buffer != NULL)
+    {
+        g_AllocationsCount++;
+        g_LiveCount++;
+    }
+
+    return Buffer;
+}
+
+void *
+__wrap_realloc(void * Buffer, size_t Size)
+{
+    void * NewBuffer = __real_realloc(Buffer, Size);
+
+    if (Buffer == NULL && NewBuffer != NULL)
+    {
+        g_AllocationsCount++;
+        g_LiveCount++;
+    }
+
+    return NewBuffer;
+}
+
+void
+__wrap_free(void * Buffer)
+{
+    if (Buffer != NULL)
+    {
+        g_LiveCount--;
+    }
+
+    __real_free(Buffer);
+}
+
+char *
+__wrap_strdup(const char * Str)
+{
+    char * Buffer = __real_strdup(Str);
+
+    if (Buffer != NULL)
+    {
+        g_AllocationsCount++;
+        g_LiveCount++;
+    }
+
+    return Buffer;
+}
+
+//////////////////////////////////////////////////
+//			          Tests                     //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The scripts of the tests and the benchmark
+ *
+ */
+typedef struct _TEST_SCRIPT
+{
+    const char * Name;
+    char *       Buffer;
+    UINT32       MaxAllocations;
+
+} TEST_SCRIPT, *PTEST_SCRIPT;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Ignore the messages of the scripts (and the errors)
+ *
+ * @param Text
+ *
+ * @return int
+ */
+static int
+TestIgnoreMessage(const char * Text)
+{
+    (void)Text;
+
+    return 0;
+}
+
+/**
+ * @brief Repeat a statement (the %u of the statement is replaced by its index)
+ *
+ * @param Statement
+ * @param Count
+ *
+ * @return char *
+ */
+static char *
+TestRepeat(const char * Statement, UINT32 Count)
+{
+    size_t Size   = (strlen(Statement) + 16) * Count + 1;
+    char * Script = (char *)malloc(Size);
+    size_t Length = 0;
+
+    TEST_CHECK(Script != NULL);
+
+    Script[0] = '\0';
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Length += snprintf(&Script[Length], Size - Length, Statement, i, i);
+    }
+
+    return Script;
+}
+
+/**
+ * @brief Generate the scripts of the tests
+ *
+ * @param Scripts
+ *
+ * @return UINT32 number of the scripts
+ */
+static UINT32
+TestGenerateScripts(TEST_SCRIPT Scripts[4])
+{
+    Scripts[0].Name   = "mixed (100 statements)";
+    Scripts[0].Buffer = TestRepeat("x = @rax + 0x10 * $pid;\n"
+                                   "if (x > 5) { y = dq(@rsp + 8); } else { y = @rcx & 0xff; }\n"
+                                   "for (i = 0; i < 10; i++) { z = x ^ i; }\n"
+                                   "while (y != 0) { y = y >> 1; }\n"
+                                   ".g%u = x + y + z;\n",
+                                   20);
+    Scripts[0].MaxAllocations = TEST_MAX_ALLOCATIONS_PER_PARSE;
+
+    Scripts[1].Name   = "functions (20)";
+    Scripts[1].Buffer = TestRepeat("int func%u(int v) { if (v < 2) { return v; } return func%u(v - 1) + v; }\n", 20);
+    Scripts[1].MaxAllocations = TEST_MAX_ALLOCATIONS_PER_PARSE + 20 * TEST_ALLOCATIONS_PER_FUNCTION;
+
+    Scripts[2].Name   = "strings (100)";
+    Scripts[2].Buffer = TestRepeat("printf(\"value of the %%s number %u is %%llx\\n\", @r15, poi(@rcx + %u));\n", 100);
+    Scripts[2].MaxAllocations = TEST_MAX_ALLOCATIONS_PER_PARSE + 100 * TEST_ALLOCATIONS_PER_PRINTF;
+
+    Scripts[3].Name   = "1000 locals";
+    Scripts[3].Buffer = TestRepeat("var%u = @rax + 0n%u;\n", 1000);
+    Scripts[3].MaxAllocations = TEST_MAX_ALLOCATIONS_PER_PARSE;
+
+    return 4;
+}
+
+/**
+ * @brief Test the allocations of the arena
+ *
+ * @return VOID
+ */
+static VOID
+TestArena()
+{
+    UINT64 Allocations;
+    char * Buffer;
+    char * Heap;
+
+    //
+    // The inactive arena allocates zeroed buffers from the heap
+    //
+    TEST_CHECK(ArenaGetState()->IsActive == 0);
+
+    Allocations = g_AllocationsCount;
+    Heap        = (char *)ArenaAllocate(0x20);
+
+    TEST_CHECK(Heap != NULL && Heap[0] == 0 && Heap[0x1f] == 0);
+    TEST_CHECK(g_AllocationsCount == Allocations + 1);
+
+    //
+    // The active arena allocates zeroed and aligned buffers from its chunks,
+    // even if the same memory was used by a previous compilation
+    //
+    TEST_CHECK(ArenaSetActive(1) == 0);
+
+    for (UINT32 Round = 0; Round < 2; Round++)
+    {
+        Allocations = g_AllocationsCount;
+
+        for (UINT32 i = 1; i < 0x400; i++)
+        {
+            Buffer = (char *)ArenaAllocate(i);
+
+            TEST_CHECK(Buffer != NULL);
+            TEST_CHECK(((UINT64)Buffer & (SCRIPT_ENGINE_ARENA_ALIGNMENT - 1)) == 0);
+
+            for (UINT32 j = 0; j < i; j++)
+            {
+                TEST_CHECK(Buffer[j] == 0);
+            }
+
+            memset(Buffer, 0xcc, i);
+
+            //
+            // The buffers of the arena are not freed one by one
+            //
+            ArenaFree(Buffer);
+        }
+
+        TEST_CHECK(ArenaGetState()->AllocationCount == 0x3ff);
+
+        //
+        // The chunks grow geometrically, the second round reuses the largest
+        // chunk of the first round
+        //
+        TEST_CHECK(g_AllocationsCount - Allocations <= (Round == 0 ? 8 : 3));
+
+        ArenaReset();
+        TEST_CHECK(ArenaGetState()->IsActive == 0);
+        TEST_CHECK(ArenaGetState()->AllocationCount == 0 && ArenaGetState()->AllocatedBytes == 0);
+
+        ArenaSetActive(1);
+    }
+
+    //
+    // A buffer that is larger than the chunks has its own chunk
+    //
+    Buffer = (char *)ArenaAllocate(SCRIPT_ENGINE_ARENA_CHUNK_SIZE * 4);
+    TEST_CHECK(Buffer != NULL && Buffer[SCRIPT_ENGINE_ARENA_CHUNK_SIZE * 4 - 1] == 0);
+
+    ArenaReset();
+
+    //
+    // The buffers of the heap are freed by ArenaFree
+    //
+    INT64 Live = g_LiveCount;
+
+    ArenaFree(Heap);
+    TEST_CHECK(g_LiveCount == Live - 1);
+}
+
+/**
+ * @brief Compare two symbol buffers (only the characters of the strings are
+ * compared, not the rest of their last symbols)
+ *
+ * @param First
+ * @param Second
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestCompareSymbols(PSYMBOL_BUFFER First, PSYMBOL_BUFFER Second)
+{
+    if (First->Pointer != Second->Pointer)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < First->Pointer;)
+    {
+        PSYMBOL Symbol      = &First->Head[i];
+        PSYMBOL OtherSymbol = &Second->Head[i];
+
+        if (Symbol->Type != OtherSymbol->Type)
+        {
+            return FALSE;
+        }
+
+        if (Symbol->Type == SYMBOL_STRING_TYPE || Symbol->Type == SYMBOL_WSTRING_TYPE)
+        {
+            if (Symbol->Len != OtherSymbol->Len || memcmp(&Symbol->Value, &OtherSymbol->Value, Symbol->Len) != 0)
+            {
+                return FALSE;
+            }
+
+            i += GetSymbolHeapSize(Symbol);
+        }
+        else
+        {
+            if (Symbol->Len != OtherSymbol->Len || Symbol->Value != OtherSymbol->Value)
+            {
+                return FALSE;
+            }
+
+            i++;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Test the allocations of parsing the scripts
+ *
+ * @param Scripts
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+TestParse(TEST_SCRIPT * Scripts, UINT32 Count)
+{
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        PSYMBOL_BUFFER First = (PSYMBOL_BUFFER)ScriptEngineParse(Scripts[i].Buffer);
+        INT64          Live  = g_LiveCount;
+        UINT64         Allocations;
+
+        TEST_CHECK(First->Message == NULL);
+        TEST_CHECK(ArenaGetState()->IsActive == 0);
+
+        //
+        // Parsing again (on the memory of the previous compilation) gives the
+        // same symbols and the same number of allocations, and every buffer
+        // except the symbol buffer is released
+        //
+        for (UINT32 j = 0; j < 3; j++)
+        {
+            Allocations = g_AllocationsCount;
+
+            PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Scripts[i].Buffer);
+
+            TEST_CHECK(CodeBuffer->Message == NULL);
+            TEST_CHECK(CodeBuffer->Pointer == First->Pointer);
+            TEST_CHECK(TestCompareSymbols(CodeBuffer, First));
+            TEST_CHECK(g_AllocationsCount - Allocations <= Scripts[i].MaxAllocations);
+
+            RemoveSymbolBuffer(CodeBuffer);
+
+            TEST_CHECK(g_LiveCount == Live);
+        }
+
+        RemoveSymbolBuffer(First);
+    }
+
+    //
+    // The errors also release the buffers of the compilation
+    //
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse("x = 1; if (x > ) { y = 2; }");
+    INT64          Live;
+
+    TEST_CHECK(CodeBuffer->Message != NULL);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    Live       = g_LiveCount;
+    CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse("x = 1; if (x > ) { y = 2; }");
+
+    TEST_CHECK(CodeBuffer->Message != NULL);
+    TEST_CHECK(ArenaGetState()->IsActive == 0);
+
+    RemoveSymbolBuffer(CodeBuffer);
+    TEST_CHECK(g_LiveCount == Live);
+}
+
+/**
+ * @brief Benchmark the allocations and the time of parsing the scripts
+ *
+ * @param Scripts
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(TEST_SCRIPT * Scripts, UINT32 Count)
+{
+    printf("%-24s %16s %12s\n", "script", "allocations", "us/parse");
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        UINT64 Allocations = g_AllocationsCount;
+        UINT64 Start       = TestGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_ITERATIONS; j++)
+        {
+            PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Scripts[i].Buffer);
+
+            RemoveSymbolBuffer(CodeBuffer);
+        }
+
+        UINT64 Time = TestGetTime() - Start;
+
+        printf("%-24s %16.1f %12.1f\n",
+               Scripts[i].Name,
+               (double)(g_AllocationsCount - Allocations) / BENCHMARK_ITERATIONS,
+               (double)Time / BENCHMARK_ITERATIONS / 1000.0);
+    }
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TEST_SCRIPT Scripts[4];
+    UINT32      Count;
+
+    ScriptEngineSetTextMessageCallback((PVOID)TestIgnoreMessage);
+
+    Count = TestGenerateScripts(Scripts);
+
+    TestArena();
+    TestParse(Scripts, Count);
+
+    printf("[+] all of the script arena tests passed\n\n");
+
+    BenchmarkRun(Scripts, Count);
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        free(Scripts[i].Buffer);
+    }
+
+    return 0;
+}
@@ -0,0 +1,351 @@
+/**
+ * @file script-engine-stubs.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Functions that the script engine imports from libhyperdbg, the
+ * symbol parser and the pseudo-registers (Linux)
+ * @details The symbols are never loaded in the tests and the pseudo-registers
+ * return fixed values, thus, the results of the scripts are deterministic
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//
+// Global Variables (libhyperdbg)
+//
+UINT64             g_CurrentExprEvalResult;
+BOOLEAN            g_CurrentExprEvalResultHasError;
+SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
+
+/**
+ * @brief Check the address (the first page is not accessible the same as
+ * Windows)
+ *
+ * @param TargetAddress
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+CheckAccessValidityAndSafety(UINT64 TargetAddress, UINT32 Size)
+{
+    return TargetAddress >= 0x10000 && TargetAddress + Size > TargetAddress;
+}
+
+/**
+ * @brief Length disassembler is not available in the tests
+ *
+ * @param Address
+ * @param MaxLength
+ * @param Is32Bit
+ *
+ * @return UINT32
+ */
+UINT32
+HyperDbgLengthDisassemblerEngine(unsigned char * Address, UINT64 MaxLength, BOOLEAN Is32Bit)
+{
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(MaxLength);
+    UNREFERENCED_PARAMETER(Is32Bit);
+
+    return 0;
+}
+
+//////////////////////////////////////////////////
+//			         Spinlocks                  //
+//////////////////////////////////////////////////
+
+VOID
+SpinlockLock(volatile LONG * Lock)
+{
+    while (__atomic_exchange_n(Lock, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+    }
+}
+
+VOID
+SpinlockLockWithCustomWait(volatile LONG * Lock, unsigned MaxWait)
+{
+    UNREFERENCED_PARAMETER(MaxWait);
+
+    SpinlockLock(Lock);
+}
+
+VOID
+SpinlockUnlock(volatile LONG * Lock)
+{
+    __atomic_store_n(Lock, 0, __ATOMIC_RELEASE);
+}
+
+//////////////////////////////////////////////////
+//			    Pseudo-registers                //
+//////////////////////////////////////////////////
+
+UINT64
+ScriptEnginePseudoRegGetTid()
+{
+    return 0x1004;
+}
+
+UINT64
+ScriptEnginePseudoRegGetCore()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetPid()
+{
+    return 0x1000;
+}
+
+CHAR *
+ScriptEnginePseudoRegGetPname()
+{
+    return "test.exe";
+}
+
+UINT64
+ScriptEnginePseudoRegGetProc()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetThread()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetPeb()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetTeb()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetIp()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetBuffer(UINT64 * CorrespondingAction)
+{
+    UNREFERENCED_PARAMETER(CorrespondingAction);
+
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetEventTag(PACTION_BUFFER ActionBuffer)
+{
+    UNREFERENCED_PARAMETER(ActionBuffer);
+
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetEventId(PACTION_BUFFER ActionBuffer)
+{
+    UNREFERENCED_PARAMETER(ActionBuffer);
+
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetEventStage(PACTION_BUFFER ActionBuffer)
+{
+    UNREFERENCED_PARAMETER(ActionBuffer);
+
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetTime()
+{
+    return 0;
+}
+
+UINT64
+ScriptEnginePseudoRegGetDate()
+{
+    return 0;
+}
+
+//////////////////////////////////////////////////
+//			      Symbol parser                 //
+//////////////////////////////////////////////////
+
+VOID
+SymSetTextMessageCallback(PVOID Handler)
+{
+    UNREFERENCED_PARAMETER(Handler);
+}
+
+VOID
+SymbolAbortLoading()
+{
+}
+
+UINT64
+SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
+{
+    UNREFERENCED_PARAMETER(FunctionOrVariableName);
+
+    *WasFound = FALSE;
+    return 0;
+}
+
+UINT32
+SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName, const char * CustomModuleName)
+{
+    UNREFERENCED_PARAMETER(BaseAddress);
+    UNREFERENCED_PARAMETER(PdbFileName);
+    UNREFERENCED_PARAMETER(CustomModuleName);
+
+    return 0;
+}
+
+UINT32
+SymUnloadAllSymbols()
+{
+    return 0;
+}
+
+UINT32
+SymUnloadModuleSymbol(char * ModuleName)
+{
+    UNREFERENCED_PARAMETER(ModuleName);
+
+    return 0;
+}
+
+UINT32
+SymSearchSymbolForMask(const char * SearchMask)
+{
+    UNREFERENCED_PARAMETER(SearchMask);
+
+    return 0;
+}
+
+BOOLEAN
+SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, UINT32 * FieldOffset)
+{
+    UNREFERENCED_PARAMETER(TypeName);
+    UNREFERENCED_PARAMETER(FieldName);
+    UNREFERENCED_PARAMETER(FieldOffset);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymGetDataTypeSize(CHAR * TypeName, UINT64 * TypeSize)
+{
+    UNREFERENCED_PARAMETER(TypeName);
+    UNREFERENCED_PARAMETER(TypeSize);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymCreateSymbolTableForDisassembler(void * CallbackFunction)
+{
+    UNREFERENCED_PARAMETER(CallbackFunction);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymConvertFileToPdbPath(const char * LocalFilePath, char * ResultPath, size_t ResultPathSize)
+{
+    UNREFERENCED_PARAMETER(LocalFilePath);
+    UNREFERENCED_PARAMETER(ResultPath);
+    UNREFERENCED_PARAMETER(ResultPathSize);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath,
+                                            char *       PdbFilePath,
+                                            char *       GuidAndAgeDetails,
+                                            BOOLEAN      Is32BitModule)
+{
+    UNREFERENCED_PARAMETER(LocalFilePath);
+    UNREFERENCED_PARAMETER(PdbFilePath);
+    UNREFERENCED_PARAMETER(GuidAndAgeDetails);
+    UNREFERENCED_PARAMETER(Is32BitModule);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymbolInitLoad(PVOID        BufferToStoreDetails,
+               UINT32       StoredLength,
+               BOOLEAN      DownloadIfAvailable,
+               const char * SymbolPath,
+               BOOLEAN      IsSilentLoad)
+{
+    UNREFERENCED_PARAMETER(BufferToStoreDetails);
+    UNREFERENCED_PARAMETER(StoredLength);
+    UNREFERENCED_PARAMETER(DownloadIfAvailable);
+    UNREFERENCED_PARAMETER(SymbolPath);
+    UNREFERENCED_PARAMETER(IsSilentLoad);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymShowDataBasedOnSymbolTypes(const char * TypeName,
+                              UINT64       Address,
+                              BOOLEAN      IsStruct,
+                              PVOID        BufferAddress,
+                              const char * AdditionalParameters)
+{
+    UNREFERENCED_PARAMETER(TypeName);
+    UNREFERENCED_PARAMETER(Address);
+    UNREFERENCED_PARAMETER(IsStruct);
+    UNREFERENCED_PARAMETER(BufferAddress);
+    UNREFERENCED_PARAMETER(AdditionalParameters);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymQuerySizeof(const char * StructNameOrTypeName, UINT32 * SizeOfField)
+{
+    UNREFERENCED_PARAMETER(StructNameOrTypeName);
+    UNREFERENCED_PARAMETER(SizeOfField);
+
+    return FALSE;
+}
+
+BOOLEAN
+SymCastingQueryForFiledsAndTypes(const char * StructName,
+                                 const char * FiledOfStructName,
+                                 PBOOLEAN     IsStructNamePointerOrNot,
+                                 PBOOLEAN     IsFiledOfStructNamePointerOrNot,
+                                 char **      NewStructOrTypeName,
+                                 UINT32 *     OffsetOfFieldFromTop,
+                                 UINT32 *     SizeOfField)
+{
+    UNREFERENCED_PARAMETER(StructName);
+    UNREFERENCED_PARAMETER(FiledOfStructName);
+    UNREFERENCED_PARAMETER(IsStructNamePointerOrNot);
+    UNREFERENCED_PARAMETER(IsFiledOfStructNamePointerOrNot);
+    UNREFERENCED_PARAMETER(NewStructOrTypeName);
+    UNREFERENCED_PARAMETER(OffsetOfFieldFromTop);
+    UNREFERENCED_PARAMETER(SizeOfField);
+
+    return FALSE;
+}
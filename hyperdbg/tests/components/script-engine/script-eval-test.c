@@ -0,0 +1,634 @@
+/**
+ * @file script-eval-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the regular and the pre-decoded
+ * interpreters of the script engine
+ * @details Each statement is parsed once and executed by both of the
+ * interpreters from the same state (registers, memory, global variables and
+ * the stack), then the results, the states after the execution and the number
+ * of the executed instructions are compared. The state is reset before each
+ * execution (also in the benchmark) as the statements modify the variables and
+ * the memory. The test-case files of the script engine (the same format that
+ * is used by the '? test' command) can also be given as the arguments. Build
+ * and run it from this directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -o script-eval-test script-eval-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-eval-test [test-case files]
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of times each statement is executed in the benchmark
+ *
+ */
+#define BENCHMARK_ITERATIONS 1000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+extern UINT64  g_CurrentExprEvalResult;
+extern BOOLEAN g_CurrentExprEvalResultHasError;
+
+/**
+ * @brief A statement and its expected result
+ *
+ */
+typedef struct _TEST_CASE
+{
+    const char * Statement;
+    UINT64       ExpectedValue;
+    BOOLEAN      ExpectError;
+
+} TEST_CASE, *PTEST_CASE;
+
+/**
+ * @brief Everything that a statement can modify
+ *
+ */
+typedef struct _TEST_STATE
+{
+    GUEST_REGS Regs;
+    UINT64     GlobalVariables[MAX_VAR_COUNT];
+    UINT64     StackBuffer[MAX_STACK_BUFFER_COUNT];
+    UINT64     Memory[0x40];
+
+} TEST_STATE, *PTEST_STATE;
+
+/**
+ * @brief Result of executing a statement by one of the interpreters
+ *
+ */
+typedef struct _TEST_RESULT
+{
+    SCRIPT_ENGINE_DECODED_EXECUTION_STATUS Status;
+    UINT64                                 Value;
+    UINT64                                 ExecutedCount;
+
+} TEST_RESULT, *PTEST_RESULT;
+
+/**
+ * @brief The statements (the results are given to test_statement, the
+ * numbers of the scripts are hexadecimal unless they have the 0n prefix)
+ *
+ */
+static const TEST_CASE g_TestCases[] = {
+    //
+    // Operators
+    //
+    {"test_statement(1 + 2 * 3);", 7, FALSE},
+    {"test_statement((1 + 2) * 3);", 9, FALSE},
+    {"test_statement(0n100 / 0n7);", 0xe, FALSE},
+    {"test_statement(0n100 % 0n7);", 2, FALSE},
+    {"test_statement(0xf0 | 0x0f);", 0xff, FALSE},
+    {"test_statement(0xff & 0x3c);", 0x3c, FALSE},
+    {"test_statement(0xff ^ 0x0f);", 0xf0, FALSE},
+    {"test_statement(1 << 0n20);", 0x100000, FALSE},
+    {"test_statement(0x100000 >> 4);", 0x10000, FALSE},
+    {"test_statement(~0);", 0xffffffffffffffff, FALSE},
+    {"test_statement(-5 + 3);", 0xfffffffffffffffe, FALSE},
+    {"test_statement(0n10 - 0n20);", 0xfffffffffffffff6, FALSE},
+    {"test_statement(5 / 0);", 0, TRUE},
+    {"test_statement(5 % 0);", 0, TRUE},
+
+    //
+    // Registers and memory
+    //
+    {"test_statement(@rax + @rdx);", 4, FALSE},
+    {"@rbx = 0x55; test_statement(@rbx * 2);", 0xaa, FALSE},
+    {"test_statement(poi(@rsp));", 0x1122334455667788, FALSE},
+    {"test_statement(dw(@rsp + 8));", 0x4242, FALSE},
+    {"test_statement(db(@rsp + 8));", 0x42, FALSE},
+    {"eq(@rsp, 0x1234); test_statement(poi(@rsp));", 0x1234, FALSE},
+
+    //
+    // Variables
+    //
+    {".g1 = 0x10; .g2 = .g1 * 3; test_statement(.g2 - .g1);", 0x20, FALSE},
+    {".counter = 5; .counter = .counter + 1; .counter++; test_statement(.counter);", 7, FALSE},
+    {"x = 3; y = 4; z = x * x + y * y; test_statement(z);", 25, FALSE},
+    {"x = 7; x++; x++; x--; test_statement(x);", 8, FALSE},
+
+    //
+    // Conditions and loops
+    //
+    {"if (@rax == 1) { test_statement(0x11); } else { test_statement(0x22); }", 0x11, FALSE},
+    {"if (@rax > 1) { test_statement(0x11); } elsif (@rax < 1) { test_statement(0x22); } else { test_statement(0x33); }", 0x33, FALSE},
+    {"if (-1 < 0) { test_statement(1); } else { test_statement(2); }", 1, FALSE},
+    {"s = 0; for (i = 0; i < 0n100; i++) { s = s + i; } test_statement(s);", 0x1356, FALSE},
+    {"x = 1; while (x < 0x1000) { x = x << 1; } test_statement(x);", 0x1000, FALSE},
+    {"n = 0; do { n = n + 3; } while (n < 0n20); test_statement(n);", 21, FALSE},
+    {"t = 0; for (i = 0; i < 0n10; i++) { if (i % 2 == 0) { t = t + i; } } test_statement(t);", 20, FALSE},
+    {".sum = 0; for (i = 1; i <= 0n10; i++) { for (j = 1; j <= i; j++) { .sum = .sum + j; } } test_statement(.sum);", 220, FALSE},
+    {"while (1) { }", 0, TRUE},
+
+    //
+    // User-defined functions
+    //
+    {"int square(int v) { return v * v; } test_statement(square(9));", 81, FALSE},
+    {"int fact(int v) { if (v <= 1) { return 1; } return v * fact(v - 1); } test_statement(fact(0n10));", 0x375f00, FALSE},
+    {"int fib(int v) { if (v < 2) { return v; } return fib(v - 1) + fib(v - 2); } test_statement(fib(0n15));", 0x262, FALSE},
+    {"void setg(int v) { .result = v + 1; } setg(0x40); test_statement(.result);", 0x41, FALSE},
+    {"int deep(int v) { return deep(v + 1); } test_statement(deep(0));", 0, TRUE},
+
+    //
+    // Functions of the script engine
+    //
+    {"test_statement(strlen(@r15));", 13, FALSE},
+    {"test_statement(wcslen(@r14));", 5, FALSE},
+    {"test_statement(strcmp(@r15, \"Hello world !\"));", 0, FALSE},
+    {"test_statement($pid);", 0x1000, FALSE},
+    {"test_statement(interlocked_increment(@rsp));", 0x1122334455667789, FALSE},
+
+    //
+    // Syntax errors
+    //
+    {"test_statement(1 + );", 0, TRUE},
+    {"x = ;", 0, TRUE},
+};
+
+/**
+ * @brief The initial state of all of the statements
+ *
+ */
+static TEST_STATE g_InitialState;
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Ignore the messages of the scripts (and the errors)
+ *
+ * @param Text
+ *
+ * @return int
+ */
+static int
+TestIgnoreMessage(const char * Text)
+{
+    (void)Text;
+
+    return 0;
+}
+
+/**
+ * @brief Make the initial state (the same registers as '? test')
+ *
+ * @return VOID
+ */
+static VOID
+TestInitializeState()
+{
+    static char    String[]     = "Hello world !";
+    static wchar_t WideString[] = L"A B C";
+
+    memset(&g_InitialState, 0, sizeof(g_InitialState));
+
+    g_InitialState.Memory[0] = 0x1122334455667788;
+    g_InitialState.Memory[1] = 0x4242424242424242;
+
+    g_InitialState.Regs.rax = 0x1;
+    g_InitialState.Regs.rdx = 0x3;
+    g_InitialState.Regs.rbx = 0x4;
+    g_InitialState.Regs.rbp = 0x6;
+    g_InitialState.Regs.rsi = 0x7;
+    g_InitialState.Regs.rdi = 0x8;
+    g_InitialState.Regs.r14 = (UINT64)WideString;
+    g_InitialState.Regs.r15 = (UINT64)String;
+}
+
+/**
+ * @brief Reset the state of an interpreter before executing a statement
+ *
+ * @param State
+ * @param ScriptGeneralRegisters
+ *
+ * @return VOID
+ */
+static inline VOID
+TestResetState(PTEST_STATE State, PSCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters)
+{
+    memcpy(State, &g_InitialState, sizeof(TEST_STATE));
+
+    //
+    // The stack pointer points to the memory of this state
+    //
+    State->Regs.rsp = (UINT64)State->Memory;
+
+    ScriptGeneralRegisters->StackBuffer         = State->StackBuffer;
+    ScriptGeneralRegisters->GlobalVariablesList = State->GlobalVariables;
+    ScriptGeneralRegisters->StackIndx           = 0;
+    ScriptGeneralRegisters->StackBaseIndx       = 0;
+    ScriptGeneralRegisters->ReturnValue         = 0;
+
+    g_CurrentExprEvalResult         = 0;
+    g_CurrentExprEvalResultHasError = FALSE;
+}
+
+/**
+ * @brief Execute a statement by the regular interpreter (the same loop as
+ * the debuggee and libhyperdbg)
+ *
+ * @param CodeBuffer
+ * @param State
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestRunRegular(PSYMBOL_BUFFER CodeBuffer, PTEST_STATE State, PTEST_RESULT Result)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters;
+    ACTION_BUFFER                   ActionBuffer  = {0};
+    SYMBOL                          ErrorSymbol   = {0};
+    UINT64                          EXECUTENUMBER = 0;
+
+    TestResetState(State, &ScriptGeneralRegisters);
+
+    Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL;
+
+    for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+    {
+        if (ScriptEngineExecute(&State->Regs,
+                                &ActionBuffer,
+                                &ScriptGeneralRegisters,
+                                CodeBuffer,
+                                &i,
+                                &ErrorSymbol) == TRUE)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_ERROR;
+            break;
+        }
+        else if (ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW;
+            break;
+        }
+        else if (EXECUTENUMBER >= MAX_EXECUTION_COUNT)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT;
+            break;
+        }
+
+        EXECUTENUMBER++;
+    }
+
+    //
+    // The instruction that is checked in the last iteration is also executed
+    //
+    Result->ExecutedCount = Result->Status == SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL ? EXECUTENUMBER : EXECUTENUMBER + 1;
+    Result->Value         = g_CurrentExprEvalResult;
+}
+
+/**
+ * @brief Execute a statement by the pre-decoded interpreter
+ *
+ * @param CodeBuffer
+ * @param DecodedBuffer
+ * @param State
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestRunDecoded(PSYMBOL_BUFFER CodeBuffer, PSCRIPT_ENGINE_DECODED_BUFFER DecodedBuffer, PTEST_STATE State, PTEST_RESULT Result)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters;
+    ACTION_BUFFER                   ActionBuffer = {0};
+    SYMBOL                          ErrorSymbol  = {0};
+
+    TestResetState(State, &ScriptGeneralRegisters);
+
+    Result->Status = ScriptEngineExecuteDecoded(&State->Regs,
+                                                &ActionBuffer,
+                                                &ScriptGeneralRegisters,
+                                                CodeBuffer,
+                                                DecodedBuffer,
+                                                &ErrorSymbol,
+                                                &Result->ExecutedCount);
+    Result->Value  = g_CurrentExprEvalResult;
+}
+
+/**
+ * @brief Parse and pre-decode a statement
+ *
+ * @param Statement
+ * @param DecodedBuffer The pre-decoded buffer (NULL if there is a syntax error)
+ *
+ * @return PSYMBOL_BUFFER
+ */
+static PSYMBOL_BUFFER
+TestCompile(const char * Statement, PSCRIPT_ENGINE_DECODED_BUFFER * DecodedBuffer)
+{
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)Statement);
+    UINT32         DecodedBufferSize;
+
+    *DecodedBuffer = NULL;
+
+    if (CodeBuffer->Message != NULL)
+    {
+        return CodeBuffer;
+    }
+
+    DecodedBufferSize = ScriptEngineDecodeGetBufferSize(CodeBuffer);
+    *DecodedBuffer    = (PSCRIPT_ENGINE_DECODED_BUFFER)malloc(DecodedBufferSize);
+
+    TEST_CHECK(*DecodedBuffer != NULL);
+    TEST_CHECK(ScriptEngineDecode(CodeBuffer, *DecodedBuffer, DecodedBufferSize));
+
+    return CodeBuffer;
+}
+
+/**
+ * @brief Execute a statement by both of the interpreters and compare them
+ * with each other and with the expected result
+ *
+ * @param TestCase
+ *
+ * @return BOOLEAN whether the result was the expected one
+ */
+static BOOLEAN
+TestStatement(const TEST_CASE * TestCase)
+{
+    static TEST_STATE             RegularState;
+    static TEST_STATE             DecodedState;
+    TEST_RESULT                   Regular;
+    TEST_RESULT                   Decoded;
+    PSCRIPT_ENGINE_DECODED_BUFFER DecodedBuffer;
+    PSYMBOL_BUFFER                CodeBuffer = TestCompile(TestCase->Statement, &DecodedBuffer);
+    BOOLEAN                       IsPassed;
+
+    if (CodeBuffer->Message != NULL)
+    {
+        RemoveSymbolBuffer(CodeBuffer);
+        return TestCase->ExpectError;
+    }
+
+    TestRunRegular(CodeBuffer, &RegularState, &Regular);
+    TestRunDecoded(CodeBuffer, DecodedBuffer, &DecodedState, &Decoded);
+
+    //
+    // Both of the interpreters should reach the same state
+    //
+    TEST_CHECK(Regular.Status == Decoded.Status);
+    TEST_CHECK(Regular.ExecutedCount == Decoded.ExecutedCount);
+    TEST_CHECK(Regular.Value == Decoded.Value);
+    TEST_CHECK(memcmp(RegularState.GlobalVariables, DecodedState.GlobalVariables, sizeof(RegularState.GlobalVariables)) == 0);
+    TEST_CHECK(memcmp(RegularState.Memory, DecodedState.Memory, sizeof(RegularState.Memory)) == 0);
+
+    RegularState.Regs.rsp = DecodedState.Regs.rsp = 0;
+    TEST_CHECK(memcmp(&RegularState.Regs, &DecodedState.Regs, sizeof(GUEST_REGS)) == 0);
+
+    if (TestCase->ExpectError)
+    {
+        IsPassed = Regular.Status != SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL;
+    }
+    else
+    {
+        IsPassed = Regular.Status == SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL && Regular.Value == TestCase->ExpectedValue;
+    }
+
+    free(DecodedBuffer);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return IsPassed;
+}
+
+/**
+ * @brief Test the statements of this file
+ *
+ * @return VOID
+ */
+static VOID
+TestBuiltinStatements()
+{
+    for (UINT32 i = 0; i < sizeof(g_TestCases) / sizeof(g_TestCases[0]); i++)
+    {
+        if (!TestStatement(&g_TestCases[i]))
+        {
+            printf("[x] unexpected result: %s (%llx)\n", g_TestCases[i].Statement, (unsigned long long)g_CurrentExprEvalResult);
+            exit(1);
+        }
+    }
+}
+
+/**
+ * @brief Remove the new line characters of a line
+ *
+ * @param Line
+ *
+ * @return VOID
+ */
+static VOID
+TestTrimLine(char * Line)
+{
+    size_t Length = strlen(Line);
+
+    while (Length != 0 && (Line[Length - 1] == '\n' || Line[Length - 1] == '\r'))
+    {
+        Line[--Length] = '\0';
+    }
+}
+
+/**
+ * @brief Test the statements of a test-case file (the same format as the
+ * '? test' command)
+ *
+ * @param FileName
+ *
+ * @return VOID
+ */
+static VOID
+TestFile(const char * FileName)
+{
+    static char Number[0x100], Statement[0x4000], Expected[0x100], End[0x100];
+    TEST_CASE   TestCase;
+    UINT32      Passed = 0;
+    UINT32      Failed = 0;
+    FILE *      File   = fopen(FileName, "r");
+
+    TEST_CHECK(File != NULL);
+
+    while (fgets(Number, sizeof(Number), File) != NULL)
+    {
+        TEST_CHECK(fgets(Statement, sizeof(Statement), File) != NULL);
+        TEST_CHECK(fgets(Expected, sizeof(Expected), File) != NULL);
+        TEST_CHECK(fgets(End, sizeof(End), File) != NULL);
+
+        TestTrimLine(Number);
+        TestTrimLine(Statement);
+        TestTrimLine(Expected);
+        TestTrimLine(End);
+
+        TEST_CHECK(strcmp(End, "$end$") == 0);
+
+        //
+        // The same as '? test', a space is appended to the statement
+        //
+        strcat(Statement, " ");
+
+        TestCase.Statement     = Statement;
+        TestCase.ExpectError   = strcmp(Expected, "$error$") == 0;
+        TestCase.ExpectedValue = TestCase.ExpectError ? 0 : strtoull(Expected, NULL, 16);
+
+        if (TestStatement(&TestCase))
+        {
+            Passed++;
+        }
+        else
+        {
+            printf("[x] %s: test-case %s failed: %s\n", FileName, Number, Statement);
+            Failed++;
+        }
+    }
+
+    fclose(File);
+
+    printf("[%c] %s: %u passed, %u failed\n", Failed == 0 ? '+' : 'x', FileName, Passed, Failed);
+
+    TEST_CHECK(Failed == 0);
+}
+
+/**
+ * @brief Benchmark the interpreters on the statements of this file
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun()
+{
+    static TEST_STATE               State;
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters;
+    TEST_RESULT                     Result;
+    UINT64                          ResetTime       = 0;
+    UINT64                          RegularTime     = 0;
+    UINT64                          DecodedTime     = 0;
+    UINT64                          RegularCount    = 0;
+    UINT64                          DecodedCount    = 0;
+    UINT64                          StatementsCount = 0;
+    UINT64                          Start;
+
+    for (UINT32 i = 0; i < sizeof(g_TestCases) / sizeof(g_TestCases[0]); i++)
+    {
+        PSCRIPT_ENGINE_DECODED_BUFFER DecodedBuffer;
+        PSYMBOL_BUFFER                CodeBuffer = TestCompile(g_TestCases[i].Statement, &DecodedBuffer);
+
+        //
+        // The statements that have errors are not measured
+        //
+        if (CodeBuffer->Message == NULL && !g_TestCases[i].ExpectError)
+        {
+            StatementsCount++;
+
+            //
+            // The state is reset before each execution, the time of resetting
+            // is measured separately and is not counted
+            //
+            Start = TestGetTime();
+
+            for (UINT32 j = 0; j < BENCHMARK_ITERATIONS; j++)
+            {
+                TestResetState(&State, &ScriptGeneralRegisters);
+                __asm__ __volatile__(""
+                                     :
+                                     :
+                                     : "memory");
+            }
+
+            ResetTime += TestGetTime() - Start;
+
+            Start = TestGetTime();
+
+            for (UINT32 j = 0; j < BENCHMARK_ITERATIONS; j++)
+            {
+                TestRunRegular(CodeBuffer, &State, &Result);
+                RegularCount += Result.ExecutedCount;
+            }
+
+            RegularTime += TestGetTime() - Start;
+
+            Start = TestGetTime();
+
+            for (UINT32 j = 0; j < BENCHMARK_ITERATIONS; j++)
+            {
+                TestRunDecoded(CodeBuffer, DecodedBuffer, &State, &Result);
+                DecodedCount += Result.ExecutedCount;
+            }
+
+            DecodedTime += TestGetTime() - Start;
+        }
+
+        free(DecodedBuffer);
+        RemoveSymbolBuffer(CodeBuffer);
+    }
+
+    RegularTime = RegularTime > ResetTime ? RegularTime - ResetTime : 0;
+    DecodedTime = DecodedTime > ResetTime ? DecodedTime - ResetTime : 0;
+
+    printf("%llu statements x %u\n\n", (unsigned long long)StatementsCount, BENCHMARK_ITERATIONS);
+    printf("%-26s %16s %12s\n", "", "executed ops", "ns/op");
+    printf("%-26s %16llu %12.2f\n", "regular interpreter", (unsigned long long)RegularCount, (double)RegularTime / RegularCount);
+    printf("%-26s %16llu %12.2f\n", "pre-decoded interpreter", (unsigned long long)DecodedCount, (double)DecodedTime / DecodedCount);
+    printf("\nspeedup: %.2fx\n", ((double)RegularTime / RegularCount) / ((double)DecodedTime / DecodedCount));
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @param argc
+ * @param argv
+ *
+ * @return int
+ */
+int
+main(int argc, char * argv[])
+{
+    ScriptEngineSetTextMessageCallback((PVOID)TestIgnoreMessage);
+
+    TestInitializeState();
+
+    TestBuiltinStatements();
+
+    for (int i = 1; i < argc; i++)
+    {
+        TestFile(argv[i]);
+    }
+
+    printf("[+] all of the script interpreter tests passed\n\n");
+
+    BenchmarkRun();
+
+    return 0;
+}
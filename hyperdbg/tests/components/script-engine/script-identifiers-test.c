@@ -0,0 +1,378 @@
+/**
+ * @file script-identifiers-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of resolving the identifiers (variables and
+ * functions) of the scripts
+ * @details The scripts with many global and local variables are executed and
+ * the variables are compared with the same computation in C, thus, each name
+ * should be resolved to its own variable. Then the time of compiling scripts
+ * with 100, 1000 and 5000 variables is measured. Build and run it from this
+ * directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -o script-identifiers-test script-identifiers-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-identifiers-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the local variables that are executed (each of them is
+ * stored on the stack of the script)
+ *
+ */
+#define TEST_LOCAL_VARIABLES_COUNT 200
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief Global variables of the executed scripts
+ *
+ */
+static UINT64 g_GlobalVariables[MAX_VAR_COUNT];
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief A growing buffer of the generated script
+ *
+ */
+typedef struct _TEST_SCRIPT
+{
+    char * Buffer;
+    size_t Length;
+    size_t Size;
+
+} TEST_SCRIPT, *PTEST_SCRIPT;
+
+/**
+ * @brief Append a formatted statement to the script
+ *
+ * @param Script
+ * @param Fmt
+ *
+ * @return VOID
+ */
+static VOID
+TestAppend(PTEST_SCRIPT Script, const char * Fmt, ...)
+{
+    va_list Args;
+    int     Length;
+
+    if (Script->Size - Script->Length < 0x100)
+    {
+        Script->Size   = Script->Size * 2 + 0x1000;
+        Script->Buffer = (char *)realloc(Script->Buffer, Script->Size);
+
+        TEST_CHECK(Script->Buffer != NULL);
+    }
+
+    va_start(Args, Fmt);
+    Length = vsnprintf(&Script->Buffer[Script->Length], Script->Size - Script->Length, Fmt, Args);
+    va_end(Args);
+
+    TEST_CHECK(Length > 0 && (size_t)Length < Script->Size - Script->Length);
+
+    Script->Length += Length;
+}
+
+/**
+ * @brief Generate a script that defines the variables and then uses each of
+ * them
+ *
+ * @param Script
+ * @param Prefix '.' for the global variables and "" for the local variables
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+TestGenerateVariables(PTEST_SCRIPT Script, const char * Prefix, UINT32 Count)
+{
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        TestAppend(Script, "%svar%u = 0n%u;\n", Prefix, i, i);
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        TestAppend(Script, "%svar%u = %svar%u + %svar%u;\n", Prefix, i, Prefix, (i * 7) % Count, Prefix, (i * 13) % Count);
+    }
+}
+
+/**
+ * @brief Compute the variables of TestGenerateVariables in C
+ *
+ * @param Variables
+ * @param Count
+ *
+ * @return VOID
+ */
+static VOID
+TestComputeVariables(UINT64 * Variables, UINT32 Count)
+{
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Variables[i] = i;
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Variables[i] = Variables[(i * 7) % Count] + Variables[(i * 13) % Count];
+    }
+}
+
+/**
+ * @brief Parse and execute a script by the pre-decoded interpreter
+ *
+ * @param Script
+ *
+ * @return VOID
+ */
+static VOID
+TestExecute(const char * Script)
+{
+    static UINT64                   StackBuffer[MAX_STACK_BUFFER_COUNT];
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    GUEST_REGS                      Regs                   = {0};
+    ACTION_BUFFER                   ActionBuffer           = {0};
+    SYMBOL                          ErrorSymbol            = {0};
+    PSYMBOL_BUFFER                  CodeBuffer             = (PSYMBOL_BUFFER)ScriptEngineParse((char *)Script);
+    PSCRIPT_ENGINE_DECODED_BUFFER   DecodedBuffer;
+    UINT32                          DecodedBufferSize;
+
+    TEST_CHECK(CodeBuffer->Message == NULL);
+
+    DecodedBufferSize = ScriptEngineDecodeGetBufferSize(CodeBuffer);
+    DecodedBuffer     = (PSCRIPT_ENGINE_DECODED_BUFFER)malloc(DecodedBufferSize);
+
+    TEST_CHECK(DecodedBuffer != NULL);
+    TEST_CHECK(ScriptEngineDecode(CodeBuffer, DecodedBuffer, DecodedBufferSize));
+
+    memset(g_GlobalVariables, 0, sizeof(g_GlobalVariables));
+
+    ScriptGeneralRegisters.StackBuffer         = StackBuffer;
+    ScriptGeneralRegisters.GlobalVariablesList = g_GlobalVariables;
+
+    TEST_CHECK(ScriptEngineExecuteDecoded(&Regs,
+                                          &ActionBuffer,
+                                          &ScriptGeneralRegisters,
+                                          CodeBuffer,
+                                          DecodedBuffer,
+                                          &ErrorSymbol,
+                                          NULL) == SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL);
+
+    free(DecodedBuffer);
+    RemoveSymbolBuffer(CodeBuffer);
+}
+
+/**
+ * @brief Resolve as many global variables as the debuggee holds
+ *
+ * @return VOID
+ */
+static VOID
+TestGlobalVariables()
+{
+    static UINT64 Expected[MAX_VAR_COUNT];
+    TEST_SCRIPT   Script = {0};
+
+    TestGenerateVariables(&Script, ".", MAX_VAR_COUNT);
+    TestComputeVariables(Expected, MAX_VAR_COUNT);
+
+    TestExecute(Script.Buffer);
+
+    //
+    // The global variables are numbered in the order of their definitions
+    //
+    TEST_CHECK(memcmp(g_GlobalVariables, Expected, sizeof(Expected)) == 0);
+
+    free(Script.Buffer);
+}
+
+/**
+ * @brief Resolve the local variables (they are copied to the global variables
+ * to be compared), the global variables keep their indexes from the previous
+ * scripts
+ *
+ * @return VOID
+ */
+static VOID
+TestLocalVariables()
+{
+    UINT64      Expected[TEST_LOCAL_VARIABLES_COUNT];
+    TEST_SCRIPT Script = {0};
+
+    TestGenerateVariables(&Script, "", TEST_LOCAL_VARIABLES_COUNT);
+    TestComputeVariables(Expected, TEST_LOCAL_VARIABLES_COUNT);
+
+    for (UINT32 i = 0; i < TEST_LOCAL_VARIABLES_COUNT; i++)
+    {
+        TestAppend(&Script, ".var%u = var%u;\n", i, i);
+    }
+
+    TestExecute(Script.Buffer);
+
+    TEST_CHECK(memcmp(g_GlobalVariables, Expected, sizeof(Expected)) == 0);
+
+    free(Script.Buffer);
+}
+
+/**
+ * @brief The locals and the parameters of the functions are not mixed with
+ * the locals of the script nor with the other functions
+ *
+ * @return VOID
+ */
+static VOID
+TestFunctionsScope()
+{
+    TestExecute("int first(int var0) { var1 = var0 + 1; return var1; }\n"
+                "int second(int var1) { var0 = var1 * 2; return var0; }\n"
+                "var0 = 0x10; var1 = 0x20;\n"
+                ".var0 = first(2);\n"
+                ".var1 = second(3);\n"
+                ".var2 = var0;\n"
+                ".var3 = var1;\n"
+                ".var4 = first(second(first(0)));\n");
+
+    TEST_CHECK(g_GlobalVariables[0] == 3);
+    TEST_CHECK(g_GlobalVariables[1] == 6);
+    TEST_CHECK(g_GlobalVariables[2] == 0x10);
+    TEST_CHECK(g_GlobalVariables[3] == 0x20);
+    TEST_CHECK(g_GlobalVariables[4] == 3);
+}
+
+/**
+ * @brief Unknown variables and functions are still errors
+ *
+ * @return VOID
+ */
+static VOID
+TestUnresolved()
+{
+    static const char * Scripts[] = {
+        "var0 = 1; .var0 = var1;",
+        ".var0 = .unknown;",
+        "int first(int var0) { return var0; } .var0 = second(1);",
+        "int first(int var0) { return var0; } .var0 = var0;",
+    };
+
+    for (UINT32 i = 0; i < sizeof(Scripts) / sizeof(Scripts[0]); i++)
+    {
+        PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)Scripts[i]);
+
+        TEST_CHECK(CodeBuffer->Message != NULL);
+
+        RemoveSymbolBuffer(CodeBuffer);
+    }
+}
+
+/**
+ * @brief Benchmark compiling scripts with many variables
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun()
+{
+    static const UINT32 VariablesCount[] = {100, 1000, 5000};
+
+    for (UINT32 i = 0; i < sizeof(VariablesCount) / sizeof(VariablesCount[0]); i++)
+    {
+        TEST_SCRIPT Script = {0};
+        UINT64      Start;
+        UINT64      Time;
+
+        TestGenerateVariables(&Script, "", VariablesCount[i]);
+
+        Start = TestGetTime();
+
+        PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Script.Buffer);
+
+        Time = TestGetTime() - Start;
+
+        TEST_CHECK(CodeBuffer->Message == NULL);
+
+        //
+        // Each statement resolves one (definitions) or three variables
+        //
+        printf("compiling %-5u variables  : %.3f ms (%.1f ns per variable reference)\n",
+               VariablesCount[i],
+               (double)Time / 1000000.0,
+               (double)Time / (VariablesCount[i] * 4));
+
+        RemoveSymbolBuffer(CodeBuffer);
+        free(Script.Buffer);
+    }
+}
+
+/**
+ * @brief Ignore the messages of the scripts (and the errors)
+ *
+ * @param Text
+ *
+ * @return int
+ */
+static int
+TestIgnoreMessage(const char * Text)
+{
+    (void)Text;
+
+    return 0;
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    ScriptEngineSetTextMessageCallback((PVOID)TestIgnoreMessage);
+
+    TestGlobalVariables();
+    TestLocalVariables();
+    TestFunctionsScope();
+    TestUnresolved();
+
+    printf("[+] all of the script identifiers tests passed\n\n");
+
+    BenchmarkRun();
+
+    return 0;
+}
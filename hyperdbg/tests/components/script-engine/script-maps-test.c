@@ -0,0 +1,442 @@
+/**
+ * @file script-maps-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the aggregation maps of the script engine
+ * @details The tables of multiple cores are updated and merged directly, then
+ * the maps are used by the scripts (map_count, map_sum, map_min, map_max,
+ * hist, map_print and map_clear) and the printed results are compared. Build
+ * and run it from this directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -o script-maps-test script-maps-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-maps-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the cores of the maps that are merged
+ *
+ */
+#define TEST_CORE_COUNT 4
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+extern SCRIPT_ENGINE_MAPS g_ScriptEngineMaps;
+
+/**
+ * @brief The messages that are shown by the scripts (map_print)
+ *
+ */
+static char   g_Messages[0x4000];
+static size_t g_MessagesLength;
+
+/**
+ * @brief Keep the messages of the scripts
+ *
+ * @param Text
+ *
+ * @return int
+ */
+static int
+TestKeepMessage(const char * Text)
+{
+    size_t Length = strlen(Text);
+
+    TEST_CHECK(g_MessagesLength + Length < sizeof(g_Messages));
+
+    memcpy(&g_Messages[g_MessagesLength], Text, Length + 1);
+    g_MessagesLength += Length;
+
+    return 0;
+}
+
+/**
+ * @brief Allocate and initialize the maps
+ *
+ * @param Maps
+ * @param CoreCount
+ *
+ * @return VOID
+ */
+static VOID
+TestInitializeMaps(PSCRIPT_ENGINE_MAPS Maps, UINT32 CoreCount)
+{
+    PVOID Buffer = malloc((size_t)ScriptEngineMapsGetRequiredSize(CoreCount));
+
+    TEST_CHECK(Buffer != NULL);
+
+    ScriptEngineMapsInitialize(Maps, Buffer, CoreCount);
+}
+
+/**
+ * @brief Clear a map (the same as map_clear)
+ *
+ * @param Maps
+ * @param MapId
+ *
+ * @return VOID
+ */
+static VOID
+TestClearMap(PSCRIPT_ENGINE_MAPS Maps, UINT32 MapId)
+{
+    Maps->Generations[MapId]++;
+}
+
+/**
+ * @brief Get a merged entry of a map and check its line of the results
+ *
+ * @param Maps
+ * @param Index
+ * @param ExpectedLine
+ *
+ * @return PSCRIPT_ENGINE_MAP_ENTRY
+ */
+static PSCRIPT_ENGINE_MAP_ENTRY
+TestCheckEntry(PSCRIPT_ENGINE_MAPS Maps, UINT32 Index, const char * ExpectedLine)
+{
+    PSCRIPT_ENGINE_MAP_ENTRY Entry = &Maps->Tables[Maps->CoreCount].Entries[Index];
+    CHAR                     Line[SCRIPT_ENGINE_MAP_LINE_SIZE];
+
+    ScriptEngineMapFormatEntry(Entry, FALSE, Line);
+
+    if (strcmp(Line, ExpectedLine) != 0)
+    {
+        printf("[x] unexpected line: %s (instead of %s)\n", Line, ExpectedLine);
+        exit(1);
+    }
+
+    return Entry;
+}
+
+/**
+ * @brief Insert the keys in the table of a single core
+ *
+ * @return VOID
+ */
+static VOID
+TestInsert()
+{
+    SCRIPT_ENGINE_MAPS Maps;
+    UINT64             DroppedCount;
+
+    TestInitializeMaps(&Maps, 1);
+
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 9, SCRIPT_ENGINE_MAP_OPERATION_MIN, 0x10));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 9, SCRIPT_ENGINE_MAP_OPERATION_MIN, 2));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 9, SCRIPT_ENGINE_MAP_OPERATION_MAX, 0x20));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 7, SCRIPT_ENGINE_MAP_OPERATION_SUM, 3));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 7, SCRIPT_ENGINE_MAP_OPERATION_SUM, 4));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 0, 5, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0));
+
+    //
+    // The keys of the other maps are not mixed with this map
+    //
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 1, 7, SCRIPT_ENGINE_MAP_OPERATION_SUM, 0x100));
+
+    //
+    // The merged entries are sorted by their keys
+    //
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 0, &DroppedCount) == 3);
+    TEST_CHECK(DroppedCount == 0);
+
+    TestCheckEntry(&Maps, 0, "5: count: 1, sum: n/a, min: n/a, max: n/a\n");
+    TestCheckEntry(&Maps, 1, "7: count: 2, sum: 7, min: n/a, max: n/a\n");
+    TestCheckEntry(&Maps, 2, "9: count: 3, sum: n/a, min: 2, max: 20\n");
+
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 1, &DroppedCount) == 1);
+    TestCheckEntry(&Maps, 0, "7: count: 1, sum: 100, min: n/a, max: n/a\n");
+
+    free(Maps.Tables);
+}
+
+/**
+ * @brief Merge the same keys from the tables of multiple cores
+ *
+ * @return VOID
+ */
+static VOID
+TestMergeCores()
+{
+    SCRIPT_ENGINE_MAPS Maps;
+    UINT64             DroppedCount;
+
+    TestInitializeMaps(&Maps, TEST_CORE_COUNT);
+
+    for (UINT32 Core = 0; Core < TEST_CORE_COUNT; Core++)
+    {
+        TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[Core], 2, 1, SCRIPT_ENGINE_MAP_OPERATION_SUM, Core + 1));
+        TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[Core], 2, 1, SCRIPT_ENGINE_MAP_OPERATION_MIN, 0x100 - Core));
+        TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[Core], 2, 1, SCRIPT_ENGINE_MAP_OPERATION_MAX, 0x200 + Core));
+    }
+
+    //
+    // A key that is only counted by a core and has a min on another core
+    // shows the min of the other core (and never the initial min)
+    //
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 2, 2, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0));
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[2], 2, 2, SCRIPT_ENGINE_MAP_OPERATION_MIN, 0x30));
+
+    //
+    // A key of a single core
+    //
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[3], 2, 0x1000, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0));
+
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 2, &DroppedCount) == 3);
+    TEST_CHECK(DroppedCount == 0);
+
+    TestCheckEntry(&Maps, 0, "1: count: c, sum: a, min: fd, max: 203\n");
+    TestCheckEntry(&Maps, 1, "2: count: 2, sum: n/a, min: 30, max: n/a\n");
+    TestCheckEntry(&Maps, 2, "1000: count: 1, sum: n/a, min: n/a, max: n/a\n");
+
+    //
+    // Merging again gives the same results (the tables of the cores are
+    // not modified)
+    //
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 2, &DroppedCount) == 3);
+    TestCheckEntry(&Maps, 0, "1: count: c, sum: a, min: fd, max: 203\n");
+
+    free(Maps.Tables);
+}
+
+/**
+ * @brief The maps that are never updated or are cleared have no entries
+ *
+ * @return VOID
+ */
+static VOID
+TestEmpty()
+{
+    SCRIPT_ENGINE_MAPS Maps;
+    UINT64             DroppedCount = 1;
+
+    TestInitializeMaps(&Maps, TEST_CORE_COUNT);
+
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 3, &DroppedCount) == 0);
+    TEST_CHECK(DroppedCount == 0);
+
+    for (UINT32 Core = 0; Core < TEST_CORE_COUNT; Core++)
+    {
+        TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[Core], 3, Core, SCRIPT_ENGINE_MAP_OPERATION_MIN, 1));
+    }
+
+    TestClearMap(&Maps, 3);
+
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 3, &DroppedCount) == 0);
+    TEST_CHECK(DroppedCount == 0);
+
+    //
+    // The slots of the cleared entries are reused and their previous values
+    // are not kept
+    //
+    TEST_CHECK(ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 3, 0, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0));
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 3, &DroppedCount) == 1);
+
+    TestCheckEntry(&Maps, 0, "0: count: 1, sum: n/a, min: n/a, max: n/a\n");
+
+    free(Maps.Tables);
+}
+
+/**
+ * @brief The updates that don't fit in the table are counted as dropped
+ *
+ * @return VOID
+ */
+static VOID
+TestDropped()
+{
+    SCRIPT_ENGINE_MAPS Maps;
+    UINT64             DroppedCount;
+    UINT64             Count      = 0;
+    UINT32             Inserted   = 0;
+    UINT32             Dropped    = 0;
+    UINT32             MergeCount = 0;
+
+    TestInitializeMaps(&Maps, 1);
+
+    for (UINT64 Key = 0; Key < SCRIPT_ENGINE_MAP_TABLE_CAPACITY * 2; Key++)
+    {
+        if (ScriptEngineMapUpdate(&Maps, &Maps.Tables[0], 4, Key, SCRIPT_ENGINE_MAP_OPERATION_COUNT, 0))
+        {
+            Inserted++;
+        }
+        else
+        {
+            Dropped++;
+        }
+    }
+
+    TEST_CHECK(Inserted <= SCRIPT_ENGINE_MAP_TABLE_CAPACITY);
+    TEST_CHECK(Dropped >= SCRIPT_ENGINE_MAP_TABLE_CAPACITY);
+
+    MergeCount = ScriptEngineMapMerge(&Maps, 4, &DroppedCount);
+
+    for (UINT32 i = 0; i < MergeCount; i++)
+    {
+        Count += Maps.Tables[1].Entries[i].Count;
+    }
+
+    TEST_CHECK(MergeCount == Inserted);
+    TEST_CHECK(Count == Inserted);
+    TEST_CHECK(DroppedCount == Dropped);
+
+    //
+    // The dropped updates of the previous generations are not counted
+    //
+    TestClearMap(&Maps, 4);
+
+    TEST_CHECK(ScriptEngineMapMerge(&Maps, 4, &DroppedCount) == 0);
+    TEST_CHECK(DroppedCount == 0);
+
+    free(Maps.Tables);
+}
+
+/**
+ * @brief Format the buckets of the histograms
+ *
+ * @return VOID
+ */
+static VOID
+TestHistogram()
+{
+    SCRIPT_ENGINE_MAP_ENTRY Entry = {0};
+    CHAR                    Line[SCRIPT_ENGINE_MAP_LINE_SIZE];
+
+    TEST_CHECK(ScriptEngineMapGetHistogramBucket(0) == 0);
+    TEST_CHECK(ScriptEngineMapGetHistogramBucket(1) == 1);
+    TEST_CHECK(ScriptEngineMapGetHistogramBucket(0x1000) == 13);
+    TEST_CHECK(ScriptEngineMapGetHistogramBucket(MAXULONG64) == 64);
+
+    Entry.Count = 3;
+
+    ScriptEngineMapFormatEntry(&Entry, TRUE, Line);
+    TEST_CHECK(strcmp(Line, "[0, 1): 3\n") == 0);
+
+    Entry.Key = 13;
+
+    ScriptEngineMapFormatEntry(&Entry, TRUE, Line);
+    TEST_CHECK(strcmp(Line, "[1000, 2000): 3\n") == 0);
+
+    Entry.Key = 64;
+
+    ScriptEngineMapFormatEntry(&Entry, TRUE, Line);
+    TEST_CHECK(strcmp(Line, "[8000000000000000, ffffffffffffffff): 3\n") == 0);
+}
+
+/**
+ * @brief Parse and execute a script by the regular interpreter and check
+ * its messages
+ *
+ * @param Script
+ * @param ExpectedMessages
+ *
+ * @return VOID
+ */
+static VOID
+TestScript(const char * Script, const char * ExpectedMessages)
+{
+    static UINT64                   StackBuffer[MAX_STACK_BUFFER_COUNT];
+    static UINT64                   GlobalVariables[MAX_VAR_COUNT];
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    GUEST_REGS                      Regs                   = {0};
+    ACTION_BUFFER                   ActionBuffer           = {0};
+    SYMBOL                          ErrorSymbol            = {0};
+    PSYMBOL_BUFFER                  CodeBuffer             = (PSYMBOL_BUFFER)ScriptEngineParse((char *)Script);
+
+    TEST_CHECK(CodeBuffer->Message == NULL);
+
+    ScriptGeneralRegisters.StackBuffer         = StackBuffer;
+    ScriptGeneralRegisters.GlobalVariablesList = GlobalVariables;
+
+    g_Messages[0]    = '\0';
+    g_MessagesLength = 0;
+
+    for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+    {
+        TEST_CHECK(ScriptEngineExecute(&Regs,
+                                       &ActionBuffer,
+                                       &ScriptGeneralRegisters,
+                                       CodeBuffer,
+                                       &i,
+                                       &ErrorSymbol) == FALSE);
+    }
+
+    if (strcmp(g_Messages, ExpectedMessages) != 0)
+    {
+        printf("[x] unexpected messages of %s:\n%s", Script, g_Messages);
+        exit(1);
+    }
+
+    RemoveSymbolBuffer(CodeBuffer);
+}
+
+/**
+ * @brief Use the maps by the functions of the scripts
+ *
+ * @return VOID
+ */
+static VOID
+TestScripts()
+{
+    TestInitializeMaps(&g_ScriptEngineMaps, 1);
+
+    TestScript("map_print(5);", "");
+
+    TestScript("map_count(5, 0n10); map_count(5, 0n10); map_min(5, 0n11, 3); map_min(5, 0n11, 1); "
+               "map_max(5, 0n12, 7); map_sum(5, 0n12, 7); map_print(5);",
+               "a: count: 2, sum: n/a, min: n/a, max: n/a\n"
+               "b: count: 2, sum: n/a, min: 1, max: n/a\n"
+               "c: count: 2, sum: 7, min: n/a, max: 7\n");
+
+    TestScript("map_clear(5); map_print(5);", "");
+
+    TestScript("hist(6, 0); hist(6, 5); hist(6, 6); hist(6, 0x1000); map_print(6);",
+               "[0, 1): 1\n"
+               "[4, 8): 2\n"
+               "[1000, 2000): 1\n");
+
+    free(g_ScriptEngineMaps.Tables);
+    memset(&g_ScriptEngineMaps, 0, sizeof(g_ScriptEngineMaps));
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    ScriptEngineSetTextMessageCallback((PVOID)TestKeepMessage);
+
+    TestInsert();
+    TestMergeCores();
+    TestEmpty();
+    TestDropped();
+    TestHistogram();
+    TestScripts();
+
+    printf("[+] all of the script maps tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,760 @@
+/**
+ * @file script-optimizer-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the optimizer of the symbol buffers
+ * @details Each statement is parsed, a copy of its symbol buffer is optimized
+ * and both of them are executed from the same state (registers, memory, global
+ * variables and the stack), then the results and the states after the
+ * execution are compared. Each rewrite of the optimizer (constant folding,
+ * copy propagation, dead-temp elimination and jump threading) has statements
+ * that should be rewritten and statements that should be kept. Build and run
+ * it from this directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -o script-optimizer-test script-optimizer-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-optimizer-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+extern UINT64  g_CurrentExprEvalResult;
+extern BOOLEAN g_CurrentExprEvalResultHasError;
+
+/**
+ * @brief A statement, its expected result and the operator that the optimizer
+ * should (or should not) remove from it
+ *
+ */
+typedef struct _TEST_CASE
+{
+    const char * Statement;
+    UINT64       ExpectedValue;
+    BOOLEAN      ExpectError;
+    UINT64       Operator;
+    BOOLEAN      IsRemoved;
+
+} TEST_CASE, *PTEST_CASE;
+
+/**
+ * @brief Everything that a statement can modify
+ *
+ */
+typedef struct _TEST_STATE
+{
+    GUEST_REGS Regs;
+    UINT64     GlobalVariables[MAX_VAR_COUNT];
+    UINT64     StackBuffer[MAX_STACK_BUFFER_COUNT];
+    UINT64     Memory[0x40];
+
+} TEST_STATE, *PTEST_STATE;
+
+/**
+ * @brief Result of executing a statement
+ *
+ */
+typedef struct _TEST_RESULT
+{
+    SCRIPT_ENGINE_DECODED_EXECUTION_STATUS Status;
+    UINT64                                 Value;
+    UINT64                                 ExecutedCount;
+
+} TEST_RESULT, *PTEST_RESULT;
+
+/**
+ * @brief The statements of each rewrite (the numbers of the scripts are
+ * hexadecimal unless they have the 0n prefix), IsRemoved means that the
+ * optimized buffer has fewer instructions of the operator, otherwise, it should
+ * have the same number of them
+ *
+ */
+static const TEST_CASE g_TestCases[] = {
+    //
+    // Constant folding
+    //
+    {"x = 2 + 3 * 4; test_statement(x);", 0xe, FALSE, FUNC_MUL, TRUE},
+    {"test_statement((0n100 / 0n7) % 3);", 2, FALSE, FUNC_DIV, TRUE},
+    {"test_statement((0n100 / 0n7) % 3);", 2, FALSE, FUNC_MOD, TRUE},
+    {"test_statement(~0 ^ 0xff);", 0xffffffffffffff00, FALSE, FUNC_NOT, TRUE},
+    {"if (-1 < 0) { test_statement(1); } else { test_statement(2); }", 1, FALSE, FUNC_LT, TRUE},
+    {"x = 0x10; y = x << 4; test_statement(y >> 2);", 0x40, FALSE, FUNC_ASL, TRUE},
+
+    //
+    // Constant folding (kept)
+    //
+    {"test_statement(5 / 0);", 0, TRUE, FUNC_DIV, FALSE},
+    {"test_statement(5 % 0);", 0, TRUE, FUNC_MOD, FALSE},
+    {"test_statement(@rax + 3);", 4, FALSE, FUNC_ADD, FALSE},
+    {"x = @rdx; test_statement(x * 2);", 6, FALSE, FUNC_MUL, FALSE},
+    {"x = 2; x = poi(@rsp); test_statement(x + 1);", 0x1122334455667789, FALSE, FUNC_ADD, FALSE},
+
+    //
+    // Copy propagation
+    //
+    {"x = @rax; y = x; z = y; test_statement(z + 1);", 2, FALSE, FUNC_MOV, TRUE},
+    {"x = 5; y = x; test_statement(y);", 5, FALSE, FUNC_MOV, TRUE},
+
+    //
+    // Copy propagation (kept), the source is modified after the copy, the
+    // address of the variable is taken, or the value comes from another block
+    //
+    {"x = @rax; y = x; x = 5; test_statement(y + x);", 6, FALSE, FUNC_ADD, FALSE},
+    {"x = 5; y = &x; eq(y, 6); test_statement(x + 1);", 7, FALSE, FUNC_ADD, FALSE},
+    {"x = 5; y = &x; x = 5; eq(y, 6); test_statement(x + 1);", 7, FALSE, FUNC_ADD, FALSE},
+    {"x = 5; y = &x; x = 5; eq(y, 6); z = x; test_statement(z + 1);", 7, FALSE, FUNC_ADD, FALSE},
+    {"int inc(int v) { x = v + 1; return x; } x = 3; y = inc(x); test_statement(x + y);", 7, FALSE, FUNC_ADD, FALSE},
+    {"i = 0; while (i < 5) { i++; } test_statement(i);", 5, FALSE, FUNC_LT, FALSE},
+
+    //
+    // Dead-temp elimination
+    //
+    {"x = 5; x = 6; test_statement(x);", 6, FALSE, FUNC_MOV, TRUE},
+    {"x = @rax + @rdx; x = 7; test_statement(x);", 7, FALSE, FUNC_ADD, TRUE},
+
+    //
+    // Dead-temp elimination (kept), the results are not used but the
+    // functions have side effects
+    //
+    {"eq(@rsp, 2 + 2); test_statement(poi(@rsp));", 4, FALSE, FUNC_EQ, FALSE},
+    {"x = interlocked_increment(@rsp); test_statement(poi(@rsp));", 0x1122334455667789, FALSE, FUNC_INTERLOCKED_INCREMENT, FALSE},
+    {"x = 5 / @rcx; test_statement(1);", 0, TRUE, FUNC_DIV, FALSE},
+    {".g = @rax + 1; test_statement(.g);", 2, FALSE, FUNC_ADD, FALSE},
+
+    //
+    // Jump threading and removing the unreachable code
+    //
+    {"if (0) { test_statement(1); } test_statement(2);", 2, FALSE, FUNC_JZ, TRUE},
+    {"if (5 > 3) { test_statement(1); } else { test_statement(2); }", 1, FALSE, FUNC_JZ, TRUE},
+    {"if (5 > 3) { test_statement(1); } else { test_statement(2); }", 1, FALSE, FUNC_TEST_STATEMENT, TRUE},
+    {"x = 0; for (i = 0; i < 3; i++) { if (i == 1) { x = x + 0x10; } } test_statement(x);", 0x10, FALSE, FUNC_EQUAL, FALSE},
+
+    //
+    // Jump threading (kept), the conditions are not constants
+    //
+    {"if (@rax) { test_statement(1); } else { test_statement(2); }", 1, FALSE, FUNC_JZ, FALSE},
+    {"n = 0; do { n = n + 3; } while (n < 0n20); test_statement(n);", 21, FALSE, FUNC_JNZ, FALSE},
+    {"while (@rcx) { } test_statement(3);", 3, FALSE, FUNC_JZ, FALSE},
+
+    //
+    // Everything together
+    //
+    {"s = 0; for (i = 0; i < 0n100; i++) { s = s + i; } test_statement(s);", 0x1356, FALSE, FUNC_LT, FALSE},
+    {".sum = 0; for (i = 1; i <= 0n10; i++) { for (j = 1; j <= i; j++) { .sum = .sum + j; } } test_statement(.sum);", 220, FALSE, FUNC_ELT, FALSE},
+    {"int fact(int v) { if (v <= 1) { return 1; } return v * fact(v - 1); } test_statement(fact(0n10));", 0x375f00, FALSE, FUNC_MUL, FALSE},
+    {"int fib(int v) { if (v < 2) { return v; } return fib(v - 1) + fib(v - 2); } test_statement(fib(0n15));", 0x262, FALSE, FUNC_ADD, FALSE},
+    {"void setg(int v) { .result = v + 1; } setg(0x40); test_statement(.result);", 0x41, FALSE, FUNC_ADD, FALSE},
+    {"test_statement(strcmp(@r15, \"Hello world !\"));", 0, FALSE, FUNC_STRCMP, FALSE},
+    {"int deep(int v) { return deep(v + 1); } test_statement(deep(0));", 0, TRUE, FUNC_ADD, FALSE},
+};
+
+/**
+ * @brief The binary and unary operators that are folded, the statements
+ * compute "@rbx operator @rcx" (or "operator @rcx"), the comparisons are only
+ * allowed in the conditions
+ *
+ */
+static const struct
+{
+    const char * Statement;
+    UINT64       Operator;
+
+} g_FoldedOperators[] = {
+    {"test_statement(@rbx + @rcx);", FUNC_ADD},
+    {"test_statement(@rbx - @rcx);", FUNC_SUB},
+    {"test_statement(@rbx * @rcx);", FUNC_MUL},
+    {"test_statement(@rbx / @rcx);", FUNC_DIV},
+    {"test_statement(@rbx % @rcx);", FUNC_MOD},
+    {"test_statement(@rbx | @rcx);", FUNC_OR},
+    {"test_statement(@rbx ^ @rcx);", FUNC_XOR},
+    {"test_statement(@rbx & @rcx);", FUNC_AND},
+    {"test_statement(@rbx >> @rcx);", FUNC_ASR},
+    {"test_statement(@rbx << @rcx);", FUNC_ASL},
+    {"if (@rbx > @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_GT},
+    {"if (@rbx < @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_LT},
+    {"if (@rbx >= @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_EGT},
+    {"if (@rbx <= @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_ELT},
+    {"if (@rbx == @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_EQUAL},
+    {"if (@rbx != @rcx) { test_statement(1); } else { test_statement(0); }", FUNC_NEQ},
+    {"test_statement(~@rcx);", FUNC_NOT},
+    {"test_statement(-@rcx);", FUNC_NEG},
+};
+
+/**
+ * @brief The values of the operands of the folded operators
+ *
+ */
+static const UINT64 g_FoldedValues[] = {
+    0,
+    1,
+    2,
+    5,
+    0x3f,
+    0x40,
+    0x41,
+    0x7fffffffffffffff,
+    0x8000000000000001,
+    0xfffffffffffffffe,
+    0xffffffffffffffff,
+};
+
+/**
+ * @brief The initial state of all of the statements
+ *
+ */
+static TEST_STATE g_InitialState;
+
+/**
+ * @brief Ignore the messages of the scripts (and the errors)
+ *
+ * @param Text
+ *
+ * @return int
+ */
+static int
+TestIgnoreMessage(const char * Text)
+{
+    (void)Text;
+
+    return 0;
+}
+
+/**
+ * @brief Make the initial state (the same registers as '? test')
+ *
+ * @return VOID
+ */
+static VOID
+TestInitializeState()
+{
+    static char    String[]     = "Hello world !";
+    static wchar_t WideString[] = L"A B C";
+
+    memset(&g_InitialState, 0, sizeof(g_InitialState));
+
+    g_InitialState.Memory[0] = 0x1122334455667788;
+    g_InitialState.Memory[1] = 0x4242424242424242;
+
+    g_InitialState.Regs.rax = 0x1;
+    g_InitialState.Regs.rdx = 0x3;
+    g_InitialState.Regs.rbx = 0x4;
+    g_InitialState.Regs.rbp = 0x6;
+    g_InitialState.Regs.rsi = 0x7;
+    g_InitialState.Regs.rdi = 0x8;
+    g_InitialState.Regs.r14 = (UINT64)WideString;
+    g_InitialState.Regs.r15 = (UINT64)String;
+}
+
+/**
+ * @brief Execute a symbol buffer by the regular interpreter (the same loop
+ * as the debuggee and libhyperdbg)
+ *
+ * @param CodeBuffer
+ * @param State The state before (initialized by the caller) and after the
+ * execution
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestRun(PSYMBOL_BUFFER CodeBuffer, PTEST_STATE State, PTEST_RESULT Result)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    ACTION_BUFFER                   ActionBuffer           = {0};
+    SYMBOL                          ErrorSymbol            = {0};
+    UINT64                          EXECUTENUMBER          = 0;
+
+    //
+    // The stack pointer points to the memory of this state
+    //
+    State->Regs.rsp = (UINT64)State->Memory;
+
+    ScriptGeneralRegisters.StackBuffer         = State->StackBuffer;
+    ScriptGeneralRegisters.GlobalVariablesList = State->GlobalVariables;
+
+    g_CurrentExprEvalResult         = 0;
+    g_CurrentExprEvalResultHasError = FALSE;
+
+    Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL;
+
+    for (UINT64 i = 0; i < CodeBuffer->Pointer;)
+    {
+        if (ScriptEngineExecute(&State->Regs,
+                                &ActionBuffer,
+                                &ScriptGeneralRegisters,
+                                CodeBuffer,
+                                &i,
+                                &ErrorSymbol) == TRUE)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_ERROR;
+            break;
+        }
+        else if (ScriptGeneralRegisters.StackIndx >= MAX_STACK_BUFFER_COUNT)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_STACK_OVERFLOW;
+            break;
+        }
+        else if (EXECUTENUMBER >= MAX_EXECUTION_COUNT)
+        {
+            Result->Status = SCRIPT_ENGINE_DECODED_EXECUTION_EXCEEDING_MAX_EXECUTION_COUNT;
+            break;
+        }
+
+        EXECUTENUMBER++;
+    }
+
+    Result->ExecutedCount = EXECUTENUMBER;
+    Result->Value         = g_CurrentExprEvalResult;
+}
+
+/**
+ * @brief Execute the optimized symbol buffer by the pre-decoded interpreter
+ * (the same as the debuggee)
+ *
+ * @param CodeBuffer
+ * @param State The state before (initialized by the caller) and after the
+ * execution
+ * @param Result
+ *
+ * @return VOID
+ */
+static VOID
+TestRunDecoded(PSYMBOL_BUFFER CodeBuffer, PTEST_STATE State, PTEST_RESULT Result)
+{
+    SCRIPT_ENGINE_GENERAL_REGISTERS ScriptGeneralRegisters = {0};
+    ACTION_BUFFER                   ActionBuffer           = {0};
+    SYMBOL                          ErrorSymbol            = {0};
+    UINT32                          DecodedBufferSize      = ScriptEngineDecodeGetBufferSize(CodeBuffer);
+    PSCRIPT_ENGINE_DECODED_BUFFER   DecodedBuffer          = (PSCRIPT_ENGINE_DECODED_BUFFER)malloc(DecodedBufferSize);
+
+    TEST_CHECK(DecodedBuffer != NULL);
+    TEST_CHECK(ScriptEngineDecode(CodeBuffer, DecodedBuffer, DecodedBufferSize));
+
+    State->Regs.rsp = (UINT64)State->Memory;
+
+    ScriptGeneralRegisters.StackBuffer         = State->StackBuffer;
+    ScriptGeneralRegisters.GlobalVariablesList = State->GlobalVariables;
+
+    g_CurrentExprEvalResult         = 0;
+    g_CurrentExprEvalResultHasError = FALSE;
+
+    Result->Status = ScriptEngineExecuteDecoded(&State->Regs,
+                                                &ActionBuffer,
+                                                &ScriptGeneralRegisters,
+                                                CodeBuffer,
+                                                DecodedBuffer,
+                                                &ErrorSymbol,
+                                                &Result->ExecutedCount);
+    Result->Value  = g_CurrentExprEvalResult;
+
+    free(DecodedBuffer);
+}
+
+/**
+ * @brief Compare the states after executing two symbol buffers
+ *
+ * @param State1
+ * @param State2
+ *
+ * @return VOID
+ */
+static VOID
+TestCompareStates(PTEST_STATE State1, PTEST_STATE State2)
+{
+    TEST_CHECK(memcmp(State1->GlobalVariables, State2->GlobalVariables, sizeof(State1->GlobalVariables)) == 0);
+    TEST_CHECK(memcmp(State1->Memory, State2->Memory, sizeof(State1->Memory)) == 0);
+
+    State1->Regs.rsp = State2->Regs.rsp = 0;
+    TEST_CHECK(memcmp(&State1->Regs, &State2->Regs, sizeof(GUEST_REGS)) == 0);
+}
+
+/**
+ * @brief Make an optimized copy of a symbol buffer
+ *
+ * @param CodeBuffer
+ *
+ * @return PSYMBOL_BUFFER
+ */
+static PSYMBOL_BUFFER
+TestOptimizeCopy(PSYMBOL_BUFFER CodeBuffer)
+{
+    PSYMBOL_BUFFER Optimized = (PSYMBOL_BUFFER)calloc(1, sizeof(SYMBOL_BUFFER));
+
+    TEST_CHECK(Optimized != NULL);
+
+    Optimized->Head    = (PSYMBOL)calloc(CodeBuffer->Size, sizeof(SYMBOL));
+    Optimized->Pointer = CodeBuffer->Pointer;
+    Optimized->Size    = CodeBuffer->Size;
+
+    TEST_CHECK(Optimized->Head != NULL);
+
+    memcpy(Optimized->Head, CodeBuffer->Head, CodeBuffer->Pointer * sizeof(SYMBOL));
+
+    TEST_CHECK(ScriptEngineOptimizeSymbolBuffer(Optimized));
+
+    //
+    // The optimizer never makes the buffer larger
+    //
+    TEST_CHECK(Optimized->Pointer <= CodeBuffer->Pointer);
+
+    return Optimized;
+}
+
+/**
+ * @brief Get the number of the symbols of an instruction (the operator and
+ * its operands)
+ *
+ * @param CodeBuffer
+ * @param Offset Offset of the operator
+ *
+ * @return UINT32
+ */
+static UINT32
+TestGetInstructionSize(PSYMBOL_BUFFER CodeBuffer, UINT32 Offset)
+{
+    UINT32 i = Offset + 1;
+
+    TEST_CHECK(CodeBuffer->Head[Offset].Type == SYMBOL_SEMANTIC_RULE_TYPE);
+
+    while (i < CodeBuffer->Pointer && CodeBuffer->Head[i].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+    {
+        if (CodeBuffer->Head[i].Type == SYMBOL_STRING_TYPE || CodeBuffer->Head[i].Type == SYMBOL_WSTRING_TYPE)
+        {
+            i += GetSymbolHeapSize(&CodeBuffer->Head[i]);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return i - Offset;
+}
+
+/**
+ * @brief Count the instructions of an operator
+ *
+ * @param CodeBuffer
+ * @param Operator
+ *
+ * @return UINT32
+ */
+static UINT32
+TestCountOperator(PSYMBOL_BUFFER CodeBuffer, UINT64 Operator)
+{
+    UINT32 Count = 0;
+
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i += TestGetInstructionSize(CodeBuffer, i))
+    {
+        if (CodeBuffer->Head[i].Value == Operator)
+        {
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Check that the jumps of the optimized buffer target the instructions
+ * and no jump targets an unconditional jump (they are threaded)
+ *
+ * @param CodeBuffer
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckJumps(PSYMBOL_BUFFER CodeBuffer)
+{
+    for (UINT32 i = 0; i < CodeBuffer->Pointer; i += TestGetInstructionSize(CodeBuffer, i))
+    {
+        UINT64 Operator = CodeBuffer->Head[i].Value;
+        UINT64 Target;
+
+        if (Operator != FUNC_JMP && Operator != FUNC_JZ && Operator != FUNC_JNZ)
+        {
+            continue;
+        }
+
+        Target = CodeBuffer->Head[i + 1].Value;
+
+        TEST_CHECK(Target <= CodeBuffer->Pointer);
+
+        if (Target < CodeBuffer->Pointer)
+        {
+            TEST_CHECK(CodeBuffer->Head[Target].Type == SYMBOL_SEMANTIC_RULE_TYPE);
+            TEST_CHECK(CodeBuffer->Head[Target].Value != FUNC_JMP);
+        }
+    }
+}
+
+/**
+ * @brief Execute a statement before and after the optimization and compare
+ * them with each other and with the expected result
+ *
+ * @param TestCase
+ *
+ * @return VOID
+ */
+static VOID
+TestStatement(const TEST_CASE * TestCase)
+{
+    static TEST_STATE OriginalState;
+    static TEST_STATE OptimizedState;
+    static TEST_STATE DecodedState;
+    TEST_RESULT       Original;
+    TEST_RESULT       Optimized;
+    TEST_RESULT       Decoded;
+    PSYMBOL_BUFFER    CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)TestCase->Statement);
+    PSYMBOL_BUFFER    OptimizedBuffer;
+    UINT32            OriginalCount;
+    UINT32            OptimizedCount;
+
+    TEST_CHECK(CodeBuffer->Message == NULL);
+
+    OptimizedBuffer = TestOptimizeCopy(CodeBuffer);
+
+    memcpy(&OriginalState, &g_InitialState, sizeof(TEST_STATE));
+    memcpy(&OptimizedState, &g_InitialState, sizeof(TEST_STATE));
+    memcpy(&DecodedState, &g_InitialState, sizeof(TEST_STATE));
+
+    TestRun(CodeBuffer, &OriginalState, &Original);
+    TestRun(OptimizedBuffer, &OptimizedState, &Optimized);
+    TestRunDecoded(OptimizedBuffer, &DecodedState, &Decoded);
+
+    //
+    // The optimized buffer has the same result by both of the interpreters
+    // and never executes more instructions
+    //
+    TEST_CHECK(Original.Status == Optimized.Status);
+    TEST_CHECK(Original.Value == Optimized.Value);
+    TEST_CHECK(Optimized.ExecutedCount <= Original.ExecutedCount);
+    TEST_CHECK(Decoded.Status == Optimized.Status);
+    TEST_CHECK(Decoded.Value == Optimized.Value);
+
+    if (TestCase->ExpectError)
+    {
+        TEST_CHECK(Original.Status != SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL);
+    }
+    else
+    {
+        TEST_CHECK(Original.Status == SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL);
+        TEST_CHECK(Original.Value == TestCase->ExpectedValue);
+    }
+
+    TestCompareStates(&OriginalState, &OptimizedState);
+    TestCompareStates(&DecodedState, &OptimizedState);
+
+    TestCheckJumps(OptimizedBuffer);
+
+    //
+    // Check the rewrite of this statement
+    //
+    OriginalCount  = TestCountOperator(CodeBuffer, TestCase->Operator);
+    OptimizedCount = TestCountOperator(OptimizedBuffer, TestCase->Operator);
+
+    if (TestCase->IsRemoved ? OptimizedCount >= OriginalCount : OptimizedCount != OriginalCount)
+    {
+        printf("[x] unexpected optimization: %s (%u -> %u instructions of %llu)\n",
+               TestCase->Statement,
+               OriginalCount,
+               OptimizedCount,
+               (unsigned long long)TestCase->Operator);
+        exit(1);
+    }
+
+    RemoveSymbolBuffer(OptimizedBuffer);
+    RemoveSymbolBuffer(CodeBuffer);
+}
+
+/**
+ * @brief Test the statements of each rewrite
+ *
+ * @return VOID
+ */
+static VOID
+TestRewrites()
+{
+    for (UINT32 i = 0; i < sizeof(g_TestCases) / sizeof(g_TestCases[0]); i++)
+    {
+        TestStatement(&g_TestCases[i]);
+    }
+}
+
+/**
+ * @brief Get the value of a register operand of the folded operators
+ *
+ * @param Symbol
+ * @param Src0 Value of rcx
+ * @param Src1 Value of rbx
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetOperandValue(PSYMBOL Symbol, UINT64 Src0, UINT64 Src1)
+{
+    TEST_CHECK(Symbol->Type == SYMBOL_REGISTER_TYPE);
+    TEST_CHECK(Symbol->Value == REGISTER_RCX || Symbol->Value == REGISTER_RBX);
+
+    return Symbol->Value == REGISTER_RCX ? Src0 : Src1;
+}
+
+/**
+ * @brief Compare the folded results of the operators with the interpreter
+ * (OptimizerFold gets the operands in the order of the symbol buffer)
+ *
+ * @return VOID
+ */
+static VOID
+TestFold()
+{
+    static TEST_STATE State;
+    TEST_RESULT       Result;
+
+    for (UINT32 i = 0; i < sizeof(g_FoldedOperators) / sizeof(g_FoldedOperators[0]); i++)
+    {
+        PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)g_FoldedOperators[i].Statement);
+        PSYMBOL        Instruction;
+        UINT32         OperandCount;
+        UINT32         j;
+
+        TEST_CHECK(CodeBuffer->Message == NULL);
+
+        //
+        // Find the instruction of the operator (after reserving the stack)
+        //
+        for (j = TestGetInstructionSize(CodeBuffer, 0); j < CodeBuffer->Pointer; j += TestGetInstructionSize(CodeBuffer, j))
+        {
+            if (CodeBuffer->Head[j].Value == g_FoldedOperators[i].Operator)
+            {
+                break;
+            }
+        }
+
+        TEST_CHECK(j < CodeBuffer->Pointer);
+
+        Instruction = &CodeBuffer->Head[j];
+
+        TEST_CHECK(OptimizerGetOperatorClass(Instruction->Value, &OperandCount) == OPTIMIZER_OPERATOR_VALUE);
+        TEST_CHECK(TestGetInstructionSize(CodeBuffer, j) == OperandCount + 1);
+
+        for (UINT32 k = 0; k < sizeof(g_FoldedValues) / sizeof(g_FoldedValues[0]); k++)
+        {
+            for (UINT32 m = 0; m < sizeof(g_FoldedValues) / sizeof(g_FoldedValues[0]); m++)
+            {
+                UINT64  Src0   = g_FoldedValues[k];
+                UINT64  Src1   = g_FoldedValues[m];
+                UINT64  Folded = 0;
+                BOOLEAN IsFolded;
+
+                IsFolded = OptimizerFold(Instruction->Value,
+                                         TestGetOperandValue(&Instruction[1], Src0, Src1),
+                                         OperandCount == 3 ? TestGetOperandValue(&Instruction[2], Src0, Src1) : 0,
+                                         &Folded);
+
+                //
+                // Division by zero and the shifts that are wider than the
+                // registers are not folded (they are kept for the runtime)
+                //
+                if ((Instruction->Value == FUNC_DIV || Instruction->Value == FUNC_MOD) && Src0 == 0)
+                {
+                    TEST_CHECK(!IsFolded);
+                    continue;
+                }
+
+                if ((Instruction->Value == FUNC_ASR || Instruction->Value == FUNC_ASL) && Src0 >= 64)
+                {
+                    TEST_CHECK(!IsFolded);
+                    continue;
+                }
+
+                TEST_CHECK(IsFolded);
+
+                memcpy(&State, &g_InitialState, sizeof(TEST_STATE));
+
+                State.Regs.rcx = Src0;
+                State.Regs.rbx = Src1;
+
+                TestRun(CodeBuffer, &State, &Result);
+
+                if (Result.Status != SCRIPT_ENGINE_DECODED_EXECUTION_SUCCESSFUL || Result.Value != Folded)
+                {
+                    printf("[x] unexpected folding: %s (rbx = %llx, rcx = %llx, %llx instead of %llx)\n",
+                           g_FoldedOperators[i].Statement,
+                           (unsigned long long)Src1,
+                           (unsigned long long)Src0,
+                           (unsigned long long)Folded,
+                           (unsigned long long)Result.Value);
+                    exit(1);
+                }
+            }
+        }
+
+        RemoveSymbolBuffer(CodeBuffer);
+    }
+
+    //
+    // The operators with side effects are never folded
+    //
+    TEST_CHECK(!OptimizerFold(FUNC_MOV, 1, 2, &Result.Value));
+    TEST_CHECK(!OptimizerFold(FUNC_INC, 1, 2, &Result.Value));
+    TEST_CHECK(!OptimizerFold(FUNC_POI, 1, 2, &Result.Value));
+}
+
+/**
+ * @brief The symbol buffers that can't be optimized are not modified
+ *
+ * @return VOID
+ */
+static VOID
+TestNotOptimized()
+{
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse((char *)"test_statement(1 + );");
+
+    TEST_CHECK(CodeBuffer->Message != NULL);
+    TEST_CHECK(!ScriptEngineOptimizeSymbolBuffer(CodeBuffer));
+    TEST_CHECK(!ScriptEngineOptimizeSymbolBuffer(NULL));
+
+    RemoveSymbolBuffer(CodeBuffer);
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    ScriptEngineSetTextMessageCallback((PVOID)TestIgnoreMessage);
+
+    TestInitializeState();
+
+    TestFold();
+    TestRewrites();
+    TestNotOptimized();
+
+    printf("[+] all of the script optimizer tests passed\n");
+
+    return 0;
+}
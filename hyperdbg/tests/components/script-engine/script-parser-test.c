@@ -0,0 +1,415 @@
+/**
+ * @file script-parser-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the perfect hash tables of the script
+ * engine's scanner and parser
+ * @details Each generated hash table is compared with a linear scan of the
+ * array that it indexes (the previous implementation) for all of the names
+ * in the array and for names that are not in it. Then the lookups and the
+ * scanner and the parser are measured on a generated script. Build and run
+ * it from this directory:
+ *
+ *   H=../../..
+ *   gcc -O2 -fcommon -I. -I$H/include -I$H/script-engine/header -I$H/script-eval \
+ *       -Wno-unknown-pragmas -o script-parser-test script-parser-test.c script-engine-stubs.c \
+ *       $H/script-engine/code/{common,globals,hardware,optimizer,parse-table,scanner,script-engine,type}.c \
+ *       $H/script-eval/code/{Functions,Keywords,Regs,ScriptEngineEval,ScriptEngineDecode,ScriptEngineMaps}.c
+ *   ./script-parser-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of statements of the generated script
+ *
+ */
+#define BENCHMARK_STATEMENTS 4000
+
+/**
+ * @brief Number of times the generated script is parsed
+ *
+ */
+#define BENCHMARK_PARSE_ITERATIONS 10
+
+/**
+ * @brief Number of times all of the names of a table are looked up
+ *
+ */
+#define BENCHMARK_LOOKUP_ITERATIONS 2000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A generated hash table and the array of the names that it indexes
+ *
+ */
+typedef struct _TEST_HASH_TABLE
+{
+    const char *           Name;
+    const int *            Displacements;
+    const unsigned short * Values;
+    unsigned int           TableSize;
+    const char * const *   Strings;    // either an array of strings
+    const SYMBOL_MAP *     SymbolMaps; // or an array of symbol maps
+    unsigned int           Count;
+
+} TEST_HASH_TABLE, *PTEST_HASH_TABLE;
+
+/**
+ * @brief All of the generated hash tables
+ *
+ */
+static const TEST_HASH_TABLE g_HashTables[] = {
+    {"TerminalMap", TerminalMapHashDisplacements, TerminalMapHashValues, TERMINAL_MAP_HASH_TABLE_SIZE, TerminalMap, NULL, TERMINAL_COUNT},
+    {"NoneTerminalMap", NoneTerminalMapHashDisplacements, NoneTerminalMapHashValues, NONE_TERMINAL_MAP_HASH_TABLE_SIZE, NoneTerminalMap, NULL, NONETERMINAL_COUNT},
+    {"LalrTerminalMap", LalrTerminalMapHashDisplacements, LalrTerminalMapHashValues, LALR_TERMINAL_MAP_HASH_TABLE_SIZE, LalrTerminalMap, NULL, LALR_TERMINAL_COUNT},
+    {"LalrNoneTerminalMap", LalrNoneTerminalMapHashDisplacements, LalrNoneTerminalMapHashValues, LALR_NONE_TERMINAL_MAP_HASH_TABLE_SIZE, LalrNoneTerminalMap, NULL, LALR_NONTERMINAL_COUNT},
+    {"KeywordList", KeywordListHashDisplacements, KeywordListHashValues, KEYWORD_LIST_HASH_TABLE_SIZE, KeywordList, NULL, KEYWORD_LIST_LENGTH},
+    {"ScriptVariableTypeList", ScriptVariableTypeListHashDisplacements, ScriptVariableTypeListHashValues, SCRIPT_VARIABLE_TYPE_LIST_HASH_TABLE_SIZE, ScriptVariableTypeList, NULL, SCRIPT_VARIABLE_TYPE_LIST_LENGTH},
+    {"SemanticRulesMapList", SemanticRulesMapListHashDisplacements, SemanticRulesMapListHashValues, SEMANTIC_RULES_MAP_LIST_HASH_TABLE_SIZE, NULL, SemanticRulesMapList, SEMANTIC_RULES_MAP_LIST_LENGTH},
+    {"RegisterMapList", RegisterMapListHashDisplacements, RegisterMapListHashValues, REGISTER_MAP_LIST_HASH_TABLE_SIZE, NULL, RegisterMapList, REGISTER_MAP_LIST_LENGTH},
+    {"PseudoRegisterMapList", PseudoRegisterMapListHashDisplacements, PseudoRegisterMapListHashValues, PSEUDO_REGISTER_MAP_LIST_HASH_TABLE_SIZE, NULL, PseudoRegisterMapList, PSEUDO_REGISTER_MAP_LIST_LENGTH},
+};
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Get a name of a table
+ *
+ * @param Table
+ * @param Index
+ *
+ * @return const char *
+ */
+static const char *
+TestGetName(const TEST_HASH_TABLE * Table, unsigned int Index)
+{
+    return Table->Strings != NULL ? Table->Strings[Index] : Table->SymbolMaps[Index].Name;
+}
+
+/**
+ * @brief Find a name by the hash table (the same as the scanner and the parser)
+ *
+ * @param Table
+ * @param Str
+ *
+ * @return int the index or -1
+ */
+static int
+TestHashFind(const TEST_HASH_TABLE * Table, const char * Str)
+{
+    unsigned int i = PerfectHashLookup(Str, Table->Displacements, Table->Values, Table->TableSize);
+
+    return strcmp(Str, TestGetName(Table, i)) == 0 ? (int)i : -1;
+}
+
+/**
+ * @brief Find a name by scanning the array (the previous implementation)
+ *
+ * @param Table
+ * @param Str
+ *
+ * @return int the index or -1
+ */
+static int
+TestLinearFind(const TEST_HASH_TABLE * Table, const char * Str)
+{
+    for (unsigned int i = 0; i < Table->Count; i++)
+    {
+        if (strcmp(Str, TestGetName(Table, i)) == 0)
+        {
+            return (int)i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Compare the hash tables with the linear scans
+ *
+ * @return VOID
+ */
+static VOID
+TestHashTables()
+{
+    static const char * Missing[] = {"", "_", "x", "rax1", "@rax", "PRINTF", "printf_", "_hex_", "S2", "if "};
+    char                Modified[0x100];
+
+    for (UINT32 t = 0; t < sizeof(g_HashTables) / sizeof(g_HashTables[0]); t++)
+    {
+        const TEST_HASH_TABLE * Table = &g_HashTables[t];
+
+        for (unsigned int i = 0; i < Table->Count; i++)
+        {
+            const char * Str       = TestGetName(Table, i);
+            int          HashIndex = TestHashFind(Table, Str);
+            int          Expected  = TestLinearFind(Table, Str);
+
+            //
+            // The index might be different if a name is repeated in the
+            // array, but it should be the same name with the same value
+            //
+            TEST_CHECK(HashIndex != -1);
+            TEST_CHECK(strcmp(TestGetName(Table, HashIndex), TestGetName(Table, Expected)) == 0);
+
+            if (Table->SymbolMaps != NULL)
+            {
+                TEST_CHECK(Table->SymbolMaps[HashIndex].Type == Table->SymbolMaps[Expected].Type);
+            }
+
+            //
+            // Names that only differ in a character are not found
+            //
+            snprintf(Modified, sizeof(Modified), "%s~", Str);
+            TEST_CHECK(TestHashFind(Table, Modified) == -1);
+
+            if (Str[0] != '\0')
+            {
+                snprintf(Modified, sizeof(Modified), "%s", Str);
+                Modified[strlen(Modified) - 1] ^= 0x20;
+
+                TEST_CHECK((TestHashFind(Table, Modified) == -1) == (TestLinearFind(Table, Modified) == -1));
+            }
+        }
+
+        for (UINT32 i = 0; i < sizeof(Missing) / sizeof(Missing[0]); i++)
+        {
+            TEST_CHECK((TestHashFind(Table, Missing[i]) == -1) == (TestLinearFind(Table, Missing[i]) == -1));
+        }
+    }
+}
+
+/**
+ * @brief Parse more loops than the temporary variables, the condition of
+ * each loop should release its temporary variable
+ *
+ * @return VOID
+ */
+static VOID
+TestLoopsTemps()
+{
+    static const char * Loops[] = {
+        "for (i = 0; i < 10; i++) { z = i; }\n",
+        "i = 1; while (i != 0) { i = i >> 1; }\n",
+    };
+
+    for (UINT32 l = 0; l < sizeof(Loops) / sizeof(Loops[0]); l++)
+    {
+        size_t Length = strlen(Loops[l]);
+        char * Script = (char *)malloc(Length * MAX_TEMP_COUNT * 2 + 1);
+
+        TEST_CHECK(Script != NULL);
+
+        for (UINT32 i = 0; i < MAX_TEMP_COUNT * 2; i++)
+        {
+            memcpy(&Script[i * Length], Loops[l], Length + 1);
+        }
+
+        PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Script);
+
+        TEST_CHECK(CodeBuffer->Message == NULL);
+
+        RemoveSymbolBuffer(CodeBuffer);
+        free(Script);
+    }
+}
+
+/**
+ * @brief The statements of the generated script and the number of their tokens
+ *
+ */
+static const struct
+{
+    const char * Statement;
+    UINT32       TokensCount;
+} g_Statements[] = {
+    {"x = @rax + 0x10 * $pid;\n", 8},
+    {"if (x > 5) { y = dq(@rsp + 8); } else { y = @rcx & 0xff; }\n", 24},
+    {"printf(\"%llx\\n\", poi(@rcx));\n", 10},
+    {"for (i = 0; i < 10; i++) { z = x ^ i; }\n", 21},
+    {"while (y != 0) { y = y >> 1; }\n", 14},
+};
+
+/**
+ * @brief Generate the script of the benchmark
+ *
+ * @param TokensCount Number of the tokens of the script
+ *
+ * @return char *
+ */
+static char *
+BenchmarkGenerateScript(UINT64 * TokensCount)
+{
+    size_t Size   = 1;
+    char * Script = NULL;
+
+    *TokensCount = 0;
+
+    for (UINT32 i = 0; i < BENCHMARK_STATEMENTS; i++)
+    {
+        Size += strlen(g_Statements[i % (sizeof(g_Statements) / sizeof(g_Statements[0]))].Statement);
+    }
+
+    Script = (char *)malloc(Size);
+    TEST_CHECK(Script != NULL);
+    Script[0] = '\0';
+
+    for (UINT32 i = 0, Offset = 0; i < BENCHMARK_STATEMENTS; i++)
+    {
+        const char * Statement = g_Statements[i % (sizeof(g_Statements) / sizeof(g_Statements[0]))].Statement;
+
+        memcpy(&Script[Offset], Statement, strlen(Statement) + 1);
+        Offset += (UINT32)strlen(Statement);
+
+        *TokensCount += g_Statements[i % (sizeof(g_Statements) / sizeof(g_Statements[0]))].TokensCount;
+    }
+
+    return Script;
+}
+
+/**
+ * @brief Benchmark the lookups and the parser
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun()
+{
+    UINT64 TokensCount;
+    UINT64 HashTime   = 0;
+    UINT64 LinearTime = 0;
+    UINT64 Lookups    = 0;
+    UINT64 Checksum   = 0;
+    UINT64 Start;
+    char * Script = BenchmarkGenerateScript(&TokensCount);
+
+    //
+    // Lookups of all of the names (the names are what the scanner and the
+    // parser look up)
+    //
+    printf("%-24s %6s %14s %14s %9s\n", "table", "names", "linear ns", "hash ns", "speedup");
+
+    for (UINT32 t = 0; t < sizeof(g_HashTables) / sizeof(g_HashTables[0]); t++)
+    {
+        const TEST_HASH_TABLE * Table = &g_HashTables[t];
+        UINT64                  Hash;
+        UINT64                  Linear;
+
+        Start = TestGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_LOOKUP_ITERATIONS; j++)
+        {
+            for (unsigned int i = 0; i < Table->Count; i++)
+            {
+                Checksum += TestLinearFind(Table, TestGetName(Table, i));
+            }
+        }
+
+        Linear = TestGetTime() - Start;
+        Start  = TestGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_LOOKUP_ITERATIONS; j++)
+        {
+            for (unsigned int i = 0; i < Table->Count; i++)
+            {
+                Checksum += TestHashFind(Table, TestGetName(Table, i));
+            }
+        }
+
+        Hash = TestGetTime() - Start;
+
+        printf("%-24s %6u %14.2f %14.2f %8.1fx\n",
+               Table->Name,
+               Table->Count,
+               (double)Linear / ((UINT64)Table->Count * BENCHMARK_LOOKUP_ITERATIONS),
+               (double)Hash / ((UINT64)Table->Count * BENCHMARK_LOOKUP_ITERATIONS),
+               (double)Linear / Hash);
+
+        LinearTime += Linear;
+        HashTime += Hash;
+        Lookups += (UINT64)Table->Count * BENCHMARK_LOOKUP_ITERATIONS;
+    }
+
+    printf("%-24s %6s %14.2f %14.2f %8.1fx\n\n",
+           "all",
+           "",
+           (double)LinearTime / Lookups,
+           (double)HashTime / Lookups,
+           (double)LinearTime / HashTime);
+
+    //
+    // The scanner and the parser
+    //
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_PARSE_ITERATIONS; i++)
+    {
+        PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParse(Script);
+
+        TEST_CHECK(CodeBuffer->Message == NULL);
+
+        Checksum += CodeBuffer->Pointer;
+        RemoveSymbolBuffer(CodeBuffer);
+    }
+
+    double Seconds = (double)(TestGetTime() - Start) / 1000000000.0;
+
+    printf("parsed statements        : %u (%llu tokens) x %u\n",
+           BENCHMARK_STATEMENTS,
+           (unsigned long long)TokensCount,
+           BENCHMARK_PARSE_ITERATIONS);
+    printf("scanner and parser       : %.0f tokens/sec (%llu)\n",
+           (double)(TokensCount * BENCHMARK_PARSE_ITERATIONS) / Seconds,
+           (unsigned long long)Checksum);
+
+    free(Script);
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestHashTables();
+    TestLoopsTemps();
+
+    printf("[+] all of the script parser tests passed\n\n");
+
+    BenchmarkRun();
+
+    return 0;
+}
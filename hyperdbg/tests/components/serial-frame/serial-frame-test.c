@@ -0,0 +1,647 @@
+/**
+ * @file serial-frame-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the framing of the serial transport
+ * @details The frames are sent over a socket pair (instead of a serial port)
+ * in random chunks, with garbage and corrupted frames between them, and they
+ * are received in bulk into the ring of a receiver. The throughput is also
+ * compared with the previous receiver (reading byte by byte and searching for
+ * the end of the buffer). Build and run it from this directory:
+ *
+ *   gcc -O2 -pthread -I. -I../../../include -o serial-frame-test \
+ *       serial-frame-test.c ../../../include/components/serialframe/code/SerialFrame.c
+ *   ./serial-frame-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum payload of the frames (the same as the serial packets)
+ *
+ */
+#define TEST_MAXIMUM_PAYLOAD (20 * 0x1000)
+
+/**
+ * @brief Size of the ring of the receiver
+ *
+ */
+#define TEST_RING_SIZE 0x40000
+
+/**
+ * @brief Number of the frames that are sent over the socket pair
+ *
+ */
+#define TEST_FRAME_COUNT 3000
+
+/**
+ * @brief The frame that stops the receiver
+ *
+ */
+#define TEST_LAST_SEQUENCE 0xffffffff
+
+/**
+ * @brief Number of the bytes of each benchmark
+ *
+ */
+#define TEST_BENCHMARK_BYTES (4 * 1024 * 1024)
+
+/**
+ * @brief Size of the packets of the benchmark
+ *
+ */
+#define TEST_BENCHMARK_PACKET_SIZE 0x400
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief The previous end of the buffer (0x00, 0x80, 0xEE, 0xFF)
+ *
+ */
+const UINT8 g_EndOfBuffer[4] = {0x00, 0x80, 0xee, 0xff};
+
+/**
+ * @brief The sockets (0 for the receiver and 1 for the sender)
+ *
+ */
+int g_Sockets[2];
+
+/**
+ * @brief State of the random generator of the sender
+ *
+ */
+UINT32 g_SenderSeed = 0x12345678;
+
+/**
+ * @brief Sequence numbers of the frames that are corrupted by the sender
+ *
+ */
+BOOLEAN g_CorruptedSequences[TEST_FRAME_COUNT];
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Fill the payload of a frame based on its sequence number
+ * @details The bytes are below 0x80, so they never contain the end of the
+ * buffer of the previous receiver
+ *
+ * @param Buffer
+ * @param Length
+ * @param Sequence
+ *
+ * @return VOID
+ */
+static VOID
+TestFillPayload(UINT8 * Buffer, UINT32 Length, UINT32 Sequence)
+{
+    UINT32 i;
+
+    memcpy(Buffer, &Sequence, sizeof(UINT32));
+
+    for (i = sizeof(UINT32); i < Length; i++)
+    {
+        Buffer[i] = (UINT8)((Sequence * 31 + i * 7) & 0x7f);
+    }
+}
+
+/**
+ * @brief Check the payload of a frame
+ *
+ * @param Buffer
+ * @param Length
+ * @param Sequence
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestCheckPayload(const UINT8 * Buffer, UINT32 Length, UINT32 Sequence)
+{
+    UINT32 i;
+
+    for (i = sizeof(UINT32); i < Length; i++)
+    {
+        if (Buffer[i] != (UINT8)((Sequence * 31 + i * 7) & 0x7f))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Write all of a buffer to a socket
+ *
+ * @param Socket
+ * @param Buffer
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+TestWriteAll(int Socket, const VOID * Buffer, UINT32 Length)
+{
+    const UINT8 * Bytes = (const UINT8 *)Buffer;
+    ssize_t       Written;
+
+    while (Length != 0)
+    {
+        Written = write(Socket, Bytes, Length);
+        TEST_CHECK(Written > 0);
+
+        Bytes += Written;
+        Length -= (UINT32)Written;
+    }
+}
+
+/**
+ * @brief Build a frame (header and payload) in a buffer
+ *
+ * @param Frame
+ * @param Payload
+ * @param Length
+ *
+ * @return UINT32 Size of the frame
+ */
+static UINT32
+TestBuildFrame(UINT8 * Frame, const UINT8 * Payload, UINT32 Length)
+{
+    SERIAL_FRAME_HEADER Header;
+
+    SerialFrameInitializeHeader(&Header);
+    SerialFrameAppendToHeader(&Header, Payload, Length);
+    SerialFrameFinalizeHeader(&Header);
+
+    memcpy(Frame, &Header, sizeof(SERIAL_FRAME_HEADER));
+    memcpy(Frame + sizeof(SERIAL_FRAME_HEADER), Payload, Length);
+
+    return (UINT32)sizeof(SERIAL_FRAME_HEADER) + Length;
+}
+
+/**
+ * @brief Test the CRC32 and the headers
+ *
+ * @return VOID
+ */
+static VOID
+TestCrc32()
+{
+    const char *        Check = "123456789";
+    SERIAL_FRAME_HEADER Header;
+    UINT32              Crc;
+
+    TEST_CHECK(SerialFrameCrc32(0, Check, 9) == 0xcbf43926);
+    TEST_CHECK(SerialFrameCrc32(0, Check, 0) == 0);
+
+    Crc = SerialFrameCrc32(0, Check, 4);
+    TEST_CHECK(SerialFrameCrc32(Crc, Check + 4, 5) == 0xcbf43926);
+
+    SerialFrameInitializeHeader(&Header);
+    SerialFrameAppendToHeader(&Header, Check, 2);
+    SerialFrameAppendToHeader(&Header, Check + 2, 7);
+    SerialFrameFinalizeHeader(&Header);
+
+    TEST_CHECK(Header.Length == 9 && Header.Crc32 == 0xcbf43926);
+    TEST_CHECK(SerialFrameCheckHeader(&Header, 9));
+    TEST_CHECK(!SerialFrameCheckHeader(&Header, 8));
+
+    Header.LengthCheck ^= 1;
+    TEST_CHECK(!SerialFrameCheckHeader(&Header, 9));
+}
+
+/**
+ * @brief Test the receiver (wrapping around the ring, garbage and corrupted frames)
+ *
+ * @return VOID
+ */
+static VOID
+TestReceiver()
+{
+    SERIAL_FRAME_RECEIVER Receiver;
+    UINT8                 Ring[256];
+    UINT8                 Frame[256];
+    UINT8                 Payload[200];
+    UINT8                 Received[200];
+    UINT32                Seed = 1;
+    UINT32                Sequence;
+    UINT32                FrameSize;
+    UINT32                Length;
+    UINT32                Offset;
+    UINT32                Chunk;
+
+    TEST_CHECK(!SerialFrameReceiverInitialize(&Receiver, Ring, 255, 100));
+    TEST_CHECK(!SerialFrameReceiverInitialize(&Receiver, Ring, 256, 250));
+    TEST_CHECK(SerialFrameReceiverInitialize(&Receiver, Ring, 256, 200));
+
+    TEST_CHECK(!SerialFrameReceiverRead(&Receiver, Received, &Length));
+
+    for (Sequence = 0; Sequence < 2000; Sequence++)
+    {
+        Length = sizeof(UINT32) + TestRandom(&Seed) % (200 - sizeof(UINT32));
+
+        TestFillPayload(Payload, Length, Sequence);
+        FrameSize = TestBuildFrame(Frame, Payload, Length);
+
+        //
+        // Garbage before the frame
+        //
+        if (Sequence % 7 == 0)
+        {
+            UINT8 Garbage[5] = {0x48, 0x44, 0x42, 0x46, 0x11};
+
+            TEST_CHECK(SerialFrameReceiverWrite(&Receiver, Garbage, sizeof(Garbage)) == sizeof(Garbage));
+        }
+
+        //
+        // A corrupted copy of the frame before it
+        //
+        if (Sequence % 11 == 0)
+        {
+            Frame[FrameSize - 1] ^= 0x80;
+
+            for (Offset = 0; Offset != FrameSize; Offset += Chunk)
+            {
+                Chunk = SerialFrameReceiverWrite(&Receiver, &Frame[Offset], FrameSize - Offset);
+                TEST_CHECK(!SerialFrameReceiverRead(&Receiver, Received, &Length));
+            }
+
+            Frame[FrameSize - 1] ^= 0x80;
+        }
+
+        for (Offset = 0; Offset != FrameSize; Offset += Chunk)
+        {
+            Chunk = 1 + TestRandom(&Seed) % 64;
+
+            if (Chunk > FrameSize - Offset)
+            {
+                Chunk = FrameSize - Offset;
+            }
+
+            TEST_CHECK(SerialFrameReceiverWrite(&Receiver, &Frame[Offset], Chunk) == Chunk);
+
+            if (Offset + Chunk != FrameSize)
+            {
+                TEST_CHECK(!SerialFrameReceiverRead(&Receiver, Received, &Length));
+            }
+        }
+
+        TEST_CHECK(SerialFrameReceiverRead(&Receiver, Received, &Length));
+        TEST_CHECK(Length == FrameSize - sizeof(SERIAL_FRAME_HEADER));
+        TEST_CHECK(memcmp(Received, Payload, Length) == 0);
+        TEST_CHECK(!SerialFrameReceiverRead(&Receiver, Received, &Length));
+    }
+
+    TEST_CHECK(Receiver.CorruptedFrames >= 2000 / 11);
+    TEST_CHECK(Receiver.WritePosition > 10 * sizeof(Ring));
+}
+
+/**
+ * @brief The sender of the socket pair test
+ * @details The frames are sent in random chunks, garbage is sent between
+ * some of them and some of them are corrupted
+ *
+ * @param Parameter
+ *
+ * @return void *
+ */
+static void *
+TestSender(void * Parameter)
+{
+    UINT8 * Payload = (UINT8 *)malloc(TEST_MAXIMUM_PAYLOAD);
+    UINT8 * Frame   = (UINT8 *)malloc(sizeof(SERIAL_FRAME_HEADER) + TEST_MAXIMUM_PAYLOAD);
+    UINT8   Garbage[64];
+    UINT32  Sequence;
+    UINT32  Length;
+    UINT32  FrameSize;
+    UINT32  Offset;
+    UINT32  Chunk;
+    UINT32  i;
+
+    (void)Parameter;
+
+    TEST_CHECK(Payload != NULL && Frame != NULL);
+
+    for (Sequence = 0; Sequence < TEST_FRAME_COUNT; Sequence++)
+    {
+        //
+        // Most of the packets are small, some of them are as big as possible
+        //
+        if (TestRandom(&g_SenderSeed) % 10 == 0)
+        {
+            Length = TEST_MAXIMUM_PAYLOAD - TestRandom(&g_SenderSeed) % 0x1000;
+        }
+        else
+        {
+            Length = sizeof(UINT32) + TestRandom(&g_SenderSeed) % 0x200;
+        }
+
+        TestFillPayload(Payload, Length, Sequence);
+        FrameSize = TestBuildFrame(Frame, Payload, Length);
+
+        if (TestRandom(&g_SenderSeed) % 13 == 0)
+        {
+            for (i = 0; i < sizeof(Garbage); i++)
+            {
+                Garbage[i] = (UINT8)TestRandom(&g_SenderSeed);
+            }
+
+            TestWriteAll(g_Sockets[1], Garbage, 1 + TestRandom(&g_SenderSeed) % sizeof(Garbage));
+        }
+
+        if (TestRandom(&g_SenderSeed) % 17 == 0)
+        {
+            Frame[sizeof(SERIAL_FRAME_HEADER) + TestRandom(&g_SenderSeed) % Length] ^= 0x55;
+            g_CorruptedSequences[Sequence] = TRUE;
+        }
+
+        for (Offset = 0; Offset != FrameSize; Offset += Chunk)
+        {
+            Chunk = 1 + TestRandom(&g_SenderSeed) % 0x2000;
+
+            if (Chunk > FrameSize - Offset)
+            {
+                Chunk = FrameSize - Offset;
+            }
+
+            TestWriteAll(g_Sockets[1], &Frame[Offset], Chunk);
+        }
+    }
+
+    //
+    // The last frame stops the receiver
+    //
+    Sequence  = TEST_LAST_SEQUENCE;
+    FrameSize = TestBuildFrame(Frame, (UINT8 *)&Sequence, sizeof(UINT32));
+    TestWriteAll(g_Sockets[1], Frame, FrameSize);
+
+    free(Payload);
+    free(Frame);
+
+    return NULL;
+}
+
+/**
+ * @brief Receive a frame from a socket into a receiver (in bulk)
+ *
+ * @param Receiver
+ * @param Socket
+ * @param Buffer
+ * @param Length
+ *
+ * @return VOID
+ */
+static VOID
+TestReceiveFrame(PSERIAL_FRAME_RECEIVER Receiver, int Socket, UINT8 * Buffer, UINT32 * Length)
+{
+    UINT8 * WriteBuffer;
+    UINT32  Free;
+    ssize_t Read;
+
+    while (!SerialFrameReceiverRead(Receiver, Buffer, Length))
+    {
+        WriteBuffer = SerialFrameReceiverGetWriteBuffer(Receiver, &Free);
+        TEST_CHECK(WriteBuffer != NULL);
+
+        Read = read(Socket, WriteBuffer, Free);
+        TEST_CHECK(Read > 0);
+
+        SerialFrameReceiverCommit(Receiver, (UINT32)Read);
+    }
+}
+
+/**
+ * @brief Test the frames over a socket pair
+ *
+ * @return VOID
+ */
+static VOID
+TestSocketPair()
+{
+    SERIAL_FRAME_RECEIVER Receiver;
+    UINT8 *               Ring   = (UINT8 *)malloc(TEST_RING_SIZE);
+    UINT8 *               Buffer = (UINT8 *)malloc(TEST_MAXIMUM_PAYLOAD);
+    pthread_t             Sender;
+    UINT32                Sequence;
+    UINT32                Expected = 0;
+    UINT32                Received = 0;
+    UINT32                Length;
+
+    TEST_CHECK(Ring != NULL && Buffer != NULL);
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, g_Sockets) == 0);
+    TEST_CHECK(SerialFrameReceiverInitialize(&Receiver, Ring, TEST_RING_SIZE, TEST_MAXIMUM_PAYLOAD));
+    TEST_CHECK(pthread_create(&Sender, NULL, TestSender, NULL) == 0);
+
+    while (TRUE)
+    {
+        TestReceiveFrame(&Receiver, g_Sockets[0], Buffer, &Length);
+
+        TEST_CHECK(Length >= sizeof(UINT32));
+        memcpy(&Sequence, Buffer, sizeof(UINT32));
+
+        if (Sequence == TEST_LAST_SEQUENCE)
+        {
+            break;
+        }
+
+        //
+        // The frames are received in order and only the corrupted ones are lost
+        //
+        TEST_CHECK(Sequence >= Expected && Sequence < TEST_FRAME_COUNT);
+        TEST_CHECK(TestCheckPayload(Buffer, Length, Sequence));
+
+        Expected = Sequence + 1;
+        Received++;
+    }
+
+    pthread_join(Sender, NULL);
+
+    for (Sequence = 0; Sequence < TEST_FRAME_COUNT; Sequence++)
+    {
+        if (!g_CorruptedSequences[Sequence])
+        {
+            Received--;
+        }
+    }
+
+    TEST_CHECK(Received == 0);
+    TEST_CHECK(Receiver.CorruptedFrames != 0 && Receiver.DiscardedBytes != 0);
+
+    close(g_Sockets[0]);
+    close(g_Sockets[1]);
+
+    free(Ring);
+    free(Buffer);
+}
+
+/**
+ * @brief The sender of the benchmarks
+ *
+ * @param Parameter TRUE if the frames are sent, otherwise the packets are
+ * followed by the end of the buffer
+ *
+ * @return void *
+ */
+static void *
+TestBenchmarkSender(void * Parameter)
+{
+    BOOLEAN Framed = Parameter != NULL;
+    UINT8   Payload[TEST_BENCHMARK_PACKET_SIZE];
+    UINT8   Frame[sizeof(SERIAL_FRAME_HEADER) + TEST_BENCHMARK_PACKET_SIZE];
+    UINT32  FrameSize;
+    UINT32  Sequence;
+
+    for (Sequence = 0; Sequence < TEST_BENCHMARK_BYTES / TEST_BENCHMARK_PACKET_SIZE; Sequence++)
+    {
+        TestFillPayload(Payload, sizeof(Payload), Sequence);
+
+        if (Framed)
+        {
+            FrameSize = TestBuildFrame(Frame, Payload, sizeof(Payload));
+        }
+        else
+        {
+            memcpy(Frame, Payload, sizeof(Payload));
+            memcpy(Frame + sizeof(Payload), g_EndOfBuffer, sizeof(g_EndOfBuffer));
+            FrameSize = sizeof(Payload) + sizeof(g_EndOfBuffer);
+        }
+
+        TestWriteAll(g_Sockets[1], Frame, FrameSize);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Compare the throughput of the previous receiver with the frames
+ *
+ * @return VOID
+ */
+static VOID
+TestBenchmark()
+{
+    SERIAL_FRAME_RECEIVER Receiver;
+    UINT8 *               Ring   = (UINT8 *)malloc(TEST_RING_SIZE);
+    UINT8 *               Buffer = (UINT8 *)malloc(TEST_MAXIMUM_PAYLOAD);
+    UINT32                Packets = TEST_BENCHMARK_BYTES / TEST_BENCHMARK_PACKET_SIZE;
+    pthread_t             Sender;
+    UINT64                Start;
+    UINT64                ByteByByte;
+    UINT64                Bulk;
+    UINT32                Sequence;
+    UINT32                Loop;
+    UINT32                Length;
+
+    TEST_CHECK(Ring != NULL && Buffer != NULL);
+
+    //
+    // The previous receiver, byte by byte until the end of the buffer
+    //
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, g_Sockets) == 0);
+    TEST_CHECK(pthread_create(&Sender, NULL, TestBenchmarkSender, NULL) == 0);
+
+    Start = TestGetTime();
+
+    for (Sequence = 0; Sequence < Packets; Sequence++)
+    {
+        for (Loop = 0;; Loop++)
+        {
+            TEST_CHECK(read(g_Sockets[0], &Buffer[Loop], 1) == 1);
+
+            if (Loop >= 3 && memcmp(&Buffer[Loop - 3], g_EndOfBuffer, sizeof(g_EndOfBuffer)) == 0)
+            {
+                break;
+            }
+        }
+
+        TEST_CHECK(Loop - 3 == TEST_BENCHMARK_PACKET_SIZE && TestCheckPayload(Buffer, Loop - 3, Sequence));
+    }
+
+    ByteByByte = TestGetTime() - Start;
+
+    pthread_join(Sender, NULL);
+    close(g_Sockets[0]);
+    close(g_Sockets[1]);
+
+    //
+    // The frames, in bulk
+    //
+    TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, g_Sockets) == 0);
+    TEST_CHECK(SerialFrameReceiverInitialize(&Receiver, Ring, TEST_RING_SIZE, TEST_MAXIMUM_PAYLOAD));
+    TEST_CHECK(pthread_create(&Sender, NULL, TestBenchmarkSender, (void *)1) == 0);
+
+    Start = TestGetTime();
+
+    for (Sequence = 0; Sequence < Packets; Sequence++)
+    {
+        TestReceiveFrame(&Receiver, g_Sockets[0], Buffer, &Length);
+        TEST_CHECK(Length == TEST_BENCHMARK_PACKET_SIZE && TestCheckPayload(Buffer, Length, Sequence));
+    }
+
+    Bulk = TestGetTime() - Start;
+
+    pthread_join(Sender, NULL);
+    close(g_Sockets[0]);
+    close(g_Sockets[1]);
+
+    printf("[*] byte by byte (end of the buffer) : %8.1f MB/s\n",
+           (double)TEST_BENCHMARK_BYTES / (double)ByteByByte * 1000.0);
+    printf("[*] frames (bulk reads into a ring)  : %8.1f MB/s\n",
+           (double)TEST_BENCHMARK_BYTES / (double)Bulk * 1000.0);
+
+    free(Ring);
+    free(Buffer);
+}
+
+int
+main()
+{
+    TestCrc32();
+    TestReceiver();
+    TestSocketPair();
+
+    TestBenchmark();
+
+    printf("[+] all of the serial frame tests passed\n");
+
+    return 0;
+}
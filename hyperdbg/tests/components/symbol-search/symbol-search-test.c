@@ -0,0 +1,437 @@
+/**
+ * @file symbol-search-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the wildcard search index of the symbols
+ * @details A synthetic symbol table (500k names that look like the names of
+ * the kernel) is indexed, the results of the queries are compared with
+ * checking all of the names by a reference matcher, and the queries are
+ * measured against checking all of the names (like the enumeration of
+ * DbgHelp). Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o symbol-search-test \
+ *       symbol-search-test.c ../../../include/components/symbolsearch/code/SymbolSearch.c
+ *   ./symbol-search-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Number of the names of the synthetic symbol table
+ *
+ */
+#define TEST_NAME_COUNT 500000
+
+/**
+ * @brief Number of the repeats of the measured queries
+ *
+ */
+#define TEST_QUERY_REPEATS 20
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+static const CHAR * g_TestPrefixes[] = {
+    "Nt", "Zw", "Ke", "Ki", "Ex", "Exp", "Mi", "Mm", "Io", "Iop", "Ps", "Psp", "Ob", "Obp",
+    "Se", "Sep", "Cm", "Cmp", "Hal", "Etw", "Wmi", "Po", "Pop", "Rtl", "Rtlp", "Vf", "Fs", "_"};
+
+static const CHAR * g_TestWords[] = {
+    "Allocate", "Free", "Pool", "Create", "Process", "Thread", "Object", "Query",
+    "Information", "Set", "Get", "Insert", "Remove", "Lock", "Unlock", "Queue",
+    "Apc", "Dpc", "Timer", "Wait", "Event", "Mutex", "Section", "View", "Map",
+    "Unmap", "Page", "File", "Registry", "Key", "Value", "Token", "Security",
+    "Descriptor", "Handle", "Table", "Entry", "List", "Callback", "Notify",
+    "Routine", "Device", "Driver", "Irp", "Memory", "Virtual", "Physical",
+    "Address", "Range", "Descriptor", "Context", "Frame", "Trap", "Interrupt",
+    "Vector", "Processor", "Affinity", "Group", "Node", "Cache", "Flush", "Tb"};
+
+static const CHAR * g_TestSuffixes[] = {"", "", "", "Ex", "WithTag", "Internal", "Worker", "Locked"};
+
+/**
+ * @brief Get a random number
+ *
+ * @param Seed
+ *
+ * @return UINT32
+ */
+static UINT32
+TestRandom(UINT32 * Seed)
+{
+    *Seed = *Seed * 1103515245 + 12345;
+
+    return *Seed >> 8;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Reference matcher (recursive, case-insensitive)
+ *
+ * @param Name
+ * @param Mask
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestMatch(const CHAR * Name, const CHAR * Mask)
+{
+    if (*Mask == '\0')
+    {
+        return *Name == '\0';
+    }
+
+    if (*Mask == '*')
+    {
+        return TestMatch(Name, Mask + 1) || (*Name != '\0' && TestMatch(Name + 1, Mask));
+    }
+
+    if (*Name == '\0')
+    {
+        return FALSE;
+    }
+
+    if (*Mask != '?' && tolower((UINT8)*Mask) != tolower((UINT8)*Name))
+    {
+        return FALSE;
+    }
+
+    return TestMatch(Name + 1, Mask + 1);
+}
+
+/**
+ * @brief Generate the names of the synthetic symbol table
+ *
+ * @param Count
+ *
+ * @return CHAR ** The names (one allocation)
+ */
+static CHAR **
+TestGenerateNames(UINT32 Count)
+{
+    CHAR ** Names   = (CHAR **)malloc(Count * sizeof(CHAR *) + (UINT64)Count * 64);
+    CHAR *  Strings = (CHAR *)&Names[Count];
+    UINT32  Seed    = 0x4844;
+
+    TEST_CHECK(Names != NULL);
+
+    //
+    // The names are packed (like the names of the index of a PDB file)
+    //
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        UINT32 Words  = TestRandom(&Seed) % 3 + 1;
+        CHAR * Cursor = Strings;
+
+        Names[i] = Cursor;
+        Cursor += sprintf(Cursor, "%s", g_TestPrefixes[TestRandom(&Seed) % (sizeof(g_TestPrefixes) / sizeof(g_TestPrefixes[0]))]);
+
+        while (Words-- != 0)
+        {
+            Cursor += sprintf(Cursor, "%s", g_TestWords[TestRandom(&Seed) % (sizeof(g_TestWords) / sizeof(g_TestWords[0]))]);
+        }
+
+        Cursor += sprintf(Cursor, "%s", g_TestSuffixes[TestRandom(&Seed) % (sizeof(g_TestSuffixes) / sizeof(g_TestSuffixes[0]))]);
+
+        //
+        // Most of the names are unique (like the names of a module)
+        //
+        if (TestRandom(&Seed) % 8 != 0)
+        {
+            Cursor += sprintf(Cursor, "%u", i);
+        }
+
+        Strings = Cursor + 1;
+    }
+
+    return Names;
+}
+
+/**
+ * @brief Check the results of a query with checking all of the names
+ *
+ * @param Index
+ * @param Mask
+ * @param Seen Scratch of the names that are found
+ *
+ * @return UINT32 Number of the results
+ */
+static UINT32
+TestQuery(PSYMBOL_SEARCH_INDEX Index, const CHAR * Mask, UINT8 * Seen)
+{
+    SYMBOL_SEARCH_ITERATOR Iterator;
+    UINT32                 Id;
+    UINT32                 Count = 0;
+
+    memset(Seen, 0, Index->NameCount);
+
+    SymbolSearchBeginQuery(Index, &Iterator, Mask);
+
+    while ((Id = SymbolSearchGetNext(&Iterator)) != SYMBOL_SEARCH_NO_NAME)
+    {
+        TEST_CHECK(Id < Index->NameCount);
+        TEST_CHECK(!Seen[Id]);
+
+        Seen[Id] = 1;
+        Count++;
+    }
+
+    TEST_CHECK(SymbolSearchGetNext(&Iterator) == SYMBOL_SEARCH_NO_NAME);
+
+    for (UINT32 i = 0; i < Index->NameCount; i++)
+    {
+        if (Seen[i] != TestMatch(Index->Names[i], Mask))
+        {
+            printf("[x] mask '%s', name '%s' (expected: %u)\n", Mask, Index->Names[i], !Seen[i]);
+            exit(1);
+        }
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Test the matcher of the masks
+ *
+ * @return VOID
+ */
+static VOID
+TestMatcher()
+{
+    static const CHAR * Names[] = {"", "a", "ab", "ExAllocatePoolWithTag", "aaa", "a*b", "Pool", "poolpool"};
+    static const CHAR * Masks[] = {"", "*", "**", "?", "??", "*?", "a", "A*", "*b", "*ab*", "ex*pool*",
+                                   "*POOL", "*pool*tag", "*o?l*", "a*a*a", "*a*a*a*", "?*?", "pool*pool",
+                                   "*pool*pool*", "exallocatepoolwithtag", "ExAllocatePoolWithTa"};
+
+    for (UINT32 i = 0; i < sizeof(Names) / sizeof(Names[0]); i++)
+    {
+        for (UINT32 j = 0; j < sizeof(Masks) / sizeof(Masks[0]); j++)
+        {
+            TEST_CHECK(SymbolSearchMatch(Names[i], Masks[j]) == TestMatch(Names[i], Masks[j]));
+        }
+    }
+}
+
+/**
+ * @brief Test the queries
+ *
+ * @param Index
+ * @param RandomMaskCount Number of the masks that are made from the names
+ *
+ * @return VOID
+ */
+static VOID
+TestQueries(PSYMBOL_SEARCH_INDEX Index, UINT32 RandomMaskCount)
+{
+    static const CHAR * Masks[] = {
+        "*", "", "NtCreateFile", "ExAllocate*", "exallocate*", "*Pool*", "*WithTag", "*pool*tag",
+        "Mi?llocate*", "*ol", "*l", "?", "*?", "??*", "K*", "Ke*Dpc*", "*Queue*Apc*Ex", "Zw*12*",
+        "*3", "*123", "Ps*Thread*Locked", "*Notify?outine*", "NoSuchSymbol*", "*zzz*", "_*",
+        "*Tb", "*TB*", "Ob*ref*", "ExAllocatePoolWithTag", "*??Pool??*"};
+    UINT8 * Seen = (UINT8 *)malloc(Index->NameCount);
+    UINT32  Seed = 0x1234;
+    CHAR    Mask[128];
+
+    TEST_CHECK(Seen != NULL);
+
+    for (UINT32 i = 0; i < sizeof(Masks) / sizeof(Masks[0]); i++)
+    {
+        TestQuery(Index, Masks[i], Seen);
+    }
+
+    //
+    // Masks that are made from the names (some of their parts are replaced
+    // by the wildcards)
+    //
+    for (UINT32 i = 0; i < RandomMaskCount; i++)
+    {
+        const CHAR * Name   = Index->Names[TestRandom(&Seed) % Index->NameCount];
+        UINT32       Length = 0;
+
+        for (const CHAR * Ch = Name; *Ch != '\0' && Length + 2 < sizeof(Mask); Ch++)
+        {
+            UINT32 Random = TestRandom(&Seed) % 16;
+
+            if (Random == 0)
+            {
+                Mask[Length++] = '*';
+
+                while (Ch[1] != '\0' && TestRandom(&Seed) % 3 != 0)
+                {
+                    Ch++;
+                }
+            }
+            else if (Random == 1)
+            {
+                Mask[Length++] = '?';
+            }
+            else
+            {
+                Mask[Length++] = (TestRandom(&Seed) % 2) ? *Ch : (CHAR)tolower((UINT8)*Ch);
+            }
+        }
+
+        Mask[Length] = '\0';
+
+        TEST_CHECK(TestQuery(Index, Mask, Seen) != 0);
+    }
+
+    free(Seen);
+}
+
+/**
+ * @brief Measure a query and checking all of the names for the same mask
+ *
+ * @param Index
+ * @param Mask
+ *
+ * @return VOID
+ */
+static VOID
+TestMeasureQuery(PSYMBOL_SEARCH_INDEX Index, const CHAR * Mask)
+{
+    SYMBOL_SEARCH_ITERATOR Iterator;
+    UINT64                 Start;
+    UINT64                 QueryTime;
+    UINT64                 ScanTime;
+    UINT32                 Results     = 0;
+    UINT32                 ScanResults = 0;
+
+    Start = TestGetTime();
+
+    for (UINT32 Repeat = 0; Repeat < TEST_QUERY_REPEATS; Repeat++)
+    {
+        SymbolSearchBeginQuery(Index, &Iterator, Mask);
+
+        while (SymbolSearchGetNext(&Iterator) != SYMBOL_SEARCH_NO_NAME)
+        {
+            Results++;
+        }
+    }
+
+    QueryTime = (TestGetTime() - Start) / TEST_QUERY_REPEATS;
+    Start     = TestGetTime();
+
+    for (UINT32 Repeat = 0; Repeat < TEST_QUERY_REPEATS; Repeat++)
+    {
+        for (UINT32 i = 0; i < Index->NameCount; i++)
+        {
+            ScanResults += SymbolSearchMatch(Index->Names[i], Mask);
+        }
+    }
+
+    ScanTime = (TestGetTime() - Start) / TEST_QUERY_REPEATS;
+
+    TEST_CHECK(Results == ScanResults);
+
+    printf("[*] %-24s %7u results, index: %8.3f ms, checking all of the names: %8.3f ms\n",
+           Mask,
+           Results / TEST_QUERY_REPEATS,
+           QueryTime / 1000000.0,
+           ScanTime / 1000000.0);
+}
+
+int
+main()
+{
+    SYMBOL_SEARCH_INDEX Index;
+    CHAR **             Names;
+    VOID *              Storage;
+    UINT64              StorageSize;
+    UINT64              Start;
+
+    TestMatcher();
+
+    Names = TestGenerateNames(TEST_NAME_COUNT);
+
+    //
+    // Empty index
+    //
+    TEST_CHECK(SymbolSearchGetRequiredSize((const CHAR * const *)Names, 0, &StorageSize));
+
+    Storage = malloc(StorageSize);
+    TEST_CHECK(Storage != NULL);
+    TEST_CHECK(SymbolSearchInitialize(&Index, Storage, StorageSize, (const CHAR * const *)Names, 0));
+
+    {
+        SYMBOL_SEARCH_ITERATOR Iterator;
+
+        SymbolSearchBeginQuery(&Index, &Iterator, "*");
+        TEST_CHECK(SymbolSearchGetNext(&Iterator) == SYMBOL_SEARCH_NO_NAME);
+    }
+
+    free(Storage);
+
+    //
+    // Small index (all of the names are checked by the queries)
+    //
+    TEST_CHECK(SymbolSearchGetRequiredSize((const CHAR * const *)Names, 5000, &StorageSize));
+
+    Storage = malloc(StorageSize);
+    TEST_CHECK(Storage != NULL);
+    TEST_CHECK(!SymbolSearchInitialize(&Index, Storage, StorageSize - 1, (const CHAR * const *)Names, 5000));
+    TEST_CHECK(SymbolSearchInitialize(&Index, Storage, StorageSize, (const CHAR * const *)Names, 5000));
+
+    TestQueries(&Index, 1000);
+
+    free(Storage);
+
+    //
+    // The synthetic symbol table
+    //
+    TEST_CHECK(SymbolSearchGetRequiredSize((const CHAR * const *)Names, TEST_NAME_COUNT, &StorageSize));
+
+    Storage = malloc(StorageSize);
+    TEST_CHECK(Storage != NULL);
+
+    Start = TestGetTime();
+    TEST_CHECK(SymbolSearchInitialize(&Index, Storage, StorageSize, (const CHAR * const *)Names, TEST_NAME_COUNT));
+
+    printf("[*] %u names, index: %llu bytes, build: %.1f ms\n",
+           TEST_NAME_COUNT,
+           StorageSize,
+           (TestGetTime() - Start) / 1000000.0);
+
+    TestQueries(&Index, 20);
+
+    TestMeasureQuery(&Index, "ExAllocate*");
+    TestMeasureQuery(&Index, "*WithTag");
+    TestMeasureQuery(&Index, "*Pool*");
+    TestMeasureQuery(&Index, "*Pool*Tag");
+    TestMeasureQuery(&Index, "*NotifyRoutine*");
+    TestMeasureQuery(&Index, "Ke*Dpc*Ex");
+    TestMeasureQuery(&Index, "*12345*");
+    TestMeasureQuery(&Index, "*Zzz*");
+    TestMeasureQuery(&Index, "*Tb");
+    TestMeasureQuery(&Index, "*");
+
+    free(Storage);
+    free(Names);
+
+    printf("[+] all of the symbol search tests passed\n");
+
+    return 0;
+}
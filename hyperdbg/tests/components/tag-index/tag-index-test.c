@@ -0,0 +1,503 @@
+/**
+ * @file tag-index-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and lookup benchmark of the tag index
+ * @details The lists of the debugger events are mocked (the same layout as
+ * DEBUGGER_CORE_EVENTS) and the events that are found by the index are
+ * compared with walking the lists after random registrations and removals
+ * (including the tags out of the dense range, the duplicated tags and a full
+ * index), then enabling and disabling the events by their tags is measured.
+ * Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o tag-index-test tag-index-test.c \
+ *       ../../../include/components/tagindex/code/TagIndex.c \
+ *       ../../../include/components/hashindex/code/HashIndex.c
+ *   ./tag-index-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief The first tag (the same as DebuggerEventTagStartSeed)
+ *
+ */
+#define TEST_TAG_START_SEED 0x1000000
+
+/**
+ * @brief Number of the lists of the events (the same as the number of the
+ * lists in DEBUGGER_CORE_EVENTS)
+ *
+ */
+#define TEST_EVENT_LISTS 26
+
+/**
+ * @brief Maximum number of the simulated events
+ *
+ */
+#define TEST_MAXIMUM_EVENTS 4096
+
+/**
+ * @brief Number of random operations
+ *
+ */
+#define TEST_OPERATIONS 1000000
+
+/**
+ * @brief Number of lookups of each benchmark
+ *
+ */
+#define BENCHMARK_LOOKUPS 1000000
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief Get the structure of a list entry (the same as CONTAINING_RECORD)
+ *
+ */
+#define TEST_CONTAINING_RECORD(Address, Type, Field) ((Type *)((UINT8 *)(Address) - offsetof(Type, Field)))
+
+/**
+ * @brief A mocked LIST_ENTRY
+ *
+ */
+typedef struct _TEST_LIST_ENTRY
+{
+    struct _TEST_LIST_ENTRY * Flink;
+    struct _TEST_LIST_ENTRY * Blink;
+
+} TEST_LIST_ENTRY, *PTEST_LIST_ENTRY;
+
+/**
+ * @brief A simulated event (similar to DEBUGGER_EVENT)
+ *
+ */
+typedef struct _TEST_EVENT
+{
+    UINT64          Tag;
+    TEST_LIST_ENTRY EventsOfSameTypeList;
+    UINT32          EventType;
+    BOOLEAN         Enabled;
+    BOOLEAN         IsRegistered;
+
+} TEST_EVENT, *PTEST_EVENT;
+
+TEST_LIST_ENTRY g_TestEvents[TEST_EVENT_LISTS];
+TAG_INDEX       g_TestTagIndex;
+UINT64          g_RandomState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+
+    return g_RandomState;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Initialize the lists of the events and the index of the tags
+ *
+ * @param DenseCount
+ * @param OverflowCapacity
+ *
+ * @return VOID
+ */
+static VOID
+TestInitialize(UINT32 DenseCount, UINT32 OverflowCapacity)
+{
+    free((PVOID)g_TestTagIndex.DenseTable);
+
+    for (UINT32 i = 0; i < TEST_EVENT_LISTS; i++)
+    {
+        g_TestEvents[i].Flink = &g_TestEvents[i];
+        g_TestEvents[i].Blink = &g_TestEvents[i];
+    }
+
+    TEST_CHECK(TagIndexInitialize(&g_TestTagIndex,
+                                  malloc(TagIndexGetRequiredSize(DenseCount, OverflowCapacity)),
+                                  TEST_TAG_START_SEED,
+                                  DenseCount,
+                                  OverflowCapacity));
+}
+
+/**
+ * @brief Register an event (the same as DebuggerRegisterEvent)
+ *
+ * @param Event
+ *
+ * @return VOID
+ */
+static VOID
+TestRegisterEvent(PTEST_EVENT Event)
+{
+    PTEST_LIST_ENTRY Head = &g_TestEvents[Event->EventType];
+
+    //
+    // InsertHeadList
+    //
+    Event->EventsOfSameTypeList.Flink = Head->Flink;
+    Event->EventsOfSameTypeList.Blink = Head;
+    Head->Flink->Blink                = &Event->EventsOfSameTypeList;
+    Head->Flink                       = &Event->EventsOfSameTypeList;
+
+    Event->IsRegistered = TRUE;
+
+    TagIndexInsert(&g_TestTagIndex, Event->Tag, Event);
+}
+
+/**
+ * @brief Find an event by walking the lists (the same as DebuggerGetEventByTag
+ * without the index)
+ *
+ * @param Tag
+ *
+ * @return PTEST_EVENT
+ */
+static PTEST_EVENT
+TestGetEventByTagFromLists(UINT64 Tag)
+{
+    for (UINT32 i = 0; i < TEST_EVENT_LISTS; i++)
+    {
+        for (PTEST_LIST_ENTRY Entry = g_TestEvents[i].Flink; Entry != &g_TestEvents[i]; Entry = Entry->Flink)
+        {
+            PTEST_EVENT CurrentEvent = TEST_CONTAINING_RECORD(Entry, TEST_EVENT, EventsOfSameTypeList);
+
+            if (CurrentEvent->Tag == Tag)
+            {
+                return CurrentEvent;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Find an event by its tag (the same as DebuggerGetEventByTag)
+ *
+ * @param Tag
+ *
+ * @return PTEST_EVENT
+ */
+static PTEST_EVENT
+TestGetEventByTag(UINT64 Tag)
+{
+    if (TagIndexIsComplete(&g_TestTagIndex))
+    {
+        return (PTEST_EVENT)TagIndexFind(&g_TestTagIndex, Tag);
+    }
+
+    return TestGetEventByTagFromLists(Tag);
+}
+
+/**
+ * @brief Remove an event by its tag (the same as DebuggerRemoveEventFromEventList)
+ *
+ * @param Tag
+ *
+ * @return BOOLEAN
+ */
+static BOOLEAN
+TestRemoveEventFromEventList(UINT64 Tag)
+{
+    PTEST_EVENT Event = TestGetEventByTag(Tag);
+
+    if (Event == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // RemoveEntryList
+    //
+    Event->EventsOfSameTypeList.Blink->Flink = Event->EventsOfSameTypeList.Flink;
+    Event->EventsOfSameTypeList.Flink->Blink = Event->EventsOfSameTypeList.Blink;
+
+    Event->IsRegistered = FALSE;
+
+    TagIndexRemove(&g_TestTagIndex, Event->Tag, Event);
+
+    return TRUE;
+}
+
+/**
+ * @brief Get a random tag of the test (mostly sequential tags)
+ *
+ * @param NextTag The next sequential tag
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandomTag(UINT64 NextTag)
+{
+    UINT32 Random = (UINT32)(TestRandom() % 100);
+
+    if (Random < 5)
+    {
+        //
+        // A tag out of the dense range
+        //
+        return TestRandom() % 4 == 0 ? TestRandom() % TEST_TAG_START_SEED : TEST_TAG_START_SEED + 0x100000 + TestRandom() % 0x10000;
+    }
+    else if (Random < 10 && NextTag != TEST_TAG_START_SEED)
+    {
+        //
+        // A duplicated (or a recently removed) tag
+        //
+        return NextTag - 1 - TestRandom() % 16;
+    }
+
+    return NextTag;
+}
+
+/**
+ * @brief Compare the index with the lists after random operations
+ *
+ * @param DenseCount
+ * @param OverflowCapacity
+ *
+ * @return VOID
+ */
+static VOID
+TestRandomOperations(UINT32 DenseCount, UINT32 OverflowCapacity)
+{
+    PTEST_EVENT Events               = calloc(TEST_MAXIMUM_EVENTS, sizeof(TEST_EVENT));
+    UINT64      NextTag              = TEST_TAG_START_SEED;
+    UINT32      Count                = 0;
+    UINT32      IncompleteOperations = 0;
+
+    TEST_CHECK(Events != NULL);
+
+    TestInitialize(DenseCount, OverflowCapacity);
+
+    for (UINT32 Operation = 0; Operation < TEST_OPERATIONS; Operation++)
+    {
+        UINT32      Random = (UINT32)(TestRandom() % 100);
+        PTEST_EVENT Event;
+        UINT64      Tag;
+
+        if (Random < 30)
+        {
+            //
+            // Register a new event (in a free slot)
+            //
+            Event = &Events[TestRandom() % TEST_MAXIMUM_EVENTS];
+
+            if (Event->IsRegistered)
+            {
+                continue;
+            }
+
+            Event->Tag       = TestRandomTag(NextTag);
+            Event->EventType = (UINT32)(TestRandom() % TEST_EVENT_LISTS);
+            Event->Enabled   = FALSE;
+
+            if (Event->Tag == NextTag)
+            {
+                NextTag++;
+            }
+
+            TestRegisterEvent(Event);
+            Count++;
+        }
+        else if (Random < 55)
+        {
+            //
+            // Remove an event (or a tag that doesn't exist)
+            //
+            Event = &Events[TestRandom() % TEST_MAXIMUM_EVENTS];
+            Tag   = Event->IsRegistered ? Event->Tag : TestRandomTag(NextTag);
+
+            if (TestRemoveEventFromEventList(Tag))
+            {
+                Count--;
+            }
+        }
+        else if (Random < 56)
+        {
+            //
+            // Clear all of the events (a new session, the tags start from
+            // the seed again)
+            //
+            while (Count != 0)
+            {
+                for (UINT32 i = 0; i < TEST_MAXIMUM_EVENTS; i++)
+                {
+                    if (Events[i].IsRegistered && TestRemoveEventFromEventList(Events[i].Tag))
+                    {
+                        Count--;
+                    }
+                }
+            }
+
+            TEST_CHECK(TagIndexIsComplete(&g_TestTagIndex) && g_TestTagIndex.Count == 0);
+
+            NextTag = TEST_TAG_START_SEED;
+        }
+        else
+        {
+            //
+            // Enable, disable or query an event
+            //
+            Event = &Events[TestRandom() % TEST_MAXIMUM_EVENTS];
+            Tag   = Event->IsRegistered && TestRandom() % 4 != 0 ? Event->Tag : TestRandomTag(NextTag);
+            Event = TestGetEventByTag(Tag);
+
+            TEST_CHECK(Event == TestGetEventByTagFromLists(Tag));
+
+            if (Event != NULL)
+            {
+                Event->Enabled = !Event->Enabled;
+            }
+        }
+
+        if (!TagIndexIsComplete(&g_TestTagIndex))
+        {
+            IncompleteOperations++;
+        }
+    }
+
+    printf("[+] dense %u, overflow %u: %u of %u operations walked the lists\n",
+           DenseCount,
+           OverflowCapacity,
+           IncompleteOperations,
+           TEST_OPERATIONS);
+
+    free(Events);
+}
+
+/**
+ * @brief Compare enabling and disabling the events with and without the index
+ *
+ * @param EventCount Number of registered events
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun(UINT32 EventCount)
+{
+    PTEST_EVENT Events = calloc(EventCount, sizeof(TEST_EVENT));
+    UINT64 *    Tags   = malloc(BENCHMARK_LOOKUPS * sizeof(UINT64));
+    UINT64      StartTime;
+    UINT64      ListTime;
+    UINT64      IndexTime;
+
+    TEST_CHECK(Events != NULL && Tags != NULL);
+
+    TestInitialize(8192, 2048);
+
+    for (UINT32 i = 0; i < EventCount; i++)
+    {
+        Events[i].Tag       = TEST_TAG_START_SEED + i;
+        Events[i].EventType = (UINT32)(TestRandom() % TEST_EVENT_LISTS);
+
+        TestRegisterEvent(&Events[i]);
+    }
+
+    TEST_CHECK(TagIndexIsComplete(&g_TestTagIndex));
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        Tags[i] = TEST_TAG_START_SEED + TestRandom() % EventCount;
+    }
+
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        PTEST_EVENT Event = TestGetEventByTagFromLists(Tags[i]);
+
+        Event->Enabled = !Event->Enabled;
+    }
+
+    ListTime  = TestGetTime() - StartTime;
+    StartTime = TestGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_LOOKUPS; i++)
+    {
+        PTEST_EVENT Event = TestGetEventByTag(Tags[i]);
+
+        Event->Enabled = !Event->Enabled;
+    }
+
+    IndexTime = TestGetTime() - StartTime;
+
+    //
+    // Each event is toggled an even number of times
+    //
+    for (UINT32 i = 0; i < EventCount; i++)
+    {
+        TEST_CHECK(!Events[i].Enabled);
+    }
+
+    printf("%-8u %14.1f %14.1f %9.1fx\n",
+           EventCount,
+           (double)ListTime / BENCHMARK_LOOKUPS,
+           (double)IndexTime / BENCHMARK_LOOKUPS,
+           (double)ListTime / IndexTime);
+
+    free(Events);
+    free(Tags);
+}
+
+/**
+ * @brief Main function of the tag index tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestRandomOperations(8192, 2048);
+    TestRandomOperations(256, 64);
+    TestRandomOperations(0, 2);
+
+    printf("[+] all of the tag index tests passed\n\n");
+
+    printf("%-8s %14s %14s %10s\n", "events", "list (ns)", "index (ns)", "speedup");
+
+    for (UINT32 EventCount = 10; EventCount <= 1000; EventCount *= 10)
+    {
+        BenchmarkRun(EventCount);
+    }
+
+    return 0;
+}
@@ -0,0 +1,763 @@
+/**
+ * @file track-trace-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests and benchmark of the records of tracking the instructions
+ * @details The execution of a program is simulated (calls to the functions of
+ * a few modules, returns, longjmps and deep recursions), its 'call' and 'ret'
+ * instructions are appended to the buffers the same as the debuggee, and the
+ * records that are decoded from the buffers and the call tree that is built
+ * from them are compared with the simulation. The size of the records and the
+ * number of packets are also compared with stepping (and sending a pausing
+ * packet for) each instruction. Build and run it from this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o track-trace-test track-trace-test.c \
+ *       ../../../include/components/tracktrace/code/TrackTrace.c
+ *   ./track-trace-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Maximum depth of the simulated calls
+ *
+ */
+#define TEST_MAXIMUM_DEPTH 4096
+
+/**
+ * @brief Number of the simulated 'call' and 'ret' instructions
+ *
+ */
+#define TEST_RECORD_COUNT 2000000
+
+/**
+ * @brief Number of the instructions between each 'call' or 'ret' in the
+ * benchmark (roughly the average of the kernel code)
+ *
+ */
+#define BENCHMARK_INSTRUCTIONS_PER_RECORD 12
+
+/**
+ * @brief Size of the packets of stepping one instruction for tracking (the
+ * DEBUGGER_REMOTE_PACKET and the DEBUGGEE_STEP_PACKET to the debuggee, then
+ * the DEBUGGER_REMOTE_PACKET and the DEBUGGEE_KD_PAUSED_PACKET back)
+ *
+ */
+#define BENCHMARK_STEP_ROUND_TRIP_BYTES (24 + 12 + 24 + 72)
+
+/**
+ * @brief Check a condition and exit if it fails
+ *
+ */
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief A record and the node that is expected from the call tree
+ *
+ */
+typedef struct _TEST_EXPECTED_NODE
+{
+    TRACK_TRACE_RECORD Record;
+    UINT32             Depth;
+    BOOLEAN            IsMatched;
+
+} TEST_EXPECTED_NODE, *PTEST_EXPECTED_NODE;
+
+/**
+ * @brief State of the simulated program
+ *
+ */
+typedef struct _TEST_PROGRAM
+{
+    UINT64  ReturnAddresses[TEST_MAXIMUM_DEPTH];
+    UINT32  Depth;
+    UINT32  KnownFrames; // Frames that are expected to be in the ring of the tree
+    UINT64  CurrentAddress;
+    UINT32  MaximumDepth;
+    BOOLEAN AllowLongJumps;
+
+} TEST_PROGRAM, *PTEST_PROGRAM;
+
+UINT64 g_RandomState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief Bases of the simulated modules
+ *
+ */
+static const UINT64 g_TestModules[] = {
+    0xfffff80112340000ull, // nt
+    0xfffff80156780000ull, // a driver
+    0x00007ffd9abc0000ull, // ntdll
+    0x0000000140000000ull, // a user-mode program
+};
+
+/**
+ * @brief Get a pseudo-random number
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandom()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+
+    return g_RandomState;
+}
+
+/**
+ * @brief Get the current time in nanoseconds
+ *
+ * @return UINT64
+ */
+static UINT64
+TestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Get an address in a random function of the simulated modules
+ * @details Most of the calls are to the same module
+ *
+ * @param CurrentAddress
+ *
+ * @return UINT64
+ */
+static UINT64
+TestRandomFunction(UINT64 CurrentAddress)
+{
+    UINT64 Base = CurrentAddress & ~0xfffffull;
+
+    if (TestRandom() % 8 == 0)
+    {
+        Base = g_TestModules[TestRandom() % (sizeof(g_TestModules) / sizeof(g_TestModules[0]))];
+    }
+
+    return Base + ((TestRandom() % 0x100000) & ~0xfull);
+}
+
+/**
+ * @brief Simulate the next 'call' or 'ret' of the program
+ *
+ * @param Program
+ * @param Expected
+ *
+ * @return VOID
+ */
+static VOID
+TestProgramNext(PTEST_PROGRAM Program, PTEST_EXPECTED_NODE Expected)
+{
+    static const UINT32 CallLengths[] = {5, 6, 2, 3, 7};
+    UINT32              Random        = (UINT32)(TestRandom() % 100);
+    TRACK_TRACE_RECORD * Record       = &Expected->Record;
+
+    //
+    // The code runs forward until the next 'call' or 'ret'
+    //
+    Record->Rip = Program->CurrentAddress + TestRandom() % 0x100;
+
+    if (Program->Depth < Program->MaximumDepth && (Random < 50 || (Program->Depth == 0 && Random < 95)))
+    {
+        Record->Kind   = TRACK_TRACE_KIND_CALL;
+        Record->Length = CallLengths[TestRandom() % (sizeof(CallLengths) / sizeof(CallLengths[0]))];
+        Record->Target = TestRandomFunction(Record->Rip);
+
+        Expected->Depth     = Program->Depth;
+        Expected->IsMatched = FALSE;
+
+        Program->ReturnAddresses[Program->Depth++] = Record->Rip + Record->Length;
+
+        if (Program->KnownFrames < TRACK_TRACE_MAXIMUM_FRAMES)
+        {
+            Program->KnownFrames++;
+        }
+    }
+    else if (Program->Depth == 0)
+    {
+        //
+        // Return from a function that is called before the tracking
+        //
+        Record->Kind   = TRACK_TRACE_KIND_RET;
+        Record->Length = 1;
+        Record->Target = TestRandomFunction(Record->Rip) + TestRandom() % 0x10;
+
+        Expected->Depth     = 0;
+        Expected->IsMatched = FALSE;
+    }
+    else
+    {
+        UINT32 Popped = 1;
+
+        Record->Kind   = TRACK_TRACE_KIND_RET;
+        Record->Length = TestRandom() % 4 == 0 ? 3 : 1; // ret imm16
+
+        //
+        // Skip a few frames (e.g., an exception or a longjmp), if the return
+        // address is not the same as a skipped frame (otherwise, it's not
+        // distinguishable from returning to that frame)
+        //
+        if (Program->AllowLongJumps && Random >= 98)
+        {
+            Popped = 1 + (UINT32)(TestRandom() % Program->Depth);
+
+            for (UINT32 i = 1; i < Popped; i++)
+            {
+                if (Program->ReturnAddresses[Program->Depth - i] == Program->ReturnAddresses[Program->Depth - Popped])
+                {
+                    Popped = 1;
+                    break;
+                }
+            }
+        }
+
+        Program->Depth -= Popped;
+
+        Record->Target = Program->ReturnAddresses[Program->Depth];
+
+        Expected->Depth     = Program->Depth;
+        Expected->IsMatched = Program->KnownFrames >= Popped;
+
+        Program->KnownFrames -= Program->KnownFrames >= Popped ? Popped : Program->KnownFrames;
+    }
+
+    Program->CurrentAddress = Record->Target;
+}
+
+/**
+ * @brief Check the records and the call tree of a buffer
+ *
+ * @param TraceBuffer
+ * @param Tree
+ * @param Expected
+ * @param ExpectedCount
+ *
+ * @return VOID
+ */
+static VOID
+TestCheckBuffer(PTRACK_TRACE_BUFFER TraceBuffer,
+                PTRACK_TRACE_TREE   Tree,
+                PTEST_EXPECTED_NODE Expected,
+                UINT32              ExpectedCount)
+{
+    TRACK_TRACE_RECORD Record;
+    TRACK_TRACE_NODE   Node;
+    UINT64             PreviousTarget = 0;
+    UINT32             Offset         = 0;
+    UINT32             Size;
+
+    TEST_CHECK(TraceBuffer->RecordCount == ExpectedCount);
+
+    for (UINT32 i = 0; i < ExpectedCount; i++)
+    {
+        Size = TrackTraceDecode(&TraceBuffer->Data[Offset], TraceBuffer->Size - Offset, PreviousTarget, &Record);
+
+        TEST_CHECK(Size != 0 && Size <= TRACK_TRACE_MAXIMUM_RECORD_SIZE);
+        TEST_CHECK(Record.Rip == Expected[i].Record.Rip);
+        TEST_CHECK(Record.Target == Expected[i].Record.Target);
+        TEST_CHECK(Record.Kind == Expected[i].Record.Kind);
+        TEST_CHECK(Record.Length == Expected[i].Record.Length);
+
+        TrackTraceTreeAdd(Tree, &Record, &Node);
+
+        TEST_CHECK(Node.Rip == Record.Rip && Node.Target == Record.Target && Node.Kind == Record.Kind);
+        TEST_CHECK(Node.Depth == Expected[i].Depth);
+        TEST_CHECK(Node.IsMatched == Expected[i].IsMatched);
+
+        PreviousTarget = Record.Target;
+        Offset += Size;
+    }
+
+    TEST_CHECK(Offset == TraceBuffer->Size);
+    TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE + TraceBuffer->Size));
+}
+
+/**
+ * @brief Test the example of the illustration
+ *
+ * @return VOID
+ */
+static VOID
+TestIllustration()
+{
+    static const BYTE  ExpectedCall[] = {0x15, 0x20, 0xd6, 0xbf, 0x02};
+    static const BYTE  ExpectedRet[]  = {0x06, 0x84, 0x01, 0xdb, 0xc0, 0x02};
+    TRACK_TRACE_RECORD Call           = {0xfffff80112340010ull, 0xfffff80112345000ull, TRACK_TRACE_KIND_CALL, 5};
+    TRACK_TRACE_RECORD Ret            = {0xfffff80112345042ull, 0xfffff80112340015ull, TRACK_TRACE_KIND_RET, 1};
+    BYTE               Buffer[TRACK_TRACE_MAXIMUM_RECORD_SIZE];
+
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), 0xfffff80112340000ull, &Call) == sizeof(ExpectedCall));
+    TEST_CHECK(memcmp(Buffer, ExpectedCall, sizeof(ExpectedCall)) == 0);
+
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), Call.Target, &Ret) == sizeof(ExpectedRet));
+    TEST_CHECK(memcmp(Buffer, ExpectedRet, sizeof(ExpectedRet)) == 0);
+}
+
+/**
+ * @brief Test the extreme and the invalid records
+ *
+ * @return VOID
+ */
+static VOID
+TestEncoding()
+{
+    static const UINT64 Values[] = {0, 1, 0x7f, 0x80, 0xfffff80112340000ull, 0x7fffffffffffffffull, 0x8000000000000000ull, ~0ull, ~0ull - 1};
+    TRACK_TRACE_RECORD  Record;
+    TRACK_TRACE_RECORD  Decoded;
+    BYTE                Buffer[TRACK_TRACE_MAXIMUM_RECORD_SIZE + 1];
+    UINT32              Size;
+
+    for (UINT32 i = 0; i < sizeof(Values) / sizeof(Values[0]); i++)
+    {
+        for (UINT32 j = 0; j < sizeof(Values) / sizeof(Values[0]); j++)
+        {
+            for (UINT32 k = 0; k < sizeof(Values) / sizeof(Values[0]); k++)
+            {
+                Record.Rip    = Values[i];
+                Record.Target = Values[j];
+                Record.Kind   = (i + j + k) % 2 ? TRACK_TRACE_KIND_CALL : TRACK_TRACE_KIND_RET;
+                Record.Length = 1 + (i + j) % 15;
+
+                Size = TrackTraceEncode(Buffer, sizeof(Buffer), Values[k], &Record);
+
+                TEST_CHECK(Size != 0 && Size <= TRACK_TRACE_MAXIMUM_RECORD_SIZE);
+                TEST_CHECK(TrackTraceDecode(Buffer, Size, Values[k], &Decoded) == Size);
+                TEST_CHECK(memcmp(&Record, &Decoded, sizeof(TRACK_TRACE_RECORD)) == 0);
+
+                //
+                // Truncated records and too small buffers
+                //
+                for (UINT32 Truncated = 0; Truncated < Size; Truncated++)
+                {
+                    TEST_CHECK(TrackTraceDecode(Buffer, Truncated, Values[k], &Decoded) == 0);
+                    TEST_CHECK(TrackTraceEncode(Buffer, Truncated, Values[k], &Record) == 0);
+                }
+
+                TEST_CHECK(TrackTraceEncode(Buffer, Size, Values[k], &Record) == Size);
+            }
+        }
+    }
+
+    //
+    // The largest record
+    //
+    Record.Rip    = 0x8000000000000000ull;
+    Record.Target = 0x8000000000000000ull + 15 + 0x8000000000000000ull;
+    Record.Kind   = TRACK_TRACE_KIND_RET;
+    Record.Length = 15;
+
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), 0, &Record) == TRACK_TRACE_MAXIMUM_RECORD_SIZE);
+
+    //
+    // Invalid records
+    //
+    Record.Rip    = 0x1000;
+    Record.Target = 0x2000;
+    Record.Kind   = TRACK_TRACE_KIND_NONE;
+    Record.Length = 5;
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), 0, &Record) == 0);
+
+    Record.Kind   = TRACK_TRACE_KIND_CALL;
+    Record.Length = 0;
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), 0, &Record) == 0);
+
+    Record.Length = 16;
+    TEST_CHECK(TrackTraceEncode(Buffer, sizeof(Buffer), 0, &Record) == 0);
+
+    //
+    // Invalid headers and overlong values
+    //
+    memset(Buffer, 0, sizeof(Buffer));
+
+    Buffer[0] = 0x14; // no kind
+    TEST_CHECK(TrackTraceDecode(Buffer, 3, 0, &Decoded) == 0);
+
+    Buffer[0] = 0x03; // invalid kind
+    TEST_CHECK(TrackTraceDecode(Buffer, 3, 0, &Decoded) == 0);
+
+    Buffer[0] = 0x01; // no length
+    TEST_CHECK(TrackTraceDecode(Buffer, 3, 0, &Decoded) == 0);
+
+    Buffer[0] = 0x55; // reserved bits
+    TEST_CHECK(TrackTraceDecode(Buffer, 3, 0, &Decoded) == 0);
+
+    Buffer[0] = 0x15;
+    TEST_CHECK(TrackTraceDecode(Buffer, 3, 0, &Decoded) == 3);
+
+    memset(&Buffer[1], 0xff, 9);
+    Buffer[10] = 0x02; // more than 64 bits
+    Buffer[11] = 0x00;
+    TEST_CHECK(TrackTraceDecode(Buffer, sizeof(Buffer), 0, &Decoded) == 0);
+
+    Buffer[10] = 0x81; // more than ten bytes
+    TEST_CHECK(TrackTraceDecode(Buffer, sizeof(Buffer), 0, &Decoded) == 0);
+
+    Buffer[10] = 0x01;
+    TEST_CHECK(TrackTraceDecode(Buffer, sizeof(Buffer), 0, &Decoded) == 12);
+}
+
+/**
+ * @brief Test the buffers and the call tree with a simulated program
+ *
+ * @param MaximumDepth
+ * @param AllowLongJumps
+ *
+ * @return VOID
+ */
+static VOID
+TestProgram(UINT32 MaximumDepth, BOOLEAN AllowLongJumps)
+{
+    PTRACK_TRACE_BUFFER TraceBuffer   = malloc(sizeof(TRACK_TRACE_BUFFER));
+    PTRACK_TRACE_TREE   Tree          = malloc(sizeof(TRACK_TRACE_TREE));
+    PTEST_PROGRAM       Program       = calloc(1, sizeof(TEST_PROGRAM));
+    PTEST_EXPECTED_NODE Expected      = malloc(TRACK_TRACE_BUFFER_SIZE * sizeof(TEST_EXPECTED_NODE));
+    UINT32              ExpectedCount = 0;
+    UINT32              BufferCount   = 0;
+    UINT32              LargestDepth  = 0;
+
+    TEST_CHECK(TraceBuffer != NULL && Tree != NULL && Program != NULL && Expected != NULL);
+
+    Program->CurrentAddress = g_TestModules[0] + 0x1000;
+    Program->MaximumDepth   = MaximumDepth;
+    Program->AllowLongJumps = AllowLongJumps;
+
+    TrackTraceBufferReset(TraceBuffer);
+    TrackTraceTreeInitialize(Tree);
+
+    for (UINT32 i = 0; i < TEST_RECORD_COUNT; i++)
+    {
+        TestProgramNext(Program, &Expected[ExpectedCount]);
+
+        if (Program->Depth > LargestDepth)
+        {
+            LargestDepth = Program->Depth;
+        }
+
+        if (!TrackTraceBufferAdd(TraceBuffer, &Expected[ExpectedCount].Record))
+        {
+            //
+            // The buffer is full, send it and add the record to the next buffer
+            //
+            TEST_CHECK(TraceBuffer->Size > TRACK_TRACE_BUFFER_SIZE - TRACK_TRACE_MAXIMUM_RECORD_SIZE);
+
+            TestCheckBuffer(TraceBuffer, Tree, Expected, ExpectedCount);
+            BufferCount++;
+
+            TrackTraceBufferReset(TraceBuffer);
+            Expected[0]   = Expected[ExpectedCount];
+            ExpectedCount = 0;
+
+            TEST_CHECK(TrackTraceBufferAdd(TraceBuffer, &Expected[0].Record));
+        }
+
+        ExpectedCount++;
+    }
+
+    TestCheckBuffer(TraceBuffer, Tree, Expected, ExpectedCount);
+    TEST_CHECK(Tree->Depth == Program->Depth);
+
+    printf("[+] %u records in %u buffers (depth up to %u, %s) are checked\n",
+           TEST_RECORD_COUNT,
+           BufferCount + 1,
+           LargestDepth,
+           AllowLongJumps ? "with longjmps" : "without longjmps");
+
+    free(TraceBuffer);
+    free(Tree);
+    free(Program);
+    free(Expected);
+}
+
+/**
+ * @brief Test the calls that are deeper than the frames of the tree
+ *
+ * @return VOID
+ */
+static VOID
+TestDeepCalls()
+{
+    TRACK_TRACE_TREE   Tree;
+    TRACK_TRACE_NODE   Node;
+    TRACK_TRACE_RECORD Record;
+    UINT32             Depth = TRACK_TRACE_MAXIMUM_FRAMES * 3 + 7;
+
+    TrackTraceTreeInitialize(&Tree);
+
+    for (UINT32 Round = 0; Round < 3; Round++)
+    {
+        //
+        // A recursion (the same return address) and then different callers
+        //
+        for (UINT32 i = 0; i < Depth; i++)
+        {
+            Record.Kind   = TRACK_TRACE_KIND_CALL;
+            Record.Length = 5;
+            Record.Rip    = i < Depth / 2 ? 0x1000 : 0x2000 + i * 0x10;
+            Record.Target = 0x1000;
+
+            TrackTraceTreeAdd(&Tree, &Record, &Node);
+            TEST_CHECK(Node.Depth == i);
+        }
+
+        for (UINT32 i = Depth; i > 0; i--)
+        {
+            Record.Kind   = TRACK_TRACE_KIND_RET;
+            Record.Length = 1;
+            Record.Rip    = 0x1100;
+            Record.Target = (i - 1 < Depth / 2 ? 0x1000 : 0x2000 + (i - 1) * 0x10) + 5;
+
+            TrackTraceTreeAdd(&Tree, &Record, &Node);
+            TEST_CHECK(Node.Depth == i - 1);
+
+            //
+            // The frames of the first calls are overwritten
+            //
+            TEST_CHECK(Node.IsMatched == (Depth - i < TRACK_TRACE_MAXIMUM_FRAMES));
+        }
+
+        //
+        // Returning to a function that is called before the tracking
+        //
+        Record.Target = 0x9000;
+
+        TrackTraceTreeAdd(&Tree, &Record, &Node);
+        TEST_CHECK(Node.Depth == 0 && !Node.IsMatched);
+        TEST_CHECK(Tree.Depth == 0 && Tree.FrameCount == 0);
+    }
+}
+
+/**
+ * @brief Test the checks of the buffers that are received by the debugger
+ * @details The size and the count of the records in a received buffer are
+ * changed the same as a truncated or a corrupted packet
+ *
+ * @return VOID
+ */
+static VOID
+TestReceivedBuffers()
+{
+    PTRACK_TRACE_BUFFER TraceBuffer = malloc(sizeof(TRACK_TRACE_BUFFER));
+    TRACK_TRACE_RECORD  Record;
+    UINT32              LastOffset = 0;
+    UINT32              Size;
+    UINT32              Count;
+
+    TEST_CHECK(TraceBuffer != NULL);
+
+    //
+    // An empty buffer only has the header
+    //
+    TrackTraceBufferReset(TraceBuffer);
+
+    TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE));
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE - 1));
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, 0));
+
+    //
+    // Fill the buffer the same as the debuggee
+    //
+    for (UINT32 i = 0;; i++)
+    {
+        Record.Kind   = i % 3 == 2 ? TRACK_TRACE_KIND_RET : TRACK_TRACE_KIND_CALL;
+        Record.Length = Record.Kind == TRACK_TRACE_KIND_RET ? 1 : 5;
+        Record.Rip    = 0xfffff80112340000ull + i * 0x35;
+        Record.Target = i % 5 == 0 ? 0x7ff612340000ull + i : 0xfffff80112350000ull + i * 0x1234;
+
+        Size = TraceBuffer->Size;
+
+        if (!TrackTraceBufferAdd(TraceBuffer, &Record))
+        {
+            break;
+        }
+
+        LastOffset = Size;
+    }
+
+    Size  = TraceBuffer->Size;
+    Count = TraceBuffer->RecordCount;
+
+    TEST_CHECK(Count > 1 && Size > TRACK_TRACE_BUFFER_SIZE - TRACK_TRACE_MAXIMUM_RECORD_SIZE);
+
+    TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE + Size));
+    TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, sizeof(TRACK_TRACE_BUFFER)));
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE + Size - 1));
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE - 1));
+
+    //
+    // The size is larger than the buffer
+    //
+    TraceBuffer->Size = TRACK_TRACE_BUFFER_SIZE + 1;
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, ~0u));
+
+    TraceBuffer->Size = ~0u;
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, ~0u));
+
+    //
+    // The size cuts the last record
+    //
+    TraceBuffer->Size = Size - 1;
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, sizeof(TRACK_TRACE_BUFFER)));
+
+    TraceBuffer->Size = LastOffset + 1;
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, sizeof(TRACK_TRACE_BUFFER)));
+
+    //
+    // The size drops the last record, so it only matches with one less record
+    //
+    TraceBuffer->Size = LastOffset;
+    TEST_CHECK(!TrackTraceBufferValidate(TraceBuffer, sizeof(TRACK_TRACE_BUFFER)));
+
+    TraceBuffer->RecordCount = Count - 1;
+    TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, TRACK_TRACE_BUFFER_HEADER_SIZE + LastOffset));
+
+    //
+    // The size is larger than the records (the rest of the buffer is not a record)
+    //
+    TraceBuffer->RecordCount = Count;
+    memset(&TraceBuffer->Data[Size], 0, TRACK_TRACE_BUFFER_SIZE - Size);
+
+    for (UINT32 i = Size; i <= TRACK_TRACE_BUFFER_SIZE; i++)
+    {
+        TraceBuffer->Size = i;
+        TEST_CHECK(TrackTraceBufferValidate(TraceBuffer, sizeof(TRACK_TRACE_BUFFER)) == (i == Size));
+    }
+
+    free(TraceBuffer);
+}
+
+/**
+ * @brief Measure the encoding, the decoding and building the call tree
+ *
+ * @return VOID
+ */
+static VOID
+BenchmarkRun()
+{
+    PTRACK_TRACE_RECORD Records     = malloc(TEST_RECORD_COUNT * sizeof(TRACK_TRACE_RECORD));
+    PTRACK_TRACE_BUFFER TraceBuffer = malloc(sizeof(TRACK_TRACE_BUFFER));
+    PTEST_PROGRAM       Program     = calloc(1, sizeof(TEST_PROGRAM));
+    TRACK_TRACE_TREE    Tree;
+    TEST_EXPECTED_NODE  Expected;
+    TRACK_TRACE_RECORD  Record;
+    TRACK_TRACE_NODE    Node;
+    UINT64              TotalSize   = 0;
+    UINT64              BufferCount = 1;
+    UINT64              Checksum    = 0;
+    UINT64              EncodeTime;
+    UINT64              DecodeTime = 0;
+    UINT64              StepBytes;
+    UINT64              Start;
+
+    TEST_CHECK(Records != NULL && TraceBuffer != NULL && Program != NULL);
+
+    Program->CurrentAddress = g_TestModules[0] + 0x1000;
+    Program->MaximumDepth   = 64;
+
+    for (UINT32 i = 0; i < TEST_RECORD_COUNT; i++)
+    {
+        TestProgramNext(Program, &Expected);
+        Records[i] = Expected.Record;
+    }
+
+    TrackTraceTreeInitialize(&Tree);
+    TrackTraceBufferReset(TraceBuffer);
+
+    Start = TestGetTime();
+
+    for (UINT32 i = 0; i < TEST_RECORD_COUNT; i++)
+    {
+        if (!TrackTraceBufferAdd(TraceBuffer, &Records[i]))
+        {
+            TotalSize += TraceBuffer->Size;
+            BufferCount++;
+
+            //
+            // Decoding is measured separately
+            //
+            EncodeTime = TestGetTime();
+
+            for (UINT32 Offset = 0, Size; Offset < TraceBuffer->Size; Offset += Size)
+            {
+                Size = TrackTraceDecode(&TraceBuffer->Data[Offset], TraceBuffer->Size - Offset, Offset == 0 ? 0 : Record.Target, &Record);
+                TrackTraceTreeAdd(&Tree, &Record, &Node);
+                Checksum += Node.Depth;
+            }
+
+            DecodeTime += TestGetTime() - EncodeTime;
+
+            TrackTraceBufferReset(TraceBuffer);
+            TrackTraceBufferAdd(TraceBuffer, &Records[i]);
+        }
+    }
+
+    EncodeTime = TestGetTime() - Start - DecodeTime;
+    TotalSize += TraceBuffer->Size;
+
+    StepBytes = (UINT64)TEST_RECORD_COUNT * BENCHMARK_INSTRUCTIONS_PER_RECORD * BENCHMARK_STEP_ROUND_TRIP_BYTES;
+
+    printf("%-22s %14s %14s %14s\n", "", "per step", "batched", "ratio");
+    printf("%-22s %14llu %14llu %13.1fx\n",
+           "packets",
+           (unsigned long long)TEST_RECORD_COUNT * BENCHMARK_INSTRUCTIONS_PER_RECORD * 2,
+           (unsigned long long)BufferCount,
+           (double)TEST_RECORD_COUNT * BENCHMARK_INSTRUCTIONS_PER_RECORD * 2 / BufferCount);
+    printf("%-22s %14llu %14llu %13.1fx\n",
+           "bytes",
+           (unsigned long long)StepBytes,
+           (unsigned long long)TotalSize,
+           (double)StepBytes / TotalSize);
+    printf("%-22s %14u %14.2f %13.1fx\n",
+           "bytes per record",
+           BENCHMARK_INSTRUCTIONS_PER_RECORD * BENCHMARK_STEP_ROUND_TRIP_BYTES,
+           (double)TotalSize / TEST_RECORD_COUNT,
+           (double)(BENCHMARK_INSTRUCTIONS_PER_RECORD * BENCHMARK_STEP_ROUND_TRIP_BYTES) / ((double)TotalSize / TEST_RECORD_COUNT));
+
+    printf("\nencoding: %.1f M records/s, decoding and building the tree: %.1f M records/s (%llu)\n",
+           TEST_RECORD_COUNT * 1000.0 / EncodeTime,
+           (TEST_RECORD_COUNT - TraceBuffer->RecordCount) * 1000.0 / DecodeTime,
+           (unsigned long long)Checksum);
+
+    free(Records);
+    free(TraceBuffer);
+    free(Program);
+}
+
+/**
+ * @brief Main function of the tests
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestIllustration();
+    TestEncoding();
+    TestDeepCalls();
+    TestReceivedBuffers();
+
+    TestProgram(200, TRUE);
+    TestProgram(TEST_MAXIMUM_DEPTH, FALSE);
+
+    printf("[+] all of the track trace tests passed\n\n");
+
+    BenchmarkRun();
+
+    return 0;
+}
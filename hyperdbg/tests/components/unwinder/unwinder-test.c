@@ -0,0 +1,707 @@
+/**
+ * @file unwinder-test.c
+ * @author Sina Karvandi (sina@hyperdbg.org)
+ * @brief Unit tests of the x64 stack unwinder
+ * @details A synthetic x64 image (headers, .pdata, unwind infos and the
+ * prologs/epilogs of its functions) and synthetic stacks are built in a
+ * simulated address space, then the frames are unwound and compared with
+ * the frames that were pushed. The number of the memory reads of a walk is
+ * also reported (with and without the module cache). Build and run it from
+ * this directory:
+ *
+ *   gcc -O2 -I. -I../../../include -o unwinder-test \
+ *       unwinder-test.c ../../../include/components/unwinder/code/Unwinder.c
+ *   ./unwinder-test
+ *
+ * @version 0.11
+ * @date 2026-10-17
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+/**
+ * @brief Base address of the synthetic image
+ *
+ */
+#define TEST_IMAGE_BASE 0xfffff80140000000ull
+
+/**
+ * @brief Size of the synthetic image
+ *
+ */
+#define TEST_IMAGE_SIZE 0x8000
+
+/**
+ * @brief The page of the image that is not accessible (e.g., a discarded section)
+ *
+ */
+#define TEST_IMAGE_HOLE 0x2000
+
+/**
+ * @brief RVA of the exception directory
+ *
+ */
+#define TEST_PDATA_RVA 0x4000
+
+/**
+ * @brief RVA of the unwind infos
+ *
+ */
+#define TEST_XDATA_RVA 0x5000
+
+/**
+ * @brief The kernel stack
+ *
+ */
+#define TEST_KERNEL_STACK 0xfffff80200010000ull
+
+/**
+ * @brief The stack of the interrupted code
+ *
+ */
+#define TEST_USER_STACK 0x000000d000020000ull
+
+/**
+ * @brief Size of the stacks
+ *
+ */
+#define TEST_STACK_SIZE 0x2000
+
+//
+// The functions of the image (RVA of the start and the end)
+//
+#define TEST_FUNCTION_A       0x1000 // push rbx, push rsi, sub rsp, 28h
+#define TEST_FUNCTION_A_END   0x1040
+#define TEST_FUNCTION_B       0x1040 // push rbp, push rdi, sub rsp, 100h, lea rbp, [rsp+20h], mov [rsp+0f0h], r12
+#define TEST_FUNCTION_B_END   0x1100
+#define TEST_FUNCTION_C1      0x1100 // push r13, sub rsp, 20h
+#define TEST_FUNCTION_C1_END  0x1140
+#define TEST_FUNCTION_C2      0x1140 // chained to C1, push r14
+#define TEST_FUNCTION_C2_END  0x1180
+#define TEST_FUNCTION_D       0x1200 // interrupt handler, machine frame with error code, push rbp
+#define TEST_FUNCTION_D_END   0x1280
+#define TEST_LEAF             0x1280 // no runtime function
+#define TEST_FUNCTION_E       0x6000 // sub rsp, 38h (after the inaccessible page)
+#define TEST_FUNCTION_E_END   0x6040
+#define TEST_FUNCTION_E2      0x6040 // indirect entry to E
+#define TEST_FUNCTION_E2_END  0x6080
+#define TEST_NUMBER_OF_ENTRIES 7
+
+/**
+ * @brief A region of the simulated address space
+ *
+ */
+typedef struct _TEST_REGION
+{
+    UINT64  Base;
+    UINT32  Size;
+    UINT8 * Data;
+
+} TEST_REGION, *PTEST_REGION;
+
+/**
+ * @brief The simulated address space
+ *
+ */
+TEST_REGION g_TestRegions[4];
+UINT32      g_TestRegionCount;
+UINT64      g_TestReadCount;
+
+#define TEST_CHECK(Condition)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (!(Condition))                                                            \
+        {                                                                            \
+            printf("[x] %s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            exit(1);                                                                 \
+        }                                                                            \
+    } while (0)
+
+/**
+ * @brief Map a region of the address space
+ *
+ * @param Base
+ * @param Size
+ *
+ * @return UINT8 * The content of the region
+ */
+UINT8 *
+TestMapRegion(UINT64 Base, UINT32 Size)
+{
+    PTEST_REGION Region = &g_TestRegions[g_TestRegionCount++];
+
+    Region->Base = Base;
+    Region->Size = Size;
+    Region->Data = calloc(1, Size);
+
+    return Region->Data;
+}
+
+/**
+ * @brief Get the address of the simulated memory
+ *
+ * @param Address
+ * @param Size
+ *
+ * @return UINT8 * NULL if it's not mapped
+ */
+UINT8 *
+TestGetMemory(UINT64 Address, UINT32 Size)
+{
+    for (UINT32 i = 0; i < g_TestRegionCount; i++)
+    {
+        if (Address - g_TestRegions[i].Base < g_TestRegions[i].Size &&
+            Address - g_TestRegions[i].Base + Size <= g_TestRegions[i].Size)
+        {
+            return &g_TestRegions[i].Data[Address - g_TestRegions[i].Base];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Read memory callback of the unwinder
+ *
+ * @param Context
+ * @param Address
+ * @param Buffer
+ * @param Size
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+TestReadMemory(PVOID Context, UINT64 Address, PVOID Buffer, UINT32 Size)
+{
+    UINT8 * Memory = TestGetMemory(Address, Size);
+
+    (void)Context;
+
+    g_TestReadCount++;
+
+    if (Memory == NULL)
+    {
+        return FALSE;
+    }
+
+    memcpy(Buffer, Memory, Size);
+
+    return TRUE;
+}
+
+/**
+ * @brief Write bytes to the simulated memory
+ *
+ * @param Address
+ * @param Bytes
+ * @param Size
+ *
+ * @return VOID
+ */
+VOID
+TestWrite(UINT64 Address, const void * Bytes, UINT32 Size)
+{
+    UINT8 * Memory = TestGetMemory(Address, Size);
+
+    TEST_CHECK(Memory != NULL);
+
+    memcpy(Memory, Bytes, Size);
+}
+
+/**
+ * @brief Write a 16-bit value
+ *
+ */
+VOID
+TestWrite16(UINT64 Address, UINT16 Value)
+{
+    TestWrite(Address, &Value, sizeof(Value));
+}
+
+/**
+ * @brief Write a 32-bit value
+ *
+ */
+VOID
+TestWrite32(UINT64 Address, UINT32 Value)
+{
+    TestWrite(Address, &Value, sizeof(Value));
+}
+
+/**
+ * @brief Write a 64-bit value
+ *
+ */
+VOID
+TestWrite64(UINT64 Address, UINT64 Value)
+{
+    TestWrite(Address, &Value, sizeof(Value));
+}
+
+/**
+ * @brief Make an unwind code
+ *
+ * @param CodeOffset
+ * @param Operation
+ * @param OpInfo
+ *
+ * @return UINT16
+ */
+UINT16
+TestUnwindCode(UINT8 CodeOffset, UINT8 Operation, UINT8 OpInfo)
+{
+    return (UINT16)(CodeOffset | (Operation << 8) | (OpInfo << 12));
+}
+
+/**
+ * @brief Write an unwind info
+ *
+ * @param Rva
+ * @param Flags
+ * @param SizeOfProlog
+ * @param FrameRegister
+ * @param FrameOffset
+ * @param Codes
+ * @param CountOfCodes
+ * @param ChainedFunction The parent function of a chained info (or NULL)
+ *
+ * @return VOID
+ */
+VOID
+TestWriteUnwindInfo(UINT32                     Rva,
+                    UINT8                      Flags,
+                    UINT8                      SizeOfProlog,
+                    UINT8                      FrameRegister,
+                    UINT8                      FrameOffset,
+                    const UINT16 *             Codes,
+                    UINT8                      CountOfCodes,
+                    PUNWINDER_RUNTIME_FUNCTION ChainedFunction)
+{
+    UINT8 Header[4] = {(UINT8)(1 | (Flags << 3)), SizeOfProlog, CountOfCodes, (UINT8)(FrameRegister | (FrameOffset << 4))};
+
+    TestWrite(TEST_IMAGE_BASE + Rva, Header, sizeof(Header));
+
+    for (UINT32 i = 0; i < CountOfCodes; i++)
+    {
+        TestWrite16(TEST_IMAGE_BASE + Rva + 4 + i * 2, Codes[i]);
+    }
+
+    if (ChainedFunction != NULL)
+    {
+        TestWrite(TEST_IMAGE_BASE + Rva + 4 + ((CountOfCodes + 1) & ~1) * 2, ChainedFunction, sizeof(UNWINDER_RUNTIME_FUNCTION));
+    }
+}
+
+/**
+ * @brief Build the synthetic image
+ *
+ * @return VOID
+ */
+VOID
+TestBuildImage()
+{
+    UNWINDER_RUNTIME_FUNCTION Functions[TEST_NUMBER_OF_ENTRIES] = {
+        {TEST_FUNCTION_A, TEST_FUNCTION_A_END, TEST_XDATA_RVA + 0x00},
+        {TEST_FUNCTION_B, TEST_FUNCTION_B_END, TEST_XDATA_RVA + 0x40},
+        {TEST_FUNCTION_C1, TEST_FUNCTION_C1_END, TEST_XDATA_RVA + 0x80},
+        {TEST_FUNCTION_C2, TEST_FUNCTION_C2_END, TEST_XDATA_RVA + 0xc0},
+        {TEST_FUNCTION_D, TEST_FUNCTION_D_END, TEST_XDATA_RVA + 0x100},
+        {TEST_FUNCTION_E, TEST_FUNCTION_E_END, TEST_XDATA_RVA + 0x140},
+        {TEST_FUNCTION_E2, TEST_FUNCTION_E2_END, TEST_PDATA_RVA + 5 * sizeof(UNWINDER_RUNTIME_FUNCTION) + 1},
+    };
+
+    //
+    // push rbx, push rsi, sub rsp, 28h ... add rsp, 28h, pop rsi, pop rbx, ret
+    //
+    const UINT8  CodeA[]         = {0x53, 0x56, 0x48, 0x83, 0xec, 0x28};
+    const UINT8  EpilogA[]       = {0x48, 0x83, 0xc4, 0x28, 0x5e, 0x5b, 0xc3};
+    const UINT16 UnwindCodesA[]  = {TestUnwindCode(6, 2, 4), TestUnwindCode(2, 0, 6), TestUnwindCode(1, 0, 3)};
+
+    //
+    // push rbp, push rdi, sub rsp, 100h, lea rbp, [rsp+20h], mov [rsp+0f0h], r12
+    // ... lea rsp, [rbp+0e0h], pop rdi, pop rbp, ret
+    //
+    const UINT8  CodeB[]         = {0x55, 0x57, 0x48, 0x81, 0xec, 0x00, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x6c, 0x24, 0x20,
+                                    0x4c, 0x89, 0xa4, 0x24, 0xf0, 0x00, 0x00, 0x00};
+    const UINT8  EpilogB[]       = {0x48, 0x8d, 0xa5, 0xe0, 0x00, 0x00, 0x00, 0x5f, 0x5d, 0xc3};
+    const UINT16 UnwindCodesB[]  = {TestUnwindCode(22, 4, 12), 0xf0 / 8, TestUnwindCode(14, 3, 0), TestUnwindCode(9, 1, 0), 0x100 / 8, TestUnwindCode(2, 0, 7), TestUnwindCode(1, 0, 5)};
+
+    //
+    // push r13, sub rsp, 20h (C1), push r14 (C2, a fragment of C1)
+    //
+    const UINT8  CodeC1[]        = {0x41, 0x55, 0x48, 0x83, 0xec, 0x20};
+    const UINT16 UnwindCodesC1[] = {TestUnwindCode(6, 2, 3), TestUnwindCode(2, 0, 13)};
+    const UINT16 UnwindCodesC2[] = {TestUnwindCode(0, 0, 14)};
+
+    //
+    // Machine frame with an error code, push rbp
+    //
+    const UINT16 UnwindCodesD[]  = {TestUnwindCode(1, 0, 5), TestUnwindCode(0, 10, 1)};
+
+    //
+    // sub rsp, 38h
+    //
+    const UINT8  CodeE[]         = {0x48, 0x83, 0xec, 0x38};
+    const UINT16 UnwindCodesE[]  = {TestUnwindCode(4, 2, 6)};
+
+    TestMapRegion(TEST_IMAGE_BASE, TEST_IMAGE_HOLE);
+    TestMapRegion(TEST_IMAGE_BASE + TEST_IMAGE_HOLE + 0x1000, TEST_IMAGE_SIZE - TEST_IMAGE_HOLE - 0x1000);
+
+    //
+    // The code is filled with nops
+    //
+    memset(TestGetMemory(TEST_IMAGE_BASE + 0x1000, 0x1000), 0x90, 0x1000);
+    memset(TestGetMemory(TEST_IMAGE_BASE + 0x6000, 0x1000), 0x90, 0x1000);
+
+    //
+    // DOS header, PE signature, AMD64 file header and PE32+ optional header
+    //
+    TestWrite16(TEST_IMAGE_BASE, 0x5a4d);
+    TestWrite32(TEST_IMAGE_BASE + 0x3c, 0x80);
+    TestWrite32(TEST_IMAGE_BASE + 0x80, 0x00004550);
+    TestWrite16(TEST_IMAGE_BASE + 0x84, 0x8664);
+    TestWrite16(TEST_IMAGE_BASE + 0x94, 0xf0);
+    TestWrite16(TEST_IMAGE_BASE + 0x98, 0x20b);
+    TestWrite32(TEST_IMAGE_BASE + 0x98 + 56, TEST_IMAGE_SIZE);
+    TestWrite32(TEST_IMAGE_BASE + 0x98 + 108, 16);
+    TestWrite32(TEST_IMAGE_BASE + 0x98 + 136, TEST_PDATA_RVA);
+    TestWrite32(TEST_IMAGE_BASE + 0x98 + 140, sizeof(Functions));
+
+    TestWrite(TEST_IMAGE_BASE + TEST_PDATA_RVA, Functions, sizeof(Functions));
+
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_A, CodeA, sizeof(CodeA));
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x30, EpilogA, sizeof(EpilogA));
+    TestWriteUnwindInfo(Functions[0].UnwindData, 0, sizeof(CodeA), 0, 0, UnwindCodesA, 3, NULL);
+
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_B, CodeB, sizeof(CodeB));
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_B + 0xb0, EpilogB, sizeof(EpilogB));
+    TestWriteUnwindInfo(Functions[1].UnwindData, 0, sizeof(CodeB), 5, 2, UnwindCodesB, 7, NULL);
+
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_C1, CodeC1, sizeof(CodeC1));
+    TestWriteUnwindInfo(Functions[2].UnwindData, 0, sizeof(CodeC1), 0, 0, UnwindCodesC1, 2, NULL);
+    TestWriteUnwindInfo(Functions[3].UnwindData, 4, 0, 0, 0, UnwindCodesC2, 1, &Functions[2]);
+
+    TestWriteUnwindInfo(Functions[4].UnwindData, 0, 1, 0, 0, UnwindCodesD, 2, NULL);
+
+    TestWrite(TEST_IMAGE_BASE + TEST_FUNCTION_E, CodeE, sizeof(CodeE));
+    TestWriteUnwindInfo(Functions[5].UnwindData, 0, sizeof(CodeE), 0, 0, UnwindCodesE, 1, NULL);
+
+    TestMapRegion(TEST_KERNEL_STACK, TEST_STACK_SIZE);
+    TestMapRegion(TEST_USER_STACK, TEST_STACK_SIZE);
+}
+
+/**
+ * @brief Make the registers of a frame (all of them are poisoned)
+ *
+ * @param Context
+ * @param Rip
+ * @param Rsp
+ *
+ * @return VOID
+ */
+VOID
+TestMakeContext(PUNWINDER_CONTEXT Context, UINT64 Rip, UINT64 Rsp)
+{
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        Context->Gpr[i] = 0xdead000000000000ull | i;
+    }
+
+    Context->Rip                        = Rip;
+    Context->Gpr[UNWINDER_REGISTER_RSP] = Rsp;
+}
+
+/**
+ * @brief Test the unwinding of single frames
+ *
+ * @return VOID
+ */
+VOID
+TestSingleFrames()
+{
+    UNWINDER         Unwinder;
+    UNWINDER_CONTEXT Context;
+    BOOLEAN          IsMachineFrame;
+    UINT64           Stack = TEST_KERNEL_STACK + 0x1000;
+
+    UnwinderInitialize(&Unwinder, TestReadMemory, NULL);
+
+    //
+    // Partially executed prolog (only 'push rbx' is executed)
+    //
+    TestWrite64(Stack, 0x1111);
+    TestWrite64(Stack + 8, 0x2222);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + 1, Stack);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(!IsMachineFrame && Context.Gpr[3] == 0x1111 && Context.Gpr[6] == (0xdead000000000000ull | 6));
+    TEST_CHECK(Context.Rip == 0x2222 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 16);
+
+    //
+    // Body, epilog (at 'add rsp', at the pops and at the 'ret')
+    //
+    TestWrite64(Stack + 0x28, 0x3333);
+    TestWrite64(Stack + 0x30, 0x4444);
+    TestWrite64(Stack + 0x38, 0x5555);
+
+    UINT32 Offsets[] = {0x10, 0x30};
+
+    for (UINT32 i = 0; i < 2; i++)
+    {
+        TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + Offsets[i], Stack);
+        TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+        TEST_CHECK(Context.Gpr[6] == 0x3333 && Context.Gpr[3] == 0x4444);
+        TEST_CHECK(Context.Rip == 0x5555 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x40);
+    }
+
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x34, Stack + 0x28);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Gpr[6] == 0x3333 && Context.Gpr[3] == 0x4444);
+    TEST_CHECK(Context.Rip == 0x5555 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x40);
+
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x36, Stack + 0x38);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Gpr[6] == (0xdead000000000000ull | 6) && Context.Gpr[3] == (0xdead000000000000ull | 3));
+    TEST_CHECK(Context.Rip == 0x5555 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x40);
+
+    //
+    // A return address after the last instruction of A (the start of B) is in A
+    //
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A_END, Stack);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, TRUE, &IsMachineFrame));
+    TEST_CHECK(Context.Rip == 0x5555 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x40);
+
+    //
+    // Frame register epilog ('lea rsp, [rbp+0e0h]')
+    //
+    TestWrite64(Stack + 0x100, 0x6666);
+    TestWrite64(Stack + 0x108, 0x7777);
+    TestWrite64(Stack + 0x110, 0x8888);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_B + 0xb0, Stack);
+    Context.Gpr[5] = Stack + 0x20;
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Gpr[7] == 0x6666 && Context.Gpr[5] == 0x7777);
+    TEST_CHECK(Context.Rip == 0x8888 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x118);
+
+    //
+    // Frame register is not set yet (after 'sub rsp, 100h')
+    //
+    TestWrite64(Stack + 0x100, 0x6666);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_B + 9, Stack);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Gpr[7] == 0x6666 && Context.Gpr[5] == 0x7777);
+    TEST_CHECK(Context.Rip == 0x8888 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x118);
+
+    //
+    // Indirect entry (E2 uses the unwind info of E)
+    //
+    TestWrite64(Stack + 0x38, 0x9999);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_E2 + 0x10, Stack);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Rip == 0x9999 && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 0x40);
+
+    //
+    // Leaf function
+    //
+    TestWrite64(Stack, 0xaaaa);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_LEAF + 0x10, Stack);
+    TEST_CHECK(UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+    TEST_CHECK(Context.Rip == 0xaaaa && Context.Gpr[UNWINDER_REGISTER_RSP] == Stack + 8);
+
+    //
+    // Not accessible stack
+    //
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x10, 0x1000);
+    TEST_CHECK(!UnwinderStep(&Unwinder, &Context, FALSE, &IsMachineFrame));
+
+    //
+    // Modules are found once (E is after the inaccessible page)
+    //
+    TEST_CHECK(Unwinder.ModuleCount == 1 && Unwinder.Modules[0].ImageBase == TEST_IMAGE_BASE);
+    TEST_CHECK(Unwinder.Modules[0].NumberOfFunctions == TEST_NUMBER_OF_ENTRIES);
+    TEST_CHECK(UnwinderFindModule(&Unwinder, TEST_IMAGE_BASE + TEST_IMAGE_SIZE) == NULL);
+    TEST_CHECK(UnwinderFindModule(&Unwinder, TEST_KERNEL_STACK) == NULL);
+}
+
+/**
+ * @brief Build a stack of all of the functions
+ * @details A <- B <- C2 (chained to C1) <- D (interrupt) <- E <- leaf
+ *
+ * @param Context The registers of the first frame
+ * @param ExpectedFrames The frames that should be unwound
+ *
+ * @return UINT32 Number of the frames
+ */
+UINT32
+TestBuildStack(PUNWINDER_CONTEXT Context, PUNWINDER_FRAME ExpectedFrames)
+{
+    UINT64 Kernel = TEST_KERNEL_STACK + 0x100;
+    UINT64 User   = TEST_USER_STACK + 0x100;
+
+    //
+    // A (rbx, rsi and 28h bytes)
+    //
+    TestWrite64(Kernel + 0x28, 0x56);
+    TestWrite64(Kernel + 0x30, 0x53);
+    TestWrite64(Kernel + 0x38, TEST_IMAGE_BASE + TEST_FUNCTION_B + 0x80);
+
+    //
+    // B (rbp, rdi, 100h bytes, r12 at 0f0h)
+    //
+    TestWrite64(Kernel + 0x40 + 0xf0, 0x412);
+    TestWrite64(Kernel + 0x140, 0x57);
+    TestWrite64(Kernel + 0x148, 0x55);
+    TestWrite64(Kernel + 0x150, TEST_IMAGE_BASE + TEST_FUNCTION_C2 + 0x10);
+
+    //
+    // C2 (r14), C1 (20h bytes and r13)
+    //
+    TestWrite64(Kernel + 0x158, 0x414);
+    TestWrite64(Kernel + 0x180, 0x413);
+    TestWrite64(Kernel + 0x188, TEST_IMAGE_BASE + TEST_FUNCTION_D + 0x50);
+
+    //
+    // D (rbp, error code, machine frame)
+    //
+    TestWrite64(Kernel + 0x190, 0x1055);
+    TestWrite64(Kernel + 0x198, 0xe);
+    TestWrite64(Kernel + 0x1a0, TEST_IMAGE_BASE + TEST_FUNCTION_E + 0x10);
+    TestWrite64(Kernel + 0x1a8, 0x10);
+    TestWrite64(Kernel + 0x1b0, 0x246);
+    TestWrite64(Kernel + 0x1b8, User);
+    TestWrite64(Kernel + 0x1c0, 0x18);
+
+    //
+    // E (38h bytes), then the leaf returns to null
+    //
+    TestWrite64(User + 0x38, TEST_IMAGE_BASE + TEST_LEAF + 0x10);
+    TestWrite64(User + 0x40, 0);
+
+    TestMakeContext(Context, TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x10, Kernel);
+    Context->Gpr[5] = Kernel + 0x60;
+
+    ExpectedFrames[0] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_FUNCTION_A + 0x10, Kernel, FALSE};
+    ExpectedFrames[1] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_FUNCTION_B + 0x80, Kernel + 0x40, FALSE};
+    ExpectedFrames[2] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_FUNCTION_C2 + 0x10, Kernel + 0x158, FALSE};
+    ExpectedFrames[3] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_FUNCTION_D + 0x50, Kernel + 0x190, FALSE};
+    ExpectedFrames[4] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_FUNCTION_E + 0x10, User, TRUE};
+    ExpectedFrames[5] = (UNWINDER_FRAME) {TEST_IMAGE_BASE + TEST_LEAF + 0x10, User + 0x40, FALSE};
+
+    return 6;
+}
+
+/**
+ * @brief Test the walk of a whole stack
+ *
+ * @return VOID
+ */
+VOID
+TestWalkStack()
+{
+    UNWINDER         Unwinder;
+    UNWINDER_CONTEXT Context;
+    UNWINDER_FRAME   Frames[16];
+    UNWINDER_FRAME   ExpectedFrames[16];
+    UINT32           ExpectedCount;
+    UINT32           FrameCount;
+    UINT64           ColdReads;
+
+    UnwinderInitialize(&Unwinder, TestReadMemory, NULL);
+
+    ExpectedCount   = TestBuildStack(&Context, ExpectedFrames);
+    g_TestReadCount = 0;
+    FrameCount      = UnwinderWalkStack(&Unwinder, &Context, Frames, 16);
+    ColdReads       = g_TestReadCount;
+
+    TEST_CHECK(FrameCount == ExpectedCount);
+
+    for (UINT32 i = 0; i < FrameCount; i++)
+    {
+        TEST_CHECK(Frames[i].Rip == ExpectedFrames[i].Rip);
+        TEST_CHECK(Frames[i].Rsp == ExpectedFrames[i].Rsp);
+        TEST_CHECK(Frames[i].IsMachineFrame == ExpectedFrames[i].IsMachineFrame);
+    }
+
+    //
+    // Nonvolatile registers of the last frame
+    //
+    TEST_CHECK(Context.Gpr[3] == 0x53 && Context.Gpr[6] == 0x56 && Context.Gpr[7] == 0x57);
+    TEST_CHECK(Context.Gpr[5] == 0x1055 && Context.Gpr[12] == 0x412 && Context.Gpr[13] == 0x413 && Context.Gpr[14] == 0x414);
+
+    //
+    // Maximum number of the frames
+    //
+    TestBuildStack(&Context, ExpectedFrames);
+    TEST_CHECK(UnwinderWalkStack(&Unwinder, &Context, Frames, 3) == 3);
+    TEST_CHECK(Frames[2].Rip == ExpectedFrames[2].Rip);
+
+    //
+    // The module is cached by the previous walks
+    //
+    TestBuildStack(&Context, ExpectedFrames);
+    g_TestReadCount = 0;
+    TEST_CHECK(UnwinderWalkStack(&Unwinder, &Context, Frames, 16) == ExpectedCount);
+
+    printf("[+] memory reads of a walk of %u frames: %llu (cold), %llu (cached module)\n",
+           ExpectedCount,
+           ColdReads,
+           g_TestReadCount);
+
+    //
+    // A loop in the stack is stopped
+    //
+    TestWrite64(TEST_KERNEL_STACK + 0x800, TEST_IMAGE_BASE + TEST_LEAF + 0x10);
+    TestMakeContext(&Context, TEST_IMAGE_BASE + TEST_LEAF + 0x10, TEST_KERNEL_STACK + 0x800);
+    TEST_CHECK(UnwinderWalkStack(&Unwinder, &Context, Frames, 16) == 2);
+}
+
+/**
+ * @brief Test the unwinding of random garbage (it should never crash)
+ *
+ * @return VOID
+ */
+VOID
+TestGarbage()
+{
+    UNWINDER         Unwinder;
+    UNWINDER_CONTEXT Context;
+    UNWINDER_FRAME   Frames[64];
+    UINT64 *         Stack = (UINT64 *)TestGetMemory(TEST_USER_STACK, TEST_STACK_SIZE);
+
+    srand(1);
+
+    for (UINT32 Iteration = 0; Iteration < 2000; Iteration++)
+    {
+        for (UINT32 i = 0; i < TEST_STACK_SIZE / sizeof(UINT64); i++)
+        {
+            UINT32 Kind = rand() % 4;
+
+            Stack[i] = Kind == 0 ? TEST_IMAGE_BASE + (rand() % TEST_IMAGE_SIZE) : Kind == 1 ? TEST_USER_STACK + (rand() % TEST_STACK_SIZE) : (UINT64)rand() << 20;
+        }
+
+        UnwinderInitialize(&Unwinder, TestReadMemory, NULL);
+        TestMakeContext(&Context, TEST_IMAGE_BASE + 0x1000 + (rand() % 0x400), TEST_USER_STACK + (rand() % TEST_STACK_SIZE));
+
+        TEST_CHECK(UnwinderWalkStack(&Unwinder, &Context, Frames, 64) <= 64);
+    }
+}
+
+/**
+ * @brief Main function
+ *
+ * @return int
+ */
+int
+main()
+{
+    TestBuildImage();
+
+    TestSingleFrames();
+    TestWalkStack();
+    TestGarbage();
+
+    printf("[+] all of the unwinder tests passed\n");
+
+    return 0;
+}